@@ -61,6 +61,10 @@ extern "C" {
 #define TSDB_PERFS_TABLE_OFFSETS     "perf_offsets"
 #define TSDB_PERFS_TABLE_TRANS       "perf_trans"
 #define TSDB_PERFS_TABLE_APPS        "perf_apps"
+#define TSDB_PERFS_TABLE_LAST_CACHE  "perf_last_cache"
+#define TSDB_PERFS_TABLE_PAGE_CACHE  "perf_page_cache"
+#define TSDB_PERFS_TABLE_WRITE_STALL "perf_write_stall"
+#define TSDB_PERFS_TABLE_STT_MERGE   "perf_stt_merge"
 
 typedef struct SSysDbTableSchema {
   const char*   name;
@@ -173,13 +173,31 @@ typedef enum EStreamType {
   STREAM_TRANS_STATE,
 } EStreamType;
 
+#define TSDB_COL_ZONE_PREFIX_LEN 16
+
+// Optional block index of a column, written for the columns created with the BLOOM_FILTER table option. The zone
+// keeps the leading bytes of the min/max value of string columns, the bloom filter is built on the raw value bytes
+// (without the var data header) of every non-null row of the block.
+typedef struct SColumnDataIdx {
+  int16_t              colId;
+  int8_t               hasZone;
+  int8_t               minTrunc;  // minPrefix is a truncated prefix of the min value
+  int8_t               maxTrunc;  // maxPrefix is a truncated prefix of the max value
+  uint8_t              minLen;
+  uint8_t              maxLen;
+  char                 minPrefix[TSDB_COL_ZONE_PREFIX_LEN];
+  char                 maxPrefix[TSDB_COL_ZONE_PREFIX_LEN];
+  struct SBloomFilter* pBloom;
+} SColumnDataIdx;
+
 #pragma pack(push, 1)
 typedef struct SColumnDataAgg {
-  int16_t colId;
-  int16_t numOfNull;
-  int64_t sum;
-  int64_t max;
-  int64_t min;
+  int16_t         colId;
+  int16_t         numOfNull;
+  int64_t         sum;
+  int64_t         max;
+  int64_t         min;
+  SColumnDataIdx* pIdx;  // not serialized, owned by the reader which loads the block sma
 } SColumnDataAgg;
 #pragma pack(pop)
 
@@ -240,6 +258,7 @@ typedef struct SColumnInfoData {
   SColumnInfo info;     // column info
   bool        hasNull;  // if current column data has null value.
   bool        reassigned; // if current column data is reassigned.
+  bool        pooled;     // if pData of the fixed length type is taken from the column buffer pool
 } SColumnInfoData;
 
 typedef struct SQueryTableDataCond {
@@ -362,6 +381,8 @@ typedef struct SSortExecInfo {
   int32_t loops;       // loop count
   int32_t writeBytes;  // write io bytes
   int32_t readBytes;   // read io bytes
+  int64_t rawWriteBytes;  // spilled bytes before compression
+  int64_t stallTime;      // us, waiting for the spill writes
 } SSortExecInfo;
 
 typedef struct SNonSortExecInfo {
@@ -212,6 +212,11 @@ int32_t blockDataToBuf(char* buf, const SSDataBlock* pBlock);
 int32_t blockDataFromBuf(SSDataBlock* pBlock, const char* buf);
 int32_t blockDataFromBuf1(SSDataBlock* pBlock, const char* buf, size_t capacity);
 
+// page codec of the paged buffer, for pages that hold a block serialized by blockDataToBuf
+void*   blockDataCreatePageCodec(const SSDataBlock* pBlock);
+int32_t blockDataEncodePage(const char* pIn, int32_t nIn, char* pOut, int32_t nOut, void* param);
+int32_t blockDataDecodePage(const char* pIn, int32_t nIn, char* pOut, int32_t nOut);
+
 SSDataBlock* blockDataExtractBlock(SSDataBlock* pBlock, int32_t startIndex, int32_t rowCount);
 
 size_t blockDataGetSize(const SSDataBlock* pBlock);
@@ -256,6 +261,11 @@ int32_t blockGetEncodeSize(const SSDataBlock* pBlock);
 int32_t blockEncode(const SSDataBlock* pBlock, char* data, int32_t numOfCols);
 const char* blockDecode(SSDataBlock* pBlock, const char* pData);
 
+// per column compression of the blockEncode payload of a fetch rsp
+int32_t blockCompressEncoded(const char* pIn, int32_t nIn, char* pOut, int32_t nOut);
+int32_t blockGetDecompressedSize(const char* pIn, int32_t nIn);
+int32_t blockDecompressEncoded(const char* pIn, int32_t nIn, char* pOut, int32_t nOut);
+
 // for debug
 char* dumpBlockData(SSDataBlock* pDataBlock, const char* flag, char** dumpBuf, const char* taskIdStr);
 
@@ -44,6 +44,7 @@ extern int32_t  tsNumOfSupportVnodes;
 extern int32_t tsMaxShellConns;
 extern int32_t tsShellActivityTimer;
 extern int32_t tsCompressMsgSize;
+extern int32_t tsFetchCompressSize;
 extern int64_t tsTickPerMin[3];
 extern int64_t tsTickPerHour[3];
 extern int32_t tsCountAlwaysReturnValue;
@@ -54,6 +55,9 @@ extern int32_t tsTagFilterResCacheSize;
 extern int32_t tsNumOfRpcThreads;
 extern int32_t tsNumOfRpcSessions;
 extern int32_t tsTimeToGetAvailableConn;
+extern int32_t tsNumOfRpcMuxConns;
+extern int32_t tsMaxRpcMuxInflight;
+extern int32_t tsRpcShmSize;
 extern int32_t tsKeepAliveIdle;
 extern int32_t tsNumOfCommitThreads;
 extern int32_t tsNumOfTaskQueueThreads;
@@ -64,6 +68,12 @@ extern int32_t tsNumOfVnodeQueryThreads;
 extern float   tsRatioOfVnodeStreamThreads;
 extern int32_t tsNumOfVnodeFetchThreads;
 extern int32_t tsNumOfVnodeRsmaThreads;
+extern int32_t tsNumOfVnodeWriteShards;  // shards a submit is split into when applied to the memtable, 1 means disabled
+extern int32_t tsNumOfCommitFsetWorkers;  // file sets of one commit written concurrently, 1 means disabled
+extern bool    tsVnodeAdaptiveCommit;     // commit before the buffer pool is full when ingest outruns commits
+extern int32_t tsVnodeWriteMaxDelay;      // max ms a write is delayed before the buffer pool stalls, 0 means disabled
+extern bool    tsVnodeNumaBind;          // run the write threads of a vnode on one NUMA node and allocate its memory there
+extern int32_t tsSttMergeMaxWriteAmp;     // max bytes rewritten per new stt byte when a tiered merge goes to the data file
 extern int32_t tsNumOfQnodeQueryThreads;
 extern int32_t tsNumOfQnodeFetchThreads;
 extern int32_t tsNumOfSnodeStreamThreads;
@@ -125,6 +135,12 @@ extern char *   tsSvrCrashReportUri;
 extern int32_t tsQueryBufferSize;  // maximum allowed usage buffer size in MB for each data node during query processing
 extern int64_t tsQueryBufferSizeBytes;    // maximum allowed usage buffer size in byte for each data node
 extern int32_t tsCacheLazyLoadThreshold;  // cost threshold for last/last_row loading cache as much as possible
+extern int32_t tsQueryReadAheadDepth;     // number of file blocks prefetched by each tsdb reader, 0 means disabled
+extern int32_t tsNumOfQueryReadAheadThreads;
+extern int32_t tsHashJoinBufferSize;  // MB, build side memory of one hash join before it spills to disk, 0 means no spill
+extern int32_t tsQueryMemoryLimit;      // MB, memory of all query tasks on one dnode, 0 means half of the total memory
+extern int32_t tsQueryTaskMemoryLimit;  // MB, memory of one query task, 0 means no limit besides tsQueryMemoryLimit
+extern int32_t tsQueryDemoteTime;       // ms of worker time after which a query runs in the low priority class, 0 disables
 
 // query client
 extern int32_t tsQueryPolicy;
@@ -193,6 +209,15 @@ extern int32_t tmqMaxTopicNum;
 
 // wal
 extern int64_t tsWalFsyncDataSizeLimit;
+extern int32_t tsWalGroupCommitWindowUs;  // flush window of the per-disk wal group commit, 0 means disabled
+extern int32_t tsIoUringQueueDepth;       // queue depth of the io_uring file backend, 0 means disabled
+
+// last cache
+extern int32_t tsCacheLastBlockCacheSize;   // MB, block cache of the rocksdb behind the last cache of each vnode
+extern int32_t tsCacheLastWriteBufferSize;  // MB, memtable size of that rocksdb, 0 means the rocksdb default
+
+// tsdb
+extern int32_t tsTsdbPageCacheSize;  // MB, dnode wide cache of tsdb file pages, 0 means disabled
 
 // internal
 extern int32_t tsTransPullupInterval;
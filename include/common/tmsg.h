@@ -147,6 +147,10 @@ typedef enum _mgmt_table {
   TSDB_MGMT_TABLE_VIEWS,
   TSDB_MGMT_TABLE_COMPACT,
   TSDB_MGMT_TABLE_COMPACT_DETAIL,
+  TSDB_MGMT_TABLE_LAST_CACHE,
+  TSDB_MGMT_TABLE_PAGE_CACHE,
+  TSDB_MGMT_TABLE_WRITE_STALL,
+  TSDB_MGMT_TABLE_STT_MERGE,
   TSDB_MGMT_TABLE_MAX,
 } EShowType;
 
@@ -580,6 +584,7 @@ void    tFreeSSubmitRsp(SSubmitRsp* pRsp);
 
 #define COL_SMA_ON     ((int8_t)0x1)
 #define COL_IDX_ON     ((int8_t)0x2)
+#define COL_BLOOM_ON   ((int8_t)0x4)
 #define COL_SET_NULL   ((int8_t)0x10)
 #define COL_SET_VAL    ((int8_t)0x20)
 #define COL_IS_SYSINFO ((int8_t)0x40)
@@ -589,6 +594,7 @@ void    tFreeSSubmitRsp(SSubmitRsp* pRsp);
 
 #define IS_BSMA_ON(s)  (((s)->flags & 0x01) == COL_SMA_ON)
 #define IS_IDX_ON(s)   (((s)->flags & 0x02) == COL_IDX_ON)
+#define IS_BLOOM_ON(s) (((s)->flags & 0x04) == COL_BLOOM_ON)
 #define IS_SET_NULL(s) (((s)->flags & COL_SET_NULL) == COL_SET_NULL)
 
 #define SSCHMEA_SET_IDX_ON(s) \
@@ -1142,6 +1148,7 @@ typedef struct {
   int16_t hashPrefix;
   int16_t hashSuffix;
   int32_t tsdbPageSize;
+  int8_t  sttMergePolicy;
   int32_t sqlLen;
   char*   sql;
 } SCreateDbReq;
@@ -1170,6 +1177,7 @@ typedef struct {
   int32_t minRows;
   int32_t walRetentionPeriod;
   int32_t walRetentionSize;
+  int8_t  sttMergePolicy;
   int32_t sqlLen;
   char*   sql;
 } SAlterDbReq;
@@ -1294,6 +1302,7 @@ typedef struct {
   SArray* pRetensions;
   int8_t  schemaless;
   int16_t sstTrigger;
+  int8_t  sttMergePolicy;
 } SDbCfgRsp;
 
 typedef SDbCfgRsp SDbCfgInfo;
@@ -1518,6 +1527,24 @@ typedef struct {
   int64_t numOfBatchInsertSuccessReqs;
   int32_t numOfCachedTables;
   int32_t learnerProgress;  // use one reservered
+  int64_t lastCacheHit;
+  int64_t lastCacheMiss;
+  int64_t lastCacheEvict;
+  int64_t pageCacheHit;
+  int64_t pageCacheMiss;
+  int64_t bufferUsed;  // bytes of the buffer pool in use
+  int64_t bufferSize;  // bytes of all buffer pools
+  int32_t numOfFreeBufPools;
+  int64_t earlyCommits;
+  int64_t writeStalls;
+  int64_t writeStallTime;  // ms
+  int64_t writeDelays;
+  int64_t writeDelayTime;  // ms
+  int64_t sttMerges;
+  int64_t sttMergesToData;
+  int64_t sttMergeBytesNew;  // bytes of the level-0 stt files merged
+  int64_t sttMergeBytesRead;
+  int64_t sttMergeBytesWritten;
 } SVnodeLoad;
 
 typedef struct {
@@ -1680,6 +1707,7 @@ typedef struct {
   int8_t   learnerSelfIndex;
   SReplica learnerReplicas[TSDB_MAX_LEARNER_REPLICA];
   int32_t  changeVersion;
+  int8_t   sttMergePolicy;
 } SCreateVnodeReq;
 
 int32_t tSerializeSCreateVnodeReq(void* buf, int32_t bufLen, SCreateVnodeReq* pReq);
@@ -1770,6 +1798,7 @@ typedef struct {
   // 2nd modification
   int32_t walRetentionPeriod;
   int32_t walRetentionSize;
+  int8_t  sttMergePolicy;
 } SAlterVnodeConfigReq;
 
 int32_t tSerializeSAlterVnodeConfigReq(void* buf, int32_t bufLen, SAlterVnodeConfigReq* pReq);
@@ -2015,6 +2044,9 @@ typedef struct STableScanAnalyzeInfo {
   uint32_t loadBlockStatis;
   uint32_t skipBlocks;
   uint32_t filterOutBlocks;
+  uint32_t readAheadBlocks;  // file blocks loaded ahead by the tsdb reader
+  uint32_t readAheadHits;    // file blocks loaded ahead that are ready when required
+  uint32_t readAheadWaits;   // file blocks loaded ahead that are still in loading when required
   double   elapsedTime;
   double   filterTime;
 } STableScanAnalyzeInfo;
@@ -2280,6 +2312,7 @@ typedef struct {
   uint64_t        taskId;
   int32_t         execId;
   SOperatorParam* pOpParam;
+  int32_t         compressSize;  // compress the rsp payload column by column if it is larger than this, 0 for never
 } SResFetchReq;
 
 int32_t tSerializeSResFetchReq(void* buf, int32_t bufLen, SResFetchReq* pReq);
@@ -2296,6 +2329,7 @@ typedef struct {
   int64_t  refId;
   int32_t  execId;
   int8_t   status;
+  int64_t  memPeak;
 } STaskStatus;
 
 typedef struct {
@@ -2861,6 +2895,7 @@ typedef struct {
 typedef struct {
   int64_t tid;
   char    status[TSDB_JOB_STATUS_LEN];
+  int64_t memPeak;
 } SQuerySubDesc;
 
 typedef struct {
@@ -2874,6 +2909,7 @@ typedef struct {
   char     fqdn[TSDB_FQDN_LEN];
   int32_t  subPlanNum;
   SArray*  subDesc;  // SArray<SQuerySubDesc>
+  int64_t  memPeak;  // sum of the sub task peaks
 } SQueryDesc;
 
 typedef struct {
@@ -71,6 +71,8 @@ typedef struct SOutputData {
   int32_t numOfCols;
   int8_t  compressed;
   char*   pData;
+  bool    rpcBuf;  // in: take over the sink's rpc buffer through pRsp instead of copying into pData
+  char*   pRsp;    // out: rpc buffer starting with an SRetrieveTableRsp header, valid when rpcBuf is set
   bool    queryEnd;
   int32_t bufStatus;
   int64_t useconds;
@@ -22,6 +22,7 @@ extern "C" {
 
 #include "query.h"
 #include "tcommon.h"
+#include "tmempool.h"
 #include "tmsgcb.h"
 #include "storageapi.h"
 
@@ -185,6 +186,21 @@ void qDestroyTask(qTaskInfo_t tinfo);
 
 void qProcessRspMsg(void* parent, struct SRpcMsg* pMsg, struct SEpSet* pEpSet);
 
+/**
+ * the peak bytes of the column buffers allocated by the task
+ * @param tinfo
+ */
+int64_t qGetTaskMemPeak(qTaskInfo_t tinfo);
+
+/**
+ * charge the memory of the task to a memory budget, the operators spill or fail once the budget refuses them
+ * @param tinfo
+ * @param reserveFp
+ * @param releaseFp
+ * @param param
+ */
+void qSetTaskMemBudget(qTaskInfo_t tinfo, __mem_reserve_fn_t reserveFp, __mem_release_fn_t releaseFp, void* param);
+
 int32_t qGetExplainExecInfo(qTaskInfo_t tinfo, SArray* pExecInfoList);
 
 void getNextTimeWindow(const SInterval* pInterval, STimeWindow* tw, int32_t order);
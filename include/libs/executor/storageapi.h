@@ -175,12 +175,14 @@ typedef struct TsdReader {
 
   int32_t      (*tsdReaderRetrieveBlockSMAInfo)();
   SSDataBlock *(*tsdReaderRetrieveDataBlock)();
+  int32_t      (*tsdReaderRetrieveRemainColumns)(void* pReader, bool load);
 
   void         (*tsdReaderReleaseDataBlock)();
 
   int32_t      (*tsdReaderResetStatus)();
   int32_t      (*tsdReaderGetDataBlockDistInfo)();
   int64_t      (*tsdReaderGetNumOfInMemRows)();
+  void         (*tsdReaderGetReadAheadStat)(void* pReader, STableScanAnalyzeInfo* pInfo);
   void         (*tsdReaderNotifyClosing)();
 
   void         (*tsdSetFilesetDelimited)(void* pReader);
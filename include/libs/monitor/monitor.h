@@ -167,11 +167,35 @@ typedef struct {
   SArray *datadirs;  // array of SMonDiskDesc
 } SMonDiskInfo;
 
+#define MON_WAL_HIST_SIZE 20
+
+typedef struct {
+  int64_t requests;
+  int64_t fsyncs;
+  int64_t depth[MON_WAL_HIST_SIZE];     // bucket i counts group commit batches of [2^i, 2^(i+1)) requests
+  int64_t fsync_us[MON_WAL_HIST_SIZE];  // bucket i counts fsyncs taking [2^i, 2^(i+1)) us
+} SMonWalInfo;
+
+#define MON_WORKER_HIST_SIZE 20
+
+typedef struct {
+  int32_t workers;
+  int32_t queued;  // items waiting in the run queues
+  int64_t items;
+  int64_t steals;  // items taken from other workers
+  int64_t busy_us;
+  int64_t wait_us_high[MON_WORKER_HIST_SIZE];  // bucket i counts items waiting [2^i, 2^(i+1)) us
+  int64_t wait_us_low[MON_WORKER_HIST_SIZE];
+} SMonWorkerInfo;
+
 typedef struct {
-  SMonDiskInfo tfs;
-  SVnodesStat  vstat;
-  SMonSysInfo  sys;
-  SMonLogs     log;
+  SMonDiskInfo   tfs;
+  SVnodesStat    vstat;
+  SMonWalInfo    wal;
+  SMonWorkerInfo query;
+  SMonWorkerInfo fetch;
+  SMonSysInfo    sys;
+  SMonLogs       log;
 } SMonVmInfo;
 
 typedef struct {
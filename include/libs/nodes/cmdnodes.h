@@ -98,6 +98,8 @@ typedef struct SDatabaseOptions {
   bool        walRetentionSizeIsSet;
   bool        walRollPeriodIsSet;
   int32_t     sstTrigger;
+  char        sttMergePolicyStr[TSDB_STT_MERGE_POLICY_STR_LEN];
+  int8_t      sttMergePolicy;
   int32_t     tablePrefix;
   int32_t     tableSuffix;
 } SDatabaseOptions;
@@ -160,6 +162,7 @@ typedef struct STableOptions {
   SNodeList* pRollupFuncs;
   int32_t    ttl;
   SNodeList* pSma;
+  SNodeList* pBloomFilter;
 } STableOptions;
 
 typedef struct SColumnDefNode {
@@ -168,6 +171,7 @@ typedef struct SColumnDefNode {
   SDataType dataType;
   char      comments[TSDB_TB_COMMENT_LEN];
   bool      sma;
+  bool      bloomFilter;
 } SColumnDefNode;
 
 typedef struct SCreateTableStmt {
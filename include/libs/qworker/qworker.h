@@ -55,12 +55,18 @@ typedef struct {
   uint64_t timeInFetchQueue;
 
   uint64_t numOfErrors;
+
+  int64_t  memUsed;       // memory charged by all query tasks of the dnode
+  int64_t  memLimit;
+  uint64_t spillRefused;  // times operators are asked to spill by the memory governor
+  uint64_t allocRefused;  // times allocations of query tasks are refused, the task fails
 } SQWorkerStat;
 
 typedef struct SQWMsgInfo {
-  int8_t taskType;
-  int8_t explain;
-  int8_t needFetch;
+  int8_t  taskType;
+  int8_t  explain;
+  int8_t  needFetch;
+  int32_t compressSize;
 } SQWMsgInfo;
 
 typedef struct SQWMsg {
@@ -48,6 +48,7 @@ typedef struct SRpcHandleInfo {
   int8_t  persistHandle;  // persist handle or not
   int8_t  hasEpSet;
   int32_t cliVer;
+  int32_t reqType;  // msg type of req, set by server
 
   // app info
   void *ahandle;  // app handle set by client
@@ -122,6 +123,9 @@ typedef struct SRpcInit {
   int32_t timeToGetConn;
   int8_t  supportBatch;  // 0: no batch, 1. batch
   int32_t batchSize;
+  int32_t muxConnNum;   // 0: no multiplex, n: share at most n conns per endpoint and thread among concurrent reqs
+  int32_t muxInflight;  // max in-flight reqs on one multiplexed conn
+  int32_t shmSize;      // 0: no shm, n: move msgs of conns to a local peer through a shm ring of n bytes
   void   *parent;
 } SRpcInit;
 
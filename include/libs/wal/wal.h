@@ -124,6 +124,15 @@ typedef struct SWal {
   SWalCkHead writeHead;
 } SWal;
 
+#define WAL_GROUP_COMMIT_HIST_SIZE 20
+
+typedef struct {
+  int64_t nRequest;
+  int64_t nFsync;
+  int64_t depthHist[WAL_GROUP_COMMIT_HIST_SIZE];    // bucket i counts batches of [2^i, 2^(i+1)) requests
+  int64_t latencyHist[WAL_GROUP_COMMIT_HIST_SIZE];  // bucket i counts fsyncs taking [2^i, 2^(i+1)) us
+} SWalGroupCommitStat;
+
 typedef struct {
   int64_t refId;
   int64_t refVer;
@@ -178,6 +187,7 @@ int32_t walWriteWithSyncInfo(SWal *, int64_t index, tmsg_t msgType, SWalSyncInfo
 int64_t walAppendLog(SWal *, int64_t index, tmsg_t msgType, SWalSyncInfo syncMeta, const void *body, int32_t bodyLen);
 
 void walFsync(SWal *, bool force);
+void walGetGroupCommitStat(SWalGroupCommitStat *pStat);
 
 // apis for lifecycle management
 int32_t walCommit(SWal *, int64_t ver);
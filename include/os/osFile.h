@@ -87,6 +87,7 @@ bool    taosCheckExistFile(const char *pathname);
 int64_t taosLSeekFile(TdFilePtr pFile, int64_t offset, int32_t whence);
 int32_t taosFtruncateFile(TdFilePtr pFile, int64_t length);
 int32_t taosFsyncFile(TdFilePtr pFile);
+int32_t taosSyncFsFile(TdFilePtr pFile);
 
 int64_t taosReadFile(TdFilePtr pFile, void *buf, int64_t count);
 int64_t taosPReadFile(TdFilePtr pFile, void *buf, int64_t count, int64_t offset);
@@ -117,6 +118,23 @@ int32_t taosCompressFile(char *srcFileName, char *destFileName);
 
 int32_t taosSetFileHandlesLimit();
 
+// batched file io, served by io_uring when it is enabled and supported by the kernel, otherwise one by one through
+// taosPReadFile/taosPWriteFile
+typedef struct {
+  TdFilePtr pFile;
+  int8_t    write;
+  void     *buf;
+  int64_t   count;
+  int64_t   offset;
+  int64_t   ret;  // bytes transferred, -1 on failure with errno in err
+  int32_t   err;
+} SFileIoReq;
+
+int32_t taosFileIoUringEnable(int32_t queueDepth);
+bool    taosFileIoUringEnabled();
+// execute all requests and wait for them, requests are executed in order if ordered is true
+int32_t taosFileIoSubmit(SFileIoReq *aReq, int32_t nReq, bool ordered);
+
 #ifdef __cplusplus
 }
 #endif
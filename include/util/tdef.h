@@ -397,6 +397,12 @@ typedef enum ELogicConditionType {
 #define TSDB_DEFAULT_SST_TRIGGER 1
 #endif
 #define TSDB_STT_TRIGGER_ARRAY_SIZE     16 // maximum of TSDB_MAX_STT_TRIGGER of TD_ENTERPRISE and TD_COMMUNITY
+#define TSDB_STT_MERGE_POLICY_STR_LEN   sizeof(TSDB_STT_MERGE_POLICY_TIERED_STR)
+#define TSDB_STT_MERGE_POLICY_COUNT_STR  "count"
+#define TSDB_STT_MERGE_POLICY_TIERED_STR "tiered"
+#define TSDB_STT_MERGE_POLICY_COUNT     0
+#define TSDB_STT_MERGE_POLICY_TIERED    1
+#define TSDB_DEFAULT_STT_MERGE_POLICY   TSDB_STT_MERGE_POLICY_COUNT
 #define TSDB_MIN_HASH_PREFIX     (2 - TSDB_TABLE_NAME_LEN)
 #define TSDB_MAX_HASH_PREFIX     (TSDB_TABLE_NAME_LEN - 2)
 #define TSDB_DEFAULT_HASH_PREFIX 0
@@ -28,6 +28,39 @@ char   *taosMemPoolMalloc(mpool_h handle);
 void    taosMemPoolFree(mpool_h handle, char *p);
 void    taosMemPoolCleanUp(mpool_h handle);
 
+/*
+ * Size-classed pool: freed buffers are cached by power-of-two size classes and reused by the later allocations of the
+ * same owner, all cached buffers are released together by taosMemClassPoolCleanUp. Each buffer records its pool in a
+ * header right before the payload, so it must be released by taosMemClassPoolFree, which gives it back to that pool
+ * from any thread. A pool cleaned up with buffers still in use is freed when the last of them is released.
+ */
+#define MEM_CLASS_POOL_ALIGN 32
+
+typedef void *mcpool_h;
+
+/*
+ * Memory control of the pool owner, e.g., the query memory governor. Spillable reservations, like the pages of a
+ * paged buffer, are refused earlier so that the owner spills before the non-spillable memory runs out.
+ */
+typedef bool (*__mem_reserve_fn_t)(void *param, int64_t size, bool spillable);
+typedef void (*__mem_release_fn_t)(void *param, int64_t size);
+
+mcpool_h taosMemClassPoolInit(int64_t maxCacheSize);
+// NULL is returned with terrno TSDB_CODE_QRY_NOT_ENOUGH_BUFFER if the owner refuses the reservation
+void    *taosMemClassPoolMalloc(mcpool_h handle, int64_t size);
+void     taosMemClassPoolFree(void *p);
+void     taosMemClassPoolCleanUp(mcpool_h handle);
+int64_t  taosMemClassPoolUsed(mcpool_h handle);
+int64_t  taosMemClassPoolPeak(mcpool_h handle);
+
+void taosMemClassPoolSetCtrl(mcpool_h handle, __mem_reserve_fn_t reserveFp, __mem_release_fn_t releaseFp, void *param);
+bool taosMemClassPoolReserve(mcpool_h handle, int64_t size, bool spillable);
+void taosMemClassPoolRelease(mcpool_h handle, int64_t size);
+
+// the pool of the task running in current thread, the previous one is returned
+mcpool_h taosMemClassPoolSwitch(mcpool_h handle);
+mcpool_h taosMemClassPoolCurrent();
+
 #ifdef __cplusplus
 }
 #endif
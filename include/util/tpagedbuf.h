@@ -39,8 +39,23 @@ typedef struct SDiskbasedBufStatis {
   int32_t getPages;
   int32_t releasePages;
   int32_t flushPages;
+  int64_t rawFlushBytes;   // flushed bytes before compression
+  int64_t stallTime;       // us, waiting for the in-flight writes to drain
+  int32_t readAheadPages;
+  int32_t readAheadHits;
+  int32_t budgetSpills;    // pages spilled since the memory budget of the query is used up
 } SDiskbasedBufStatis;
 
+/**
+ * Encode a page before it is flushed to disk, return the encoded size, or -1 if the page can not be encoded.
+ */
+typedef int32_t (*__page_encode_fn_t)(const char* pIn, int32_t nIn, char* pOut, int32_t nOut, void* param);
+
+/**
+ * Decode a page encoded by __page_encode_fn_t, return the decoded size, or -1 on error.
+ */
+typedef int32_t (*__page_decode_fn_t)(const char* pIn, int32_t nIn, char* pOut, int32_t nOut);
+
 /**
  * create disk-based result buffer
  * @param pBuf
@@ -151,6 +166,16 @@ void setBufPageDirty(void* pPage, bool dirty);
  */
 void setBufPageCompressOnDisk(SDiskbasedBuf* pBuf, bool comp);
 
+/**
+ * Set the page codec used instead of lz4 when the pages are compressed on disk, e.g., a codec that knows the layout
+ * of the pages. The param is owned by the buffer and freed by taosMemoryFree.
+ * @param pBuf
+ * @param encodeFp
+ * @param decodeFp
+ * @param param
+ */
+void dBufSetPageCodec(SDiskbasedBuf* pBuf, __page_encode_fn_t encodeFp, __page_decode_fn_t decodeFp, void* param);
+
 /**
  * Set the pageId page buffer is not need
  * @param pBuf
@@ -33,6 +33,10 @@ Notes:
 1: taosOpenQueue/taosCloseQueue, taosOpenQset/taosCloseQset is NOT multi-thread safe
 2: after taosCloseQueue/taosCloseQset is called, read/write operation APIs are not safe.
 3: read/write operation APIs are multi-thread safe
+4: writers never lock, items are linked into an intrusive MPSC list. Readers of one queue are
+   serialized by the queue mutex, and readers of a qset wait on a counting semaphore that only
+   enters the kernel after spinning for a while, so a writer only posts when a reader is parked.
+5: a queue shall be added into a qset before any item is written into it
 
 To remove the limitation and make this set of queue APIs multi-thread safe, REF(tref.c)
 shall be used to set up the protection.
@@ -73,14 +77,15 @@ struct STaosQnode {
 };
 
 struct STaosQueue {
-  STaosQnode   *head;
-  STaosQnode   *tail;
+  STaosQnode   *head;     // the oldest node, only accessed by the reader
+  STaosQnode   *tail;     // the newest node, swapped by the writers
+  STaosQnode   *stub;     // dummy node, so that the list is never empty
   STaosQueue   *next;     // for queue set
   STaosQset    *qset;     // for queue set
   void         *ahandle;  // for queue set
   FItem         itemFp;
   FItems        itemsFp;
-  TdThreadMutex mutex;
+  TdThreadMutex mutex;    // serializes the readers
   int64_t       memOfItems;
   int32_t       numOfItems;
   int64_t       threadId;
@@ -93,6 +98,8 @@ struct STaosQset {
   STaosQueue   *current;
   TdThreadMutex mutex;
   tsem_t        sem;
+  int32_t       semCount;   // negative if readers are parked on sem
+  int32_t       spinTimes;  // adaptive, how long a reader spins before it parks
   int32_t       numOfQueues;
   int32_t       numOfItems;
 };
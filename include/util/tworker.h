@@ -64,11 +64,78 @@ typedef struct SWWorkerPool {
   int32_t       max;  // max number of workers
   int32_t       num;
   int32_t       nextId;  // from 0 to max-1, cyclic
+  bool          bindNuma;
+  int32_t       numaNode;  // the workers run on this NUMA node if bindNuma
   const char   *name;
   SWWorker     *workers;
   TdThreadMutex mutex;
 } SWWorkerPool;
 
+/*
+ * Work-stealing pool: every worker owns a run queue per priority class, an idle worker steals from the others before
+ * it parks. The items of one key (e.g. the trace root id of a query) are demoted to the low class once the key has
+ * consumed more than demoteUs of worker time, so short queries are not stuck behind long scans.
+ */
+#define STEAL_WORKER_HIGH     0
+#define STEAL_WORKER_LOW      1
+#define STEAL_WORKER_CLASSES  2
+#define STEAL_WORKER_HIST     20    // bucket i counts items waiting [2^i, 2^(i+1)) us in the run queues
+#define STEAL_WORKER_SVC_SIZE 1024  // slots of the attained service table
+
+typedef struct SStealWorkerPool SStealWorkerPool;
+typedef int64_t (*FItemKey)(void *pItem);
+
+typedef struct {
+  STaosQnode *head;
+  STaosQnode *tail;
+  int32_t     num;
+} SStealRunQueue;
+
+typedef struct {
+  int64_t busyUs;       // time spent in the item callbacks
+  int64_t numOfItems;   // items processed
+  int64_t numOfSteals;  // items taken from other workers
+  int64_t waitHist[STEAL_WORKER_CLASSES][STEAL_WORKER_HIST];
+} SStealWorkerStat;
+
+typedef struct {
+  int32_t          numOfWorkers;
+  int32_t          numOfQueued;  // items waiting in the run queues
+  SStealWorkerStat stat;         // summed over the workers
+} SStealWorkerPoolStat;
+
+typedef struct SStealWorker {
+  int32_t           id;      // worker id
+  int64_t           pid;     // thread pid
+  TdThread          thread;  // thread id
+  SStealWorkerPool *pool;
+  TdThreadMutex     mutex;   // protects the run queues
+  SStealRunQueue    runq[STEAL_WORKER_CLASSES];
+  int32_t           highBurst;  // high class items taken in a row
+  SStealWorkerStat  stat;
+} SStealWorker;
+
+typedef struct {
+  int64_t key;
+  int64_t usedUs;
+} SStealWorkerSvc;
+
+typedef struct SStealWorkerPool {
+  int32_t         num;       // number of workers
+  int32_t         max;       // number of workers allocated, set by tStealWorkerInit
+  int64_t         demoteUs;  // 0 means no priority classes
+  FItemKey        keyFp;     // NULL means no priority classes
+  const char     *name;
+  SStealWorker   *workers;
+  TdThreadMutex   mutex;     // for parking the idle workers
+  TdThreadCond    cond;
+  int32_t         numOfIdle;
+  int32_t         numOfItems;  // items in the run queues
+  int32_t         nextId;
+  int8_t          stop;
+  SStealWorkerSvc svc[STEAL_WORKER_SVC_SIZE];
+} SStealWorkerPool;
+
 int32_t     tQWorkerInit(SQWorkerPool *pool);
 void        tQWorkerCleanup(SQWorkerPool *pool);
 STaosQueue *tQWorkerAllocQueue(SQWorkerPool *pool, void *ahandle, FItem fp);
@@ -79,6 +146,15 @@ void        tAutoQWorkerCleanup(SAutoQWorkerPool *pool);
 STaosQueue *tAutoQWorkerAllocQueue(SAutoQWorkerPool *pool, void *ahandle, FItem fp);
 void        tAutoQWorkerFreeQueue(SAutoQWorkerPool *pool, STaosQueue *queue);
 
+int32_t     tStealWorkerInit(SStealWorkerPool *pool);
+void        tStealWorkerCleanup(SStealWorkerPool *pool);
+STaosQueue *tStealWorkerAllocQueue(SStealWorkerPool *pool, void *ahandle, FItem fp);
+void        tStealWorkerFreeQueue(SStealWorkerPool *pool, STaosQueue *queue);
+int32_t     tStealWorkerWriteQitem(SStealWorkerPool *pool, STaosQueue *queue, void *pItem);
+void        tStealWorkerGetStat(SStealWorkerPool *pool, int32_t workerId, SStealWorkerStat *pStat);
+void        tStealWorkerGetPoolStat(SStealWorkerPool *pool, SStealWorkerPoolStat *pStat);
+void        tStealWorkerReport(SStealWorkerPool *pool);
+
 int32_t     tWWorkerInit(SWWorkerPool *pool);
 void        tWWorkerCleanup(SWWorkerPool *pool);
 STaosQueue *tWWorkerAllocQueue(SWWorkerPool *pool, void *ahandle, FItems fp);
@@ -103,6 +179,8 @@ typedef struct {
   int32_t     max;
   FItems      fp;
   void       *param;
+  bool        bindNuma;
+  int32_t     numaNode;
 } SMultiWorkerCfg;
 
 typedef struct {
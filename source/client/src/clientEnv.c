@@ -177,6 +177,9 @@ void *openTransporter(const char *user, const char *auth, int32_t numOfThread) {
   connLimitNum = TMIN(connLimitNum, 1000);
   rpcInit.connLimitNum = connLimitNum;
   rpcInit.timeToGetConn = tsTimeToGetAvailableConn;
+  rpcInit.muxConnNum = tsNumOfRpcMuxConns;
+  rpcInit.muxInflight = tsMaxRpcMuxInflight;
+  rpcInit.shmSize = tsRpcShmSize;
 
   taosVersionStrToInt(version, &(rpcInit.compatibilityVer));
 
@@ -566,6 +566,10 @@ int32_t hbBuildQueryDesc(SQueryHbReqBasic *hbBasic, STscObj *pObj) {
         desc.subDesc = NULL;
       }
       desc.subPlanNum = taosArrayGetSize(desc.subDesc);
+      for (int32_t i = 0; i < desc.subPlanNum; ++i) {
+        SQuerySubDesc *pSub = taosArrayGet(desc.subDesc, i);
+        desc.memPeak += pSub->memPeak;
+      }
     } else {
       desc.subDesc = NULL;
     }
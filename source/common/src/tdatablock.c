@@ -17,9 +17,44 @@
 #include "tdatablock.h"
 #include "tcompare.h"
 #include "tlog.h"
+#include "tmempool.h"
 #include "tname.h"
 
-#define MALLOC_ALIGN_BYTES 32
+#define MALLOC_ALIGN_BYTES MEM_CLASS_POOL_ALIGN
+
+// payload of the fixed length columns comes from the pool of the running task, if there is one. The pool is recorded
+// with the buffer, so the payload goes back to it in whichever thread the column is destroyed. terrno is set to
+// TSDB_CODE_QRY_NOT_ENOUGH_BUFFER if the task is over its memory budget
+static FORCE_INLINE void* colDataMallocPayload(int64_t size) {
+  return taosMemClassPoolMalloc(taosMemClassPoolCurrent(), size);
+}
+
+static FORCE_INLINE void colDataFreePayload(SColumnInfoData* pColumn) {
+  if (pColumn->pooled) {
+    taosMemClassPoolFree(pColumn->pData);
+    pColumn->pData = NULL;
+    pColumn->pooled = false;
+  } else {
+    taosMemoryFreeClear(pColumn->pData);
+  }
+}
+
+// a payload assigned from outside, e.g., by the udf, is replaced by a pooled one as well
+static int32_t colDataReallocPayload(SColumnInfoData* pColumn, int64_t oldSize, int64_t size) {
+  char* tmp = colDataMallocPayload(size);
+  if (tmp == NULL) {
+    return terrno;  // out of memory, or refused by the memory budget of the task
+  }
+
+  if (pColumn->pData != NULL) {
+    memcpy(tmp, pColumn->pData, oldSize);
+    colDataFreePayload(pColumn);
+  }
+
+  pColumn->pData = tmp;
+  pColumn->pooled = true;
+  return TSDB_CODE_SUCCESS;
+}
 
 int32_t colDataGetLength(const SColumnInfoData* pColumnInfoData, int32_t numOfRows) {
   if (IS_VAR_DATA_TYPE(pColumnInfoData->info.type)) {
@@ -274,8 +309,10 @@ int32_t colDataCopyAndReassign(SColumnInfoData* pColumnInfoData, uint32_t curren
   
   if (numOfRows > 1) {
     int32_t* pOffset = pColumnInfoData->varmeta.offset;
-    memset(&pOffset[currentRow + 1], pOffset[currentRow], sizeof(pOffset[0]) * (numOfRows - 1));
-    pColumnInfoData->reassigned = true;  
+    for (uint32_t i = 1; i < numOfRows; ++i) {
+      pOffset[currentRow + i] = pOffset[currentRow];
+    }
+    pColumnInfoData->reassigned = true;
   }
 
   return TSDB_CODE_SUCCESS;
@@ -411,12 +448,12 @@ int32_t colDataMergeCol(SColumnInfoData* pColumnInfoData, int32_t numOfRow1, int
   } else {
     if (finalNumOfRows > (*capacity)) {
       // all data may be null, when the pColumnInfoData->info.type == 0, bytes == 0;
-      char* tmp = taosMemoryRealloc(pColumnInfoData->pData, finalNumOfRows * pColumnInfoData->info.bytes);
-      if (tmp == NULL) {
-        return TSDB_CODE_OUT_OF_MEMORY;
+      int32_t code = colDataReallocPayload(pColumnInfoData, (int64_t)numOfRow1 * pColumnInfoData->info.bytes,
+                                           (int64_t)finalNumOfRows * pColumnInfoData->info.bytes);
+      if (code != TSDB_CODE_SUCCESS) {
+        return code;
       }
 
-      pColumnInfoData->pData = tmp;
       if (BitmapLen(numOfRow1) < BitmapLen(finalNumOfRows)) {
         char* btmp = taosMemoryRealloc(pColumnInfoData->nullbitmap, BitmapLen(finalNumOfRows));
         if (btmp == NULL) {
@@ -1002,7 +1039,11 @@ static SColumnInfoData* createHelpColInfoData(const SSDataBlock* pDataBlock) {
       pCols[i].varmeta.allocLen = pCols[i].varmeta.length;
     } else {
       pCols[i].nullbitmap = taosMemoryCalloc(1, BitmapLen(rows));
-      pCols[i].pData = taosMemoryCalloc(rows, pCols[i].info.bytes);
+      pCols[i].pData = colDataMallocPayload(rows * pCols[i].info.bytes);
+      if (pCols[i].pData != NULL) {
+        pCols[i].pooled = true;
+        memset(pCols[i].pData, 0, rows * pCols[i].info.bytes);
+      }
     }
   }
 
@@ -1024,8 +1065,9 @@ static void copyBackToBlock(SSDataBlock* pDataBlock, SColumnInfoData* pCols) {
       pColInfoData->nullbitmap = pCols[i].nullbitmap;
     }
 
-    taosMemoryFreeClear(pColInfoData->pData);
+    colDataFreePayload(pColInfoData);
     pColInfoData->pData = pCols[i].pData;
+    pColInfoData->pooled = pCols[i].pooled;
   }
 
   taosMemoryFreeClear(pCols);
@@ -1199,21 +1241,13 @@ static int32_t doEnsureCapacity(SColumnInfoData* pColumn, const SDataBlockInfo*
     }
 
     // here we employ the aligned malloc function, to make sure that the address of allocated memory is aligned
-    // to MALLOC_ALIGN_BYTES
-    tmp = taosMemoryMallocAlign(MALLOC_ALIGN_BYTES, numOfRows * pColumn->info.bytes);
-    if (tmp == NULL) {
-      return TSDB_CODE_OUT_OF_MEMORY;
-    }
-    // memset(tmp, 0, numOfRows * pColumn->info.bytes);
-
-    // copy back the existed data
-    if (pColumn->pData != NULL) {
-      memcpy(tmp, pColumn->pData, existedRows * pColumn->info.bytes);
-      taosMemoryFreeClear(pColumn->pData);
+    // to MALLOC_ALIGN_BYTES, the existed data is copied back
+    int32_t code = colDataReallocPayload(pColumn, (int64_t)existedRows * pColumn->info.bytes,
+                                         (int64_t)numOfRows * pColumn->info.bytes);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
     }
 
-    pColumn->pData = tmp;
-
     // check if the allocated memory is aligned to the requried bytes.
 #if defined LINUX
     if ((((uint64_t)pColumn->pData) & (MALLOC_ALIGN_BYTES - 1)) != 0x0) {
@@ -1222,7 +1256,7 @@ static int32_t doEnsureCapacity(SColumnInfoData* pColumn, const SDataBlockInfo*
 #endif
 
     if (clearPayload) {
-      memset(tmp + pColumn->info.bytes * existedRows, 0, pColumn->info.bytes * (numOfRows - existedRows));
+      memset(pColumn->pData + pColumn->info.bytes * existedRows, 0, pColumn->info.bytes * (numOfRows - existedRows));
     }
   }
 
@@ -1577,7 +1611,7 @@ void colDataDestroy(SColumnInfoData* pColData) {
     taosMemoryFreeClear(pColData->nullbitmap);
   }
 
-  taosMemoryFreeClear(pColData->pData);
+  colDataFreePayload(pColData);
 }
 
 static void doShiftBitmap(char* nullBitmap, size_t n, size_t total) {
@@ -2535,3 +2569,431 @@ int32_t blockDataGetSortedRows(SSDataBlock* pDataBlock, SArray* pOrderInfo) {
   }
   return nextRowIdx;
 }
+
+typedef struct SPageCodecSchema {
+  int32_t numOfCols;
+  int8_t  type[];
+} SPageCodecSchema;
+
+#define PAGE_CODEC_STRING 0
+#define PAGE_CODEC_TYPED  1
+
+void* blockDataCreatePageCodec(const SSDataBlock* pBlock) {
+  int32_t           numOfCols = (int32_t)taosArrayGetSize(pBlock->pDataBlock);
+  SPageCodecSchema* pSchema = taosMemoryMalloc(sizeof(SPageCodecSchema) + numOfCols);
+  if (pSchema == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return NULL;
+  }
+
+  pSchema->numOfCols = numOfCols;
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    SColumnInfoData* pCol = taosArrayGet(pBlock->pDataBlock, i);
+    pSchema->type[i] = pCol->info.type;
+  }
+
+  return pSchema;
+}
+
+// float and double are left to lz4, since the float codecs may be lossy
+static bool pageCodecHasTyped(int8_t type) {
+  switch (type) {
+    case TSDB_DATA_TYPE_TIMESTAMP:
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_UBIGINT:
+    case TSDB_DATA_TYPE_INT:
+    case TSDB_DATA_TYPE_UINT:
+    case TSDB_DATA_TYPE_SMALLINT:
+    case TSDB_DATA_TYPE_USMALLINT:
+    case TSDB_DATA_TYPE_TINYINT:
+    case TSDB_DATA_TYPE_UTINYINT:
+    case TSDB_DATA_TYPE_BOOL:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static int32_t pageCodecCompressTyped(int8_t type, const char* pIn, int32_t nEle, char* pOut, int32_t nOut) {
+  switch (type) {
+    case TSDB_DATA_TYPE_TIMESTAMP:
+      return tsCompressTimestamp((void*)pIn, 0, nEle, pOut, nOut, ONE_STAGE_COMP, NULL, 0);
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_UBIGINT:
+      return tsCompressBigint((void*)pIn, 0, nEle, pOut, nOut, ONE_STAGE_COMP, NULL, 0);
+    case TSDB_DATA_TYPE_INT:
+    case TSDB_DATA_TYPE_UINT:
+      return tsCompressInt((void*)pIn, 0, nEle, pOut, nOut, ONE_STAGE_COMP, NULL, 0);
+    case TSDB_DATA_TYPE_SMALLINT:
+    case TSDB_DATA_TYPE_USMALLINT:
+      return tsCompressSmallint((void*)pIn, 0, nEle, pOut, nOut, ONE_STAGE_COMP, NULL, 0);
+    case TSDB_DATA_TYPE_TINYINT:
+    case TSDB_DATA_TYPE_UTINYINT:
+    case TSDB_DATA_TYPE_BOOL:
+      return tsCompressTinyint((void*)pIn, 0, nEle, pOut, nOut, ONE_STAGE_COMP, NULL, 0);
+    default:
+      return -1;
+  }
+}
+
+static int32_t pageCodecDecompressTyped(int8_t type, const char* pIn, int32_t nIn, int32_t nEle, char* pOut,
+                                        int32_t nOut) {
+  switch (type) {
+    case TSDB_DATA_TYPE_TIMESTAMP:
+      return tsDecompressTimestamp((void*)pIn, nIn, nEle, pOut, nOut, ONE_STAGE_COMP, NULL, 0);
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_UBIGINT:
+      return tsDecompressBigint((void*)pIn, nIn, nEle, pOut, nOut, ONE_STAGE_COMP, NULL, 0);
+    case TSDB_DATA_TYPE_INT:
+    case TSDB_DATA_TYPE_UINT:
+      return tsDecompressInt((void*)pIn, nIn, nEle, pOut, nOut, ONE_STAGE_COMP, NULL, 0);
+    case TSDB_DATA_TYPE_SMALLINT:
+    case TSDB_DATA_TYPE_USMALLINT:
+      return tsDecompressSmallint((void*)pIn, nIn, nEle, pOut, nOut, ONE_STAGE_COMP, NULL, 0);
+    case TSDB_DATA_TYPE_TINYINT:
+    case TSDB_DATA_TYPE_UTINYINT:
+    case TSDB_DATA_TYPE_BOOL:
+      return tsDecompressTinyint((void*)pIn, nIn, nEle, pOut, nOut, ONE_STAGE_COMP, NULL, 0);
+    default:
+      return -1;
+  }
+}
+
+// segment: [int32 raw length][int32 compressed length][compressed data], type PAGE_CODEC_STRING(the null type) for lz4
+static int32_t pageCodecPutSegment(const char* pIn, int32_t len, int8_t type, int32_t nEle, char* pOut, int32_t nOut) {
+  int32_t head = sizeof(int32_t) * 2;
+  // the compressors have no bound check, keep room for the worst case
+  if (nOut < head + len + 32) {
+    return -1;
+  }
+
+  int32_t size = 0;
+  if (len > 0) {
+    size = (type == PAGE_CODEC_STRING) ? tsCompressString((void*)pIn, len, 1, pOut + head, nOut - head, ONE_STAGE_COMP,
+                                                          NULL, 0)
+                                       : pageCodecCompressTyped(type, pIn, nEle, pOut + head, nOut - head);
+    if (size <= 0) {
+      return -1;
+    }
+  }
+
+  *(int32_t*)pOut = len;
+  *(int32_t*)(pOut + sizeof(int32_t)) = size;
+  return head + size;
+}
+
+static int32_t pageCodecGetSegment(const char* pIn, int32_t nIn, int8_t type, int32_t nEle, char* pOut, int32_t nOut,
+                                   int32_t* pLen) {
+  int32_t head = sizeof(int32_t) * 2;
+  if (nIn < head) {
+    return -1;
+  }
+
+  int32_t len = *(int32_t*)pIn;
+  int32_t size = *(int32_t*)(pIn + sizeof(int32_t));
+  if (len < 0 || len > nOut || size < 0 || size > nIn - head) {
+    return -1;
+  }
+
+  if (len > 0) {
+    int32_t n = (type == PAGE_CODEC_STRING) ? tsDecompressString((void*)(pIn + head), size, 1, pOut, len,
+                                                                 ONE_STAGE_COMP, NULL, 0)
+                                            : pageCodecDecompressTyped(type, pIn + head, size, nEle, pOut, len);
+    if (n != len) {
+      return -1;
+    }
+  }
+
+  *pLen = len;
+  return head + size;
+}
+
+/**
+ * The page holds a block serialized by blockDataToBuf, every column is compressed by itself:
+ * [int32 rows][int32 numOfCols]{[int8 type][int8 codec][meta segment][data segment]}...[tail segment]
+ */
+int32_t blockDataEncodePage(const char* pIn, int32_t nIn, char* pOut, int32_t nOut, void* param) {
+  SPageCodecSchema* pSchema = param;
+  if (pSchema == NULL || nIn < sizeof(int32_t) || nOut < sizeof(int32_t) * 2) {
+    return -1;
+  }
+
+  int32_t rows = *(int32_t*)pIn;
+  if (rows < 0) {
+    return -1;
+  }
+
+  const char* pStart = pIn + sizeof(int32_t);
+  const char* pEnd = pIn + nIn;
+  char*       p = pOut;
+  char*       pOutEnd = pOut + nOut;
+
+  *(int32_t*)p = rows;
+  *(int32_t*)(p + sizeof(int32_t)) = pSchema->numOfCols;
+  p += sizeof(int32_t) * 2;
+
+  for (int32_t i = 0; i < pSchema->numOfCols; ++i) {
+    int8_t  type = pSchema->type[i];
+    int32_t metaLen = IS_VAR_DATA_TYPE(type) ? rows * sizeof(int32_t) : BitmapLen(rows);
+    if (pEnd - pStart < metaLen + (int32_t)sizeof(int32_t)) {
+      return -1;
+    }
+
+    const char* pMeta = pStart;
+    int32_t     dataLen = *(int32_t*)(pStart + metaLen);
+    const char* pData = pStart + metaLen + sizeof(int32_t);
+    if (dataLen < 0 || dataLen > pEnd - pData) {
+      return -1;
+    }
+
+    int8_t codec = PAGE_CODEC_STRING;
+    if (pageCodecHasTyped(type) && rows > 0 && dataLen == rows * tDataTypes[type].bytes) {
+      codec = PAGE_CODEC_TYPED;
+    }
+
+    if (pOutEnd - p < 2) {
+      return -1;
+    }
+    p[0] = type;
+    p[1] = codec;
+    p += 2;
+
+    int32_t n = pageCodecPutSegment(pMeta, metaLen, PAGE_CODEC_STRING, 0, p, pOutEnd - p);
+    if (n < 0) {
+      return -1;
+    }
+    p += n;
+
+    n = pageCodecPutSegment(pData, dataLen, (codec == PAGE_CODEC_TYPED) ? type : PAGE_CODEC_STRING, rows, p,
+                            pOutEnd - p);
+    if (n < 0) {
+      return -1;
+    }
+    p += n;
+
+    pStart = pData + dataLen;
+  }
+
+  // the rest of the page is usually empty
+  int32_t n = pageCodecPutSegment(pStart, pEnd - pStart, PAGE_CODEC_STRING, 0, p, pOutEnd - p);
+  if (n < 0) {
+    return -1;
+  }
+
+  return (p + n) - pOut;
+}
+
+int32_t blockDataDecodePage(const char* pIn, int32_t nIn, char* pOut, int32_t nOut) {
+  if (nIn < sizeof(int32_t) * 2 || nOut < sizeof(int32_t)) {
+    return -1;
+  }
+
+  int32_t rows = *(int32_t*)pIn;
+  int32_t numOfCols = *(int32_t*)(pIn + sizeof(int32_t));
+  if (rows < 0 || numOfCols < 0) {
+    return -1;
+  }
+
+  const char* p = pIn + sizeof(int32_t) * 2;
+  const char* pEnd = pIn + nIn;
+  char*       pStart = pOut;
+  char*       pOutEnd = pOut + nOut;
+
+  *(int32_t*)pStart = rows;
+  pStart += sizeof(int32_t);
+
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    if (pEnd - p < 2) {
+      return -1;
+    }
+    int8_t type = p[0];
+    int8_t codec = p[1];
+    p += 2;
+
+    int32_t len = 0;
+    int32_t n = pageCodecGetSegment(p, pEnd - p, PAGE_CODEC_STRING, 0, pStart, pOutEnd - pStart, &len);
+    if (n < 0) {
+      return -1;
+    }
+    p += n;
+    pStart += len;
+
+    if (pOutEnd - pStart < sizeof(int32_t)) {
+      return -1;
+    }
+    char* pDataLen = pStart;
+    pStart += sizeof(int32_t);
+
+    n = pageCodecGetSegment(p, pEnd - p, (codec == PAGE_CODEC_TYPED) ? type : PAGE_CODEC_STRING, rows, pStart,
+                            pOutEnd - pStart, &len);
+    if (n < 0) {
+      return -1;
+    }
+    *(int32_t*)pDataLen = len;
+    p += n;
+    pStart += len;
+  }
+
+  int32_t len = 0;
+  if (pageCodecGetSegment(p, pEnd - p, PAGE_CODEC_STRING, 0, pStart, pOutEnd - pStart, &len) < 0) {
+    return -1;
+  }
+
+  return (pStart + len) - pOut;
+}
+
+/**
+ * Compress the payload of a fetch rsp, which holds one or more blocks serialized by blockEncode. The serial meta of
+ * each block is kept as it is, the columns are compressed one by one:
+ * [int32 raw length]{[serial meta]{[int8 codec][meta segment][data segment]}...}...
+ * Returns -1 if the result does not fit into pOut, the caller is expected to send the payload uncompressed then.
+ */
+int32_t blockCompressEncoded(const char* pIn, int32_t nIn, char* pOut, int32_t nOut) {
+  if (nIn <= 0 || nOut < sizeof(int32_t)) {
+    return -1;
+  }
+
+  const char* pStart = pIn;
+  const char* pEnd = pIn + nIn;
+  char*       p = pOut;
+  char*       pOutEnd = pOut + nOut;
+
+  *(int32_t*)p = nIn;
+  p += sizeof(int32_t);
+
+  while (pStart < pEnd) {
+    if (pEnd - pStart < (int64_t)blockDataGetSerialMetaSize(0)) {
+      return -1;
+    }
+
+    int32_t blockLen = *(int32_t*)(pStart + sizeof(int32_t));
+    int32_t rows = *(int32_t*)(pStart + sizeof(int32_t) * 2);
+    int32_t numOfCols = *(int32_t*)(pStart + sizeof(int32_t) * 3);
+    int32_t metaSize = blockDataGetSerialMetaSize(numOfCols);
+    if (rows < 0 || numOfCols < 0 || blockLen < metaSize || blockLen > pEnd - pStart) {
+      return -1;
+    }
+
+    if (pOutEnd - p < metaSize) {
+      return -1;
+    }
+    memcpy(p, pStart, metaSize);
+    p += metaSize;
+
+    const char*    pSchema = pStart + blockDataGetSerialMetaSize(0);
+    const int32_t* colSizes = (const int32_t*)(pSchema + numOfCols * (sizeof(int8_t) + sizeof(int32_t)));
+    const char*    pCol = pStart + metaSize;
+
+    for (int32_t i = 0; i < numOfCols; ++i) {
+      int8_t  type = *(int8_t*)(pSchema + i * (sizeof(int8_t) + sizeof(int32_t)));
+      int32_t metaLen = IS_VAR_DATA_TYPE(type) ? rows * sizeof(int32_t) : BitmapLen(rows);
+      int32_t dataLen = ntohl(colSizes[i]);
+      if (dataLen < 0 || metaLen + dataLen > pStart + blockLen - pCol) {
+        return -1;
+      }
+
+      int8_t codec = PAGE_CODEC_STRING;
+      if (pageCodecHasTyped(type) && rows > 0 && dataLen == rows * tDataTypes[type].bytes) {
+        codec = PAGE_CODEC_TYPED;
+      }
+
+      if (pOutEnd - p < 1) {
+        return -1;
+      }
+      *p++ = codec;
+
+      int32_t n = pageCodecPutSegment(pCol, metaLen, PAGE_CODEC_STRING, 0, p, pOutEnd - p);
+      if (n < 0) {
+        return -1;
+      }
+      p += n;
+      pCol += metaLen;
+
+      n = pageCodecPutSegment(pCol, dataLen, (codec == PAGE_CODEC_TYPED) ? type : PAGE_CODEC_STRING, rows, p,
+                              pOutEnd - p);
+      if (n < 0) {
+        return -1;
+      }
+      p += n;
+      pCol += dataLen;
+    }
+
+    if (pCol != pStart + blockLen) {
+      return -1;
+    }
+    pStart += blockLen;
+  }
+
+  return p - pOut;
+}
+
+int32_t blockGetDecompressedSize(const char* pIn, int32_t nIn) {
+  if (nIn < sizeof(int32_t)) {
+    return -1;
+  }
+  return *(int32_t*)pIn;
+}
+
+int32_t blockDecompressEncoded(const char* pIn, int32_t nIn, char* pOut, int32_t nOut) {
+  int32_t rawLen = blockGetDecompressedSize(pIn, nIn);
+  if (rawLen < 0 || rawLen > nOut) {
+    return -1;
+  }
+
+  const char* p = pIn + sizeof(int32_t);
+  const char* pEnd = pIn + nIn;
+  char*       pStart = pOut;
+  char*       pOutEnd = pOut + rawLen;
+
+  while (p < pEnd) {
+    if (pEnd - p < (int64_t)blockDataGetSerialMetaSize(0)) {
+      return -1;
+    }
+
+    int32_t blockLen = *(int32_t*)(p + sizeof(int32_t));
+    int32_t rows = *(int32_t*)(p + sizeof(int32_t) * 2);
+    int32_t numOfCols = *(int32_t*)(p + sizeof(int32_t) * 3);
+    int32_t metaSize = blockDataGetSerialMetaSize(numOfCols);
+    if (rows < 0 || numOfCols < 0 || blockLen < metaSize || blockLen > pOutEnd - pStart || metaSize > pEnd - p) {
+      return -1;
+    }
+
+    char* pBlock = pStart;
+    memcpy(pStart, p, metaSize);
+    p += metaSize;
+    pStart += metaSize;
+
+    const char*    pSchema = pBlock + blockDataGetSerialMetaSize(0);
+    const int32_t* colSizes = (const int32_t*)(pSchema + numOfCols * (sizeof(int8_t) + sizeof(int32_t)));
+
+    for (int32_t i = 0; i < numOfCols; ++i) {
+      int8_t type = *(int8_t*)(pSchema + i * (sizeof(int8_t) + sizeof(int32_t)));
+      if (pEnd - p < 1) {
+        return -1;
+      }
+      int8_t codec = *p++;
+
+      int32_t len = 0;
+      int32_t n = pageCodecGetSegment(p, pEnd - p, PAGE_CODEC_STRING, 0, pStart, pBlock + blockLen - pStart, &len);
+      if (n < 0) {
+        return -1;
+      }
+      p += n;
+      pStart += len;
+
+      n = pageCodecGetSegment(p, pEnd - p, (codec == PAGE_CODEC_TYPED) ? type : PAGE_CODEC_STRING, rows, pStart,
+                              pBlock + blockLen - pStart, &len);
+      if (n < 0 || len != (int32_t)ntohl(colSizes[i])) {
+        return -1;
+      }
+      p += n;
+      pStart += len;
+    }
+
+    if (pStart != pBlock + blockLen) {
+      return -1;
+    }
+  }
+
+  return (pStart == pOutEnd) ? rawLen : -1;
+}
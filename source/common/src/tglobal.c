@@ -50,6 +50,11 @@ int32_t tsShellActivityTimer = 3;  // second
 int32_t tsNumOfRpcThreads = 1;
 int32_t tsNumOfRpcSessions = 30000;
 int32_t tsTimeToGetAvailableConn = 500000;
+// 0: one conn per outstanding req, n: client multiplexes reqs on at most n conns per dnode and rpc thread
+int32_t tsNumOfRpcMuxConns = 0;
+int32_t tsMaxRpcMuxInflight = 256;
+// 0: no shm, n: conns between client and taosd on the same host move msgs through a shm ring of n bytes
+int32_t tsRpcShmSize = 0;
 int32_t tsKeepAliveIdle = 60;
 
 int32_t tsNumOfCommitThreads = 2;
@@ -61,6 +66,12 @@ int32_t tsNumOfVnodeQueryThreads = 4;
 float   tsRatioOfVnodeStreamThreads = 4.0;
 int32_t tsNumOfVnodeFetchThreads = 4;
 int32_t tsNumOfVnodeRsmaThreads = 2;
+int32_t tsNumOfVnodeWriteShards = 1;
+int32_t tsNumOfCommitFsetWorkers = 1;
+bool    tsVnodeAdaptiveCommit = false;
+int32_t tsVnodeWriteMaxDelay = 0;
+bool    tsVnodeNumaBind = false;
+int32_t tsSttMergeMaxWriteAmp = 8;
 int32_t tsNumOfQnodeQueryThreads = 4;
 int32_t tsNumOfQnodeFetchThreads = 1;
 int32_t tsNumOfSnodeStreamThreads = 4;
@@ -172,6 +183,10 @@ int32_t tsTimeSeriesThreshold = 50;
  */
 int32_t tsCompressMsgSize = -1;
 
+// the client asks for the fetched blocks to be compressed column by column once the rsp payload is larger than this,
+// 0 means no compression of query results
+int32_t tsFetchCompressSize = 0;
+
 // count/hyperloglog function always return values in case of all NULL data or Empty data set.
 int32_t tsCountAlwaysReturnValue = 1;
 
@@ -195,6 +210,12 @@ char    tsTagFilterCache = 0;
 int32_t tsQueryBufferSize = -1;
 int64_t tsQueryBufferSizeBytes = -1;
 int32_t tsCacheLazyLoadThreshold = 500;
+int32_t tsQueryReadAheadDepth = 0;
+int32_t tsNumOfQueryReadAheadThreads = 2;
+int32_t tsHashJoinBufferSize = 1024;
+int32_t tsQueryMemoryLimit = 0;
+int32_t tsQueryTaskMemoryLimit = 0;
+int32_t tsQueryDemoteTime = 1000;
 
 int32_t  tsDiskCfgNum = 0;
 SDiskCfg tsDiskCfg[TFS_MAX_DISKS] = {0};
@@ -238,6 +259,15 @@ bool    tsStartUdfd = true;
 
 // wal
 int64_t tsWalFsyncDataSizeLimit = (100 * 1024 * 1024L);
+int32_t tsWalGroupCommitWindowUs = 0;
+int32_t tsIoUringQueueDepth = 0;
+
+// last cache
+int32_t tsCacheLastBlockCacheSize = 5;
+int32_t tsCacheLastWriteBufferSize = 0;
+
+// tsdb
+int32_t tsTsdbPageCacheSize = 64;
 
 // ttl
 bool    tsTtlChangeOnWrite = false;  // if true, ttl delete time changes on last write
@@ -469,6 +499,12 @@ static int32_t taosAddClientCfg(SConfig *pCfg) {
     return -1;
   if (cfgAddInt32(pCfg, "compressMsgSize", tsCompressMsgSize, -1, 100000000, CFG_SCOPE_BOTH, CFG_DYN_CLIENT) != 0)
     return -1;
+  if (cfgAddInt32(pCfg, "fetchCompressSize", tsFetchCompressSize, 0, 100000000, CFG_SCOPE_CLIENT, CFG_DYN_CLIENT) != 0)
+    return -1;
+  if (cfgAddInt32(pCfg, "numOfRpcMuxConns", tsNumOfRpcMuxConns, 0, 64, CFG_SCOPE_CLIENT, CFG_DYN_NONE) != 0) return -1;
+  if (cfgAddInt32(pCfg, "maxRpcMuxInflight", tsMaxRpcMuxInflight, 1, 65536, CFG_SCOPE_CLIENT, CFG_DYN_NONE) != 0)
+    return -1;
+  if (cfgAddInt32(pCfg, "rpcShmSize", tsRpcShmSize, 0, 1073741824, CFG_SCOPE_BOTH, CFG_DYN_NONE) != 0) return -1;
   if (cfgAddInt32(pCfg, "queryPolicy", tsQueryPolicy, 1, 4, CFG_SCOPE_CLIENT, CFG_DYN_ENT_CLIENT) != 0) return -1;
   if (cfgAddBool(pCfg, "enableQueryHb", tsEnableQueryHb, CFG_SCOPE_CLIENT, CFG_DYN_CLIENT) != 0) return -1;
   if (cfgAddBool(pCfg, "enableScience", tsEnableScience, CFG_SCOPE_CLIENT, CFG_DYN_NONE) != 0) return -1;
@@ -636,6 +672,17 @@ static int32_t taosAddServerCfg(SConfig *pCfg) {
   if (cfgAddInt32(pCfg, "numOfVnodeRsmaThreads", tsNumOfVnodeRsmaThreads, 1, 1024, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0)
     return -1;
 
+  if (cfgAddInt32(pCfg, "numOfVnodeWriteShards", tsNumOfVnodeWriteShards, 1, 64, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0)
+    return -1;
+  if (cfgAddInt32(pCfg, "numOfCommitFsetWorkers", tsNumOfCommitFsetWorkers, 1, 64, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0)
+    return -1;
+  if (cfgAddBool(pCfg, "vnodeAdaptiveCommit", tsVnodeAdaptiveCommit, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0) return -1;
+  if (cfgAddInt32(pCfg, "vnodeWriteMaxDelay", tsVnodeWriteMaxDelay, 0, 1000, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0)
+    return -1;
+  if (cfgAddBool(pCfg, "vnodeNumaBind", tsVnodeNumaBind, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0) return -1;
+  if (cfgAddInt32(pCfg, "sttMergeMaxWriteAmp", tsSttMergeMaxWriteAmp, 1, 1024, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0)
+    return -1;
+
   tsNumOfQnodeQueryThreads = tsNumOfCores * 2;
   tsNumOfQnodeQueryThreads = TMAX(tsNumOfQnodeQueryThreads, 4);
   if (cfgAddInt32(pCfg, "numOfQnodeQueryThreads", tsNumOfQnodeQueryThreads, 4, 1024, CFG_SCOPE_SERVER, CFG_DYN_NONE) !=
@@ -739,6 +786,19 @@ static int32_t taosAddServerCfg(SConfig *pCfg) {
   if (cfgAddInt64(pCfg, "walFsyncDataSizeLimit", tsWalFsyncDataSizeLimit, 100 * 1024 * 1024, INT64_MAX,
                   CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0)
     return -1;
+  if (cfgAddInt32(pCfg, "walGroupCommitWindowUs", tsWalGroupCommitWindowUs, 0, 100000, CFG_SCOPE_SERVER,
+                  CFG_DYN_ENT_SERVER) != 0)
+    return -1;
+  if (cfgAddInt32(pCfg, "ioUringQueueDepth", tsIoUringQueueDepth, 0, 4096, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0)
+    return -1;
+  if (cfgAddInt32(pCfg, "cacheLastBlockCacheSize", tsCacheLastBlockCacheSize, 1, 65536, CFG_SCOPE_SERVER,
+                  CFG_DYN_NONE) != 0)
+    return -1;
+  if (cfgAddInt32(pCfg, "cacheLastWriteBufferSize", tsCacheLastWriteBufferSize, 0, 4096, CFG_SCOPE_SERVER,
+                  CFG_DYN_NONE) != 0)
+    return -1;
+  if (cfgAddInt32(pCfg, "tsdbPageCacheSize", tsTsdbPageCacheSize, 0, 1048576, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0)
+    return -1;
 
   if (cfgAddBool(pCfg, "udf", tsStartUdfd, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0) return -1;
   if (cfgAddString(pCfg, "udfdResFuncs", tsUdfdResFuncs, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0) return -1;
@@ -756,6 +816,23 @@ static int32_t taosAddServerCfg(SConfig *pCfg) {
   if (cfgAddInt32(pCfg, "cacheLazyLoadThreshold", tsCacheLazyLoadThreshold, 0, 100000, CFG_SCOPE_SERVER,
                   CFG_DYN_ENT_SERVER) != 0)
     return -1;
+  if (cfgAddInt32(pCfg, "queryReadAheadDepth", tsQueryReadAheadDepth, 0, 64, CFG_SCOPE_SERVER, CFG_DYN_ENT_SERVER) !=
+      0)
+    return -1;
+  if (cfgAddInt32(pCfg, "numOfQueryReadAheadThreads", tsNumOfQueryReadAheadThreads, 1, 256, CFG_SCOPE_SERVER,
+                  CFG_DYN_NONE) != 0)
+    return -1;
+  if (cfgAddInt32(pCfg, "hashJoinBufferSize", tsHashJoinBufferSize, 0, 1048576, CFG_SCOPE_SERVER,
+                  CFG_DYN_ENT_SERVER) != 0)
+    return -1;
+  if (cfgAddInt32(pCfg, "queryMemoryLimit", tsQueryMemoryLimit, 0, INT32_MAX, CFG_SCOPE_SERVER, CFG_DYN_ENT_SERVER) !=
+      0)
+    return -1;
+  if (cfgAddInt32(pCfg, "queryTaskMemoryLimit", tsQueryTaskMemoryLimit, 0, INT32_MAX, CFG_SCOPE_SERVER,
+                  CFG_DYN_ENT_SERVER) != 0)
+    return -1;
+  if (cfgAddInt32(pCfg, "queryDemoteTime", tsQueryDemoteTime, 0, 3600000, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0)
+    return -1;
 
   if (cfgAddString(pCfg, "lossyColumns", tsLossyColumns, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0) return -1;
   if (cfgAddFloat(pCfg, "fPrecision", tsFPrecision, 0.0f, 100000.0f, CFG_SCOPE_SERVER, CFG_DYN_NONE) != 0) return -1;
@@ -1061,6 +1138,10 @@ static int32_t taosSetClientCfg(SConfig *pCfg) {
   tsShellActivityTimer = cfgGetItem(pCfg, "shellActivityTimer")->i32;
   tsCompressMsgSize = cfgGetItem(pCfg, "compressMsgSize")->i32;
   tsNumOfTaskQueueThreads = cfgGetItem(pCfg, "numOfTaskQueueThreads")->i32;
+  tsFetchCompressSize = cfgGetItem(pCfg, "fetchCompressSize")->i32;
+  tsNumOfRpcMuxConns = cfgGetItem(pCfg, "numOfRpcMuxConns")->i32;
+  tsMaxRpcMuxInflight = cfgGetItem(pCfg, "maxRpcMuxInflight")->i32;
+  tsRpcShmSize = cfgGetItem(pCfg, "rpcShmSize")->i32;
   tsQueryPolicy = cfgGetItem(pCfg, "queryPolicy")->i32;
   tsEnableQueryHb = cfgGetItem(pCfg, "enableQueryHb")->bval;
   tsEnableScience = cfgGetItem(pCfg, "enableScience")->bval;
@@ -1132,6 +1213,12 @@ static int32_t taosSetServerCfg(SConfig *pCfg) {
   tsRatioOfVnodeStreamThreads = cfgGetItem(pCfg, "ratioOfVnodeStreamThreads")->fval;
   tsNumOfVnodeFetchThreads = cfgGetItem(pCfg, "numOfVnodeFetchThreads")->i32;
   tsNumOfVnodeRsmaThreads = cfgGetItem(pCfg, "numOfVnodeRsmaThreads")->i32;
+  tsNumOfVnodeWriteShards = cfgGetItem(pCfg, "numOfVnodeWriteShards")->i32;
+  tsNumOfCommitFsetWorkers = cfgGetItem(pCfg, "numOfCommitFsetWorkers")->i32;
+  tsVnodeAdaptiveCommit = cfgGetItem(pCfg, "vnodeAdaptiveCommit")->bval;
+  tsVnodeWriteMaxDelay = cfgGetItem(pCfg, "vnodeWriteMaxDelay")->i32;
+  tsVnodeNumaBind = cfgGetItem(pCfg, "vnodeNumaBind")->bval;
+  tsSttMergeMaxWriteAmp = cfgGetItem(pCfg, "sttMergeMaxWriteAmp")->i32;
   tsNumOfQnodeQueryThreads = cfgGetItem(pCfg, "numOfQnodeQueryThreads")->i32;
   //  tsNumOfQnodeFetchThreads = cfgGetItem(pCfg, "numOfQnodeFetchTereads")->i32;
   tsNumOfSnodeStreamThreads = cfgGetItem(pCfg, "numOfSnodeSharedThreads")->i32;
@@ -1178,6 +1265,15 @@ static int32_t taosSetServerCfg(SConfig *pCfg) {
   tsTimeSeriesThreshold = cfgGetItem(pCfg, "timeseriesThreshold")->i32;
 
   tsWalFsyncDataSizeLimit = cfgGetItem(pCfg, "walFsyncDataSizeLimit")->i64;
+  tsWalGroupCommitWindowUs = cfgGetItem(pCfg, "walGroupCommitWindowUs")->i32;
+  tsIoUringQueueDepth = cfgGetItem(pCfg, "ioUringQueueDepth")->i32;
+  if (taosFileIoUringEnable(tsIoUringQueueDepth) != 0) {
+    uWarn("io_uring is not supported on this platform, ioUringQueueDepth:%d is ignored", tsIoUringQueueDepth);
+    tsIoUringQueueDepth = 0;
+  }
+  tsCacheLastBlockCacheSize = cfgGetItem(pCfg, "cacheLastBlockCacheSize")->i32;
+  tsCacheLastWriteBufferSize = cfgGetItem(pCfg, "cacheLastWriteBufferSize")->i32;
+  tsTsdbPageCacheSize = cfgGetItem(pCfg, "tsdbPageCacheSize")->i32;
 
   tsElectInterval = cfgGetItem(pCfg, "syncElectInterval")->i32;
   tsHeartbeatInterval = cfgGetItem(pCfg, "syncHeartbeatInterval")->i32;
@@ -1197,6 +1293,12 @@ static int32_t taosSetServerCfg(SConfig *pCfg) {
   }
 
   tsCacheLazyLoadThreshold = cfgGetItem(pCfg, "cacheLazyLoadThreshold")->i32;
+  tsQueryReadAheadDepth = cfgGetItem(pCfg, "queryReadAheadDepth")->i32;
+  tsNumOfQueryReadAheadThreads = cfgGetItem(pCfg, "numOfQueryReadAheadThreads")->i32;
+  tsHashJoinBufferSize = cfgGetItem(pCfg, "hashJoinBufferSize")->i32;
+  tsQueryMemoryLimit = cfgGetItem(pCfg, "queryMemoryLimit")->i32;
+  tsQueryTaskMemoryLimit = cfgGetItem(pCfg, "queryTaskMemoryLimit")->i32;
+  tsQueryDemoteTime = cfgGetItem(pCfg, "queryDemoteTime")->i32;
 
   tstrncpy(tsLossyColumns, cfgGetItem(pCfg, "lossyColumns")->str, sizeof(tsLossyColumns));
   tsFPrecision = cfgGetItem(pCfg, "fPrecision")->fval;
@@ -1475,15 +1577,20 @@ static int32_t taosCfgDynamicOptionsForServer(SConfig *pCfg, char *name) {
 
         {"cacheLazyLoadThreshold", &tsCacheLazyLoadThreshold},
         {"checkpointInterval", &tsStreamCheckpointInterval},
+        {"hashJoinBufferSize", &tsHashJoinBufferSize},
         {"keepAliveIdle", &tsKeepAliveIdle},
         {"logKeepDays", &tsLogKeepDays},
         {"maxStreamBackendCache", &tsMaxStreamBackendCache},
         {"mqRebalanceInterval", &tsMqRebalanceInterval},
         {"numOfLogLines", &tsNumOfLogLines},
+        {"queryMemoryLimit", &tsQueryMemoryLimit},
+        {"queryReadAheadDepth", &tsQueryReadAheadDepth},
         {"queryRspPolicy", &tsQueryRspPolicy},
+        {"queryTaskMemoryLimit", &tsQueryTaskMemoryLimit},
         {"timeseriesThreshold", &tsTimeSeriesThreshold},
         {"tmqMaxTopicNum", &tmqMaxTopicNum},
         {"transPullupInterval", &tsTransPullupInterval},
+        {"walGroupCommitWindowUs", &tsWalGroupCommitWindowUs},
         {"compactPullupInterval", &tsCompactPullupInterval},
         {"trimVDbIntervalSec", &tsTrimVDbIntervalSec},
         {"ttlBatchDropNum", &tsTtlBatchDropNum},
@@ -1701,6 +1808,7 @@ static int32_t taosCfgDynamicOptionsForClient(SConfig *pCfg, char *name) {
         {"crashReporting", &tsEnableCrashReport},
         {"enableCoreFile", &tsAsyncLog},
         {"enableQueryHb", &tsEnableQueryHb},
+        {"fetchCompressSize", &tsFetchCompressSize},
         {"keepColumnName", &tsKeepColumnName},
         {"keepAliveIdle", &tsKeepAliveIdle},
         {"logKeepDays", &tsLogKeepDays},
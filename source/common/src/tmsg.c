@@ -459,6 +459,17 @@ int32_t tSerializeSClientHbBatchReq(void *buf, int32_t bufLen, const SClientHbBa
     SClientHbReq *pReq = taosArrayGet(pBatchReq->reqs, i);
     if (tSerializeSClientHbReq(&encoder, pReq) < 0) return -1;
   }
+
+  // appended after all reqs to stay compatible with the old decoders
+  for (int32_t i = 0; i < reqNum; i++) {
+    SClientHbReq *pReq = taosArrayGet(pBatchReq->reqs, i);
+    if (pReq->connKey.connType != CONN_TYPE__QUERY || pReq->query == NULL) continue;
+    int32_t num = taosArrayGetSize(pReq->query->queryDesc);
+    for (int32_t j = 0; j < num; ++j) {
+      SQueryDesc *desc = taosArrayGet(pReq->query->queryDesc, j);
+      if (tEncodeI64(&encoder, desc->memPeak) < 0) return -1;
+    }
+  }
   tEndEncode(&encoder);
 
   int32_t tlen = encoder.pos;
@@ -485,6 +496,18 @@ int32_t tDeserializeSClientHbBatchReq(void *buf, int32_t bufLen, SClientHbBatchR
     taosArrayPush(pBatchReq->reqs, &req);
   }
 
+  if (!tDecodeIsEnd(&decoder)) {
+    for (int32_t i = 0; i < reqNum; i++) {
+      SClientHbReq *pReq = taosArrayGet(pBatchReq->reqs, i);
+      if (pReq->connKey.connType != CONN_TYPE__QUERY || pReq->query == NULL) continue;
+      int32_t num = taosArrayGetSize(pReq->query->queryDesc);
+      for (int32_t j = 0; j < num; ++j) {
+        SQueryDesc *desc = taosArrayGet(pReq->query->queryDesc, j);
+        if (tDecodeI64(&decoder, &desc->memPeak) < 0) return -1;
+      }
+    }
+  }
+
   tEndDecode(&decoder);
   tDecoderClear(&decoder);
   return 0;
@@ -1221,14 +1244,43 @@ int32_t tSerializeSStatusReq(void *buf, int32_t bufLen, SStatusReq *pReq) {
   // vnode extra
   for (int32_t i = 0; i < vlen; ++i) {
     SVnodeLoad *pload = taosArrayGet(pReq->pVloads, i);
-    int64_t     reserved = 0;
     if (tEncodeI64(&encoder, pload->syncTerm) < 0) return -1;
-    if (tEncodeI64(&encoder, reserved) < 0) return -1;
-    if (tEncodeI64(&encoder, reserved) < 0) return -1;
-    if (tEncodeI64(&encoder, reserved) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->lastCacheHit) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->lastCacheMiss) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->lastCacheEvict) < 0) return -1;
   }
 
   if (tEncodeI64(&encoder, pReq->ipWhiteVer) < 0) return -1;
+
+  // vnode page cache
+  for (int32_t i = 0; i < vlen; ++i) {
+    SVnodeLoad *pload = taosArrayGet(pReq->pVloads, i);
+    if (tEncodeI64(&encoder, pload->pageCacheHit) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->pageCacheMiss) < 0) return -1;
+  }
+
+  // vnode write stall
+  for (int32_t i = 0; i < vlen; ++i) {
+    SVnodeLoad *pload = taosArrayGet(pReq->pVloads, i);
+    if (tEncodeI64(&encoder, pload->bufferUsed) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->bufferSize) < 0) return -1;
+    if (tEncodeI32(&encoder, pload->numOfFreeBufPools) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->earlyCommits) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->writeStalls) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->writeStallTime) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->writeDelays) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->writeDelayTime) < 0) return -1;
+  }
+
+  // vnode stt merge
+  for (int32_t i = 0; i < vlen; ++i) {
+    SVnodeLoad *pload = taosArrayGet(pReq->pVloads, i);
+    if (tEncodeI64(&encoder, pload->sttMerges) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->sttMergesToData) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->sttMergeBytesNew) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->sttMergeBytesRead) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->sttMergeBytesWritten) < 0) return -1;
+  }
   tEndEncode(&encoder);
 
   int32_t tlen = encoder.pos;
@@ -1332,17 +1384,52 @@ int32_t tDeserializeSStatusReq(void *buf, int32_t bufLen, SStatusReq *pReq) {
   if (!tDecodeIsEnd(&decoder)) {
     for (int32_t i = 0; i < vlen; ++i) {
       SVnodeLoad *pLoad = taosArrayGet(pReq->pVloads, i);
-      int64_t     reserved = 0;
       if (tDecodeI64(&decoder, &pLoad->syncTerm) < 0) return -1;
-      if (tDecodeI64(&decoder, &reserved) < 0) return -1;
-      if (tDecodeI64(&decoder, &reserved) < 0) return -1;
-      if (tDecodeI64(&decoder, &reserved) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->lastCacheHit) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->lastCacheMiss) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->lastCacheEvict) < 0) return -1;
     }
   }
   if (!tDecodeIsEnd(&decoder)) {
     if (tDecodeI64(&decoder, &pReq->ipWhiteVer) < 0) return -1;
   }
 
+  // vnode page cache
+  if (!tDecodeIsEnd(&decoder)) {
+    for (int32_t i = 0; i < vlen; ++i) {
+      SVnodeLoad *pLoad = taosArrayGet(pReq->pVloads, i);
+      if (tDecodeI64(&decoder, &pLoad->pageCacheHit) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->pageCacheMiss) < 0) return -1;
+    }
+  }
+
+  // vnode write stall
+  if (!tDecodeIsEnd(&decoder)) {
+    for (int32_t i = 0; i < vlen; ++i) {
+      SVnodeLoad *pLoad = taosArrayGet(pReq->pVloads, i);
+      if (tDecodeI64(&decoder, &pLoad->bufferUsed) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->bufferSize) < 0) return -1;
+      if (tDecodeI32(&decoder, &pLoad->numOfFreeBufPools) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->earlyCommits) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->writeStalls) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->writeStallTime) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->writeDelays) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->writeDelayTime) < 0) return -1;
+    }
+  }
+
+  // vnode stt merge
+  if (!tDecodeIsEnd(&decoder)) {
+    for (int32_t i = 0; i < vlen; ++i) {
+      SVnodeLoad *pLoad = taosArrayGet(pReq->pVloads, i);
+      if (tDecodeI64(&decoder, &pLoad->sttMerges) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->sttMergesToData) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->sttMergeBytesNew) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->sttMergeBytesRead) < 0) return -1;
+      if (tDecodeI64(&decoder, &pLoad->sttMergeBytesWritten) < 0) return -1;
+    }
+  }
+
   tEndDecode(&decoder);
   tDecoderClear(&decoder);
   return 0;
@@ -2948,6 +3035,11 @@ int32_t tSerializeSCreateDbReq(void *buf, int32_t bufLen, SCreateDbReq *pReq) {
   if (tEncodeI32(&encoder, pReq->keepTimeOffset) < 0) return -1;
 
   ENCODESQL();
+  // fields after the sql need the sql slot to be present
+  if (pReq->sqlLen <= 0 || pReq->sql == NULL) {
+    if (tEncodeI32(&encoder, 0) < 0) return -1;
+  }
+  if (tEncodeI8(&encoder, pReq->sttMergePolicy) < 0) return -1;
   tEndEncode(&encoder);
 
   int32_t tlen = encoder.pos;
@@ -3017,6 +3109,11 @@ int32_t tDeserializeSCreateDbReq(void *buf, int32_t bufLen, SCreateDbReq *pReq)
 
   DECODESQL();
 
+  pReq->sttMergePolicy = TSDB_DEFAULT_STT_MERGE_POLICY;
+  if (!tDecodeIsEnd(&decoder)) {
+    if (tDecodeI8(&decoder, &pReq->sttMergePolicy) < 0) return -1;
+  }
+
   tEndDecode(&decoder);
 
   tDecoderClear(&decoder);
@@ -3057,6 +3154,11 @@ int32_t tSerializeSAlterDbReq(void *buf, int32_t bufLen, SAlterDbReq *pReq) {
   if (tEncodeI32(&encoder, pReq->walRetentionSize) < 0) return -1;
   if (tEncodeI32(&encoder, pReq->keepTimeOffset) < 0) return -1;
   ENCODESQL();
+  // fields after the sql need the sql slot to be present
+  if (pReq->sqlLen <= 0 || pReq->sql == NULL) {
+    if (tEncodeI32(&encoder, 0) < 0) return -1;
+  }
+  if (tEncodeI8(&encoder, pReq->sttMergePolicy) < 0) return -1;
   tEndEncode(&encoder);
 
   int32_t tlen = encoder.pos;
@@ -3104,8 +3206,12 @@ int32_t tDeserializeSAlterDbReq(void *buf, int32_t bufLen, SAlterDbReq *pReq) {
   if (!tDecodeIsEnd(&decoder)) {
     if (tDecodeI32(&decoder, &pReq->keepTimeOffset) < 0) return -1;
   }
-
   DECODESQL();
+
+  pReq->sttMergePolicy = -1;
+  if (!tDecodeIsEnd(&decoder)) {
+    if (tDecodeI8(&decoder, &pReq->sttMergePolicy) < 0) return -1;
+  }
   tEndDecode(&decoder);
 
   tDecoderClear(&decoder);
@@ -3905,6 +4011,7 @@ int32_t tSerializeSDbCfgRspImpl(SEncoder *encoder, const SDbCfgRsp *pRsp) {
   if (tEncodeI8(encoder, pRsp->schemaless) < 0) return -1;
   if (tEncodeI16(encoder, pRsp->sstTrigger) < 0) return -1;
   if (tEncodeI32(encoder, pRsp->keepTimeOffset) < 0) return -1;
+  if (tEncodeI8(encoder, pRsp->sttMergePolicy) < 0) return -1;
 
   return 0;
 }
@@ -3977,6 +4084,10 @@ int32_t tDeserializeSDbCfgRspImpl(SDecoder *decoder, SDbCfgRsp *pRsp) {
   if (!tDecodeIsEnd(decoder)) {
     if (tDecodeI32(decoder, &pRsp->keepTimeOffset) < 0) return -1;
   }
+  pRsp->sttMergePolicy = TSDB_DEFAULT_STT_MERGE_POLICY;
+  if (!tDecodeIsEnd(decoder)) {
+    if (tDecodeI8(decoder, &pRsp->sttMergePolicy) < 0) return -1;
+  }
 
   return 0;
 }
@@ -5012,6 +5123,7 @@ int32_t tSerializeSCreateVnodeReq(void *buf, int32_t bufLen, SCreateVnodeReq *pR
   }
   if (tEncodeI32(&encoder, pReq->changeVersion) < 0) return -1;
   if (tEncodeI32(&encoder, pReq->keepTimeOffset) < 0) return -1;
+  if (tEncodeI8(&encoder, pReq->sttMergePolicy) < 0) return -1;
 
   tEndEncode(&encoder);
 
@@ -5105,6 +5217,10 @@ int32_t tDeserializeSCreateVnodeReq(void *buf, int32_t bufLen, SCreateVnodeReq *
   if (!tDecodeIsEnd(&decoder)) {
     if (tDecodeI32(&decoder, &pReq->keepTimeOffset) < 0) return -1;
   }
+  pReq->sttMergePolicy = TSDB_DEFAULT_STT_MERGE_POLICY;
+  if (!tDecodeIsEnd(&decoder)) {
+    if (tDecodeI8(&decoder, &pReq->sttMergePolicy) < 0) return -1;
+  }
 
   tEndDecode(&decoder);
   tDecoderClear(&decoder);
@@ -5372,6 +5488,7 @@ int32_t tSerializeSAlterVnodeConfigReq(void *buf, int32_t bufLen, SAlterVnodeCon
   if (tEncodeI32(&encoder, pReq->walRetentionPeriod) < 0) return -1;
   if (tEncodeI32(&encoder, pReq->walRetentionSize) < 0) return -1;
   if (tEncodeI32(&encoder, pReq->keepTimeOffset) < 0) return -1;
+  if (tEncodeI8(&encoder, pReq->sttMergePolicy) < 0) return -1;
   tEndEncode(&encoder);
 
   int32_t tlen = encoder.pos;
@@ -5422,6 +5539,10 @@ int32_t tDeserializeSAlterVnodeConfigReq(void *buf, int32_t bufLen, SAlterVnodeC
   if (!tDecodeIsEnd(&decoder)) {
     if (tDecodeI32(&decoder, &pReq->keepTimeOffset) < 0) return -1;
   }
+  pReq->sttMergePolicy = -1;
+  if (!tDecodeIsEnd(&decoder)) {
+    if (tDecodeI8(&decoder, &pReq->sttMergePolicy) < 0) return -1;
+  }
 
   tEndDecode(&decoder);
   tDecoderClear(&decoder);
@@ -6432,6 +6553,7 @@ int32_t tSerializeSResFetchReq(void *buf, int32_t bufLen, SResFetchReq *pReq) {
   } else {
     if (tEncodeI32(&encoder, 0) < 0) return -1;
   }
+  if (tEncodeI32(&encoder, pReq->compressSize) < 0) return -1;
 
   tEndEncode(&encoder);
 
@@ -6472,6 +6594,12 @@ int32_t tDeserializeSResFetchReq(void *buf, int32_t bufLen, SResFetchReq *pReq)
     if (tDeserializeSOperatorParam(&decoder, pReq->pOpParam) < 0) return -1;
   }
 
+  if (!tDecodeIsEnd(&decoder)) {
+    if (tDecodeI32(&decoder, &pReq->compressSize) < 0) return -1;
+  } else {
+    pReq->compressSize = 0;
+  }
+
   tEndDecode(&decoder);
 
   tDecoderClear(&decoder);
@@ -6825,6 +6953,12 @@ int32_t tSerializeSSchedulerHbRsp(void *buf, int32_t bufLen, SSchedulerHbRsp *pR
   } else {
     if (tEncodeI32(&encoder, 0) < 0) return -1;
   }
+
+  int32_t num = taosArrayGetSize(pRsp->taskStatus);
+  for (int32_t i = 0; i < num; ++i) {
+    STaskStatus *status = taosArrayGet(pRsp->taskStatus, i);
+    if (tEncodeI64(&encoder, status->memPeak) < 0) return -1;
+  }
   tEndEncode(&encoder);
 
   int32_t tlen = encoder.pos;
@@ -6857,6 +6991,13 @@ int32_t tDeserializeSSchedulerHbRsp(void *buf, int32_t bufLen, SSchedulerHbRsp *
   } else {
     pRsp->taskStatus = NULL;
   }
+
+  if (!tDecodeIsEnd(&decoder)) {
+    for (int32_t i = 0; i < num; ++i) {
+      STaskStatus *status = taosArrayGet(pRsp->taskStatus, i);
+      if (tDecodeI64(&decoder, &status->memPeak) < 0) return -1;
+    }
+  }
   tEndDecode(&decoder);
 
   tDecoderClear(&decoder);
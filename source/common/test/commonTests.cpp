@@ -302,6 +302,62 @@ TEST(testCase, Datablock_test) {
   taosArrayDestroy(pOrderInfo);
 }
 
+TEST(testCase, Datablock_compress_encoded_test) {
+  SSDataBlock* b = createDataBlock();
+
+  SColumnInfoData infoData = createColumnInfoData(TSDB_DATA_TYPE_TIMESTAMP, 8, 1);
+  blockDataAppendColInfo(b, &infoData);
+  SColumnInfoData infoData1 = createColumnInfoData(TSDB_DATA_TYPE_INT, 4, 2);
+  blockDataAppendColInfo(b, &infoData1);
+  SColumnInfoData infoData2 = createColumnInfoData(TSDB_DATA_TYPE_BINARY, 40, 3);
+  blockDataAppendColInfo(b, &infoData2);
+  SColumnInfoData infoData3 = createColumnInfoData(TSDB_DATA_TYPE_DOUBLE, 8, 4);
+  blockDataAppendColInfo(b, &infoData3);
+
+  int32_t numOfRows = 4000;
+  blockDataEnsureCapacity(b, numOfRows);
+
+  char buf[128] = {0};
+  char varbuf[128] = {0};
+  for (int32_t i = 0; i < numOfRows; ++i) {
+    int64_t ts = 1700000000000 + i * 1000;
+    int32_t v = i % 17;
+    double  d = i * 0.5;
+    sprintf(buf, "device_%d", i % 10);
+    STR_TO_VARSTR(varbuf, buf)
+
+    colDataSetVal((SColumnInfoData*)taosArrayGet(b->pDataBlock, 0), i, (const char*)&ts, false);
+    colDataSetVal((SColumnInfoData*)taosArrayGet(b->pDataBlock, 1), i, (const char*)&v, (i % 7) == 0);
+    colDataSetVal((SColumnInfoData*)taosArrayGet(b->pDataBlock, 2), i, (const char*)varbuf, (i % 11) == 0);
+    colDataSetVal((SColumnInfoData*)taosArrayGet(b->pDataBlock, 3), i, (const char*)&d, false);
+  }
+  b->info.rows = numOfRows;
+
+  // two blocks in one payload, as a fetch rsp of an upper level task carries
+  int32_t size = blockGetEncodeSize(b) * 2;
+  char*   pRaw = (char*)taosMemoryMalloc(size);
+  int32_t len = blockEncode(b, pRaw, 4);
+  len += blockEncode(b, pRaw + len, 4);
+
+  char*   pComp = (char*)taosMemoryMalloc(len);
+  int32_t compLen = blockCompressEncoded(pRaw, len, pComp, len);
+  ASSERT_GT(compLen, 0);
+  ASSERT_LT(compLen, len);
+  ASSERT_EQ(blockGetDecompressedSize(pComp, compLen), len);
+
+  char* pOut = (char*)taosMemoryMalloc(len);
+  ASSERT_EQ(blockDecompressEncoded(pComp, compLen, pOut, len), len);
+  ASSERT_EQ(memcmp(pRaw, pOut, len), 0);
+
+  // a payload that does not shrink is rejected
+  ASSERT_EQ(blockCompressEncoded(pRaw, len, pComp, 64), -1);
+
+  taosMemoryFree(pOut);
+  taosMemoryFree(pComp);
+  taosMemoryFree(pRaw);
+  blockDataDestroy(b);
+}
+
 #if 0
 TEST(testCase, non_var_dataBlock_split_test) {
   SSDataBlock* b = static_cast<SSDataBlock*>(taosMemoryCalloc(1, sizeof(SSDataBlock)));
@@ -639,4 +695,51 @@ TEST(timeTest, char2ts) {
   ASSERT_EQ(-3, TEST_char2ts("yyyy-mm-DDD", &ts, TSDB_TIME_PRECISION_MILLI, "1970-01-001"));
 }
 
+TEST(testCase, dbReq_sttMergePolicy_test) {
+  for (int32_t withSql = 0; withSql < 2; ++withSql) {
+    char sql[] = "create database db stt_merge_policy 'tiered'";
+
+    SCreateDbReq createReq = {0};
+    strcpy(createReq.db, "1.db");
+    createReq.keepTimeOffset = 3;
+    createReq.sttMergePolicy = TSDB_STT_MERGE_POLICY_TIERED;
+    if (withSql) {
+      createReq.sql = sql;
+      createReq.sqlLen = strlen(sql);
+    }
+    int32_t contLen = tSerializeSCreateDbReq(NULL, 0, &createReq);
+    void*   pReq = taosMemoryMalloc(contLen);
+    ASSERT_EQ(tSerializeSCreateDbReq(pReq, contLen, &createReq), contLen);
+
+    SCreateDbReq createRsp = {0};
+    ASSERT_EQ(tDeserializeSCreateDbReq(pReq, contLen, &createRsp), 0);
+    ASSERT_EQ(createRsp.keepTimeOffset, 3);
+    ASSERT_EQ(createRsp.sttMergePolicy, TSDB_STT_MERGE_POLICY_TIERED);
+    ASSERT_EQ(createRsp.sqlLen, createReq.sqlLen);
+    if (withSql) {
+      ASSERT_STREQ(createRsp.sql, sql);
+    }
+    tFreeSCreateDbReq(&createRsp);
+    taosMemoryFree(pReq);
+
+    SAlterDbReq alterReq = {0};
+    strcpy(alterReq.db, "1.db");
+    alterReq.sttMergePolicy = TSDB_STT_MERGE_POLICY_COUNT;
+    if (withSql) {
+      alterReq.sql = sql;
+      alterReq.sqlLen = strlen(sql);
+    }
+    contLen = tSerializeSAlterDbReq(NULL, 0, &alterReq);
+    pReq = taosMemoryMalloc(contLen);
+    ASSERT_EQ(tSerializeSAlterDbReq(pReq, contLen, &alterReq), contLen);
+
+    SAlterDbReq alterRsp = {0};
+    ASSERT_EQ(tDeserializeSAlterDbReq(pReq, contLen, &alterRsp), 0);
+    ASSERT_EQ(alterRsp.sttMergePolicy, TSDB_STT_MERGE_POLICY_COUNT);
+    ASSERT_EQ(alterRsp.sqlLen, alterReq.sqlLen);
+    tFreeSAlterDbReq(&alterRsp);
+    taosMemoryFree(pReq);
+  }
+}
+
 #pragma GCC diagnostic pop
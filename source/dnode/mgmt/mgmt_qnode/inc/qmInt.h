@@ -25,13 +25,15 @@ extern "C" {
 #endif
 
 typedef struct SQnodeMgmt {
-  SDnodeData   *pData;
-  SQnode       *pQnode;
-  SMsgCb        msgCb;
-  const char   *path;
-  const char   *name;
-  SSingleWorker queryWorker;
-  SSingleWorker fetchWorker;
+  SDnodeData      *pData;
+  SQnode          *pQnode;
+  SMsgCb           msgCb;
+  const char      *path;
+  const char      *name;
+  SStealWorkerPool queryPool;
+  SStealWorkerPool fetchPool;
+  STaosQueue      *pQueryQ;
+  STaosQueue      *pFetchQ;
 } SQnodeMgmt;
 
 // qmHandle.c
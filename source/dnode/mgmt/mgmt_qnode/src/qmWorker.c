@@ -41,20 +41,22 @@ static void qmProcessQueue(SQueueInfo *pInfo, SRpcMsg *pMsg) {
   taosFreeQitem(pMsg);
 }
 
-static int32_t qmPutNodeMsgToWorker(SSingleWorker *pWorker, SRpcMsg *pMsg) {
-  dTrace("msg:%p, put into worker %s, type:%s", pMsg, pWorker->name, TMSG_INFO(pMsg->msgType));
-  taosWriteQitem(pWorker->queue, pMsg);
-  return 0;
+// messages of one query share the root id of the trace, a long running query is demoted by it
+static int64_t qmGetQueryMsgKey(SRpcMsg *pMsg) { return TRACE_GET_ROOTID(&pMsg->info.traceId); }
+
+static int32_t qmPutNodeMsgToWorker(SStealWorkerPool *pPool, STaosQueue *pQueue, SRpcMsg *pMsg) {
+  dTrace("msg:%p, put into worker %s, type:%s", pMsg, pPool->name, TMSG_INFO(pMsg->msgType));
+  return tStealWorkerWriteQitem(pPool, pQueue, pMsg);
 }
 
 int32_t qmPutNodeMsgToQueryQueue(SQnodeMgmt *pMgmt, SRpcMsg *pMsg) {
   qndPreprocessQueryMsg(pMgmt->pQnode, pMsg);
 
-  return qmPutNodeMsgToWorker(&pMgmt->queryWorker, pMsg);
+  return qmPutNodeMsgToWorker(&pMgmt->queryPool, pMgmt->pQueryQ, pMsg);
 }
 
 int32_t qmPutNodeMsgToFetchQueue(SQnodeMgmt *pMgmt, SRpcMsg *pMsg) {
-  return qmPutNodeMsgToWorker(&pMgmt->fetchWorker, pMsg);
+  return qmPutNodeMsgToWorker(&pMgmt->fetchPool, pMgmt->pFetchQ, pMsg);
 }
 
 int32_t qmPutRpcMsgToQueue(SQnodeMgmt *pMgmt, EQueueType qtype, SRpcMsg *pRpc) {
@@ -66,12 +68,12 @@ int32_t qmPutRpcMsgToQueue(SQnodeMgmt *pMgmt, EQueueType qtype, SRpcMsg *pRpc) {
   switch (qtype) {
     case QUERY_QUEUE:
       dTrace("msg:%p, is created and will put into qnode-query queue, len:%d", pMsg, pRpc->contLen);
-      taosWriteQitem(pMgmt->queryWorker.queue, pMsg);
+      tStealWorkerWriteQitem(&pMgmt->queryPool, pMgmt->pQueryQ, pMsg);
       return 0;
     case READ_QUEUE:
     case FETCH_QUEUE:
       dTrace("msg:%p, is created and will put into qnode-fetch queue, len:%d", pMsg, pRpc->contLen);
-      taosWriteQitem(pMgmt->fetchWorker.queue, pMsg);
+      tStealWorkerWriteQitem(&pMgmt->fetchPool, pMgmt->pFetchQ, pMsg);
       return 0;
     default:
       terrno = TSDB_CODE_INVALID_PARA;
@@ -86,10 +88,10 @@ int32_t qmGetQueueSize(SQnodeMgmt *pMgmt, int32_t vgId, EQueueType qtype) {
 
   switch (qtype) {
     case QUERY_QUEUE:
-      size = taosQueueItemSize(pMgmt->queryWorker.queue);
+      size = taosQueueItemSize(pMgmt->pQueryQ);
       break;
     case FETCH_QUEUE:
-      size = taosQueueItemSize(pMgmt->fetchWorker.queue);
+      size = taosQueueItemSize(pMgmt->pFetchQ);
       break;
     default:
       break;
@@ -98,30 +100,44 @@ int32_t qmGetQueueSize(SQnodeMgmt *pMgmt, int32_t vgId, EQueueType qtype) {
   return size;
 }
 
-int32_t qmStartWorker(SQnodeMgmt *pMgmt) {
-  SSingleWorkerCfg queryCfg = {
-      .min = tsNumOfVnodeQueryThreads,
-      .max = tsNumOfVnodeQueryThreads,
-      .name = "qnode-query",
-      .fp = (FItem)qmProcessQueue,
-      .param = pMgmt,
-  };
+static int32_t qmStartPool(SStealWorkerPool *pPool, STaosQueue **ppQueue, const char *name, int32_t num,
+                           SQnodeMgmt *pMgmt) {
+  pPool->name = name;
+  pPool->num = num;
+  pPool->demoteUs = (int64_t)tsQueryDemoteTime * 1000;
+  pPool->keyFp = (FItemKey)qmGetQueryMsgKey;
+  if (tStealWorkerInit(pPool) != 0) {
+    dError("failed to start %s worker since %s", name, terrstr());
+    return -1;
+  }
 
-  if (tSingleWorkerInit(&pMgmt->queryWorker, &queryCfg) != 0) {
-    dError("failed to start qnode-query worker since %s", terrstr());
+  *ppQueue = tStealWorkerAllocQueue(pPool, pMgmt, (FItem)qmProcessQueue);
+  if (*ppQueue == NULL) {
+    dError("failed to alloc %s queue since %s", name, terrstr());
     return -1;
   }
 
-  SSingleWorkerCfg fetchCfg = {
-      .min = tsNumOfQnodeFetchThreads,
-      .max = tsNumOfQnodeFetchThreads,
-      .name = "qnode-fetch",
-      .fp = (FItem)qmProcessQueue,
-      .param = pMgmt,
-  };
+  return 0;
+}
+
+static void qmStopPool(SStealWorkerPool *pPool, STaosQueue **ppQueue) {
+  while (!taosQueueEmpty(*ppQueue)) {
+    taosMsleep(10);
+  }
+
+  tStealWorkerCleanup(pPool);
+  if (*ppQueue != NULL) {
+    tStealWorkerFreeQueue(pPool, *ppQueue);
+    *ppQueue = NULL;
+  }
+}
+
+int32_t qmStartWorker(SQnodeMgmt *pMgmt) {
+  if (qmStartPool(&pMgmt->queryPool, &pMgmt->pQueryQ, "qnode-query", tsNumOfVnodeQueryThreads, pMgmt) != 0) {
+    return -1;
+  }
 
-  if (tSingleWorkerInit(&pMgmt->fetchWorker, &fetchCfg) != 0) {
-    dError("failed to start qnode-fetch worker since %s", terrstr());
+  if (qmStartPool(&pMgmt->fetchPool, &pMgmt->pFetchQ, "qnode-fetch", tsNumOfQnodeFetchThreads, pMgmt) != 0) {
     return -1;
   }
 
@@ -130,7 +146,7 @@ int32_t qmStartWorker(SQnodeMgmt *pMgmt) {
 }
 
 void qmStopWorker(SQnodeMgmt *pMgmt) {
-  tSingleWorkerCleanup(&pMgmt->queryWorker);
-  tSingleWorkerCleanup(&pMgmt->fetchWorker);
+  qmStopPool(&pMgmt->queryPool, &pMgmt->pQueryQ);
+  qmStopPool(&pMgmt->fetchPool, &pMgmt->pFetchQ);
   dDebug("qnode workers are closed");
 }
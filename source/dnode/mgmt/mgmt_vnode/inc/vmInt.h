@@ -25,14 +25,16 @@
 extern "C" {
 #endif
 
+#define VNODE_WORKER_REPORT_SEC 300  // the query and fetch pools log their wait histograms
+
 typedef struct SVnodeMgmt {
   SDnodeData      *pData;
   SMsgCb           msgCb;
   const char      *path;
   const char      *name;
-  SQWorkerPool     queryPool;
+  SStealWorkerPool queryPool;
   SAutoQWorkerPool streamPool;
-  SWWorkerPool     fetchPool;
+  SStealWorkerPool fetchPool;
   SSingleWorker    mgmtWorker;
   SHashObj        *hash;
   TdThreadRwlock   lock;
@@ -69,6 +71,7 @@ typedef struct {
   STaosQueue   *pQueryQ;
   STaosQueue   *pStreamQ;
   STaosQueue   *pFetchQ;
+  TdThreadMutex fetchLock;  // the fetch msgs not handled by qworker run one at a time, as on a per-vnode thread
 } SVnodeObj;
 
 typedef struct {
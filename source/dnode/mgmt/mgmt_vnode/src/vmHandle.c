@@ -66,6 +66,21 @@ void vmGetVnodeLoadsLite(SVnodeMgmt *pMgmt, SMonVloadInfo *pInfo) {
   taosThreadRwlockUnlock(&pMgmt->lock);
 }
 
+static void vmGetWorkerInfo(SStealWorkerPool *pPool, SMonWorkerInfo *pInfo) {
+  SStealWorkerPoolStat stat = {0};
+  tStealWorkerGetPoolStat(pPool, &stat);
+
+  pInfo->workers = stat.numOfWorkers;
+  pInfo->queued = stat.numOfQueued;
+  pInfo->items = stat.stat.numOfItems;
+  pInfo->steals = stat.stat.numOfSteals;
+  pInfo->busy_us = stat.stat.busyUs;
+  for (int32_t i = 0; i < TMIN(MON_WORKER_HIST_SIZE, STEAL_WORKER_HIST); ++i) {
+    pInfo->wait_us_high[i] = stat.stat.waitHist[STEAL_WORKER_HIGH][i];
+    pInfo->wait_us_low[i] = stat.stat.waitHist[STEAL_WORKER_LOW][i];
+  }
+}
+
 void vmGetMonitorInfo(SVnodeMgmt *pMgmt, SMonVmInfo *pInfo) {
   SMonVloadInfo vloads = {0};
   vmGetVnodeLoads(pMgmt, &vloads, true);
@@ -107,6 +122,18 @@ void vmGetMonitorInfo(SVnodeMgmt *pMgmt, SMonVmInfo *pInfo) {
   pMgmt->state.numOfBatchInsertReqs = numOfBatchInsertReqs;
   pMgmt->state.numOfBatchInsertSuccessReqs = numOfBatchInsertSuccessReqs;
 
+  SWalGroupCommitStat walStat = {0};
+  walGetGroupCommitStat(&walStat);
+  pInfo->wal.requests = walStat.nRequest;
+  pInfo->wal.fsyncs = walStat.nFsync;
+  for (int32_t i = 0; i < TMIN(MON_WAL_HIST_SIZE, WAL_GROUP_COMMIT_HIST_SIZE); ++i) {
+    pInfo->wal.depth[i] = walStat.depthHist[i];
+    pInfo->wal.fsync_us[i] = walStat.latencyHist[i];
+  }
+
+  vmGetWorkerInfo(&pMgmt->queryPool, &pInfo->query);
+  vmGetWorkerInfo(&pMgmt->fetchPool, &pInfo->fetch);
+
   tfsGetMonitorInfo(pMgmt->pTfs, &pInfo->tfs);
   taosArrayDestroy(pVloads);
 }
@@ -150,6 +177,7 @@ static void vmGenerateVnodeCfg(SCreateVnodeReq *pCreate, SVnodeCfg *pCfg) {
   pCfg->walCfg.level = pCreate->walLevel;
 
   pCfg->sttTrigger = pCreate->sstTrigger;
+  pCfg->sttMergePolicy = pCreate->sttMergePolicy;
   pCfg->hashBegin = pCreate->hashBegin;
   pCfg->hashEnd = pCreate->hashEnd;
   pCfg->hashMethod = pCreate->hashMethod;
@@ -212,8 +212,7 @@ void vmCloseVnode(SVnodeMgmt *pMgmt, SVnodeObj *pVnode, bool commitAndRemoveWal)
   dInfo("vgId:%d, wait for vnode query queue:%p is empty", pVnode->vgId, pVnode->pQueryQ);
   while (!taosQueueEmpty(pVnode->pQueryQ)) taosMsleep(10);
 
-  dInfo("vgId:%d, wait for vnode fetch queue:%p is empty, thread:%08" PRId64, pVnode->vgId, pVnode->pFetchQ,
-        pVnode->pFetchQ->threadId);
+  dInfo("vgId:%d, wait for vnode fetch queue:%p is empty", pVnode->vgId, pVnode->pFetchQ);
   while (!taosQueueEmpty(pVnode->pFetchQ)) taosMsleep(10);
 
   tqNotifyClose(pVnode->pImpl->pTq);
@@ -539,6 +538,10 @@ static void *vmThreadFp(void *param) {
     if (sec % (VNODE_TIMEOUT_SEC / 2) == 0) {
       vmCheckSyncTimeout(pMgmt);
     }
+    if (sec % VNODE_WORKER_REPORT_SEC == 0) {
+      tStealWorkerReport(&pMgmt->queryPool);
+      tStealWorkerReport(&pMgmt->fetchPool);
+    }
   }
 
   return NULL;
@@ -109,37 +109,56 @@ static void vmProcessStreamQueue(SQueueInfo *pInfo, SRpcMsg *pMsg) {
   taosFreeQitem(pMsg);
 }
 
-static void vmProcessFetchQueue(SQueueInfo *pInfo, STaosQall *qall, int32_t numOfMsgs) {
-  SVnodeObj *pVnode = pInfo->ahandle;
-  SRpcMsg   *pMsg = NULL;
+// qworker handles these msgs of one vnode concurrently, as it does on the query queue and on the qnode fetch queue
+static bool vmIsQWorkerFetchMsg(tmsg_t msgType) {
+  switch (msgType) {
+    case TDMT_SCH_FETCH:
+    case TDMT_SCH_MERGE_FETCH:
+    case TDMT_SCH_FETCH_RSP:
+    case TDMT_SCH_DROP_TASK:
+    case TDMT_SCH_TASK_NOTIFY:
+    case TDMT_SCH_QUERY_HEARTBEAT:
+      return true;
+    default:
+      return false;
+  }
+}
 
-  for (int32_t i = 0; i < numOfMsgs; ++i) {
-    if (taosGetQitem(qall, (void **)&pMsg) == 0) continue;
-    const STraceId *trace = &pMsg->info.traceId;
-    dGTrace("vgId:%d, msg:%p get from vnode-fetch queue", pVnode->vgId, pMsg);
+static void vmProcessFetchQueue(SQueueInfo *pInfo, SRpcMsg *pMsg) {
+  SVnodeObj      *pVnode = pInfo->ahandle;
+  const STraceId *trace = &pMsg->info.traceId;
+  dGTrace("vgId:%d, msg:%p get from vnode-fetch queue", pVnode->vgId, pMsg);
 
-    terrno = 0;
-    int32_t code = vnodeProcessFetchMsg(pVnode->pImpl, pMsg, pInfo);
-    if (code != 0) {
-      if (code == -1 && terrno != 0) {
-        code = terrno;
-      }
+  // the table meta and tmq msgs were never run concurrently on one vnode, keep them serialized
+  bool serial = !vmIsQWorkerFetchMsg(pMsg->msgType);
+  if (serial) taosThreadMutexLock(&pVnode->fetchLock);
 
-      if (code == TSDB_CODE_WAL_LOG_NOT_EXIST) {
-        dGDebug("vnodeProcessFetchMsg vgId:%d, msg:%p failed to fetch since %s", pVnode->vgId, pMsg, terrstr());
-      } else {
-        dGError("vnodeProcessFetchMsg vgId:%d, msg:%p failed to fetch since %s", pVnode->vgId, pMsg, terrstr());
-      }
+  terrno = 0;
+  int32_t code = vnodeProcessFetchMsg(pVnode->pImpl, pMsg, pInfo);
+  if (serial) taosThreadMutexUnlock(&pVnode->fetchLock);
 
-      vmSendRsp(pMsg, code);
+  if (code != 0) {
+    if (code == -1 && terrno != 0) {
+      code = terrno;
     }
 
-    dGTrace("vnodeProcessFetchMsg vgId:%d, msg:%p is freed, code:0x%x", pVnode->vgId, pMsg, code);
-    rpcFreeCont(pMsg->pCont);
-    taosFreeQitem(pMsg);
+    if (code == TSDB_CODE_WAL_LOG_NOT_EXIST) {
+      dGDebug("vnodeProcessFetchMsg vgId:%d, msg:%p failed to fetch since %s", pVnode->vgId, pMsg, terrstr());
+    } else {
+      dGError("vnodeProcessFetchMsg vgId:%d, msg:%p failed to fetch since %s", pVnode->vgId, pMsg, terrstr());
+    }
+
+    vmSendRsp(pMsg, code);
   }
+
+  dGTrace("vnodeProcessFetchMsg vgId:%d, msg:%p is freed, code:0x%x", pVnode->vgId, pMsg, code);
+  rpcFreeCont(pMsg->pCont);
+  taosFreeQitem(pMsg);
 }
 
+// messages of one query share the root id of the trace, a long running query is demoted by it
+static int64_t vmGetQueryMsgKey(SRpcMsg *pMsg) { return TRACE_GET_ROOTID(&pMsg->info.traceId); }
+
 static void vmProcessSyncQueue(SQueueInfo *pInfo, STaosQall *qall, int32_t numOfMsgs) {
   SVnodeObj *pVnode = pInfo->ahandle;
   SRpcMsg   *pMsg = NULL;
@@ -201,7 +220,7 @@ static int32_t vmPutMsgToQueue(SVnodeMgmt *pMgmt, SRpcMsg *pMsg, EQueueType qtyp
         dError("vgId:%d, msg:%p preprocess query msg failed since %s", pVnode->vgId, pMsg, terrstr(code));
       } else {
         dGTrace("vgId:%d, msg:%p put into vnode-query queue", pVnode->vgId, pMsg);
-        taosWriteQitem(pVnode->pQueryQ, pMsg);
+        tStealWorkerWriteQitem(&pMgmt->queryPool, pVnode->pQueryQ, pMsg);
       }
       break;
     case STREAM_QUEUE:
@@ -210,7 +229,7 @@ static int32_t vmPutMsgToQueue(SVnodeMgmt *pMgmt, SRpcMsg *pMsg, EQueueType qtyp
       break;
     case FETCH_QUEUE:
       dGTrace("vgId:%d, msg:%p put into vnode-fetch queue", pVnode->vgId, pMsg);
-      taosWriteQitem(pVnode->pFetchQ, pMsg);
+      tStealWorkerWriteQitem(&pMgmt->fetchPool, pVnode->pFetchQ, pMsg);
       break;
     case WRITE_QUEUE:
       if (!vmDataSpaceSufficient(pVnode)) {
@@ -345,18 +364,22 @@ int32_t vmGetQueueSize(SVnodeMgmt *pMgmt, int32_t vgId, EQueueType qtype) {
 }
 
 int32_t vmAllocQueue(SVnodeMgmt *pMgmt, SVnodeObj *pVnode) {
+  int32_t         numaNode = vnodeGetNumaNode(pVnode->pImpl);
   SMultiWorkerCfg wcfg = {.max = 1, .name = "vnode-write", .fp = (FItems)vnodeProposeWriteMsg, .param = pVnode->pImpl};
   SMultiWorkerCfg scfg = {.max = 1, .name = "vnode-sync", .fp = (FItems)vmProcessSyncQueue, .param = pVnode};
   SMultiWorkerCfg sccfg = {.max = 1, .name = "vnode-sync-rd", .fp = (FItems)vmProcessSyncQueue, .param = pVnode};
   SMultiWorkerCfg acfg = {.max = 1, .name = "vnode-apply", .fp = (FItems)vnodeApplyWriteMsg, .param = pVnode->pImpl};
+  wcfg.bindNuma = acfg.bindNuma = (numaNode >= 0);
+  wcfg.numaNode = acfg.numaNode = numaNode;
   (void)tMultiWorkerInit(&pVnode->pWriteW, &wcfg);
   (void)tMultiWorkerInit(&pVnode->pSyncW, &scfg);
   (void)tMultiWorkerInit(&pVnode->pSyncRdW, &sccfg);
   (void)tMultiWorkerInit(&pVnode->pApplyW, &acfg);
 
-  pVnode->pQueryQ = tQWorkerAllocQueue(&pMgmt->queryPool, pVnode, (FItem)vmProcessQueryQueue);
+  taosThreadMutexInit(&pVnode->fetchLock, NULL);
+  pVnode->pQueryQ = tStealWorkerAllocQueue(&pMgmt->queryPool, pVnode, (FItem)vmProcessQueryQueue);
   pVnode->pStreamQ = tAutoQWorkerAllocQueue(&pMgmt->streamPool, pVnode, (FItem)vmProcessStreamQueue);
-  pVnode->pFetchQ = tWWorkerAllocQueue(&pMgmt->fetchPool, pVnode, (FItems)vmProcessFetchQueue);
+  pVnode->pFetchQ = tStealWorkerAllocQueue(&pMgmt->fetchPool, pVnode, (FItem)vmProcessFetchQueue);
 
   if (pVnode->pWriteW.queue == NULL || pVnode->pSyncW.queue == NULL || pVnode->pSyncRdW.queue == NULL ||
       pVnode->pApplyW.queue == NULL || pVnode->pQueryQ == NULL || pVnode->pStreamQ == NULL || pVnode->pFetchQ == NULL) {
@@ -373,38 +396,41 @@ int32_t vmAllocQueue(SVnodeMgmt *pMgmt, SVnodeObj *pVnode) {
   dInfo("vgId:%d, apply-queue:%p is alloced, thread:%08" PRId64, pVnode->vgId, pVnode->pApplyW.queue,
         pVnode->pApplyW.queue->threadId);
   dInfo("vgId:%d, query-queue:%p is alloced", pVnode->vgId, pVnode->pQueryQ);
-  dInfo("vgId:%d, fetch-queue:%p is alloced, thread:%08" PRId64, pVnode->vgId, pVnode->pFetchQ,
-        pVnode->pFetchQ->threadId);
+  dInfo("vgId:%d, fetch-queue:%p is alloced", pVnode->vgId, pVnode->pFetchQ);
   dInfo("vgId:%d, stream-queue:%p is alloced", pVnode->vgId, pVnode->pStreamQ);
   return 0;
 }
 
 void vmFreeQueue(SVnodeMgmt *pMgmt, SVnodeObj *pVnode) {
-  tQWorkerFreeQueue(&pMgmt->queryPool, pVnode->pQueryQ);
+  tStealWorkerFreeQueue(&pMgmt->queryPool, pVnode->pQueryQ);
   tAutoQWorkerFreeQueue(&pMgmt->streamPool, pVnode->pStreamQ);
-  tWWorkerFreeQueue(&pMgmt->fetchPool, pVnode->pFetchQ);
+  tStealWorkerFreeQueue(&pMgmt->fetchPool, pVnode->pFetchQ);
   pVnode->pQueryQ = NULL;
   pVnode->pStreamQ = NULL;
   pVnode->pFetchQ = NULL;
+  taosThreadMutexDestroy(&pVnode->fetchLock);
   dDebug("vgId:%d, queue is freed", pVnode->vgId);
 }
 
 int32_t vmStartWorker(SVnodeMgmt *pMgmt) {
-  SQWorkerPool *pQPool = &pMgmt->queryPool;
+  SStealWorkerPool *pQPool = &pMgmt->queryPool;
   pQPool->name = "vnode-query";
-  pQPool->min = tsNumOfVnodeQueryThreads;
-  pQPool->max = tsNumOfVnodeQueryThreads;
-  if (tQWorkerInit(pQPool) != 0) return -1;
+  pQPool->num = tsNumOfVnodeQueryThreads;
+  pQPool->demoteUs = (int64_t)tsQueryDemoteTime * 1000;
+  pQPool->keyFp = (FItemKey)vmGetQueryMsgKey;
+  if (tStealWorkerInit(pQPool) != 0) return -1;
 
   SAutoQWorkerPool *pStreamPool = &pMgmt->streamPool;
   pStreamPool->name = "vnode-stream";
   pStreamPool->ratio = tsRatioOfVnodeStreamThreads;
   if (tAutoQWorkerInit(pStreamPool) != 0) return -1;
 
-  SWWorkerPool *pFPool = &pMgmt->fetchPool;
+  SStealWorkerPool *pFPool = &pMgmt->fetchPool;
   pFPool->name = "vnode-fetch";
-  pFPool->max = tsNumOfVnodeFetchThreads;
-  if (tWWorkerInit(pFPool) != 0) return -1;
+  pFPool->num = tsNumOfVnodeFetchThreads;
+  pFPool->demoteUs = (int64_t)tsQueryDemoteTime * 1000;
+  pFPool->keyFp = (FItemKey)vmGetQueryMsgKey;
+  if (tStealWorkerInit(pFPool) != 0) return -1;
 
   SSingleWorkerCfg mgmtCfg = {
       .min = 1,
@@ -420,8 +446,8 @@ int32_t vmStartWorker(SVnodeMgmt *pMgmt) {
 }
 
 void vmStopWorker(SVnodeMgmt *pMgmt) {
-  tQWorkerCleanup(&pMgmt->queryPool);
+  tStealWorkerCleanup(&pMgmt->queryPool);
   tAutoQWorkerCleanup(&pMgmt->streamPool);
-  tWWorkerCleanup(&pMgmt->fetchPool);
+  tStealWorkerCleanup(&pMgmt->fetchPool);
   dDebug("vnode workers are closed");
 }
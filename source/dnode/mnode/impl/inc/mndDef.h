@@ -333,6 +333,7 @@ typedef struct {
   int16_t hashPrefix;
   int16_t hashSuffix;
   int16_t sstTrigger;
+  int8_t  sttMergePolicy;
   int32_t tsdbPageSize;
   int32_t numOfRetensions;
   SArray* pRetensions;
@@ -391,6 +392,24 @@ typedef struct {
   void*     pTsma;
   int32_t   numOfCachedTables;
   int32_t   syncConfChangeVer;
+  int64_t   lastCacheHit;
+  int64_t   lastCacheMiss;
+  int64_t   lastCacheEvict;
+  int64_t   pageCacheHit;
+  int64_t   pageCacheMiss;
+  int64_t   bufferUsed;
+  int64_t   bufferSize;
+  int32_t   numOfFreeBufPools;
+  int64_t   earlyCommits;
+  int64_t   writeStalls;
+  int64_t   writeStallTime;
+  int64_t   writeDelays;
+  int64_t   writeDelayTime;
+  int64_t   sttMerges;
+  int64_t   sttMergesToData;
+  int64_t   sttMergeBytesNew;
+  int64_t   sttMergeBytesRead;
+  int64_t   sttMergeBytesWritten;
 } SVgObj;
 
 typedef struct {
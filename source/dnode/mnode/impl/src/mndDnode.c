@@ -565,6 +565,24 @@ static int32_t mndProcessStatusReq(SRpcMsg *pReq) {
       if (pVload->syncState == TAOS_SYNC_STATE_LEADER) {
         pVgroup->cacheUsage = pVload->cacheUsage;
         pVgroup->numOfCachedTables = pVload->numOfCachedTables;
+        pVgroup->lastCacheHit = pVload->lastCacheHit;
+        pVgroup->lastCacheMiss = pVload->lastCacheMiss;
+        pVgroup->lastCacheEvict = pVload->lastCacheEvict;
+        pVgroup->pageCacheHit = pVload->pageCacheHit;
+        pVgroup->pageCacheMiss = pVload->pageCacheMiss;
+        pVgroup->bufferUsed = pVload->bufferUsed;
+        pVgroup->bufferSize = pVload->bufferSize;
+        pVgroup->numOfFreeBufPools = pVload->numOfFreeBufPools;
+        pVgroup->earlyCommits = pVload->earlyCommits;
+        pVgroup->writeStalls = pVload->writeStalls;
+        pVgroup->writeStallTime = pVload->writeStallTime;
+        pVgroup->writeDelays = pVload->writeDelays;
+        pVgroup->writeDelayTime = pVload->writeDelayTime;
+        pVgroup->sttMerges = pVload->sttMerges;
+        pVgroup->sttMergesToData = pVload->sttMergesToData;
+        pVgroup->sttMergeBytesNew = pVload->sttMergeBytesNew;
+        pVgroup->sttMergeBytesRead = pVload->sttMergeBytesRead;
+        pVgroup->sttMergeBytesWritten = pVload->sttMergeBytesWritten;
         pVgroup->numOfTables = pVload->numOfTables;
         pVgroup->numOfTimeSeries = pVload->numOfTimeSeries;
         pVgroup->totalStorage = pVload->totalStorage;
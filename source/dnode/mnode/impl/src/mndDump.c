@@ -107,6 +107,7 @@ void dumpDb(SSdb *pSdb, SJson *json) {
     tjsonAddStringToObject(item, "hashPrefix", i642str(pObj->cfg.hashPrefix));
     tjsonAddStringToObject(item, "hashSuffix", i642str(pObj->cfg.hashSuffix));
     tjsonAddStringToObject(item, "sstTrigger", i642str(pObj->cfg.sstTrigger));
+    tjsonAddStringToObject(item, "sttMergePolicy", i642str(pObj->cfg.sttMergePolicy));
     tjsonAddStringToObject(item, "tsdbPageSize", i642str(pObj->cfg.tsdbPageSize));
     tjsonAddStringToObject(item, "schemaless", i642str(pObj->cfg.schemaless));
     tjsonAddStringToObject(item, "walLevel", i642str(pObj->cfg.walLevel));
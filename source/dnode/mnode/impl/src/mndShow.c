@@ -123,6 +123,14 @@ static int32_t convertToRetrieveType(char *name, int32_t len) {
     type = TSDB_MGMT_TABLE_COMPACT;
   } else if (strncasecmp(name, TSDB_INS_TABLE_COMPACT_DETAILS, len) == 0) {
     type = TSDB_MGMT_TABLE_COMPACT_DETAIL;
+  } else if (strncasecmp(name, TSDB_PERFS_TABLE_LAST_CACHE, len) == 0) {
+    type = TSDB_MGMT_TABLE_LAST_CACHE;
+  } else if (strncasecmp(name, TSDB_PERFS_TABLE_PAGE_CACHE, len) == 0) {
+    type = TSDB_MGMT_TABLE_PAGE_CACHE;
+  } else if (strncasecmp(name, TSDB_PERFS_TABLE_WRITE_STALL, len) == 0) {
+    type = TSDB_MGMT_TABLE_WRITE_STALL;
+  } else if (strncasecmp(name, TSDB_PERFS_TABLE_STT_MERGE, len) == 0) {
+    type = TSDB_MGMT_TABLE_STT_MERGE;
   } else {
     mError("invalid show name:%s len:%d", name, len);
   }
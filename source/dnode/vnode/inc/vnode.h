@@ -69,6 +69,7 @@ int32_t vnodeBegin(SVnode *pVnode);
 int32_t vnodeStart(SVnode *pVnode);
 void    vnodeStop(SVnode *pVnode);
 int64_t vnodeGetSyncHandle(SVnode *pVnode);
+int32_t vnodeGetNumaNode(SVnode *pVnode);
 int32_t   vnodeGetSnapshot(SVnode *pVnode, SSnapshot *pSnapshot);
 void vnodeGetInfo(void *pVnode, const char **dbname, int32_t *vgId, int64_t *numOfTables, int64_t *numOfNormalTables);
 int32_t   vnodeProcessCreateTSma(SVnode *pVnode, void *pCont, uint32_t contLen);
@@ -162,9 +163,11 @@ int32_t      tsdbNextDataBlock2(STsdbReader *pReader, bool *hasNext);
 int32_t      tsdbRetrieveDatablockSMA2(STsdbReader *pReader, SSDataBlock *pDataBlock, bool *allHave, bool *hasNullSMA);
 void         tsdbReleaseDataBlock2(STsdbReader *pReader);
 SSDataBlock *tsdbRetrieveDataBlock2(STsdbReader *pTsdbReadHandle, SArray *pColumnIdList);
+int32_t      tsdbRetrieveRemainColumns2(void *pReader, bool load);
 int32_t      tsdbReaderReset2(STsdbReader *pReader, SQueryTableDataCond *pCond);
 int32_t      tsdbGetFileBlocksDistInfo2(STsdbReader *pReader, STableBlockDistInfo *pTableBlockInfo);
 int64_t      tsdbGetNumOfRowsInMemTable2(STsdbReader *pHandle);
+void         tsdbReaderGetReadAheadStat2(void *pReader, STableScanAnalyzeInfo *pInfo);
 void        *tsdbGetIdx2(SMeta *pMeta);
 void        *tsdbGetIvtIdx2(SMeta *pMeta);
 uint64_t     tsdbGetReaderMaxVersion2(STsdbReader *pReader);
@@ -185,6 +188,10 @@ void    tsdbCacheSetCapacity(SVnode *pVnode, size_t capacity);
 size_t  tsdbCacheGetCapacity(SVnode *pVnode);
 size_t  tsdbCacheGetUsage(SVnode *pVnode);
 int32_t tsdbCacheGetElems(SVnode *pVnode);
+void    tsdbCacheGetStat(SVnode *pVnode, int64_t *pHit, int64_t *pMiss, int64_t *pEvict);
+void    tsdbPageCacheGetStat(SVnode *pVnode, int64_t *pHit, int64_t *pMiss);
+void    tsdbMergeGetStat(SVnode *pVnode, int64_t *pMerges, int64_t *pToData, int64_t *pBytesNew, int64_t *pBytesRead,
+                         int64_t *pBytesWritten);
 
 //// tq
 typedef struct SIdInfo {
@@ -304,6 +311,7 @@ struct SVnodeCfg {
   uint32_t    hashEnd;
   bool        hashChange;
   int16_t     sttTrigger;
+  int8_t      sttMergePolicy;
   int16_t     hashPrefix;
   int16_t     hashSuffix;
   int32_t     tsdbPageSize;
@@ -19,6 +19,7 @@
 // #include "../tsdb/tsdbFile2.h"
 // #include "../tsdb/tsdbMerge.h"
 // #include "../tsdb/tsdbSttFileRW.h"
+#include "tbloomfilter.h"
 #include "tsimplehash.h"
 #include "vnodeInt.h"
 
@@ -44,6 +45,7 @@ typedef struct SDelIdx          SDelIdx;
 typedef struct STbData          STbData;
 typedef struct SMemTable        SMemTable;
 typedef struct STbDataIter      STbDataIter;
+typedef struct SRocksBatch      SRocksBatch;
 typedef struct SMapData         SMapData;
 typedef struct SBlockIdx        SBlockIdx;
 typedef struct SDataBlk         SDataBlk;
@@ -82,6 +84,10 @@ typedef struct STFileSystem     STFileSystem;
 #define TSDB_FILE_DLMT ((uint32_t)0xF00AFA0F)
 #define TSDB_FHDR_SIZE 512
 
+// the column aggs of a block in the .sma file may be followed by the column indexes, led by an agg with this colId
+#define TSDB_SMA_IDX_MARK           ((int16_t)-1)
+#define TSDB_BLOCK_BLOOM_ERROR_RATE 0.01
+
 #define VERSION_MIN 0
 #define VERSION_MAX INT64_MAX
 
@@ -206,6 +212,10 @@ int32_t tsdbFidLevel(int32_t fid, STsdbKeepCfg *pKeepCfg, int64_t nowSec);
 int32_t tsdbBuildDeleteSkyline(SArray *aDelData, int32_t sidx, int32_t eidx, SArray *aSkyline);
 int32_t tPutColumnDataAgg(uint8_t *p, SColumnDataAgg *pColAgg);
 int32_t tGetColumnDataAgg(uint8_t *p, SColumnDataAgg *pColAgg);
+int32_t tColDataCalcIdx(SColData *pColData, SColumnDataIdx *pIdx);
+void    tColumnDataIdxClear(SColumnDataIdx *pIdx);
+int32_t tPutColumnDataIdx(uint8_t *p, SColumnDataIdx *pIdx);
+int32_t tGetColumnDataIdx(uint8_t *p, SColumnDataIdx *pIdx);
 int32_t tsdbCmprData(uint8_t *pIn, int32_t szIn, int8_t type, int8_t cmprAlg, uint8_t **ppOut, int32_t nOut,
                      int32_t *szOut, uint8_t **ppBuf);
 int32_t tsdbDecmprData(uint8_t *pIn, int32_t szIn, int8_t type, int8_t cmprAlg, uint8_t **ppOut, int32_t szOut,
@@ -362,9 +372,11 @@ typedef struct {
   rocksdb_flushoptions_t              *flushoptions;
   rocksdb_writeoptions_t              *writeoptions;
   rocksdb_readoptions_t               *readoptions;
-  rocksdb_writebatch_t                *writebatch;
-  rocksdb_writebatch_t                *rwritebatch;
-  TdThreadMutex                        rMutex;
+  SRocksBatch                         *pBatch;     // the batch puts and deletes go to
+  SArray                              *pFlushing;  // SArray<SRocksBatch *>, swapped out and not written, oldest first
+  int64_t                              flushTask;  // the task writing pFlushing, 0 if none
+  TdThreadMutex                        rMutex;     // guards the batches
+  TdThreadMutex                        wMutex;     // serializes the writes of swapped out batches
   STSchema                            *pTSchema;
 } SRocksCache;
 
@@ -373,6 +385,28 @@ typedef struct {
   int    flush_count;
 } SCacheFlushState;
 
+typedef struct {
+  int64_t nHit;
+  int64_t nMiss;
+  int64_t nEvict;
+} SLastCacheStat;
+
+typedef struct {
+  int64_t nHit;
+  int64_t nMiss;
+} SPageCacheStat;
+
+typedef struct {
+  int64_t nMerge;
+  int64_t nToData;
+  int64_t bytesNew;  // of the level-0 stt files merged
+  int64_t bytesRead;
+  int64_t bytesWritten;
+} SSttMergeStat;
+
+// last cache entries of a table are guarded by one of the striped locks picked by uid
+#define TSDB_CACHE_LOCK_STRIPES 64
+
 struct STsdb {
   char                *path;
   SVnode              *pVnode;
@@ -384,7 +418,10 @@ struct STsdb {
   STsdbFS              fs;  // old
   SLRUCache           *lruCache;
   SCacheFlushState     flushState;
-  TdThreadMutex        lruMutex;
+  TdThreadMutex        lruMutex[TSDB_CACHE_LOCK_STRIPES];
+  SLastCacheStat       lastStat;
+  SPageCacheStat       pageStat;  // of dnode wide page cache
+  SSttMergeStat        mergeStat;
   SLRUCache           *biCache;
   TdThreadMutex        biMutex;
   SLRUCache           *bCache;
@@ -421,16 +458,31 @@ typedef struct SMemSkipList {
   SMemSkipListNode *pTail;
 } SMemSkipList;
 
+// in-order column batches are appended as they are instead of being put into the skip list row by row
+typedef struct SMemAppendBlk SMemAppendBlk;
+struct SMemAppendBlk {
+  SBlockData    *pBlockData;
+  SMemAppendBlk *pPrev;
+  SMemAppendBlk *pNext;
+};
+
+typedef struct SMemAppendList {
+  int64_t        size;
+  SMemAppendBlk *pHead;
+  SMemAppendBlk *pTail;
+} SMemAppendList;
+
 struct STbData {
-  tb_uid_t     suid;
-  tb_uid_t     uid;
-  TSKEY        minKey;
-  TSKEY        maxKey;
-  SDelData    *pHead;
-  SDelData    *pTail;
-  SMemSkipList sl;
-  STbData     *next;
-  SRBTreeNode  rbtn[1];
+  tb_uid_t       suid;
+  tb_uid_t       uid;
+  TSKEY          minKey;
+  TSKEY          maxKey;
+  SDelData      *pHead;
+  SDelData      *pTail;
+  SMemSkipList   sl;
+  SMemAppendList al;
+  STbData       *next;
+  SRBTreeNode    rbtn[1];
 };
 
 struct SMemTable {
@@ -560,6 +612,9 @@ struct STbDataIter {
   STbData          *pTbData;
   int8_t            backward;
   SMemSkipListNode *pNode;
+  SMemAppendBlk    *pBlk;  // current append block, NULL if the append list is exhausted
+  int32_t           iBlkRow;
+  int8_t            fromBlk;  // if the current row is from the append list
   TSDBROW          *pRow;
   TSDBROW           row;
 };
@@ -662,6 +717,8 @@ typedef struct {
   TdFilePtr   pFD;
   int64_t     pgno;
   uint8_t    *pBuf;
+  uint8_t    *pPgBuf;  // scratch for multi-page reads
+  int64_t     szPgBuf;
   int64_t     szFile;
   STsdb      *pTsdb;
   const char *objName;
@@ -669,6 +726,8 @@ typedef struct {
   int32_t     fid;
   int64_t     cid;
   int64_t     blkno;
+  int64_t     pcId;   // file id in page cache, 0: pages not cached
+  bool        pcHot;  // pages kept by page cache in preference to others
 } STsdbFD;
 
 struct SDelFWriter {
@@ -947,6 +1006,13 @@ int32_t tsdbCacheDeleteLastrow(SLRUCache *pCache, tb_uid_t uid, TSKEY eKey);
 int32_t tsdbCacheDeleteLast(SLRUCache *pCache, tb_uid_t uid, TSKEY eKey);
 int32_t tsdbCacheDelete(SLRUCache *pCache, tb_uid_t uid, TSKEY eKey);
 
+// tsdbPageCache ==============================================================================================
+void    tsdbPageCacheAttach(STsdbFD *pFD);
+bool    tsdbPageCacheGet(STsdbFD *pFD, int64_t pgno, uint8_t *pPage);
+void    tsdbPageCachePut(STsdbFD *pFD, int64_t pgno, const uint8_t *pPage);
+void    tsdbPageCacheRemoveFile(const char *path);
+void    tsdbPageCacheRemoveTsdb(STsdb *pTsdb);
+
 // ========== inline functions ==========
 static FORCE_INLINE int32_t tsdbKeyCmprFn(const void *p1, const void *p2) {
   TSDBKEY *pKey1 = (TSDBKEY *)p1;
@@ -970,6 +1036,8 @@ static FORCE_INLINE int32_t tsdbKeyCmprFn(const void *p1, const void *p2) {
 // #define SL_NODE_FORWARD(n, l)  ((n)->forwards[l])
 // #define SL_NODE_BACKWARD(n, l) ((n)->forwards[(n)->level + (l)])
 
+TSDBROW *tsdbTbDataIterGetMerge(STbDataIter *pIter);
+
 static FORCE_INLINE TSDBROW *tsdbTbDataIterGet(STbDataIter *pIter) {
   if (pIter == NULL) return NULL;
 
@@ -977,6 +1045,10 @@ static FORCE_INLINE TSDBROW *tsdbTbDataIterGet(STbDataIter *pIter) {
     return pIter->pRow;
   }
 
+  if (pIter->pBlk) {
+    return tsdbTbDataIterGetMerge(pIter);
+  }
+
   if (pIter->backward) {
     if (pIter->pNode == pIter->pTbData->sl.pHead) {
       return NULL;
@@ -73,7 +73,8 @@ int32_t vnodeACancel(SVAsync* async, int64_t taskId);
 int32_t vnodeAsyncSetWorkers(SVAsync* async, int32_t numWorkers);
 
 // vnodeModule.c
-extern SVAsync* vnodeAsyncHandle[2];
+extern SVAsync* vnodeAsyncHandle[4];
+extern void*    vnodeTimer;
 
 // vnodeBufPool.c
 typedef struct SVBufPoolNode SVBufPoolNode;
@@ -131,11 +132,17 @@ int32_t vnodeLoadInfo(const char* dir, SVnodeInfo* pInfo);
 int32_t vnodeSyncCommit(SVnode* pVnode);
 int32_t vnodeAsyncCommit(SVnode* pVnode);
 bool    vnodeShouldRollback(SVnode* pVnode);
+int64_t vnodeGetWriteDelay(SVnode* pVnode);
+void    vnodeRecordWriteStall(SVnode* pVnode, int64_t us);
+void    vnodeGetWriteStallLoad(SVnode* pVnode, SVnodeLoad* pLoad);
 
 // vnodeSync.c
 int32_t vnodeSyncOpen(SVnode* pVnode, char* path, int32_t vnodeVersion);
 int32_t vnodeSyncStart(SVnode* pVnode);
 void    vnodeSyncPreClose(SVnode* pVnode);
+bool    vnodeDeferWriteMsg(SVnode* pVnode, SRpcMsg* pMsg);
+bool    vnodeNextDeferredWrite(SVnode* pVnode, SRpcMsg* pMsg);
+void    vnodeStopDeferWrite(SVnode* pVnode);
 void    vnodeSyncPostClose(SVnode* pVnode);
 void    vnodeSyncClose(SVnode* pVnode);
 void    vnodeRedirectRpcMsg(SVnode* pVnode, SRpcMsg* pMsg, int32_t code);
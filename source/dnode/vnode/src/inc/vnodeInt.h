@@ -128,6 +128,20 @@ int32_t     metaTbCursorPrev(SMTbCursor* pTbCur, ETableType jumpTableType);
 
 void* vnodeBufPoolMalloc(SVBufPool* pPool, int size);
 void* vnodeBufPoolMallocAligned(SVBufPool* pPool, int size);
+
+// a private bump allocator carved from SVBufPool in chunks, so that concurrent writers only take the pool lock once
+// per chunk
+#define VNODE_BUFPOOL_ARENA_CHUNK (16 * 1024)
+typedef struct {
+  SVBufPool* pPool;
+  uint8_t*   ptr;
+  uint8_t*   end;
+} SVBufPoolArena;
+
+void  vnodeBufPoolArenaInit(SVBufPoolArena* pArena, SVBufPool* pPool);
+void* vnodeBufPoolArenaMalloc(SVBufPoolArena* pArena, int size);
+void* vnodeBufPoolArenaMallocAligned(SVBufPoolArena* pArena, int size);
+void  vnodeBufPoolArenaClear(SVBufPoolArena* pArena);
 void  vnodeBufPoolFree(SVBufPool* pPool, void* p);
 void  vnodeBufPoolRef(SVBufPool* pPool);
 void  vnodeBufPoolUnRef(SVBufPool* pPool, bool proactive);
@@ -208,6 +222,8 @@ typedef struct SMetaInfo {
 int32_t metaGetInfo(SMeta* pMeta, int64_t uid, SMetaInfo* pInfo, SMetaReader* pReader);
 
 // tsdb
+int32_t tsdbPageCacheOpen(int64_t capacity);
+void    tsdbPageCacheClose();
 int     tsdbOpen(SVnode* pVnode, STsdb** ppTsdb, const char* dir, STsdbKeepCfg* pKeepCfg, int8_t rollback, bool force);
 int     tsdbClose(STsdb** pTsdb);
 int32_t tsdbBegin(STsdb* pTsdb);
@@ -221,6 +237,7 @@ int32_t tsdbRetention(STsdb* tsdb, int64_t now, int32_t sync);
 int     tsdbScanAndConvertSubmitMsg(STsdb* pTsdb, SSubmitReq2* pMsg);
 int     tsdbInsertData(STsdb* pTsdb, int64_t version, SSubmitReq2* pMsg, SSubmitRsp2* pRsp);
 int32_t tsdbInsertTableData(STsdb* pTsdb, int64_t version, SSubmitTbData* pSubmitTbData, int32_t* affectedRows);
+int32_t tsdbInsertTableDataBatch(STsdb* pTsdb, int64_t version, SArray* aSubmitTbData, int32_t* affectedRows);
 int32_t tsdbDeleteTableData(STsdb* pTsdb, int64_t version, tb_uid_t suid, tb_uid_t uid, TSKEY sKey, TSKEY eKey);
 int32_t tsdbSetKeepCfg(STsdb* pTsdb, STsdbCfg* pCfg);
 
@@ -439,6 +456,32 @@ typedef struct SVCommitSched {
   int64_t maxWaitMs;
 } SVCommitSched;
 
+// buffer pool pressure of the write path, rates are smoothed and the counters only grow
+typedef struct SVWriteStall {
+  int64_t    ingestRate;  // bytes/s applied to the buffer pool in use
+  int64_t    commitRate;  // bytes/s of buffer pool flushed by commits
+  int64_t    sampleUs;
+  int64_t    sampleSize;
+  SVBufPool* earlyPool;  // pool an early commit was proposed for
+  int64_t    nEarlyCommit;
+  int64_t    nStall;
+  int64_t    stallUs;
+  int64_t    nDelay;
+  int64_t    delayUs;
+  tmr_h      deferTmr;   // timer to resume the deferred writes, NULL if it is not started
+  SArray*    pDeferred;  // SVDeferredWrite, in arrival order
+  void*      pResume;    // pCont of the first deferred write put back to the write queue to resume the others
+  int8_t     holding;    // later writes are held behind the deferred ones until all of them are proposed
+  bool       resuming;   // the write thread is proposing the deferred writes
+  bool       stopped;    // no more writes are deferred since the vnode is closing
+} SVWriteStall;
+
+// a submit deferred by the write thread under write pressure, instead of blocking the thread
+typedef struct SVDeferredWrite {
+  SRpcMsg msg;
+  int64_t deferUs;
+} SVDeferredWrite;
+
 struct SVnode {
   char*     path;
   SVnodeCfg config;
@@ -446,6 +489,7 @@ struct SVnode {
   SVStatis  statis;
   STfs*     pTfs;
   int32_t   diskPrimary;
+  int32_t   numaNode;  // -1 if the vnode is not bound to a NUMA node
   SMsgCb    msgCb;
 
   // Buffer Pool
@@ -460,8 +504,9 @@ struct SVnode {
   SVBufPool*    onRecycle;
 
   // commit variables
-  int64_t commitChannel;
-  int64_t commitTask;
+  int64_t      commitChannel;
+  int64_t      commitTask;
+  SVWriteStall writeStall;
 
   SMeta*        pMeta;
   SSma*         pSma;
@@ -173,6 +173,42 @@ static int myCmp(void *state, const char *a, size_t alen, const char *b, size_t
   return 0;
 }
 
+// a batch of puts and deletes of the rocks cache, indexed so that reads are served from it until it is written
+struct SRocksBatch {
+  rocksdb_writebatch_wi_t *wb;
+  SHashObj                *pDeleted;  // keys deleted in the batch, which the index does not tell from absent ones
+};
+
+static SRocksBatch *rocksBatchCreate(void) {
+  SRocksBatch *pBatch = taosMemoryCalloc(1, sizeof(*pBatch));
+  if (pBatch == NULL) {
+    return NULL;
+  }
+
+  pBatch->wb = rocksdb_writebatch_wi_create(0, 1);
+  pBatch->pDeleted = taosHashInit(16, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY), true, HASH_NO_LOCK);
+  if (pBatch->wb == NULL || pBatch->pDeleted == NULL) {
+    if (pBatch->wb) rocksdb_writebatch_wi_destroy(pBatch->wb);
+    taosHashCleanup(pBatch->pDeleted);
+    taosMemoryFree(pBatch);
+    return NULL;
+  }
+
+  return pBatch;
+}
+
+static void rocksBatchDestroy(SRocksBatch *pBatch) {
+  if (pBatch == NULL) {
+    return;
+  }
+
+  rocksdb_writebatch_wi_destroy(pBatch->wb);
+  taosHashCleanup(pBatch->pDeleted);
+  taosMemoryFree(pBatch);
+}
+
+static void rocksWriteBatches(STsdb *pTsdb, bool task);
+
 static int32_t tsdbOpenRocksCache(STsdb *pTsdb) {
   int32_t code = 0;
 
@@ -182,7 +218,7 @@ static int32_t tsdbOpenRocksCache(STsdb *pTsdb) {
     return code;
   }
 
-  rocksdb_cache_t *cache = rocksdb_cache_create_lru(5 * 1024 * 1024);
+  rocksdb_cache_t *cache = rocksdb_cache_create_lru((size_t)tsCacheLastBlockCacheSize * 1024 * 1024);
   pTsdb->rCache.blockcache = cache;
 
   rocksdb_block_based_table_options_t *tableoptions = rocksdb_block_based_options_create();
@@ -199,6 +235,9 @@ static int32_t tsdbOpenRocksCache(STsdb *pTsdb) {
   rocksdb_block_based_options_set_block_cache(tableoptions, cache);
   rocksdb_options_set_block_based_table_factory(options, tableoptions);
   rocksdb_options_set_info_log_level(options, 2);  // WARN_LEVEL
+  if (tsCacheLastWriteBufferSize > 0) {
+    rocksdb_options_set_write_buffer_size(options, (size_t)tsCacheLastWriteBufferSize * 1024 * 1024);
+  }
   // rocksdb_options_set_inplace_update_support(options, 1);
   // rocksdb_options_set_allow_concurrent_memtable_write(options, 0);
 
@@ -234,11 +273,18 @@ static int32_t tsdbOpenRocksCache(STsdb *pTsdb) {
     goto _err5;
   }
 
-  rocksdb_writebatch_t *writebatch = rocksdb_writebatch_create();
-  rocksdb_writebatch_t *rwritebatch = rocksdb_writebatch_create();
+  SRocksBatch *pBatch = rocksBatchCreate();
+  SArray      *pFlushing = taosArrayInit(4, POINTER_BYTES);
+  if (NULL == pBatch || NULL == pFlushing) {
+    rocksBatchDestroy(pBatch);
+    taosArrayDestroy(pFlushing);
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err6;
+  }
 
-  pTsdb->rCache.writebatch = writebatch;
-  pTsdb->rCache.rwritebatch = rwritebatch;
+  pTsdb->rCache.pBatch = pBatch;
+  pTsdb->rCache.pFlushing = pFlushing;
+  pTsdb->rCache.flushTask = 0;
   pTsdb->rCache.my_comparator = cmp;
   pTsdb->rCache.options = options;
   pTsdb->rCache.writeoptions = writeoptions;
@@ -247,13 +293,16 @@ static int32_t tsdbOpenRocksCache(STsdb *pTsdb) {
   pTsdb->rCache.db = db;
 
   taosThreadMutexInit(&pTsdb->rCache.rMutex, NULL);
+  taosThreadMutexInit(&pTsdb->rCache.wMutex, NULL);
 
   pTsdb->rCache.pTSchema = NULL;
 
   return code;
 
+_err6:
+  rocksdb_flushoptions_destroy(flushoptions);
 _err5:
-  rocksdb_close(pTsdb->rCache.db);
+  rocksdb_close(db);
 _err4:
   rocksdb_readoptions_destroy(readoptions);
 _err3:
@@ -268,10 +317,31 @@ _err:
 }
 
 static void tsdbCloseRocksCache(STsdb *pTsdb) {
+  SRocksCache *rCache = &pTsdb->rCache;
+
+  // the flush task is stopped, and the batches not written yet are written here before rocksdb is closed
+  taosThreadMutexLock(&rCache->rMutex);
+  int64_t flushTask = rCache->flushTask;
+  taosThreadMutexUnlock(&rCache->rMutex);
+  if (flushTask != 0 && vnodeACancel(vnodeAsyncHandle[0], flushTask) != 0) {
+    vnodeAWait(vnodeAsyncHandle[0], flushTask);
+  }
+  rCache->flushTask = 0;
+
+  rocksWriteBatches(pTsdb, false);
+  if (rocksdb_writebatch_wi_count(rCache->pBatch->wb) > 0) {
+    char *err = NULL;
+    rocksdb_write_writebatch_wi(rCache->db, rCache->writeoptions, rCache->pBatch->wb, &err);
+    if (NULL != err) {
+      tsdbError("vgId:%d, %s failed at line %d since %s", TD_VID(pTsdb->pVnode), __func__, __LINE__, err);
+      rocksdb_free(err);
+    }
+  }
+
   rocksdb_close(pTsdb->rCache.db);
   rocksdb_flushoptions_destroy(pTsdb->rCache.flushoptions);
-  rocksdb_writebatch_destroy(pTsdb->rCache.writebatch);
-  rocksdb_writebatch_destroy(pTsdb->rCache.rwritebatch);
+  rocksBatchDestroy(pTsdb->rCache.pBatch);
+  taosArrayDestroy(pTsdb->rCache.pFlushing);
   rocksdb_readoptions_destroy(pTsdb->rCache.readoptions);
   rocksdb_writeoptions_destroy(pTsdb->rCache.writeoptions);
   rocksdb_options_destroy(pTsdb->rCache.options);
@@ -279,44 +349,189 @@ static void tsdbCloseRocksCache(STsdb *pTsdb) {
   rocksdb_cache_destroy(pTsdb->rCache.blockcache);
   rocksdb_comparator_destroy(pTsdb->rCache.my_comparator);
   taosThreadMutexDestroy(&pTsdb->rCache.rMutex);
+  taosThreadMutexDestroy(&pTsdb->rCache.wMutex);
   taosMemoryFree(pTsdb->rCache.pTSchema);
 }
 
-static void rocksMayWrite(STsdb *pTsdb, bool force, bool read, bool lock) {
-  rocksdb_writebatch_t *wb = pTsdb->rCache.writebatch;
-  if (read) {
-    if (lock) {
-      taosThreadMutexLock(&pTsdb->lruMutex);
+static TdThreadMutex *tsdbCacheLock(STsdb *pTsdb, tb_uid_t uid) {
+  return &pTsdb->lruMutex[(uint64_t)uid % TSDB_CACHE_LOCK_STRIPES];
+}
+
+// called with rMutex held
+static void rocksPut(STsdb *pTsdb, const char *key, size_t klen, const char *value, size_t vlen) {
+  SRocksBatch *pBatch = pTsdb->rCache.pBatch;
+
+  rocksdb_writebatch_wi_put(pBatch->wb, key, klen, value, vlen);
+  taosHashRemove(pBatch->pDeleted, key, klen);
+}
+
+// called with rMutex held
+static void rocksDelete(STsdb *pTsdb, const char *key, size_t klen) {
+  SRocksBatch *pBatch = pTsdb->rCache.pBatch;
+
+  rocksdb_writebatch_wi_delete(pBatch->wb, key, klen);
+  taosHashPut(pBatch->pDeleted, key, klen, NULL, 0);
+}
+
+// called with rMutex held. 1 is returned if the key is put in the batch, with its value in *ppValue, -1 if it is
+// deleted, and 0 if the batch does not touch it
+static int32_t rocksBatchGet(STsdb *pTsdb, SRocksBatch *pBatch, const char *key, size_t klen, char **ppValue,
+                             size_t *vlen) {
+  char *err = NULL;
+
+  *ppValue = rocksdb_writebatch_wi_get_from_batch(pBatch->wb, pTsdb->rCache.options, key, klen, vlen, &err);
+  if (NULL != err) {
+    tsdbError("vgId:%d, %s failed at line %d since %s", TD_VID(pTsdb->pVnode), __func__, __LINE__, err);
+    rocksdb_free(err);
+  }
+  if (*ppValue) {
+    return 1;
+  }
+
+  return taosHashGet(pBatch->pDeleted, key, klen) ? -1 : 0;
+}
+
+/*
+ * Write the swapped out batches to rocksdb in order, one writer at a time. A batch is dropped only after it is
+ * written, so that a read finds a key either in a batch or in rocksdb. The flush task clears rCache.flushTask when it
+ * finds no more batch, in the same critical section, so that a batch swapped out later starts a new task.
+ */
+static void rocksWriteBatches(STsdb *pTsdb, bool task) {
+  SRocksCache *rCache = &pTsdb->rCache;
+
+  taosThreadMutexLock(&rCache->wMutex);
+  while (1) {
+    SRocksBatch *pBatch = NULL;
+
+    taosThreadMutexLock(&rCache->rMutex);
+    if (taosArrayGetSize(rCache->pFlushing) > 0) {
+      pBatch = *(SRocksBatch **)taosArrayGet(rCache->pFlushing, 0);
+    } else if (task) {
+      rCache->flushTask = 0;
     }
-    wb = pTsdb->rCache.rwritebatch;
-  } else {
-    if (lock) {
-      taosThreadMutexLock(&pTsdb->rCache.rMutex);
+    taosThreadMutexUnlock(&rCache->rMutex);
+
+    if (pBatch == NULL) {
+      break;
     }
-  }
 
-  int count = rocksdb_writebatch_count(wb);
-  if ((force && count > 0) || count >= ROCKS_BATCH_SIZE) {
     char *err = NULL;
-
-    rocksdb_write(pTsdb->rCache.db, pTsdb->rCache.writeoptions, wb, &err);
+    rocksdb_write_writebatch_wi(rCache->db, rCache->writeoptions, pBatch->wb, &err);
     if (NULL != err) {
-      tsdbError("vgId:%d, %s failed at line %d, count: %d since %s", TD_VID(pTsdb->pVnode), __func__, __LINE__, count,
-                err);
+      tsdbError("vgId:%d, %s failed at line %d, count: %d since %s", TD_VID(pTsdb->pVnode), __func__, __LINE__,
+                rocksdb_writebatch_wi_count(pBatch->wb), err);
       rocksdb_free(err);
-      // pTsdb->flushState.flush_count = 0;
     }
 
-    rocksdb_writebatch_clear(wb);
+    taosThreadMutexLock(&rCache->rMutex);
+    taosArrayRemove(rCache->pFlushing, 0);
+    taosThreadMutexUnlock(&rCache->rMutex);
+    rocksBatchDestroy(pBatch);
   }
+  taosThreadMutexUnlock(&rCache->wMutex);
+}
+
+static int32_t rocksFlushTask(void *arg) {
+  rocksWriteBatches((STsdb *)arg, true);
+  return 0;
+}
+
+/*
+ * Swap out the batch when it is full or forced, and leave it to the flush task on the vnode-commit pool, so that the
+ * caller does not wait for rocksdb. The batches are written by the caller only if the task can not be started, and if
+ * lock is not set, the caller holds rMutex and they are left to the next write.
+ */
+static void rocksMayWrite(STsdb *pTsdb, bool force, bool lock) {
+  SRocksCache *rCache = &pTsdb->rCache;
+  bool         write = false;
 
   if (lock) {
-    if (read) {
-      taosThreadMutexUnlock(&pTsdb->lruMutex);
+    taosThreadMutexLock(&rCache->rMutex);
+  }
+
+  int count = rocksdb_writebatch_wi_count(rCache->pBatch->wb);
+  if ((force && count > 0) || count >= ROCKS_BATCH_SIZE) {
+    SRocksBatch *pBatch = rocksBatchCreate();
+    if (pBatch != NULL && taosArrayPush(rCache->pFlushing, &rCache->pBatch) != NULL) {
+      rCache->pBatch = pBatch;
     } else {
-      taosThreadMutexUnlock(&pTsdb->rCache.rMutex);
+      rocksBatchDestroy(pBatch);
+    }
+
+    if (rCache->flushTask == 0 &&
+        vnodeAsync(vnodeAsyncHandle[0], EVA_PRIORITY_HIGH, rocksFlushTask, NULL, pTsdb, &rCache->flushTask) != 0) {
+      rCache->flushTask = 0;
+      write = taosArrayGetSize(rCache->pFlushing) > 0;
+    }
+  }
+
+  if (lock) {
+    taosThreadMutexUnlock(&rCache->rMutex);
+    if (write) {
+      rocksWriteBatches(pTsdb, false);
+    }
+  }
+}
+
+/*
+ * Get the keys from the batches not written yet, newest first, and the rest from rocksdb, so that a miss of the lru
+ * does not wait for the pending batches to be written. The values are freed by rocksdb_free. The caller must not hold
+ * rMutex.
+ */
+static void rocksMultiGet(STsdb *pTsdb, int num_keys, const char *const *keys_list, const size_t *keys_list_sizes,
+                          char **values_list, size_t *values_list_sizes, char **errs) {
+  SRocksCache *rCache = &pTsdb->rCache;
+  int          nRemain = 0;
+  int         *remainIdx = taosMemoryMalloc(num_keys * sizeof(int));
+  const char **remainKeys = taosMemoryMalloc(num_keys * sizeof(char *));
+  size_t      *remainKeySizes = taosMemoryMalloc(num_keys * sizeof(size_t));
+  char       **remainValues = taosMemoryCalloc(num_keys, sizeof(char *));
+  size_t      *remainValueSizes = taosMemoryCalloc(num_keys, sizeof(size_t));
+  char       **remainErrs = taosMemoryCalloc(num_keys, sizeof(char *));
+
+  if (!remainIdx || !remainKeys || !remainKeySizes || !remainValues || !remainValueSizes || !remainErrs) {
+    // every key goes to the batches and rocksdb in turn
+    taosMemoryFreeClear(remainIdx);
+  }
+
+  taosThreadMutexLock(&rCache->rMutex);
+  for (int i = 0; i < num_keys; ++i) {
+    int32_t found = rocksBatchGet(pTsdb, rCache->pBatch, keys_list[i], keys_list_sizes[i], &values_list[i],
+                                  &values_list_sizes[i]);
+    for (int32_t iBatch = taosArrayGetSize(rCache->pFlushing) - 1; found == 0 && iBatch >= 0; --iBatch) {
+      SRocksBatch *pBatch = *(SRocksBatch **)taosArrayGet(rCache->pFlushing, iBatch);
+      found = rocksBatchGet(pTsdb, pBatch, keys_list[i], keys_list_sizes[i], &values_list[i], &values_list_sizes[i]);
+    }
+    errs[i] = NULL;
+
+    if (found == 0 && remainIdx) {
+      remainIdx[nRemain] = i;
+      remainKeys[nRemain] = keys_list[i];
+      remainKeySizes[nRemain] = keys_list_sizes[i];
+      nRemain++;
+    } else if (found == 0) {
+      values_list[i] = rocksdb_get(rCache->db, rCache->readoptions, keys_list[i], keys_list_sizes[i],
+                                   &values_list_sizes[i], &errs[i]);
+    }
+  }
+  taosThreadMutexUnlock(&rCache->rMutex);
+
+  if (nRemain > 0) {
+    rocksdb_multi_get(rCache->db, rCache->readoptions, nRemain, remainKeys, remainKeySizes, remainValues,
+                      remainValueSizes, remainErrs);
+    for (int i = 0; i < nRemain; ++i) {
+      values_list[remainIdx[i]] = remainValues[i];
+      values_list_sizes[remainIdx[i]] = remainValueSizes[i];
+      errs[remainIdx[i]] = remainErrs[i];
     }
   }
+
+  taosMemoryFree(remainIdx);
+  taosMemoryFree(remainKeys);
+  taosMemoryFree(remainKeySizes);
+  taosMemoryFree(remainValues);
+  taosMemoryFree(remainValueSizes);
+  taosMemoryFree(remainErrs);
 }
 
 static SLastCol *tsdbCacheDeserialize(char const *value) {
@@ -360,36 +575,20 @@ static void tsdbCacheSerialize(SLastCol *pLastCol, char **value, size_t *size) {
 }
 
 static void tsdbCachePutBatch(SLastCol *pLastCol, const void *key, size_t klen, SCacheFlushState *state) {
-  STsdb                *pTsdb = state->pTsdb;
-  SRocksCache          *rCache = &pTsdb->rCache;
-  rocksdb_writebatch_t *wb = rCache->writebatch;
-  char                 *rocks_value = NULL;
-  size_t                vlen = 0;
+  STsdb       *pTsdb = state->pTsdb;
+  SRocksCache *rCache = &pTsdb->rCache;
+  char        *rocks_value = NULL;
+  size_t       vlen = 0;
 
   tsdbCacheSerialize(pLastCol, &rocks_value, &vlen);
 
   taosThreadMutexLock(&rCache->rMutex);
-
-  rocksdb_writebatch_put(wb, (char *)key, klen, rocks_value, vlen);
+  rocksPut(pTsdb, (char *)key, klen, rocks_value, vlen);
+  taosThreadMutexUnlock(&rCache->rMutex);
 
   taosMemoryFree(rocks_value);
 
-  if (++state->flush_count >= ROCKS_BATCH_SIZE) {
-    char *err = NULL;
-
-    rocksdb_write(rCache->db, rCache->writeoptions, wb, &err);
-    if (NULL != err) {
-      tsdbError("vgId:%d, %s failed at line %d, count: %d since %s", TD_VID(pTsdb->pVnode), __func__, __LINE__,
-                state->flush_count, err);
-      rocksdb_free(err);
-    }
-
-    rocksdb_writebatch_clear(wb);
-
-    state->flush_count = 0;
-  }
-
-  taosThreadMutexUnlock(&rCache->rMutex);
+  rocksMayWrite(pTsdb, false, true);
 }
 
 int tsdbCacheFlushDirty(const void *key, size_t klen, void *value, void *ud) {
@@ -408,18 +607,25 @@ int32_t tsdbCacheCommit(STsdb *pTsdb) {
   int32_t code = 0;
   char   *err = NULL;
 
-  SLRUCache            *pCache = pTsdb->lruCache;
-  rocksdb_writebatch_t *wb = pTsdb->rCache.writebatch;
+  SLRUCache *pCache = pTsdb->lruCache;
 
-  taosThreadMutexLock(&pTsdb->lruMutex);
+  for (int32_t i = 0; i < TSDB_CACHE_LOCK_STRIPES; ++i) {
+    taosThreadMutexLock(&pTsdb->lruMutex[i]);
+  }
 
   taosLRUCacheApply(pCache, tsdbCacheFlushDirty, &pTsdb->flushState);
 
-  rocksMayWrite(pTsdb, true, false, false);
-  rocksMayWrite(pTsdb, true, true, false);
+  // the batches are written here rather than left to the flush task, so that they are flushed below
+  rocksMayWrite(pTsdb, true, true);
+  rocksWriteBatches(pTsdb, false);
+
+  taosThreadMutexLock(&pTsdb->rCache.wMutex);
   rocksdb_flush(pTsdb->rCache.db, pTsdb->rCache.flushoptions, &err);
+  taosThreadMutexUnlock(&pTsdb->rCache.wMutex);
 
-  taosThreadMutexUnlock(&pTsdb->lruMutex);
+  for (int32_t i = TSDB_CACHE_LOCK_STRIPES - 1; i >= 0; --i) {
+    taosThreadMutexUnlock(&pTsdb->lruMutex[i]);
+  }
 
   if (NULL != err) {
     tsdbError("vgId:%d, %s failed at line %d since %s", TD_VID(pTsdb->pVnode), __func__, __LINE__, err);
@@ -461,9 +667,16 @@ static void reallocVarData(SColVal *pColVal) {
   }
 }
 
+// set while entries are erased on purpose, so that only the entries evicted by the lru are counted
+static threadlocal bool tsdbCacheErasing = false;
+
 static void tsdbCacheDeleter(const void *key, size_t klen, void *value, void *ud) {
   SLastCol *pLastCol = (SLastCol *)value;
 
+  if (!tsdbCacheErasing) {
+    atomic_add_fetch_64(&((SCacheFlushState *)ud)->pTsdb->lastStat.nEvict, 1);
+  }
+
   if (pLastCol->dirty) {
     tsdbCachePutBatch(pLastCol, key, klen, (SCacheFlushState *)ud);
   }
@@ -509,9 +722,10 @@ int32_t tsdbCacheUpdate(STsdb *pTsdb, tb_uid_t suid, tb_uid_t uid, TSDBROW *pRow
   int        num_keys = TARRAY_SIZE(aColVal);
   TSKEY      keyTs = TSDBROW_TS(pRow);
   SArray    *remainCols = NULL;
-  SLRUCache *pCache = pTsdb->lruCache;
+  SLRUCache     *pCache = pTsdb->lruCache;
+  TdThreadMutex *pLock = tsdbCacheLock(pTsdb, uid);
 
-  taosThreadMutexLock(&pTsdb->lruMutex);
+  taosThreadMutexLock(pLock);
   for (int i = 0; i < num_keys; ++i) {
     SColVal *pColVal = (SColVal *)taosArrayGet(aColVal, i);
     int16_t  cid = pColVal->cid;
@@ -611,8 +825,8 @@ int32_t tsdbCacheUpdate(STsdb *pTsdb, tb_uid_t suid, tb_uid_t uid, TSDBROW *pRow
     char  **values_list = taosMemoryCalloc(num_keys, sizeof(char *));
     size_t *values_list_sizes = taosMemoryCalloc(num_keys, sizeof(size_t));
     char  **errs = taosMemoryCalloc(num_keys, sizeof(char *));
-    rocksdb_multi_get(pTsdb->rCache.db, pTsdb->rCache.readoptions, num_keys, (const char *const *)keys_list,
-                      keys_list_sizes, values_list, values_list_sizes, errs);
+    rocksMultiGet(pTsdb, num_keys, (const char *const *)keys_list, keys_list_sizes, values_list, values_list_sizes,
+                  errs);
     for (int i = 0; i < num_keys; ++i) {
       rocksdb_free(errs[i]);
     }
@@ -621,7 +835,6 @@ int32_t tsdbCacheUpdate(STsdb *pTsdb, tb_uid_t suid, tb_uid_t uid, TSDBROW *pRow
     taosMemoryFree(keys_list_sizes);
     taosMemoryFree(values_list_sizes);
 
-    rocksdb_writebatch_t *wb = pTsdb->rCache.writebatch;
     for (int i = 0; i < num_keys; ++i) {
       SIdxKey *idxKey = &((SIdxKey *)TARRAY_DATA(remainCols))[i];
       SColVal *pColVal = (SColVal *)TARRAY_DATA(aColVal) + idxKey->idx;
@@ -637,7 +850,7 @@ int32_t tsdbCacheUpdate(STsdb *pTsdb, tb_uid_t suid, tb_uid_t uid, TSDBROW *pRow
           // SLastKey key = (SLastKey){.ltype = 0, .uid = uid, .cid = pColVal->cid};
           taosThreadMutexLock(&pTsdb->rCache.rMutex);
 
-          rocksdb_writebatch_put(wb, (char *)&idxKey->key, ROCKS_KEY_LEN, value, vlen);
+          rocksPut(pTsdb, (char *)&idxKey->key, ROCKS_KEY_LEN, value, vlen);
 
           taosThreadMutexUnlock(&pTsdb->rCache.rMutex);
 
@@ -669,7 +882,7 @@ int32_t tsdbCacheUpdate(STsdb *pTsdb, tb_uid_t suid, tb_uid_t uid, TSDBROW *pRow
             // SLastKey key = (SLastKey){.ltype = 1, .uid = uid, .cid = pColVal->cid};
             taosThreadMutexLock(&pTsdb->rCache.rMutex);
 
-            rocksdb_writebatch_put(wb, (char *)&idxKey->key, ROCKS_KEY_LEN, value, vlen);
+            rocksPut(pTsdb, (char *)&idxKey->key, ROCKS_KEY_LEN, value, vlen);
 
             taosThreadMutexUnlock(&pTsdb->rCache.rMutex);
 
@@ -698,14 +911,14 @@ int32_t tsdbCacheUpdate(STsdb *pTsdb, tb_uid_t suid, tb_uid_t uid, TSDBROW *pRow
       rocksdb_free(values_list[i]);
     }
 
-    rocksMayWrite(pTsdb, true, false, true);
+    rocksMayWrite(pTsdb, false, true);
 
     taosMemoryFree(values_list);
 
     taosArrayDestroy(remainCols);
   }
 
-  taosThreadMutexUnlock(&pTsdb->lruMutex);
+  taosThreadMutexUnlock(pLock);
 
 _exit:
   taosArrayDestroy(aColVal);
@@ -720,8 +933,8 @@ static int32_t mergeLastRowCid(tb_uid_t uid, STsdb *pTsdb, SArray **ppLastArray,
                                int nCols, int16_t *slotIds);
 #if 1
 int32_t tsdbCacheGetSlow(STsdb *pTsdb, tb_uid_t uid, SArray *pLastArray, SCacheRowsReader *pr, int8_t ltype) {
-  rocksdb_writebatch_t *wb = NULL;
-  int32_t               code = 0;
+  bool    put = false;
+  int32_t code = 0;
 
   SArray *pCidList = pr->pCidList;
   int     num_keys = TARRAY_SIZE(pCidList);
@@ -740,8 +953,7 @@ int32_t tsdbCacheGetSlow(STsdb *pTsdb, tb_uid_t uid, SArray *pLastArray, SCacheR
   char  **values_list = taosMemoryCalloc(num_keys, sizeof(char *));
   size_t *values_list_sizes = taosMemoryCalloc(num_keys, sizeof(size_t));
   char  **errs = taosMemoryMalloc(num_keys * sizeof(char *));
-  rocksdb_multi_get(pTsdb->rCache.db, pTsdb->rCache.readoptions, num_keys, (const char *const *)keys_list,
-                    keys_list_sizes, values_list, values_list_sizes, errs);
+  rocksMultiGet(pTsdb, num_keys, (const char *const *)keys_list, keys_list_sizes, values_list, values_list_sizes, errs);
   for (int i = 0; i < num_keys; ++i) {
     if (errs[i]) {
       rocksdb_free(errs[i]);
@@ -788,22 +1000,22 @@ int32_t tsdbCacheGetSlow(STsdb *pTsdb, tb_uid_t uid, SArray *pLastArray, SCacheR
         }
 
         // store result back to rocks cache
-        wb = pTsdb->rCache.rwritebatch;
+        put = true;
         char  *value = NULL;
         size_t vlen = 0;
         tsdbCacheSerialize(pLastCol, &value, &vlen);
 
         SLastKey *key = &(SLastKey){.ltype = ltype, .uid = uid, .cid = pLastCol->colVal.cid};
         size_t    klen = ROCKS_KEY_LEN;
-        rocksdb_writebatch_put(wb, (char *)key, klen, value, vlen);
+        rocksPut(pTsdb, (char *)key, klen, value, vlen);
 
         taosMemoryFree(value);
       } else {
         reallocVarData(&pLastCol->colVal);
       }
 
-      if (wb) {
-        rocksMayWrite(pTsdb, false, true, false);
+      if (put) {
+        rocksMayWrite(pTsdb, false, false);
       }
 
       taosThreadMutexUnlock(&pTsdb->rCache.rMutex);
@@ -826,7 +1038,7 @@ static SLastCol *tsdbCacheLoadCol(STsdb *pTsdb, SCacheRowsReader *pr, int16_t sl
                                   int8_t ltype) {
   SLastCol *pLastCol = tsdbCacheLookup(pTsdb, uid, cid, ltype);
   if (!pLastCol) {
-    rocksdb_writebatch_t *wb = NULL;
+    bool put = false;
 
     taosThreadMutexLock(&pTsdb->rCache.rMutex);
     pLastCol = tsdbCacheLookup(pTsdb, uid, cid, ltype);
@@ -853,14 +1065,14 @@ static SLastCol *tsdbCacheLoadCol(STsdb *pTsdb, SCacheRowsReader *pr, int16_t sl
       }
 
       // store result back to rocks cache
-      wb = pTsdb->rCache.rwritebatch;
+      put = true;
       char  *value = NULL;
       size_t vlen = 0;
       tsdbCacheSerialize(pLastCol, &value, &vlen);
 
       SLastKey *key = &(SLastKey){.ltype = ltype, .uid = uid, .cid = pLastCol->colVal.cid};
       size_t    klen = ROCKS_KEY_LEN;
-      rocksdb_writebatch_put(wb, (char *)key, klen, value, vlen);
+      rocksPut(pTsdb, (char *)key, klen, value, vlen);
       taosMemoryFree(value);
 
       SLastCol *pTmpLastCol = taosMemoryCalloc(1, sizeof(SLastCol));
@@ -870,8 +1082,8 @@ static SLastCol *tsdbCacheLoadCol(STsdb *pTsdb, SCacheRowsReader *pr, int16_t sl
       taosArrayDestroy(pTmpColArray);
     }
 
-    if (wb) {
-      rocksMayWrite(pTsdb, false, true, false);
+    if (put) {
+      rocksMayWrite(pTsdb, false, false);
     }
 
     taosThreadMutexUnlock(&pTsdb->rCache.rMutex);
@@ -882,10 +1094,10 @@ static SLastCol *tsdbCacheLoadCol(STsdb *pTsdb, SCacheRowsReader *pr, int16_t sl
 
 static int32_t tsdbCacheLoadFromRaw(STsdb *pTsdb, tb_uid_t uid, SArray *pLastArray, SArray *remainCols,
                                     SCacheRowsReader *pr, int8_t ltype) {
-  int32_t               code = 0;
-  rocksdb_writebatch_t *wb = NULL;
-  SArray               *pTmpColArray = NULL;
-  int                   num_keys = TARRAY_SIZE(remainCols);
+  int32_t code = 0;
+  bool    put = false;
+  SArray *pTmpColArray = NULL;
+  int     num_keys = TARRAY_SIZE(remainCols);
   int16_t              *aCols = taosMemoryMalloc(num_keys * sizeof(int16_t));
   int16_t              *slotIds = taosMemoryMalloc(num_keys * sizeof(int16_t));
 
@@ -942,19 +1154,21 @@ static int32_t tsdbCacheLoadFromRaw(STsdb *pTsdb, tb_uid_t uid, SArray *pLastArr
     }
 
     // store result back to rocks cache
-    wb = pTsdb->rCache.rwritebatch;
     char  *value = NULL;
     size_t vlen = 0;
     tsdbCacheSerialize(pLastCol, &value, &vlen);
 
     SLastKey *key = &idxKey->key;
     size_t    klen = ROCKS_KEY_LEN;
-    rocksdb_writebatch_put(wb, (char *)key, klen, value, vlen);
+    taosThreadMutexLock(&pTsdb->rCache.rMutex);
+    rocksPut(pTsdb, (char *)key, klen, value, vlen);
+    taosThreadMutexUnlock(&pTsdb->rCache.rMutex);
     taosMemoryFree(value);
+    put = true;
   }
 
-  if (wb) {
-    rocksMayWrite(pTsdb, false, true, false);
+  if (put) {
+    rocksMayWrite(pTsdb, false, true);
   }
 
   taosArrayDestroy(pTmpColArray);
@@ -983,8 +1197,7 @@ static int32_t tsdbCacheLoadFromRocks(STsdb *pTsdb, tb_uid_t uid, SArray *pLastA
   char  **values_list = taosMemoryCalloc(num_keys, sizeof(char *));
   size_t *values_list_sizes = taosMemoryCalloc(num_keys, sizeof(size_t));
   char  **errs = taosMemoryMalloc(num_keys * sizeof(char *));
-  rocksdb_multi_get(pTsdb->rCache.db, pTsdb->rCache.readoptions, num_keys, (const char *const *)keys_list,
-                    keys_list_sizes, values_list, values_list_sizes, errs);
+  rocksMultiGet(pTsdb, num_keys, (const char *const *)keys_list, keys_list_sizes, values_list, values_list_sizes, errs);
   for (int i = 0; i < num_keys; ++i) {
     if (errs[i]) {
       rocksdb_free(errs[i]);
@@ -1044,6 +1257,7 @@ int32_t tsdbCacheGetBatch(STsdb *pTsdb, tb_uid_t uid, SArray *pLastArray, SCache
   SLRUCache *pCache = pTsdb->lruCache;
   SArray    *pCidList = pr->pCidList;
   int        num_keys = TARRAY_SIZE(pCidList);
+  int64_t    nHit = 0;
 
   for (int i = 0; i < num_keys; ++i) {
     int16_t cid = ((int16_t *)TARRAY_DATA(pCidList))[i];
@@ -1059,6 +1273,7 @@ int32_t tsdbCacheGetBatch(STsdb *pTsdb, tb_uid_t uid, SArray *pLastArray, SCache
       taosArrayPush(pLastArray, &lastCol);
 
       taosLRUCacheRelease(pCache, h, false);
+      ++nHit;
     } else {
       SLastCol noneCol = {.ts = TSKEY_MIN, .colVal = COL_VAL_NONE(cid, pr->pSchema->columns[pr->pSlotIds[i]].type)};
 
@@ -1071,8 +1286,16 @@ int32_t tsdbCacheGetBatch(STsdb *pTsdb, tb_uid_t uid, SArray *pLastArray, SCache
     }
   }
 
+  if (nHit > 0) {
+    atomic_add_fetch_64(&pTsdb->lastStat.nHit, nHit);
+  }
+
   if (remainCols && TARRAY_SIZE(remainCols) > 0) {
-    taosThreadMutexLock(&pTsdb->lruMutex);
+    TdThreadMutex *pLock = tsdbCacheLock(pTsdb, uid);
+
+    atomic_add_fetch_64(&pTsdb->lastStat.nMiss, TARRAY_SIZE(remainCols));
+
+    taosThreadMutexLock(pLock);
     for (int i = 0; i < TARRAY_SIZE(remainCols);) {
       SIdxKey   *idxKey = &((SIdxKey *)TARRAY_DATA(remainCols))[i];
       LRUHandle *h = taosLRUCacheLookup(pCache, &idxKey->key, ROCKS_KEY_LEN);
@@ -1094,7 +1317,7 @@ int32_t tsdbCacheGetBatch(STsdb *pTsdb, tb_uid_t uid, SArray *pLastArray, SCache
     // tsdbTrace("tsdb/cache: vgId: %d, load %" PRId64 " from rocks", TD_VID(pTsdb->pVnode), uid);
     code = tsdbCacheLoadFromRocks(pTsdb, uid, pLastArray, remainCols, pr, ltype);
 
-    taosThreadMutexUnlock(&pTsdb->lruMutex);
+    taosThreadMutexUnlock(pLock);
 
     if (remainCols) {
       taosArrayDestroy(remainCols);
@@ -1138,13 +1361,11 @@ int32_t tsdbCacheDel(STsdb *pTsdb, tb_uid_t suid, tb_uid_t uid, TSKEY sKey, TSKE
 
   (void)tsdbCacheCommit(pTsdb);
 
-  taosThreadMutexLock(&pTsdb->lruMutex);
+  TdThreadMutex *pLock = tsdbCacheLock(pTsdb, uid);
+  taosThreadMutexLock(pLock);
 
-  taosThreadMutexLock(&pTsdb->rCache.rMutex);
-  // rocksMayWrite(pTsdb, true, false, false);
-  rocksdb_multi_get(pTsdb->rCache.db, pTsdb->rCache.readoptions, num_keys * 2, (const char *const *)keys_list,
-                    keys_list_sizes, values_list, values_list_sizes, errs);
-  taosThreadMutexUnlock(&pTsdb->rCache.rMutex);
+  rocksMultiGet(pTsdb, num_keys * 2, (const char *const *)keys_list, keys_list_sizes, values_list, values_list_sizes,
+                errs);
 
   for (int i = 0; i < num_keys * 2; ++i) {
     if (errs[i]) {
@@ -1153,16 +1374,15 @@ int32_t tsdbCacheDel(STsdb *pTsdb, tb_uid_t suid, tb_uid_t uid, TSKEY sKey, TSKE
   }
   taosMemoryFree(errs);
 
-  rocksdb_writebatch_t *wb = pTsdb->rCache.writebatch;
   for (int i = 0; i < num_keys; ++i) {
     SLastCol *pLastCol = tsdbCacheDeserialize(values_list[i]);
     taosThreadMutexLock(&pTsdb->rCache.rMutex);
     if (NULL != pLastCol && (pLastCol->ts <= eKey && pLastCol->ts >= sKey)) {
-      rocksdb_writebatch_delete(wb, keys_list[i], klen);
+      rocksDelete(pTsdb, keys_list[i], klen);
     }
     pLastCol = tsdbCacheDeserialize(values_list[i + num_keys]);
     if (NULL != pLastCol && (pLastCol->ts <= eKey && pLastCol->ts >= sKey)) {
-      rocksdb_writebatch_delete(wb, keys_list[num_keys + i], klen);
+      rocksDelete(pTsdb, keys_list[num_keys + i], klen);
     }
     taosThreadMutexUnlock(&pTsdb->rCache.rMutex);
 
@@ -1182,7 +1402,9 @@ int32_t tsdbCacheDel(STsdb *pTsdb, tb_uid_t suid, tb_uid_t uid, TSKEY sKey, TSKE
       taosLRUCacheRelease(pTsdb->lruCache, h, erase);
     }
     if (erase) {
+      tsdbCacheErasing = true;
       taosLRUCacheErase(pTsdb->lruCache, keys_list[i], klen);
+      tsdbCacheErasing = false;
     }
 
     erase = false;
@@ -1196,7 +1418,9 @@ int32_t tsdbCacheDel(STsdb *pTsdb, tb_uid_t suid, tb_uid_t uid, TSKEY sKey, TSKE
       taosLRUCacheRelease(pTsdb->lruCache, h, erase);
     }
     if (erase) {
+      tsdbCacheErasing = true;
       taosLRUCacheErase(pTsdb->lruCache, keys_list[num_keys + i], klen);
+      tsdbCacheErasing = false;
     }
     // taosThreadMutexUnlock(&pTsdb->lruMutex);
   }
@@ -1208,9 +1432,9 @@ int32_t tsdbCacheDel(STsdb *pTsdb, tb_uid_t suid, tb_uid_t uid, TSKEY sKey, TSKE
   taosMemoryFree(values_list);
   taosMemoryFree(values_list_sizes);
 
-  rocksMayWrite(pTsdb, true, false, true);
+  rocksMayWrite(pTsdb, true, true);
 
-  taosThreadMutexUnlock(&pTsdb->lruMutex);
+  taosThreadMutexUnlock(pLock);
 
 _exit:
   taosMemoryFree(pTSchema);
@@ -1223,7 +1447,8 @@ int32_t tsdbOpenCache(STsdb *pTsdb) {
   SLRUCache *pCache = NULL;
   size_t     cfgCapacity = pTsdb->pVnode->config.cacheLastSize * 1024 * 1024;
 
-  pCache = taosLRUCacheInit(cfgCapacity, 0, .5);
+  // shard the lru by capacity, so that lookups of different tables rarely meet on one shard lock
+  pCache = taosLRUCacheInit(cfgCapacity, -1, .5);
   if (pCache == NULL) {
     code = TSDB_CODE_OUT_OF_MEMORY;
     goto _err;
@@ -1255,7 +1480,10 @@ int32_t tsdbOpenCache(STsdb *pTsdb) {
 
   taosLRUCacheSetStrictCapacity(pCache, false);
 
-  taosThreadMutexInit(&pTsdb->lruMutex, NULL);
+  for (int32_t i = 0; i < TSDB_CACHE_LOCK_STRIPES; ++i) {
+    taosThreadMutexInit(&pTsdb->lruMutex[i], NULL);
+  }
+  memset(&pTsdb->lastStat, 0, sizeof(pTsdb->lastStat));
 
   pTsdb->flushState.pTsdb = pTsdb;
   pTsdb->flushState.flush_count = 0;
@@ -1268,11 +1496,15 @@ _err:
 void tsdbCloseCache(STsdb *pTsdb) {
   SLRUCache *pCache = pTsdb->lruCache;
   if (pCache) {
+    tsdbCacheErasing = true;
     taosLRUCacheEraseUnrefEntries(pCache);
 
     taosLRUCacheCleanup(pCache);
+    tsdbCacheErasing = false;
 
-    taosThreadMutexDestroy(&pTsdb->lruMutex);
+    for (int32_t i = 0; i < TSDB_CACHE_LOCK_STRIPES; ++i) {
+      taosThreadMutexDestroy(&pTsdb->lruMutex[i]);
+    }
   }
 
   tsdbCloseBICache(pTsdb);
@@ -3023,6 +3255,15 @@ int32_t tsdbCacheGetElems(SVnode *pVnode) {
   return elems;
 }
 
+void tsdbCacheGetStat(SVnode *pVnode, int64_t *pHit, int64_t *pMiss, int64_t *pEvict) {
+  *pHit = *pMiss = *pEvict = 0;
+  if (pVnode->pTsdb != NULL) {
+    *pHit = atomic_load_64(&pVnode->pTsdb->lastStat.nHit);
+    *pMiss = atomic_load_64(&pVnode->pTsdb->lastStat.nMiss);
+    *pEvict = atomic_load_64(&pVnode->pTsdb->lastStat.nEvict);
+  }
+}
+
 static void getBICacheKey(int32_t fid, int64_t commitID, char *key, int *len) {
   struct {
     int32_t fid;
@@ -14,6 +14,7 @@
  */
 
 #include "tsdbCommit2.h"
+#include "vnd.h"
 
 // extern dependencies
 typedef struct {
@@ -36,8 +37,6 @@ typedef struct {
   struct {
     int64_t    cid;
     int64_t    now;
-    TSKEY      nextKey;
-    TSKEY      maxDelKey;
     int32_t    fid;
     int32_t    expLevel;
     SDiskID    did;
@@ -47,6 +46,9 @@ typedef struct {
     TABLEID    tbid[1];
     bool       hasTSData;
     bool       skipTsRow;
+    int64_t    numOfRow;
+    int64_t    numOfTomb;
+    int64_t    elapsed;  // us
   } ctx[1];
 
   // reader
@@ -60,6 +62,9 @@ typedef struct {
 
   // writer
   SFSetWriter *writer;
+
+  // file sets to commit, in fid order
+  TARRAY2(int32_t) fidArr[1];
 } SCommitter2;
 
 static int32_t tsdbCommitOpenWriter(SCommitter2 *committer) {
@@ -110,7 +115,6 @@ static int32_t tsdbCommitCloseWriter(SCommitter2 *committer) {
 static int32_t tsdbCommitTSData(SCommitter2 *committer) {
   int32_t   code = 0;
   int32_t   lino = 0;
-  int64_t   numOfRow = 0;
   SMetaInfo info;
 
   committer->ctx->hasTSData = false;
@@ -144,14 +148,13 @@ static int32_t tsdbCommitTSData(SCommitter2 *committer) {
     }
 
     if (ts > committer->ctx->maxKey) {
-      committer->ctx->nextKey = TMIN(committer->ctx->nextKey, ts);
       code = tsdbIterMergerSkipTableData(committer->dataIterMerger, committer->ctx->tbid);
       TSDB_CHECK_CODE(code, lino, _exit);
       continue;
     }
 
     committer->ctx->hasTSData = true;
-    numOfRow++;
+    committer->ctx->numOfRow++;
 
     code = tsdbFSetWriteRow(committer->writer, row);
     TSDB_CHECK_CODE(code, lino, _exit);
@@ -164,7 +167,8 @@ _exit:
   if (code) {
     TSDB_ERROR_LOG(TD_VID(committer->tsdb->pVnode), lino, code);
   } else {
-    tsdbDebug("vgId:%d fid:%d commit %" PRId64 " rows", TD_VID(committer->tsdb->pVnode), committer->ctx->fid, numOfRow);
+    tsdbDebug("vgId:%d fid:%d commit %" PRId64 " rows", TD_VID(committer->tsdb->pVnode), committer->ctx->fid,
+              committer->ctx->numOfRow);
   }
   return code;
 }
@@ -172,15 +176,9 @@ _exit:
 static int32_t tsdbCommitTombData(SCommitter2 *committer) {
   int32_t   code = 0;
   int32_t   lino = 0;
-  int64_t   numRecord = 0;
   SMetaInfo info;
 
   if (committer->ctx->fset == NULL && !committer->ctx->hasTSData) {
-    if (committer->ctx->maxKey < committer->ctx->maxDelKey) {
-      committer->ctx->nextKey = committer->ctx->maxKey + 1;
-    } else {
-      committer->ctx->nextKey = TSKEY_MAX;
-    }
     return 0;
   }
 
@@ -198,19 +196,11 @@ static int32_t tsdbCommitTombData(SCommitter2 *committer) {
       }
     }
 
-    if (record->ekey < committer->ctx->minKey) {
-      // do nothing
-    } else if (record->skey > committer->ctx->maxKey) {
-      committer->ctx->nextKey = TMIN(record->skey, committer->ctx->nextKey);
-    } else {
-      if (record->ekey > committer->ctx->maxKey) {
-        committer->ctx->nextKey = TMIN(committer->ctx->nextKey, committer->ctx->maxKey + 1);
-      }
-
+    if (record->ekey >= committer->ctx->minKey && record->skey <= committer->ctx->maxKey) {
       record->skey = TMAX(record->skey, committer->ctx->minKey);
       record->ekey = TMIN(record->ekey, committer->ctx->maxKey);
 
-      numRecord++;
+      committer->ctx->numOfTomb++;
       code = tsdbFSetWriteTombRecord(committer->writer, record);
       TSDB_CHECK_CODE(code, lino, _exit);
     }
@@ -224,7 +214,7 @@ _exit:
     TSDB_ERROR_LOG(TD_VID(committer->tsdb->pVnode), lino, code);
   } else {
     tsdbDebug("vgId:%d fid:%d commit %" PRId64 " tomb records", TD_VID(committer->tsdb->pVnode), committer->ctx->fid,
-              numRecord);
+              committer->ctx->numOfTomb);
   }
   return code;
 }
@@ -368,12 +358,9 @@ static int32_t tsdbCommitFileSetBegin(SCommitter2 *committer) {
   int32_t lino = 0;
   STsdb  *tsdb = committer->tsdb;
 
-  int32_t fid = tsdbKeyFid(committer->ctx->nextKey, committer->minutes, committer->precision);
-
   // check if can commit
-  tsdbFSCheckCommit(tsdb, fid);
+  tsdbFSCheckCommit(tsdb, committer->ctx->fid);
 
-  committer->ctx->fid = fid;
   committer->ctx->expLevel = tsdbFidLevel(committer->ctx->fid, &tsdb->keepCfg, committer->ctx->now);
   tsdbFidKeyRange(committer->ctx->fid, committer->minutes, committer->precision, &committer->ctx->minKey,
                   &committer->ctx->maxKey);
@@ -400,9 +387,6 @@ static int32_t tsdbCommitFileSetBegin(SCommitter2 *committer) {
   code = tsdbCommitOpenWriter(committer);
   TSDB_CHECK_CODE(code, lino, _exit);
 
-  // reset nextKey
-  committer->ctx->nextKey = TSKEY_MAX;
-
   committer->ctx->skipTsRow = false;
 
   extern int8_t  tsS3Enabled;
@@ -481,6 +465,9 @@ static int32_t tsdbCommitFileSet(SCommitter2 *committer) {
 
 _exit:
   if (code) {
+    tsdbFSetWriterClose(&committer->writer, true, committer->fopArray);
+    tsdbCommitCloseIter(committer);
+    tsdbCommitCloseReader(committer);
     TSDB_ERROR_LOG(TD_VID(committer->tsdb->pVnode), lino, code);
   } else {
     tsdbDebug("vgId:%d %s done, fid:%d", TD_VID(committer->tsdb->pVnode), __func__, committer->ctx->fid);
@@ -488,6 +475,223 @@ _exit:
   return code;
 }
 
+static int32_t tsdbFidCmprFn(const int32_t *fid1, const int32_t *fid2) {
+  if (*fid1 < *fid2) {
+    return -1;
+  } else if (*fid1 > *fid2) {
+    return 1;
+  }
+  return 0;
+}
+
+static int32_t tsdbCommitAddFid(SCommitter2 *committer, int32_t fid) {
+  if (TARRAY2_SEARCH(committer->fidArr, &fid, tsdbFidCmprFn, TD_EQ) != NULL) {
+    return 0;
+  }
+  return TARRAY2_SORT_INSERT(committer->fidArr, fid, tsdbFidCmprFn);
+}
+
+/*
+ * Collect the file sets touched by the memtable before writing any of them, so that they can be committed
+ * independently: the ones holding rows, found by seeking each table to the start of the next file set, and the
+ * existing ones hit by a delete. A delete on a file set which does not exist and gets no rows has nothing to apply to.
+ */
+static int32_t tsdbCommitPlanFSet(SCommitter2 *committer) {
+  int32_t    code = 0;
+  int32_t    lino = 0;
+  SMemTable *imem = committer->tsdb->imem;
+  TSKEY      minKey;
+  TSKEY      maxKey;
+
+  SRBTreeIter iter[1] = {tRBTreeIterCreate(imem->tbDataTree, 1)};
+  for (SRBTreeNode *node = tRBTreeIterNext(iter); node; node = tRBTreeIterNext(iter)) {
+    STbData *tbData = TCONTAINER_OF(node, STbData, rbtn);
+
+    for (TSKEY key = tbData->minKey; key <= tbData->maxKey;) {
+      int32_t fid = tsdbKeyFid(key, committer->minutes, committer->precision);
+
+      code = tsdbCommitAddFid(committer, fid);
+      TSDB_CHECK_CODE(code, lino, _exit);
+
+      tsdbFidKeyRange(fid, committer->minutes, committer->precision, &minKey, &maxKey);
+      if (maxKey >= tbData->maxKey) break;
+
+      STbDataIter tbIter[1];
+      TSDBKEY     from = {.version = VERSION_MIN, .ts = maxKey + 1};
+      tsdbTbDataIterOpen(tbData, &from, 0, tbIter);
+
+      TSDBROW *row = tsdbTbDataIterGet(tbIter);
+      if (row == NULL) break;
+      key = TSDBROW_TS(row);
+    }
+
+    for (SDelData *delData = tbData->pHead; delData; delData = delData->pNext) {
+      STFileSet *fset;
+      TARRAY2_FOREACH(committer->fsetArr, fset) {
+        tsdbFidKeyRange(fset->fid, committer->minutes, committer->precision, &minKey, &maxKey);
+        if (delData->sKey <= maxKey && delData->eKey >= minKey) {
+          code = tsdbCommitAddFid(committer, fset->fid);
+          TSDB_CHECK_CODE(code, lino, _exit);
+        }
+      }
+    }
+  }
+
+_exit:
+  if (code) {
+    TSDB_ERROR_LOG(TD_VID(committer->tsdb->pVnode), lino, code);
+  } else {
+    tsdbDebug("vgId:%d %s done, fsets:%d", TD_VID(committer->tsdb->pVnode), __func__,
+              (int32_t)TARRAY2_SIZE(committer->fidArr));
+  }
+  return code;
+}
+
+static void tsdbCommitterInitFSet(SCommitter2 *committer, int32_t fid, SCommitter2 *fsetCommitter) {
+  memset(fsetCommitter, 0, sizeof(fsetCommitter[0]));
+
+  fsetCommitter->tsdb = committer->tsdb;
+  fsetCommitter->fsetArr = committer->fsetArr;
+  fsetCommitter->minutes = committer->minutes;
+  fsetCommitter->precision = committer->precision;
+  fsetCommitter->minRow = committer->minRow;
+  fsetCommitter->maxRow = committer->maxRow;
+  fsetCommitter->cmprAlg = committer->cmprAlg;
+  fsetCommitter->sttTrigger = committer->sttTrigger;
+  fsetCommitter->szPage = committer->szPage;
+  fsetCommitter->compactVersion = committer->compactVersion;
+  fsetCommitter->ctx->cid = committer->ctx->cid;
+  fsetCommitter->ctx->now = committer->ctx->now;
+  fsetCommitter->ctx->fid = fid;
+}
+
+static void tsdbCommitterDestroyFSet(SCommitter2 *fsetCommitter) {
+  TARRAY2_DESTROY(fsetCommitter->dataIterArray, NULL);
+  TARRAY2_DESTROY(fsetCommitter->tombIterArray, NULL);
+  TARRAY2_DESTROY(fsetCommitter->sttReaderArray, NULL);
+  TARRAY2_DESTROY(fsetCommitter->fopArray, NULL);
+}
+
+static int32_t tsdbCommitFSetQueueDo(void *arg) {
+  SCommitFSetQueue *queue = (SCommitFSetQueue *)arg;
+
+  while (atomic_load_32(&queue->code) == 0) {
+    int32_t idx = atomic_fetch_add_32(&queue->nextFSet, 1);
+    if (idx >= queue->numOfFSet) break;
+
+    int32_t code = queue->commitFn(queue->arg, idx);
+    if (code) {
+      atomic_val_compare_exchange_32(&queue->code, 0, code);
+    }
+  }
+  return 0;
+}
+
+int32_t tsdbCommitFSetQueueRun(SCommitFSetQueue *queue, int32_t numOfWorker) {
+  int64_t *taskIds = NULL;
+
+  numOfWorker = TMIN(numOfWorker, queue->numOfFSet);
+  if (numOfWorker > 1 && vnodeAsyncHandle[0] != NULL) {
+    taskIds = (int64_t *)taosMemoryCalloc(numOfWorker, sizeof(int64_t));
+    for (int32_t i = 1; taskIds && i < numOfWorker; i++) {
+      if (vnodeAsync(vnodeAsyncHandle[0], EVA_PRIORITY_HIGH, tsdbCommitFSetQueueDo, NULL, queue, &taskIds[i]) != 0) {
+        taskIds[i] = 0;
+      }
+    }
+  }
+
+  // The calling thread drains the queue too, then takes back the helpers which have not started. They wait on the
+  // same pool as the commits of other vnodes, so waiting for them could deadlock when every worker is committing.
+  tsdbCommitFSetQueueDo(queue);
+  for (int32_t i = 1; taskIds && i < numOfWorker; i++) {
+    if (VNODE_ASYNC_VALID_TASK_ID(taskIds[i]) && vnodeACancel(vnodeAsyncHandle[0], taskIds[i]) != 0) {
+      vnodeAWait(vnodeAsyncHandle[0], taskIds[i]);
+    }
+  }
+
+  taosMemoryFree(taskIds);
+  return queue->code;
+}
+
+int32_t tsdbCommitMergeFopArray(TFileOpArray *fopArray, const TFileOpArray *fsetFopArray) {
+  if (TARRAY2_SIZE(fsetFopArray) == 0) {
+    return 0;
+  }
+
+  if (TARRAY2_SIZE(fopArray) > 0 && TARRAY2_LAST(fopArray).fid > TARRAY2_FIRST(fsetFopArray).fid) {
+    return TSDB_CODE_INVALID_PARA;
+  }
+
+  return TARRAY2_APPEND_BATCH(fopArray, TARRAY2_DATA(fsetFopArray), TARRAY2_SIZE(fsetFopArray));
+}
+
+static int32_t tsdbCommitFSetDo(void *arg, int32_t idx) {
+  SCommitter2 *committer = &((SCommitter2 *)arg)[idx];
+  int64_t      st = taosGetTimestampUs();
+  int32_t      code = tsdbCommitFileSet(committer);
+
+  committer->ctx->elapsed = taosGetTimestampUs() - st;
+  return code;
+}
+
+/*
+ * Commit the planned file sets, up to numOfCommitFsetWorkers of them at a time on the vnode-commit pool. Each one is
+ * written by its own committer into its own file op array, and the arrays are merged in fid order at the end, so the
+ * FS edit still covers the whole commit and is applied at once.
+ */
+static int32_t tsdbCommitFSets(SCommitter2 *committer) {
+  int32_t          code = 0;
+  int32_t          lino = 0;
+  int32_t          numOfFSet = TARRAY2_SIZE(committer->fidArr);
+  int32_t          numOfWorker = TMIN(tsNumOfCommitFsetWorkers, numOfFSet);
+  int64_t          maxElapsed = 0;
+  SCommitter2     *committers = NULL;  // one per file set, in fid order
+  SCommitFSetQueue queue = {.numOfFSet = numOfFSet, .commitFn = tsdbCommitFSetDo};
+
+  if (numOfFSet == 0) goto _exit;
+
+  committers = (SCommitter2 *)taosMemoryCalloc(numOfFSet, sizeof(SCommitter2));
+  if (committers == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+  for (int32_t i = 0; i < numOfFSet; i++) {
+    tsdbCommitterInitFSet(committer, TARRAY2_GET(committer->fidArr, i), &committers[i]);
+  }
+
+  queue.arg = committers;
+  code = tsdbCommitFSetQueueRun(&queue, numOfWorker);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  for (int32_t i = 0; i < numOfFSet; i++) {
+    SCommitter2 *fsetCommitter = &committers[i];
+
+    code = tsdbCommitMergeFopArray(committer->fopArray, fsetCommitter->fopArray);
+    TSDB_CHECK_CODE(code, lino, _exit);
+
+    maxElapsed = TMAX(maxElapsed, fsetCommitter->ctx->elapsed);
+    tsdbInfo("vgId:%d fid:%d commit done, rows:%" PRId64 " tomb records:%" PRId64 " elapsed:%" PRId64 "us",
+             TD_VID(committer->tsdb->pVnode), fsetCommitter->ctx->fid, fsetCommitter->ctx->numOfRow,
+             fsetCommitter->ctx->numOfTomb, fsetCommitter->ctx->elapsed);
+  }
+
+_exit:
+  if (committers) {
+    for (int32_t i = 0; i < numOfFSet; i++) {
+      tsdbCommitterDestroyFSet(&committers[i]);
+    }
+    taosMemoryFree(committers);
+  }
+  if (code) {
+    TSDB_ERROR_LOG(TD_VID(committer->tsdb->pVnode), lino, code);
+  } else {
+    tsdbDebug("vgId:%d %s done, fsets:%d workers:%d max elapsed:%" PRId64 "us", TD_VID(committer->tsdb->pVnode),
+              __func__, numOfFSet, numOfWorker, maxElapsed);
+  }
+  return code;
+}
+
 static int32_t tsdbOpenCommitter(STsdb *tsdb, SCommitInfo *info, SCommitter2 *committer) {
   int32_t code = 0;
   int32_t lino = 0;
@@ -508,35 +712,8 @@ static int32_t tsdbOpenCommitter(STsdb *tsdb, SCommitInfo *info, SCommitter2 *co
   committer->ctx->cid = tsdbFSAllocEid(tsdb->pFS);
   committer->ctx->now = taosGetTimestampSec();
 
-  committer->ctx->nextKey = tsdb->imem->minKey;
-  if (tsdb->imem->nDel > 0) {
-    SRBTreeIter iter[1] = {tRBTreeIterCreate(tsdb->imem->tbDataTree, 1)};
-
-    for (SRBTreeNode *node = tRBTreeIterNext(iter); node; node = tRBTreeIterNext(iter)) {
-      STbData *tbData = TCONTAINER_OF(node, STbData, rbtn);
-
-      for (SDelData *delData = tbData->pHead; delData; delData = delData->pNext) {
-        if (delData->sKey < committer->ctx->nextKey) {
-          committer->ctx->nextKey = delData->sKey;
-        }
-      }
-    }
-  }
-
-  committer->ctx->maxDelKey = TSKEY_MIN;
-  TSKEY minKey = TSKEY_MAX;
-  TSKEY maxKey = TSKEY_MIN;
-  if (TARRAY2_SIZE(committer->fsetArr) > 0) {
-    STFileSet *fset = TARRAY2_LAST(committer->fsetArr);
-    tsdbFidKeyRange(fset->fid, committer->minutes, committer->precision, &minKey, &committer->ctx->maxDelKey);
-
-    fset = TARRAY2_FIRST(committer->fsetArr);
-    tsdbFidKeyRange(fset->fid, committer->minutes, committer->precision, &minKey, &maxKey);
-  }
-
-  if (committer->ctx->nextKey < TMIN(tsdb->imem->minKey, minKey)) {
-    committer->ctx->nextKey = TMIN(tsdb->imem->minKey, minKey);
-  }
+  code = tsdbCommitPlanFSet(committer);
+  TSDB_CHECK_CODE(code, lino, _exit);
 
 _exit:
   if (code) {
@@ -567,6 +744,7 @@ static int32_t tsdbCloseCommitter(SCommitter2 *committer, int32_t eno) {
   TARRAY2_DESTROY(committer->sttReaderArray, NULL);
   TARRAY2_DESTROY(committer->fopArray, NULL);
   TARRAY2_DESTROY(committer->sttReaderArray, NULL);
+  TARRAY2_DESTROY(committer->fidArr, NULL);
   tsdbFSDestroyCopySnapshot(&committer->fsetArr);
 
 _exit:
@@ -609,10 +787,8 @@ int32_t tsdbCommitBegin(STsdb *tsdb, SCommitInfo *info) {
     code = tsdbOpenCommitter(tsdb, info, committer);
     TSDB_CHECK_CODE(code, lino, _exit);
 
-    while (committer->ctx->nextKey != TSKEY_MAX) {
-      code = tsdbCommitFileSet(committer);
-      TSDB_CHECK_CODE(code, lino, _exit);
-    }
+    code = tsdbCommitFSets(committer);
+    TSDB_CHECK_CODE(code, lino, _exit);
 
     code = tsdbCloseCommitter(committer, code);
     TSDB_CHECK_CODE(code, lino, _exit);
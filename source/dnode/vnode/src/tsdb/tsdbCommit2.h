@@ -26,6 +26,23 @@
 extern "C" {
 #endif
 
+typedef int32_t (*tsdbCommitFSetFn)(void *arg, int32_t idx);  // commit the idx-th file set of a commit
+
+// the file sets of one commit, pulled by the workers committing them
+typedef struct {
+  int32_t          numOfFSet;
+  tsdbCommitFSetFn commitFn;
+  void            *arg;
+  volatile int32_t nextFSet;
+  volatile int32_t code;  // the first failure, no more file sets are started once it is set
+} SCommitFSetQueue;
+
+// commit the file sets in the queue with up to numOfWorker workers, the calling thread included, and return the first
+// failure; the helpers on the vnode-commit pool are done or cancelled when it returns
+int32_t tsdbCommitFSetQueueRun(SCommitFSetQueue *queue, int32_t numOfWorker);
+// append the file ops of a file set, which must not precede the file sets merged before
+int32_t tsdbCommitMergeFopArray(TFileOpArray *fopArray, const TFileOpArray *fsetFopArray);
+
 #ifdef __cplusplus
 }
 #endif
@@ -395,11 +395,14 @@ _exit:
 }
 
 int32_t tsdbDataFileReadBlockSma(SDataFileReader *reader, const SBrinRecord *record,
-                                 TColumnDataAggArray *columnDataAggArray) {
+                                 TColumnDataAggArray *columnDataAggArray, TColumnDataIdxArray *columnDataIdxArray) {
   int32_t code = 0;
   int32_t lino = 0;
 
   TARRAY2_CLEAR(columnDataAggArray, NULL);
+  if (columnDataIdxArray) {
+    TARRAY2_CLEAR(columnDataIdxArray, tColumnDataIdxClear);
+  }
   if (record->smaSize > 0) {
     code = tRealloc(&reader->config->bufArr[0], record->smaSize);
     TSDB_CHECK_CODE(code, lino, _exit);
@@ -410,14 +413,51 @@ int32_t tsdbDataFileReadBlockSma(SDataFileReader *reader, const SBrinRecord *rec
     // decode sma data
     int32_t size = 0;
     while (size < record->smaSize) {
-      SColumnDataAgg sma[1];
+      SColumnDataAgg sma[1] = {0};
 
       size += tGetColumnDataAgg(reader->config->bufArr[0] + size, sma);
 
+      if (sma->colId == TSDB_SMA_IDX_MARK) {
+        if (columnDataIdxArray == NULL) {
+          size = record->smaSize;
+          break;
+        }
+
+        for (int32_t i = 0; i < sma->numOfNull; i++) {
+          SColumnDataIdx idx[1];
+
+          size += tGetColumnDataIdx(reader->config->bufArr[0] + size, idx);
+
+          code = TARRAY2_APPEND_PTR(columnDataIdxArray, idx);
+          if (code) {
+            tColumnDataIdxClear(idx);
+            TSDB_CHECK_CODE(code, lino, _exit);
+          }
+        }
+        continue;
+      }
+
       code = TARRAY2_APPEND_PTR(columnDataAggArray, sma);
       TSDB_CHECK_CODE(code, lino, _exit);
     }
     ASSERT(size == record->smaSize);
+
+    // both arrays are ordered by colId
+    if (columnDataIdxArray) {
+      for (int32_t i = 0, j = 0; i < TARRAY2_SIZE(columnDataAggArray) && j < TARRAY2_SIZE(columnDataIdxArray);) {
+        SColumnDataAgg *sma = TARRAY2_GET_PTR(columnDataAggArray, i);
+        SColumnDataIdx *idx = TARRAY2_GET_PTR(columnDataIdxArray, j);
+        if (sma->colId == idx->colId) {
+          sma->pIdx = idx;
+          i++;
+          j++;
+        } else if (sma->colId < idx->colId) {
+          i++;
+        } else {
+          j++;
+        }
+      }
+    }
   }
 
 _exit:
@@ -816,6 +856,26 @@ _exit:
   return code;
 }
 
+static bool tsdbDataFileColBloomOn(SDataFileWriter *writer, int16_t cid) {
+  STSchema *pTSchema = writer->config->skmTb->pTSchema;
+  if (pTSchema == NULL) return false;
+
+  int32_t lidx = 0;
+  int32_t ridx = pTSchema->numOfCols - 1;
+  while (lidx <= ridx) {
+    int32_t   midx = (lidx + ridx) >> 1;
+    STColumn *pTColumn = &pTSchema->columns[midx];
+    if (pTColumn->colId == cid) {
+      return (pTColumn->flags & COL_BLOOM_ON) != 0;
+    } else if (pTColumn->colId < cid) {
+      lidx = midx + 1;
+    } else {
+      ridx = midx - 1;
+    }
+  }
+  return false;
+}
+
 static int32_t tsdbDataFileDoWriteBlockData(SDataFileWriter *writer, SBlockData *bData) {
   if (bData->nRow == 0) return 0;
 
@@ -875,9 +935,11 @@ static int32_t tsdbDataFileDoWriteBlockData(SDataFileWriter *writer, SBlockData
   }
 
   // to .sma file
+  int32_t nIdx = 0;
   for (int32_t i = 0; i < bData->nColData; ++i) {
     SColData *colData = bData->aColData + i;
-    if ((!colData->smaOn) || ((colData->flag & HAS_VALUE) == 0)) continue;
+    bool      bloomOn = tsdbDataFileColBloomOn(writer, colData->cid);
+    if ((!colData->smaOn && !bloomOn) || ((colData->flag & HAS_VALUE) == 0)) continue;
 
     SColumnDataAgg sma[1] = {{.colId = colData->cid}};
     tColDataCalcSMA[colData->type](colData, &sma->sum, &sma->max, &sma->min, &sma->numOfNull);
@@ -889,6 +951,39 @@ static int32_t tsdbDataFileDoWriteBlockData(SDataFileWriter *writer, SBlockData
 
     tPutColumnDataAgg(writer->config->bufArr[0] + record->smaSize, sma);
     record->smaSize += size;
+    if (bloomOn) nIdx++;
+  }
+
+  // column indexes, after all the column aggs
+  if (nIdx > 0) {
+    SColumnDataAgg mark[1] = {{.colId = TSDB_SMA_IDX_MARK, .numOfNull = nIdx}};
+    int32_t        size = tPutColumnDataAgg(NULL, mark);
+
+    code = tRealloc(&writer->config->bufArr[0], record->smaSize + size);
+    TSDB_CHECK_CODE(code, lino, _exit);
+
+    tPutColumnDataAgg(writer->config->bufArr[0] + record->smaSize, mark);
+    record->smaSize += size;
+
+    for (int32_t i = 0; i < bData->nColData; ++i) {
+      SColData *colData = bData->aColData + i;
+      if (((colData->flag & HAS_VALUE) == 0) || !tsdbDataFileColBloomOn(writer, colData->cid)) continue;
+
+      SColumnDataIdx idx[1];
+      code = tColDataCalcIdx(colData, idx);
+      TSDB_CHECK_CODE(code, lino, _exit);
+
+      size = tPutColumnDataIdx(NULL, idx);
+      code = tRealloc(&writer->config->bufArr[0], record->smaSize + size);
+      if (code) {
+        tColumnDataIdxClear(idx);
+        TSDB_CHECK_CODE(code, lino, _exit);
+      }
+
+      tPutColumnDataIdx(writer->config->bufArr[0] + record->smaSize, idx);
+      record->smaSize += size;
+      tColumnDataIdxClear(idx);
+    }
   }
 
   if (record->smaSize > 0) {
@@ -28,6 +28,7 @@ extern "C" {
 typedef TARRAY2(SBlockIdx) TBlockIdxArray;
 typedef TARRAY2(SDataBlk) TDataBlkArray;
 typedef TARRAY2(SColumnDataAgg) TColumnDataAggArray;
+typedef TARRAY2(SColumnDataIdx) TColumnDataIdxArray;
 
 typedef struct {
   SFDataPtr brinBlkPtr[1];
@@ -63,7 +64,7 @@ int32_t tsdbDataFileReadBlockDataByColumn(SDataFileReader *reader, const SBrinRe
                                           STSchema *pTSchema, int16_t cids[], int32_t ncid);
 // .sma
 int32_t tsdbDataFileReadBlockSma(SDataFileReader *reader, const SBrinRecord *record,
-                                 TColumnDataAggArray *columnDataAggArray);
+                                 TColumnDataAggArray *columnDataAggArray, TColumnDataIdxArray *columnDataIdxArray);
 // .tomb
 int32_t tsdbDataFileReadTombBlk(SDataFileReader *reader, const TTombBlkArray **tombBlkArray);
 int32_t tsdbDataFileReadTombBlock(SDataFileReader *reader, const STombBlk *tombBlk, STombBlock *tData);
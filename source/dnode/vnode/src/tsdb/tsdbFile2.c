@@ -43,6 +43,7 @@ static const struct {
 };
 
 void remove_file(const char *fname, bool last_level) {
+  tsdbPageCacheRemoveFile(fname);
   int32_t code = taosRemoveFile(fname);
   if (code) {
     if (tsS3Enabled && last_level) {
@@ -14,9 +14,12 @@
  */
 
 #include "tsdb.h"
+#include "vnd.h"
 #include "util/tsimplehash.h"
 
 #define MEM_MIN_HASH 1024
+// a shard is only worth its dispatch cost if it has some tables to insert
+#define TSDB_MEM_SHARD_MIN_TABLES 8
 #define SL_MAX_LEVEL 5
 
 // sizeof(SMemSkipListNode) + sizeof(SMemSkipListNode *) * (l) * 2
@@ -32,11 +35,28 @@
 #define SL_MOVE_FROM_POS 0x2
 
 static void    tbDataMovePosTo(STbData *pTbData, SMemSkipListNode **pos, TSDBKEY *pKey, int32_t flags);
+static void    tbDataAppendMoveTo(STbData *pTbData, TSDBKEY *pKey, int8_t backward, SMemAppendBlk **ppBlk,
+                                  int32_t *iRow);
 static int32_t tsdbGetOrCreateTbData(SMemTable *pMemTable, tb_uid_t suid, tb_uid_t uid, STbData **ppTbData);
-static int32_t tsdbInsertRowDataToTable(SMemTable *pMemTable, STbData *pTbData, int64_t version,
-                                        SSubmitTbData *pSubmitTbData, int32_t *affectedRows);
-static int32_t tsdbInsertColDataToTable(SMemTable *pMemTable, STbData *pTbData, int64_t version,
-                                        SSubmitTbData *pSubmitTbData, int32_t *affectedRows);
+static int32_t tsdbInsertRowDataToTable(SMemTable *pMemTable, STbData *pTbData, SVBufPoolArena *pArena,
+                                        int64_t version, SSubmitTbData *pSubmitTbData, int32_t *affectedRows);
+static int32_t tsdbInsertColDataToTable(SMemTable *pMemTable, STbData *pTbData, SVBufPoolArena *pArena,
+                                        int64_t version, SSubmitTbData *pSubmitTbData, int32_t *affectedRows);
+
+typedef struct {
+  SMemTable     *pMemTable;
+  int64_t        version;
+  SArray        *aSubmitTbData;
+  STbData      **aTbData;  // STbData of each SSubmitTbData, created before the shards start
+  int32_t        iShard;
+  int32_t        nShard;
+  SVBufPoolArena arena;
+  int64_t        taskId;
+  int32_t        code;
+  int64_t        nRow;
+  TSKEY          minKey;
+  TSKEY          maxKey;
+} SMemWriteShard;
 
 static int32_t tTbDataCmprFn(const SRBTreeNode *n1, const SRBTreeNode *n2) {
   STbData *tbData1 = TCONTAINER_OF(n1, STbData, rbtn);
@@ -115,12 +135,31 @@ STbData *tsdbGetTbDataFromMemTable(SMemTable *pMemTable, tb_uid_t suid, tb_uid_t
   return pTbData;
 }
 
+static FORCE_INLINE void *tsdbMemMalloc(SMemTable *pMemTable, SVBufPoolArena *pArena, int32_t size) {
+  return pArena ? vnodeBufPoolArenaMalloc(pArena, size) : vnodeBufPoolMalloc(pMemTable->pTsdb->pVnode->inUse, size);
+}
+
+static FORCE_INLINE void *tsdbMemMallocAligned(SMemTable *pMemTable, SVBufPoolArena *pArena, int32_t size) {
+  return pArena ? vnodeBufPoolArenaMallocAligned(pArena, size)
+                : vnodeBufPoolMallocAligned(pMemTable->pTsdb->pVnode->inUse, size);
+}
+
+static int32_t tsdbInsertDataToTable(SMemTable *pMemTable, STbData *pTbData, SVBufPoolArena *pArena, int64_t version,
+                                     SSubmitTbData *pSubmitTbData, int32_t *affectedRows) {
+  if (pSubmitTbData->flags & SUBMIT_REQ_COLUMN_DATA_FORMAT) {
+    return tsdbInsertColDataToTable(pMemTable, pTbData, pArena, version, pSubmitTbData, affectedRows);
+  } else {
+    return tsdbInsertRowDataToTable(pMemTable, pTbData, pArena, version, pSubmitTbData, affectedRows);
+  }
+}
+
 int32_t tsdbInsertTableData(STsdb *pTsdb, int64_t version, SSubmitTbData *pSubmitTbData, int32_t *affectedRows) {
   int32_t    code = 0;
   SMemTable *pMemTable = pTsdb->mem;
   STbData   *pTbData = NULL;
   tb_uid_t   suid = pSubmitTbData->suid;
   tb_uid_t   uid = pSubmitTbData->uid;
+  int32_t    nRow = 0;
 
   // create/get STbData to op
   code = tsdbGetOrCreateTbData(pMemTable, suid, uid, &pTbData);
@@ -129,17 +168,17 @@ int32_t tsdbInsertTableData(STsdb *pTsdb, int64_t version, SSubmitTbData *pSubmi
   }
 
   // do insert impl
-  if (pSubmitTbData->flags & SUBMIT_REQ_COLUMN_DATA_FORMAT) {
-    code = tsdbInsertColDataToTable(pMemTable, pTbData, version, pSubmitTbData, affectedRows);
-  } else {
-    code = tsdbInsertRowDataToTable(pMemTable, pTbData, version, pSubmitTbData, affectedRows);
-  }
+  code = tsdbInsertDataToTable(pMemTable, pTbData, NULL, version, pSubmitTbData, &nRow);
   if (code) goto _err;
 
   // update
+  pMemTable->minKey = TMIN(pMemTable->minKey, pTbData->minKey);
+  pMemTable->maxKey = TMAX(pMemTable->maxKey, pTbData->maxKey);
+  pMemTable->nRow += nRow;
   pMemTable->minVer = TMIN(pMemTable->minVer, version);
   pMemTable->maxVer = TMAX(pMemTable->maxVer, version);
 
+  if (affectedRows) *affectedRows = nRow;
   return code;
 
 _err:
@@ -147,6 +186,130 @@ _err:
   return code;
 }
 
+static int32_t tsdbMemWriteShardDo(void *arg) {
+  SMemWriteShard *pShard = (SMemWriteShard *)arg;
+  int32_t         code = 0;
+
+  for (int32_t i = 0; i < TARRAY_SIZE(pShard->aSubmitTbData); i++) {
+    STbData *pTbData = pShard->aTbData[i];
+    if (TABS(pTbData->uid) % pShard->nShard != pShard->iShard) continue;
+
+    int32_t nRow = 0;
+    code = tsdbInsertDataToTable(pShard->pMemTable, pTbData, &pShard->arena, pShard->version,
+                                 taosArrayGet(pShard->aSubmitTbData, i), &nRow);
+    if (code) break;
+
+    pShard->nRow += nRow;
+    pShard->minKey = TMIN(pShard->minKey, pTbData->minKey);
+    pShard->maxKey = TMAX(pShard->maxKey, pTbData->maxKey);
+  }
+
+  vnodeBufPoolArenaClear(&pShard->arena);
+  pShard->code = code;
+  return code;
+}
+
+/*
+ * Insert all tables of one submit request. When numOfVnodeWriteShards > 1 and the request is large enough, the tables
+ * are partitioned by uid into shards which are applied concurrently, each one allocating from its own arena carved
+ * from the buffer pool. All rows share the same version, so the WAL order is kept no matter how shards interleave.
+ */
+int32_t tsdbInsertTableDataBatch(STsdb *pTsdb, int64_t version, SArray *aSubmitTbData, int32_t *affectedRows) {
+  int32_t         code = 0;
+  int32_t         lino = 0;
+  SMemTable      *pMemTable = pTsdb->mem;
+  int32_t         nTbData = TARRAY_SIZE(aSubmitTbData);
+  int32_t         nShard = TMIN(tsNumOfVnodeWriteShards, nTbData / TSDB_MEM_SHARD_MIN_TABLES);
+  STbData       **aTbData = NULL;
+  SMemWriteShard *aShard = NULL;
+
+  if (affectedRows) *affectedRows = 0;
+
+  if (nShard <= 1 || pTsdb->pVnode->inUse->lock == NULL) {
+    for (int32_t i = 0; i < nTbData; i++) {
+      int32_t nRow = 0;
+      code = tsdbInsertTableData(pTsdb, version, taosArrayGet(aSubmitTbData, i), &nRow);
+      TSDB_CHECK_CODE(code, lino, _exit);
+      if (affectedRows) *affectedRows += nRow;
+    }
+    goto _exit;
+  }
+
+  // create STbData up front, so the shards never touch the table hash or the buffer pool lists concurrently
+  aTbData = (STbData **)taosMemoryMalloc(sizeof(STbData *) * nTbData);
+  aShard = (SMemWriteShard *)taosMemoryCalloc(nShard, sizeof(SMemWriteShard));
+  if (aTbData == NULL || aShard == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+  for (int32_t i = 0; i < nTbData; i++) {
+    SSubmitTbData *pSubmitTbData = taosArrayGet(aSubmitTbData, i);
+    code = tsdbGetOrCreateTbData(pMemTable, pSubmitTbData->suid, pSubmitTbData->uid, &aTbData[i]);
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+  // dispatch, the calling thread takes shard 0 itself and every shard which fails to be scheduled
+  for (int32_t iShard = 0; iShard < nShard; iShard++) {
+    SMemWriteShard *pShard = &aShard[iShard];
+
+    pShard->pMemTable = pMemTable;
+    pShard->version = version;
+    pShard->aSubmitTbData = aSubmitTbData;
+    pShard->aTbData = aTbData;
+    pShard->iShard = iShard;
+    pShard->nShard = nShard;
+    pShard->minKey = TSKEY_MAX;
+    pShard->maxKey = TSKEY_MIN;
+    vnodeBufPoolArenaInit(&pShard->arena, pTsdb->pVnode->inUse);
+
+    if (iShard > 0 &&
+        vnodeAsync(vnodeAsyncHandle[3], EVA_PRIORITY_HIGH, tsdbMemWriteShardDo, NULL, pShard, &pShard->taskId) != 0) {
+      pShard->taskId = 0;
+    }
+  }
+
+  tsdbMemWriteShardDo(&aShard[0]);
+  for (int32_t iShard = 1; iShard < nShard; iShard++) {
+    if (VNODE_ASYNC_VALID_TASK_ID(aShard[iShard].taskId)) {
+      vnodeAWait(vnodeAsyncHandle[3], aShard[iShard].taskId);
+    } else {
+      tsdbMemWriteShardDo(&aShard[iShard]);
+    }
+  }
+
+  // merge
+  for (int32_t iShard = 0; iShard < nShard; iShard++) {
+    SMemWriteShard *pShard = &aShard[iShard];
+
+    if (pShard->code && code == 0) {
+      code = pShard->code;
+      lino = __LINE__;
+    }
+    pMemTable->minKey = TMIN(pMemTable->minKey, pShard->minKey);
+    pMemTable->maxKey = TMAX(pMemTable->maxKey, pShard->maxKey);
+    pMemTable->nRow += pShard->nRow;
+    if (affectedRows) *affectedRows += pShard->nRow;
+  }
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  pMemTable->minVer = TMIN(pMemTable->minVer, version);
+  pMemTable->maxVer = TMAX(pMemTable->maxVer, version);
+
+  tsdbTrace("vgId:%d %s done, version:%" PRId64 " tables:%d shards:%d", TD_VID(pTsdb->pVnode), __func__, version,
+            nTbData, nShard);
+
+_exit:
+  if (code) {
+    tsdbError("vgId:%d %s failed at line %d since %s, version:%" PRId64, TD_VID(pTsdb->pVnode), __func__, lino,
+              tstrerror(code), version);
+    terrno = code;
+  }
+  taosMemoryFree(aShard);
+  taosMemoryFree(aTbData);
+  return code;
+}
+
 int32_t tsdbDeleteTableData(STsdb *pTsdb, int64_t version, tb_uid_t suid, tb_uid_t uid, TSKEY sKey, TSKEY eKey) {
   int32_t    code = 0;
   SMemTable *pMemTable = pTsdb->mem;
@@ -266,9 +429,79 @@ void tsdbTbDataIterOpen(STbData *pTbData, TSDBKEY *pFrom, int8_t backward, STbDa
       pIter->pNode = SL_GET_NODE_FORWARD(pos[0], 0);
     }
   }
+
+  pIter->fromBlk = 0;
+  tbDataAppendMoveTo(pTbData, pFrom, backward, &pIter->pBlk, &pIter->iBlkRow);
+}
+
+TSDBROW *tsdbTbDataIterGetMerge(STbDataIter *pIter) {
+  STbData *pTbData = pIter->pTbData;
+  bool     hasNode;
+
+  pIter->fromBlk = 1;
+  pIter->row = tsdbRowFromBlockData(pIter->pBlk->pBlockData, pIter->iBlkRow);
+
+  if (pIter->backward) {
+    hasNode = (pIter->pNode != pTbData->sl.pHead);
+  } else {
+    hasNode = (pIter->pNode != pTbData->sl.pTail);
+  }
+
+  if (hasNode) {
+    TSDBROW nRow;
+    if (pIter->pNode->flag == TSDBROW_ROW_FMT) {
+      nRow = tsdbRowFromTSRow(pIter->pNode->version, pIter->pNode->pData);
+    } else {
+      nRow = tsdbRowFromBlockData(pIter->pNode->pData, pIter->pNode->iRow);
+    }
+
+    TSDBKEY bKey = TSDBROW_KEY(&pIter->row);
+    TSDBKEY nKey = TSDBROW_KEY(&nRow);
+    int32_t c = tsdbKeyCmprFn(&nKey, &bKey);
+    if (pIter->backward ? (c > 0) : (c < 0)) {
+      pIter->row = nRow;
+      pIter->fromBlk = 0;
+    }
+  }
+
+  pIter->pRow = &pIter->row;
+  return pIter->pRow;
+}
+
+static bool tbDataIterNextMerge(STbDataIter *pIter) {
+  if (tsdbTbDataIterGet(pIter) == NULL) {
+    return false;
+  }
+
+  pIter->pRow = NULL;
+  if (pIter->fromBlk) {
+    if (pIter->backward) {
+      if (--pIter->iBlkRow < 0) {
+        pIter->pBlk = pIter->pBlk->pPrev;
+        if (pIter->pBlk) pIter->iBlkRow = pIter->pBlk->pBlockData->nRow - 1;
+      }
+    } else {
+      if (++pIter->iBlkRow >= pIter->pBlk->pBlockData->nRow) {
+        pIter->pBlk = (SMemAppendBlk *)atomic_load_ptr(&pIter->pBlk->pNext);
+        pIter->iBlkRow = 0;
+      }
+    }
+  } else {
+    if (pIter->backward) {
+      pIter->pNode = SL_GET_NODE_BACKWARD(pIter->pNode, 0);
+    } else {
+      pIter->pNode = SL_GET_NODE_FORWARD(pIter->pNode, 0);
+    }
+  }
+
+  return tsdbTbDataIterGet(pIter) != NULL;
 }
 
 bool tsdbTbDataIterNext(STbDataIter *pIter) {
+  if (pIter->pBlk) {
+    return tbDataIterNextMerge(pIter);
+  }
+
   pIter->pRow = NULL;
   if (pIter->backward) {
     ASSERT(pIter->pNode != pIter->pTbData->sl.pTail);
@@ -299,7 +532,7 @@ bool tsdbTbDataIterNext(STbDataIter *pIter) {
 
 int64_t tsdbCountTbDataRows(STbData *pTbData) {
   SMemSkipListNode *pNode = pTbData->sl.pHead;
-  int64_t           rowsNum = 0;
+  int64_t           rowsNum = atomic_load_64(&pTbData->al.size);
 
   while (NULL != pNode) {
     pNode = SL_GET_NODE_FORWARD(pNode, 0);
@@ -392,6 +625,9 @@ static int32_t tsdbGetOrCreateTbData(SMemTable *pMemTable, tb_uid_t suid, tb_uid
   pTbData->sl.level = 0;
   pTbData->sl.pHead = (SMemSkipListNode *)&pTbData[1];
   pTbData->sl.pTail = (SMemSkipListNode *)POINTER_SHIFT(pTbData->sl.pHead, SL_NODE_SIZE(maxLevel));
+  pTbData->al.size = 0;
+  pTbData->al.pHead = NULL;
+  pTbData->al.pTail = NULL;
   pTbData->sl.pHead->level = maxLevel;
   pTbData->sl.pTail->level = maxLevel;
   for (int8_t iLevel = 0; iLevel < maxLevel; iLevel++) {
@@ -510,6 +746,99 @@ static void tbDataMovePosTo(STbData *pTbData, SMemSkipListNode **pos, TSDBKEY *p
   }
 }
 
+static int32_t tbDataAppendBlkSearch(SBlockData *pBlockData, TSDBKEY *pKey, int8_t backward) {
+  // all rows of an append block share the same version, and their timestamps are strictly increasing
+  int32_t lidx = 0;
+  int32_t ridx = pBlockData->nRow - 1;
+
+  if (backward) {
+    // the last row not greater than pKey
+    while (lidx < ridx) {
+      int32_t midx = (lidx + ridx + 1) >> 1;
+      TSDBKEY key = {.ts = pBlockData->aTSKEY[midx], .version = pBlockData->aVersion[midx]};
+      if (tsdbKeyCmprFn(&key, pKey) <= 0) {
+        lidx = midx;
+      } else {
+        ridx = midx - 1;
+      }
+    }
+  } else {
+    // the first row not less than pKey
+    while (lidx < ridx) {
+      int32_t midx = (lidx + ridx) >> 1;
+      TSDBKEY key = {.ts = pBlockData->aTSKEY[midx], .version = pBlockData->aVersion[midx]};
+      if (tsdbKeyCmprFn(&key, pKey) >= 0) {
+        ridx = midx;
+      } else {
+        lidx = midx + 1;
+      }
+    }
+  }
+
+  return lidx;
+}
+
+static void tbDataAppendMoveTo(STbData *pTbData, TSDBKEY *pKey, int8_t backward, SMemAppendBlk **ppBlk,
+                               int32_t *iRow) {
+  SMemAppendBlk *pBlk;
+
+  if (backward) {
+    for (pBlk = (SMemAppendBlk *)atomic_load_ptr(&pTbData->al.pTail); pBlk; pBlk = pBlk->pPrev) {
+      SBlockData *pBlockData = pBlk->pBlockData;
+      if (pKey == NULL) {
+        *iRow = pBlockData->nRow - 1;
+        break;
+      }
+
+      TSDBKEY fKey = {.ts = pBlockData->aTSKEY[0], .version = pBlockData->aVersion[0]};
+      if (tsdbKeyCmprFn(&fKey, pKey) <= 0) {
+        *iRow = tbDataAppendBlkSearch(pBlockData, pKey, backward);
+        break;
+      }
+    }
+  } else {
+    for (pBlk = (SMemAppendBlk *)atomic_load_ptr(&pTbData->al.pHead); pBlk;
+         pBlk = (SMemAppendBlk *)atomic_load_ptr(&pBlk->pNext)) {
+      SBlockData *pBlockData = pBlk->pBlockData;
+      if (pKey == NULL) {
+        *iRow = 0;
+        break;
+      }
+
+      TSDBKEY lKey = {.ts = pBlockData->aTSKEY[pBlockData->nRow - 1], .version = pBlockData->aVersion[0]};
+      if (tsdbKeyCmprFn(&lKey, pKey) >= 0) {
+        *iRow = tbDataAppendBlkSearch(pBlockData, pKey, backward);
+        break;
+      }
+    }
+  }
+
+  *ppBlk = pBlk;
+}
+
+static int32_t tbDataDoAppend(SMemTable *pMemTable, STbData *pTbData, SVBufPoolArena *pArena,
+                              SBlockData *pBlockData) {
+  SMemAppendBlk *pBlk = (SMemAppendBlk *)tsdbMemMallocAligned(pMemTable, pArena, sizeof(*pBlk));
+  if (pBlk == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  pBlk->pBlockData = pBlockData;
+  pBlk->pPrev = pTbData->al.pTail;
+  pBlk->pNext = NULL;
+
+  // publish the block only after it is fully set, readers may be walking the list
+  if (pTbData->al.pTail) {
+    atomic_store_ptr(&pTbData->al.pTail->pNext, pBlk);
+  } else {
+    atomic_store_ptr(&pTbData->al.pHead, pBlk);
+  }
+  atomic_store_ptr(&pTbData->al.pTail, pBlk);
+  atomic_add_fetch_64(&pTbData->al.size, pBlockData->nRow);
+
+  return 0;
+}
+
 static FORCE_INLINE int8_t tsdbMemSkipListRandLevel(SMemSkipList *pSl) {
   int8_t level = 1;
   int8_t tlevel = TMIN(pSl->maxLevel, pSl->level + 1);
@@ -520,21 +849,20 @@ static FORCE_INLINE int8_t tsdbMemSkipListRandLevel(SMemSkipList *pSl) {
 
   return level;
 }
-static int32_t tbDataDoPut(SMemTable *pMemTable, STbData *pTbData, SMemSkipListNode **pos, TSDBROW *pRow,
-                           int8_t forward) {
+static int32_t tbDataDoPut(SMemTable *pMemTable, STbData *pTbData, SVBufPoolArena *pArena, SMemSkipListNode **pos,
+                           TSDBROW *pRow, int8_t forward) {
   int32_t           code = 0;
   int8_t            level;
   SMemSkipListNode *pNode = NULL;
-  SVBufPool        *pPool = pMemTable->pTsdb->pVnode->inUse;
   int64_t           nSize;
 
   // create node
   level = tsdbMemSkipListRandLevel(&pTbData->sl);
   nSize = SL_NODE_SIZE(level);
   if (pRow->type == TSDBROW_ROW_FMT) {
-    pNode = (SMemSkipListNode *)vnodeBufPoolMallocAligned(pPool, nSize + pRow->pTSRow->len);
+    pNode = (SMemSkipListNode *)tsdbMemMallocAligned(pMemTable, pArena, nSize + pRow->pTSRow->len);
   } else if (pRow->type == TSDBROW_COL_FMT) {
-    pNode = (SMemSkipListNode *)vnodeBufPoolMallocAligned(pPool, nSize);
+    pNode = (SMemSkipListNode *)tsdbMemMallocAligned(pMemTable, pArena, nSize);
   } else {
     ASSERT(0);
   }
@@ -599,8 +927,8 @@ _exit:
   return code;
 }
 
-static int32_t tsdbInsertColDataToTable(SMemTable *pMemTable, STbData *pTbData, int64_t version,
-                                        SSubmitTbData *pSubmitTbData, int32_t *affectedRows) {
+static int32_t tsdbInsertColDataToTable(SMemTable *pMemTable, STbData *pTbData, SVBufPoolArena *pArena,
+                                        int64_t version, SSubmitTbData *pSubmitTbData, int32_t *affectedRows) {
   int32_t code = 0;
 
   SVBufPool *pPool = pMemTable->pTsdb->pVnode->inUse;
@@ -612,7 +940,7 @@ static int32_t tsdbInsertColDataToTable(SMemTable *pMemTable, STbData *pTbData,
   ASSERT(aColData[0].flag == HAS_VALUE);
 
   // copy and construct block data
-  SBlockData *pBlockData = vnodeBufPoolMalloc(pPool, sizeof(*pBlockData));
+  SBlockData *pBlockData = tsdbMemMalloc(pMemTable, pArena, sizeof(*pBlockData));
   if (pBlockData == NULL) {
     code = TSDB_CODE_OUT_OF_MEMORY;
     goto _exit;
@@ -622,7 +950,7 @@ static int32_t tsdbInsertColDataToTable(SMemTable *pMemTable, STbData *pTbData,
   pBlockData->uid = pTbData->uid;
   pBlockData->nRow = aColData[0].nVal;
   pBlockData->aUid = NULL;
-  pBlockData->aVersion = vnodeBufPoolMalloc(pPool, aColData[0].nData);
+  pBlockData->aVersion = tsdbMemMalloc(pMemTable, pArena, aColData[0].nData);
   if (pBlockData->aVersion == NULL) {
     code = TSDB_CODE_OUT_OF_MEMORY;
     goto _exit;
@@ -631,7 +959,7 @@ static int32_t tsdbInsertColDataToTable(SMemTable *pMemTable, STbData *pTbData,
     pBlockData->aVersion[i] = version;
   }
 
-  pBlockData->aTSKEY = vnodeBufPoolMalloc(pPool, aColData[0].nData);
+  pBlockData->aTSKEY = tsdbMemMalloc(pMemTable, pArena, aColData[0].nData);
   if (pBlockData->aTSKEY == NULL) {
     code = TSDB_CODE_OUT_OF_MEMORY;
     goto _exit;
@@ -639,26 +967,41 @@ static int32_t tsdbInsertColDataToTable(SMemTable *pMemTable, STbData *pTbData,
   memcpy(pBlockData->aTSKEY, aColData[0].pData, aColData[0].nData);
 
   pBlockData->nColData = nColData - 1;
-  pBlockData->aColData = vnodeBufPoolMalloc(pPool, sizeof(SColData) * pBlockData->nColData);
+  pBlockData->aColData = tsdbMemMalloc(pMemTable, pArena, sizeof(SColData) * pBlockData->nColData);
   if (pBlockData->aColData == NULL) {
     code = TSDB_CODE_OUT_OF_MEMORY;
     goto _exit;
   }
 
   for (int32_t iColData = 0; iColData < pBlockData->nColData; ++iColData) {
-    code = tColDataCopy(&aColData[iColData + 1], &pBlockData->aColData[iColData], (xMallocFn)vnodeBufPoolMalloc, pPool);
+    if (pArena) {
+      code = tColDataCopy(&aColData[iColData + 1], &pBlockData->aColData[iColData],
+                          (xMallocFn)vnodeBufPoolArenaMalloc, pArena);
+    } else {
+      code = tColDataCopy(&aColData[iColData + 1], &pBlockData->aColData[iColData], (xMallocFn)vnodeBufPoolMalloc,
+                          pPool);
+    }
     if (code) goto _exit;
   }
 
-  // loop to add each row to the skiplist
   SMemSkipListNode *pos[SL_MAX_LEVEL];
   TSDBROW           tRow = tsdbRowFromBlockData(pBlockData, 0);
   TSDBKEY           key = {.version = version, .ts = pBlockData->aTSKEY[0]};
   TSDBROW           lRow;  // last row
 
+  // in-order batch, keep it as it is in the append list
+  if (key.ts > pTbData->maxKey) {
+    if ((code = tbDataDoAppend(pMemTable, pTbData, pArena, pBlockData))) goto _exit;
+    pTbData->minKey = TMIN(pTbData->minKey, key.ts);
+    key.ts = pBlockData->aTSKEY[pBlockData->nRow - 1];
+    lRow = tsdbRowFromBlockData(pBlockData, pBlockData->nRow - 1);
+    goto _update;
+  }
+
+  // loop to add each row to the skiplist
   // first row
   tbDataMovePosTo(pTbData, pos, &key, SL_MOVE_BACKWARD);
-  if ((code = tbDataDoPut(pMemTable, pTbData, pos, &tRow, 0))) goto _exit;
+  if ((code = tbDataDoPut(pMemTable, pTbData, pArena, pos, &tRow, 0))) goto _exit;
   pTbData->minKey = TMIN(pTbData->minKey, key.ts);
   lRow = tRow;
 
@@ -676,13 +1019,14 @@ static int32_t tsdbInsertColDataToTable(SMemTable *pMemTable, STbData *pTbData,
         tbDataMovePosTo(pTbData, pos, &key, SL_MOVE_FROM_POS);
       }
 
-      if ((code = tbDataDoPut(pMemTable, pTbData, pos, &tRow, 1))) goto _exit;
+      if ((code = tbDataDoPut(pMemTable, pTbData, pArena, pos, &tRow, 1))) goto _exit;
       lRow = tRow;
 
       ++tRow.iRow;
     }
   }
 
+_update:
   if (key.ts >= pTbData->maxKey) {
     pTbData->maxKey = key.ts;
   }
@@ -691,19 +1035,14 @@ static int32_t tsdbInsertColDataToTable(SMemTable *pMemTable, STbData *pTbData,
     tsdbCacheUpdate(pMemTable->pTsdb, pTbData->suid, pTbData->uid, &lRow);
   }
 
-  // SMemTable
-  pMemTable->minKey = TMIN(pMemTable->minKey, pTbData->minKey);
-  pMemTable->maxKey = TMAX(pMemTable->maxKey, pTbData->maxKey);
-  pMemTable->nRow += pBlockData->nRow;
-
   if (affectedRows) *affectedRows = pBlockData->nRow;
 
 _exit:
   return code;
 }
 
-static int32_t tsdbInsertRowDataToTable(SMemTable *pMemTable, STbData *pTbData, int64_t version,
-                                        SSubmitTbData *pSubmitTbData, int32_t *affectedRows) {
+static int32_t tsdbInsertRowDataToTable(SMemTable *pMemTable, STbData *pTbData, SVBufPoolArena *pArena,
+                                        int64_t version, SSubmitTbData *pSubmitTbData, int32_t *affectedRows) {
   int32_t code = 0;
 
   int32_t           nRow = TARRAY_SIZE(pSubmitTbData->aRowP);
@@ -718,7 +1057,7 @@ static int32_t tsdbInsertRowDataToTable(SMemTable *pMemTable, STbData *pTbData,
   tRow.pTSRow = aRow[iRow++];
   key.ts = tRow.pTSRow->ts;
   tbDataMovePosTo(pTbData, pos, &key, SL_MOVE_BACKWARD);
-  code = tbDataDoPut(pMemTable, pTbData, pos, &tRow, 0);
+  code = tbDataDoPut(pMemTable, pTbData, pArena, pos, &tRow, 0);
   if (code) goto _exit;
   lRow = tRow;
 
@@ -738,7 +1077,7 @@ static int32_t tsdbInsertRowDataToTable(SMemTable *pMemTable, STbData *pTbData,
         tbDataMovePosTo(pTbData, pos, &key, SL_MOVE_FROM_POS);
       }
 
-      code = tbDataDoPut(pMemTable, pTbData, pos, &tRow, 1);
+      code = tbDataDoPut(pMemTable, pTbData, pArena, pos, &tRow, 1);
       if (code) goto _exit;
 
       lRow = tRow;
@@ -754,18 +1093,13 @@ static int32_t tsdbInsertRowDataToTable(SMemTable *pMemTable, STbData *pTbData,
     tsdbCacheUpdate(pMemTable->pTsdb, pTbData->suid, pTbData->uid, &lRow);
   }
 
-  // SMemTable
-  pMemTable->minKey = TMIN(pMemTable->minKey, pTbData->minKey);
-  pMemTable->maxKey = TMAX(pMemTable->maxKey, pTbData->maxKey);
-  pMemTable->nRow += nRow;
-
   if (affectedRows) *affectedRows = nRow;
 
 _exit:
   return code;
 }
 
-int32_t tsdbGetNRowsInTbData(STbData *pTbData) { return pTbData->sl.size; }
+int32_t tsdbGetNRowsInTbData(STbData *pTbData) { return pTbData->sl.size + atomic_load_64(&pTbData->al.size); }
 
 int32_t tsdbRefMemTable(SMemTable *pMemTable, SQueryNode *pQNode) {
   int32_t code = 0;
@@ -17,12 +17,15 @@
 
 #define TSDB_MAX_LEVEL 2  // means max level is 3
 
+#define TSDB_STT_TIER_SIZE_RATIO 2  // a tier is merged up when the bytes merged are this many times of it
+
 typedef struct {
   STsdb     *tsdb;
   int32_t    fid;
   STFileSet *fset;
 
   int32_t sttTrigger;
+  int8_t  policy;
   int32_t maxRow;
   int32_t minRow;
   int32_t szPage;
@@ -38,6 +41,12 @@ typedef struct {
     bool       toData;
     int32_t    level;
     TABLEID    tbid[1];
+    // cost
+    int64_t szNew;   // level-0 stt bytes merged
+    int64_t szRead;  // input bytes
+    int32_t nSttLeft;
+    int32_t estReadFiles;
+    double  estWriteAmp;
   } ctx[1];
 
   TFileOpArray fopArr[1];
@@ -90,146 +99,239 @@ _exit:
   return code;
 }
 
-static int32_t tsdbMergeFileSetBeginOpenReader(SMerger *merger) {
+static int32_t tsdbMergerAddSttFile(SMerger *merger, STFileObj *fobj) {
+  int32_t code = 0;
+  int32_t lino = 0;
+
+  STFileOp op = {
+      .optype = TSDB_FOP_REMOVE,
+      .fid = merger->ctx->fset->fid,
+      .of = fobj->f[0],
+  };
+  code = TARRAY2_APPEND(merger->fopArr, op);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  SSttFileReader      *reader;
+  SSttFileReaderConfig config = {
+      .tsdb = merger->tsdb,
+      .szPage = merger->szPage,
+      .file[0] = fobj->f[0],
+  };
+
+  code = tsdbSttFileReaderOpen(fobj->fname, &config, &reader);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  code = TARRAY2_APPEND(merger->sttReaderArr, reader);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  if (fobj->f->stt->level == 0) {
+    merger->ctx->szNew += fobj->f->size;
+  }
+  merger->ctx->szRead += fobj->f->size;
+
+_exit:
+  if (code) {
+    TSDB_ERROR_LOG(TD_VID(merger->tsdb->pVnode), lino, code);
+  }
+  return code;
+}
+
+static int64_t tsdbSttLvlSize(const SSttLvl *lvl) {
+  int64_t    size = 0;
+  STFileObj *fobj;
+  TARRAY2_FOREACH(lvl->fobjArr, fobj) { size += fobj->f->size; }
+  return size;
+}
+
+static int64_t tsdbMergerDataFileSize(SMerger *merger) {
+  int64_t size = 0;
+  for (int32_t ftype = TSDB_FTYPE_HEAD; ftype <= TSDB_FTYPE_SMA; ++ftype) {
+    if (merger->ctx->fset->farr[ftype]) {
+      size += merger->ctx->fset->farr[ftype]->f->size;
+    }
+  }
+  return size;
+}
+
+// Count based policy: level n holds files merged from sttTrigger^n level-0 files, and the file set is merged
+// into the data file whenever no file is left at or above the level merged to.
+static int32_t tsdbMergeFileSetBeginOpenReaderByCount(SMerger *merger) {
   int32_t  code = 0;
   int32_t  lino = 0;
   SSttLvl *lvl;
 
-  bool hasLevelLargerThanMax = false;
-  TARRAY2_FOREACH_REVERSE(merger->ctx->fset->lvlArr, lvl) {
-    if (lvl->level <= TSDB_MAX_LEVEL) {
-      break;
-    } else if (TARRAY2_SIZE(lvl->fobjArr) > 0) {
-      hasLevelLargerThanMax = true;
+  merger->ctx->toData = true;
+  merger->ctx->level = 0;
+
+  // find the highest level that can be merged to
+  for (int32_t i = 0, numCarry = 0;;) {
+    int32_t numFile = numCarry;
+    if (i < TARRAY2_SIZE(merger->ctx->fset->lvlArr) &&
+        merger->ctx->level == TARRAY2_GET(merger->ctx->fset->lvlArr, i)->level) {
+      numFile += TARRAY2_SIZE(TARRAY2_GET(merger->ctx->fset->lvlArr, i)->fobjArr);
+      i++;
+    }
+
+    numCarry = numFile / merger->sttTrigger;
+    if (numCarry == 0) {
       break;
+    } else {
+      merger->ctx->level++;
     }
   }
 
-  if (hasLevelLargerThanMax) {
-    // merge all stt files
-    merger->ctx->toData = true;
-    merger->ctx->level = TSDB_MAX_LEVEL;
-
-    TARRAY2_FOREACH(merger->ctx->fset->lvlArr, lvl) {
-      int32_t numMergeFile = TARRAY2_SIZE(lvl->fobjArr);
+  ASSERT(merger->ctx->level > 0);
 
-      for (int32_t i = 0; i < numMergeFile; ++i) {
-        STFileObj *fobj = TARRAY2_GET(lvl->fobjArr, i);
+  if (merger->ctx->level <= TSDB_MAX_LEVEL) {
+    TARRAY2_FOREACH_REVERSE(merger->ctx->fset->lvlArr, lvl) {
+      if (TARRAY2_SIZE(lvl->fobjArr) == 0) {
+        continue;
+      }
 
-        STFileOp op = {
-            .optype = TSDB_FOP_REMOVE,
-            .fid = merger->ctx->fset->fid,
-            .of = fobj->f[0],
-        };
-        code = TARRAY2_APPEND(merger->fopArr, op);
-        TSDB_CHECK_CODE(code, lino, _exit);
+      if (lvl->level >= merger->ctx->level) {
+        merger->ctx->toData = false;
+      }
+      break;
+    }
+  }
 
-        SSttFileReader      *reader;
-        SSttFileReaderConfig config = {
-            .tsdb = merger->tsdb,
-            .szPage = merger->szPage,
-            .file[0] = fobj->f[0],
-        };
+  // get number of level-0 files to merge
+  int32_t numFile = pow(merger->sttTrigger, merger->ctx->level);
+  TARRAY2_FOREACH(merger->ctx->fset->lvlArr, lvl) {
+    if (lvl->level == 0) continue;
+    if (lvl->level >= merger->ctx->level) break;
 
-        code = tsdbSttFileReaderOpen(fobj->fname, &config, &reader);
-        TSDB_CHECK_CODE(code, lino, _exit);
+    numFile = numFile - TARRAY2_SIZE(lvl->fobjArr) * pow(merger->sttTrigger, lvl->level);
+  }
 
-        code = TARRAY2_APPEND(merger->sttReaderArr, reader);
-        TSDB_CHECK_CODE(code, lino, _exit);
-      }
+  ASSERT(numFile >= 0);
+
+  // get file system operations
+  TARRAY2_FOREACH(merger->ctx->fset->lvlArr, lvl) {
+    int32_t numMergeFile;
+    if (lvl->level >= merger->ctx->level) {
+      numMergeFile = 0;
+    } else if (lvl->level == 0) {
+      numMergeFile = numFile;
+    } else {
+      numMergeFile = TARRAY2_SIZE(lvl->fobjArr);
     }
-  } else {
-    // do regular merge
-    merger->ctx->toData = true;
-    merger->ctx->level = 0;
-
-    // find the highest level that can be merged to
-    for (int32_t i = 0, numCarry = 0;;) {
-      int32_t numFile = numCarry;
-      if (i < TARRAY2_SIZE(merger->ctx->fset->lvlArr) &&
-          merger->ctx->level == TARRAY2_GET(merger->ctx->fset->lvlArr, i)->level) {
-        numFile += TARRAY2_SIZE(TARRAY2_GET(merger->ctx->fset->lvlArr, i)->fobjArr);
-        i++;
-      }
 
-      numCarry = numFile / merger->sttTrigger;
-      if (numCarry == 0) {
-        break;
-      } else {
-        merger->ctx->level++;
-      }
+    for (int32_t i = 0; i < numMergeFile; ++i) {
+      code = tsdbMergerAddSttFile(merger, TARRAY2_GET(lvl->fobjArr, i));
+      TSDB_CHECK_CODE(code, lino, _exit);
     }
+    merger->ctx->nSttLeft += TARRAY2_SIZE(lvl->fobjArr) - numMergeFile;
+  }
 
-    ASSERT(merger->ctx->level > 0);
+  if (merger->ctx->level > TSDB_MAX_LEVEL) {
+    merger->ctx->level = TSDB_MAX_LEVEL;
+  }
 
-    if (merger->ctx->level <= TSDB_MAX_LEVEL) {
-      TARRAY2_FOREACH_REVERSE(merger->ctx->fset->lvlArr, lvl) {
-        if (TARRAY2_SIZE(lvl->fobjArr) == 0) {
-          continue;
-        }
+_exit:
+  if (code) {
+    TSDB_ERROR_LOG(TD_VID(merger->tsdb->pVnode), lino, code);
+  }
+  return code;
+}
 
-        if (lvl->level >= merger->ctx->level) {
-          merger->ctx->toData = false;
-        }
-        break;
-      }
+// Size tiered policy: each level is a tier of at most sttTrigger - 1 runs. The level-0 runs are merged together
+// with every tier above them that is full or much smaller than the bytes merged so far, and the result joins the
+// first tier not merged. Merging into the data file rewrites its head and, in the worst case, every block of it,
+// so it is only done when that costs at most sttMergeMaxWriteAmp bytes per new byte, or when all tiers are full.
+static int32_t tsdbMergeFileSetBeginOpenReaderByTier(SMerger *merger) {
+  int32_t  code = 0;
+  int32_t  lino = 0;
+  SSttLvl *lvl;
+  int64_t  szMerge = 0;
+  int32_t  iLvl = 0;
+
+  merger->ctx->level = 0;
+  for (; iLvl < TARRAY2_SIZE(merger->ctx->fset->lvlArr); ++iLvl) {
+    lvl = TARRAY2_GET(merger->ctx->fset->lvlArr, iLvl);
+    if (lvl->level != merger->ctx->level) break;
+
+    int64_t size = tsdbSttLvlSize(lvl);
+    if (lvl->level > 0                                                  //
+        && TARRAY2_SIZE(lvl->fobjArr) + 1 < merger->sttTrigger          //
+        && (lvl->level == TSDB_MAX_LEVEL || size * TSDB_STT_TIER_SIZE_RATIO > szMerge)) {
+      break;
     }
 
-    // get number of level-0 files to merge
-    int32_t numFile = pow(merger->sttTrigger, merger->ctx->level);
-    TARRAY2_FOREACH(merger->ctx->fset->lvlArr, lvl) {
-      if (lvl->level == 0) continue;
-      if (lvl->level >= merger->ctx->level) break;
-
-      numFile = numFile - TARRAY2_SIZE(lvl->fobjArr) * pow(merger->sttTrigger, lvl->level);
+    for (int32_t i = 0; i < TARRAY2_SIZE(lvl->fobjArr); ++i) {
+      code = tsdbMergerAddSttFile(merger, TARRAY2_GET(lvl->fobjArr, i));
+      TSDB_CHECK_CODE(code, lino, _exit);
     }
+    szMerge += size;
+    merger->ctx->level++;
+  }
 
-    ASSERT(numFile >= 0);
+  for (int32_t i = iLvl; i < TARRAY2_SIZE(merger->ctx->fset->lvlArr); ++i) {
+    merger->ctx->nSttLeft += TARRAY2_SIZE(TARRAY2_GET(merger->ctx->fset->lvlArr, i)->fobjArr);
+  }
 
-    // get file system operations
-    TARRAY2_FOREACH(merger->ctx->fset->lvlArr, lvl) {
-      if (lvl->level >= merger->ctx->level) {
-        break;
-      }
+  if (merger->ctx->level > TSDB_MAX_LEVEL) {
+    merger->ctx->toData = true;
+  } else if (merger->ctx->nSttLeft == 0) {
+    int64_t szData = tsdbMergerDataFileSize(merger);
+    merger->ctx->toData = (szMerge + szData <= (int64_t)tsSttMergeMaxWriteAmp * TMAX(merger->ctx->szNew, 1));
+  } else {
+    merger->ctx->toData = false;
+  }
 
-      int32_t numMergeFile;
-      if (lvl->level == 0) {
-        numMergeFile = numFile;
-      } else {
-        numMergeFile = TARRAY2_SIZE(lvl->fobjArr);
-      }
+  if (merger->ctx->toData) {
+    merger->ctx->level = TSDB_MAX_LEVEL;
+  }
 
-      for (int32_t i = 0; i < numMergeFile; ++i) {
-        STFileObj *fobj = TARRAY2_GET(lvl->fobjArr, i);
+_exit:
+  if (code) {
+    TSDB_ERROR_LOG(TD_VID(merger->tsdb->pVnode), lino, code);
+  }
+  return code;
+}
 
-        STFileOp op = {
-            .optype = TSDB_FOP_REMOVE,
-            .fid = merger->ctx->fset->fid,
-            .of = fobj->f[0],
-        };
-        code = TARRAY2_APPEND(merger->fopArr, op);
-        TSDB_CHECK_CODE(code, lino, _exit);
+static int32_t tsdbMergeFileSetBeginOpenReader(SMerger *merger) {
+  int32_t  code = 0;
+  int32_t  lino = 0;
+  SSttLvl *lvl;
 
-        SSttFileReader      *reader;
-        SSttFileReaderConfig config = {
-            .tsdb = merger->tsdb,
-            .szPage = merger->szPage,
-            .file[0] = fobj->f[0],
-        };
+  bool hasLevelLargerThanMax = false;
+  TARRAY2_FOREACH_REVERSE(merger->ctx->fset->lvlArr, lvl) {
+    if (lvl->level <= TSDB_MAX_LEVEL) {
+      break;
+    } else if (TARRAY2_SIZE(lvl->fobjArr) > 0) {
+      hasLevelLargerThanMax = true;
+      break;
+    }
+  }
 
-        code = tsdbSttFileReaderOpen(fobj->fname, &config, &reader);
-        TSDB_CHECK_CODE(code, lino, _exit);
+  if (hasLevelLargerThanMax) {
+    // merge all stt files
+    merger->ctx->toData = true;
+    merger->ctx->level = TSDB_MAX_LEVEL;
 
-        code = TARRAY2_APPEND(merger->sttReaderArr, reader);
+    TARRAY2_FOREACH(merger->ctx->fset->lvlArr, lvl) {
+      for (int32_t i = 0; i < TARRAY2_SIZE(lvl->fobjArr); ++i) {
+        code = tsdbMergerAddSttFile(merger, TARRAY2_GET(lvl->fobjArr, i));
         TSDB_CHECK_CODE(code, lino, _exit);
       }
     }
+  } else if (merger->policy == TSDB_STT_MERGE_POLICY_TIERED) {
+    code = tsdbMergeFileSetBeginOpenReaderByTier(merger);
+    TSDB_CHECK_CODE(code, lino, _exit);
+  } else {
+    code = tsdbMergeFileSetBeginOpenReaderByCount(merger);
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
 
-    if (merger->ctx->level > TSDB_MAX_LEVEL) {
-      merger->ctx->level = TSDB_MAX_LEVEL;
-    }
+  if (merger->ctx->toData) {
+    merger->ctx->szRead += tsdbMergerDataFileSize(merger);
   }
 
+  // bytes rewritten per new byte, and stt files a query of the file set still reads after the merge
+  merger->ctx->estWriteAmp = (double)merger->ctx->szRead / TMAX(merger->ctx->szNew, 1);
+  merger->ctx->estReadFiles = merger->ctx->nSttLeft + (merger->ctx->toData ? 0 : 1);
+
 _exit:
   if (code) {
     TSDB_ERROR_LOG(TD_VID(merger->tsdb->pVnode), lino, code);
@@ -380,6 +482,36 @@ static int32_t tsdbMergeFileSetEndCloseReader(SMerger *merger) {
   return 0;
 }
 
+static void tsdbMergerRecordStat(SMerger *merger) {
+  int64_t         szWritten = 0;
+  const STFileOp *op;
+  TARRAY2_FOREACH_PTR(merger->fopArr, op) {
+    if (op->optype == TSDB_FOP_CREATE) {
+      szWritten += op->nf.size;
+    } else if (op->optype == TSDB_FOP_MODIFY) {
+      szWritten += op->nf.size - op->of.size;
+    }
+  }
+
+  SSttMergeStat *pStat = &merger->tsdb->mergeStat;
+  atomic_add_fetch_64(&pStat->nMerge, 1);
+  if (merger->ctx->toData) {
+    atomic_add_fetch_64(&pStat->nToData, 1);
+  }
+  atomic_add_fetch_64(&pStat->bytesNew, merger->ctx->szNew);
+  atomic_add_fetch_64(&pStat->bytesRead, merger->ctx->szRead);
+  atomic_add_fetch_64(&pStat->bytesWritten, szWritten);
+
+  tsdbInfo("vgId:%d merge fid:%d, policy:%s toData:%d level:%d, new:%" PRId64 " read:%" PRId64 " written:%" PRId64
+           " bytes, estimated write amp:%.2f read files:%d",
+           TD_VID(merger->tsdb->pVnode), merger->ctx->fset->fid,
+           merger->policy == TSDB_STT_MERGE_POLICY_TIERED ? TSDB_STT_MERGE_POLICY_TIERED_STR
+                                                          : TSDB_STT_MERGE_POLICY_COUNT_STR,
+           merger->ctx->toData,
+           merger->ctx->level, merger->ctx->szNew, merger->ctx->szRead, szWritten, merger->ctx->estWriteAmp,
+           merger->ctx->estReadFiles);
+}
+
 static int32_t tsdbMergeFileSetEnd(SMerger *merger) {
   int32_t code = 0;
   int32_t lino = 0;
@@ -405,6 +537,8 @@ static int32_t tsdbMergeFileSetEnd(SMerger *merger) {
   }
   taosThreadMutexUnlock(&merger->tsdb->mutex);
 
+  tsdbMergerRecordStat(merger);
+
 _exit:
   if (code) {
     TSDB_ERROR_LOG(TD_VID(merger->tsdb->pVnode), lino, code);
@@ -535,6 +669,7 @@ int32_t tsdbMerge(void *arg) {
       .tsdb = tsdb,
       .fid = mergeArg->fid,
       .sttTrigger = tsdb->pVnode->config.sttTrigger,
+      .policy = tsdb->pVnode->config.sttMergePolicy,
   }};
 
   if (merger->sttTrigger <= 1) return 0;
@@ -594,3 +729,16 @@ _exit:
   tsdbTFileSetClear(&merger->fset);
   return code;
 }
+
+void tsdbMergeGetStat(SVnode *pVnode, int64_t *pMerges, int64_t *pToData, int64_t *pBytesNew, int64_t *pBytesRead,
+                      int64_t *pBytesWritten) {
+  *pMerges = *pToData = *pBytesNew = *pBytesRead = *pBytesWritten = 0;
+  if (pVnode->pTsdb != NULL) {
+    SSttMergeStat *pStat = &pVnode->pTsdb->mergeStat;
+    *pMerges = atomic_load_64(&pStat->nMerge);
+    *pToData = atomic_load_64(&pStat->nToData);
+    *pBytesNew = atomic_load_64(&pStat->bytesNew);
+    *pBytesRead = atomic_load_64(&pStat->bytesRead);
+    *pBytesWritten = atomic_load_64(&pStat->bytesWritten);
+  }
+}
@@ -117,6 +117,7 @@ int tsdbClose(STsdb **pTsdb) {
 
     tsdbCloseFS(&(*pTsdb)->pFS);
     tsdbCloseCache(*pTsdb);
+    tsdbPageCacheRemoveTsdb(*pTsdb);
 #ifdef TD_ENTERPRISE
     tsdbCloseCompMonitor(*pTsdb);
 #endif
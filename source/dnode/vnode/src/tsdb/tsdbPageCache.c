@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tsdb.h"
+
+/*
+ * Dnode wide cache of checksum verified pages of tsdb files, replaced by 2Q:
+ *  - a page read the first time enters A1in, a fifo which takes at most 1/4 of the capacity under pressure
+ *  - a page evicted from A1in leaves its key in A1out, a fifo of ghost keys without data
+ *  - a page read again while it is in A1in or its key is in A1out moves to Am, a lru holding the working set
+ * so pages of a big scan which are read only once never push the working set out of Am. Pages of .head files go
+ * into Am directly as they are read by almost every query.
+ */
+
+#define TSDB_PCACHE_SHARDS 16
+
+typedef enum {
+  TSDB_PCACHE_A1IN = 0,
+  TSDB_PCACHE_AM,
+  TSDB_PCACHE_A1OUT,
+  TSDB_PCACHE_QUEUES,
+} EPageQueue;
+
+typedef struct {
+  int64_t fileId;
+  int64_t pgno;
+} SPageKey;
+
+typedef struct SPageEntry SPageEntry;
+struct SPageEntry {
+  SPageEntry *prev;
+  SPageEntry *next;
+  SPageKey    key;
+  int8_t      queue;
+  int32_t     size;  // 0 for ghost key in A1out
+  uint8_t     data[];
+};
+
+typedef struct {
+  TdThreadMutex mutex;
+  SHashObj     *pHash;  // SPageKey -> SPageEntry *
+  SPageEntry    queues[TSDB_PCACHE_QUEUES];
+  int64_t       capacity;
+  int64_t       a1inBytes;
+  int64_t       amBytes;
+  int32_t       nResident;
+  int32_t       nGhost;
+} SPageShard;
+
+typedef struct {
+  int64_t id;
+  STsdb  *pTsdb;
+} SPageFile;
+
+static struct {
+  int64_t       capacity;
+  int64_t       fileId;
+  TdThreadMutex mutex;
+  SHashObj     *pFiles;  // file path -> SPageFile
+  SPageShard    shards[TSDB_PCACHE_SHARDS];
+} tsdbPCache = {0};
+
+static FORCE_INLINE void tsdbPCacheUnlink(SPageEntry *pEntry) {
+  pEntry->prev->next = pEntry->next;
+  pEntry->next->prev = pEntry->prev;
+}
+
+static FORCE_INLINE void tsdbPCachePushHead(SPageShard *pShard, SPageEntry *pEntry, EPageQueue queue) {
+  SPageEntry *pHead = &pShard->queues[queue];
+  pEntry->queue = queue;
+  pEntry->prev = pHead;
+  pEntry->next = pHead->next;
+  pHead->next->prev = pEntry;
+  pHead->next = pEntry;
+}
+
+static FORCE_INLINE SPageEntry *tsdbPCacheTail(SPageShard *pShard, EPageQueue queue) {
+  SPageEntry *pHead = &pShard->queues[queue];
+  return pHead->prev == pHead ? NULL : pHead->prev;
+}
+
+static FORCE_INLINE SPageShard *tsdbPCacheShard(SPageKey *pKey) {
+  uint64_t h = (uint64_t)pKey->fileId * 0x9E3779B97F4A7C15ULL ^ (uint64_t)pKey->pgno;
+  return &tsdbPCache.shards[(h ^ (h >> 29)) % TSDB_PCACHE_SHARDS];
+}
+
+static void tsdbPCacheRemove(SPageShard *pShard, SPageEntry *pEntry) {
+  tsdbPCacheUnlink(pEntry);
+  taosHashRemove(pShard->pHash, &pEntry->key, sizeof(SPageKey));
+  if (pEntry->queue == TSDB_PCACHE_A1IN) {
+    pShard->a1inBytes -= pEntry->size;
+    pShard->nResident--;
+  } else if (pEntry->queue == TSDB_PCACHE_AM) {
+    pShard->amBytes -= pEntry->size;
+    pShard->nResident--;
+  } else {
+    pShard->nGhost--;
+  }
+  taosMemoryFree(pEntry);
+}
+
+static void tsdbPCacheEvict(SPageShard *pShard) {
+  while (pShard->a1inBytes + pShard->amBytes > pShard->capacity) {
+    SPageEntry *pVictim = tsdbPCacheTail(pShard, TSDB_PCACHE_AM);
+    if (pShard->a1inBytes > pShard->capacity / 4 || pVictim == NULL) {
+      pVictim = tsdbPCacheTail(pShard, TSDB_PCACHE_A1IN);
+    }
+    if (pVictim == NULL) break;
+
+    if (pVictim->queue == TSDB_PCACHE_AM) {
+      tsdbPCacheRemove(pShard, pVictim);
+      continue;
+    }
+
+    // keep the key only, so a second read soon after promotes the page to Am
+    SPageEntry *pGhost = taosMemoryCalloc(1, sizeof(SPageEntry));
+    SPageKey    key = pVictim->key;
+    tsdbPCacheRemove(pShard, pVictim);
+    if (pGhost == NULL) continue;
+
+    pGhost->key = key;
+    if (taosHashPut(pShard->pHash, &key, sizeof(key), &pGhost, sizeof(pGhost)) != 0) {
+      taosMemoryFree(pGhost);
+      continue;
+    }
+    tsdbPCachePushHead(pShard, pGhost, TSDB_PCACHE_A1OUT);
+    pShard->nGhost++;
+  }
+
+  while (pShard->nGhost > TMAX(pShard->nResident / 2, 16)) {
+    tsdbPCacheRemove(pShard, tsdbPCacheTail(pShard, TSDB_PCACHE_A1OUT));
+  }
+}
+
+int32_t tsdbPageCacheOpen(int64_t capacity) {
+  if (capacity <= 0) return 0;
+
+  tsdbPCache.pFiles = taosHashInit(1024, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY), true, HASH_NO_LOCK);
+  if (tsdbPCache.pFiles == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+  taosThreadMutexInit(&tsdbPCache.mutex, NULL);
+
+  for (int32_t i = 0; i < TSDB_PCACHE_SHARDS; i++) {
+    SPageShard *pShard = &tsdbPCache.shards[i];
+    pShard->pHash = taosHashInit(1024, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY), true, HASH_NO_LOCK);
+    if (pShard->pHash == NULL) {
+      tsdbPageCacheClose();
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+    for (int32_t q = 0; q < TSDB_PCACHE_QUEUES; q++) {
+      pShard->queues[q].prev = pShard->queues[q].next = &pShard->queues[q];
+    }
+    pShard->capacity = capacity / TSDB_PCACHE_SHARDS;
+    taosThreadMutexInit(&pShard->mutex, NULL);
+  }
+
+  tsdbPCache.capacity = capacity;
+  tsdbInfo("tsdb page cache is opened, capacity:%" PRId64, capacity);
+  return 0;
+}
+
+void tsdbPageCacheClose() {
+  if (tsdbPCache.pFiles == NULL) return;
+
+  tsdbPCache.capacity = 0;
+  for (int32_t i = 0; i < TSDB_PCACHE_SHARDS; i++) {
+    SPageShard *pShard = &tsdbPCache.shards[i];
+    if (pShard->pHash == NULL) continue;
+
+    for (int32_t q = 0; q < TSDB_PCACHE_QUEUES; q++) {
+      SPageEntry *pEntry = NULL;
+      while ((pEntry = tsdbPCacheTail(pShard, q)) != NULL) {
+        tsdbPCacheRemove(pShard, pEntry);
+      }
+    }
+    taosHashCleanup(pShard->pHash);
+    pShard->pHash = NULL;
+    taosThreadMutexDestroy(&pShard->mutex);
+  }
+
+  taosHashCleanup(tsdbPCache.pFiles);
+  tsdbPCache.pFiles = NULL;
+  taosThreadMutexDestroy(&tsdbPCache.mutex);
+}
+
+void tsdbPageCacheAttach(STsdbFD *pFD) {
+  pFD->pcId = 0;
+  if (tsdbPCache.capacity <= 0 || pFD->s3File || pFD->flag != TD_FILE_READ ||
+      pFD->szPage > tsdbPCache.capacity / TSDB_PCACHE_SHARDS) {
+    return;
+  }
+
+  int32_t len = strlen(pFD->path);
+  pFD->pcHot = len > 5 && strcmp(pFD->path + len - 5, ".head") == 0;
+
+  // an id assigned by path stays valid until the file is removed or written, see tsdbPageCacheRemoveFile
+  taosThreadMutexLock(&tsdbPCache.mutex);
+  SPageFile *pFile = taosHashGet(tsdbPCache.pFiles, pFD->path, len);
+  if (pFile != NULL) {
+    pFD->pcId = pFile->id;
+  } else {
+    SPageFile file = {.id = ++tsdbPCache.fileId, .pTsdb = pFD->pTsdb};
+    if (taosHashPut(tsdbPCache.pFiles, pFD->path, len, &file, sizeof(file)) == 0) {
+      pFD->pcId = file.id;
+    }
+  }
+  taosThreadMutexUnlock(&tsdbPCache.mutex);
+}
+
+bool tsdbPageCacheGet(STsdbFD *pFD, int64_t pgno, uint8_t *pPage) {
+  SPageKey    key = {.fileId = pFD->pcId, .pgno = pgno};
+  SPageShard *pShard = tsdbPCacheShard(&key);
+  bool        hit = false;
+
+  taosThreadMutexLock(&pShard->mutex);
+  SPageEntry **ppEntry = taosHashGet(pShard->pHash, &key, sizeof(key));
+  if (ppEntry != NULL && (*ppEntry)->queue != TSDB_PCACHE_A1OUT) {
+    SPageEntry *pEntry = *ppEntry;
+    memcpy(pPage, pEntry->data, pEntry->size);
+    if (pEntry->queue == TSDB_PCACHE_A1IN) {
+      pShard->a1inBytes -= pEntry->size;
+      pShard->amBytes += pEntry->size;
+    }
+    tsdbPCacheUnlink(pEntry);
+    tsdbPCachePushHead(pShard, pEntry, TSDB_PCACHE_AM);
+    hit = true;
+  }
+  taosThreadMutexUnlock(&pShard->mutex);
+
+  if (hit) {
+    atomic_add_fetch_64(&pFD->pTsdb->pageStat.nHit, 1);
+  } else {
+    atomic_add_fetch_64(&pFD->pTsdb->pageStat.nMiss, 1);
+  }
+  return hit;
+}
+
+void tsdbPageCachePut(STsdbFD *pFD, int64_t pgno, const uint8_t *pPage) {
+  SPageKey    key = {.fileId = pFD->pcId, .pgno = pgno};
+  SPageShard *pShard = tsdbPCacheShard(&key);
+
+  SPageEntry *pNew = taosMemoryMalloc(sizeof(SPageEntry) + pFD->szPage);
+  if (pNew == NULL) return;
+  pNew->key = key;
+  pNew->size = pFD->szPage;
+  memcpy(pNew->data, pPage, pFD->szPage);
+
+  EPageQueue queue = pFD->pcHot ? TSDB_PCACHE_AM : TSDB_PCACHE_A1IN;
+
+  taosThreadMutexLock(&pShard->mutex);
+  SPageEntry **ppEntry = taosHashGet(pShard->pHash, &key, sizeof(key));
+  if (ppEntry != NULL) {
+    if ((*ppEntry)->queue != TSDB_PCACHE_A1OUT) {
+      // loaded by another reader meanwhile
+      taosThreadMutexUnlock(&pShard->mutex);
+      taosMemoryFree(pNew);
+      return;
+    }
+    tsdbPCacheRemove(pShard, *ppEntry);
+    queue = TSDB_PCACHE_AM;
+  }
+
+  if (taosHashPut(pShard->pHash, &key, sizeof(key), &pNew, sizeof(pNew)) != 0) {
+    taosThreadMutexUnlock(&pShard->mutex);
+    taosMemoryFree(pNew);
+    return;
+  }
+  tsdbPCachePushHead(pShard, pNew, queue);
+  if (queue == TSDB_PCACHE_AM) {
+    pShard->amBytes += pNew->size;
+  } else {
+    pShard->a1inBytes += pNew->size;
+  }
+  pShard->nResident++;
+  tsdbPCacheEvict(pShard);
+  taosThreadMutexUnlock(&pShard->mutex);
+}
+
+// Forget the id of a file which is removed, or opened for write as new data may be appended to its last page.
+// Later readers get a new id, and the pages cached by the old id are never read again and age out of the queues.
+void tsdbPageCacheRemoveFile(const char *path) {
+  if (tsdbPCache.capacity <= 0) return;
+
+  taosThreadMutexLock(&tsdbPCache.mutex);
+  taosHashRemove(tsdbPCache.pFiles, path, strlen(path));
+  taosThreadMutexUnlock(&tsdbPCache.mutex);
+}
+
+// the vnode may be dropped and created again with the same file paths
+void tsdbPageCacheRemoveTsdb(STsdb *pTsdb) {
+  if (tsdbPCache.capacity <= 0) return;
+
+  SArray *aPath = taosArrayInit(64, POINTER_BYTES);
+  if (aPath == NULL) return;
+
+  taosThreadMutexLock(&tsdbPCache.mutex);
+  SPageFile *pFile = taosHashIterate(tsdbPCache.pFiles, NULL);
+  while (pFile != NULL) {
+    if (pFile->pTsdb == pTsdb) {
+      size_t keyLen = 0;
+      char  *path = taosHashGetKey(pFile, &keyLen);
+      char  *dup = taosMemoryCalloc(1, keyLen + 1);
+      if (dup != NULL) {
+        memcpy(dup, path, keyLen);
+        taosArrayPush(aPath, &dup);
+      }
+    }
+    pFile = taosHashIterate(tsdbPCache.pFiles, pFile);
+  }
+  for (int32_t i = 0; i < taosArrayGetSize(aPath); i++) {
+    char *path = *(char **)taosArrayGet(aPath, i);
+    taosHashRemove(tsdbPCache.pFiles, path, strlen(path));
+  }
+  taosThreadMutexUnlock(&tsdbPCache.mutex);
+
+  taosArrayDestroyP(aPath, taosMemoryFree);
+}
+
+void tsdbPageCacheGetStat(SVnode *pVnode, int64_t *pHit, int64_t *pMiss) {
+  *pHit = *pMiss = 0;
+  if (pVnode->pTsdb != NULL) {
+    *pHit = atomic_load_64(&pVnode->pTsdb->pageStat.nHit);
+    *pMiss = atomic_load_64(&pVnode->pTsdb->pageStat.nMiss);
+  }
+}
@@ -77,6 +77,7 @@ static void          updateComposedBlockInfo(STsdbReader* pReader, double el, ST
 static bool outOfTimeWindow(int64_t ts, STimeWindow* pWindow) { return (ts > pWindow->ekey) || (ts < pWindow->skey); }
 
 static void resetPreFilesetMemTableListIndex(SReaderStatus* pStatus);
+static int32_t doLoadRemainColumns(STsdbReader* pReader, bool loadAll);
 
 static int32_t setColumnIdSlotList(SBlockLoadSuppInfo* pSupInfo, SColumnInfo* pCols, const int32_t* pSlotIdList,
                                    int32_t numOfCols) {
@@ -110,7 +111,8 @@ static int32_t updateBlockSMAInfo(STSchema* pSchema, SBlockLoadSuppInfo* pSupInf
   while (i < pSchema->numOfCols && j < pSupInfo->numOfCols) {
     STColumn* pTCol = &pSchema->columns[i];
     if (pTCol->colId == pSupInfo->colId[j]) {
-      if (!IS_BSMA_ON(pTCol)) {
+      // the block sma is written for the columns with bloom filter as well
+      if (!IS_BSMA_ON(pTCol) && !IS_BLOOM_ON(pTCol)) {
         pSupInfo->smaValid = false;
         return TSDB_CODE_SUCCESS;
       }
@@ -195,6 +197,8 @@ static int32_t filesetIteratorNext(SFilesetIter* pIter, STsdbReader* pReader, bo
   // check file the time range of coverage
   STimeWindow win = {0};
 
+  tsdbReadAheadReset(&pReader->status.readAhead, pCost);
+
   while (1) {
     if (pReader->pFileReader != NULL) {
       tsdbDataFileReaderClose(&pReader->pFileReader);
@@ -422,6 +426,12 @@ static int32_t tsdbReaderCreate(SVnode* pVnode, SQueryTableDataCond* pCond, void
     goto _end;
   }
 
+  code = tsdbReadAheadInit(&pReader->status.readAhead, tsQueryReadAheadDepth);
+  if (code != TSDB_CODE_SUCCESS) {
+    terrno = code;
+    goto _end;
+  }
+
   if (pReader->suppInfo.colId[0] != PRIMARYKEY_TIMESTAMP_COL_ID) {
     tsdbError("the first column isn't primary timestamp, %d, %s", pReader->suppInfo.colId[0], pReader->idStr);
     code = TSDB_CODE_INVALID_PARA;
@@ -882,19 +892,92 @@ static void copyNumericCols(const SColData* pData, SFileBlockDumpInfo* pDumpInfo
   }
 }
 
-static int32_t copyBlockDataToSDataBlock(STsdbReader* pReader) {
+// copy the columns of rows [pDumpInfo->rowIndex, pDumpInfo->rowIndex + step * dumpedRows) into the result block.
+// only the columns of which pMask[i] is true are copied if pMask is not NULL.
+static int32_t copyColsToSDataBlock(STsdbReader* pReader, SBlockData* pBlockData, SFileBlockDumpInfo* pDumpInfo,
+                                    int32_t dumpedRows, const bool* pMask) {
+  SBlockLoadSuppInfo* pSupInfo = &pReader->suppInfo;
+  SSDataBlock*        pResBlock = pReader->resBlockInfo.pResBlock;
+  int32_t             numOfOutputCols = pSupInfo->numOfCols;
+  bool                asc = ASCENDING_TRAVERSE(pReader->info.order);
+  int32_t             step = asc ? 1 : -1;
+  int32_t             code = TSDB_CODE_SUCCESS;
+  SColVal             cv = {0};
+
+  int32_t i = 0;
+  int32_t rowIndex = 0;
+
+  SColumnInfoData* pColData = taosArrayGet(pResBlock->pDataBlock, pSupInfo->slotId[i]);
+  if (pSupInfo->colId[i] == PRIMARYKEY_TIMESTAMP_COL_ID) {
+    if (pMask == NULL || pMask[i]) {
+      copyPrimaryTsCol(pBlockData, pDumpInfo, pColData, dumpedRows, asc);
+    }
+    i += 1;
+  }
+
+  int32_t colIndex = 0;
+  int32_t num = pBlockData->nColData;
+  while (i < numOfOutputCols && colIndex < num) {
+    if (pMask != NULL && !pMask[i]) {
+      i += 1;
+      continue;
+    }
+
+    rowIndex = 0;
+
+    SColData* pData = tBlockDataGetColDataByIdx(pBlockData, colIndex);
+    if (pData->cid < pSupInfo->colId[i]) {
+      colIndex += 1;
+    } else if (pData->cid == pSupInfo->colId[i]) {
+      pColData = taosArrayGet(pResBlock->pDataBlock, pSupInfo->slotId[i]);
+
+      if (pData->flag == HAS_NONE || pData->flag == HAS_NULL || pData->flag == (HAS_NULL | HAS_NONE)) {
+        colDataSetNNULL(pColData, 0, dumpedRows);
+      } else {
+        if (IS_MATHABLE_TYPE(pColData->info.type)) {
+          copyNumericCols(pData, pDumpInfo, pColData, dumpedRows, asc);
+        } else {  // varchar/nchar type
+          for (int32_t j = pDumpInfo->rowIndex; rowIndex < dumpedRows; j += step) {
+            tColDataGetValue(pData, j, &cv);
+            code = doCopyColVal(pColData, rowIndex++, i, &cv, pSupInfo);
+            if (code) {
+              return code;
+            }
+          }
+        }
+      }
+
+      colIndex += 1;
+      i += 1;
+    } else {  // the specified column does not exist in file block, fill with null data
+      pColData = taosArrayGet(pResBlock->pDataBlock, pSupInfo->slotId[i]);
+      colDataSetNNULL(pColData, 0, dumpedRows);
+      i += 1;
+    }
+  }
+
+  // fill the mis-matched columns with null value
+  while (i < numOfOutputCols) {
+    if (pMask == NULL || pMask[i]) {
+      pColData = taosArrayGet(pResBlock->pDataBlock, pSupInfo->slotId[i]);
+      colDataSetNNULL(pColData, 0, dumpedRows);
+    }
+    i += 1;
+  }
+
+  return code;
+}
+
+static int32_t copyBlockDataToSDataBlock(STsdbReader* pReader, const bool* pMask) {
   SReaderStatus*      pStatus = &pReader->status;
   SDataBlockIter*     pBlockIter = &pStatus->blockIter;
-  SBlockLoadSuppInfo* pSupInfo = &pReader->suppInfo;
   SFileBlockDumpInfo* pDumpInfo = &pReader->status.fBlockDumpInfo;
 
   SBlockData*         pBlockData = &pStatus->fileBlockData;
   SFileDataBlockInfo* pBlockInfo = getCurrentBlockInfo(pBlockIter);
   SSDataBlock*        pResBlock = pReader->resBlockInfo.pResBlock;
-  int32_t             numOfOutputCols = pSupInfo->numOfCols;
   int32_t             code = TSDB_CODE_SUCCESS;
 
-  SColVal cv = {0};
   int64_t st = taosGetTimestampUs();
   bool    asc = ASCENDING_TRAVERSE(pReader->info.order);
   int32_t step = asc ? 1 : -1;
@@ -972,56 +1055,16 @@ static int32_t copyBlockDataToSDataBlock(STsdbReader* pReader) {
     return TSDB_CODE_SUCCESS;
   }
 
-  int32_t i = 0;
-  int32_t rowIndex = 0;
-
-  SColumnInfoData* pColData = taosArrayGet(pResBlock->pDataBlock, pSupInfo->slotId[i]);
-  if (pSupInfo->colId[i] == PRIMARYKEY_TIMESTAMP_COL_ID) {
-    copyPrimaryTsCol(pBlockData, pDumpInfo, pColData, dumpedRows, asc);
-    i += 1;
-  }
-
-  int32_t colIndex = 0;
-  int32_t num = pBlockData->nColData;
-  while (i < numOfOutputCols && colIndex < num) {
-    rowIndex = 0;
-
-    SColData* pData = tBlockDataGetColDataByIdx(pBlockData, colIndex);
-    if (pData->cid < pSupInfo->colId[i]) {
-      colIndex += 1;
-    } else if (pData->cid == pSupInfo->colId[i]) {
-      pColData = taosArrayGet(pResBlock->pDataBlock, pSupInfo->slotId[i]);
-
-      if (pData->flag == HAS_NONE || pData->flag == HAS_NULL || pData->flag == (HAS_NULL | HAS_NONE)) {
-        colDataSetNNULL(pColData, 0, dumpedRows);
-      } else {
-        if (IS_MATHABLE_TYPE(pColData->info.type)) {
-          copyNumericCols(pData, pDumpInfo, pColData, dumpedRows, asc);
-        } else {  // varchar/nchar type
-          for (int32_t j = pDumpInfo->rowIndex; rowIndex < dumpedRows; j += step) {
-            tColDataGetValue(pData, j, &cv);
-            code = doCopyColVal(pColData, rowIndex++, i, &cv, pSupInfo);
-            if (code) {
-              return code;
-            }
-          }
-        }
-      }
-
-      colIndex += 1;
-      i += 1;
-    } else {  // the specified column does not exist in file block, fill with null data
-      pColData = taosArrayGet(pResBlock->pDataBlock, pSupInfo->slotId[i]);
-      colDataSetNNULL(pColData, 0, dumpedRows);
-      i += 1;
-    }
+  code = copyColsToSDataBlock(pReader, pBlockData, pDumpInfo, dumpedRows, pMask);
+  if (code) {
+    return code;
   }
 
-  // fill the mis-matched columns with null value
-  while (i < numOfOutputCols) {
-    pColData = taosArrayGet(pResBlock->pDataBlock, pSupInfo->slotId[i]);
-    colDataSetNNULL(pColData, 0, dumpedRows);
-    i += 1;
+  if (pMask != NULL) {  // the remain columns are copied later from the same position
+    SLateMatInfo* pLateInfo = &pStatus->lateMatInfo;
+    pLateInfo->pending = true;
+    pLateInfo->rowIndex = pDumpInfo->rowIndex;
+    pLateInfo->numOfRows = dumpedRows;
   }
 
   pResBlock->info.dataLoad = 1;
@@ -1072,8 +1115,10 @@ static FORCE_INLINE STSchema* getTableSchemaImpl(STsdbReader* pReader, uint64_t
   return pReader->info.pSchema;
 }
 
-static int32_t doLoadFileBlockData(STsdbReader* pReader, SDataBlockIter* pBlockIter, SBlockData* pBlockData,
-                                   uint64_t uid) {
+// the following blocks are loaded ahead with the same columns if readAhead is true, which is false when the remain
+// columns of current block are loaded.
+static int32_t doLoadFileBlockDataByColumn(STsdbReader* pReader, SDataBlockIter* pBlockIter, SBlockData* pBlockData,
+                                           uint64_t uid, int16_t* pCid, int32_t numOfCids, bool readAhead) {
   int32_t   code = 0;
   STSchema* pSchema = pReader->info.pSchema;
   int64_t   st = taosGetTimestampUs();
@@ -1088,19 +1133,28 @@ static int32_t doLoadFileBlockData(STsdbReader* pReader, SDataBlockIter* pBlockI
     }
   }
 
-  SBlockLoadSuppInfo* pSup = &pReader->suppInfo;
   SFileDataBlockInfo* pBlockInfo = getCurrentBlockInfo(pBlockIter);
   SFileBlockDumpInfo* pDumpInfo = &pReader->status.fBlockDumpInfo;
 
   SBrinRecord* pRecord = &pBlockInfo->record;
-  code = tsdbDataFileReadBlockDataByColumn(pReader->pFileReader, pRecord, pBlockData, pSchema, &pSup->colId[1],
-                                           pSup->numOfCols - 1);
+
+  // the block loaded ahead is used only if it contains all of the columns in pCid
+  if (!tsdbReadAheadFetch(pReader, pRecord, pBlockData, pCid, numOfCids)) {
+    code = tsdbDataFileReadBlockDataByColumn(pReader->pFileReader, pRecord, pBlockData, pSchema, pCid, numOfCids);
+    if (code != TSDB_CODE_SUCCESS) {
+      tsdbError("%p error occurs in loading file block, global index:%d, table index:%d, brange:%" PRId64 "-%" PRId64
+                ", rows:%d, code:%s %s",
+                pReader, pBlockIter->index, pBlockInfo->tbBlockIdx, pBlockInfo->record.firstKey,
+                pBlockInfo->record.lastKey, pBlockInfo->record.numRow, tstrerror(code), pReader->idStr);
+      return code;
+    }
+  }
+
+  // the read-ahead is an optimization, disable it instead of failing the query
+  code = readAhead ? tsdbReadAheadSchedule(pReader, pCid, numOfCids) : TSDB_CODE_SUCCESS;
   if (code != TSDB_CODE_SUCCESS) {
-    tsdbError("%p error occurs in loading file block, global index:%d, table index:%d, brange:%" PRId64 "-%" PRId64
-              ", rows:%d, code:%s %s",
-              pReader, pBlockIter->index, pBlockInfo->tbBlockIdx, pBlockInfo->record.firstKey,
-              pBlockInfo->record.lastKey, pBlockInfo->record.numRow, tstrerror(code), pReader->idStr);
-    return code;
+    tsdbWarn("%p failed to schedule read-ahead, disable it, code:%s %s", pReader, tstrerror(code), pReader->idStr);
+    tsdbReadAheadDestroy(&pReader->status.readAhead, &pReader->cost);
   }
 
   double elapsedTime = (taosGetTimestampUs() - st) / 1000.0;
@@ -1116,6 +1170,12 @@ static int32_t doLoadFileBlockData(STsdbReader* pReader, SDataBlockIter* pBlockI
   return TSDB_CODE_SUCCESS;
 }
 
+static int32_t doLoadFileBlockData(STsdbReader* pReader, SDataBlockIter* pBlockIter, SBlockData* pBlockData,
+                                   uint64_t uid) {
+  SBlockLoadSuppInfo* pSup = &pReader->suppInfo;
+  return doLoadFileBlockDataByColumn(pReader, pBlockIter, pBlockData, uid, &pSup->colId[1], pSup->numOfCols - 1, true);
+}
+
 /**
  * This is an two rectangles overlap cases.
  */
@@ -2385,7 +2445,7 @@ static int32_t buildComposedDataBlock(STsdbReader* pReader) {
   if (isCleanFileDataBlock(pReader, pBlockInfo, pBlockScanInfo, keyInBuf) && (pRecord->numRow <= cap)) {
     if (((asc && (pRecord->firstKey < keyInBuf.ts)) || (!asc && (pRecord->lastKey > keyInBuf.ts))) &&
         (pBlockScanInfo->sttKeyInfo.status == STT_FILE_NO_DATA)) {
-      code = copyBlockDataToSDataBlock(pReader);
+      code = copyBlockDataToSDataBlock(pReader, NULL);
       if (code) {
         goto _end;
       }
@@ -4111,6 +4171,7 @@ void tsdbReaderClose2(STsdbReader* pReader) {
 
   SBlockLoadSuppInfo* pSupInfo = &pReader->suppInfo;
   TARRAY2_DESTROY(&pSupInfo->colAggArray, NULL);
+  TARRAY2_DESTROY(&pSupInfo->colIdxArray, tColumnDataIdxClear);
   for (int32_t i = 0; i < pSupInfo->numOfCols; ++i) {
     if (pSupInfo->buildBuf[i] != NULL) {
       taosMemoryFreeClear(pSupInfo->buildBuf[i]);
@@ -4122,6 +4183,9 @@ void tsdbReaderClose2(STsdbReader* pReader) {
   }
 
   taosMemoryFree(pSupInfo->colId);
+  taosMemoryFree(pReader->status.lateMatInfo.pMask);
+  taosMemoryFree(pReader->status.lateMatInfo.pCid);
+  tsdbReadAheadDestroy(&pReader->status.readAhead, &pReader->cost);
   tBlockDataDestroy(&pReader->status.fileBlockData);
   cleanupDataBlockIterator(&pReader->status.blockIter);
 
@@ -4162,12 +4226,16 @@ void tsdbReaderClose2(STsdbReader* pReader) {
       "build in-memory-block-time:%.2f ms, sttBlocks:%" PRId64 ", sttBlocks-time:%.2f ms, sttStatisBlock:%" PRId64
       ", stt-statis-Block-time:%.2f ms, composed-blocks:%" PRId64
       ", composed-blocks-time:%.2fms, STableBlockScanInfo size:%.2f Kb, createTime:%.2f ms,createSkylineIterTime:%.2f "
-      "ms, initSttBlockReader:%.2fms, %s",
+      "ms, initSttBlockReader:%.2fms, late-mat-blocks:%" PRId64 ", late-mat-skip-blocks:%" PRId64
+      ", late-mat-skip-cols:%" PRId64 ", read-ahead-blocks:%" PRId64 ", read-ahead-hits:%" PRId64
+      ", read-ahead-waits:%" PRId64 ", read-ahead-discards:%" PRId64 ", read-ahead-wait-time:%.2f ms, %s",
       pReader, pCost->headFileLoad, pCost->headFileLoadTime, pCost->smaDataLoad, pCost->smaLoadTime, pCost->numOfBlocks,
       pCost->blockLoadTime, pCost->buildmemBlock, pCost->sttCost.loadBlocks, pCost->sttCost.blockElapsedTime,
       pCost->sttCost.loadStatisBlocks, pCost->sttCost.statisElapsedTime, pCost->composedBlocks,
       pCost->buildComposedBlockTime, numOfTables * sizeof(STableBlockScanInfo) / 1000.0, pCost->createScanInfoList,
-      pCost->createSkylineIterTime, pCost->initSttBlockReader, pReader->idStr);
+      pCost->createSkylineIterTime, pCost->initSttBlockReader, pCost->lateMatBlocks, pCost->lateMatSkipBlocks,
+      pCost->lateMatSkipCols, pCost->readAheadBlocks, pCost->readAheadHits, pCost->readAheadWaits,
+      pCost->readAheadDiscards, pCost->readAheadWaitTime, pReader->idStr);
 
   taosMemoryFree(pReader->idStr);
 
@@ -4197,9 +4265,20 @@ int32_t tsdbReaderSuspend2(STsdbReader* pReader) {
       pBlockScanInfo = *pStatus->pTableIter;
     }
 
+    // the file block is not available after resumed, so load the remain columns of the dumped rows now
+    SLateMatInfo* pLateInfo = &pStatus->lateMatInfo;
+    if (pLateInfo->pending) {
+      pLateInfo->code = doLoadRemainColumns(pReader, false);
+      if (pLateInfo->code != TSDB_CODE_SUCCESS) {
+        tsdbError("failed to load remain columns before suspend, code:%s %s", tstrerror(pLateInfo->code),
+                  pReader->idStr);
+      }
+    }
+
     tsdbDataFileReaderClose(&pReader->pFileReader);
 
     SReadCostSummary* pCost = &pReader->cost;
+    tsdbReadAheadReset(&pReader->status.readAhead, pCost);
     pReader->status.pLDataIterArray = destroySttBlockReader(pReader->status.pLDataIterArray, &pCost->sttCost);
     pReader->status.pLDataIterArray = taosArrayInit(4, POINTER_BYTES);
   }
@@ -4617,7 +4696,7 @@ int32_t tsdbRetrieveDatablockSMA2(STsdbReader* pReader, SSDataBlock* pDataBlock,
   //  int64_t st = taosGetTimestampUs();
   TARRAY2_CLEAR(&pSup->colAggArray, 0);
 
-  code = tsdbDataFileReadBlockSma(pReader->pFileReader, &pFBlock->record, &pSup->colAggArray);
+  code = tsdbDataFileReadBlockSma(pReader->pFileReader, &pFBlock->record, &pSup->colAggArray, &pSup->colIdxArray);
   if (code != TSDB_CODE_SUCCESS) {
     tsdbDebug("vgId:%d, failed to load block SMA for uid %" PRIu64 ", code:%s, %s", 0, pFBlock->uid, tstrerror(code),
               pReader->idStr);
@@ -4678,11 +4757,90 @@ int32_t tsdbRetrieveDatablockSMA2(STsdbReader* pReader, SSDataBlock* pDataBlock,
   return code;
 }
 
-static SSDataBlock* doRetrieveDataBlock(STsdbReader* pReader) {
+// set the columns that are loaded in the first phase of late materialization, i.e., the columns in pIdList.
+static int32_t initLateMatInfo(STsdbReader* pReader, SArray* pIdList, int32_t* numOfCids) {
+  SBlockLoadSuppInfo* pSup = &pReader->suppInfo;
+  SLateMatInfo*       pLateInfo = &pReader->status.lateMatInfo;
+  int32_t             num = 0;
+  size_t              size = taosArrayGetSize(pIdList);
+
+  if (pLateInfo->pMask == NULL) {
+    pLateInfo->pMask = taosMemoryCalloc(pSup->numOfCols, sizeof(bool));
+    pLateInfo->pCid = taosMemoryCalloc(pSup->numOfCols, sizeof(int16_t));
+    if (pLateInfo->pMask == NULL || pLateInfo->pCid == NULL) {
+      taosMemoryFreeClear(pLateInfo->pMask);
+      taosMemoryFreeClear(pLateInfo->pCid);
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+  }
+
+  // the primary timestamp column is always loaded
+  pLateInfo->pMask[0] = true;
+  for (int32_t i = 1; i < pSup->numOfCols; ++i) {
+    pLateInfo->pMask[i] = false;
+    for (int32_t j = 0; j < size; ++j) {
+      if (*(col_id_t*)taosArrayGet(pIdList, j) == pSup->colId[i]) {
+        pLateInfo->pMask[i] = true;
+        pLateInfo->pCid[num++] = pSup->colId[i];
+        break;
+      }
+    }
+  }
+
+  *numOfCids = num;
+  return TSDB_CODE_SUCCESS;
+}
+
+// load the columns that are not copied in the first phase, and copy them into the same rows of the result block.
+static int32_t doLoadRemainColumns(STsdbReader* pReader, bool loadAll) {
+  SReaderStatus*      pStatus = &pReader->status;
+  SLateMatInfo*       pLateInfo = &pStatus->lateMatInfo;
+  SBlockLoadSuppInfo* pSup = &pReader->suppInfo;
+  SFileBlockDumpInfo* pDumpInfo = &pStatus->fBlockDumpInfo;
+  SFileDataBlockInfo* pBlockInfo = getCurrentBlockInfo(&pStatus->blockIter);
+  bool                allDumped = pDumpInfo->allDumped;
+  int32_t             numOfCids = 0;
+  int32_t             code = TSDB_CODE_SUCCESS;
+
+  pLateInfo->pending = false;
+  for (int32_t i = 0; i < pSup->numOfCols; ++i) {
+    pLateInfo->pMask[i] = !pLateInfo->pMask[i];
+    if (pLateInfo->pMask[i]) {
+      pLateInfo->pCid[numOfCids++] = pSup->colId[i];
+    }
+  }
+
+  // the dump info should not be affected by reloading the file block
+  if (loadAll) {
+    code = doLoadFileBlockDataByColumn(pReader, &pStatus->blockIter, &pStatus->fileBlockData, pBlockInfo->uid,
+                                       &pSup->colId[1], pSup->numOfCols - 1, false);
+  } else {
+    code = doLoadFileBlockDataByColumn(pReader, &pStatus->blockIter, &pStatus->fileBlockData, pBlockInfo->uid,
+                                       pLateInfo->pCid, numOfCids, false);
+  }
+
+  pDumpInfo->allDumped = allDumped;
+  if (code != TSDB_CODE_SUCCESS) {
+    tBlockDataReset(&pStatus->fileBlockData);
+    return code;
+  }
+
+  SFileBlockDumpInfo info = {.rowIndex = pLateInfo->rowIndex};
+  code = copyColsToSDataBlock(pReader, &pStatus->fileBlockData, &info, pLateInfo->numOfRows, pLateInfo->pMask);
+  pReader->cost.lateMatBlocks += 1;
+  return code;
+}
+
+static SSDataBlock* doRetrieveDataBlock(STsdbReader* pReader, SArray* pIdList) {
   SReaderStatus*      pStatus = &pReader->status;
+  SLateMatInfo*       pLateInfo = &pStatus->lateMatInfo;
   int32_t             code = TSDB_CODE_SUCCESS;
   SFileDataBlockInfo* pBlockInfo = getCurrentBlockInfo(&pStatus->blockIter);
+  bool*               pMask = NULL;
+  int32_t             numOfCids = 0;
 
+  pLateInfo->pending = false;
+  pLateInfo->code = TSDB_CODE_SUCCESS;
   if (pReader->code != TSDB_CODE_SUCCESS) {
     return NULL;
   }
@@ -4692,20 +4850,49 @@ static SSDataBlock* doRetrieveDataBlock(STsdbReader* pReader) {
     return NULL;
   }
 
-  code = doLoadFileBlockData(pReader, &pStatus->blockIter, &pStatus->fileBlockData, pBlockScanInfo->uid);
+  if (pIdList != NULL) {
+    code = initLateMatInfo(pReader, pIdList, &numOfCids);
+    if (code != TSDB_CODE_SUCCESS) {
+      terrno = code;
+      return NULL;
+    }
+
+    // nothing to be deferred if all of the required columns are in the id list
+    if (numOfCids < pReader->suppInfo.numOfCols - 1) {
+      pMask = pLateInfo->pMask;
+    }
+  }
+
+  if (pMask != NULL) {
+    code = doLoadFileBlockDataByColumn(pReader, &pStatus->blockIter, &pStatus->fileBlockData, pBlockScanInfo->uid,
+                                       pLateInfo->pCid, numOfCids, true);
+  } else {
+    code = doLoadFileBlockData(pReader, &pStatus->blockIter, &pStatus->fileBlockData, pBlockScanInfo->uid);
+  }
+
   if (code != TSDB_CODE_SUCCESS) {
     tBlockDataReset(&pStatus->fileBlockData);
     terrno = code;
     return NULL;
   }
 
-  code = copyBlockDataToSDataBlock(pReader);
+  code = copyBlockDataToSDataBlock(pReader, pMask);
   if (code != TSDB_CODE_SUCCESS) {
     tBlockDataReset(&pStatus->fileBlockData);
     terrno = code;
     return NULL;
   }
 
+  // the rest rows of current file block are dumped later from the file block data, so the remain columns are needed
+  // right now.
+  if (pLateInfo->pending && !pStatus->fBlockDumpInfo.allDumped) {
+    code = doLoadRemainColumns(pReader, true);
+    if (code != TSDB_CODE_SUCCESS) {
+      terrno = code;
+      return NULL;
+    }
+  }
+
   return pReader->resBlockInfo.pResBlock;
 }
 
@@ -4724,7 +4911,8 @@ SSDataBlock* tsdbRetrieveDataBlock2(STsdbReader* pReader, SArray* pIdList) {
     return pTReader->resBlockInfo.pResBlock;
   }
 
-  SSDataBlock* ret = doRetrieveDataBlock(pTReader);
+  // late materialization is only applied to the main scan
+  SSDataBlock* ret = doRetrieveDataBlock(pTReader, (pTReader == pReader) ? pIdList : NULL);
 
   qTrace("tsdb/read-retrieve: %p, unlock read mutex", pReader);
   tsdbReleaseReader(pReader);
@@ -4732,6 +4920,38 @@ SSDataBlock* tsdbRetrieveDataBlock2(STsdbReader* pReader, SArray* pIdList) {
   return ret;
 }
 
+/**
+ * Load the remain columns of the data block returned by tsdbRetrieveDataBlock2 with a column id list, or skip them if
+ * no rows in the block are qualified. It should be called once after such a tsdbRetrieveDataBlock2 invocation. The read
+ * mutex is not held in between, and if the reader is suspended meanwhile the remain columns are loaded by the suspend.
+ */
+int32_t tsdbRetrieveRemainColumns2(void* param, bool load) {
+  STsdbReader*        pReader = param;
+  SLateMatInfo*       pLateInfo = &pReader->status.lateMatInfo;
+  SBlockLoadSuppInfo* pSup = &pReader->suppInfo;
+  int32_t             code = TSDB_CODE_SUCCESS;
+
+  qTrace("tsdb/read-retrieve: %p, take read mutex", pReader);
+  tsdbAcquireReader(pReader);
+
+  if (!pLateInfo->pending) {
+    code = pLateInfo->code;
+    pLateInfo->code = TSDB_CODE_SUCCESS;
+  } else if (load) {
+    code = doLoadRemainColumns(pReader, false);
+  } else {
+    pLateInfo->pending = false;
+    pReader->cost.lateMatSkipBlocks += 1;
+    for (int32_t i = 0; i < pSup->numOfCols; ++i) {
+      pReader->cost.lateMatSkipCols += (pLateInfo->pMask[i] ? 0 : 1);
+    }
+  }
+
+  qTrace("tsdb/read-retrieve: %p, unlock read mutex", pReader);
+  tsdbReleaseReader(pReader);
+  return code;
+}
+
 int32_t tsdbReaderReset2(STsdbReader* pReader, SQueryTableDataCond* pCond) {
   int32_t code = TSDB_CODE_SUCCESS;
 
@@ -5002,6 +5222,20 @@ int64_t tsdbGetNumOfRowsInMemTable2(STsdbReader* pReader) {
   return rows;
 }
 
+// the read-ahead stats of the reader, including the inner readers of external rows, are added into pInfo.
+void tsdbReaderGetReadAheadStat2(void* param, STableScanAnalyzeInfo* pInfo) {
+  STsdbReader* pReader = param;
+  STsdbReader* pReaders[] = {pReader, pReader->innerReader[0], pReader->innerReader[1]};
+
+  for (int32_t i = 0; i < tListLen(pReaders); ++i) {
+    if (pReaders[i] != NULL) {
+      pInfo->readAheadBlocks += pReaders[i]->cost.readAheadBlocks;
+      pInfo->readAheadHits += pReaders[i]->cost.readAheadHits;
+      pInfo->readAheadWaits += pReaders[i]->cost.readAheadWaits;
+    }
+  }
+}
+
 int32_t tsdbGetTableSchema(void* pVnode, int64_t uid, STSchema** pSchema, int64_t* suid) {
   SMetaReader mr = {0};
   metaReaderDoInit(&mr, ((SVnode*)pVnode)->pMeta, 0);
@@ -21,6 +21,7 @@
 #include "tsdbMerge.h"
 #include "tsdbUtil2.h"
 #include "tsimplehash.h"
+#include "vnd.h"
 
 #define INIT_TIMEWINDOW(_w)  do { (_w)->skey = INT64_MAX; (_w)->ekey = INT64_MIN;} while(0);
 
@@ -1050,4 +1051,248 @@ bool overlapWithDelSkylineWithoutVer(STableBlockScanInfo* pBlockScanInfo, const
 
     return doCheckDatablockOverlapWithoutVersion(pBlockScanInfo, pRecord, index);
   }
-}
\ No newline at end of file
+}
+int32_t tsdbReadAheadInit(SReadAheadInfo* pInfo, int32_t depth) {
+  pInfo->fid = INT32_MIN;
+  pInfo->depth = 0;
+  if (depth <= 0 || vnodeAsyncHandle[2] == NULL) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  pInfo->pSlots = taosMemoryCalloc(depth, sizeof(SReadAheadSlot));
+  if (pInfo->pSlots == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  for (int32_t i = 0; i < depth; ++i) {
+    int32_t code = tBlockDataCreate(&pInfo->pSlots[i].blockData);
+    if (code != TSDB_CODE_SUCCESS) {
+      for (int32_t j = 0; j < i; ++j) {
+        tBlockDataDestroy(&pInfo->pSlots[j].blockData);
+      }
+      taosMemoryFreeClear(pInfo->pSlots);
+      return code;
+    }
+  }
+
+  pInfo->depth = depth;
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t doReadAheadBlock(void* param) {
+  SReadAheadSlot* pSlot = param;
+
+  pSlot->code = tsdbDataFileReadBlockDataByColumn(pSlot->pFileReader, &pSlot->record, &pSlot->blockData,
+                                                  pSlot->pSchema, pSlot->pCid, pSlot->numOfCids);
+  atomic_store_8(&pSlot->ready, 1);
+  return pSlot->code;
+}
+
+// wait for the task of slot to be completed or cancelled, the slot is idle afterwards.
+static void doReleaseReadAheadSlot(SReadAheadSlot* pSlot, SReadCostSummary* pCost) {
+  if (!VNODE_ASYNC_VALID_TASK_ID(pSlot->taskId)) {
+    return;
+  }
+
+  if (vnodeACancel(vnodeAsyncHandle[2], pSlot->taskId) != 0) {
+    vnodeAWait(vnodeAsyncHandle[2], pSlot->taskId);
+  }
+
+  pSlot->taskId = 0;
+  pSlot->ready = 0;
+  pCost->readAheadDiscards += 1;
+}
+
+void tsdbReadAheadReset(SReadAheadInfo* pInfo, SReadCostSummary* pCost) {
+  for (int32_t i = 0; i < pInfo->depth; ++i) {
+    SReadAheadSlot* pSlot = &pInfo->pSlots[i];
+    doReleaseReadAheadSlot(pSlot, pCost);
+    tsdbDataFileReaderClose(&pSlot->pFileReader);
+  }
+
+  pInfo->fid = INT32_MIN;
+}
+
+void tsdbReadAheadDestroy(SReadAheadInfo* pInfo, SReadCostSummary* pCost) {
+  tsdbReadAheadReset(pInfo, pCost);
+  for (int32_t i = 0; i < pInfo->depth; ++i) {
+    tBlockDataDestroy(&pInfo->pSlots[i].blockData);
+    taosMemoryFree(pInfo->pSlots[i].pCid);
+  }
+
+  taosMemoryFreeClear(pInfo->pSlots);
+  pInfo->depth = 0;
+}
+
+static int32_t doOpenReadAheadFileReader(STsdbReader* pReader, SReadAheadSlot* pSlot) {
+  STFileObj* pFileObj = pReader->status.pCurrentFileset->farr[TSDB_FTYPE_DATA];
+  if (pFileObj == NULL) {
+    return TSDB_CODE_INVALID_PARA;
+  }
+
+  SDataFileReaderConfig conf = {.tsdb = pReader->pTsdb, .szPage = pReader->pTsdb->pVnode->config.tsdbPageSize};
+  const char*           filesName[TSDB_FTYPE_MAX] = {0};
+
+  conf.files[TSDB_FTYPE_DATA].file = *pFileObj->f;
+  conf.files[TSDB_FTYPE_DATA].exist = true;
+  filesName[TSDB_FTYPE_DATA] = pFileObj->fname;
+
+  return tsdbDataFileReaderOpen(filesName, &conf, &pSlot->pFileReader);
+}
+
+static bool isBlockInReadAheadWindow(SDataBlockIter* pBlockIter, int32_t depth, const SBrinRecord* pRecord) {
+  int32_t step = ASCENDING_TRAVERSE(pBlockIter->order) ? 1 : -1;
+  for (int32_t i = 1, index = pBlockIter->index + step; i <= depth && index >= 0 && index < pBlockIter->numOfBlocks;
+       ++i, index += step) {
+    SFileDataBlockInfo* pBlockInfo = taosArrayGet(pBlockIter->blockList, index);
+    if (pBlockInfo->record.blockOffset == pRecord->blockOffset) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static SReadAheadSlot* getReadAheadSlot(SReadAheadInfo* pInfo, const SBrinRecord* pRecord) {
+  for (int32_t i = 0; i < pInfo->depth; ++i) {
+    SReadAheadSlot* pSlot = &pInfo->pSlots[i];
+    if (VNODE_ASYNC_VALID_TASK_ID(pSlot->taskId) && pSlot->record.blockOffset == pRecord->blockOffset &&
+        pSlot->record.uid == pRecord->uid) {
+      return pSlot;
+    }
+  }
+
+  return NULL;
+}
+
+// check if all of the columns in pCid are loaded by the slot, both of the lists are in ascending order.
+static bool isReadAheadSlotCovered(const SReadAheadSlot* pSlot, const int16_t* pCid, int32_t numOfCids) {
+  int32_t j = 0;
+  for (int32_t i = 0; i < numOfCids; ++i) {
+    while (j < pSlot->numOfCids && pSlot->pCid[j] < pCid[i]) {
+      j += 1;
+    }
+
+    if (j >= pSlot->numOfCids || pSlot->pCid[j] != pCid[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// the blocks are loaded ahead with the same columns as the current one, i.e., only the columns in filter if the late
+// materialization is applied, and the remain columns are loaded on demand.
+int32_t tsdbReadAheadSchedule(STsdbReader* pReader, const int16_t* pCid, int32_t numOfCids) {
+  SReadAheadInfo*     pInfo = &pReader->status.readAhead;
+  SDataBlockIter*     pBlockIter = &pReader->status.blockIter;
+  SBlockLoadSuppInfo* pSup = &pReader->suppInfo;
+  int32_t             step = ASCENDING_TRAVERSE(pBlockIter->order) ? 1 : -1;
+  int32_t             code = TSDB_CODE_SUCCESS;
+
+  if (pInfo->depth == 0 || pReader->info.pSchema == NULL || pReader->status.pCurrentFileset == NULL) {
+    return code;
+  }
+
+  // the file readers of slots are opened on the previous file set
+  if (pInfo->fid != pReader->status.pCurrentFileset->fid) {
+    tsdbReadAheadReset(pInfo, &pReader->cost);
+    pInfo->fid = pReader->status.pCurrentFileset->fid;
+  }
+
+  // release the slots of blocks that have been passed by, or skipped due to the reorder of block iterator.
+  for (int32_t i = 0; i < pInfo->depth; ++i) {
+    SReadAheadSlot* pSlot = &pInfo->pSlots[i];
+    if (VNODE_ASYNC_VALID_TASK_ID(pSlot->taskId) && !isBlockInReadAheadWindow(pBlockIter, pInfo->depth, &pSlot->record)) {
+      doReleaseReadAheadSlot(pSlot, &pReader->cost);
+    }
+  }
+
+  for (int32_t i = 1, index = pBlockIter->index + step; i <= pInfo->depth && index >= 0 && index < pBlockIter->numOfBlocks;
+       ++i, index += step) {
+    SFileDataBlockInfo* pBlockInfo = taosArrayGet(pBlockIter->blockList, index);
+    if (getReadAheadSlot(pInfo, &pBlockInfo->record) != NULL) {
+      continue;
+    }
+
+    SReadAheadSlot* pSlot = NULL;
+    for (int32_t j = 0; j < pInfo->depth; ++j) {
+      if (!VNODE_ASYNC_VALID_TASK_ID(pInfo->pSlots[j].taskId)) {
+        pSlot = &pInfo->pSlots[j];
+        break;
+      }
+    }
+
+    if (pSlot == NULL) {
+      break;
+    }
+
+    if (pSlot->pFileReader == NULL) {
+      code = doOpenReadAheadFileReader(pReader, pSlot);
+      if (code != TSDB_CODE_SUCCESS) {
+        tsdbWarn("%p failed to open file reader for read-ahead, code:%s, %s", pReader, tstrerror(code), pReader->idStr);
+        return code;
+      }
+    }
+
+    if (pSlot->pCid == NULL) {
+      pSlot->pCid = taosMemoryMalloc(pSup->numOfCols * sizeof(int16_t));
+      if (pSlot->pCid == NULL) {
+        return TSDB_CODE_OUT_OF_MEMORY;
+      }
+    }
+
+    pSlot->record = pBlockInfo->record;
+    pSlot->pSchema = pReader->info.pSchema;
+    pSlot->numOfCids = numOfCids;
+    memcpy(pSlot->pCid, pCid, numOfCids * sizeof(int16_t));
+    pSlot->code = TSDB_CODE_SUCCESS;
+    pSlot->ready = 0;
+
+    code = vnodeAsync(vnodeAsyncHandle[2], EVA_PRIORITY_NORMAL, doReadAheadBlock, NULL, pSlot, &pSlot->taskId);
+    if (code != TSDB_CODE_SUCCESS) {
+      pSlot->taskId = 0;
+      return code;
+    }
+
+    pReader->cost.readAheadBlocks += 1;
+  }
+
+  return code;
+}
+
+bool tsdbReadAheadFetch(STsdbReader* pReader, const SBrinRecord* pRecord, SBlockData* pBlockData, const int16_t* pCid,
+                        int32_t numOfCids) {
+  SReadAheadInfo* pInfo = &pReader->status.readAhead;
+  SReadAheadSlot* pSlot = getReadAheadSlot(pInfo, pRecord);
+  if (pSlot == NULL) {
+    return false;
+  }
+
+  // e.g., only the filter columns are loaded ahead, but all of the columns are required to merge the block
+  if (!isReadAheadSlotCovered(pSlot, pCid, numOfCids)) {
+    doReleaseReadAheadSlot(pSlot, &pReader->cost);
+    return false;
+  }
+
+  if (atomic_load_8(&pSlot->ready)) {
+    pReader->cost.readAheadHits += 1;
+  } else {
+    int64_t st = taosGetTimestampUs();
+    vnodeAWait(vnodeAsyncHandle[2], pSlot->taskId);
+    pReader->cost.readAheadWaitTime += (taosGetTimestampUs() - st) / 1000.0;
+    pReader->cost.readAheadWaits += 1;
+  }
+
+  pSlot->taskId = 0;
+  pSlot->ready = 0;
+
+  // load it again by the caller
+  if (pSlot->code != TSDB_CODE_SUCCESS) {
+    tsdbWarn("%p failed to load file block ahead, code:%s, %s", pReader, tstrerror(pSlot->code), pReader->idStr);
+    return false;
+  }
+
+  TSWAP(*pBlockData, pSlot->blockData);
+  return true;
+}
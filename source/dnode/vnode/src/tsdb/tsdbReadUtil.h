@@ -120,6 +120,14 @@ typedef struct SReadCostSummary {
   double  createScanInfoList;
   double  createSkylineIterTime;
   double  initSttBlockReader;
+  int64_t lateMatBlocks;      // file blocks loaded in two phases, the filter columns first
+  int64_t lateMatSkipBlocks;  // file blocks of which the remain columns are skipped since no rows qualified
+  int64_t lateMatSkipCols;    // total number of skipped column loads
+  int64_t readAheadBlocks;    // file blocks scheduled to be loaded ahead
+  int64_t readAheadHits;      // prefetched file blocks that are ready when required
+  int64_t readAheadWaits;     // prefetched file blocks that are still in loading when required
+  int64_t readAheadDiscards;  // prefetched file blocks that are not used
+  double  readAheadWaitTime;
 } SReadCostSummary;
 
 typedef struct STableUidList {
@@ -147,6 +155,7 @@ typedef struct SBlockOrderSupporter {
 
 typedef struct SBlockLoadSuppInfo {
   TColumnDataAggArray colAggArray;
+  TColumnDataIdxArray colIdxArray;  // bloom filters and zones of the current block, referred by colAggArray
   SColumnDataAgg      tsColAgg;
   int16_t*            colId;
   int16_t*            slotId;
@@ -196,6 +205,36 @@ typedef struct SFileBlockDumpInfo {
   bool    allDumped;
 } SFileBlockDumpInfo;
 
+// late materialization: load the filter columns of a file block first, and the remain columns only if there are
+// qualified rows after the filter is applied.
+typedef struct SLateMatInfo {
+  bool     pending;    // the remain columns of the dumped rows are not loaded yet
+  bool*    pMask;      // pMask[i] is true if the i-th column in SBlockLoadSuppInfo should be copied in current phase
+  int16_t* pCid;       // tmp buffer for the column id list to be loaded
+  int32_t  rowIndex;   // start position of the dumped rows in the file block
+  int32_t  numOfRows;  // number of dumped rows
+  int32_t  code;       // error of loading the remain columns when the reader is suspended
+} SLateMatInfo;
+
+// file blocks that are loaded and decompressed ahead by the read-ahead workers, in the block access order.
+typedef struct SReadAheadSlot {
+  int64_t          taskId;       // the task in read-ahead async handle, 0 means the slot is idle
+  SBrinRecord      record;       // the data block to load, identified by the block offset in data file
+  STSchema*        pSchema;
+  int16_t*         pCid;       // the columns to load, in ascending order
+  int32_t          numOfCids;
+  SDataFileReader* pFileReader;  // each slot owns a file reader, since the data file reader is not thread safe
+  SBlockData       blockData;
+  int32_t          code;
+  int8_t           ready;  // set by the worker when the block is loaded
+} SReadAheadSlot;
+
+typedef struct SReadAheadInfo {
+  int32_t         depth;  // number of slots, 0 means read-ahead is disabled
+  int32_t         fid;    // the file set that file readers of slots are opened on
+  SReadAheadSlot* pSlots;
+} SReadAheadInfo;
+
 typedef struct SReaderStatus {
   bool                  suspendInvoked;
   bool                  loadFromFile;       // check file stage
@@ -206,6 +245,8 @@ typedef struct SReaderStatus {
   SFileBlockDumpInfo    fBlockDumpInfo;
   STFileSet*            pCurrentFileset;  // current opened file set
   SBlockData            fileBlockData;
+  SLateMatInfo          lateMatInfo;
+  SReadAheadInfo        readAhead;
   SFilesetIter          fileIter;
   SDataBlockIter        blockIter;
   SArray*               pLDataIterArray;
@@ -282,6 +323,14 @@ void         clearBrinBlockIter(SBrinRecordIter* pIter);
 int32_t initBlockIterator(STsdbReader* pReader, SDataBlockIter* pBlockIter, int32_t numOfBlocks, SArray* pTableList);
 bool    blockIteratorNext(SDataBlockIter* pBlockIter, const char* idStr);
 
+// read-ahead API, the data blocks following the current one in block iterator are loaded by background workers
+int32_t tsdbReadAheadInit(SReadAheadInfo* pInfo, int32_t depth);
+void    tsdbReadAheadReset(SReadAheadInfo* pInfo, SReadCostSummary* pCost);
+void    tsdbReadAheadDestroy(SReadAheadInfo* pInfo, SReadCostSummary* pCost);
+int32_t tsdbReadAheadSchedule(STsdbReader* pReader, const int16_t* pCid, int32_t numOfCids);
+bool    tsdbReadAheadFetch(STsdbReader* pReader, const SBrinRecord* pRecord, SBlockData* pBlockData, const int16_t* pCid,
+                           int32_t numOfCids);
+
 // load tomb data API (stt/mem only for one table each, tomb data from data files are load for all tables at one time)
 void    loadMemTombData(SArray** ppMemDelData, STbData* pMemTbData, STbData* piMemTbData, int64_t ver);
 int32_t loadDataFileTombDataForAll(STsdbReader* pReader);
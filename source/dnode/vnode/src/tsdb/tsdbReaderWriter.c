@@ -73,6 +73,13 @@ static int32_t tsdbOpenFileImpl(STsdbFD *pFD) {
     goto _exit;
   }
 
+  if (flag == TD_FILE_READ) {
+    tsdbPageCacheAttach(pFD);
+  } else {
+    // the last page of a file may be rewritten when data is appended to it
+    tsdbPageCacheRemoveFile(path);
+  }
+
   // not check file size when reading data files.
   if (flag != TD_FILE_READ && !pFD->s3File) {
     if (taosStatFile(path, &pFD->szFile, NULL, NULL) < 0) {
@@ -123,7 +130,12 @@ void tsdbCloseFile(STsdbFD **ppFD) {
   STsdbFD *pFD = *ppFD;
   if (pFD) {
     taosMemoryFree(pFD->pBuf);
+    taosMemoryFree(pFD->pPgBuf);
     if (!pFD->s3File) {
+      if (pFD->pFD != NULL && pFD->flag != TD_FILE_READ) {
+        // readers opened while the file was written may have cached its old last page
+        tsdbPageCacheRemoveFile(pFD->path);
+      }
       taosCloseFile(&pFD->pFD);
     }
     taosMemoryFree(pFD);
@@ -202,6 +214,10 @@ static int32_t tsdbReadFilePage(STsdbFD *pFD, int64_t pgno) {
     memcpy(pFD->pBuf, pBlock + (offset - blk_offset), pFD->szPage);
 
     tsdbCacheRelease(pFD->pTsdb->bCache, handle);
+  } else if (pFD->pcId != 0 && pgno > 1 && tsdbPageCacheGet(pFD, pgno, pFD->pBuf)) {
+    // checked before put into cache
+    pFD->pgno = pgno;
+    goto _exit;
   } else {
     // seek
     int64_t n = taosLSeekFile(pFD->pFD, offset, SEEK_SET);
@@ -226,6 +242,9 @@ static int32_t tsdbReadFilePage(STsdbFD *pFD, int64_t pgno) {
     code = TSDB_CODE_FILE_CORRUPTED;
     goto _exit;
   }
+  if (pFD->pcId != 0 && pgno > 1) {
+    tsdbPageCachePut(pFD, pgno, pFD->pBuf);
+  }
 
   pFD->pgno = pgno;
 
@@ -265,6 +284,100 @@ _exit:
   return code;
 }
 
+// read pages [pgno, pgnoEnd] with one submission instead of a seek and a read for each page, pages found in page
+// cache are skipped and each run of pages between them is one request of the submission
+static int32_t tsdbReadFilePages(STsdbFD *pFD, int64_t pgno, int64_t pgnoEnd, int64_t bOffset, uint8_t *pBuf,
+                                 int64_t size) {
+  int32_t     code = 0;
+  int64_t     n = 0;
+  int32_t     szPgCont = PAGE_CONTENT_SIZE(pFD->szPage);
+  int64_t     nPage = pgnoEnd - pgno + 1;
+  int64_t     szRead = nPage * pFD->szPage;
+  SFileIoReq  req = {0};
+  SFileIoReq *aReq = &req;
+  int32_t     nReq = 0;
+  bool       *aHit = NULL;
+
+  if (pFD->szPgBuf < szRead) {
+    uint8_t *pPgBuf = taosMemoryRealloc(pFD->pPgBuf, szRead);
+    if (pPgBuf == NULL) {
+      code = TSDB_CODE_OUT_OF_MEMORY;
+      goto _exit;
+    }
+    pFD->pPgBuf = pPgBuf;
+    pFD->szPgBuf = szRead;
+  }
+
+  if (pFD->pcId != 0) {
+    aHit = taosMemoryCalloc(nPage, sizeof(bool));
+    aReq = taosMemoryCalloc((nPage + 1) / 2, sizeof(SFileIoReq));
+    if (aHit == NULL || aReq == NULL) {
+      code = TSDB_CODE_OUT_OF_MEMORY;
+      goto _exit;
+    }
+    for (int64_t i = 0; i < nPage; i++) {
+      aHit[i] = pgno + i > 1 && tsdbPageCacheGet(pFD, pgno + i, pFD->pPgBuf + i * pFD->szPage);
+    }
+  }
+
+  for (int64_t i = 0; i < nPage;) {
+    if (aHit != NULL && aHit[i]) {
+      i++;
+      continue;
+    }
+    int64_t j = i + 1;
+    while (j < nPage && (aHit == NULL || !aHit[j])) j++;
+    aReq[nReq++] = (SFileIoReq){.pFile = pFD->pFD,
+                                .write = false,
+                                .buf = pFD->pPgBuf + i * pFD->szPage,
+                                .count = (j - i) * pFD->szPage,
+                                .offset = PAGE_OFFSET(pgno + i, pFD->szPage)};
+    i = j;
+  }
+
+  if (nReq > 0 && taosFileIoSubmit(aReq, nReq, false) < 0) {
+    code = TAOS_SYSTEM_ERROR(errno);
+    goto _exit;
+  }
+  // short transfers are completed by the os layer, a read still short has reached the end of file
+  for (int32_t i = 0; i < nReq; i++) {
+    if (aReq[i].ret < aReq[i].count) {
+      code = TSDB_CODE_FILE_CORRUPTED;
+      goto _exit;
+    }
+  }
+
+  for (int64_t iPg = pgno; iPg <= pgnoEnd; iPg++) {
+    uint8_t *pPage = pFD->pPgBuf + (iPg - pgno) * pFD->szPage;
+
+    // check
+    if (aHit == NULL || !aHit[iPg - pgno]) {
+      if (iPg > 1 && !taosCheckChecksumWhole(pPage, pFD->szPage)) {
+        code = TSDB_CODE_FILE_CORRUPTED;
+        goto _exit;
+      }
+      if (pFD->pcId != 0 && iPg > 1) {
+        tsdbPageCachePut(pFD, iPg, pPage);
+      }
+    }
+
+    int64_t nRead = TMIN(szPgCont - bOffset, size - n);
+    memcpy(pBuf + n, pPage + bOffset, nRead);
+
+    n += nRead;
+    bOffset = 0;
+  }
+
+  // keep the last page cached as tsdbReadFilePage does
+  memcpy(pFD->pBuf, pFD->pPgBuf + (pgnoEnd - pgno) * pFD->szPage, pFD->szPage);
+  pFD->pgno = pgnoEnd;
+
+_exit:
+  taosMemoryFree(aHit);
+  if (aReq != &req) taosMemoryFree(aReq);
+  return code;
+}
+
 static int32_t tsdbReadFileImp(STsdbFD *pFD, int64_t offset, uint8_t *pBuf, int64_t size) {
   int32_t code = 0;
   int64_t n = 0;
@@ -276,6 +389,13 @@ static int32_t tsdbReadFileImp(STsdbFD *pFD, int64_t offset, uint8_t *pBuf, int6
   // ASSERT(pgno && pgno <= pFD->szFile);
   ASSERT(bOffset < szPgCont);
 
+  if (!pFD->s3File && pFD->pgno != pgno && taosFileIoUringEnabled()) {
+    int64_t pgnoEnd = OFFSET_PGNO(LOGIC_TO_FILE_OFFSET(offset + size - 1, pFD->szPage), pFD->szPage);
+    if (pgnoEnd > pgno) {
+      return tsdbReadFilePages(pFD, pgno, pgnoEnd, bOffset, pBuf, size);
+    }
+  }
+
   while (n < size) {
     if (pFD->pgno != pgno) {
       code = tsdbReadFilePage(pFD, pgno);
@@ -1268,7 +1388,7 @@ int32_t tsdbReadBlockSma(SDataFReader *pReader, SDataBlk *pDataBlk, SArray *aCol
   // decode
   int32_t n = 0;
   while (n < pSmaInfo->size) {
-    SColumnDataAgg sma;
+    SColumnDataAgg sma = {0};
     n += tGetColumnDataAgg(pReader->aBuf[0] + n, &sma);
 
     if (taosArrayPush(aColumnDataAgg, &sma) == NULL) {
@@ -1534,6 +1534,133 @@ int32_t tGetColumnDataAgg(uint8_t *p, SColumnDataAgg *pColAgg) {
   n += tGetI64(p + n, &pColAgg->sum);
   n += tGetI64(p + n, &pColAgg->max);
   n += tGetI64(p + n, &pColAgg->min);
+  pColAgg->pIdx = NULL;
+
+  return n;
+}
+
+// SColumnDataIdx ======================================================
+static int32_t tColDataIdxCompare(const uint8_t *pData1, uint32_t nData1, const uint8_t *pData2, uint32_t nData2) {
+  int32_t c = memcmp(pData1, pData2, TMIN(nData1, nData2));
+  if (c) return c;
+  return (nData1 < nData2) ? -1 : ((nData1 > nData2) ? 1 : 0);
+}
+
+int32_t tColDataCalcIdx(SColData *pColData, SColumnDataIdx *pIdx) {
+  bool     isVar = IS_VAR_DATA_TYPE(pColData->type);
+  uint8_t *pMin = NULL;
+  uint8_t *pMax = NULL;
+  uint32_t nMin = 0;
+  uint32_t nMax = 0;
+
+  memset(pIdx, 0, sizeof(*pIdx));
+  pIdx->colId = pColData->cid;
+  pIdx->pBloom = tBloomFilterInit(pColData->nVal, TSDB_BLOCK_BLOOM_ERROR_RATE);
+  if (pIdx->pBloom == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+
+  for (int32_t iVal = 0; iVal < pColData->nVal; iVal++) {
+    if (tColDataGetBitValue(pColData, iVal) != 2) continue;
+
+    uint8_t *pData;
+    uint32_t nData;
+    if (isVar) {
+      pData = pColData->pData + pColData->aOffset[iVal];
+      nData = ((iVal + 1 < pColData->nVal) ? pColData->aOffset[iVal + 1] : pColData->nData) - pColData->aOffset[iVal];
+    } else {
+      pData = pColData->pData + tDataTypes[pColData->type].bytes * iVal;
+      nData = tDataTypes[pColData->type].bytes;
+    }
+
+    tBloomFilterPut(pIdx->pBloom, pData, nData);
+
+    if (isVar) {
+      if (pMin == NULL || tColDataIdxCompare(pData, nData, pMin, nMin) < 0) {
+        pMin = pData;
+        nMin = nData;
+      }
+      if (pMax == NULL || tColDataIdxCompare(pData, nData, pMax, nMax) > 0) {
+        pMax = pData;
+        nMax = nData;
+      }
+    }
+  }
+
+  // the zone keeps prefixes only, a truncated min is still a lower bound while a truncated max is not an upper bound
+  // of the values in the block
+  if (pMin) {
+    pIdx->hasZone = 1;
+    pIdx->minLen = TMIN(nMin, TSDB_COL_ZONE_PREFIX_LEN);
+    pIdx->maxLen = TMIN(nMax, TSDB_COL_ZONE_PREFIX_LEN);
+    pIdx->minTrunc = (nMin > TSDB_COL_ZONE_PREFIX_LEN) ? 1 : 0;
+    pIdx->maxTrunc = (nMax > TSDB_COL_ZONE_PREFIX_LEN) ? 1 : 0;
+    memcpy(pIdx->minPrefix, pMin, pIdx->minLen);
+    memcpy(pIdx->maxPrefix, pMax, pIdx->maxLen);
+  }
+
+  return 0;
+}
+
+void tColumnDataIdxClear(SColumnDataIdx *pIdx) {
+  tBloomFilterDestroy(pIdx->pBloom);
+  pIdx->pBloom = NULL;
+}
+
+int32_t tPutColumnDataIdx(uint8_t *p, SColumnDataIdx *pIdx) {
+  int32_t n = 0;
+
+  n += tPutI16v(p ? p + n : p, pIdx->colId);
+  n += tPutI8(p ? p + n : p, pIdx->hasZone);
+  if (pIdx->hasZone) {
+    n += tPutI8(p ? p + n : p, pIdx->minTrunc);
+    n += tPutI8(p ? p + n : p, pIdx->maxTrunc);
+    n += tPutBinary(p ? p + n : p, (uint8_t *)pIdx->minPrefix, pIdx->minLen);
+    n += tPutBinary(p ? p + n : p, (uint8_t *)pIdx->maxPrefix, pIdx->maxLen);
+  }
+
+  SEncoder encoder = {0};
+  tEncoderInit(&encoder, NULL, 0);
+  tBloomFilterEncode(pIdx->pBloom, &encoder);
+  uint32_t nBloom = encoder.pos;
+  tEncoderClear(&encoder);
+
+  n += tPutU32v(p ? p + n : p, nBloom);
+  if (p) {
+    tEncoderInit(&encoder, p + n, nBloom);
+    tBloomFilterEncode(pIdx->pBloom, &encoder);
+    tEncoderClear(&encoder);
+  }
+  n += nBloom;
+
+  return n;
+}
+
+int32_t tGetColumnDataIdx(uint8_t *p, SColumnDataIdx *pIdx) {
+  int32_t  n = 0;
+  uint8_t *pData;
+  uint32_t nData;
+
+  memset(pIdx, 0, sizeof(*pIdx));
+  n += tGetI16v(p + n, &pIdx->colId);
+  n += tGetI8(p + n, &pIdx->hasZone);
+  if (pIdx->hasZone) {
+    n += tGetI8(p + n, &pIdx->minTrunc);
+    n += tGetI8(p + n, &pIdx->maxTrunc);
+    n += tGetBinary(p + n, &pData, &nData);
+    pIdx->minLen = TMIN(nData, TSDB_COL_ZONE_PREFIX_LEN);
+    memcpy(pIdx->minPrefix, pData, pIdx->minLen);
+    n += tGetBinary(p + n, &pData, &nData);
+    pIdx->maxLen = TMIN(nData, TSDB_COL_ZONE_PREFIX_LEN);
+    memcpy(pIdx->maxPrefix, pData, pIdx->maxLen);
+  }
+
+  n += tGetU32v(p + n, &nData);
+  if (nData > 0) {
+    SDecoder decoder = {0};
+    tDecoderInit(&decoder, p + n, nData);
+    pIdx->pBloom = tBloomFilterDecode(&decoder);
+    tDecoderClear(&decoder);
+  }
+  n += nData;
 
   return n;
 }
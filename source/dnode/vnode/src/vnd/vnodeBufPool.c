@@ -26,6 +26,12 @@ static int vnodeBufPoolCreate(SVnode *pVnode, int32_t id, int64_t size, SVBufPoo
   }
   memset(pPool, 0, sizeof(SVBufPool));
 
+  // the pages are moved to the node before the write threads of the vnode touch them
+  if (pVnode->numaNode >= 0 && taosBindMemoryNumaNode(pPool, sizeof(SVBufPool) + size, pVnode->numaNode) != 0) {
+    vWarn("vgId:%d, failed to bind buffer pool %d to numa node:%d since %s", TD_VID(pVnode), id, pVnode->numaNode,
+          terrstr());
+  }
+
   // query handle list
   taosThreadMutexInit(&pPool->mutex, NULL);
   pPool->nQuery = 0;
@@ -40,7 +46,7 @@ static int vnodeBufPoolCreate(SVnode *pVnode, int32_t id, int64_t size, SVBufPoo
   pPool->node.pnext = &pPool->pTail;
   pPool->node.size = size;
 
-  if (VND_IS_RSMA(pVnode)) {
+  if (VND_IS_RSMA(pVnode) || tsNumOfVnodeWriteShards > 1) {
     pPool->lock = taosMemoryMalloc(sizeof(TdThreadSpinlock));
     if (!pPool->lock) {
       taosMemoryFree(pPool);
@@ -193,6 +199,70 @@ void *vnodeBufPoolMalloc(SVBufPool *pPool, int size) {
   return p;
 }
 
+void vnodeBufPoolArenaInit(SVBufPoolArena *pArena, SVBufPool *pPool) {
+  pArena->pPool = pPool;
+  pArena->ptr = NULL;
+  pArena->end = NULL;
+}
+
+void *vnodeBufPoolArenaMalloc(SVBufPoolArena *pArena, int size) {
+  void *p;
+
+  if (size > VNODE_BUFPOOL_ARENA_CHUNK / 4) {
+    // large allocations go to the pool directly so the arena chunk is not wasted
+    return vnodeBufPoolMalloc(pArena->pPool, size);
+  }
+
+  if (pArena->end - pArena->ptr < size) {
+    vnodeBufPoolArenaClear(pArena);
+    pArena->ptr = vnodeBufPoolMallocAligned(pArena->pPool, VNODE_BUFPOOL_ARENA_CHUNK);
+    if (pArena->ptr == NULL) {
+      pArena->end = NULL;
+      return NULL;
+    }
+    pArena->end = pArena->ptr + VNODE_BUFPOOL_ARENA_CHUNK;
+  }
+
+  p = pArena->ptr;
+  pArena->ptr += size;
+  return p;
+}
+
+void *vnodeBufPoolArenaMallocAligned(SVBufPoolArena *pArena, int size) {
+  if (size > VNODE_BUFPOOL_ARENA_CHUNK / 4) {
+    return vnodeBufPoolMallocAligned(pArena->pPool, size);
+  }
+
+  if (pArena->ptr) {
+    int paddingLen = (((long)pArena->ptr + 7) & ~7) - (long)pArena->ptr;
+    if (pArena->end - pArena->ptr >= size + paddingLen) {
+      pArena->ptr += paddingLen;
+    } else {
+      vnodeBufPoolArenaClear(pArena);
+    }
+  }
+
+  // chunks are 8 bytes aligned, so the first allocation from a new chunk is aligned too
+  return vnodeBufPoolArenaMalloc(pArena, size);
+}
+
+void vnodeBufPoolArenaClear(SVBufPoolArena *pArena) {
+  SVBufPool *pPool = pArena->pPool;
+
+  if (pArena->ptr == NULL) return;
+
+  // give the unused tail back if the chunk is still the last piece cut from the anchor node
+  if (pPool->lock) taosThreadSpinLock(pPool->lock);
+  if (pPool->ptr == pArena->end) {
+    pPool->size -= (pArena->end - pArena->ptr);
+    pPool->ptr = pArena->ptr;
+  }
+  if (pPool->lock) taosThreadSpinUnlock(pPool->lock);
+
+  pArena->ptr = NULL;
+  pArena->end = NULL;
+}
+
 void vnodeBufPoolFree(SVBufPool *pPool, void *p) {
   // uint8_t       *ptr = (uint8_t *)p;
   // SVBufPoolNode *pNode;
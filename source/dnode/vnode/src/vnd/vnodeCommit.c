@@ -30,6 +30,19 @@ static int vnodeCommitImpl(SCommitInfo *pInfo);
 
 #define WAIT_TIME_MILI_SEC 10  // miliseconds
 
+#define VNODE_WRITE_STALL_MIN_US     1000    // waits shorter than this are not counted as stalls
+#define VNODE_WRITE_RATE_SAMPLE_US   100000  // interval the ingest rate is sampled at
+#define VNODE_COMMIT_EARLY_MIN_RATIO 0.5     // never commit a pool filled less than this early
+#define VNODE_WRITE_DELAY_RATIO      0.75    // writes are delayed once the pool in use is filled past this
+
+void vnodeRecordWriteStall(SVnode *pVnode, int64_t us) {
+  if (us < VNODE_WRITE_STALL_MIN_US) return;
+
+  atomic_add_fetch_64(&pVnode->writeStall.nStall, 1);
+  atomic_add_fetch_64(&pVnode->writeStall.stallUs, us);
+  vDebug("vgId:%d, write stalled for %" PRId64 "us on buffer pool", TD_VID(pVnode), us);
+}
+
 static int32_t vnodeTryRecycleBufPool(SVnode *pVnode) {
   int32_t code = 0;
 
@@ -64,10 +77,11 @@ _exit:
 static int32_t vnodeGetBufPoolToUse(SVnode *pVnode) {
   int32_t code = 0;
   int32_t lino = 0;
+  int32_t nTry = 0;
+  int64_t st = taosGetTimestampUs();
 
   taosThreadMutexLock(&pVnode->mutex);
 
-  int32_t nTry = 0;
   for (;;) {
     ++nTry;
 
@@ -79,6 +93,7 @@ static int32_t vnodeGetBufPoolToUse(SVnode *pVnode) {
       pVnode->inUse->nRef = 1;
       pVnode->freeList = pVnode->inUse->freeNext;
       pVnode->inUse->freeNext = NULL;
+      pVnode->writeStall.earlyPool = NULL;
       break;
     } else {
       vDebug("vgId:%d, no free buffer pool on %d try, try to recycle...", TD_VID(pVnode), nTry);
@@ -111,6 +126,7 @@ static int32_t vnodeGetBufPoolToUse(SVnode *pVnode) {
 
 _exit:
   taosThreadMutexUnlock(&pVnode->mutex);
+  vnodeRecordWriteStall(pVnode, taosGetTimestampUs() - st);
   if (code) {
     vError("vgId:%d, %s failed at line %d since %s", TD_VID(pVnode), __func__, lino, tstrerror(code));
   }
@@ -150,6 +166,35 @@ _exit:
   return code;
 }
 
+/*
+ * Called with pVnode->mutex held. Commit the pool in use before it is full when, at the smoothed rates, the rest of it
+ * would fill sooner than what it already holds can be committed. Waiting for it to fill would start a commit which
+ * outlasts the filling of the next pool, and the apply thread then stalls behind it.
+ */
+static bool vnodeShouldCommitEarly(SVnode *pVnode) {
+  SVWriteStall *pStall = &pVnode->writeStall;
+  SVBufPool    *pPool = pVnode->inUse;
+  int64_t       now = taosGetTimestampUs();
+
+  if (pStall->sampleUs == 0 || pPool->size < pStall->sampleSize) {
+    // first sample, or a new pool is in use
+    pStall->sampleUs = now;
+    pStall->sampleSize = pPool->size;
+  } else if (now - pStall->sampleUs >= VNODE_WRITE_RATE_SAMPLE_US) {
+    int64_t rate = (pPool->size - pStall->sampleSize) * 1000000 / (now - pStall->sampleUs);
+    pStall->ingestRate = (pStall->ingestRate > 0) ? (pStall->ingestRate * 3 + rate) / 4 : rate;
+    pStall->sampleUs = now;
+    pStall->sampleSize = pPool->size;
+  }
+
+  // a commit in flight would block the early one, and one early commit per pool is enough
+  if (pVnode->onCommit != NULL || pStall->earlyPool == pPool) return false;
+  if (pStall->ingestRate <= 0 || pStall->commitRate <= 0) return false;
+  if (pPool->size < pPool->node.size * VNODE_COMMIT_EARLY_MIN_RATIO) return false;
+
+  return (double)(pPool->node.size - pPool->size) * pStall->commitRate < (double)pPool->size * pStall->ingestRate;
+}
+
 int vnodeShouldCommit(SVnode *pVnode, bool atExit) {
   bool diskAvail = osDataSpaceAvailable();
   bool needCommit = false;
@@ -158,11 +203,58 @@ int vnodeShouldCommit(SVnode *pVnode, bool atExit) {
   if (pVnode->inUse && diskAvail) {
     needCommit = (pVnode->inUse->size > pVnode->inUse->node.size) ||
                  (atExit && (pVnode->inUse->size > 0 || pVnode->pMeta->changed));
+
+    if (!needCommit && tsVnodeAdaptiveCommit && vnodeShouldCommitEarly(pVnode)) {
+      vDebug("vgId:%d, commit early, buffer pool used:%" PRId64 " size:%" PRId64 " ingest:%" PRId64
+             "B/s commit:%" PRId64 "B/s",
+             TD_VID(pVnode), pVnode->inUse->size, pVnode->inUse->node.size, pVnode->writeStall.ingestRate,
+             pVnode->writeStall.commitRate);
+      pVnode->writeStall.earlyPool = pVnode->inUse;
+      pVnode->writeStall.nEarlyCommit++;
+      needCommit = true;
+    }
   }
   taosThreadMutexUnlock(&pVnode->mutex);
   return needCommit;
 }
 
+/*
+ * Called with pVnode->mutex held, before a submit is proposed. Once the pool in use is filled past
+ * VNODE_WRITE_DELAY_RATIO while the previous commit still runs, filling it up would block the apply thread until that
+ * commit ends. Each write is delayed instead, in proportion to how close the pool is to full and up to
+ * vnodeWriteMaxDelay, which spreads the wait over the writes and lets the commit catch up.
+ */
+int64_t vnodeGetWriteDelay(SVnode *pVnode) {
+  int64_t delayUs = 0;
+
+  if (tsVnodeWriteMaxDelay > 0 && pVnode->inUse && pVnode->onCommit && pVnode->inUse->node.size > 0) {
+    double ratio = (double)pVnode->inUse->size / pVnode->inUse->node.size;
+    if (ratio > VNODE_WRITE_DELAY_RATIO) {
+      ratio = TMIN((ratio - VNODE_WRITE_DELAY_RATIO) / (1 - VNODE_WRITE_DELAY_RATIO), 1.0);
+      delayUs = (int64_t)(ratio * tsVnodeWriteMaxDelay * 1000);
+    }
+  }
+
+  return delayUs;
+}
+
+void vnodeGetWriteStallLoad(SVnode *pVnode, SVnodeLoad *pLoad) {
+  taosThreadMutexLock(&pVnode->mutex);
+  pLoad->bufferUsed = pVnode->inUse ? pVnode->inUse->size : 0;
+  pLoad->numOfFreeBufPools = 0;
+  for (SVBufPool *pPool = pVnode->freeList; pPool; pPool = pPool->freeNext) {
+    pLoad->numOfFreeBufPools++;
+  }
+  pLoad->earlyCommits = pVnode->writeStall.nEarlyCommit;
+  taosThreadMutexUnlock(&pVnode->mutex);
+
+  pLoad->bufferSize = pVnode->config.szBuf;
+  pLoad->writeStalls = atomic_load_64(&pVnode->writeStall.nStall);
+  pLoad->writeStallTime = atomic_load_64(&pVnode->writeStall.stallUs) / 1000;
+  pLoad->writeDelays = atomic_load_64(&pVnode->writeStall.nDelay);
+  pLoad->writeDelayTime = atomic_load_64(&pVnode->writeStall.delayUs) / 1000;
+}
+
 int vnodeSaveInfo(const char *dir, const SVnodeInfo *pInfo) {
   char      fname[TSDB_FILENAME_LEN];
   TdFilePtr pFile;
@@ -287,8 +379,10 @@ static int32_t vnodePrepareCommit(SVnode *pVnode, SCommitInfo *pInfo) {
   char    dir[TSDB_FILENAME_LEN] = {0};
   int64_t lastCommitted = pInfo->info.state.committed;
 
-  // wait last commit task
+  // wait last commit task, the apply thread stalls if it is still running
+  int64_t st = taosGetTimestampUs();
   vnodeAWait(vnodeAsyncHandle[0], pVnode->commitTask);
+  vnodeRecordWriteStall(pVnode, taosGetTimestampUs() - st);
 
   if (syncNodeGetConfig(pVnode->sync, &pVnode->config.syncCfg) != 0) goto _exit;
 
@@ -366,7 +460,12 @@ static int32_t vnodeCommitTask(void *arg) {
   SCommitInfo *pInfo = (SCommitInfo *)arg;
   SVnode      *pVnode = pInfo->pVnode;
 
+  // commit threads are shared, the one picking the task moves to the node of the vnode
+  if (pVnode->numaNode >= 0) (void)taosSetThreadNumaNode(pVnode->numaNode);
+
   // commit
+  int64_t size = pVnode->onCommit->size;
+  int64_t st = taosGetTimestampUs();
   code = vnodeCommitImpl(pInfo);
   if (code) {
     vFatal("vgId:%d, failed to commit vnode since %s", TD_VID(pVnode), terrstr());
@@ -375,6 +474,16 @@ static int32_t vnodeCommitTask(void *arg) {
     goto _exit;
   }
 
+  // commit throughput, for the early commit trigger
+  int64_t elapsed = taosGetTimestampUs() - st;
+  if (size > 0 && elapsed > 0) {
+    int64_t rate = size * 1000000 / elapsed;
+    taosThreadMutexLock(&pVnode->mutex);
+    pVnode->writeStall.commitRate =
+        (pVnode->writeStall.commitRate > 0) ? (pVnode->writeStall.commitRate * 3 + rate) / 4 : rate;
+    taosThreadMutexUnlock(&pVnode->mutex);
+  }
+
   vnodeReturnBufPool(pVnode);
 
 _exit:
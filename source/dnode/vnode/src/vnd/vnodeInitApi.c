@@ -48,6 +48,7 @@ void initTsdbReaderAPI(TsdReader* pReader) {
   pReader->tsdNextDataBlock = tsdbNextDataBlock2;
 
   pReader->tsdReaderRetrieveDataBlock = tsdbRetrieveDataBlock2;
+  pReader->tsdReaderRetrieveRemainColumns = tsdbRetrieveRemainColumns2;
   pReader->tsdReaderReleaseDataBlock = tsdbReleaseDataBlock2;
 
   pReader->tsdReaderRetrieveBlockSMAInfo = tsdbRetrieveDatablockSMA2;
@@ -57,6 +58,7 @@ void initTsdbReaderAPI(TsdReader* pReader) {
 
   pReader->tsdReaderGetDataBlockDistInfo = tsdbGetFileBlocksDistInfo2;
   pReader->tsdReaderGetNumOfInMemRows = tsdbGetNumOfRowsInMemTable2;  // todo this function should be moved away
+  pReader->tsdReaderGetReadAheadStat = tsdbReaderGetReadAheadStat2;
 
   pReader->tsdSetQueryTableList = tsdbSetTableList2;
   pReader->tsdSetReaderTaskId = (void (*)(void*, const char*))tsdbReaderSetId2;
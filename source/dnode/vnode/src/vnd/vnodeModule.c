@@ -18,7 +18,8 @@
 
 static volatile int32_t VINIT = 0;
 
-SVAsync* vnodeAsyncHandle[2];
+SVAsync* vnodeAsyncHandle[4];
+void*    vnodeTimer = NULL;
 
 int vnodeInit(int nthreads) {
   int32_t init;
@@ -36,10 +37,28 @@ int vnodeInit(int nthreads) {
   vnodeAsyncInit(&vnodeAsyncHandle[1], "vnode-merge");
   vnodeAsyncSetWorkers(vnodeAsyncHandle[1], nthreads);
 
+  // vnode-read-ahead
+  vnodeAsyncInit(&vnodeAsyncHandle[2], "vnode-read-ahead");
+  vnodeAsyncSetWorkers(vnodeAsyncHandle[2], tsNumOfQueryReadAheadThreads);
+
+  // vnode-write-shard
+  vnodeAsyncInit(&vnodeAsyncHandle[3], "vnode-write-shard");
+  vnodeAsyncSetWorkers(vnodeAsyncHandle[3], tsNumOfVnodeWriteShards);
+
+  // timer of the writes deferred on write pressure
+  vnodeTimer = taosTmrInit(TSDB_MAX_VNODES_PER_DB, MSECONDS_PER_TICK, 10000, "VND-TMR");
+  if (vnodeTimer == NULL) {
+    return -1;
+  }
+
   if (walInit() < 0) {
     return -1;
   }
 
+  if (tsdbPageCacheOpen((int64_t)tsTsdbPageCacheSize * 1024 * 1024) != 0) {
+    return -1;
+  }
+
   return 0;
 }
 
@@ -50,7 +69,12 @@ void vnodeCleanup() {
   // set stop
   vnodeAsyncDestroy(&vnodeAsyncHandle[0]);
   vnodeAsyncDestroy(&vnodeAsyncHandle[1]);
+  vnodeAsyncDestroy(&vnodeAsyncHandle[2]);
+  vnodeAsyncDestroy(&vnodeAsyncHandle[3]);
+  taosTmrCleanUp(vnodeTimer);
+  vnodeTimer = NULL;
 
   walCleanUp();
   smaCleanUp();
+  tsdbPageCacheClose();
 }
@@ -330,6 +330,33 @@ static int32_t vnodeCheckDisk(int32_t diskPrimary, STfs *pTfs) {
   return 0;
 }
 
+// vnodes opened on this dnode per NUMA node, a new vnode goes to the node with the fewest
+static int32_t vnodeNumaLoad[64] = {0};
+
+static int32_t vnodeNumaAcquire() {
+  int32_t numOfNodes = TMIN(taosGetNumOfNumaNodes(), tListLen(vnodeNumaLoad));
+  if (!tsVnodeNumaBind || numOfNodes <= 1) return -1;
+
+  while (1) {
+    int32_t node = 0;
+    int32_t load = atomic_load_32(&vnodeNumaLoad[0]);
+    for (int32_t i = 1; i < numOfNodes; ++i) {
+      int32_t cur = atomic_load_32(&vnodeNumaLoad[i]);
+      if (cur < load) {
+        node = i;
+        load = cur;
+      }
+    }
+    if (atomic_val_compare_exchange_32(&vnodeNumaLoad[node], load, load + 1) == load) return node;
+  }
+}
+
+static void vnodeNumaRelease(int32_t node) {
+  if (node >= 0) atomic_sub_fetch_32(&vnodeNumaLoad[node], 1);
+}
+
+int32_t vnodeGetNumaNode(SVnode *pVnode) { return pVnode->numaNode; }
+
 SVnode *vnodeOpen(const char *path, int32_t diskPrimary, STfs *pTfs, SMsgCb msgCb, bool force) {
   SVnode    *pVnode = NULL;
   SVnodeInfo info = {0};
@@ -391,6 +418,7 @@ SVnode *vnodeOpen(const char *path, int32_t diskPrimary, STfs *pTfs, SMsgCb msgC
   pVnode->state.applyTerm = info.state.commitTerm;
   pVnode->pTfs = pTfs;
   pVnode->diskPrimary = diskPrimary;
+  pVnode->numaNode = vnodeNumaAcquire();
   pVnode->msgCb = msgCb;
   taosThreadMutexInit(&pVnode->lock, NULL);
   pVnode->blocked = false;
@@ -399,6 +427,13 @@ SVnode *vnodeOpen(const char *path, int32_t diskPrimary, STfs *pTfs, SMsgCb msgC
   taosThreadMutexInit(&pVnode->mutex, NULL);
   taosThreadCondInit(&pVnode->poolNotEmpty, NULL);
 
+  pVnode->writeStall.pDeferred = taosArrayInit(8, sizeof(SVDeferredWrite));
+  if (pVnode->writeStall.pDeferred == NULL) {
+    vError("vgId:%d, failed to init deferred writes", TD_VID(pVnode));
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err;
+  }
+
   if (vnodeAChannelInit(vnodeAsyncHandle[0], &pVnode->commitChannel) != 0) {
     vError("vgId:%d, failed to init commit channel", TD_VID(pVnode));
     goto _err;
@@ -407,6 +442,9 @@ SVnode *vnodeOpen(const char *path, int32_t diskPrimary, STfs *pTfs, SMsgCb msgC
   int8_t rollback = vnodeShouldRollback(pVnode);
 
   // open buffer pool
+  if (pVnode->numaNode >= 0) {
+    vInfo("vgId:%d, vnode is bound to numa node:%d", TD_VID(pVnode), pVnode->numaNode);
+  }
   if (vnodeOpenBufPool(pVnode) < 0) {
     vError("vgId:%d, failed to open vnode buffer pool since %s", TD_VID(pVnode), tstrerror(terrno));
     goto _err;
@@ -490,7 +528,9 @@ _err:
   if (pVnode->pSma) smaClose(pVnode->pSma);
   if (pVnode->pMeta) metaClose(&pVnode->pMeta);
   if (pVnode->freeList) vnodeCloseBufPool(pVnode);
+  taosArrayDestroy(pVnode->writeStall.pDeferred);
 
+  vnodeNumaRelease(pVnode->numaNode);
   taosMemoryFree(pVnode);
   return NULL;
 }
@@ -514,12 +554,15 @@ void vnodeClose(SVnode *pVnode) {
     smaClose(pVnode->pSma);
     if (pVnode->pMeta) metaClose(&pVnode->pMeta);
     vnodeCloseBufPool(pVnode);
-
+    vnodeStopDeferWrite(pVnode);
+    taosArrayDestroy(pVnode->writeStall.pDeferred);
+  
     // destroy handle
     tsem_destroy(&pVnode->syncSem);
     taosThreadCondDestroy(&pVnode->poolNotEmpty);
     taosThreadMutexDestroy(&pVnode->mutex);
     taosThreadMutexDestroy(&pVnode->lock);
+    vnodeNumaRelease(pVnode->numaNode);
     taosMemoryFree(pVnode);
   }
 }
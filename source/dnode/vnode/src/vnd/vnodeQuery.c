@@ -387,6 +387,11 @@ int32_t vnodeGetLoad(SVnode *pVnode, SVnodeLoad *pLoad) {
   pLoad->learnerProgress = state.progress;
   pLoad->cacheUsage = tsdbCacheGetUsage(pVnode);
   pLoad->numOfCachedTables = tsdbCacheGetElems(pVnode);
+  tsdbCacheGetStat(pVnode, &pLoad->lastCacheHit, &pLoad->lastCacheMiss, &pLoad->lastCacheEvict);
+  tsdbPageCacheGetStat(pVnode, &pLoad->pageCacheHit, &pLoad->pageCacheMiss);
+  vnodeGetWriteStallLoad(pVnode, pLoad);
+  tsdbMergeGetStat(pVnode, &pLoad->sttMerges, &pLoad->sttMergesToData, &pLoad->sttMergeBytesNew,
+                   &pLoad->sttMergeBytesRead, &pLoad->sttMergeBytesWritten);
   pLoad->numOfTables = metaGetTbNum(pVnode->pMeta);
   pLoad->numOfTimeSeries = metaGetTimeSeriesNum(pVnode->pMeta, 1);
   pLoad->totalStorage = (int64_t)3 * 1073741824;
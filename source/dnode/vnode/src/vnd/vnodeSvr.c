@@ -1665,6 +1665,9 @@ static int32_t vnodeProcessSubmitReq(SVnode *pVnode, int64_t ver, void *pReq, in
       }
     }
 
+    // data is inserted by shards after all tables are created
+    if (tsNumOfVnodeWriteShards > 1) continue;
+
     // insert data
     int32_t affectedRows;
     code = tsdbInsertTableData(pVnode->pTsdb, ver, pSubmitTbData, &affectedRows);
@@ -1676,6 +1679,20 @@ static int32_t vnodeProcessSubmitReq(SVnode *pVnode, int64_t ver, void *pReq, in
     pSubmitRsp->affectedRows += affectedRows;
   }
 
+  if (tsNumOfVnodeWriteShards > 1) {
+    int32_t affectedRows;
+    code = tsdbInsertTableDataBatch(pVnode->pTsdb, ver, pSubmitReq->aSubmitTbData, &affectedRows);
+    if (code) goto _exit;
+
+    for (int32_t i = 0; i < TARRAY_SIZE(pSubmitReq->aSubmitTbData); ++i) {
+      SSubmitTbData *pSubmitTbData = taosArrayGet(pSubmitReq->aSubmitTbData, i);
+      code = metaUpdateChangeTimeWithLock(pVnode->pMeta, pSubmitTbData->uid, pSubmitTbData->ctimeMs);
+      if (code) goto _exit;
+    }
+
+    pSubmitRsp->affectedRows += affectedRows;
+  }
+
   // update the affected table uid list
   if (taosArrayGetSize(newTbUids) > 0) {
     vDebug("vgId:%d, add %d table into query table list in handling submit", TD_VID(pVnode),
@@ -1892,6 +1909,10 @@ static int32_t vnodeProcessAlterConfigReq(SVnode *pVnode, int64_t ver, void *pRe
     pVnode->config.sttTrigger = req.sttTrigger;
   }
 
+  if (req.sttMergePolicy != -1 && req.sttMergePolicy != pVnode->config.sttMergePolicy) {
+    pVnode->config.sttMergePolicy = req.sttMergePolicy;
+  }
+
   if (req.minRows != -1 && req.minRows != pVnode->config.tsdbCfg.minRows) {
     pVnode->config.tsdbCfg.minRows = req.minRows;
   }
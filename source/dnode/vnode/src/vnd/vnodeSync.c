@@ -105,6 +105,156 @@ static void vnodeHandleProposeError(SVnode *pVnode, SRpcMsg *pMsg, int32_t code)
   }
 }
 
+// called with pVnode->mutex held, the first deferred write is put back to the write queue to resume the others behind
+// it, or all of them are replied if the vnode is closing.
+static void vnodeReleaseDeferredWrites(SVnode *pVnode) {
+  SVWriteStall *pStall = &pVnode->writeStall;
+
+  while (taosArrayGetSize(pStall->pDeferred) > 0) {
+    SVDeferredWrite *pWrite = taosArrayGet(pStall->pDeferred, 0);
+    SRpcMsg          msg = pWrite->msg;
+
+    atomic_add_fetch_64(&pStall->nDelay, 1);
+    atomic_add_fetch_64(&pStall->delayUs, taosGetTimestampUs() - pWrite->deferUs);
+    taosArrayRemove(pStall->pDeferred, 0);
+
+    if (pStall->stopped) {
+      vnodeHandleProposeError(pVnode, &msg, TSDB_CODE_VND_STOPPED);
+      rpcFreeCont(msg.pCont);
+      continue;
+    }
+
+    // the error is replied and the content is freed if it fails, then the next one resumes the others
+    pStall->pResume = msg.pCont;
+    if (tmsgPutToQueue(&pVnode->msgCb, WRITE_QUEUE, &msg) == 0) {
+      return;
+    }
+    pStall->pResume = NULL;
+  }
+
+  atomic_store_8(&pStall->holding, 0);
+}
+
+static void vnodeDeferredWriteTimeout(void *param, void *tmrId) {
+  SVnode *pVnode = param;
+
+  taosThreadMutexLock(&pVnode->mutex);
+  vnodeReleaseDeferredWrites(pVnode);
+  pVnode->writeStall.deferTmr = NULL;
+  taosThreadMutexUnlock(&pVnode->mutex);
+}
+
+/*
+ * Defer a submit under write pressure instead of sleeping on the write thread, so the write thread is not blocked.
+ * Once a write is deferred, every later write msg of the vnode is held behind it to keep the writes in arrival order.
+ * When the delay of the first one expires, it is put back to the write queue, and the ones held behind it are taken by
+ * vnodeNextDeferredWrite right after it is proposed.
+ */
+bool vnodeDeferWriteMsg(SVnode *pVnode, SRpcMsg *pMsg) {
+  SVWriteStall *pStall = &pVnode->writeStall;
+  bool          deferred = false;
+
+  if (tsVnodeWriteMaxDelay <= 0 && !atomic_load_8(&pStall->holding)) {
+    return false;
+  }
+
+  taosThreadMutexLock(&pVnode->mutex);
+  if (pStall->pResume != NULL && pStall->pResume == pMsg->pCont) {
+    pStall->pResume = NULL;
+    pStall->resuming = true;
+    goto _exit;
+  }
+
+  if (pStall->stopped) {
+    goto _exit;
+  }
+
+  int64_t delayUs = 0;
+  if (!pStall->holding) {
+    if (pMsg->msgType != TDMT_VND_SUBMIT || (delayUs = vnodeGetWriteDelay(pVnode)) <= 0) {
+      goto _exit;
+    }
+  }
+
+  SVDeferredWrite write = {.msg = *pMsg, .deferUs = taosGetTimestampUs()};
+  if (taosArrayPush(pStall->pDeferred, &write) == NULL) {
+    // the ones held before it are proposed first, unless it is the first one
+    if (pStall->holding) {
+      vnodeHandleProposeError(pVnode, pMsg, TSDB_CODE_OUT_OF_MEMORY);
+      rpcFreeCont(pMsg->pCont);
+      deferred = true;
+    }
+    goto _exit;
+  }
+
+  if (!pStall->holding) {
+    pStall->deferTmr = taosTmrStart(vnodeDeferredWriteTimeout, TMAX(delayUs / 1000, 1), pVnode, vnodeTimer);
+    if (pStall->deferTmr == NULL) {
+      taosArrayPop(pStall->pDeferred);
+      goto _exit;
+    }
+    atomic_store_8(&pStall->holding, 1);
+  }
+
+  const STraceId *trace = &pMsg->info.traceId;
+  vGTrace("vgId:%d, msg:%p is deferred on write pressure, type:%s deferred:%d", pVnode->config.vgId, pMsg,
+          TMSG_INFO(pMsg->msgType), (int32_t)taosArrayGetSize(pStall->pDeferred));
+  deferred = true;
+
+_exit:
+  taosThreadMutexUnlock(&pVnode->mutex);
+  return deferred;
+}
+
+// take the next write held behind the resumed one in arrival order, false if there is no more
+bool vnodeNextDeferredWrite(SVnode *pVnode, SRpcMsg *pMsg) {
+  SVWriteStall *pStall = &pVnode->writeStall;
+  bool          next = false;
+
+  if (!pStall->resuming) {
+    return false;
+  }
+
+  taosThreadMutexLock(&pVnode->mutex);
+  if (taosArrayGetSize(pStall->pDeferred) > 0) {
+    SVDeferredWrite *pWrite = taosArrayGet(pStall->pDeferred, 0);
+    *pMsg = pWrite->msg;
+    atomic_add_fetch_64(&pStall->nDelay, 1);
+    atomic_add_fetch_64(&pStall->delayUs, taosGetTimestampUs() - pWrite->deferUs);
+    taosArrayRemove(pStall->pDeferred, 0);
+    next = true;
+  } else {
+    pStall->resuming = false;
+    atomic_store_8(&pStall->holding, 0);
+  }
+  taosThreadMutexUnlock(&pVnode->mutex);
+  return next;
+}
+
+// stop deferring writes and reply the deferred ones, since the write queue is going to be closed
+void vnodeStopDeferWrite(SVnode *pVnode) {
+  SVWriteStall *pStall = &pVnode->writeStall;
+
+  taosThreadMutexLock(&pVnode->mutex);
+  pStall->stopped = true;
+
+  tmr_h tmrId = pStall->deferTmr;
+  if (tmrId != NULL && taosTmrStopA(&tmrId)) {
+    pStall->deferTmr = NULL;
+  }
+
+  // the timer has been fired, wait for it to finish
+  while (pStall->deferTmr != NULL) {
+    taosThreadMutexUnlock(&pVnode->mutex);
+    taosMsleep(1);
+    taosThreadMutexLock(&pVnode->mutex);
+  }
+
+  vnodeReleaseDeferredWrites(pVnode);
+  pStall->pResume = NULL;
+  taosThreadMutexUnlock(&pVnode->mutex);
+}
+
 static int32_t inline vnodeProposeMsg(SVnode *pVnode, SRpcMsg *pMsg, bool isWeak) {
   int64_t seq = 0;
 
@@ -160,6 +310,32 @@ void vnodeProposeCommitOnNeed(SVnode *pVnode, bool atExit) {
   }
 }
 
+static void vnodePreProcessAndProposeMsg(SVnode *pVnode, SRpcMsg *pMsg) {
+  const STraceId *trace = &pMsg->info.traceId;
+  int32_t         code = vnodePreProcessWriteMsg(pVnode, pMsg);
+  if (code != 0) {
+    vGError("vgId:%d, msg:%p failed to pre-process since %s", pVnode->config.vgId, pMsg, tstrerror(code));
+    if (terrno != 0) code = terrno;
+    vnodeHandleProposeError(pVnode, pMsg, code);
+    rpcFreeCont(pMsg->pCont);
+    return;
+  }
+
+  code = vnodeProposeMsg(pVnode, pMsg, vnodeIsMsgWeak(pMsg->msgType));
+
+  vGTrace("vgId:%d, msg:%p is freed, code:0x%x", pVnode->config.vgId, pMsg, code);
+  rpcFreeCont(pMsg->pCont);
+}
+
+// propose the writes held behind a resumed one, before the later writes in the write queue
+static void vnodeProposeDeferredWrites(SVnode *pVnode) {
+  SRpcMsg msg = {0};
+  while (vnodeNextDeferredWrite(pVnode, &msg)) {
+    vnodeProposeCommitOnNeed(pVnode, false);
+    vnodePreProcessAndProposeMsg(pVnode, &msg);
+  }
+}
+
 #if BATCH_ENABLE
 
 static void inline vnodeProposeBatchMsg(SVnode *pVnode, SRpcMsg **pMsgArr, bool *pIsWeakArr, int32_t *arrSize) {
@@ -240,6 +416,10 @@ void vnodeProposeWriteMsg(SQueueInfo *pInfo, STaosQall *qall, int32_t numOfMsgs)
 
     bool atExit = false;
     vnodeProposeCommitOnNeed(pVnode, atExit);
+    if (vnodeDeferWriteMsg(pVnode, pMsg)) {
+      taosFreeQitem(pMsg);
+      continue;
+    }
 
     code = vnodePreProcessWriteMsg(pVnode, pMsg);
     if (code != 0) {
@@ -257,9 +437,10 @@ void vnodeProposeWriteMsg(SQueueInfo *pInfo, STaosQall *qall, int32_t numOfMsgs)
     pIsWeakArr[arrayPos] = isWeak;
     arrayPos++;
 
-    if (isBlock || msg == numOfMsgs - 1) {
+    if (isBlock || msg == numOfMsgs - 1 || pVnode->writeStall.resuming) {
       vnodeProposeBatchMsg(pVnode, pMsgArr, pIsWeakArr, &arrayPos);
     }
+    vnodeProposeDeferredWrites(pVnode);
   }
 
   taosMemoryFree(pMsgArr);
@@ -271,7 +452,6 @@ void vnodeProposeWriteMsg(SQueueInfo *pInfo, STaosQall *qall, int32_t numOfMsgs)
 void vnodeProposeWriteMsg(SQueueInfo *pInfo, STaosQall *qall, int32_t numOfMsgs) {
   SVnode  *pVnode = pInfo->ahandle;
   int32_t  vgId = pVnode->config.vgId;
-  int32_t  code = 0;
   SRpcMsg *pMsg = NULL;
   vTrace("vgId:%d, get %d msgs from vnode-write queue", vgId, numOfMsgs);
 
@@ -294,22 +474,14 @@ void vnodeProposeWriteMsg(SQueueInfo *pInfo, STaosQall *qall, int32_t numOfMsgs)
 
     bool atExit = false;
     vnodeProposeCommitOnNeed(pVnode, atExit);
-
-    code = vnodePreProcessWriteMsg(pVnode, pMsg);
-    if (code != 0) {
-      vGError("vgId:%d, msg:%p failed to pre-process since %s", vgId, pMsg, tstrerror(code));
-      if (terrno != 0) code = terrno;
-      vnodeHandleProposeError(pVnode, pMsg, code);
-      rpcFreeCont(pMsg->pCont);
+    if (vnodeDeferWriteMsg(pVnode, pMsg)) {
       taosFreeQitem(pMsg);
       continue;
     }
 
-    code = vnodeProposeMsg(pVnode, pMsg, isWeak);
-
-    vGTrace("vgId:%d, msg:%p is freed, code:0x%x", vgId, pMsg, code);
-    rpcFreeCont(pMsg->pCont);
+    vnodePreProcessAndProposeMsg(pVnode, pMsg);
     taosFreeQitem(pMsg);
+    vnodeProposeDeferredWrites(pVnode);
   }
 }
 
@@ -715,6 +887,7 @@ int32_t vnodeSyncStart(SVnode *pVnode) {
 
 void vnodeSyncPreClose(SVnode *pVnode) {
   vInfo("vgId:%d, sync pre close", pVnode->config.vgId);
+  vnodeStopDeferWrite(pVnode);
   syncLeaderTransfer(pVnode->sync);
   syncPreStop(pVnode->sync);
 
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <vector>
+
+#include "vnodeTestUtil.h"
+#include "../src/tsdb/tsdbCommit2.h"
+
+// records how the file sets of a commit are committed
+struct SFSetCommitRecorder {
+  int32_t                  failIdx = -1;
+  int32_t                  sleepMs = 0;
+  TdThread                 caller;
+  std::atomic<int32_t>     running{0};
+  std::atomic<int32_t>     maxRunning{0};
+  std::atomic<int32_t>     started{0};
+  std::atomic<int32_t>     byHelper{0};
+  std::vector<int32_t>     commits;  // times each file set is committed
+  std::vector<TFileOpArray> fopArrays;
+
+  explicit SFSetCommitRecorder(int32_t numOfFSet) : commits(numOfFSet, 0), fopArrays(numOfFSet) {
+    caller = taosThreadSelf();
+    for (auto &fopArray : fopArrays) {
+      TARRAY2_INIT(&fopArray);
+    }
+  }
+
+  ~SFSetCommitRecorder() {
+    for (auto &fopArray : fopArrays) {
+      TARRAY2_DESTROY(&fopArray, NULL);
+    }
+  }
+
+  static int32_t commit(void *arg, int32_t idx) {
+    SFSetCommitRecorder *recorder = (SFSetCommitRecorder *)arg;
+
+    int32_t running = ++recorder->running;
+    int32_t maxRunning = recorder->maxRunning.load();
+    while (running > maxRunning && !recorder->maxRunning.compare_exchange_weak(maxRunning, running)) {
+    }
+    ++recorder->started;
+    if (!taosThreadEqual(taosThreadSelf(), recorder->caller)) ++recorder->byHelper;
+
+    // the later file sets finish first
+    if (recorder->sleepMs > 0) {
+      taosMsleep(recorder->sleepMs * (recorder->commits.size() - idx));
+    }
+
+    int32_t code = 0;
+    if (idx == recorder->failIdx) {
+      code = TSDB_CODE_OUT_OF_MEMORY;
+    } else {
+      // two file ops of the file set, fid is 10 times the index
+      for (int32_t i = 0; i < 2; i++) {
+        STFileOp fop = {.optype = i == 0 ? TSDB_FOP_REMOVE : TSDB_FOP_CREATE, .fid = idx * 10};
+        fop.nf.fid = idx * 10;
+        fop.nf.cid = i;
+        EXPECT_EQ(TARRAY2_APPEND(&recorder->fopArrays[idx], fop), 0);
+      }
+    }
+
+    recorder->commits[idx]++;
+    --recorder->running;
+    return code;
+  }
+};
+
+class TsdbCommitTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() { ASSERT_EQ(vnodeAsyncInit(&vnodeAsyncHandle[0], "vnode-commit"), 0); }
+
+  static void TearDownTestSuite() { vnodeAsyncDestroy(&vnodeAsyncHandle[0]); }
+
+  void SetUp() override { ASSERT_EQ(vnodeAsyncSetWorkers(vnodeAsyncHandle[0], 4), 0); }
+
+  static int32_t runQueue(SFSetCommitRecorder *recorder, int32_t numOfWorker) {
+    SCommitFSetQueue queue = {0};
+    queue.numOfFSet = recorder->commits.size();
+    queue.commitFn = SFSetCommitRecorder::commit;
+    queue.arg = recorder;
+    return tsdbCommitFSetQueueRun(&queue, numOfWorker);
+  }
+
+  static std::vector<int32_t> mergedFids(SFSetCommitRecorder *recorder, int32_t *code) {
+    std::vector<int32_t> fids;
+    TFileOpArray         fopArray[1];
+    TARRAY2_INIT(fopArray);
+
+    *code = 0;
+    for (auto &fsetFopArray : recorder->fopArrays) {
+      if ((*code = tsdbCommitMergeFopArray(fopArray, &fsetFopArray)) != 0) break;
+    }
+
+    const STFileOp *fop;
+    TARRAY2_FOREACH_PTR(fopArray, fop) { fids.push_back(fop->fid); }
+    TARRAY2_DESTROY(fopArray, NULL);
+    return fids;
+  }
+
+  // block the workers of the vnode-commit pool, as if they were committing other vnodes
+  static int32_t blockWorker(void *arg) {
+    std::atomic<bool> *blocked = (std::atomic<bool> *)arg;
+    while (blocked->load()) {
+      taosMsleep(1);
+    }
+    return 0;
+  }
+};
+
+TEST_F(TsdbCommitTest, serial) {
+  SFSetCommitRecorder recorder(5);
+  ASSERT_EQ(runQueue(&recorder, 1), 0);
+
+  ASSERT_EQ(recorder.commits, std::vector<int32_t>(5, 1));
+  ASSERT_EQ(recorder.maxRunning, 1);
+  ASSERT_EQ(recorder.byHelper, 0);
+}
+
+TEST_F(TsdbCommitTest, concurrent) {
+  SFSetCommitRecorder recorder(8);
+  recorder.sleepMs = 5;
+  ASSERT_EQ(runQueue(&recorder, 4), 0);
+
+  // every file set is committed exactly once, and the helpers are done on return
+  ASSERT_EQ(recorder.commits, std::vector<int32_t>(8, 1));
+  ASSERT_EQ(recorder.running, 0);
+  ASSERT_GT(recorder.maxRunning, 1);
+  ASSERT_LE(recorder.maxRunning, 4);
+  ASSERT_GT(recorder.byHelper, 0);
+
+  // the file ops are merged in fid order although the file sets finish in reverse order
+  int32_t              code = 0;
+  std::vector<int32_t> fids = mergedFids(&recorder, &code);
+  ASSERT_EQ(code, 0);
+  ASSERT_EQ(fids.size(), 16);
+  for (int32_t i = 0; i < fids.size(); i++) {
+    ASSERT_EQ(fids[i], (i / 2) * 10);
+  }
+}
+
+TEST_F(TsdbCommitTest, failure) {
+  SFSetCommitRecorder recorder(32);
+  recorder.sleepMs = 1;
+  recorder.failIdx = 2;
+  ASSERT_EQ(runQueue(&recorder, 4), TSDB_CODE_OUT_OF_MEMORY);
+
+  // no file set is committed twice, no more are started after the failure, and the running ones are awaited
+  ASSERT_EQ(recorder.running, 0);
+  ASSERT_EQ(recorder.commits[2], 1);
+  ASSERT_LT(recorder.started, 32);
+  for (int32_t n : recorder.commits) {
+    ASSERT_LE(n, 1);
+  }
+  int32_t started = recorder.started;
+  taosMsleep(50);
+  ASSERT_EQ(recorder.started, started);
+}
+
+TEST_F(TsdbCommitTest, cancelHelpers) {
+  // the only worker of the pool is busy, so the helpers cannot start before the caller drains the queue
+  std::atomic<bool> blocked{true};
+  int64_t           taskId = 0;
+  ASSERT_EQ(vnodeAsyncSetWorkers(vnodeAsyncHandle[0], 1), 0);
+  ASSERT_EQ(vnodeAsync(vnodeAsyncHandle[0], EVA_PRIORITY_HIGH, blockWorker, NULL, &blocked, &taskId), 0);
+  taosMsleep(10);
+
+  SFSetCommitRecorder recorder(6);
+  ASSERT_EQ(runQueue(&recorder, 4), 0);
+  ASSERT_EQ(recorder.commits, std::vector<int32_t>(6, 1));
+  ASSERT_EQ(recorder.byHelper, 0);
+
+  // the helpers are cancelled rather than waited, so they never run after the queue is gone
+  blocked = false;
+  ASSERT_EQ(vnodeAWait(vnodeAsyncHandle[0], taskId), 0);
+  taosMsleep(20);
+  ASSERT_EQ(recorder.started, 6);
+  ASSERT_EQ(recorder.byHelper, 0);
+}
+
+TEST_F(TsdbCommitTest, mergeFopArray) {
+  SFSetCommitRecorder recorder(3);
+  for (int32_t i = 0; i < 3; i++) {
+    ASSERT_EQ(SFSetCommitRecorder::commit(&recorder, i), 0);
+  }
+
+  // a file set without file ops is skipped
+  TARRAY2_CLEAR(&recorder.fopArrays[1], NULL);
+  int32_t code = 0;
+  ASSERT_EQ(mergedFids(&recorder, &code), std::vector<int32_t>({0, 0, 20, 20}));
+  ASSERT_EQ(code, 0);
+
+  // the file ops of a file set cannot be merged behind those of a later one
+  std::swap(recorder.fopArrays[0], recorder.fopArrays[2]);
+  ASSERT_EQ(mergedFids(&recorder, &code), std::vector<int32_t>({20, 20}));
+  ASSERT_EQ(code, TSDB_CODE_INVALID_PARA);
+}
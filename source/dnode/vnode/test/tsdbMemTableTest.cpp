@@ -0,0 +1,438 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "vnodeTestUtil.h"
+
+struct SMemRow {
+  TSKEY   ts;
+  int64_t version;
+  int32_t val;
+
+  bool operator<(const SMemRow &r) const { return ts < r.ts || (ts == r.ts && version < r.version); }
+  bool operator==(const SMemRow &r) const { return ts == r.ts && version == r.version && val == r.val; }
+};
+
+static std::ostream &operator<<(std::ostream &os, const SMemRow &r) {
+  return os << "{ts:" << r.ts << ", ver:" << r.version << ", val:" << r.val << "}";
+}
+
+class TsdbMemTableTest : public VnodeTest {
+ protected:
+  static const tb_uid_t suid = 10;
+  static const tb_uid_t uid = 11;
+
+  void SetUp() override {
+    ASSERT_NO_FATAL_FAILURE(VnodeTest::SetUp());
+    pVnode->config.szBuf = VNODE_BUFPOOL_SEGMENTS * 1024 * 1024;
+    pVnode->config.tsdbCfg.slLevel = 5;
+    pVnode->config.cacheLast = 0;
+
+    ASSERT_EQ(vnodeOpenBufPool(pVnode), 0);
+    pVnode->inUse = pVnode->aBufPool[0];
+    pVnode->inUse->nRef = 1;
+    ASSERT_EQ(tsdbMemTableCreate(pTsdb, &pTsdb->mem), 0);
+
+    SSchema aSchema[2] = {0};
+    aSchema[0].type = TSDB_DATA_TYPE_TIMESTAMP;
+    aSchema[0].colId = PRIMARYKEY_TIMESTAMP_COL_ID;
+    aSchema[0].bytes = TYPE_BYTES[TSDB_DATA_TYPE_TIMESTAMP];
+    aSchema[1].type = TSDB_DATA_TYPE_INT;
+    aSchema[1].colId = PRIMARYKEY_TIMESTAMP_COL_ID + 1;
+    aSchema[1].bytes = TYPE_BYTES[TSDB_DATA_TYPE_INT];
+    pTSchema = tBuildTSchema(aSchema, 2, 1);
+    ASSERT_NE(pTSchema, nullptr);
+  }
+
+  void TearDown() override {
+    tsdbMemTableDestroy(pTsdb->mem, false);
+    vnodeCloseBufPool(pVnode);
+    tDestroyTSchema(pTSchema);
+    VnodeTest::TearDown();
+  }
+
+  static int32_t rowVal(TSKEY ts, int64_t version) { return (int32_t)(ts * 100 + version); }
+
+  static SColVal makeColVal(int16_t cid, int8_t type, int64_t val) {
+    SColVal colVal = {0};
+    colVal.cid = cid;
+    colVal.type = type;
+    colVal.flag = CV_FLAG_VALUE;
+    colVal.value.val = val;
+    return colVal;
+  }
+
+  // a column format batch, which goes to the append list if it starts after the table's max key
+  void makeColData(tb_uid_t tbUid, int64_t version, const std::vector<TSKEY> &keys, SSubmitTbData *pSubmitTbData) {
+    SColData aColData[2] = {0};
+    tColDataInit(&aColData[0], PRIMARYKEY_TIMESTAMP_COL_ID, TSDB_DATA_TYPE_TIMESTAMP, 0);
+    tColDataInit(&aColData[1], PRIMARYKEY_TIMESTAMP_COL_ID + 1, TSDB_DATA_TYPE_INT, 0);
+    for (TSKEY ts : keys) {
+      SColVal tsVal = makeColVal(PRIMARYKEY_TIMESTAMP_COL_ID, TSDB_DATA_TYPE_TIMESTAMP, ts);
+      SColVal colVal = makeColVal(PRIMARYKEY_TIMESTAMP_COL_ID + 1, TSDB_DATA_TYPE_INT, rowVal(ts, version));
+      ASSERT_EQ(tColDataAppendValue(&aColData[0], &tsVal), 0);
+      ASSERT_EQ(tColDataAppendValue(&aColData[1], &colVal), 0);
+    }
+
+    *pSubmitTbData = {0};
+    pSubmitTbData->flags = SUBMIT_REQ_COLUMN_DATA_FORMAT;
+    pSubmitTbData->suid = suid;
+    pSubmitTbData->uid = tbUid;
+    pSubmitTbData->aCol = taosArrayInit(2, sizeof(SColData));
+    ASSERT_NE(taosArrayPush(pSubmitTbData->aCol, &aColData[0]), nullptr);
+    ASSERT_NE(taosArrayPush(pSubmitTbData->aCol, &aColData[1]), nullptr);
+  }
+
+  // a row format batch, which always goes to the skip list
+  void makeRowData(tb_uid_t tbUid, int64_t version, const std::vector<TSKEY> &keys, SSubmitTbData *pSubmitTbData) {
+    *pSubmitTbData = {0};
+    pSubmitTbData->suid = suid;
+    pSubmitTbData->uid = tbUid;
+    pSubmitTbData->aRowP = taosArrayInit(keys.size(), sizeof(SRow *));
+
+    SArray *aColVal = taosArrayInit(2, sizeof(SColVal));
+    for (TSKEY ts : keys) {
+      SColVal tsVal = makeColVal(PRIMARYKEY_TIMESTAMP_COL_ID, TSDB_DATA_TYPE_TIMESTAMP, ts);
+      SColVal colVal = makeColVal(PRIMARYKEY_TIMESTAMP_COL_ID + 1, TSDB_DATA_TYPE_INT, rowVal(ts, version));
+      taosArrayClear(aColVal);
+      ASSERT_NE(taosArrayPush(aColVal, &tsVal), nullptr);
+      ASSERT_NE(taosArrayPush(aColVal, &colVal), nullptr);
+
+      SRow *pRow = NULL;
+      ASSERT_EQ(tRowBuild(aColVal, pTSchema, &pRow), 0);
+      ASSERT_NE(taosArrayPush(pSubmitTbData->aRowP, &pRow), nullptr);
+    }
+    taosArrayDestroy(aColVal);
+  }
+
+  static void destroySubmitTbData(SSubmitTbData *pSubmitTbData) {
+    if (pSubmitTbData->flags & SUBMIT_REQ_COLUMN_DATA_FORMAT) {
+      taosArrayDestroyEx(pSubmitTbData->aCol, tColDataDestroy);
+    } else {
+      for (int32_t i = 0; i < taosArrayGetSize(pSubmitTbData->aRowP); i++) {
+        tRowDestroy(*(SRow **)taosArrayGet(pSubmitTbData->aRowP, i));
+      }
+      taosArrayDestroy(pSubmitTbData->aRowP);
+    }
+  }
+
+  void insertData(int64_t version, const std::vector<TSKEY> &keys, SSubmitTbData *pSubmitTbData) {
+    int32_t affectedRows = 0;
+    ASSERT_EQ(tsdbInsertTableData(pTsdb, version, pSubmitTbData, &affectedRows), 0);
+    ASSERT_EQ(affectedRows, keys.size());
+    destroySubmitTbData(pSubmitTbData);
+
+    for (TSKEY ts : keys) {
+      rows.push_back({ts, version, rowVal(ts, version)});
+    }
+  }
+
+  void insertColData(int64_t version, const std::vector<TSKEY> &keys) {
+    SSubmitTbData submitTbData;
+    ASSERT_NO_FATAL_FAILURE(makeColData(uid, version, keys, &submitTbData));
+    insertData(version, keys, &submitTbData);
+  }
+
+  void insertRowData(int64_t version, const std::vector<TSKEY> &keys) {
+    SSubmitTbData submitTbData;
+    ASSERT_NO_FATAL_FAILURE(makeRowData(uid, version, keys, &submitTbData));
+    insertData(version, keys, &submitTbData);
+  }
+
+  STbData *getTbData() { return tsdbGetTbDataFromMemTable(pTsdb->mem, suid, uid); }
+
+  std::vector<SMemRow> scan(TSKEY *pFromTs, int64_t fromVer, int8_t backward, STbData *pTbData = NULL) {
+    std::vector<SMemRow> result;
+    STbDataIter          iter = {0};
+    TSDBKEY              from = {.version = fromVer, .ts = pFromTs ? *pFromTs : 0};
+
+    tsdbTbDataIterOpen(pTbData ? pTbData : getTbData(), pFromTs ? &from : NULL, backward, &iter);
+    for (TSDBROW *pRow = tsdbTbDataIterGet(&iter); pRow; pRow = tsdbTbDataIterGet(&iter)) {
+      SColVal colVal = {0};
+      tsdbRowGetColVal(pRow, pTSchema, 1, &colVal);
+      result.push_back({TSDBROW_TS(pRow), TSDBROW_VERSION(pRow), (int32_t)colVal.value.val});
+      if (!tsdbTbDataIterNext(&iter)) break;
+    }
+    return result;
+  }
+
+  // the rows expected by a scan from the key, in the order of the scan
+  std::vector<SMemRow> expected(TSKEY *pFromTs, int64_t fromVer, int8_t backward) {
+    std::vector<SMemRow> result;
+    SMemRow              from = {pFromTs ? *pFromTs : 0, fromVer, 0};
+    for (auto &row : rows) {
+      if (pFromTs && (backward ? from < row : row < from)) continue;
+      result.push_back(row);
+    }
+    std::sort(result.begin(), result.end());
+    if (backward) std::reverse(result.begin(), result.end());
+    return result;
+  }
+
+  void checkScan() {
+    ASSERT_EQ(scan(NULL, 0, 0), expected(NULL, 0, 0));
+    ASSERT_EQ(scan(NULL, 0, 1), expected(NULL, 0, 1));
+
+    // from each key, and from the keys just before and after each key
+    for (auto &row : rows) {
+      for (TSKEY ts : {row.ts - 1, row.ts, row.ts + 1}) {
+        for (int64_t ver : {(int64_t)0, row.version, VERSION_MAX}) {
+          ASSERT_EQ(scan(&ts, ver, 0), expected(&ts, ver, 0)) << "forward from ts:" << ts << " ver:" << ver;
+          ASSERT_EQ(scan(&ts, ver, 1), expected(&ts, ver, 1)) << "backward from ts:" << ts << " ver:" << ver;
+        }
+      }
+    }
+  }
+
+  STSchema            *pTSchema = NULL;
+  std::vector<SMemRow> rows;
+};
+
+TEST_F(TsdbMemTableTest, appendOnly) {
+  insertColData(1, {10, 20, 30, 40});
+  insertColData(2, {50});
+  insertColData(3, {60, 70, 80});
+
+  // in-order batches are kept in the append list only
+  STbData *pTbData = getTbData();
+  ASSERT_NE(pTbData, nullptr);
+  ASSERT_EQ(pTbData->sl.size, 0);
+  ASSERT_EQ(pTbData->al.size, 8);
+  ASSERT_EQ(tsdbGetNRowsInTbData(pTbData), 8);
+  ASSERT_EQ(pTbData->minKey, 10);
+  ASSERT_EQ(pTbData->maxKey, 80);
+
+  checkScan();
+}
+
+TEST_F(TsdbMemTableTest, mergeOrder) {
+  insertColData(1, {10, 20, 30, 40});
+  insertRowData(2, {5, 25, 45});          // before, between and after the appended rows
+  insertColData(3, {15, 35});             // overlapped batch goes to the skip list
+  insertColData(4, {50, 60, 70});         // in order again
+  insertRowData(5, {1, 55, 65, 75, 100});
+
+  STbData *pTbData = getTbData();
+  ASSERT_EQ(pTbData->al.size, 4 + 3);
+  ASSERT_EQ(pTbData->sl.size, 3 + 2 + 5);
+  ASSERT_EQ(tsdbGetNRowsInTbData(pTbData), rows.size());
+
+  checkScan();
+}
+
+TEST_F(TsdbMemTableTest, duplicateKeys) {
+  insertColData(1, {10, 20, 30, 40});
+  insertColData(2, {50, 60});
+  insertRowData(3, {20, 50});  // update rows in the append list
+  insertColData(4, {10, 40, 60});
+  insertRowData(5, {40});
+  insertColData(6, {70, 80});
+
+  // the versions of a key are adjacent and ordered by version, so keeping the last of each key in a forward scan
+  // (or the first in a backward scan) yields the newest value
+  std::map<TSKEY, SMemRow> newest;
+  for (auto &row : rows) {
+    auto it = newest.find(row.ts);
+    if (it == newest.end() || it->second.version < row.version) newest[row.ts] = row;
+  }
+
+  std::vector<SMemRow> forward;
+  for (auto &row : scan(NULL, 0, 0)) {
+    if (!forward.empty() && forward.back().ts == row.ts) {
+      ASSERT_LT(forward.back().version, row.version);
+      forward.back() = row;
+    } else {
+      forward.push_back(row);
+    }
+  }
+
+  std::vector<SMemRow> backward;
+  for (auto &row : scan(NULL, 0, 1)) {
+    if (!backward.empty() && backward.back().ts == row.ts) {
+      ASSERT_GT(backward.back().version, row.version);
+    } else {
+      backward.push_back(row);
+    }
+  }
+  std::reverse(backward.begin(), backward.end());
+
+  ASSERT_EQ(forward.size(), newest.size());
+  ASSERT_EQ(backward, forward);
+  for (auto &row : forward) {
+    ASSERT_EQ(row, newest[row.ts]);
+  }
+
+  checkScan();
+}
+
+class TsdbMemTableShardTest : public TsdbMemTableTest {
+ protected:
+  static const int32_t nTable = 40;
+  static const int32_t nShard = 4;
+
+  static void SetUpTestSuite() {
+    ASSERT_EQ(vnodeAsyncInit(&vnodeAsyncHandle[3], "vnode-write-shard"), 0);
+    ASSERT_EQ(vnodeAsyncSetWorkers(vnodeAsyncHandle[3], nShard), 0);
+  }
+
+  static void TearDownTestSuite() { vnodeAsyncDestroy(&vnodeAsyncHandle[3]); }
+
+  void SetUp() override {
+    // set before the pool is opened, so the pool has the lock which the shard arenas need
+    numOfWriteShards = tsNumOfVnodeWriteShards;
+    tsNumOfVnodeWriteShards = nShard;
+    TsdbMemTableTest::SetUp();
+    ASSERT_NE(pVnode->inUse->lock, nullptr);
+    ASSERT_EQ(tsdbMemTableCreate(pTsdb, &pSerialMem), 0);
+  }
+
+  void TearDown() override {
+    tsdbMemTableDestroy(pSerialMem, false);
+    TsdbMemTableTest::TearDown();
+    tsNumOfVnodeWriteShards = numOfWriteShards;
+  }
+
+  // each table is submitted twice in one request, in column format and then in row format with overlapping keys, so
+  // both parts must be applied by the same shard in order
+  void makeSubmit(int64_t version, SArray *aSubmitTbData) {
+    for (int32_t i = 0; i < nTable * 2; i++) {
+      tb_uid_t            tbUid = 100 + i % nTable;
+      TSKEY               base = tbUid * 10000 + version * 1000;
+      std::vector<TSKEY>  keys;
+      SSubmitTbData       submitTbData;
+      if (i < nTable) {
+        for (int32_t k = 0; k < 200; k++) keys.push_back(base + k * 2);
+        ASSERT_NO_FATAL_FAILURE(makeColData(tbUid, version, keys, &submitTbData));
+      } else {
+        for (int32_t k = 0; k < 150; k++) keys.push_back(base + 100 + k * 3);
+        ASSERT_NO_FATAL_FAILURE(makeRowData(tbUid, version, keys, &submitTbData));
+      }
+      ASSERT_NE(taosArrayPush(aSubmitTbData, &submitTbData), nullptr);
+    }
+  }
+
+  void insertBatch(SMemTable *pMem, int32_t nWriteShard, int64_t version, SArray *aSubmitTbData) {
+    SMemTable *pMemSave = pTsdb->mem;
+    int32_t    affectedRows = 0;
+    int32_t    expectedRows = 0;
+
+    for (int32_t i = 0; i < taosArrayGetSize(aSubmitTbData); i++) {
+      SSubmitTbData *pSubmitTbData = (SSubmitTbData *)taosArrayGet(aSubmitTbData, i);
+      expectedRows += (pSubmitTbData->flags & SUBMIT_REQ_COLUMN_DATA_FORMAT)
+                          ? ((SColData *)taosArrayGet(pSubmitTbData->aCol, 0))->nVal
+                          : taosArrayGetSize(pSubmitTbData->aRowP);
+    }
+
+    pTsdb->mem = pMem;
+    tsNumOfVnodeWriteShards = nWriteShard;
+    int32_t code = tsdbInsertTableDataBatch(pTsdb, version, aSubmitTbData, &affectedRows);
+    tsNumOfVnodeWriteShards = nShard;
+    pTsdb->mem = pMemSave;
+
+    ASSERT_EQ(code, 0);
+    ASSERT_EQ(affectedRows, expectedRows);
+  }
+
+  // apply the submits to the test memtable with nWriteShard shards, and to pSerialMem one table after another
+  void insertAndCompare(int32_t nWriteShard, const std::vector<int64_t> &versions) {
+    for (int64_t version : versions) {
+      SArray *aSubmitTbData = taosArrayInit(nTable * 2, sizeof(SSubmitTbData));
+      ASSERT_NO_FATAL_FAILURE(makeSubmit(version, aSubmitTbData));
+      ASSERT_NO_FATAL_FAILURE(insertBatch(pTsdb->mem, nWriteShard, version, aSubmitTbData));
+      ASSERT_NO_FATAL_FAILURE(insertBatch(pSerialMem, 1, version, aSubmitTbData));
+      taosArrayDestroyEx(aSubmitTbData, (FDelete)destroySubmitTbData);
+    }
+
+    SMemTable *pMem = pTsdb->mem;
+    ASSERT_EQ(pMem->nRow, pSerialMem->nRow);
+    ASSERT_EQ(pMem->minKey, pSerialMem->minKey);
+    ASSERT_EQ(pMem->maxKey, pSerialMem->maxKey);
+    ASSERT_EQ(pMem->minVer, pSerialMem->minVer);
+    ASSERT_EQ(pMem->maxVer, pSerialMem->maxVer);
+    ASSERT_EQ(pMem->nTbData, nTable);
+    ASSERT_EQ(pSerialMem->nTbData, nTable);
+
+    for (tb_uid_t tbUid = 100; tbUid < 100 + nTable; tbUid++) {
+      STbData *pTbData = tsdbGetTbDataFromMemTable(pMem, suid, tbUid);
+      STbData *pSerialTbData = tsdbGetTbDataFromMemTable(pSerialMem, suid, tbUid);
+      ASSERT_NE(pTbData, nullptr);
+      ASSERT_NE(pSerialTbData, nullptr);
+      ASSERT_EQ(tsdbGetNRowsInTbData(pTbData), tsdbGetNRowsInTbData(pSerialTbData));
+      ASSERT_EQ(pTbData->minKey, pSerialTbData->minKey);
+      ASSERT_EQ(pTbData->maxKey, pSerialTbData->maxKey);
+      ASSERT_EQ(scan(NULL, 0, 0, pTbData), scan(NULL, 0, 0, pSerialTbData)) << "uid:" << tbUid;
+      ASSERT_EQ(scan(NULL, 0, 1, pTbData), scan(NULL, 0, 1, pSerialTbData)) << "uid:" << tbUid;
+    }
+  }
+
+  int32_t    numOfWriteShards = 1;
+  SMemTable *pSerialMem = NULL;
+};
+
+const int32_t TsdbMemTableShardTest::nTable;
+const int32_t TsdbMemTableShardTest::nShard;
+
+TEST_F(TsdbMemTableShardTest, sameAsSerial) {
+  insertAndCompare(nShard, {1, 2, 3});
+}
+
+TEST_F(TsdbMemTableShardTest, asyncFailed) {
+  // no pool to schedule on, each shard is applied by the calling thread
+  SVAsync *async = vnodeAsyncHandle[3];
+  vnodeAsyncHandle[3] = NULL;
+  insertAndCompare(nShard, {1, 2});
+  vnodeAsyncHandle[3] = async;
+}
+
+TEST_F(TsdbMemTableShardTest, arenaClear) {
+  SVBufPool     *pPool = pVnode->inUse;
+  SVBufPoolArena arena;
+  vnodeBufPoolArenaInit(&arena, pPool);
+
+  // the unused tail of the chunk is given back when the chunk is still the last piece cut from the anchor node
+  uint8_t *ptr = pPool->ptr;
+  int64_t  size = pPool->size;
+  uint8_t *p1 = (uint8_t *)vnodeBufPoolArenaMalloc(&arena, 100);
+  ASSERT_NE(p1, nullptr);
+  ASSERT_GE(pPool->size, size + VNODE_BUFPOOL_ARENA_CHUNK);
+  uint8_t *p2 = (uint8_t *)vnodeBufPoolArenaMallocAligned(&arena, 30);
+  ASSERT_EQ((long)p2 % 8, 0);
+  ASSERT_EQ(p2, p1 + 104);
+
+  vnodeBufPoolArenaClear(&arena);
+  ASSERT_EQ(arena.ptr, nullptr);
+  ASSERT_EQ(pPool->ptr, p2 + 30);
+  ASSERT_EQ(pPool->size, size + (pPool->ptr - ptr));
+  ASSERT_EQ(pPool->size, pPool->ptr - pPool->node.data);
+
+  vnodeBufPoolArenaClear(&arena);
+  ASSERT_EQ(pPool->ptr, p2 + 30);
+
+  // the tail is kept once the pool is allocated from after the chunk
+  ASSERT_NE(vnodeBufPoolArenaMalloc(&arena, 100), nullptr);
+  ASSERT_EQ(vnodeBufPoolMalloc(pPool, 10), arena.end);
+  ptr = pPool->ptr;
+  size = pPool->size;
+  vnodeBufPoolArenaClear(&arena);
+  ASSERT_EQ(pPool->ptr, ptr);
+  ASSERT_EQ(pPool->size, size);
+
+  // large allocations go to the pool directly
+  ASSERT_NE(vnodeBufPoolArenaMalloc(&arena, VNODE_BUFPOOL_ARENA_CHUNK), nullptr);
+  ASSERT_EQ(arena.ptr, nullptr);
+}
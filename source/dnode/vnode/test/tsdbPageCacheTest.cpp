@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <vector>
+
+#include "vnodeTestUtil.h"
+#include "../src/tsdb/tsdbDef.h"
+
+class TsdbPageCacheTest : public VnodeTest {
+ protected:
+  static const int32_t szPage = 4096;
+
+  void SetUp() override {
+    ASSERT_EQ(tsdbPageCacheOpen(4 * 1024 * 1024), 0);
+    ASSERT_NO_FATAL_FAILURE(VnodeTest::SetUp());
+    pVnode->config.tsdbPageSize = szPage;
+    snprintf(path, sizeof(path), "%s/tsdbPageCacheTest.data", TD_TMP_DIR_PATH);
+    taosRemoveFile(path);
+  }
+
+  void TearDown() override {
+    taosRemoveFile(path);
+    tsdbPageCacheClose();
+    VnodeTest::TearDown();
+  }
+
+  void writeFile(int64_t offset, const std::vector<uint8_t> &data, int32_t flag) {
+    STsdbFD *pFD = NULL;
+    ASSERT_EQ(tsdbOpenFile(path, pTsdb, flag, &pFD), 0);
+    ASSERT_EQ(tsdbWriteFile(pFD, offset, data.data(), data.size()), 0);
+    ASSERT_EQ(tsdbFsyncFile(pFD), 0);
+    tsdbCloseFile(&pFD);
+  }
+
+  std::vector<uint8_t> readFile(int64_t size) {
+    std::vector<uint8_t> data(size);
+    STsdbFD             *pFD = NULL;
+    EXPECT_EQ(tsdbOpenFile(path, pTsdb, TD_FILE_READ, &pFD), 0);
+    EXPECT_EQ(tsdbReadFile(pFD, 0, data.data(), size, 0), 0);
+    tsdbCloseFile(&pFD);
+    return data;
+  }
+
+  void getStat(int64_t *pHit, int64_t *pMiss) { tsdbPageCacheGetStat(pVnode, pHit, pMiss); }
+
+  static std::vector<uint8_t> makeData(int64_t size, uint8_t seed) {
+    std::vector<uint8_t> data(size);
+    for (int64_t i = 0; i < size; i++) {
+      data[i] = (uint8_t)(seed + i * 7);
+    }
+    return data;
+  }
+
+  char path[PATH_MAX] = {0};
+};
+
+TEST_F(TsdbPageCacheTest, hitAndMiss) {
+  int64_t              szData = 3 * (szPage - sizeof(TSCKSUM)) + 100;  // 4 pages, the first one is not cached
+  std::vector<uint8_t> data = makeData(szData, 1);
+  writeFile(0, data, TD_FILE_READ | TD_FILE_WRITE | TD_FILE_CREATE | TD_FILE_TRUNC);
+
+  int64_t nHit = 0, nMiss = 0;
+  ASSERT_EQ(readFile(szData), data);
+  getStat(&nHit, &nMiss);
+  ASSERT_EQ(nHit, 0);
+  ASSERT_EQ(nMiss, 3);
+
+  ASSERT_EQ(readFile(szData), data);
+  getStat(&nHit, &nMiss);
+  ASSERT_EQ(nHit, 3);
+  ASSERT_EQ(nMiss, 3);
+}
+
+TEST_F(TsdbPageCacheTest, appendToCachedFile) {
+  int64_t              szData = 2 * (szPage - sizeof(TSCKSUM)) + 100;
+  std::vector<uint8_t> data = makeData(szData, 1);
+  writeFile(0, data, TD_FILE_READ | TD_FILE_WRITE | TD_FILE_CREATE | TD_FILE_TRUNC);
+  ASSERT_EQ(readFile(szData), data);
+
+  // the last page which is cached now is rewritten by the append
+  std::vector<uint8_t> more = makeData(szPage, 2);
+  writeFile(szData, more, TD_FILE_READ | TD_FILE_WRITE);
+  data.insert(data.end(), more.begin(), more.end());
+
+  int64_t nHit = 0, nMiss = 0;
+  getStat(&nHit, &nMiss);
+  ASSERT_EQ(readFile(data.size()), data);
+
+  // the file is read by a new id, so no stale page is served
+  int64_t nHit2 = 0, nMiss2 = 0;
+  getStat(&nHit2, &nMiss2);
+  ASSERT_EQ(nHit2, nHit);
+  ASSERT_EQ(nMiss2, nMiss + 3);
+
+  ASSERT_EQ(readFile(data.size()), data);
+  getStat(&nHit, &nMiss);
+  ASSERT_EQ(nHit, nHit2 + 3);
+  ASSERT_EQ(nMiss, nMiss2);
+}
+
+TEST_F(TsdbPageCacheTest, removeFile) {
+  int64_t              szData = 2 * (szPage - sizeof(TSCKSUM)) + 100;
+  std::vector<uint8_t> data = makeData(szData, 3);
+  writeFile(0, data, TD_FILE_READ | TD_FILE_WRITE | TD_FILE_CREATE | TD_FILE_TRUNC);
+  ASSERT_EQ(readFile(szData), data);
+
+  // a file created again by the same path is not served from the pages of the removed one
+  tsdbPageCacheRemoveFile(path);
+  taosRemoveFile(path);
+  data = makeData(szData, 4);
+  writeFile(0, data, TD_FILE_READ | TD_FILE_WRITE | TD_FILE_CREATE | TD_FILE_TRUNC);
+
+  int64_t nHit = 0, nMiss = 0;
+  getStat(&nHit, &nMiss);
+  ASSERT_EQ(readFile(szData), data);
+  int64_t nHit2 = 0, nMiss2 = 0;
+  getStat(&nHit2, &nMiss2);
+  ASSERT_EQ(nHit2, nHit);
+  ASSERT_EQ(nMiss2, nMiss + 2);
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VNODE_TEST_UTIL_H
+#define VNODE_TEST_UTIL_H
+
+#include <gtest/gtest.h>
+
+#include <vnodeInt.h>
+#include "tsdb.h"
+#include "vnd.h"
+
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+// a zeroed vnode and tsdb linked to each other, the fixtures set the fields read by the module under test
+class VnodeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    pVnode = (SVnode *)taosMemoryCalloc(1, sizeof(SVnode));
+    pTsdb = (STsdb *)taosMemoryCalloc(1, sizeof(STsdb));
+    ASSERT_NE(pVnode, nullptr);
+    ASSERT_NE(pTsdb, nullptr);
+
+    pVnode->config.vgId = 2;
+    pVnode->numaNode = -1;
+    pVnode->pTsdb = pTsdb;
+    pTsdb->pVnode = pVnode;
+  }
+
+  void TearDown() override {
+    taosMemoryFree(pTsdb);
+    taosMemoryFree(pVnode);
+  }
+
+  SVnode *pVnode = NULL;
+  STsdb  *pTsdb = NULL;
+};
+
+#endif  // VNODE_TEST_UTIL_H
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <vector>
+
+#include "vnodeTestUtil.h"
+
+static TdThreadMutex        queueMutex;
+static std::vector<SRpcMsg> writeQueue;
+
+static int32_t putToWriteQueue(void *pMgmt, EQueueType qtype, SRpcMsg *pMsg) {
+  taosThreadMutexLock(&queueMutex);
+  writeQueue.push_back(*pMsg);
+  taosThreadMutexUnlock(&queueMutex);
+  return 0;
+}
+
+class VnodeWriteStallTest : public VnodeTest {
+ protected:
+  static void SetUpTestSuite() {
+    taosThreadMutexInit(&queueMutex, NULL);
+    vnodeTimer = taosTmrInit(TSDB_MAX_VNODES_PER_DB, MSECONDS_PER_TICK, 10000, "VND-TMR");
+    ASSERT_NE(vnodeTimer, nullptr);
+  }
+
+  static void TearDownTestSuite() {
+    taosTmrCleanUp(vnodeTimer);
+    vnodeTimer = NULL;
+    taosThreadMutexDestroy(&queueMutex);
+  }
+
+  void SetUp() override {
+    ASSERT_NO_FATAL_FAILURE(VnodeTest::SetUp());
+    pInUse = (SVBufPool *)taosMemoryCalloc(1, sizeof(SVBufPool));
+    pOnCommit = (SVBufPool *)taosMemoryCalloc(1, sizeof(SVBufPool));
+    ASSERT_NE(pInUse, nullptr);
+    ASSERT_NE(pOnCommit, nullptr);
+
+    taosThreadMutexInit(&pVnode->mutex, NULL);
+    pVnode->msgCb.putToQueueFp = putToWriteQueue;
+    pVnode->inUse = pInUse;
+    pInUse->node.size = 1000;
+    pVnode->writeStall.pDeferred = taosArrayInit(8, sizeof(SVDeferredWrite));
+    ASSERT_NE(pVnode->writeStall.pDeferred, nullptr);
+
+    maxDelay = tsVnodeWriteMaxDelay;
+    tsVnodeWriteMaxDelay = 20;
+    writeQueue.clear();
+  }
+
+  void TearDown() override {
+    vnodeStopDeferWrite(pVnode);
+    for (auto &msg : writeQueue) {
+      rpcFreeCont(msg.pCont);
+    }
+    writeQueue.clear();
+
+    tsVnodeWriteMaxDelay = maxDelay;
+    taosArrayDestroy(pVnode->writeStall.pDeferred);
+    taosThreadMutexDestroy(&pVnode->mutex);
+    taosMemoryFree(pOnCommit);
+    taosMemoryFree(pInUse);
+    VnodeTest::TearDown();
+  }
+
+  int64_t getWriteDelay() {
+    taosThreadMutexLock(&pVnode->mutex);
+    int64_t delayUs = vnodeGetWriteDelay(pVnode);
+    taosThreadMutexUnlock(&pVnode->mutex);
+    return delayUs;
+  }
+
+  SVnodeLoad getLoad() {
+    SVnodeLoad load = {0};
+    vnodeGetWriteStallLoad(pVnode, &load);
+    return load;
+  }
+
+  static SRpcMsg makeSubmitMsg(tmsg_t msgType = TDMT_VND_SUBMIT) {
+    SRpcMsg msg = {0};
+    msg.msgType = msgType;
+    msg.contLen = sizeof(SMsgHead);
+    msg.pCont = rpcMallocCont(msg.contLen);
+    return msg;
+  }
+
+  size_t waitWriteQueue(size_t size) {
+    for (int32_t i = 0; i < 1000; ++i) {
+      taosThreadMutexLock(&queueMutex);
+      size_t n = writeQueue.size();
+      taosThreadMutexUnlock(&queueMutex);
+      if (n >= size) return n;
+      taosMsleep(1);
+    }
+    return writeQueue.size();
+  }
+
+  SVBufPool *pInUse = NULL;
+  SVBufPool *pOnCommit = NULL;
+  int32_t    maxDelay = 0;
+};
+
+TEST_F(VnodeWriteStallTest, writeDelay) {
+  // no commit is running
+  pInUse->size = 1200;
+  ASSERT_EQ(getWriteDelay(), 0);
+
+  pVnode->onCommit = pOnCommit;
+  pInUse->size = 500;
+  ASSERT_EQ(getWriteDelay(), 0);
+
+  pInUse->size = 750;
+  ASSERT_EQ(getWriteDelay(), 0);
+
+  // linear from 75% to full
+  pInUse->size = 875;
+  ASSERT_EQ(getWriteDelay(), 10000);
+
+  pInUse->size = 1000;
+  ASSERT_EQ(getWriteDelay(), 20000);
+
+  pInUse->size = 1200;
+  ASSERT_EQ(getWriteDelay(), 20000);
+
+  tsVnodeWriteMaxDelay = 0;
+  ASSERT_EQ(getWriteDelay(), 0);
+}
+
+TEST_F(VnodeWriteStallTest, stallAccounting) {
+  vnodeRecordWriteStall(pVnode, 0);
+  vnodeRecordWriteStall(pVnode, 999);
+
+  SVnodeLoad load = getLoad();
+  ASSERT_EQ(load.writeStalls, 0);
+  ASSERT_EQ(load.writeStallTime, 0);
+
+  vnodeRecordWriteStall(pVnode, 1000);
+  vnodeRecordWriteStall(pVnode, 3500);
+
+  load = getLoad();
+  ASSERT_EQ(load.writeStalls, 2);
+  ASSERT_EQ(load.writeStallTime, 4);
+  ASSERT_EQ(load.writeDelays, 0);
+}
+
+TEST_F(VnodeWriteStallTest, deferWrite) {
+  SRpcMsg msg1 = makeSubmitMsg();
+  SRpcMsg msg2 = makeSubmitMsg(TDMT_VND_DROP_TABLE);
+  SRpcMsg msg3 = makeSubmitMsg();
+  SRpcMsg next = {0};
+
+  // not deferred without pressure, and only a submit starts deferring
+  ASSERT_FALSE(vnodeDeferWriteMsg(pVnode, &msg1));
+  pVnode->onCommit = pOnCommit;
+  pInUse->size = 1000;
+  ASSERT_FALSE(vnodeDeferWriteMsg(pVnode, &msg2));
+
+  int64_t st = taosGetTimestampUs();
+  ASSERT_TRUE(vnodeDeferWriteMsg(pVnode, &msg1));
+  ASSERT_EQ(getLoad().writeDelays, 0);
+
+  // the later writes are held behind it whatever their type, even if the pressure is gone
+  ASSERT_TRUE(vnodeDeferWriteMsg(pVnode, &msg2));
+  pVnode->onCommit = NULL;
+  ASSERT_TRUE(vnodeDeferWriteMsg(pVnode, &msg3));
+  ASSERT_FALSE(vnodeNextDeferredWrite(pVnode, &next));
+
+  // only the first one is put back to the write queue when the delay expires
+  ASSERT_EQ(waitWriteQueue(1), 1);
+  ASSERT_GE(taosGetTimestampUs() - st, 15000);
+  ASSERT_EQ(writeQueue[0].pCont, msg1.pCont);
+  taosMsleep(20);
+  ASSERT_EQ(writeQueue.size(), 1);
+
+  // a write arriving before it is popped again is held behind the others
+  SRpcMsg msg4 = makeSubmitMsg();
+  ASSERT_TRUE(vnodeDeferWriteMsg(pVnode, &msg4));
+
+  // it is not deferred again, and the held ones follow it in arrival order
+  ASSERT_FALSE(vnodeDeferWriteMsg(pVnode, &writeQueue[0]));
+  ASSERT_TRUE(vnodeNextDeferredWrite(pVnode, &next));
+  ASSERT_EQ(next.pCont, msg2.pCont);
+  ASSERT_TRUE(vnodeNextDeferredWrite(pVnode, &next));
+  ASSERT_EQ(next.pCont, msg3.pCont);
+  ASSERT_TRUE(vnodeNextDeferredWrite(pVnode, &next));
+  ASSERT_EQ(next.pCont, msg4.pCont);
+  ASSERT_FALSE(vnodeNextDeferredWrite(pVnode, &next));
+
+  SVnodeLoad load = getLoad();
+  ASSERT_EQ(load.writeDelays, 4);
+  ASSERT_GE(load.writeDelayTime, 20);
+
+  // nothing is held any more
+  SRpcMsg msg5 = makeSubmitMsg();
+  ASSERT_FALSE(vnodeDeferWriteMsg(pVnode, &msg5));
+  rpcFreeCont(msg2.pCont);
+  rpcFreeCont(msg3.pCont);
+  rpcFreeCont(msg4.pCont);
+
+  // the deferred writes are replied when the vnode is closing, and no more writes are deferred
+  pVnode->onCommit = pOnCommit;
+  ASSERT_TRUE(vnodeDeferWriteMsg(pVnode, &msg5));
+  SRpcMsg msg6 = makeSubmitMsg(TDMT_VND_DROP_TABLE);
+  ASSERT_TRUE(vnodeDeferWriteMsg(pVnode, &msg6));
+  vnodeStopDeferWrite(pVnode);
+  ASSERT_EQ(getLoad().writeDelays, 6);
+  SRpcMsg msg7 = makeSubmitMsg();
+  ASSERT_FALSE(vnodeDeferWriteMsg(pVnode, &msg7));
+
+  taosMsleep(50);
+  ASSERT_EQ(writeQueue.size(), 1);
+  rpcFreeCont(msg7.pCont);
+}
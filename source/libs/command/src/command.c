@@ -317,6 +317,10 @@ static void setCreateDBResultIntoDataBlock(SSDataBlock* pBlock, char* dbName, ch
     if (retentions) {
       len += sprintf(buf2 + VARSTR_HEADER_SIZE + len, " RETENTIONS %s", retentions);
     }
+
+    if (TSDB_STT_MERGE_POLICY_TIERED == pCfg->sttMergePolicy) {
+      len += sprintf(buf2 + VARSTR_HEADER_SIZE + len, " STT_MERGE_POLICY '%s'", TSDB_STT_MERGE_POLICY_TIERED_STR);
+    }
   }
 
   taosMemoryFree(retentions);
@@ -672,6 +676,21 @@ void appendTableOptions(char* buf, int32_t* len, SDbCfgInfo* pDbCfg, STableCfg*
       }
       *len += sprintf(buf + VARSTR_HEADER_SIZE + *len, ")");
     }
+
+    bool bloomOn = false;
+    for (int32_t i = 0; i < pCfg->numOfColumns; ++i) {
+      if (IS_BLOOM_ON(pCfg->pSchemas + i)) {
+        if (bloomOn) {
+          *len += sprintf(buf + VARSTR_HEADER_SIZE + *len, ",`%s`", (pCfg->pSchemas + i)->name);
+        } else {
+          bloomOn = true;
+          *len += sprintf(buf + VARSTR_HEADER_SIZE + *len, " BLOOM_FILTER(`%s`", (pCfg->pSchemas + i)->name);
+        }
+      }
+    }
+    if (bloomOn) {
+      *len += sprintf(buf + VARSTR_HEADER_SIZE + *len, ")");
+    }
   }
 }
 
@@ -430,6 +430,9 @@ int32_t qExplainResNodeToRowsImpl(SExplainResNode *pResNode, SExplainCtx *ctx, i
           info.loadBlockStatis += pScanInfo->loadBlockStatis;
           info.totalCheckedRows += pScanInfo->totalCheckedRows;
           info.filterOutBlocks += pScanInfo->filterOutBlocks;
+          info.readAheadBlocks += pScanInfo->readAheadBlocks;
+          info.readAheadHits += pScanInfo->readAheadHits;
+          info.readAheadWaits += pScanInfo->readAheadWaits;
 
           if (pScanInfo->totalRows > totalRows) {
             totalRows = pScanInfo->totalRows;
@@ -451,6 +454,17 @@ int32_t qExplainResNodeToRowsImpl(SExplainResNode *pResNode, SExplainCtx *ctx, i
 
         EXPLAIN_ROW_APPEND("check_rows=%.1f", ((double)info.totalCheckedRows) / nodeNum);
         EXPLAIN_ROW_APPEND(EXPLAIN_BLANK_FORMAT);
+
+        if (info.readAheadBlocks > 0) {
+          EXPLAIN_ROW_APPEND("read_ahead_blocks=%.1f", ((double)info.readAheadBlocks) / nodeNum);
+          EXPLAIN_ROW_APPEND(EXPLAIN_BLANK_FORMAT);
+
+          EXPLAIN_ROW_APPEND("read_ahead_hits=%.1f", ((double)info.readAheadHits) / nodeNum);
+          EXPLAIN_ROW_APPEND(EXPLAIN_BLANK_FORMAT);
+
+          EXPLAIN_ROW_APPEND("read_ahead_waits=%.1f", ((double)info.readAheadWaits) / nodeNum);
+          EXPLAIN_ROW_APPEND(EXPLAIN_BLANK_FORMAT);
+        }
         EXPLAIN_ROW_END();
 
         QRY_ERR_RET(qExplainResAppendRow(ctx, tbuf, tlen, level + 1));
@@ -832,6 +846,15 @@ int32_t qExplainResNodeToRowsImpl(SExplainResNode *pResNode, SExplainCtx *ctx, i
         EXPLAIN_ROW_APPEND("  loops:%d", pExecInfo->loops);
         EXPLAIN_ROW_END();
         QRY_ERR_RET(qExplainResAppendRow(ctx, tbuf, tlen, level));
+
+        if (execInfo->verboseLen >= sizeof(SSortExecInfo) && pExecInfo->writeBytes > 0) {
+          EXPLAIN_ROW_NEW(level + 1, "Spill: ");
+          EXPLAIN_ROW_APPEND("write:%.2f Kb", pExecInfo->writeBytes / 1024.0);
+          EXPLAIN_ROW_APPEND("  comp ratio:%.2f", pExecInfo->rawWriteBytes / (double)pExecInfo->writeBytes);
+          EXPLAIN_ROW_APPEND("  stall:%.3f ms", pExecInfo->stallTime / 1000.0);
+          EXPLAIN_ROW_END();
+          QRY_ERR_RET(qExplainResAppendRow(ctx, tbuf, tlen, level));
+        }
       }
 
       if (verbose) {
@@ -1189,6 +1212,15 @@ int32_t qExplainResNodeToRowsImpl(SExplainResNode *pResNode, SExplainCtx *ctx, i
           EXPLAIN_ROW_APPEND("  loops:%d", pExecInfo->loops);
           EXPLAIN_ROW_END();
           QRY_ERR_RET(qExplainResAppendRow(ctx, tbuf, tlen, level));
+
+          if (execInfo->verboseLen >= sizeof(SSortExecInfo) && pExecInfo->writeBytes > 0) {
+            EXPLAIN_ROW_NEW(level + 1, "Spill: ");
+            EXPLAIN_ROW_APPEND("write:%.2f Kb", pExecInfo->writeBytes / 1024.0);
+            EXPLAIN_ROW_APPEND("  comp ratio:%.2f", pExecInfo->rawWriteBytes / (double)pExecInfo->writeBytes);
+            EXPLAIN_ROW_APPEND("  stall:%.3f ms", pExecInfo->stallTime / 1000.0);
+            EXPLAIN_ROW_END();
+            QRY_ERR_RET(qExplainResAppendRow(ctx, tbuf, tlen, level));
+          }
         }
       }
 
@@ -1411,6 +1443,15 @@ int32_t qExplainResNodeToRowsImpl(SExplainResNode *pResNode, SExplainCtx *ctx, i
         EXPLAIN_ROW_APPEND("  loops:%d", pExecInfo->loops);
         EXPLAIN_ROW_END();
         QRY_ERR_RET(qExplainResAppendRow(ctx, tbuf, tlen, level));
+
+        if (execInfo->verboseLen >= sizeof(SSortExecInfo) && pExecInfo->writeBytes > 0) {
+          EXPLAIN_ROW_NEW(level + 1, "Spill: ");
+          EXPLAIN_ROW_APPEND("write:%.2f Kb", pExecInfo->writeBytes / 1024.0);
+          EXPLAIN_ROW_APPEND("  comp ratio:%.2f", pExecInfo->rawWriteBytes / (double)pExecInfo->writeBytes);
+          EXPLAIN_ROW_APPEND("  stall:%.3f ms", pExecInfo->stallTime / 1000.0);
+          EXPLAIN_ROW_END();
+          QRY_ERR_RET(qExplainResAppendRow(ctx, tbuf, tlen, level));
+        }
       }
 
       if (verbose) {
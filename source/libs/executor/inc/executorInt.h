@@ -34,6 +34,7 @@ extern "C" {
 #include "scalar.h"
 #include "taosdef.h"
 #include "tarray.h"
+#include "tbloomfilter.h"
 #include "tfill.h"
 #include "thash.h"
 #include "tlockfree.h"
@@ -44,6 +45,7 @@ extern "C" {
 #include "tlrucache.h"
 
 typedef int32_t (*__block_search_fn_t)(char* data, int32_t num, int64_t key, int32_t order);
+typedef int32_t (*__load_remain_cols_fn_t)(void* param, bool load);
 
 typedef struct STsdbReader STsdbReader;
 typedef struct STqReader   STqReader;
@@ -223,6 +225,8 @@ typedef struct SAggSupporter {
   SDiskbasedBuf* pResultBuf;           // query result buffer based on blocked-wised disk file
   int32_t        resultRowSize;  // the result buffer size for each result row, with the meta data size for each row
   int32_t        currentPageId;  // current write page id
+  int64_t        memCharged;     // memory of the result row hash table charged to the task memory budget
+  void*          pMemPool;       // the pool memCharged is charged to
 } SAggSupporter;
 
 typedef struct {
@@ -239,6 +243,19 @@ typedef struct STableMetaCacheInfo {
   uint64_t   cacheHit;
 } STableMetaCacheInfo;
 
+// join keys of the build side of a hash join, pushed down to the table scan of its probe side so that blocks and rows
+// which can not be matched are dropped in the scan.
+typedef struct SScanRuntimeFilter {
+  int32_t       slotId;  // slot of the key column in the result block of the table scan
+  int32_t       type;
+  bool          hasRange;  // min/max are valid, only for integer and timestamp keys
+  int64_t       min;
+  int64_t       max;
+  SBloomFilter* pBloom;  // NULL if the build side has more keys than the filter is sized for
+  int64_t       filterOutBlocks;
+  int64_t       filterOutRows;
+} SScanRuntimeFilter;
+
 typedef struct STableScanBase {
   STsdbReader*           dataReader;
   SFileBlockLoadRecorder readRecorder;
@@ -254,6 +271,8 @@ typedef struct STableScanBase {
   // there are more than one table list exists in one task, if only one vnode exists.
   STableListInfo* pTableListInfo;
   TsdReader       readerAPI;
+  SArray*         pFilterColIds;  // SArray<col_id_t>, columns in filter that are loaded ahead of the others
+  SScanRuntimeFilter* pRtFilter;  // owned by the hash join operator that pushes it down
 } STableScanBase;
 
 typedef struct STableScanInfo {
@@ -744,6 +763,10 @@ int32_t     getBufferPgSize(int32_t rowSize, uint32_t* defaultPgsz, uint32_t* de
 extern void doDestroyExchangeOperatorInfo(void* param);
 
 int32_t doFilter(SSDataBlock* pBlock, SFilterInfo* pFilterInfo, SColMatchInfo* pColMatchInfo);
+int32_t doFilterWithLateLoad(SSDataBlock* pBlock, SFilterInfo* pFilterInfo, SColMatchInfo* pColMatchInfo,
+                             __load_remain_cols_fn_t fp, void* param);
+bool    doFilterByRuntimeFilterSMA(SScanRuntimeFilter* pFilter, SSDataBlock* pBlock);
+void    doFilterByRuntimeFilter(SScanRuntimeFilter* pFilter, SSDataBlock* pBlock);
 int32_t addTagPseudoColumnData(SReadHandle* pHandle, const SExprInfo* pExpr, int32_t numOfExpr, SSDataBlock* pBlock,
                                int32_t rows, const char* idStr, STableMetaCacheInfo* pCache);
 
@@ -756,6 +779,7 @@ void clearResultRowInitFlag(SqlFunctionCtx* pCtx, int32_t numOfOutput);
 SResultRow* doSetResultOutBufByKey(SDiskbasedBuf* pResultBuf, SResultRowInfo* pResultRowInfo, char* pData,
                                    int32_t bytes, bool masterscan, uint64_t groupId, SExecTaskInfo* pTaskInfo,
                                    bool isIntervalQuery, SAggSupporter* pSup, bool keepGroup);
+void        chargeTaskMem(SExecTaskInfo* pTaskInfo, void** ppPool, int64_t* pCharged, int64_t size);
 
 int32_t projectApplyFunctions(SExprInfo* pExpr, SSDataBlock* pResult, SSDataBlock* pSrcBlock, SqlFunctionCtx* pCtx,
                               int32_t numOfOutput, SArray* pPseudoList);
@@ -21,6 +21,16 @@ extern "C" {
 
 #define HASH_JOIN_DEFAULT_PAGE_SIZE 10485760
 
+#define HASH_JOIN_SPILL_PART_BITS  4
+#define HASH_JOIN_SPILL_PART_NUM   (1 << HASH_JOIN_SPILL_PART_BITS)
+#define HASH_JOIN_SPILL_PAGE_SIZE  1048576
+#define HASH_JOIN_SPILL_BUF_SIZE   (32 * 1048576)
+#define HASH_JOIN_SPILL_BLOCK_ROWS 4096
+
+#define HASH_JOIN_RT_FILTER_DEF_KEYS   65536
+#define HASH_JOIN_RT_FILTER_MAX_KEYS   (8 * 1048576)
+#define HASH_JOIN_RT_FILTER_ERROR_RATE 0.01
+
 #pragma pack(push, 1) 
 typedef struct SBufRowInfo {
   void*    next;
@@ -46,6 +56,7 @@ typedef struct SHJoinColInfo {
   int32_t  dstSlot;
   bool     keyCol;
   bool     vardata;
+  int8_t   type;
   int32_t* offset;
   int32_t  bytes;
   char*    data;
@@ -90,8 +101,37 @@ typedef struct SHJoinExecInfo {
   int64_t probeBlkRows;
   int64_t resRows;
   int64_t expectRows;
+  int64_t spillBuildRows;
+  int64_t spillProbeRows;
 } SHJoinExecInfo;
 
+typedef struct SHJoinSpillPart {
+  SSDataBlock* pBuildBlk;    // rows not written to the spill buffer yet
+  SSDataBlock* pProbeBlk;
+  SArray*      pBuildPages;  // SArray<int32_t>, page ids in the spill buffer
+  SArray*      pProbePages;
+} SHJoinSpillPart;
+
+/*
+ * Once the build side exceeds memLimit or the memory budget of the task, the rows of partition 0 keep going into the key hash and the rows of the other
+ * partitions are written to disk. Probe rows of a spilled partition are matched against the key hash and also written
+ * to disk, each spilled partition is joined after the probe side is exhausted by rebuilding the key hash from its own
+ * build rows.
+ */
+typedef struct SHJoinSpillCtx {
+  int64_t         memLimit;
+  int64_t         memCharged;  // build side memory charged to the task memory budget
+  void*           pMemPool;    // the pool memCharged is charged to
+  bool            spilled;
+  bool            restoring;  // the probe side is exhausted, joining the spilled partitions
+  int32_t         partIdx;
+  int32_t         pageIdx;
+  SDiskbasedBuf*  pBuf;
+  SSDataBlock*    pBuildBlk;  // spilled rows loaded from the spill buffer
+  SSDataBlock*    pProbeBlk;
+  SHJoinSpillPart parts[HASH_JOIN_SPILL_PART_NUM];
+} SHJoinSpillCtx;
+
 
 typedef struct SHJoinOperatorInfo {
   int32_t          joinType;
@@ -107,6 +147,8 @@ typedef struct SHJoinOperatorInfo {
   bool             keyHashBuilt;
   SHJoinCtx        ctx;
   SHJoinExecInfo   execInfo;
+  SHJoinSpillCtx   spill;
+  SScanRuntimeFilter* pRtFilter;
 } SHJoinOperatorInfo;
 
 #ifdef __cplusplus
@@ -22,6 +22,9 @@ extern "C" {
 
 #define GET_TASKID(_t) (((SExecTaskInfo*)(_t))->id.str)
 
+#define TASK_MEM_POOL_CACHE_SIZE (16 * 1048576)  // freed column buffers cached by one task at most
+#define TASK_MEM_CHARGE_UNIT     (1048576)
+
 enum {
   // when this task starts to execute, this status will set
       TASK_NOT_COMPLETED = 0x1u,
@@ -97,6 +100,7 @@ struct SExecTaskInfo {
   int8_t                dynamicTask;
   SOperatorParam*       pOpParam;
   bool                  paramSet;
+  void*                 pMemPool;  // column buffers freed by the operators are reused within the task
 };
 
 void           buildTaskId(uint64_t taskId, uint64_t queryId, char* dst);
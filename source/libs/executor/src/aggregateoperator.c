@@ -28,6 +28,7 @@
 #include "tdatablock.h"
 #include "tglobal.h"
 #include "thash.h"
+#include "tmempool.h"
 #include "ttypes.h"
 #include "index.h"
 
@@ -501,6 +502,9 @@ int32_t doInitAggInfoSup(SAggSupporter* pAggSup, SqlFunctionCtx* pCtx, int32_t n
 void cleanupAggSup(SAggSupporter* pAggSup) {
   taosMemoryFreeClear(pAggSup->keyBuf);
   tSimpleHashCleanup(pAggSup->pResultRowHashTable);
+  taosMemClassPoolRelease(pAggSup->pMemPool, pAggSup->memCharged);
+  pAggSup->memCharged = 0;
+  pAggSup->pMemPool = NULL;
   destroyDiskbasedBuf(pAggSup->pResultBuf);
 }
 
@@ -21,22 +21,19 @@
 #include "tdatablock.h"
 #include "tglobal.h"
 #include "tqueue.h"
+#include "trpc.h"
 
 extern SDataSinkStat gDataSinkStat;
 
+// pData is an rpc message buffer with SRetrieveTableRsp headroom, so that it can be handed over to the fetch rsp as-is
 typedef struct SDataDispatchBuf {
-  int32_t useSize;
-  int32_t allocSize;
-  char*   pData;
-} SDataDispatchBuf;
-
-typedef struct SDataCacheEntry {
   int32_t dataLen;
+  int32_t allocSize;
   int32_t numOfRows;
   int32_t numOfCols;
   int8_t  compressed;
-  char    data[];
-} SDataCacheEntry;
+  char*   pData;
+} SDataDispatchBuf;
 
 typedef struct SDataDispatchHandle {
   SDataSinkHandle     sink;
@@ -54,7 +51,7 @@ typedef struct SDataDispatchHandle {
 // clang-format off
 // data format:
 // +----------------+------------------+--------------+--------------+------------------+--------------------------------------------+------------------------------------+-------------+-----------+-------------+-----------+
-// |SDataCacheEntry |  version         | total length | numOfRows    |     group id     | col1_schema | col2_schema | col3_schema... | column#1 length, column#2 length...| col1 bitmap | col1 data | col2 bitmap | col2 data |
+// |RetrieveTableRsp|  version         | total length | numOfRows    |     group id     | col1_schema | col2_schema | col3_schema... | column#1 length, column#2 length...| col1 bitmap | col1 data | col2 bitmap | col2 data |
 // |                |  sizeof(int32_t) |sizeof(int32) | sizeof(int32)| sizeof(uint64_t) | (sizeof(int8_t)+sizeof(int32_t))*numOfCols | sizeof(int32_t) * numOfCols        | actual size |           |                         |
 // +----------------+------------------+--------------+--------------+------------------+--------------------------------------------+------------------------------------+-------------+-----------+-------------+-----------+
 // The length of bitmap is decided by number of rows of this data block, and the length of each column data is
@@ -69,21 +66,13 @@ static void toDataCacheEntry(SDataDispatchHandle* pHandle, const SInputData* pIn
       ++numOfCols;
     }
   }
-  SDataCacheEntry* pEntry = (SDataCacheEntry*)pBuf->pData;
-  pEntry->compressed = 0;
-  pEntry->numOfRows = pInput->pData->info.rows;
-  pEntry->numOfCols = numOfCols;
-  pEntry->dataLen = 0;
-
-  pBuf->useSize = sizeof(SDataCacheEntry);
-  pEntry->dataLen = blockEncode(pInput->pData, pEntry->data, numOfCols);
-  //  ASSERT(pEntry->numOfRows == *(int32_t*)(pEntry->data + 8));
-  //  ASSERT(pEntry->numOfCols == *(int32_t*)(pEntry->data + 8 + 4));
-
-  pBuf->useSize += pEntry->dataLen;
+  pBuf->compressed = 0;
+  pBuf->numOfRows = pInput->pData->info.rows;
+  pBuf->numOfCols = numOfCols;
+  pBuf->dataLen = blockEncode(pInput->pData, ((SRetrieveTableRsp*)pBuf->pData)->data, numOfCols);
 
-  atomic_add_fetch_64(&pHandle->cachedSize, pEntry->dataLen);
-  atomic_add_fetch_64(&gDataSinkStat.cachedSize, pEntry->dataLen);
+  atomic_add_fetch_64(&pHandle->cachedSize, pBuf->dataLen);
+  atomic_add_fetch_64(&gDataSinkStat.cachedSize, pBuf->dataLen);
 }
 
 static bool allocBuf(SDataDispatchHandle* pDispatcher, const SInputData* pInput, SDataDispatchBuf* pBuf) {
@@ -96,9 +85,9 @@ static bool allocBuf(SDataDispatchHandle* pDispatcher, const SInputData* pInput,
     }
   */
 
-  pBuf->allocSize = sizeof(SDataCacheEntry) + blockGetEncodeSize(pInput->pData);
+  pBuf->allocSize = sizeof(SRetrieveTableRsp) + blockGetEncodeSize(pInput->pData);
 
-  pBuf->pData = taosMemoryMalloc(pBuf->allocSize);
+  pBuf->pData = rpcMallocCont(pBuf->allocSize);
   if (pBuf->pData == NULL) {
     qError("SinkNode failed to malloc memory, size:%d, code:%d", pBuf->allocSize, TAOS_SYSTEM_ERROR(errno));
   }
@@ -178,15 +167,9 @@ static void getDataLength(SDataSinkHandle* pHandle, int64_t* pLen, bool* pQueryE
     taosFreeQitem(pBuf);
   }
 
-  SDataCacheEntry* pEntry = (SDataCacheEntry*)pDispatcher->nextOutput.pData;
-  *pLen = pEntry->dataLen;
-
-  //  ASSERT(pEntry->numOfRows == *(int32_t*)(pEntry->data + 8));
-  //  ASSERT(pEntry->numOfCols == *(int32_t*)(pEntry->data + 8 + 4));
-
+  *pLen = pDispatcher->nextOutput.dataLen;
   *pQueryEnd = pDispatcher->queryEnd;
-  qDebug("got data len %" PRId64 ", row num %d in sink", *pLen,
-         ((SDataCacheEntry*)(pDispatcher->nextOutput.pData))->numOfRows);
+  qDebug("got data len %" PRId64 ", row num %d in sink", *pLen, pDispatcher->nextOutput.numOfRows);
 }
 
 
@@ -200,16 +183,23 @@ static int32_t getDataBlock(SDataSinkHandle* pHandle, SOutputData* pOutput) {
     pOutput->queryEnd = pDispatcher->queryEnd;
     return TSDB_CODE_SUCCESS;
   }
-  SDataCacheEntry* pEntry = (SDataCacheEntry*)(pDispatcher->nextOutput.pData);
-  memcpy(pOutput->pData, pEntry->data, pEntry->dataLen);
-  pOutput->numOfRows = pEntry->numOfRows;
-  pOutput->numOfCols = pEntry->numOfCols;
-  pOutput->compressed = pEntry->compressed;
+  SDataDispatchBuf* pBuf = &pDispatcher->nextOutput;
+  if (pOutput->rpcBuf) {
+    // hand the encoded block over together with its zeroed rsp headroom, the caller owns it from now on
+    pOutput->pRsp = pBuf->pData;
+    pBuf->pData = NULL;
+  } else {
+    memcpy(pOutput->pData, ((SRetrieveTableRsp*)pBuf->pData)->data, pBuf->dataLen);
+    rpcFreeCont(pBuf->pData);
+    pBuf->pData = NULL;
+  }
+  pOutput->numOfRows = pBuf->numOfRows;
+  pOutput->numOfCols = pBuf->numOfCols;
+  pOutput->compressed = pBuf->compressed;
 
-  atomic_sub_fetch_64(&pDispatcher->cachedSize, pEntry->dataLen);
-  atomic_sub_fetch_64(&gDataSinkStat.cachedSize, pEntry->dataLen);
+  atomic_sub_fetch_64(&pDispatcher->cachedSize, pBuf->dataLen);
+  atomic_sub_fetch_64(&gDataSinkStat.cachedSize, pBuf->dataLen);
 
-  taosMemoryFreeClear(pDispatcher->nextOutput.pData);  // todo persistent
   pOutput->bufStatus = updateStatus(pDispatcher);
   taosThreadMutexLock(&pDispatcher->mutex);
   pOutput->queryEnd = pDispatcher->queryEnd;
@@ -223,12 +213,13 @@ static int32_t getDataBlock(SDataSinkHandle* pHandle, SOutputData* pOutput) {
 static int32_t destroyDataSinker(SDataSinkHandle* pHandle) {
   SDataDispatchHandle* pDispatcher = (SDataDispatchHandle*)pHandle;
   atomic_sub_fetch_64(&gDataSinkStat.cachedSize, pDispatcher->cachedSize);
-  taosMemoryFreeClear(pDispatcher->nextOutput.pData);
+  rpcFreeCont(pDispatcher->nextOutput.pData);
+  pDispatcher->nextOutput.pData = NULL;
   while (!taosQueueEmpty(pDispatcher->pDataBlocks)) {
     SDataDispatchBuf* pBuf = NULL;
     taosReadQitem(pDispatcher->pDataBlocks, (void**)&pBuf);
     if (pBuf != NULL) {
-      taosMemoryFreeClear(pBuf->pData);
+      rpcFreeCont(pBuf->pData);
       taosFreeQitem(pBuf);
     }
   }
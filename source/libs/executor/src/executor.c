@@ -21,6 +21,7 @@
 #include "planner.h"
 #include "querytask.h"
 #include "tdatablock.h"
+#include "tmempool.h"
 #include "tref.h"
 #include "tudf.h"
 
@@ -596,11 +597,14 @@ int32_t qExecTaskOpt(qTaskInfo_t tinfo, SArray* pResList, uint64_t* useconds, bo
     return TSDB_CODE_SUCCESS;
   }
 
+  mcpool_h prevPool = taosMemClassPoolSwitch(pTaskInfo->pMemPool);
+
   // error occurs, record the error code and return to client
   int32_t ret = setjmp(pTaskInfo->env);
   if (ret != TSDB_CODE_SUCCESS) {
     pTaskInfo->code = ret;
     cleanUpUdfs();
+    taosMemClassPoolSwitch(prevPool);
 
     qDebug("%s task abort due to error/cancel occurs, code:%s", GET_TASKID(pTaskInfo), tstrerror(pTaskInfo->code));
     atomic_store_64(&pTaskInfo->owner, 0);
@@ -663,6 +667,7 @@ int32_t qExecTaskOpt(qTaskInfo_t tinfo, SArray* pResList, uint64_t* useconds, bo
   }
 
   cleanUpUdfs();
+  taosMemClassPoolSwitch(prevPool);
 
   uint64_t total = pTaskInfo->pRoot->resultInfo.totalRows;
   qDebug("%s task suspended, %d rows in %d blocks returned, total:%" PRId64 " rows, in sinkNode:%d, elapsed:%.2f ms",
@@ -717,11 +722,14 @@ int32_t qExecTask(qTaskInfo_t tinfo, SSDataBlock** pRes, uint64_t* useconds) {
     pTaskInfo->cost.start = taosGetTimestampUs();
   }
 
+  mcpool_h prevPool = taosMemClassPoolSwitch(pTaskInfo->pMemPool);
+
   // error occurs, record the error code and return to client
   int32_t ret = setjmp(pTaskInfo->env);
   if (ret != TSDB_CODE_SUCCESS) {
     pTaskInfo->code = ret;
     cleanUpUdfs();
+    taosMemClassPoolSwitch(prevPool);
     qDebug("%s task abort due to error/cancel occurs, code:%s", GET_TASKID(pTaskInfo), tstrerror(pTaskInfo->code));
     atomic_store_64(&pTaskInfo->owner, 0);
     return pTaskInfo->code;
@@ -740,6 +748,7 @@ int32_t qExecTask(qTaskInfo_t tinfo, SSDataBlock** pRes, uint64_t* useconds) {
   }
 
   cleanUpUdfs();
+  taosMemClassPoolSwitch(prevPool);
 
   int32_t  current = (*pRes != NULL) ? (*pRes)->info.rows : 0;
   uint64_t total = pTaskInfo->pRoot->resultInfo.totalRows;
@@ -874,6 +883,18 @@ void qDestroyTask(qTaskInfo_t qTaskHandle) {
   doDestroyTask(pTaskInfo);
 }
 
+int64_t qGetTaskMemPeak(qTaskInfo_t tinfo) {
+  SExecTaskInfo* pTaskInfo = (SExecTaskInfo*)tinfo;
+  return (pTaskInfo == NULL) ? 0 : taosMemClassPoolPeak(pTaskInfo->pMemPool);
+}
+
+void qSetTaskMemBudget(qTaskInfo_t tinfo, __mem_reserve_fn_t reserveFp, __mem_release_fn_t releaseFp, void* param) {
+  SExecTaskInfo* pTaskInfo = (SExecTaskInfo*)tinfo;
+  if (pTaskInfo != NULL) {
+    taosMemClassPoolSetCtrl(pTaskInfo->pMemPool, reserveFp, releaseFp, param);
+  }
+}
+
 int32_t qGetExplainExecInfo(qTaskInfo_t tinfo, SArray* pExecInfoList) {
   SExecTaskInfo* pTaskInfo = (SExecTaskInfo*)tinfo;
   return getOperatorExplainExecInfo(pTaskInfo->pRoot, pExecInfoList);
@@ -33,6 +33,7 @@
 #include "storageapi.h"
 #include "tcompare.h"
 #include "thash.h"
+#include "tmempool.h"
 #include "ttypes.h"
 
 #define SET_REVERSE_SCAN_FLAG(runtime)    ((runtime)->scanFlag = REVERSE_SCAN)
@@ -195,6 +196,12 @@ SResultRow* doSetResultOutBufByKey(SDiskbasedBuf* pResultBuf, SResultRowInfo* pR
     SResultRowPosition pos = {.pageId = pResult->pageId, .offset = pResult->offset};
     tSimpleHashPut(pSup->pResultRowHashTable, pSup->keyBuf, GET_RES_WINDOW_KEY_LEN(bytes), &pos,
                    sizeof(SResultRowPosition));
+
+    // the hash table can not be spilled, the query fails if it grows beyond the memory budget
+    int64_t memSize = tSimpleHashGetMemSize(pSup->pResultRowHashTable) +
+                      tSimpleHashGetSize(pSup->pResultRowHashTable) *
+                          (GET_RES_WINDOW_KEY_LEN(bytes) + sizeof(SResultRowPosition));
+    chargeTaskMem(pTaskInfo, &pSup->pMemPool, &pSup->memCharged, memSize);
   }
 
   // 2. set the new time window to be the new active time window
@@ -209,6 +216,24 @@ SResultRow* doSetResultOutBufByKey(SDiskbasedBuf* pResultBuf, SResultRowInfo* pR
   return pResult;
 }
 
+// the pool is kept in *ppPool, so that the charge is released to it even if another pool is current by then
+void chargeTaskMem(SExecTaskInfo* pTaskInfo, void** ppPool, int64_t* pCharged, int64_t size) {
+  if (size <= *pCharged) {
+    return;
+  }
+
+  // charged by chunk, so the budget is not asked for every new entry
+  int64_t delta = (size - *pCharged + TASK_MEM_CHARGE_UNIT - 1) / TASK_MEM_CHARGE_UNIT * TASK_MEM_CHARGE_UNIT;
+  if (!taosMemClassPoolReserve(pTaskInfo->pMemPool, delta, false)) {
+    qError("%s memory budget of task is used up, charged:%" PRId64 ", required:%" PRId64, GET_TASKID(pTaskInfo),
+           *pCharged, delta);
+    T_LONG_JMP(pTaskInfo->env, TSDB_CODE_QRY_NOT_ENOUGH_BUFFER);
+  }
+
+  *ppPool = pTaskInfo->pMemPool;
+  *pCharged += delta;
+}
+
 //  query_range_start, query_range_end, window_duration, window_start, window_end
 void initExecTimeWindowInfo(SColumnInfoData* pColData, STimeWindow* pQueryWindow) {
   pColData->info.type = TSDB_DATA_TYPE_TIMESTAMP;
@@ -501,20 +526,31 @@ void clearResultRowInitFlag(SqlFunctionCtx* pCtx, int32_t numOfOutput) {
 }
 
 int32_t doFilter(SSDataBlock* pBlock, SFilterInfo* pFilterInfo, SColMatchInfo* pColMatchInfo) {
+  return doFilterWithLateLoad(pBlock, pFilterInfo, pColMatchInfo, NULL, NULL);
+}
+
+// the columns that are not involved in the filter may be absent in pBlock, and they are loaded by fp before the
+// unqualified rows are removed. fp is invoked exactly once, and with load=false if no rows are qualified.
+int32_t doFilterWithLateLoad(SSDataBlock* pBlock, SFilterInfo* pFilterInfo, SColMatchInfo* pColMatchInfo,
+                             __load_remain_cols_fn_t fp, void* param) {
   if (pFilterInfo == NULL || pBlock->info.rows == 0) {
-    return TSDB_CODE_SUCCESS;
+    return (fp != NULL) ? fp(param, pBlock->info.rows > 0) : TSDB_CODE_SUCCESS;
   }
 
   SFilterColumnParam param1 = {.numOfCols = taosArrayGetSize(pBlock->pDataBlock), .pDataBlock = pBlock->pDataBlock};
   SColumnInfoData*   p = NULL;
+  int32_t            status = 0;
 
   int32_t code = filterSetDataFromSlotId(pFilterInfo, &param1);
-  if (code != TSDB_CODE_SUCCESS) {
-    goto _err;
+  if (code == TSDB_CODE_SUCCESS) {
+    code = filterExecute(pFilterInfo, pBlock, &p, NULL, param1.numOfCols, &status);
+  }
+
+  if (fp != NULL) {
+    int32_t ret = fp(param, (code == TSDB_CODE_SUCCESS) && (status != FILTER_RESULT_NONE_QUALIFIED));
+    code = (code == TSDB_CODE_SUCCESS) ? ret : code;
   }
 
-  int32_t status = 0;
-  code = filterExecute(pFilterInfo, pBlock, &p, NULL, param1.numOfCols, &status);
   if (code != TSDB_CODE_SUCCESS) {
     goto _err;
   }
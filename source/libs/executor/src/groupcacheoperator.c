@@ -148,13 +148,13 @@ void blockDataDeepCleanup(SSDataBlock* pDataBlock) {
   size_t numOfCols = taosArrayGetSize(pDataBlock->pDataBlock);
   for (int32_t i = 0; i < numOfCols; ++i) {
     SColumnInfoData* p = taosArrayGet(pDataBlock->pDataBlock, i);
-    taosMemoryFreeClear(p->pData);
+    colDataDestroy(p);
     if (IS_VAR_DATA_TYPE(p->info.type)) {
-      taosMemoryFreeClear(p->varmeta.offset);
+      p->varmeta.offset = NULL;
       p->varmeta.length = 0;
       p->varmeta.allocLen = 0;
     } else {
-      taosMemoryFreeClear(p->nullbitmap);
+      p->nullbitmap = NULL;
     }
   }
   pDataBlock->info.capacity = 0;
@@ -450,6 +450,7 @@ void blockDataDeepClear(SSDataBlock* pDataBlock) {
   for (int32_t i = 0; i < numOfCols; ++i) {
     SColumnInfoData* p = taosArrayGet(pDataBlock->pDataBlock, i);
     p->pData = NULL;
+    p->pooled = false;
     if (IS_VAR_DATA_TYPE(p->info.type)) {
       p->varmeta.offset = NULL;
       p->varmeta.length = 0;
@@ -22,7 +22,9 @@
 #include "querytask.h"
 #include "tcompare.h"
 #include "tdatablock.h"
+#include "tglobal.h"
 #include "thash.h"
+#include "tmempool.h"
 #include "tmsg.h"
 #include "ttypes.h"
 #include "hashjoin.h"
@@ -67,6 +69,7 @@ static int32_t initHJoinKeyColsInfo(SHJoinTableInfo* pTable, SNodeList* pList) {
     SColumnNode* pColNode = (SColumnNode*)pNode;
     pTable->keyCols[i].srcSlot = pColNode->slotId;
     pTable->keyCols[i].vardata = IS_VAR_DATA_TYPE(pColNode->node.resType.type);
+    pTable->keyCols[i].type = pColNode->node.resType.type;
     pTable->keyCols[i].bytes = pColNode->node.resType.bytes;
     bufSize += pColNode->node.resType.bytes;
     ++i;
@@ -95,10 +98,9 @@ static void getHJoinValColNum(SNodeList* pList, int32_t blkId, int32_t* colNum)
   }
 }
 
-static bool valColInKeyCols(int16_t slotId, int32_t keyNum, SHJoinColInfo* pKeys, int32_t* pKeyIdx) {
+static bool valColInKeyCols(int16_t slotId, int32_t keyNum, SHJoinColInfo* pKeys) {
   for (int32_t i = 0; i < keyNum; ++i) {
     if (pKeys[i].srcSlot == slotId) {
-      *pKeyIdx = i;
       return true;
     }
   }
@@ -124,11 +126,12 @@ static int32_t initJoinValColsInfo(SHJoinTableInfo* pTable, SNodeList* pList) {
     STargetNode* pTarget = (STargetNode*)pNode;
     SColumnNode* pColNode = (SColumnNode*)pTarget->pExpr;
     if (pColNode->dataBlockId == pTable->blkId) {
-      if (valColInKeyCols(pColNode->slotId, pTable->keyNum, pTable->keyCols, &pTable->valCols[i].srcSlot)) {
+      // the probe side copies the key columns from its block too, so srcSlot is always the slot of the column
+      pTable->valCols[i].srcSlot = pColNode->slotId;
+      if (valColInKeyCols(pColNode->slotId, pTable->keyNum, pTable->keyCols)) {
         pTable->valCols[i].keyCol = true;
       } else {
         pTable->valCols[i].keyCol = false;
-        pTable->valCols[i].srcSlot = pColNode->slotId;
         pTable->valColExist = true;
         colNum++;
       }
@@ -275,14 +278,10 @@ static void freeHJoinBufPage(void* param) {
   taosMemoryFree(pInfo->data);
 }
 
-static void destroyHJoinKeyHash(SSHashObj** ppHash) {
-  if (NULL == ppHash || NULL == (*ppHash)) {
-    return;
-  }
-
+static void freeHJoinKeyHashRows(SSHashObj* pHash) {
   void*   pIte = NULL;
   int32_t iter = 0;
-  while ((pIte = tSimpleHashIterate(*ppHash, pIte, &iter)) != NULL) {
+  while ((pIte = tSimpleHashIterate(pHash, pIte, &iter)) != NULL) {
     SGroupData* pGroup = pIte;
     SBufRowInfo* pRow = pGroup->rows;
     SBufRowInfo* pNext = NULL;
@@ -292,18 +291,74 @@ static void destroyHJoinKeyHash(SSHashObj** ppHash) {
       pRow = pNext;
     }
   }
+}
+
+static void destroyHJoinKeyHash(SSHashObj** ppHash) {
+  if (NULL == ppHash || NULL == (*ppHash)) {
+    return;
+  }
 
+  freeHJoinKeyHashRows(*ppHash);
   tSimpleHashCleanup(*ppHash);
   *ppHash = NULL;
 }
 
+static void resetHJoinKeyHash(SHJoinOperatorInfo* pJoin) {
+  freeHJoinKeyHashRows(pJoin->pKeyHash);
+  tSimpleHashClear(pJoin->pKeyHash);
+
+  while (taosArrayGetSize(pJoin->pRowBufs) > 1) {
+    freeHJoinBufPage(taosArrayPop(pJoin->pRowBufs));
+  }
+  SBufPageInfo* pPage = taosArrayGet(pJoin->pRowBufs, 0);
+  pPage->offset = 0;
+}
+
+static void destroyHJoinSpill(SHJoinSpillCtx* pSpill) {
+  for (int32_t i = 0; i < HASH_JOIN_SPILL_PART_NUM; ++i) {
+    SHJoinSpillPart* pPart = &pSpill->parts[i];
+    pPart->pBuildBlk = blockDataDestroy(pPart->pBuildBlk);
+    pPart->pProbeBlk = blockDataDestroy(pPart->pProbeBlk);
+    taosArrayDestroy(pPart->pBuildPages);
+    taosArrayDestroy(pPart->pProbePages);
+    pPart->pBuildPages = NULL;
+    pPart->pProbePages = NULL;
+  }
+
+  pSpill->pBuildBlk = blockDataDestroy(pSpill->pBuildBlk);
+  pSpill->pProbeBlk = blockDataDestroy(pSpill->pProbeBlk);
+  destroyDiskbasedBuf(pSpill->pBuf);
+  pSpill->pBuf = NULL;
+
+  taosMemClassPoolRelease(pSpill->pMemPool, pSpill->memCharged);
+  pSpill->memCharged = 0;
+  pSpill->pMemPool = NULL;
+}
+
+static void destroyHJoinRtFilter(SScanRuntimeFilter** ppFilter) {
+  if (NULL == *ppFilter) {
+    return;
+  }
+
+  tBloomFilterDestroy((*ppFilter)->pBloom);
+  taosMemoryFreeClear(*ppFilter);
+}
+
 static void destroyHashJoinOperator(void* param) {
   SHJoinOperatorInfo* pJoinOperator = (SHJoinOperatorInfo*)param;
-  qError("hashJoin exec info, buildBlk:%" PRId64 ", buildRows:%" PRId64 ", probeBlk:%" PRId64 ", probeRows:%" PRId64 ", resRows:%" PRId64, 
+  qError("hashJoin exec info, buildBlk:%" PRId64 ", buildRows:%" PRId64 ", probeBlk:%" PRId64 ", probeRows:%" PRId64 ", resRows:%" PRId64
+         ", spillBuildRows:%" PRId64 ", spillProbeRows:%" PRId64, 
          pJoinOperator->execInfo.buildBlkNum, pJoinOperator->execInfo.buildBlkRows, pJoinOperator->execInfo.probeBlkNum, 
-         pJoinOperator->execInfo.probeBlkRows, pJoinOperator->execInfo.resRows);
+         pJoinOperator->execInfo.probeBlkRows, pJoinOperator->execInfo.resRows, pJoinOperator->execInfo.spillBuildRows,
+         pJoinOperator->execInfo.spillProbeRows);
+  if (pJoinOperator->pRtFilter) {
+    qDebug("hashJoin runtime filter, filterOutBlocks:%" PRId64 ", filterOutRows:%" PRId64,
+           pJoinOperator->pRtFilter->filterOutBlocks, pJoinOperator->pRtFilter->filterOutRows);
+  }
 
   destroyHJoinKeyHash(&pJoinOperator->pKeyHash);
+  destroyHJoinSpill(&pJoinOperator->spill);
+  destroyHJoinRtFilter(&pJoinOperator->pRtFilter);
 
   freeHJoinTableInfo(&pJoinOperator->tbs[0]);
   freeHJoinTableInfo(&pJoinOperator->tbs[1]);
@@ -672,16 +727,191 @@ static int32_t addRowToHash(SHJoinOperatorInfo* pJoin, SSDataBlock* pBlock, size
   return TSDB_CODE_SUCCESS;
 }
 
+static FORCE_INLINE int32_t getHJoinSpillPart(char* pKey, size_t keyLen) {
+  return MurmurHash3_32(pKey, keyLen) >> (32 - HASH_JOIN_SPILL_PART_BITS);
+}
+
+static int32_t flushHJoinSpillBlock(SDiskbasedBuf* pBuf, SSDataBlock* pBlock, SArray* pPages) {
+  int32_t start = 0;
+  while (start < pBlock->info.rows) {
+    int32_t stop = 0;
+    blockDataSplitRows(pBlock, pBlock->info.hasVarCol, start, &stop, getBufPageSize(pBuf));
+    SSDataBlock* p = blockDataExtractBlock(pBlock, start, stop - start + 1);
+    if (p == NULL) {
+      return terrno;
+    }
+
+    int32_t pageId = -1;
+    void*   pPage = getNewBufPage(pBuf, &pageId);
+    if (pPage == NULL) {
+      blockDataDestroy(p);
+      return terrno;
+    }
+
+    blockDataToBuf(pPage, p);
+    setBufPageDirty(pPage, true);
+    releaseBufPage(pBuf, pPage);
+    blockDataDestroy(p);
+
+    taosArrayPush(pPages, &pageId);
+    start = stop + 1;
+  }
+
+  blockDataCleanup(pBlock);
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t loadHJoinSpillBlock(SDiskbasedBuf* pBuf, int32_t pageId, SSDataBlock* pBlock) {
+  void* pPage = getBufPage(pBuf, pageId);
+  if (pPage == NULL) {
+    return terrno;
+  }
+
+  int32_t code = blockDataFromBuf(pBlock, pPage);
+  releaseBufPage(pBuf, pPage);
+  return code;
+}
+
+static int32_t addRowToHJoinSpillPart(SHJoinOperatorInfo* pJoin, SSDataBlock** ppStage, SArray* pPages,
+                                      SSDataBlock* pBlock, int32_t rowIdx) {
+  int32_t code = TSDB_CODE_SUCCESS;
+  if (NULL == *ppStage) {
+    *ppStage = createOneDataBlock(pBlock, false);
+    if (NULL == *ppStage) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+    code = blockDataEnsureCapacity(*ppStage, HASH_JOIN_SPILL_BLOCK_ROWS);
+    if (code) {
+      return code;
+    }
+  }
+
+  SSDataBlock* pStage = *ppStage;
+  if (pStage->info.rows >= HASH_JOIN_SPILL_BLOCK_ROWS) {
+    code = flushHJoinSpillBlock(pJoin->spill.pBuf, pStage, pPages);
+    if (code) {
+      return code;
+    }
+  }
+
+  int32_t numOfCols = taosArrayGetSize(pBlock->pDataBlock);
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    SColumnInfoData* pSrc = taosArrayGet(pBlock->pDataBlock, i);
+    SColumnInfoData* pDst = taosArrayGet(pStage->pDataBlock, i);
+    bool             isNull = colDataIsNull_s(pSrc, rowIdx);
+    code = colDataSetVal(pDst, pStage->info.rows, isNull ? NULL : colDataGetData(pSrc, rowIdx), isNull);
+    if (code) {
+      return code;
+    }
+  }
+
+  pStage->info.rows++;
+  return TSDB_CODE_SUCCESS;
+}
+
+static int64_t getHJoinBuildMemSize(SHJoinOperatorInfo* pJoin) {
+  return (int64_t)taosArrayGetSize(pJoin->pRowBufs) * HASH_JOIN_DEFAULT_PAGE_SIZE +
+         tSimpleHashGetMemSize(pJoin->pKeyHash) + pJoin->execInfo.buildBlkRows * (int64_t)sizeof(SBufRowInfo);
+}
+
+// the build side spills as soon as the memory budget of the task refuses it, even below memLimit
+static bool isHJoinBuildOverBudget(SExecTaskInfo* pTaskInfo, SHJoinOperatorInfo* pJoin) {
+  SHJoinSpillCtx* pSpill = &pJoin->spill;
+  int64_t         memSize = getHJoinBuildMemSize(pJoin);
+  if (memSize <= pSpill->memCharged) {
+    return false;
+  }
+
+  if (!taosMemClassPoolReserve(pTaskInfo->pMemPool, memSize - pSpill->memCharged, true)) {
+    return true;
+  }
+
+  pSpill->pMemPool = pTaskInfo->pMemPool;
+  pSpill->memCharged = memSize;
+  return memSize > pSpill->memLimit;
+}
+
+static int32_t initHJoinSpill(struct SOperatorInfo* pOperator) {
+  SHJoinOperatorInfo* pJoin = pOperator->info;
+  SHJoinSpillCtx*     pSpill = &pJoin->spill;
+
+  if (!osTempSpaceAvailable()) {
+    qWarn("%s hash join keeps building in memory since no disk space to spill, tempDir:%s",
+          GET_TASKID(pOperator->pTaskInfo), tsTempDir);
+    pSpill->memLimit = 0;
+    return TSDB_CODE_SUCCESS;
+  }
+
+  int32_t code =
+      createDiskbasedBuf(&pSpill->pBuf, HASH_JOIN_SPILL_PAGE_SIZE, HASH_JOIN_SPILL_BUF_SIZE, "hashJoinSpillBuf", tsTempDir);
+  if (code) {
+    return code;
+  }
+
+  for (int32_t i = 1; i < HASH_JOIN_SPILL_PART_NUM; ++i) {
+    pSpill->parts[i].pBuildPages = taosArrayInit(4, sizeof(int32_t));
+    pSpill->parts[i].pProbePages = taosArrayInit(4, sizeof(int32_t));
+    if (NULL == pSpill->parts[i].pBuildPages || NULL == pSpill->parts[i].pProbePages) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+  }
+
+  pSpill->spilled = true;
+  qDebug("%s hash join starts to spill, buildRows:%" PRId64 ", memSize:%" PRId64 ", memLimit:%" PRId64,
+         GET_TASKID(pOperator->pTaskInfo), pJoin->execInfo.buildBlkRows, getHJoinBuildMemSize(pJoin), pSpill->memLimit);
+  return TSDB_CODE_SUCCESS;
+}
+
+static void addKeyToHJoinRtFilter(SScanRuntimeFilter* pFilter, char* pKey, size_t keyLen) {
+  if (pFilter->hasRange) {
+    int64_t v = 0;
+    GET_TYPED_DATA(v, int64_t, pFilter->type, pKey);
+    pFilter->min = TMIN(pFilter->min, v);
+    pFilter->max = TMAX(pFilter->max, v);
+  }
+
+  if (pFilter->pBloom) {
+    if (tBloomFilterIsFull(pFilter->pBloom)) {
+      tBloomFilterDestroy(pFilter->pBloom);
+      pFilter->pBloom = NULL;
+    } else {
+      tBloomFilterPut(pFilter->pBloom, pKey, keyLen);
+    }
+  }
+}
+
 static int32_t addBlockRowsToHash(SSDataBlock* pBlock, SHJoinOperatorInfo* pJoin) {
   SHJoinTableInfo* pBuild = pJoin->pBuild;
+  SHJoinSpillCtx*  pSpill = &pJoin->spill;
   int32_t code = setKeyColsData(pBlock, pBuild);
   if (code) {
     return code;
   }
 
+  // the spilled partitions are rebuilt while restoring, neither the spill nor the runtime filter applies to them
+  bool             spill = pSpill->spilled && !pSpill->restoring;
+  SColumnInfoData* pKeyCol =
+      (pJoin->pRtFilter && !pSpill->restoring) ? taosArrayGet(pBlock->pDataBlock, pBuild->keyCols[0].srcSlot) : NULL;
+
   size_t bufLen = 0;
   for (int32_t i = 0; i < pBlock->info.rows; ++i) {
     copyKeyColsDataToBuf(pBuild, i, &bufLen);
+    if (pKeyCol && !colDataIsNull_s(pKeyCol, i)) {
+      addKeyToHJoinRtFilter(pJoin->pRtFilter, pBuild->keyData, bufLen);
+    }
+
+    if (spill) {
+      int32_t part = getHJoinSpillPart(pBuild->keyData, bufLen);
+      if (part != 0) {
+        code = addRowToHJoinSpillPart(pJoin, &pSpill->parts[part].pBuildBlk, pSpill->parts[part].pBuildPages, pBlock, i);
+        if (code) {
+          return code;
+        }
+        pJoin->execInfo.spillBuildRows++;
+        continue;
+      }
+    }
+
     code = addRowToHash(pJoin, pBlock, bufLen, i);
     if (code) {
       return code;
@@ -693,6 +923,7 @@ static int32_t addBlockRowsToHash(SSDataBlock* pBlock, SHJoinOperatorInfo* pJoin
 
 static int32_t buildHJoinKeyHash(struct SOperatorInfo* pOperator) {
   SHJoinOperatorInfo* pJoin = pOperator->info;
+  SHJoinSpillCtx* pSpill = &pJoin->spill;
   SSDataBlock* pBlock = NULL;
   int32_t code = TSDB_CODE_SUCCESS;
   
@@ -709,11 +940,220 @@ static int32_t buildHJoinKeyHash(struct SOperatorInfo* pOperator) {
     if (code) {
       return code;
     }
+
+    if (!pSpill->spilled && pSpill->memLimit > 0 && isHJoinBuildOverBudget(pOperator->pTaskInfo, pJoin)) {
+      code = initHJoinSpill(pOperator);
+      if (code) {
+        return code;
+      }
+    }
+  }
+
+  if (pSpill->spilled) {
+    for (int32_t i = 1; i < HASH_JOIN_SPILL_PART_NUM; ++i) {
+      SHJoinSpillPart* pPart = &pSpill->parts[i];
+      if (pPart->pBuildBlk && pPart->pBuildBlk->info.rows > 0) {
+        code = flushHJoinSpillBlock(pSpill->pBuf, pPart->pBuildBlk, pPart->pBuildPages);
+        if (code) {
+          return code;
+        }
+      }
+    }
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t spillHJoinProbeRows(SHJoinOperatorInfo* pJoin, SSDataBlock* pBlock) {
+  SHJoinTableInfo* pProbe = pJoin->pProbe;
+  SHJoinSpillCtx*  pSpill = &pJoin->spill;
+  int32_t          code = setKeyColsData(pBlock, pProbe);
+  if (code) {
+    return code;
+  }
+
+  size_t bufLen = 0;
+  for (int32_t i = 0; i < pBlock->info.rows; ++i) {
+    copyKeyColsDataToBuf(pProbe, i, &bufLen);
+    SHJoinSpillPart* pPart = &pSpill->parts[getHJoinSpillPart(pProbe->keyData, bufLen)];
+    if (taosArrayGetSize(pPart->pBuildPages) <= 0) {
+      continue;
+    }
+
+    code = addRowToHJoinSpillPart(pJoin, &pPart->pProbeBlk, pPart->pProbePages, pBlock, i);
+    if (code) {
+      return code;
+    }
+    pJoin->execInfo.spillProbeRows++;
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t startHJoinSpillRestore(struct SOperatorInfo* pOperator) {
+  SHJoinOperatorInfo* pJoin = pOperator->info;
+  SHJoinSpillCtx*     pSpill = &pJoin->spill;
+  int32_t             code = TSDB_CODE_SUCCESS;
+
+  pSpill->restoring = true;
+  pSpill->partIdx = 0;
+  pSpill->pageIdx = 0;
+
+  for (int32_t i = 1; i < HASH_JOIN_SPILL_PART_NUM; ++i) {
+    SHJoinSpillPart* pPart = &pSpill->parts[i];
+    if (pPart->pProbeBlk == NULL) {
+      continue;
+    }
+    if (pPart->pProbeBlk->info.rows > 0) {
+      code = flushHJoinSpillBlock(pSpill->pBuf, pPart->pProbeBlk, pPart->pProbePages);
+      if (code) {
+        return code;
+      }
+    }
+    if (pSpill->pProbeBlk == NULL) {
+      pSpill->pProbeBlk = createOneDataBlock(pPart->pProbeBlk, false);
+      pSpill->pBuildBlk = createOneDataBlock(pPart->pBuildBlk, false);
+      if (pSpill->pProbeBlk == NULL || pSpill->pBuildBlk == NULL) {
+        return TSDB_CODE_OUT_OF_MEMORY;
+      }
+    }
+  }
+
+  // rows of partition 0 are all joined, the memory is reused by the spilled partitions
+  resetHJoinKeyHash(pJoin);
+
+  qDebug("%s hash join starts to join spilled partitions, spillBuildRows:%" PRId64 ", spillProbeRows:%" PRId64,
+         GET_TASKID(pOperator->pTaskInfo), pJoin->execInfo.spillBuildRows, pJoin->execInfo.spillProbeRows);
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t rebuildHJoinKeyHash(SHJoinOperatorInfo* pJoin, SHJoinSpillPart* pPart) {
+  SHJoinSpillCtx* pSpill = &pJoin->spill;
+
+  resetHJoinKeyHash(pJoin);
+
+  int32_t pageNum = taosArrayGetSize(pPart->pBuildPages);
+  for (int32_t i = 0; i < pageNum; ++i) {
+    int32_t code = loadHJoinSpillBlock(pSpill->pBuf, *(int32_t*)taosArrayGet(pPart->pBuildPages, i), pSpill->pBuildBlk);
+    if (code) {
+      return code;
+    }
+    code = addBlockRowsToHash(pSpill->pBuildBlk, pJoin);
+    if (code) {
+      return code;
+    }
   }
 
   return TSDB_CODE_SUCCESS;
 }
 
+static int32_t getHJoinSpilledProbeBlock(SHJoinOperatorInfo* pJoin, SSDataBlock** ppBlock) {
+  SHJoinSpillCtx* pSpill = &pJoin->spill;
+
+  while (pSpill->partIdx < HASH_JOIN_SPILL_PART_NUM) {
+    SHJoinSpillPart* pPart = &pSpill->parts[pSpill->partIdx];
+    if (pSpill->pageIdx < (int32_t)taosArrayGetSize(pPart->pProbePages)) {
+      int32_t code =
+          loadHJoinSpillBlock(pSpill->pBuf, *(int32_t*)taosArrayGet(pPart->pProbePages, pSpill->pageIdx), pSpill->pProbeBlk);
+      if (code) {
+        return code;
+      }
+      pSpill->pageIdx++;
+      *ppBlock = pSpill->pProbeBlk;
+      return TSDB_CODE_SUCCESS;
+    }
+
+    do {
+      pSpill->partIdx++;
+    } while (pSpill->partIdx < HASH_JOIN_SPILL_PART_NUM &&
+             taosArrayGetSize(pSpill->parts[pSpill->partIdx].pProbePages) <= 0);
+
+    pSpill->pageIdx = 0;
+    if (pSpill->partIdx < HASH_JOIN_SPILL_PART_NUM) {
+      int32_t code = rebuildHJoinKeyHash(pJoin, &pSpill->parts[pSpill->partIdx]);
+      if (code) {
+        return code;
+      }
+    }
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t getHJoinProbeBlock(struct SOperatorInfo* pOperator, SSDataBlock** ppBlock) {
+  SHJoinOperatorInfo* pJoin = pOperator->info;
+  SHJoinSpillCtx*     pSpill = &pJoin->spill;
+
+  *ppBlock = NULL;
+  if (!pSpill->restoring) {
+    SSDataBlock* pBlock = getNextBlockFromDownstream(pOperator, pJoin->pProbe->downStreamIdx);
+    if (pBlock) {
+      pJoin->execInfo.probeBlkNum++;
+      pJoin->execInfo.probeBlkRows += pBlock->info.rows;
+
+      *ppBlock = pBlock;
+      return pSpill->spilled ? spillHJoinProbeRows(pJoin, pBlock) : TSDB_CODE_SUCCESS;
+    }
+
+    if (!pSpill->spilled) {
+      return TSDB_CODE_SUCCESS;
+    }
+
+    int32_t code = startHJoinSpillRestore(pOperator);
+    if (code) {
+      return code;
+    }
+  }
+
+  return getHJoinSpilledProbeBlock(pJoin, ppBlock);
+}
+
+static int32_t initHJoinRtFilter(SHJoinOperatorInfo* pJoin) {
+  SHJoinTableInfo* pBuild = pJoin->pBuild;
+  SHJoinTableInfo* pProbe = pJoin->pProbe;
+
+  // the probe rows can only be dropped in the scan if they are never part of the result
+  if (JOIN_TYPE_INNER != pJoin->joinType || 1 != pBuild->keyNum || 1 != pProbe->keyNum ||
+      pBuild->keyCols[0].type != pProbe->keyCols[0].type || pBuild->keyCols[0].bytes != pProbe->keyCols[0].bytes ||
+      QUERY_NODE_PHYSICAL_PLAN_TABLE_SCAN != pProbe->downStream->operatorType) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  SScanRuntimeFilter* pFilter = taosMemoryCalloc(1, sizeof(SScanRuntimeFilter));
+  if (NULL == pFilter) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  pFilter->slotId = pProbe->keyCols[0].srcSlot;
+  pFilter->type = pProbe->keyCols[0].type;
+  if (IS_SIGNED_NUMERIC_TYPE(pFilter->type) || TSDB_DATA_TYPE_TIMESTAMP == pFilter->type) {
+    pFilter->hasRange = true;
+    pFilter->min = INT64_MAX;
+    pFilter->max = INT64_MIN;
+  }
+
+  uint64_t keyNum = pBuild->inputStat.inputRowNum > 0 ? pBuild->inputStat.inputRowNum : HASH_JOIN_RT_FILTER_DEF_KEYS;
+  pFilter->pBloom = tBloomFilterInit(TMIN(keyNum, HASH_JOIN_RT_FILTER_MAX_KEYS), HASH_JOIN_RT_FILTER_ERROR_RATE);
+
+  pJoin->pRtFilter = pFilter;
+  return TSDB_CODE_SUCCESS;
+}
+
+static void pushDownHJoinRtFilter(struct SOperatorInfo* pOperator) {
+  SHJoinOperatorInfo* pJoin = pOperator->info;
+  SScanRuntimeFilter* pFilter = pJoin->pRtFilter;
+  if (NULL == pFilter || (!pFilter->hasRange && NULL == pFilter->pBloom)) {
+    return;
+  }
+
+  STableScanInfo* pScanInfo = pJoin->pProbe->downStream->info;
+  pScanInfo->base.pRtFilter = pFilter;
+
+  qDebug("%s hash join runtime filter pushed down, slotId:%d, range:%d [%" PRId64 ", %" PRId64 "], bloom keys:%" PRIu64,
+         GET_TASKID(pOperator->pTaskInfo), pFilter->slotId, pFilter->hasRange, pFilter->min, pFilter->max,
+         pFilter->pBloom ? pFilter->pBloom->size : 0);
+}
+
 static int32_t launchBlockHashJoin(struct SOperatorInfo* pOperator, SSDataBlock* pBlock) {
   SHJoinOperatorInfo* pJoin = pOperator->info;
   SHJoinTableInfo* pProbe = pJoin->pProbe;
@@ -770,11 +1210,13 @@ static SSDataBlock* doHashJoin(struct SOperatorInfo* pOperator) {
       T_LONG_JMP(pTaskInfo->env, code);
     }
 
-    if (tSimpleHashGetSize(pJoin->pKeyHash) <= 0) {
+    if (tSimpleHashGetSize(pJoin->pKeyHash) <= 0 && !pJoin->spill.spilled) {
       setHJoinDone(pOperator);
       goto _return;
     }
 
+    pushDownHJoinRtFilter(pOperator);
+
     //qTrace("build table rows:%" PRId64, getRowsNumOfKeyHash(pJoin->pKeyHash));
   }
 
@@ -790,15 +1232,17 @@ static SSDataBlock* doHashJoin(struct SOperatorInfo* pOperator) {
   }
 
   while (true) {
-    SSDataBlock* pBlock = getNextBlockFromDownstream(pOperator, pJoin->pProbe->downStreamIdx);
+    SSDataBlock* pBlock = NULL;
+    code = getHJoinProbeBlock(pOperator, &pBlock);
+    if (code) {
+      pTaskInfo->code = code;
+      T_LONG_JMP(pTaskInfo->env, code);
+    }
     if (NULL == pBlock) {
       setHJoinDone(pOperator);
       break;
     }
 
-    pJoin->execInfo.probeBlkNum++;
-    pJoin->execInfo.probeBlkRows += pBlock->info.rows;
-    
     code = launchBlockHashJoin(pOperator, pBlock);
     if (code) {
       pTaskInfo->code = code;
@@ -865,6 +1309,12 @@ SOperatorInfo* createHashJoinOperatorInfo(SOperatorInfo** pDownstream, int32_t n
     goto _error;
   }
 
+  pInfo->spill.memLimit = (int64_t)tsHashJoinBufferSize * 1048576;
+  code = initHJoinRtFilter(pInfo);
+  if (code) {
+    goto _error;
+  }
+
   if (pJoinNode->pFilterConditions != NULL && pJoinNode->node.pConditions != NULL) {
     pInfo->pCond = nodesMakeNode(QUERY_NODE_LOGIC_CONDITION);
     if (pInfo->pCond == NULL) {
@@ -31,6 +31,7 @@
 #include "querytask.h"
 #include "storageapi.h"
 #include "thash.h"
+#include "tmempool.h"
 #include "ttypes.h"
 
 #define CLEAR_QUERY_STATUS(q, st) ((q)->status &= (~(st)))
@@ -58,7 +59,8 @@ SExecTaskInfo* doCreateTask(uint64_t queryId, uint64_t taskId, int32_t vgId, EOP
   pTaskInfo->id.str = taosMemoryMalloc(64);
   buildTaskId(taskId, queryId, pTaskInfo->id.str);
   pTaskInfo->schemaInfos = taosArrayInit(1, sizeof(SSchemaInfo));
-  
+  pTaskInfo->pMemPool = taosMemClassPoolInit(TASK_MEM_POOL_CACHE_SIZE);
+
   return pTaskInfo;
 }
 
@@ -96,8 +98,11 @@ int32_t createExecTaskInfo(SSubplan* pPlan, SExecTaskInfo** pTaskInfo, SReadHand
   TSWAP((*pTaskInfo)->sql, sql);
 
   (*pTaskInfo)->pSubplan = pPlan;
+
+  mcpool_h prevPool = taosMemClassPoolSwitch((*pTaskInfo)->pMemPool);
   (*pTaskInfo)->pRoot = createOperator(pPlan->pNode, *pTaskInfo, pHandle, pPlan->pTagCond, pPlan->pTagIndexCond,
                                        pPlan->user, pPlan->dbFName);
+  taosMemClassPoolSwitch(prevPool);
 
   if (NULL == (*pTaskInfo)->pRoot) {
     int32_t code = (*pTaskInfo)->code;
@@ -217,7 +222,10 @@ static void freeBlock(void* pParam) {
 }
 
 void doDestroyTask(SExecTaskInfo* pTaskInfo) {
-  qDebug("%s execTask is freed", GET_TASKID(pTaskInfo));
+  qDebug("%s execTask is freed, mem peak:%.2f Kb", GET_TASKID(pTaskInfo),
+         taosMemClassPoolPeak(pTaskInfo->pMemPool) / 1024.0);
+
+  mcpool_h prevPool = taosMemClassPoolSwitch(pTaskInfo->pMemPool);
   destroyOperator(pTaskInfo->pRoot);
   pTaskInfo->pRoot = NULL;
 
@@ -230,6 +238,9 @@ void doDestroyTask(SExecTaskInfo* pTaskInfo) {
   }
 
   taosArrayDestroyEx(pTaskInfo->pResultBlockList, freeBlock);
+  taosMemClassPoolSwitch(prevPool);
+  taosMemClassPoolCleanUp(pTaskInfo->pMemPool);
+
   taosArrayDestroy(pTaskInfo->stopInfo.pStopInfo);
   taosMemoryFreeClear(pTaskInfo->sql);
   taosMemoryFreeClear(pTaskInfo->id.str);
@@ -293,6 +293,86 @@ bool applyLimitOffset(SLimitInfo* pLimitInfo, SSDataBlock* pBlock, SExecTaskInfo
   return false;
 }
 
+static int32_t doLoadRemainColumns(void* param, bool load) {
+  STableScanBase* pTableScanInfo = param;
+  return pTableScanInfo->readerAPI.tsdReaderRetrieveRemainColumns(pTableScanInfo->dataReader, load);
+}
+
+bool doFilterByRuntimeFilterSMA(SScanRuntimeFilter* pFilter, SSDataBlock* pBlock) {
+  if (!pFilter->hasRange || pBlock->pBlockAgg == NULL || pFilter->slotId >= taosArrayGetSize(pBlock->pDataBlock)) {
+    return true;
+  }
+
+  SColumnDataAgg* pAgg = pBlock->pBlockAgg[pFilter->slotId];
+  if (pAgg == NULL) {
+    return true;
+  }
+
+  // null keys never match
+  if (pAgg->numOfNull >= pBlock->info.rows) {
+    return false;
+  }
+
+  return pAgg->max >= pFilter->min && pAgg->min <= pFilter->max;
+}
+
+void doFilterByRuntimeFilter(SScanRuntimeFilter* pFilter, SSDataBlock* pBlock) {
+  int32_t rows = pBlock->info.rows;
+  if (rows <= 0 || pFilter->slotId >= taosArrayGetSize(pBlock->pDataBlock)) {
+    return;
+  }
+
+  SColumnInfoData* pCol = taosArrayGet(pBlock->pDataBlock, pFilter->slotId);
+  if (pCol->pData == NULL) {
+    return;
+  }
+
+  bool* p = taosMemoryMalloc(rows * sizeof(bool));
+  if (p == NULL) {
+    return;
+  }
+
+  bool    isVar = IS_VAR_DATA_TYPE(pCol->info.type);
+  int32_t numOfQualified = 0;
+  for (int32_t i = 0; i < rows; ++i) {
+    p[i] = false;
+    if (colDataIsNull_s(pCol, i)) {
+      continue;
+    }
+
+    char* pData = colDataGetData(pCol, i);
+    if (pFilter->hasRange) {
+      int64_t v = 0;
+      GET_TYPED_DATA(v, int64_t, pCol->info.type, pData);
+      if (v < pFilter->min || v > pFilter->max) {
+        continue;
+      }
+    }
+
+    if (pFilter->pBloom != NULL) {
+      uint32_t len = isVar ? varDataTLen(pData) : pCol->info.bytes;
+      uint64_t h1 = (uint64_t)pFilter->pBloom->hashFn1(pData, len);
+      uint64_t h2 = (uint64_t)pFilter->pBloom->hashFn2(pData, len);
+      if (tBloomFilterNoContain(pFilter->pBloom, h1, h2) == TSDB_CODE_SUCCESS) {
+        continue;
+      }
+    }
+
+    p[i] = true;
+    numOfQualified++;
+  }
+
+  if (numOfQualified == 0) {
+    trimDataBlock(pBlock, rows, NULL);
+    pBlock->info.rows = 0;
+  } else if (numOfQualified < rows) {
+    trimDataBlock(pBlock, rows, p);
+  }
+
+  pFilter->filterOutRows += rows - numOfQualified;
+  taosMemoryFree(p);
+}
+
 static int32_t loadDataBlock(SOperatorInfo* pOperator, STableScanBase* pTableScanInfo, SSDataBlock* pBlock,
                              uint32_t* status) {
   SExecTaskInfo*          pTaskInfo = pOperator->pTaskInfo;
@@ -364,6 +444,26 @@ static int32_t loadDataBlock(SOperatorInfo* pOperator, STableScanBase* pTableSca
     }
   }
 
+  // try to filter data block according to the key range of the hash join above
+  SScanRuntimeFilter* pRtFilter = pTableScanInfo->pRtFilter;
+  if (pRtFilter != NULL && pRtFilter->hasRange) {
+    if (pBlock->pBlockAgg == NULL) {
+      doLoadBlockSMA(pTableScanInfo, pBlock, pTaskInfo);
+    }
+    if (!doFilterByRuntimeFilterSMA(pRtFilter, pBlock)) {
+      qDebug("%s data block filter out by runtime filter, brange:%" PRId64 "-%" PRId64 ", rows:%" PRId64,
+             GET_TASKID(pTaskInfo), pBlockInfo->window.skey, pBlockInfo->window.ekey, pBlockInfo->rows);
+      pCost->filterOutBlocks += 1;
+      pRtFilter->filterOutBlocks += 1;
+      pRtFilter->filterOutRows += pBlockInfo->rows;
+      (*status) = FUNC_DATA_REQUIRED_FILTEROUT;
+
+      taosMemoryFreeClear(pBlock->pBlockAgg);
+      pAPI->tsdReader.tsdReaderReleaseDataBlock(pTableScanInfo->dataReader);
+      return TSDB_CODE_SUCCESS;
+    }
+  }
+
   // free the sma info, since it should not be involved in later computing process.
   taosMemoryFreeClear(pBlock->pBlockAgg);
 
@@ -387,7 +487,9 @@ static int32_t loadDataBlock(SOperatorInfo* pOperator, STableScanBase* pTableSca
   pCost->totalCheckedRows += pBlock->info.rows;
   pCost->loadBlocks += 1;
 
-  SSDataBlock* p = pAPI->tsdReader.tsdReaderRetrieveDataBlock(pTableScanInfo->dataReader, NULL);
+  // only the columns in filter are loaded if pFilterColIds is not NULL, the others are loaded after the filter is
+  // applied and only if any rows are qualified.
+  SSDataBlock* p = pAPI->tsdReader.tsdReaderRetrieveDataBlock(pTableScanInfo->dataReader, pTableScanInfo->pFilterColIds);
   if (p == NULL) {
     return terrno;
   }
@@ -399,7 +501,13 @@ static int32_t loadDataBlock(SOperatorInfo* pOperator, STableScanBase* pTableSca
   pCost->totalRows -= pBlock->info.rows;
 
   if (pOperator->exprSupp.pFilterInfo != NULL) {
-    int32_t code = doFilter(pBlock, pOperator->exprSupp.pFilterInfo, &pTableScanInfo->matchInfo);
+    int32_t code = TSDB_CODE_SUCCESS;
+    if (pTableScanInfo->pFilterColIds != NULL) {
+      code = doFilterWithLateLoad(pBlock, pOperator->exprSupp.pFilterInfo, &pTableScanInfo->matchInfo,
+                                  doLoadRemainColumns, pTableScanInfo);
+    } else {
+      code = doFilter(pBlock, pOperator->exprSupp.pFilterInfo, &pTableScanInfo->matchInfo);
+    }
     if (code != TSDB_CODE_SUCCESS) return code;
 
     int64_t st = taosGetTimestampUs();
@@ -413,6 +521,13 @@ static int32_t loadDataBlock(SOperatorInfo* pOperator, STableScanBase* pTableSca
     } else {
       qDebug("%s data block filter applied, elapsed time:%.2f ms", GET_TASKID(pTaskInfo), el);
     }
+  } else if (pTableScanInfo->pFilterColIds != NULL) {
+    int32_t code = doLoadRemainColumns(pTableScanInfo, true);
+    if (code != TSDB_CODE_SUCCESS) return code;
+  }
+
+  if (pRtFilter != NULL) {
+    doFilterByRuntimeFilter(pRtFilter, pBlock);
   }
 
   bool limitReached = applyLimitOffset(&pTableScanInfo->limitInfo, pBlock, pTaskInfo);
@@ -988,6 +1103,10 @@ static int32_t getTableScannerExecInfo(struct SOperatorInfo* pOptr, void** pOptr
   SFileBlockLoadRecorder* pRecorder = taosMemoryCalloc(1, sizeof(SFileBlockLoadRecorder));
   STableScanInfo*         pTableScanInfo = pOptr->info;
   *pRecorder = pTableScanInfo->base.readRecorder;
+  if (pTableScanInfo->base.dataReader != NULL) {
+    pTableScanInfo->base.readerAPI.tsdReaderGetReadAheadStat(pTableScanInfo->base.dataReader, pRecorder);
+  }
+
   *pOptrExplain = pRecorder;
   *len = sizeof(SFileBlockLoadRecorder);
   return 0;
@@ -995,6 +1114,7 @@ static int32_t getTableScannerExecInfo(struct SOperatorInfo* pOptr, void** pOptr
 
 static void destroyTableScanBase(STableScanBase* pBase, TsdReader* pAPI) {
   cleanupQueryTableDataCond(&pBase->cond);
+  taosArrayDestroy(pBase->pFilterColIds);
 
   pAPI->tsdReaderClose(pBase->dataReader);
   pBase->dataReader = NULL;
@@ -1016,6 +1136,59 @@ static void destroyTableScanOperatorInfo(void* param) {
   taosMemoryFreeClear(param);
 }
 
+typedef struct SFilterColIdCxt {
+  STableScanBase* pBase;
+  int32_t         code;
+} SFilterColIdCxt;
+
+static EDealRes collectFilterColId(SNode* pNode, void* pContext) {
+  SFilterColIdCxt* pCxt = pContext;
+  if (QUERY_NODE_COLUMN != nodeType(pNode) || ((SColumnNode*)pNode)->colType != COLUMN_TYPE_COLUMN) {
+    return DEAL_RES_CONTINUE;
+  }
+
+  SColumnNode* pCol = (SColumnNode*)pNode;
+  SArray*      pList = pCxt->pBase->matchInfo.pList;
+  for (int32_t i = 0; i < taosArrayGetSize(pList); ++i) {
+    SColMatchItem* pItem = taosArrayGet(pList, i);
+    if (pItem->dstSlotId != pCol->slotId) {
+      continue;
+    }
+
+    col_id_t colId = pItem->colId;
+    for (int32_t j = 0; j < taosArrayGetSize(pCxt->pBase->pFilterColIds); ++j) {
+      if (*(col_id_t*)taosArrayGet(pCxt->pBase->pFilterColIds, j) == colId) {
+        return DEAL_RES_CONTINUE;
+      }
+    }
+
+    if (taosArrayPush(pCxt->pBase->pFilterColIds, &colId) == NULL) {
+      pCxt->code = TSDB_CODE_OUT_OF_MEMORY;
+      return DEAL_RES_ERROR;
+    }
+    break;
+  }
+
+  return DEAL_RES_CONTINUE;
+}
+
+// the data columns referenced by the filter are loaded ahead of the others during table scan, so the load of the
+// remain columns can be avoided if no rows in a data block are qualified.
+static int32_t initFilterColIds(STableScanBase* pBase, SNode* pConditions) {
+  if (pConditions == NULL) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  pBase->pFilterColIds = taosArrayInit(4, sizeof(col_id_t));
+  if (pBase->pFilterColIds == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  SFilterColIdCxt cxt = {.pBase = pBase, .code = TSDB_CODE_SUCCESS};
+  nodesWalkExpr(pConditions, collectFilterColId, &cxt);
+  return cxt.code;
+}
+
 SOperatorInfo* createTableScanOperatorInfo(STableScanPhysiNode* pTableScanNode, SReadHandle* readHandle,
                                            STableListInfo* pTableListInfo, SExecTaskInfo* pTaskInfo) {
   int32_t         code = 0;
@@ -1067,6 +1240,11 @@ SOperatorInfo* createTableScanOperatorInfo(STableScanPhysiNode* pTableScanNode,
     goto _error;
   }
 
+  code = initFilterColIds(&pInfo->base, pTableScanNode->scan.node.pConditions);
+  if (code != TSDB_CODE_SUCCESS) {
+    goto _error;
+  }
+
   pInfo->currentGroupId = -1;
   pInfo->assignBlockUid = pTableScanNode->assignBlockUid;
   pInfo->hasGroupByTag = pTableScanNode->pGroupTags ? true : false;
@@ -3729,6 +3907,11 @@ SOperatorInfo* createTableMergeScanOperatorInfo(STableScanPhysiNode* pTableScanN
     goto _error;
   }
 
+  code = initFilterColIds(&pInfo->base, pTableScanNode->scan.node.pConditions);
+  if (code != TSDB_CODE_SUCCESS) {
+    goto _error;
+  }
+
   initResultSizeInfo(&pOperator->resultInfo, 1024);
   pInfo->pResBlock = createDataBlockFromDescNode(pDescNode);
   blockDataEnsureCapacity(pInfo->pResBlock, pOperator->resultInfo.capacity);
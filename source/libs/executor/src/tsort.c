@@ -21,6 +21,7 @@
 #include "tdef.h"
 #include "theap.h"
 #include "tlosertree.h"
+#include "tmempool.h"
 #include "tpagedbuf.h"
 #include "tsort.h"
 #include "tutil.h"
@@ -334,6 +335,18 @@ static int32_t doAddNewExternalMemSource(SDiskbasedBuf* pBuf, SArray* pAllSource
   return blockDataEnsureCapacity(pSource->src.pBlock, numOfRows);
 }
 
+// the pages hold blocks serialized by blockDataToBuf, compress them column by column
+static void setSortPageCodec(SSortHandle* pHandle, const SSDataBlock* pBlock) {
+  if (pBlock == NULL) {
+    return;
+  }
+
+  void* param = blockDataCreatePageCodec(pBlock);
+  if (param != NULL) {
+    dBufSetPageCodec(pHandle->pBuf, blockDataEncodePage, blockDataDecodePage, param);
+  }
+}
+
 static int32_t doAddToBuf(SSDataBlock* pDataBlock, SSortHandle* pHandle) {
   int32_t start = 0;
 
@@ -350,6 +363,7 @@ static int32_t doAddToBuf(SSDataBlock* pDataBlock, SSortHandle* pHandle) {
     if (code != TSDB_CODE_SUCCESS) {
       return code;
     }
+    setSortPageCodec(pHandle, pDataBlock);
   }
 
   SArray* pPageIdList = taosArrayInit(4, sizeof(int32_t));
@@ -417,6 +431,7 @@ static int32_t sortComparInit(SMsortComparParam* pParam, SArray* pSources, int32
       terrno = code;
       return code;
     }
+    setSortPageCodec(pHandle, pHandle->pDataBlock);
   }
 
   if (pHandle->type == SORT_SINGLESOURCE_SORT) {
@@ -843,6 +858,7 @@ static int32_t createPageBuf(SSortHandle* pHandle) {
     if (code != TSDB_CODE_SUCCESS) {
       return code;
     }
+    setSortPageCodec(pHandle, pHandle->pDataBlock);
   }
   return 0;
 }
@@ -1120,6 +1136,19 @@ static int32_t createBlocksMergeSortInitialSources(SSortHandle* pHandle) {
   return TSDB_CODE_SUCCESS;
 }
 
+// the in-memory run is sorted and spilled before it reaches the sort buffer size, if the memory budget of the query
+// task can not afford it to grow by another block
+static bool isSortRunOverBudget(SSDataBlock* pBlock) {
+  mcpool_h pPool = taosMemClassPoolCurrent();
+  int64_t  size = blockDataGetSize(pBlock);
+  if (!taosMemClassPoolReserve(pPool, size, true)) {
+    return true;
+  }
+
+  taosMemClassPoolRelease(pPool, size);
+  return false;
+}
+
 static int32_t createBlocksQuickSortInitialSources(SSortHandle* pHandle) {
   int32_t code = 0;
   size_t  sortBufSize = pHandle->numOfPages * pHandle->pageSize;
@@ -1164,7 +1193,7 @@ static int32_t createBlocksQuickSortInitialSources(SSortHandle* pHandle) {
     }
 
     size_t size = blockDataGetSize(pHandle->pDataBlock);
-    if (size > sortBufSize) {
+    if (size > sortBufSize || isSortRunOverBudget(pBlock)) {
       // Perform the in-memory sort and then flush data in the buffer into disk.
       int64_t p = taosGetTimestampUs();
       code = blockDataSort(pHandle->pDataBlock, pHandle->pSortInfo);
@@ -1577,6 +1606,8 @@ SSortExecInfo tsortGetSortExecInfo(SSortHandle* pHandle) {
       SDiskbasedBufStatis st = getDBufStatis(pHandle->pBuf);
       info.writeBytes = st.flushBytes;
       info.readBytes = st.loadBytes;
+      info.rawWriteBytes = st.rawFlushBytes;
+      info.stallTime = st.stallTime;
     }
   }
 
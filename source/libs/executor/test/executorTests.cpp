@@ -25,6 +25,7 @@
 
 #include "executor.h"
 #include "executorInt.h"
+#include "filter.h"
 #include "function.h"
 #include "operator.h"
 #include "taos.h"
@@ -53,6 +54,128 @@ TEST(testCase, windowFunctionTest) {
   ASSERT_EQ(num, ekeyNum - pos + 1);
 }
 
+// a file block of which the rows are dumped into the result block in several parts, and the column that is not in the
+// filter is copied from the same position only if any rows of the part are qualified.
+typedef struct SDummyLateLoadInfo {
+  int32_t        rowIndex;
+  int32_t        numOfRows;
+  int32_t        numOfCalls;
+  bool           load;
+  const int32_t* pRemain;
+  SSDataBlock*   pBlock;
+} SDummyLateLoadInfo;
+
+int32_t dummyLoadRemainColumns(void* param, bool load) {
+  SDummyLateLoadInfo* pInfo = static_cast<SDummyLateLoadInfo*>(param);
+  pInfo->numOfCalls += 1;
+  pInfo->load = load;
+  if (load) {
+    SColumnInfoData* pCol = (SColumnInfoData*)taosArrayGet(pInfo->pBlock->pDataBlock, 1);
+    for (int32_t i = 0; i < pInfo->numOfRows; ++i) {
+      colDataSetVal(pCol, i, (const char*)&pInfo->pRemain[pInfo->rowIndex + i], false);
+    }
+  }
+  return TSDB_CODE_SUCCESS;
+}
+
+TEST(testCase, filterWithLateLoad_partialDumpedBlock) {
+  const int32_t numOfRows = 10;
+  const int32_t capacity = 4;
+  int32_t       filterv[numOfRows];
+  int32_t       remainv[numOfRows];
+  for (int32_t i = 0; i < numOfRows; ++i) {
+    filterv[i] = i;
+    remainv[i] = 100 + i;
+  }
+
+  SSDataBlock*    pBlock = createDataBlock();
+  SColumnInfoData col0 = createColumnInfoData(TSDB_DATA_TYPE_INT, sizeof(int32_t), 1);
+  SColumnInfoData col1 = createColumnInfoData(TSDB_DATA_TYPE_INT, sizeof(int32_t), 2);
+  ASSERT_EQ(blockDataAppendColInfo(pBlock, &col0), 0);
+  ASSERT_EQ(blockDataAppendColInfo(pBlock, &col1), 0);
+  ASSERT_EQ(blockDataEnsureCapacity(pBlock, capacity), 0);
+
+  // c1 > 5
+  SColumnNode* pCol = (SColumnNode*)nodesMakeNode(QUERY_NODE_COLUMN);
+  pCol->node.resType.type = TSDB_DATA_TYPE_INT;
+  pCol->node.resType.bytes = sizeof(int32_t);
+  pCol->dataBlockId = 0;
+  pCol->slotId = 0;
+  pCol->colId = 1;
+  SValueNode* pVal = (SValueNode*)nodesMakeNode(QUERY_NODE_VALUE);
+  pVal->node.resType.type = TSDB_DATA_TYPE_INT;
+  pVal->node.resType.bytes = sizeof(int32_t);
+  pVal->datum.i = 5;
+  SOperatorNode* pOp = (SOperatorNode*)nodesMakeNode(QUERY_NODE_OPERATOR);
+  pOp->node.resType.type = TSDB_DATA_TYPE_BOOL;
+  pOp->node.resType.bytes = sizeof(bool);
+  pOp->opType = OP_TYPE_GREATER_THAN;
+  pOp->pLeft = (SNode*)pCol;
+  pOp->pRight = (SNode*)pVal;
+
+  SFilterInfo* pFilterInfo = NULL;
+  ASSERT_EQ(filterInitFromNode((SNode*)pOp, &pFilterInfo, 0), 0);
+
+  // the parts are [0, 4) with none qualified, [4, 8) partially qualified and [8, 10) all qualified
+  int32_t expRows[] = {0, 2, 2};
+  bool    expLoad[] = {false, true, true};
+
+  SDummyLateLoadInfo info = {0};
+  info.pRemain = remainv;
+  info.pBlock = pBlock;
+  for (int32_t part = 0, rowIndex = 0; rowIndex < numOfRows; ++part, rowIndex += capacity) {
+    int32_t rows = TMIN(capacity, numOfRows - rowIndex);
+    blockDataCleanup(pBlock);
+    SColumnInfoData* pFilterCol = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0);
+    SColumnInfoData* pRemainCol = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 1);
+    for (int32_t i = 0; i < rows; ++i) {
+      colDataSetVal(pFilterCol, i, (const char*)&filterv[rowIndex + i], false);
+      colDataSetNULL(pRemainCol, i);
+    }
+    pBlock->info.rows = rows;
+
+    info.rowIndex = rowIndex;
+    info.numOfRows = rows;
+    info.numOfCalls = 0;
+    ASSERT_EQ(doFilterWithLateLoad(pBlock, pFilterInfo, NULL, dummyLoadRemainColumns, &info), 0);
+    ASSERT_EQ(info.numOfCalls, 1);
+    ASSERT_EQ(info.load, expLoad[part]);
+    ASSERT_EQ(pBlock->info.rows, expRows[part]);
+
+    for (int32_t i = 0; i < pBlock->info.rows; ++i) {
+      ASSERT_FALSE(colDataIsNull_s(pRemainCol, i));
+      int32_t v = *(int32_t*)colDataGetData(pFilterCol, i);
+      ASSERT_GT(v, 5);
+      ASSERT_EQ(*(int32_t*)colDataGetData(pRemainCol, i), remainv[v]);
+    }
+  }
+
+  // without filter, the remain columns are always loaded for non-empty blocks
+  blockDataCleanup(pBlock);
+  pBlock->info.rows = 0;
+  info.numOfCalls = 0;
+  ASSERT_EQ(doFilterWithLateLoad(pBlock, NULL, NULL, dummyLoadRemainColumns, &info), 0);
+  ASSERT_EQ(info.numOfCalls, 1);
+  ASSERT_EQ(info.load, false);
+
+  SColumnInfoData* pFilterCol = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0);
+  for (int32_t i = 0; i < 2; ++i) {
+    colDataSetVal(pFilterCol, i, (const char*)&filterv[i], false);
+  }
+  pBlock->info.rows = 2;
+  info.rowIndex = 0;
+  info.numOfRows = 2;
+  info.numOfCalls = 0;
+  ASSERT_EQ(doFilterWithLateLoad(pBlock, NULL, NULL, dummyLoadRemainColumns, &info), 0);
+  ASSERT_EQ(info.numOfCalls, 1);
+  ASSERT_EQ(info.load, true);
+  ASSERT_EQ(pBlock->info.rows, 2);
+
+  filterFreeInfo(pFilterInfo);
+  nodesDestroyNode((SNode*)pOp);
+  blockDataDestroy(pBlock);
+}
+
 typedef struct SDummyInputInfo {
   int32_t      totalPages;  // numOfPages
   int32_t      current;
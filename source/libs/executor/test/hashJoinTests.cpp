@@ -0,0 +1,505 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <tglobal.h>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#include "os.h"
+
+#include "executorInt.h"
+#include "hashjoin.h"
+#include "operator.h"
+#include "querynodes.h"
+#include "querytask.h"
+#include "tbloomfilter.h"
+#include "tdatablock.h"
+#include "tmempool.h"
+
+namespace {
+
+// the columns of both sides: int key, varchar key, bigint value and varchar value
+enum {
+  HJ_SLOT_IKEY = 0,
+  HJ_SLOT_VKEY,
+  HJ_SLOT_VAL,
+  HJ_SLOT_VSTR,
+};
+
+#define HJ_VAR_BYTES (20 + VARSTR_HEADER_SIZE)
+
+// build value, probe value, probe varchar key, build varchar value
+typedef std::tuple<int64_t, int64_t, std::string, std::string> SHJoinRes;
+
+// a table scan of which the blocks are generated, the runtime filter pushed down by the join is applied to them as the
+// table scan does, so the scan info must be the first member.
+typedef struct SHJoinTestInput {
+  STableScanInfo scan;
+  int32_t        numOfBlocks;
+  int32_t        rowsPerBlock;
+  int32_t        numOfKeys;
+  int64_t        valBase;
+  int32_t        current;
+  SSDataBlock*   pBlock;
+} SHJoinTestInput;
+
+int32_t getHJoinTestKey(SHJoinTestInput* pInput, int64_t row) { return (int32_t)((row * 7) % pInput->numOfKeys); }
+
+void setHJoinTestVarVal(SColumnInfoData* pCol, int32_t rowIdx, const char* fmt, int64_t v) {
+  char buf[HJ_VAR_BYTES] = {0};
+  int32_t len = snprintf(varDataVal(buf), HJ_VAR_BYTES - VARSTR_HEADER_SIZE, fmt, v);
+  varDataSetLen(buf, len);
+  colDataSetVal(pCol, rowIdx, buf, false);
+}
+
+SSDataBlock* getHJoinTestBlock(SOperatorInfo* pOperator) {
+  SHJoinTestInput* pInput = (SHJoinTestInput*)pOperator->info;
+  while (pInput->current < pInput->numOfBlocks) {
+    SSDataBlock* pBlock = pInput->pBlock;
+    blockDataCleanup(pBlock);
+    blockDataEnsureCapacity(pBlock, pInput->rowsPerBlock);
+
+    for (int32_t i = 0; i < pInput->rowsPerBlock; ++i) {
+      int64_t row = (int64_t)pInput->current * pInput->rowsPerBlock + i;
+      int32_t key = getHJoinTestKey(pInput, row);
+      int64_t val = pInput->valBase + row;
+      colDataSetVal((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, HJ_SLOT_IKEY), i, (const char*)&key, false);
+      setHJoinTestVarVal((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, HJ_SLOT_VKEY), i, "key_%" PRId64, key);
+      colDataSetVal((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, HJ_SLOT_VAL), i, (const char*)&val, false);
+      setHJoinTestVarVal((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, HJ_SLOT_VSTR), i, "val_%" PRId64, val);
+    }
+    pBlock->info.rows = pInput->rowsPerBlock;
+    pInput->current++;
+
+    if (pInput->scan.base.pRtFilter != NULL) {
+      doFilterByRuntimeFilter(pInput->scan.base.pRtFilter, pBlock);
+      if (pBlock->info.rows == 0) {
+        continue;
+      }
+    }
+    return pBlock;
+  }
+
+  return NULL;
+}
+
+void destroyHJoinTestInput(void* param) {
+  SHJoinTestInput* pInput = (SHJoinTestInput*)param;
+  blockDataDestroy(pInput->pBlock);
+  taosMemoryFree(pInput);
+}
+
+SOperatorInfo* createHJoinTestInput(SExecTaskInfo* pTaskInfo, int16_t blkId, int32_t numOfBlocks, int32_t rowsPerBlock,
+                                    int32_t numOfKeys, int64_t valBase, bool tableScan) {
+  SOperatorInfo*   pOperator = (SOperatorInfo*)taosMemoryCalloc(1, sizeof(SOperatorInfo));
+  SHJoinTestInput* pInput = (SHJoinTestInput*)taosMemoryCalloc(1, sizeof(SHJoinTestInput));
+  pInput->numOfBlocks = numOfBlocks;
+  pInput->rowsPerBlock = rowsPerBlock;
+  pInput->numOfKeys = numOfKeys;
+  pInput->valBase = valBase;
+
+  pInput->pBlock = createDataBlock();
+  SColumnInfoData ikey = createColumnInfoData(TSDB_DATA_TYPE_INT, sizeof(int32_t), 1);
+  SColumnInfoData vkey = createColumnInfoData(TSDB_DATA_TYPE_VARCHAR, HJ_VAR_BYTES, 2);
+  SColumnInfoData val = createColumnInfoData(TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), 3);
+  SColumnInfoData vstr = createColumnInfoData(TSDB_DATA_TYPE_VARCHAR, HJ_VAR_BYTES, 4);
+  blockDataAppendColInfo(pInput->pBlock, &ikey);
+  blockDataAppendColInfo(pInput->pBlock, &vkey);
+  blockDataAppendColInfo(pInput->pBlock, &val);
+  blockDataAppendColInfo(pInput->pBlock, &vstr);
+
+  setOperatorInfo(pOperator, "hashJoinTestInput",
+                  tableScan ? QUERY_NODE_PHYSICAL_PLAN_TABLE_SCAN : QUERY_NODE_PHYSICAL_PLAN_PROJECT, false,
+                  OP_NOT_OPENED, pInput, pTaskInfo);
+  pOperator->resultDataBlockId = blkId;
+  pOperator->fpSet = createOperatorFpSet(optrDummyOpenFn, getHJoinTestBlock, NULL, destroyHJoinTestInput,
+                                         optrDefaultBufFn, NULL, optrDefaultGetNextExtFn, NULL);
+  return pOperator;
+}
+
+SNode* createHJoinTestCol(int16_t blkId, int16_t slotId) {
+  SColumnNode* pCol = (SColumnNode*)nodesMakeNode(QUERY_NODE_COLUMN);
+  pCol->dataBlockId = blkId;
+  pCol->slotId = slotId;
+  if (slotId == HJ_SLOT_IKEY) {
+    pCol->node.resType.type = TSDB_DATA_TYPE_INT;
+    pCol->node.resType.bytes = sizeof(int32_t);
+  } else if (slotId == HJ_SLOT_VAL) {
+    pCol->node.resType.type = TSDB_DATA_TYPE_BIGINT;
+    pCol->node.resType.bytes = sizeof(int64_t);
+  } else {
+    pCol->node.resType.type = TSDB_DATA_TYPE_VARCHAR;
+    pCol->node.resType.bytes = HJ_VAR_BYTES;
+  }
+  return (SNode*)pCol;
+}
+
+void addHJoinTestTarget(SHashJoinPhysiNode* pJoinNode, int16_t blkId, int16_t srcSlot) {
+  STargetNode*  pTarget = (STargetNode*)nodesMakeNode(QUERY_NODE_TARGET);
+  SSlotDescNode* pSlot = (SSlotDescNode*)nodesMakeNode(QUERY_NODE_SLOT_DESC);
+  pTarget->dataBlockId = pJoinNode->node.pOutputDataBlockDesc->dataBlockId;
+  pTarget->slotId = LIST_LENGTH(pJoinNode->pTargets);
+  pTarget->pExpr = createHJoinTestCol(blkId, srcSlot);
+
+  pSlot->slotId = pTarget->slotId;
+  pSlot->dataType = ((SExprNode*)pTarget->pExpr)->resType;
+  pSlot->output = true;
+
+  nodesListMakeAppend(&pJoinNode->pTargets, (SNode*)pTarget);
+  nodesListMakeAppend(&pJoinNode->node.pOutputDataBlockDesc->pSlots, (SNode*)pSlot);
+}
+
+// joins the left side, which is the build side, with the right side on the given key slots
+SHashJoinPhysiNode* createHJoinTestNode(const std::vector<int16_t>& keySlots) {
+  SHashJoinPhysiNode* pJoinNode = (SHashJoinPhysiNode*)nodesMakeNode(QUERY_NODE_PHYSICAL_PLAN_HASH_JOIN);
+  pJoinNode->joinType = JOIN_TYPE_INNER;
+  pJoinNode->inputStat[0].inputRowNum = 1;
+  pJoinNode->inputStat[1].inputRowNum = 2;
+  pJoinNode->node.pOutputDataBlockDesc = (SDataBlockDescNode*)nodesMakeNode(QUERY_NODE_DATABLOCK_DESC);
+  pJoinNode->node.pOutputDataBlockDesc->dataBlockId = 3;
+
+  for (int16_t slotId : keySlots) {
+    nodesListMakeAppend(&pJoinNode->pOnLeft, createHJoinTestCol(1, slotId));
+    nodesListMakeAppend(&pJoinNode->pOnRight, createHJoinTestCol(2, slotId));
+  }
+
+  addHJoinTestTarget(pJoinNode, 1, HJ_SLOT_VAL);
+  addHJoinTestTarget(pJoinNode, 2, HJ_SLOT_VAL);
+  addHJoinTestTarget(pJoinNode, 2, HJ_SLOT_VKEY);
+  addHJoinTestTarget(pJoinNode, 1, HJ_SLOT_VSTR);
+  return pJoinNode;
+}
+
+typedef struct SHJoinTestParam {
+  std::vector<int16_t> keySlots;
+  int32_t              bufferSize;  // hashJoinBufferSize, MB
+  bool                 tableScan;   // the probe side is a table scan, so the runtime filter is pushed down
+  bool                 refuseMem;   // the memory budget of the task refuses the build side
+} SHJoinTestParam;
+
+typedef struct SHJoinTestStat {
+  bool    spilled;
+  int64_t spillBuildRows;
+  int64_t spillProbeRows;
+  int64_t filterOutRows;
+  int64_t memUsed;  // charged to the task memory pool after the join is destroyed
+} SHJoinTestStat;
+
+bool refuseHJoinTestMem(void* param, int64_t size, bool spillable) { return !spillable; }
+
+void releaseHJoinTestMem(void* param, int64_t size) {}
+
+std::vector<SHJoinRes> runHJoinTest(const SHJoinTestParam& param, SHJoinTestStat* pStat) {
+  std::vector<SHJoinRes> res;
+  int32_t                bufferSize = tsHashJoinBufferSize;
+  tsHashJoinBufferSize = param.bufferSize;
+
+  SExecTaskInfo* pTaskInfo = (SExecTaskInfo*)taosMemoryCalloc(1, sizeof(SExecTaskInfo));
+  pTaskInfo->id.str = taosStrdup("hashJoinTest");
+  pTaskInfo->pMemPool = taosMemClassPoolInit(0);
+  if (param.refuseMem) {
+    taosMemClassPoolSetCtrl(pTaskInfo->pMemPool, refuseHJoinTestMem, releaseHJoinTestMem, NULL);
+  }
+
+  // 5 build blocks with each key on 4 build rows, the probe side has keys without build rows
+  SOperatorInfo* pDownstream[2] = {
+      createHJoinTestInput(pTaskInfo, 1, 5, 4096, 5120, 0, false),
+      createHJoinTestInput(pTaskInfo, 2, 4, 1000, 6000, 1000000, param.tableScan),
+  };
+  SHashJoinPhysiNode* pJoinNode = createHJoinTestNode(param.keySlots);
+  SOperatorInfo*      pOperator = createHashJoinOperatorInfo(pDownstream, 2, pJoinNode, pTaskInfo);
+  EXPECT_NE(pOperator, nullptr);
+
+  SSDataBlock* pRes = NULL;
+  while (pOperator && (pRes = pOperator->fpSet.getNextFn(pOperator)) != NULL) {
+    for (int32_t i = 0; i < pRes->info.rows; ++i) {
+      char* pKey = colDataGetData((SColumnInfoData*)taosArrayGet(pRes->pDataBlock, 2), i);
+      char* pStr = colDataGetData((SColumnInfoData*)taosArrayGet(pRes->pDataBlock, 3), i);
+      res.emplace_back(*(int64_t*)colDataGetData((SColumnInfoData*)taosArrayGet(pRes->pDataBlock, 0), i),
+                       *(int64_t*)colDataGetData((SColumnInfoData*)taosArrayGet(pRes->pDataBlock, 1), i),
+                       std::string(varDataVal(pKey), varDataLen(pKey)), std::string(varDataVal(pStr), varDataLen(pStr)));
+    }
+  }
+
+  if (pOperator) {
+    SHJoinOperatorInfo* pJoin = (SHJoinOperatorInfo*)pOperator->info;
+    pStat->spilled = pJoin->spill.spilled;
+    pStat->spillBuildRows = pJoin->execInfo.spillBuildRows;
+    pStat->spillProbeRows = pJoin->execInfo.spillProbeRows;
+    pStat->filterOutRows = pJoin->pRtFilter ? pJoin->pRtFilter->filterOutRows : 0;
+    destroyOperator(pOperator);
+  }
+  pStat->memUsed = taosMemClassPoolUsed(pTaskInfo->pMemPool);
+
+  nodesDestroyNode((SNode*)pJoinNode);
+  taosMemClassPoolCleanUp(pTaskInfo->pMemPool);
+  taosMemoryFree(pTaskInfo->id.str);
+  taosMemoryFree(pTaskInfo);
+  tsHashJoinBufferSize = bufferSize;
+
+  std::sort(res.begin(), res.end());
+  return res;
+}
+
+// the rows of the input sides are derived from their row numbers, so the join result is computed by nested loops
+std::vector<SHJoinRes> getHJoinTestExpected() {
+  SHJoinTestInput build = {.numOfBlocks = 5, .rowsPerBlock = 4096, .numOfKeys = 5120, .valBase = 0};
+  SHJoinTestInput probe = {.numOfBlocks = 4, .rowsPerBlock = 1000, .numOfKeys = 6000, .valBase = 1000000};
+
+  std::vector<std::vector<int64_t>> buildRows(probe.numOfKeys);
+  for (int64_t row = 0; row < (int64_t)build.numOfBlocks * build.rowsPerBlock; ++row) {
+    buildRows[getHJoinTestKey(&build, row)].push_back(row);
+  }
+
+  std::vector<SHJoinRes> res;
+  for (int64_t row = 0; row < (int64_t)probe.numOfBlocks * probe.rowsPerBlock; ++row) {
+    int32_t key = getHJoinTestKey(&probe, row);
+    for (int64_t buildRow : buildRows[key]) {
+      res.emplace_back(build.valBase + buildRow, probe.valBase + row, "key_" + std::to_string(key),
+                       "val_" + std::to_string(build.valBase + buildRow));
+    }
+  }
+
+  std::sort(res.begin(), res.end());
+  return res;
+}
+
+}  // namespace
+
+class HashJoinTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    strcpy(tsTempDir, TD_TMP_DIR_PATH);
+    osUpdate();
+    expected = getHJoinTestExpected();
+    ASSERT_GT(expected.size(), 0);
+  }
+
+  static void TearDownTestSuite() { expected.clear(); }
+
+  static std::vector<SHJoinRes> expected;
+};
+
+std::vector<SHJoinRes> HashJoinTest::expected;
+
+TEST_F(HashJoinTest, spillIntKey) {
+  SHJoinTestStat memStat = {0}, spillStat = {0};
+
+  std::vector<SHJoinRes> inMem = runHJoinTest({.keySlots = {HJ_SLOT_IKEY}, .bufferSize = 0}, &memStat);
+  ASSERT_FALSE(memStat.spilled);
+  ASSERT_EQ(inMem, expected);
+
+  // the first row page of the build side is already over 1MB, so all blocks after the first are spilled
+  std::vector<SHJoinRes> spilled = runHJoinTest({.keySlots = {HJ_SLOT_IKEY}, .bufferSize = 1}, &spillStat);
+  ASSERT_TRUE(spillStat.spilled);
+  ASSERT_GT(spillStat.spillBuildRows, 4096);
+  ASSERT_GT(spillStat.spillProbeRows, 0);
+  ASSERT_EQ(spilled, inMem);
+  ASSERT_EQ(spillStat.memUsed, 0);
+}
+
+TEST_F(HashJoinTest, spillVarKey) {
+  SHJoinTestStat memStat = {0}, spillStat = {0};
+
+  std::vector<SHJoinRes> inMem = runHJoinTest({.keySlots = {HJ_SLOT_VKEY}, .bufferSize = 0}, &memStat);
+  ASSERT_EQ(inMem, expected);
+
+  // the var-length keys and values of the spilled partitions are restored from the spill pages
+  std::vector<SHJoinRes> spilled = runHJoinTest({.keySlots = {HJ_SLOT_VKEY}, .bufferSize = 1}, &spillStat);
+  ASSERT_TRUE(spillStat.spilled);
+  ASSERT_GT(spillStat.spillProbeRows, 0);
+  ASSERT_EQ(spilled, inMem);
+}
+
+TEST_F(HashJoinTest, spillMultiKey) {
+  SHJoinTestStat spillStat = {0};
+
+  std::vector<SHJoinRes> spilled =
+      runHJoinTest({.keySlots = {HJ_SLOT_IKEY, HJ_SLOT_VKEY}, .bufferSize = 1}, &spillStat);
+  ASSERT_TRUE(spillStat.spilled);
+  ASSERT_EQ(spilled, expected);
+}
+
+TEST_F(HashJoinTest, spillByMemBudget) {
+  SHJoinTestStat stat = {0};
+
+  // below hashJoinBufferSize, but the memory budget of the task refuses the build side
+  std::vector<SHJoinRes> spilled =
+      runHJoinTest({.keySlots = {HJ_SLOT_IKEY}, .bufferSize = 1024, .refuseMem = true}, &stat);
+  ASSERT_TRUE(stat.spilled);
+  ASSERT_EQ(spilled, expected);
+  ASSERT_EQ(stat.memUsed, 0);
+}
+
+TEST_F(HashJoinTest, runtimeFilter) {
+  SHJoinTestStat stat = {0};
+
+  // the probe keys without build rows are dropped by the scan, the result is the same
+  std::vector<SHJoinRes> res = runHJoinTest({.keySlots = {HJ_SLOT_IKEY}, .bufferSize = 0, .tableScan = true}, &stat);
+  ASSERT_GT(stat.filterOutRows, 0);
+  ASSERT_EQ(res, expected);
+
+  // also when the build side is spilled, as the filter has all build keys
+  res = runHJoinTest({.keySlots = {HJ_SLOT_IKEY}, .bufferSize = 1, .tableScan = true}, &stat);
+  ASSERT_TRUE(stat.spilled);
+  ASSERT_GT(stat.filterOutRows, 0);
+  ASSERT_EQ(res, expected);
+}
+
+TEST(runtimeFilterTest, filterRows) {
+  const int32_t rows = 300;
+
+  // the build keys are the even numbers in [100, 200]
+  SScanRuntimeFilter filter = {.slotId = 1, .type = TSDB_DATA_TYPE_INT, .hasRange = true, .min = 100, .max = 200};
+  filter.pBloom = tBloomFilterInit(64, 0.01);
+  for (int32_t key = 100; key <= 200; key += 2) {
+    ASSERT_EQ(tBloomFilterPut(filter.pBloom, &key, sizeof(key)), TSDB_CODE_SUCCESS);
+  }
+
+  SSDataBlock*    pBlock = createDataBlock();
+  SColumnInfoData val = createColumnInfoData(TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), 1);
+  SColumnInfoData key = createColumnInfoData(TSDB_DATA_TYPE_INT, sizeof(int32_t), 2);
+  blockDataAppendColInfo(pBlock, &val);
+  blockDataAppendColInfo(pBlock, &key);
+  blockDataEnsureCapacity(pBlock, rows + 1);
+  for (int32_t i = 0; i < rows; ++i) {
+    int64_t v = i * 10;
+    colDataSetVal((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0), i, (const char*)&v, false);
+    colDataSetVal((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 1), i, (const char*)&i, false);
+  }
+  colDataSetNULL((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0), rows);
+  colDataSetNULL((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 1), rows);
+  pBlock->info.rows = rows + 1;
+
+  doFilterByRuntimeFilter(&filter, pBlock);
+
+  // every build key is kept with its row, the null key and the keys out of the range are dropped
+  std::vector<int32_t> kept;
+  int32_t              falsePositive = 0;
+  for (int32_t i = 0; i < pBlock->info.rows; ++i) {
+    SColumnInfoData* pKeyCol = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 1);
+    ASSERT_FALSE(colDataIsNull_s(pKeyCol, i));
+    int32_t k = *(int32_t*)colDataGetData(pKeyCol, i);
+    ASSERT_EQ(*(int64_t*)colDataGetData((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0), i), k * 10);
+    ASSERT_GE(k, 100);
+    ASSERT_LE(k, 200);
+    if (k % 2 == 0) {
+      kept.push_back(k);
+    } else {
+      falsePositive++;
+    }
+  }
+  ASSERT_EQ(kept.size(), 51);
+  ASSERT_LE(falsePositive, 5);
+  ASSERT_EQ(filter.filterOutRows, rows + 1 - pBlock->info.rows);
+
+  // a block without any build key is emptied
+  blockDataCleanup(pBlock);
+  for (int32_t i = 0; i < 10; ++i) {
+    int32_t k = 1000 + i;
+    colDataSetVal((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 1), i, (const char*)&k, false);
+  }
+  pBlock->info.rows = 10;
+  doFilterByRuntimeFilter(&filter, pBlock);
+  ASSERT_EQ(pBlock->info.rows, 0);
+
+  tBloomFilterDestroy(filter.pBloom);
+  blockDataDestroy(pBlock);
+}
+
+TEST(runtimeFilterTest, filterVarRows) {
+  SScanRuntimeFilter filter = {.slotId = 0, .type = TSDB_DATA_TYPE_VARCHAR};
+  filter.pBloom = tBloomFilterInit(64, 0.01);
+
+  SSDataBlock*    pBlock = createDataBlock();
+  SColumnInfoData key = createColumnInfoData(TSDB_DATA_TYPE_VARCHAR, HJ_VAR_BYTES, 1);
+  blockDataAppendColInfo(pBlock, &key);
+  blockDataEnsureCapacity(pBlock, 100);
+
+  // the build side puts the keys with their var header, as the scan looks them up
+  SColumnInfoData* pKeyCol = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0);
+  for (int32_t i = 0; i < 100; ++i) {
+    setHJoinTestVarVal(pKeyCol, i, "key_%" PRId64, i);
+    if (i % 10 == 0) {
+      char* pKey = colDataGetData(pKeyCol, i);
+      ASSERT_EQ(tBloomFilterPut(filter.pBloom, pKey, varDataTLen(pKey)), TSDB_CODE_SUCCESS);
+    }
+  }
+  pBlock->info.rows = 100;
+
+  doFilterByRuntimeFilter(&filter, pBlock);
+  int32_t matched = 0;
+  for (int32_t i = 0; i < pBlock->info.rows; ++i) {
+    char* pKey = colDataGetData(pKeyCol, i);
+    int32_t k = atoi(std::string(varDataVal(pKey) + 4, varDataLen(pKey) - 4).c_str());
+    matched += (k % 10 == 0);
+  }
+  ASSERT_EQ(matched, 10);
+  ASSERT_LE(pBlock->info.rows, 15);
+
+  tBloomFilterDestroy(filter.pBloom);
+  blockDataDestroy(pBlock);
+}
+
+TEST(runtimeFilterTest, filterBlocks) {
+  SScanRuntimeFilter filter = {.slotId = 1, .type = TSDB_DATA_TYPE_INT, .hasRange = true, .min = 100, .max = 200};
+  SSDataBlock*       pBlock = createDataBlock();
+  SColumnInfoData    val = createColumnInfoData(TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), 1);
+  SColumnInfoData    key = createColumnInfoData(TSDB_DATA_TYPE_INT, sizeof(int32_t), 2);
+  blockDataAppendColInfo(pBlock, &val);
+  blockDataAppendColInfo(pBlock, &key);
+  pBlock->info.rows = 10;
+
+  // a block without sma is always loaded
+  ASSERT_TRUE(doFilterByRuntimeFilterSMA(&filter, pBlock));
+
+  // only the blocks of which the key range overlaps with the build keys are loaded
+  SColumnDataAgg  agg = {.colId = 2, .numOfNull = 0, .max = 160, .min = 150};
+  SColumnDataAgg* aggs[2] = {NULL, &agg};
+  pBlock->pBlockAgg = aggs;
+  ASSERT_TRUE(doFilterByRuntimeFilterSMA(&filter, pBlock));
+  agg.min = 0, agg.max = 99;
+  ASSERT_FALSE(doFilterByRuntimeFilterSMA(&filter, pBlock));
+  agg.min = 201, agg.max = 300;
+  ASSERT_FALSE(doFilterByRuntimeFilterSMA(&filter, pBlock));
+  agg.min = 0, agg.max = 100;
+  ASSERT_TRUE(doFilterByRuntimeFilterSMA(&filter, pBlock));
+  agg.min = 200, agg.max = 300;
+  ASSERT_TRUE(doFilterByRuntimeFilterSMA(&filter, pBlock));
+  agg.min = 0, agg.max = 300;
+  ASSERT_TRUE(doFilterByRuntimeFilterSMA(&filter, pBlock));
+
+  // a block of null keys never matches
+  agg.min = 150, agg.max = 150, agg.numOfNull = 10;
+  ASSERT_FALSE(doFilterByRuntimeFilterSMA(&filter, pBlock));
+
+  // no range for the key type
+  filter.hasRange = false;
+  agg.min = 0, agg.max = 99, agg.numOfNull = 0;
+  ASSERT_TRUE(doFilterByRuntimeFilterSMA(&filter, pBlock));
+
+  pBlock->pBlockAgg = NULL;
+  blockDataDestroy(pBlock);
+}
+
+#pragma GCC diagnostic pop
@@ -63,9 +63,8 @@
 
 #define GET_INVOKE_INTRINSIC_THRESHOLD(_bits, _bytes) ((_bits) / ((_bytes) << 3u))
 
-static void calculateRounds(int32_t numOfRows, int32_t bytes, int32_t* remainder, int32_t* rounds, int32_t* width) {
-  const int32_t bitWidth = 256;
-
+static void calculateRounds(int32_t numOfRows, int32_t bytes, int32_t bitWidth, int32_t* remainder, int32_t* rounds,
+                            int32_t* width) {
   *width = (bitWidth >> 3u) / bytes;
   *remainder = numOfRows % (*width);
   *rounds = numOfRows / (*width);
@@ -95,12 +94,18 @@ static void calculateRounds(int32_t numOfRows, int32_t bytes, int32_t* remainder
     }                                                      \
   }
 
-static int8_t i8VectorCmpAVX2(const void* pData, int32_t numOfRows, bool isMinFunc, bool signVal) {
+// merge the min/max value of current block into the result buffer
+#define __COMPARE_MERGE_VAL(_assign, _val, _blockVal, _isMin)                        \
+  if (!(_assign) || ((_isMin) ? ((_blockVal) < (_val)) : ((_blockVal) > (_val)))) { \
+    (_val) = (_blockVal);                                                            \
+  }
+
+static int8_t i8VectorCmpAVX2(const int8_t* pData, int32_t numOfRows, bool isMinFunc, bool signVal) {
   int8_t        v = 0;
   const int8_t* p = pData;
 
   int32_t width, remain, rounds;
-  calculateRounds(numOfRows, sizeof(int8_t), &remain, &rounds, &width);
+  calculateRounds(numOfRows, sizeof(int8_t), 256, &remain, &rounds, &width);
 
 #if __AVX2__
   __m256i next;
@@ -109,7 +114,7 @@ static int8_t i8VectorCmpAVX2(const void* pData, int32_t numOfRows, bool isMinFu
 
   if (!isMinFunc) {  // max function
     if (signVal) {
-      for (int32_t i = 0; i < rounds; ++i) {
+      for (int32_t i = 1; i < rounds; ++i) {
         next = _mm256_lddqu_si256((__m256i*)p);
         initVal = _mm256_max_epi8(initVal, next);
         p += width;
@@ -118,19 +123,21 @@ static int8_t i8VectorCmpAVX2(const void* pData, int32_t numOfRows, bool isMinFu
       const int8_t* q = (const int8_t*)&initVal;
       EXTRACT_MAX_VAL(q, p, width, remain, v)
     } else {  // unsigned value
-      for (int32_t i = 0; i < rounds; ++i) {
+      for (int32_t i = 1; i < rounds; ++i) {
         next = _mm256_lddqu_si256((__m256i*)p);
         initVal = _mm256_max_epu8(initVal, next);
         p += width;
       }
 
       const uint8_t* q = (const uint8_t*)&initVal;
-      EXTRACT_MAX_VAL(q, p, width, remain, v)
+      uint8_t        uv = 0;
+      EXTRACT_MAX_VAL(q, (const uint8_t*)p, width, remain, uv)
+      v = (int8_t)uv;
     }
 
   } else {  // min function
     if (signVal) {
-      for (int32_t i = 0; i < rounds; ++i) {
+      for (int32_t i = 1; i < rounds; ++i) {
         next = _mm256_lddqu_si256((__m256i*)p);
         initVal = _mm256_min_epi8(initVal, next);
         p += width;
@@ -140,7 +147,7 @@ static int8_t i8VectorCmpAVX2(const void* pData, int32_t numOfRows, bool isMinFu
       const int8_t* q = (const int8_t*)&initVal;
       EXTRACT_MIN_VAL(q, p, width, remain, v)
     } else {
-      for (int32_t i = 0; i < rounds; ++i) {
+      for (int32_t i = 1; i < rounds; ++i) {
         next = _mm256_lddqu_si256((__m256i*)p);
         initVal = _mm256_min_epu8(initVal, next);
         p += width;
@@ -148,7 +155,9 @@ static int8_t i8VectorCmpAVX2(const void* pData, int32_t numOfRows, bool isMinFu
 
       // let sum up the final results
       const uint8_t* q = (const uint8_t*)&initVal;
-      EXTRACT_MIN_VAL(q, p, width, remain, v)
+      uint8_t        uv = 0;
+      EXTRACT_MIN_VAL(q, (const uint8_t*)p, width, remain, uv)
+      v = (int8_t)uv;
     }
   }
 #endif
@@ -161,7 +170,7 @@ static int16_t i16VectorCmpAVX2(const int16_t* pData, int32_t numOfRows, bool is
   const int16_t* p = pData;
 
   int32_t width, remain, rounds;
-  calculateRounds(numOfRows, sizeof(int16_t), &remain, &rounds, &width);
+  calculateRounds(numOfRows, sizeof(int16_t), 256, &remain, &rounds, &width);
 
 #if __AVX2__
   __m256i next;
@@ -170,7 +179,7 @@ static int16_t i16VectorCmpAVX2(const int16_t* pData, int32_t numOfRows, bool is
 
   if (!isMinFunc) {  // max function
     if (signVal) {
-      for (int32_t i = 0; i < rounds; ++i) {
+      for (int32_t i = 1; i < rounds; ++i) {
         next = _mm256_lddqu_si256((__m256i*)p);
         initVal = _mm256_max_epi16(initVal, next);
         p += width;
@@ -180,7 +189,7 @@ static int16_t i16VectorCmpAVX2(const int16_t* pData, int32_t numOfRows, bool is
       const int16_t* q = (const int16_t*)&initVal;
       EXTRACT_MAX_VAL(q, p, width, remain, v)
     } else {
-      for (int32_t i = 0; i < rounds; ++i) {
+      for (int32_t i = 1; i < rounds; ++i) {
         next = _mm256_lddqu_si256((__m256i*)p);
         initVal = _mm256_max_epu16(initVal, next);
         p += width;
@@ -188,12 +197,14 @@ static int16_t i16VectorCmpAVX2(const int16_t* pData, int32_t numOfRows, bool is
 
       // let sum up the final results
       const uint16_t* q = (const uint16_t*)&initVal;
-      EXTRACT_MAX_VAL(q, p, width, remain, v)
+      uint16_t        uv = 0;
+      EXTRACT_MAX_VAL(q, (const uint16_t*)p, width, remain, uv)
+      v = (int16_t)uv;
     }
 
   } else {  // min function
     if (signVal) {
-      for (int32_t i = 0; i < rounds; ++i) {
+      for (int32_t i = 1; i < rounds; ++i) {
         next = _mm256_lddqu_si256((__m256i*)p);
         initVal = _mm256_min_epi16(initVal, next);
         p += width;
@@ -203,15 +214,17 @@ static int16_t i16VectorCmpAVX2(const int16_t* pData, int32_t numOfRows, bool is
       const int16_t* q = (const int16_t*)&initVal;
       EXTRACT_MIN_VAL(q, p, width, remain, v)
     } else {
-      for (int32_t i = 0; i < rounds; ++i) {
+      for (int32_t i = 1; i < rounds; ++i) {
         next = _mm256_lddqu_si256((__m256i*)p);
-        initVal = _mm256_min_epi16(initVal, next);
+        initVal = _mm256_min_epu16(initVal, next);
         p += width;
       }
 
       // let sum up the final results
       const uint16_t* q = (const uint16_t*)&initVal;
-      EXTRACT_MIN_VAL(q, p, width, remain, v)
+      uint16_t        uv = 0;
+      EXTRACT_MIN_VAL(q, (const uint16_t*)p, width, remain, uv)
+      v = (int16_t)uv;
     }
   }
 #endif
@@ -224,7 +237,7 @@ static int32_t i32VectorCmpAVX2(const int32_t* pData, int32_t numOfRows, bool is
   const int32_t* p = pData;
 
   int32_t width, remain, rounds;
-  calculateRounds(numOfRows, sizeof(int32_t), &remain, &rounds, &width);
+  calculateRounds(numOfRows, sizeof(int32_t), 256, &remain, &rounds, &width);
 
 #if __AVX2__
   __m256i next;
@@ -233,7 +246,7 @@ static int32_t i32VectorCmpAVX2(const int32_t* pData, int32_t numOfRows, bool is
 
   if (!isMinFunc) {  // max function
     if (signVal) {
-      for (int32_t i = 0; i < rounds; ++i) {
+      for (int32_t i = 1; i < rounds; ++i) {
         next = _mm256_lddqu_si256((__m256i*)p);
         initVal = _mm256_max_epi32(initVal, next);
         p += width;
@@ -243,19 +256,21 @@ static int32_t i32VectorCmpAVX2(const int32_t* pData, int32_t numOfRows, bool is
       const int32_t* q = (const int32_t*)&initVal;
       EXTRACT_MAX_VAL(q, p, width, remain, v)
     } else {  // unsigned value
-      for (int32_t i = 0; i < rounds; ++i) {
+      for (int32_t i = 1; i < rounds; ++i) {
         next = _mm256_lddqu_si256((__m256i*)p);
-        initVal = _mm256_max_epi32(initVal, next);
+        initVal = _mm256_max_epu32(initVal, next);
         p += width;
       }
 
       // let compare  the final results
       const uint32_t* q = (const uint32_t*)&initVal;
-      EXTRACT_MAX_VAL(q, p, width, remain, v)
+      uint32_t        uv = 0;
+      EXTRACT_MAX_VAL(q, (const uint32_t*)p, width, remain, uv)
+      v = (int32_t)uv;
     }
   } else {  // min function
     if (signVal) {
-      for (int32_t i = 0; i < rounds; ++i) {
+      for (int32_t i = 1; i < rounds; ++i) {
         next = _mm256_lddqu_si256((__m256i*)p);
         initVal = _mm256_min_epi32(initVal, next);
         p += width;
@@ -265,7 +280,7 @@ static int32_t i32VectorCmpAVX2(const int32_t* pData, int32_t numOfRows, bool is
       const int32_t* q = (const int32_t*)&initVal;
       EXTRACT_MIN_VAL(q, p, width, remain, v)
     } else {
-      for (int32_t i = 0; i < rounds; ++i) {
+      for (int32_t i = 1; i < rounds; ++i) {
         next = _mm256_lddqu_si256((__m256i*)p);
         initVal = _mm256_min_epu32(initVal, next);
         p += width;
@@ -273,8 +288,63 @@ static int32_t i32VectorCmpAVX2(const int32_t* pData, int32_t numOfRows, bool is
 
       // let sum up the final results
       const uint32_t* q = (const uint32_t*)&initVal;
+      uint32_t        uv = 0;
+      EXTRACT_MIN_VAL(q, (const uint32_t*)p, width, remain, uv)
+      v = (int32_t)uv;
+    }
+  }
+#endif
+
+  return v;
+}
+
+static int64_t i64VectorCmpAVX2(const int64_t* pData, int32_t numOfRows, bool isMinFunc, bool signVal) {
+  int64_t        v = 0;
+  const int64_t* p = pData;
+
+  int32_t width, remain, rounds;
+  calculateRounds(numOfRows, sizeof(int64_t), 256, &remain, &rounds, &width);
+
+#if __AVX2__
+  // there is no 64-bit min/max instruction in AVX2, so compare and blend instead. The unsigned values are compared
+  // as signed ones after flipping the sign bit.
+  const __m256i flip = signVal ? _mm256_setzero_si256() : _mm256_set1_epi64x(INT64_MIN);
+
+  __m256i next;
+  __m256i initVal = _mm256_xor_si256(_mm256_lddqu_si256((__m256i*)p), flip);
+  p += width;
+
+  if (!isMinFunc) {  // max function
+    for (int32_t i = 1; i < rounds; ++i) {
+      next = _mm256_xor_si256(_mm256_lddqu_si256((__m256i*)p), flip);
+      initVal = _mm256_blendv_epi8(initVal, next, _mm256_cmpgt_epi64(next, initVal));
+      p += width;
+    }
+  } else {  // min function
+    for (int32_t i = 1; i < rounds; ++i) {
+      next = _mm256_xor_si256(_mm256_lddqu_si256((__m256i*)p), flip);
+      initVal = _mm256_blendv_epi8(initVal, next, _mm256_cmpgt_epi64(initVal, next));
+      p += width;
+    }
+  }
+
+  initVal = _mm256_xor_si256(initVal, flip);
+  if (signVal) {
+    const int64_t* q = (const int64_t*)&initVal;
+    if (!isMinFunc) {
+      EXTRACT_MAX_VAL(q, p, width, remain, v)
+    } else {
       EXTRACT_MIN_VAL(q, p, width, remain, v)
     }
+  } else {
+    const uint64_t* q = (const uint64_t*)&initVal;
+    uint64_t        uv = 0;
+    if (!isMinFunc) {
+      EXTRACT_MAX_VAL(q, (const uint64_t*)p, width, remain, uv)
+    } else {
+      EXTRACT_MIN_VAL(q, (const uint64_t*)p, width, remain, uv)
+    }
+    v = (int64_t)uv;
   }
 #endif
 
@@ -286,7 +356,7 @@ static float floatVectorCmpAVX(const float* pData, int32_t numOfRows, bool isMin
   const float* p = pData;
 
   int32_t width, remain, rounds;
-  calculateRounds(numOfRows, sizeof(float), &remain, &rounds, &width);
+  calculateRounds(numOfRows, sizeof(float), 256, &remain, &rounds, &width);
 
 #if __AVX__
 
@@ -323,7 +393,7 @@ static double doubleVectorCmpAVX(const double* pData, int32_t numOfRows, bool is
   const double* p = pData;
 
   int32_t width, remain, rounds;
-  calculateRounds(numOfRows, sizeof(double), &remain, &rounds, &width);
+  calculateRounds(numOfRows, sizeof(double), 256, &remain, &rounds, &width);
 
 #if __AVX__
 
@@ -357,6 +427,322 @@ static double doubleVectorCmpAVX(const double* pData, int32_t numOfRows, bool is
   return v;
 }
 
+#if __AVX512BW__
+static int8_t i8VectorCmpAVX512(const int8_t* pData, int32_t numOfRows, bool isMinFunc, bool signVal) {
+  int8_t        v = 0;
+  const int8_t* p = pData;
+
+  int32_t width, remain, rounds;
+  calculateRounds(numOfRows, sizeof(int8_t), 512, &remain, &rounds, &width);
+
+  __m512i initVal = _mm512_loadu_si512(p);
+  p += width;
+
+  for (int32_t i = 1; i < rounds; ++i) {
+    __m512i next = _mm512_loadu_si512(p);
+    if (signVal) {
+      initVal = isMinFunc ? _mm512_min_epi8(initVal, next) : _mm512_max_epi8(initVal, next);
+    } else {
+      initVal = isMinFunc ? _mm512_min_epu8(initVal, next) : _mm512_max_epu8(initVal, next);
+    }
+    p += width;
+  }
+
+  if (signVal) {
+    const int8_t* q = (const int8_t*)&initVal;
+    if (isMinFunc) {
+      EXTRACT_MIN_VAL(q, p, width, remain, v)
+    } else {
+      EXTRACT_MAX_VAL(q, p, width, remain, v)
+    }
+  } else {
+    const uint8_t* q = (const uint8_t*)&initVal;
+    uint8_t        uv = 0;
+    if (isMinFunc) {
+      EXTRACT_MIN_VAL(q, (const uint8_t*)p, width, remain, uv)
+    } else {
+      EXTRACT_MAX_VAL(q, (const uint8_t*)p, width, remain, uv)
+    }
+    v = (int8_t)uv;
+  }
+
+  return v;
+}
+
+static int16_t i16VectorCmpAVX512(const int16_t* pData, int32_t numOfRows, bool isMinFunc, bool signVal) {
+  int16_t        v = 0;
+  const int16_t* p = pData;
+
+  int32_t width, remain, rounds;
+  calculateRounds(numOfRows, sizeof(int16_t), 512, &remain, &rounds, &width);
+
+  __m512i initVal = _mm512_loadu_si512(p);
+  p += width;
+
+  for (int32_t i = 1; i < rounds; ++i) {
+    __m512i next = _mm512_loadu_si512(p);
+    if (signVal) {
+      initVal = isMinFunc ? _mm512_min_epi16(initVal, next) : _mm512_max_epi16(initVal, next);
+    } else {
+      initVal = isMinFunc ? _mm512_min_epu16(initVal, next) : _mm512_max_epu16(initVal, next);
+    }
+    p += width;
+  }
+
+  if (signVal) {
+    const int16_t* q = (const int16_t*)&initVal;
+    if (isMinFunc) {
+      EXTRACT_MIN_VAL(q, p, width, remain, v)
+    } else {
+      EXTRACT_MAX_VAL(q, p, width, remain, v)
+    }
+  } else {
+    const uint16_t* q = (const uint16_t*)&initVal;
+    uint16_t        uv = 0;
+    if (isMinFunc) {
+      EXTRACT_MIN_VAL(q, (const uint16_t*)p, width, remain, uv)
+    } else {
+      EXTRACT_MAX_VAL(q, (const uint16_t*)p, width, remain, uv)
+    }
+    v = (int16_t)uv;
+  }
+
+  return v;
+}
+#endif
+
+#if __AVX512F__
+static int32_t i32VectorCmpAVX512(const int32_t* pData, int32_t numOfRows, bool isMinFunc, bool signVal) {
+  int32_t        v = 0;
+  const int32_t* p = pData;
+
+  int32_t width, remain, rounds;
+  calculateRounds(numOfRows, sizeof(int32_t), 512, &remain, &rounds, &width);
+
+  __m512i initVal = _mm512_loadu_si512(p);
+  p += width;
+
+  for (int32_t i = 1; i < rounds; ++i) {
+    __m512i next = _mm512_loadu_si512(p);
+    if (signVal) {
+      initVal = isMinFunc ? _mm512_min_epi32(initVal, next) : _mm512_max_epi32(initVal, next);
+    } else {
+      initVal = isMinFunc ? _mm512_min_epu32(initVal, next) : _mm512_max_epu32(initVal, next);
+    }
+    p += width;
+  }
+
+  if (signVal) {
+    v = isMinFunc ? _mm512_reduce_min_epi32(initVal) : _mm512_reduce_max_epi32(initVal);
+    if (isMinFunc) {
+      __COMPARE_EXTRACT_MIN(0, remain, v, p);
+    } else {
+      __COMPARE_EXTRACT_MAX(0, remain, v, p);
+    }
+  } else {
+    const uint32_t* q = (const uint32_t*)p;
+    uint32_t        uv = isMinFunc ? _mm512_reduce_min_epu32(initVal) : _mm512_reduce_max_epu32(initVal);
+    if (isMinFunc) {
+      __COMPARE_EXTRACT_MIN(0, remain, uv, q);
+    } else {
+      __COMPARE_EXTRACT_MAX(0, remain, uv, q);
+    }
+    v = (int32_t)uv;
+  }
+
+  return v;
+}
+
+static int64_t i64VectorCmpAVX512(const int64_t* pData, int32_t numOfRows, bool isMinFunc, bool signVal) {
+  int64_t        v = 0;
+  const int64_t* p = pData;
+
+  int32_t width, remain, rounds;
+  calculateRounds(numOfRows, sizeof(int64_t), 512, &remain, &rounds, &width);
+
+  __m512i initVal = _mm512_loadu_si512(p);
+  p += width;
+
+  for (int32_t i = 1; i < rounds; ++i) {
+    __m512i next = _mm512_loadu_si512(p);
+    if (signVal) {
+      initVal = isMinFunc ? _mm512_min_epi64(initVal, next) : _mm512_max_epi64(initVal, next);
+    } else {
+      initVal = isMinFunc ? _mm512_min_epu64(initVal, next) : _mm512_max_epu64(initVal, next);
+    }
+    p += width;
+  }
+
+  if (signVal) {
+    v = isMinFunc ? _mm512_reduce_min_epi64(initVal) : _mm512_reduce_max_epi64(initVal);
+    if (isMinFunc) {
+      __COMPARE_EXTRACT_MIN(0, remain, v, p);
+    } else {
+      __COMPARE_EXTRACT_MAX(0, remain, v, p);
+    }
+  } else {
+    const uint64_t* q = (const uint64_t*)p;
+    uint64_t        uv = isMinFunc ? _mm512_reduce_min_epu64(initVal) : _mm512_reduce_max_epu64(initVal);
+    if (isMinFunc) {
+      __COMPARE_EXTRACT_MIN(0, remain, uv, q);
+    } else {
+      __COMPARE_EXTRACT_MAX(0, remain, uv, q);
+    }
+    v = (int64_t)uv;
+  }
+
+  return v;
+}
+
+static float floatVectorCmpAVX512(const float* pData, int32_t numOfRows, bool isMinFunc) {
+  const float* p = pData;
+
+  int32_t width, remain, rounds;
+  calculateRounds(numOfRows, sizeof(float), 512, &remain, &rounds, &width);
+
+  __m512 initVal = _mm512_loadu_ps(p);
+  p += width;
+
+  for (int32_t i = 1; i < rounds; ++i) {
+    __m512 next = _mm512_loadu_ps(p);
+    initVal = isMinFunc ? _mm512_min_ps(initVal, next) : _mm512_max_ps(initVal, next);
+    p += width;
+  }
+
+  float v = isMinFunc ? _mm512_reduce_min_ps(initVal) : _mm512_reduce_max_ps(initVal);
+  if (isMinFunc) {
+    __COMPARE_EXTRACT_MIN(0, remain, v, p);
+  } else {
+    __COMPARE_EXTRACT_MAX(0, remain, v, p);
+  }
+
+  return v;
+}
+
+static double doubleVectorCmpAVX512(const double* pData, int32_t numOfRows, bool isMinFunc) {
+  const double* p = pData;
+
+  int32_t width, remain, rounds;
+  calculateRounds(numOfRows, sizeof(double), 512, &remain, &rounds, &width);
+
+  __m512d initVal = _mm512_loadu_pd(p);
+  p += width;
+
+  for (int32_t i = 1; i < rounds; ++i) {
+    __m512d next = _mm512_loadu_pd(p);
+    initVal = isMinFunc ? _mm512_min_pd(initVal, next) : _mm512_max_pd(initVal, next);
+    p += width;
+  }
+
+  double v = isMinFunc ? _mm512_reduce_min_pd(initVal) : _mm512_reduce_max_pd(initVal);
+  if (isMinFunc) {
+    __COMPARE_EXTRACT_MIN(0, remain, v, p);
+  } else {
+    __COMPARE_EXTRACT_MAX(0, remain, v, p);
+  }
+
+  return v;
+}
+#endif
+
+// Pick the widest kernel available for the column. The kernels require at least one full vector of data, so false is
+// returned when the input is too short or no SIMD kernel is compiled in, and the caller falls back to the scalar loop.
+static bool i8VectorCmp(const int8_t* p, int32_t numOfRows, bool isMinFunc, bool signVal, int8_t* pRes) {
+#if __AVX512BW__
+  if (tsSIMDEnable && tsAVX512Enable && numOfRows >= GET_INVOKE_INTRINSIC_THRESHOLD(512, sizeof(int8_t))) {
+    *pRes = i8VectorCmpAVX512(p, numOfRows, isMinFunc, signVal);
+    return true;
+  }
+#endif
+#if __AVX2__
+  if (tsSIMDEnable && tsAVX2Enable && numOfRows >= GET_INVOKE_INTRINSIC_THRESHOLD(256, sizeof(int8_t))) {
+    *pRes = i8VectorCmpAVX2(p, numOfRows, isMinFunc, signVal);
+    return true;
+  }
+#endif
+  return false;
+}
+
+static bool i16VectorCmp(const int16_t* p, int32_t numOfRows, bool isMinFunc, bool signVal, int16_t* pRes) {
+#if __AVX512BW__
+  if (tsSIMDEnable && tsAVX512Enable && numOfRows >= GET_INVOKE_INTRINSIC_THRESHOLD(512, sizeof(int16_t))) {
+    *pRes = i16VectorCmpAVX512(p, numOfRows, isMinFunc, signVal);
+    return true;
+  }
+#endif
+#if __AVX2__
+  if (tsSIMDEnable && tsAVX2Enable && numOfRows >= GET_INVOKE_INTRINSIC_THRESHOLD(256, sizeof(int16_t))) {
+    *pRes = i16VectorCmpAVX2(p, numOfRows, isMinFunc, signVal);
+    return true;
+  }
+#endif
+  return false;
+}
+
+static bool i32VectorCmp(const int32_t* p, int32_t numOfRows, bool isMinFunc, bool signVal, int32_t* pRes) {
+#if __AVX512F__
+  if (tsSIMDEnable && tsAVX512Enable && numOfRows >= GET_INVOKE_INTRINSIC_THRESHOLD(512, sizeof(int32_t))) {
+    *pRes = i32VectorCmpAVX512(p, numOfRows, isMinFunc, signVal);
+    return true;
+  }
+#endif
+#if __AVX2__
+  if (tsSIMDEnable && tsAVX2Enable && numOfRows >= GET_INVOKE_INTRINSIC_THRESHOLD(256, sizeof(int32_t))) {
+    *pRes = i32VectorCmpAVX2(p, numOfRows, isMinFunc, signVal);
+    return true;
+  }
+#endif
+  return false;
+}
+
+static bool i64VectorCmp(const int64_t* p, int32_t numOfRows, bool isMinFunc, bool signVal, int64_t* pRes) {
+#if __AVX512F__
+  if (tsSIMDEnable && tsAVX512Enable && numOfRows >= GET_INVOKE_INTRINSIC_THRESHOLD(512, sizeof(int64_t))) {
+    *pRes = i64VectorCmpAVX512(p, numOfRows, isMinFunc, signVal);
+    return true;
+  }
+#endif
+#if __AVX2__
+  if (tsSIMDEnable && tsAVX2Enable && numOfRows >= GET_INVOKE_INTRINSIC_THRESHOLD(256, sizeof(int64_t))) {
+    *pRes = i64VectorCmpAVX2(p, numOfRows, isMinFunc, signVal);
+    return true;
+  }
+#endif
+  return false;
+}
+
+static bool floatVectorCmp(const float* p, int32_t numOfRows, bool isMinFunc, float* pRes) {
+#if __AVX512F__
+  if (tsSIMDEnable && tsAVX512Enable && numOfRows >= GET_INVOKE_INTRINSIC_THRESHOLD(512, sizeof(float))) {
+    *pRes = floatVectorCmpAVX512(p, numOfRows, isMinFunc);
+    return true;
+  }
+#endif
+#if __AVX__
+  if (tsSIMDEnable && tsAVXEnable && numOfRows >= GET_INVOKE_INTRINSIC_THRESHOLD(256, sizeof(float))) {
+    *pRes = floatVectorCmpAVX(p, numOfRows, isMinFunc);
+    return true;
+  }
+#endif
+  return false;
+}
+
+static bool doubleVectorCmp(const double* p, int32_t numOfRows, bool isMinFunc, double* pRes) {
+#if __AVX512F__
+  if (tsSIMDEnable && tsAVX512Enable && numOfRows >= GET_INVOKE_INTRINSIC_THRESHOLD(512, sizeof(double))) {
+    *pRes = doubleVectorCmpAVX512(p, numOfRows, isMinFunc);
+    return true;
+  }
+#endif
+#if __AVX__
+  if (tsSIMDEnable && tsAVXEnable && numOfRows >= GET_INVOKE_INTRINSIC_THRESHOLD(256, sizeof(double))) {
+    *pRes = doubleVectorCmpAVX(p, numOfRows, isMinFunc);
+    return true;
+  }
+#endif
+  return false;
+}
+
 static int32_t findFirstValPosition(const SColumnInfoData* pCol, int32_t start, int32_t numOfRows) {
   int32_t i = start;
 
@@ -367,11 +753,37 @@ static int32_t findFirstValPosition(const SColumnInfoData* pCol, int32_t start,
   return i;
 }
 
+static int32_t findFirstNullPosition(const SColumnInfoData* pCol, int32_t start, int32_t end) {
+  int32_t i = start;
+
+  while (i < end) {
+    // skip the whole byte of bitmap if there is no null value in these 8 rows
+    if (BitPos(i) == 0 && (i + 8) <= end && BMCharPos(pCol->nullbitmap, i) == 0) {
+      i += 8;
+      continue;
+    }
+
+    if (colDataIsNull_f(pCol->nullbitmap, i)) {
+      break;
+    }
+
+    i += 1;
+  }
+
+  return i;
+}
+
 static void handleInt8Col(const void* data, int32_t start, int32_t numOfRows, SMinmaxResInfo* pBuf, bool isMinFunc,
                           bool signVal) {
-  // AVX2 version to speedup the loop
-  if (tsAVX2Enable && tsSIMDEnable) {
-    pBuf->v = i8VectorCmpAVX2(data, numOfRows, isMinFunc, signVal);
+  int8_t val = 0;
+
+  // SIMD version to speedup the loop
+  if (i8VectorCmp((const int8_t*)data + start, numOfRows, isMinFunc, signVal, &val)) {
+    if (signVal) {
+      __COMPARE_MERGE_VAL(pBuf->assign, *(int8_t*)&pBuf->v, val, isMinFunc)
+    } else {
+      __COMPARE_MERGE_VAL(pBuf->assign, *(uint8_t*)&pBuf->v, (uint8_t)val, isMinFunc)
+    }
   } else {
     if (!pBuf->assign) {
       pBuf->v = ((int8_t*)data)[start];
@@ -403,9 +815,15 @@ static void handleInt8Col(const void* data, int32_t start, int32_t numOfRows, SM
 
 static void handleInt16Col(const void* data, int32_t start, int32_t numOfRows, SMinmaxResInfo* pBuf, bool isMinFunc,
                            bool signVal) {
-  // AVX2 version to speedup the loop
-  if (tsAVX2Enable && tsSIMDEnable) {
-    pBuf->v = i16VectorCmpAVX2(data, numOfRows, isMinFunc, signVal);
+  int16_t val = 0;
+
+  // SIMD version to speedup the loop
+  if (i16VectorCmp((const int16_t*)data + start, numOfRows, isMinFunc, signVal, &val)) {
+    if (signVal) {
+      __COMPARE_MERGE_VAL(pBuf->assign, *(int16_t*)&pBuf->v, val, isMinFunc)
+    } else {
+      __COMPARE_MERGE_VAL(pBuf->assign, *(uint16_t*)&pBuf->v, (uint16_t)val, isMinFunc)
+    }
   } else {
     if (!pBuf->assign) {
       pBuf->v = ((int16_t*)data)[start];
@@ -437,9 +855,15 @@ static void handleInt16Col(const void* data, int32_t start, int32_t numOfRows, S
 
 static void handleInt32Col(const void* data, int32_t start, int32_t numOfRows, SMinmaxResInfo* pBuf, bool isMinFunc,
                            bool signVal) {
-  // AVX2 version to speedup the loop
-  if (tsAVX2Enable && tsSIMDEnable) {
-    pBuf->v = i32VectorCmpAVX2(data, numOfRows, isMinFunc, signVal);
+  int32_t val = 0;
+
+  // SIMD version to speedup the loop
+  if (i32VectorCmp((const int32_t*)data + start, numOfRows, isMinFunc, signVal, &val)) {
+    if (signVal) {
+      __COMPARE_MERGE_VAL(pBuf->assign, *(int32_t*)&pBuf->v, val, isMinFunc)
+    } else {
+      __COMPARE_MERGE_VAL(pBuf->assign, *(uint32_t*)&pBuf->v, (uint32_t)val, isMinFunc)
+    }
   } else {
     if (!pBuf->assign) {
       pBuf->v = ((int32_t*)data)[start];
@@ -471,39 +895,53 @@ static void handleInt32Col(const void* data, int32_t start, int32_t numOfRows, S
 
 static void handleInt64Col(const void* data, int32_t start, int32_t numOfRows, SMinmaxResInfo* pBuf, bool isMinFunc,
                            bool signVal) {
-  if (!pBuf->assign) {
-    pBuf->v = ((int64_t*)data)[start];
-  }
+  int64_t val = 0;
 
-  if (signVal) {
-    const int64_t* p = (const int64_t*)data;
-    int64_t*       v = &pBuf->v;
-
-    if (isMinFunc) {
-      __COMPARE_EXTRACT_MIN(start, start + numOfRows, *v, p);
+  // SIMD version to speedup the loop
+  if (i64VectorCmp((const int64_t*)data + start, numOfRows, isMinFunc, signVal, &val)) {
+    if (signVal) {
+      __COMPARE_MERGE_VAL(pBuf->assign, pBuf->v, val, isMinFunc)
     } else {
-      __COMPARE_EXTRACT_MAX(start, start + numOfRows, *v, p);
+      __COMPARE_MERGE_VAL(pBuf->assign, *(uint64_t*)&pBuf->v, (uint64_t)val, isMinFunc)
     }
   } else {
-    const uint64_t* p = (const uint64_t*)data;
-    uint64_t*       v = (uint64_t*)&pBuf->v;
+    if (!pBuf->assign) {
+      pBuf->v = ((int64_t*)data)[start];
+    }
 
-    if (isMinFunc) {
-      __COMPARE_EXTRACT_MIN(start, start + numOfRows, *v, p);
+    if (signVal) {
+      const int64_t* p = (const int64_t*)data;
+      int64_t*       v = &pBuf->v;
+
+      if (isMinFunc) {
+        __COMPARE_EXTRACT_MIN(start, start + numOfRows, *v, p);
+      } else {
+        __COMPARE_EXTRACT_MAX(start, start + numOfRows, *v, p);
+      }
     } else {
-      __COMPARE_EXTRACT_MAX(start, start + numOfRows, *v, p);
+      const uint64_t* p = (const uint64_t*)data;
+      uint64_t*       v = (uint64_t*)&pBuf->v;
+
+      if (isMinFunc) {
+        __COMPARE_EXTRACT_MIN(start, start + numOfRows, *v, p);
+      } else {
+        __COMPARE_EXTRACT_MAX(start, start + numOfRows, *v, p);
+      }
     }
   }
+
+  pBuf->assign = true;
 }
 
 static void handleFloatCol(SColumnInfoData* pCol, int32_t start, int32_t numOfRows, SMinmaxResInfo* pBuf,
                            bool isMinFunc) {
   float* pData = (float*)pCol->pData;
   float* val = (float*)&pBuf->v;
+  float  blockVal = 0;
 
-  // AVX version to speedup the loop
-  if (tsAVXEnable && tsSIMDEnable) {
-    *val = floatVectorCmpAVX(pData, numOfRows, isMinFunc);
+  // SIMD version to speedup the loop
+  if (floatVectorCmp(pData + start, numOfRows, isMinFunc, &blockVal)) {
+    __COMPARE_MERGE_VAL(pBuf->assign, *val, blockVal, isMinFunc)
   } else {
     if (!pBuf->assign) {
       *val = pData[start];
@@ -531,10 +969,11 @@ static void handleDoubleCol(SColumnInfoData* pCol, int32_t start, int32_t numOfR
                             bool isMinFunc) {
   double* pData = (double*)pCol->pData;
   double* val = (double*)&pBuf->v;
+  double  blockVal = 0;
 
-  // AVX version to speedup the loop
-  if (tsAVXEnable && tsSIMDEnable) {
-    *val = (double)doubleVectorCmpAVX(pData, numOfRows, isMinFunc);
+  // SIMD version to speedup the loop
+  if (doubleVectorCmp(pData + start, numOfRows, isMinFunc, &blockVal)) {
+    __COMPARE_MERGE_VAL(pBuf->assign, *val, blockVal, isMinFunc)
   } else {
     if (!pBuf->assign) {
       *val = pData[start];
@@ -558,6 +997,73 @@ static void handleDoubleCol(SColumnInfoData* pCol, int32_t start, int32_t numOfR
   pBuf->assign = true;
 }
 
+static void handleNotNullCol(SColumnInfoData* pCol, int32_t start, int32_t numOfRows, SMinmaxResInfo* pBuf,
+                             bool isMinFunc) {
+  switch (pCol->info.type) {
+    case TSDB_DATA_TYPE_BOOL:
+    case TSDB_DATA_TYPE_TINYINT: {
+      handleInt8Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, true);
+      break;
+    }
+    case TSDB_DATA_TYPE_SMALLINT: {
+      handleInt16Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, true);
+      break;
+    }
+    case TSDB_DATA_TYPE_INT: {
+      handleInt32Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, true);
+      break;
+    }
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_TIMESTAMP: {
+      handleInt64Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, true);
+      break;
+    }
+    case TSDB_DATA_TYPE_UTINYINT: {
+      handleInt8Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, false);
+      break;
+    }
+    case TSDB_DATA_TYPE_USMALLINT: {
+      handleInt16Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, false);
+      break;
+    }
+    case TSDB_DATA_TYPE_UINT: {
+      handleInt32Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, false);
+      break;
+    }
+    case TSDB_DATA_TYPE_UBIGINT: {
+      handleInt64Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, false);
+      break;
+    }
+    case TSDB_DATA_TYPE_FLOAT: {
+      handleFloatCol(pCol, start, numOfRows, pBuf, isMinFunc);
+      break;
+    }
+    case TSDB_DATA_TYPE_DOUBLE: {
+      handleDoubleCol(pCol, start, numOfRows, pBuf, isMinFunc);
+      break;
+    }
+  }
+}
+
+// Split the rows into segments without null value and feed each of them to the handlers above, so that a data block
+// with only a few null values still benefits from the SIMD kernels. Returns the number of not-null values.
+static int32_t handleNullableCol(SColumnInfoData* pCol, int32_t start, int32_t numOfRows, SMinmaxResInfo* pBuf,
+                                 bool isMinFunc) {
+  int32_t numOfElems = 0;
+  int32_t end = start + numOfRows;
+
+  int32_t i = findFirstValPosition(pCol, start, numOfRows);
+  while (i < end) {
+    int32_t j = findFirstNullPosition(pCol, i, end);
+    handleNotNullCol(pCol, i, j - i, pBuf, isMinFunc);
+    numOfElems += (j - i);
+
+    i = findFirstValPosition(pCol, j, end - j);
+  }
+
+  return numOfElems;
+}
+
 static int32_t findRowIndex(int32_t start, int32_t num, SColumnInfoData* pCol, const char* tval) {
   // the data is loaded, not only the block SMA value
   for (int32_t i = start; i < num + start; ++i) {
@@ -594,7 +1100,8 @@ static void doExtractVal(SColumnInfoData* pCol, int32_t i, int32_t end, SqlFunct
         break;
       }
 
-      case TSDB_DATA_TYPE_BIGINT: {
+      case TSDB_DATA_TYPE_BIGINT:
+      case TSDB_DATA_TYPE_TIMESTAMP: {
         const int64_t* pData = (const int64_t*)pCol->pData;
         __COMPARE_ACQUIRED_MIN(i, end, pCol->nullbitmap, pData, pCtx, (pBuf->v), &pBuf->tuplePos)
         break;
@@ -657,7 +1164,8 @@ static void doExtractVal(SColumnInfoData* pCol, int32_t i, int32_t end, SqlFunct
         break;
       }
 
-      case TSDB_DATA_TYPE_BIGINT: {
+      case TSDB_DATA_TYPE_BIGINT:
+      case TSDB_DATA_TYPE_TIMESTAMP: {
         const int64_t* pData = (const int64_t*)pCol->pData;
         __COMPARE_ACQUIRED_MAX(i, end, pCol->nullbitmap, pData, pCtx, (pBuf->v), &pBuf->tuplePos)
         break;
@@ -811,13 +1319,13 @@ int32_t doMinMaxHelper(SqlFunctionCtx* pCtx, int32_t isMinFunc, int32_t* nElems)
   // clang-format off
   int32_t threshold[] = {
       //NULL,    BOOL,      TINYINT, SMALLINT, INT, BIGINT, FLOAT, DOUBLE, VARCHAR,   TIMESTAMP, NCHAR,
-      INT32_MAX, INT32_MAX, 32,      16,       8,   4,      8,     4,      INT32_MAX, INT32_MAX, INT32_MAX,
+      INT32_MAX, INT32_MAX, 32,      16,       8,   4,      8,     4,      INT32_MAX, 4,         INT32_MAX,
       // UTINYINT,USMALLINT, UINT, UBIGINT,   JSON,      VARBINARY, DECIMAL,   BLOB,      MEDIUMBLOB, BINARY
       32,         16,        8,    4,         INT32_MAX, INT32_MAX, INT32_MAX, INT32_MAX, INT32_MAX,  INT32_MAX,
   };
   // clang-format on
 
-  if (pCol->hasNull || numOfRows < threshold[pCol->info.type] || pCtx->subsidiaries.num > 0) {
+  if (numOfRows < threshold[pCol->info.type] || pCtx->subsidiaries.num > 0) {
     int32_t i = findFirstValPosition(pCol, start, numOfRows);
 
     if ((i < end) && (!pBuf->assign)) {
@@ -827,6 +1335,7 @@ int32_t doMinMaxHelper(SqlFunctionCtx* pCtx, int32_t isMinFunc, int32_t* nElems)
         case TSDB_DATA_TYPE_DOUBLE:
         case TSDB_DATA_TYPE_UBIGINT:
         case TSDB_DATA_TYPE_BIGINT:
+        case TSDB_DATA_TYPE_TIMESTAMP:
           pBuf->v = *(int64_t*)p;
           break;
         case TSDB_DATA_TYPE_UINT:
@@ -866,54 +1375,11 @@ int32_t doMinMaxHelper(SqlFunctionCtx* pCtx, int32_t isMinFunc, int32_t* nElems)
     }
 
     doExtractVal(pCol, i, end, pCtx, pBuf, isMinFunc);
+  } else if (pCol->hasNull) {
+    numOfElems = handleNullableCol(pCol, start, numOfRows, pBuf, isMinFunc);
   } else {
     numOfElems = numOfRows;
-
-    switch (type) {
-      case TSDB_DATA_TYPE_BOOL:
-      case TSDB_DATA_TYPE_TINYINT: {
-        handleInt8Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, true);
-        break;
-      }
-      case TSDB_DATA_TYPE_SMALLINT: {
-        handleInt16Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, true);
-        break;
-      }
-      case TSDB_DATA_TYPE_INT: {
-        handleInt32Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, true);
-        break;
-      }
-      case TSDB_DATA_TYPE_BIGINT: {
-        handleInt64Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, true);
-        break;
-      }
-      case TSDB_DATA_TYPE_UTINYINT: {
-        handleInt8Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, false);
-        break;
-      }
-      case TSDB_DATA_TYPE_USMALLINT: {
-        handleInt16Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, false);
-        break;
-      }
-      case TSDB_DATA_TYPE_UINT: {
-        handleInt32Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, false);
-        break;
-      }
-      case TSDB_DATA_TYPE_UBIGINT: {
-        handleInt64Col(pCol->pData, start, numOfRows, pBuf, isMinFunc, false);
-        break;
-      }
-      case TSDB_DATA_TYPE_FLOAT: {
-        handleFloatCol(pCol, start, numOfRows, pBuf, isMinFunc);
-        break;
-      }
-      case TSDB_DATA_TYPE_DOUBLE: {
-        handleDoubleCol(pCol, start, numOfRows, pBuf, isMinFunc);
-        break;
-      }
-    }
-
-    pBuf->assign = true;
+    handleNotNullCol(pCol, start, numOfRows, pBuf, isMinFunc);
   }
 
 _over:
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "builtinsimpl.h"
+#include "tdatablock.h"
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+namespace {
+
+// the instruction set allowed to the min/max kernels, the widest kernel compiled in is used when it is allowed
+enum EMinMaxSimd { MINMAX_SCALAR = 0, MINMAX_AVX2, MINMAX_AVX512 };
+
+const char *simdName(EMinMaxSimd simd) {
+  switch (simd) {
+    case MINMAX_AVX2:
+      return "avx2";
+    case MINMAX_AVX512:
+      return "avx512";
+    default:
+      return "scalar";
+  }
+}
+
+class MinMaxTest : public ::testing::TestWithParam<EMinMaxSimd> {
+ protected:
+  void SetUp() override {
+    avx2 = tsAVX2Enable;
+    avx512 = tsAVX512Enable;
+    simd = tsSIMDEnable;
+
+    bool cpuAvx2 = false, cpuAvx512 = false;
+#if defined(__x86_64__) || defined(__i386__)
+    cpuAvx2 = __builtin_cpu_supports("avx2");
+    // the 8/16-bit kernels need AVX512BW besides AVX512F
+    cpuAvx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+#endif
+
+    switch (GetParam()) {
+      case MINMAX_SCALAR:
+        tsSIMDEnable = 0;
+        break;
+      case MINMAX_AVX2:
+        if (!cpuAvx2) GTEST_SKIP() << "avx2 is not supported by cpu";
+        tsSIMDEnable = 1;
+        tsAVX2Enable = 1;
+        tsAVX512Enable = 0;
+        break;
+      case MINMAX_AVX512:
+        if (!cpuAvx512) GTEST_SKIP() << "avx512f/avx512bw is not supported by cpu";
+        tsSIMDEnable = 1;
+        tsAVX2Enable = cpuAvx2;
+        tsAVX512Enable = 1;
+        break;
+    }
+  }
+
+  void TearDown() override {
+    tsAVX2Enable = avx2;
+    tsAVX512Enable = avx512;
+    tsSIMDEnable = simd;
+  }
+
+  char avx2 = 0;
+  char avx512 = 0;
+  char simd = 0;
+};
+
+// feed the rows in [start, start + rows) of the column to the min/max function, the result is accumulated in pRes.
+// A non-zero value is returned if any value is not null.
+int32_t doMinMax(SColumnInfoData *pCol, int32_t start, int32_t rows, bool isMinFunc, char *pRes) {
+  SqlFunctionCtx  ctx = {0};
+  SColumnDataAgg *pAgg = NULL;
+  ctx.input.pData = &pCol;
+  ctx.input.pColumnDataAgg = &pAgg;
+  ctx.input.totalRows = start + rows;
+  ctx.input.startRowIndex = start;
+  ctx.input.numOfRows = rows;
+  ctx.input.numOfInputCols = 1;
+  ctx.input.colDataSMAIsSet = false;
+  ctx.resultInfo = (SResultRowEntryInfo *)pRes;
+
+  int32_t numOfElems = 0;
+  EXPECT_EQ(doMinMaxHelper(&ctx, isMinFunc, &numOfElems), TSDB_CODE_SUCCESS);
+  return numOfElems;
+}
+
+template <typename T>
+class MinMaxColumn {
+ public:
+  MinMaxColumn(int16_t type, const std::vector<T> &vals, const std::vector<bool> &nulls) : vals(vals), nulls(nulls) {
+    col = createColumnInfoData(type, sizeof(T), 1);
+    EXPECT_EQ(colInfoDataEnsureCapacity(&col, vals.size(), false), TSDB_CODE_SUCCESS);
+    for (size_t i = 0; i < vals.size(); ++i) {
+      bool isNull = i < nulls.size() && nulls[i];
+      EXPECT_EQ(colDataSetVal(&col, i, (const char *)&vals[i], isNull), TSDB_CODE_SUCCESS);
+    }
+  }
+
+  ~MinMaxColumn() { colDataDestroy(&col); }
+
+  // check the min/max of rows in [start, start + rows) against a scalar loop
+  void check(int32_t start, int32_t rows) {
+    for (int32_t isMin = 0; isMin <= 1; ++isMin) {
+      char res[sizeof(SResultRowEntryInfo) + sizeof(SMinmaxResInfo)] = {0};
+      int32_t numOfElems = doMinMax(&col, start, rows, isMin, res);
+
+      int32_t expectElems = 0;
+      T       expect = 0;
+      for (int32_t i = start; i < start + rows; ++i) {
+        if (i < nulls.size() && nulls[i]) continue;
+        if (expectElems++ == 0 || (isMin ? vals[i] < expect : vals[i] > expect)) {
+          expect = vals[i];
+        }
+      }
+
+      SMinmaxResInfo *pBuf = (SMinmaxResInfo *)GET_ROWCELL_INTERBUF((SResultRowEntryInfo *)res);
+      ASSERT_EQ(numOfElems > 0, expectElems > 0) << "start:" << start << " rows:" << rows;
+      ASSERT_EQ(pBuf->assign, expectElems > 0);
+      if (expectElems > 0) {
+        T val = 0;
+        memcpy(&val, &pBuf->v, sizeof(T));
+        ASSERT_EQ(val, expect) << (isMin ? "min" : "max") << " start:" << start << " rows:" << rows;
+      }
+    }
+  }
+
+  // accumulate the result block by block, as the rows of a table are read by several data blocks
+  void checkBlocks(int32_t blockRows) {
+    for (int32_t isMin = 0; isMin <= 1; ++isMin) {
+      char    res[sizeof(SResultRowEntryInfo) + sizeof(SMinmaxResInfo)] = {0};
+      int32_t numOfElems = 0;
+      for (int32_t start = 0; start < vals.size(); start += blockRows) {
+        int32_t rows = std::min<int32_t>(blockRows, vals.size() - start);
+        numOfElems += doMinMax(&col, start, rows, isMin, res);
+      }
+
+      int32_t expectElems = 0;
+      T       expect = 0;
+      for (size_t i = 0; i < vals.size(); ++i) {
+        if (i < nulls.size() && nulls[i]) continue;
+        if (expectElems++ == 0 || (isMin ? vals[i] < expect : vals[i] > expect)) {
+          expect = vals[i];
+        }
+      }
+
+      SMinmaxResInfo *pBuf = (SMinmaxResInfo *)GET_ROWCELL_INTERBUF((SResultRowEntryInfo *)res);
+      T               val = 0;
+      memcpy(&val, &pBuf->v, sizeof(T));
+      ASSERT_EQ(numOfElems > 0, expectElems > 0);
+      ASSERT_EQ(val, expect) << (isMin ? "min" : "max") << " blockRows:" << blockRows;
+    }
+  }
+
+  SColumnInfoData col;
+
+ private:
+  std::vector<T>    vals;
+  std::vector<bool> nulls;
+};
+
+template <typename T>
+std::vector<T> genValues(size_t size, uint32_t seed) {
+  std::mt19937_64 rng(seed);
+  std::vector<T>  vals(size);
+  for (auto &v : vals) {
+    if (std::is_floating_point<T>::value) {
+      v = (T)((int64_t)(rng() % 2000001) - 1000000) / 7;
+    } else {
+      v = (T)rng();
+    }
+  }
+  return vals;
+}
+
+// the row counts cover: below one vector, exactly one vector and with a remainder for every width up to 512 bits
+const std::vector<int32_t> kRowCounts = {1, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 127, 128, 129, 1000};
+
+template <typename T>
+void checkNotNull(int16_t type, uint32_t seed) {
+  for (int32_t rows : kRowCounts) {
+    MinMaxColumn<T> col(type, genValues<T>(rows + 5, seed + rows), {});
+    col.check(0, rows);
+    col.check(5, rows);  // start from an unaligned row
+  }
+}
+
+template <typename T>
+void checkExtremes(int16_t type) {
+  // the extremes lie in the lanes and in the remainder, the unsigned values have the top bit set
+  for (int32_t rows : {64, 67, 200}) {
+    for (int32_t pos : {0, 1, rows / 2, rows - 1}) {
+      std::vector<T> vals(rows, (T)1);
+      vals[pos] = std::numeric_limits<T>::max();
+      vals[(pos + 3) % rows] = std::numeric_limits<T>::lowest();
+      MinMaxColumn<T> col(type, vals, {});
+      col.check(0, rows);
+    }
+  }
+}
+
+template <typename T>
+void checkNullable(int16_t type, uint32_t seed) {
+  std::mt19937 rng(seed);
+  for (int32_t rows : {8, 33, 64, 129, 1000}) {
+    std::vector<T> vals = genValues<T>(rows, seed + rows);
+
+    // sparse nulls, so that the rows are split into segments long enough for the vector kernels
+    std::vector<bool> nulls(rows, false);
+    for (int32_t i = 0; i < rows; ++i) {
+      nulls[i] = (rng() % 50) == 0;
+    }
+    nulls[0] = true;
+    nulls[rows - 1] = true;
+    MinMaxColumn<T> sparse(type, vals, nulls);
+    ASSERT_TRUE(sparse.col.hasNull);
+    sparse.check(0, rows);
+    sparse.check(3, rows - 3);
+
+    // dense nulls
+    for (int32_t i = 0; i < rows; ++i) {
+      nulls[i] = (rng() % 2) == 0;
+    }
+    MinMaxColumn<T> dense(type, vals, nulls);
+    dense.check(0, rows);
+
+    // the extreme value is hidden by a null
+    std::vector<T> hidden(rows, (T)1);
+    std::fill(nulls.begin(), nulls.end(), false);
+    hidden[rows / 2] = std::numeric_limits<T>::max();
+    nulls[rows / 2] = true;
+    MinMaxColumn<T> masked(type, hidden, nulls);
+    masked.check(0, rows);
+
+    // all values are null
+    std::fill(nulls.begin(), nulls.end(), true);
+    MinMaxColumn<T> empty(type, vals, nulls);
+    empty.check(0, rows);
+  }
+}
+
+template <typename T>
+void checkBlocks(int16_t type, uint32_t seed) {
+  std::vector<T>    vals = genValues<T>(1000, seed);
+  std::vector<bool> nulls(vals.size(), false);
+  for (size_t i = 0; i < vals.size(); i += 37) {
+    nulls[i] = true;
+  }
+
+  MinMaxColumn<T> notNull(type, vals, {});
+  MinMaxColumn<T> nullable(type, vals, nulls);
+  for (int32_t blockRows : {1, 7, 64, 100, 333}) {
+    notNull.checkBlocks(blockRows);
+    nullable.checkBlocks(blockRows);
+  }
+}
+
+template <typename T>
+void checkType(int16_t type, uint32_t seed) {
+  checkNotNull<T>(type, seed);
+  checkExtremes<T>(type);
+  checkNullable<T>(type, seed);
+  checkBlocks<T>(type, seed);
+}
+
+}  // namespace
+
+TEST_P(MinMaxTest, tinyint) { checkType<int8_t>(TSDB_DATA_TYPE_TINYINT, 1); }
+TEST_P(MinMaxTest, smallint) { checkType<int16_t>(TSDB_DATA_TYPE_SMALLINT, 2); }
+TEST_P(MinMaxTest, int) { checkType<int32_t>(TSDB_DATA_TYPE_INT, 3); }
+TEST_P(MinMaxTest, bigint) { checkType<int64_t>(TSDB_DATA_TYPE_BIGINT, 4); }
+TEST_P(MinMaxTest, utinyint) { checkType<uint8_t>(TSDB_DATA_TYPE_UTINYINT, 5); }
+TEST_P(MinMaxTest, usmallint) { checkType<uint16_t>(TSDB_DATA_TYPE_USMALLINT, 6); }
+TEST_P(MinMaxTest, uint) { checkType<uint32_t>(TSDB_DATA_TYPE_UINT, 7); }
+TEST_P(MinMaxTest, ubigint) { checkType<uint64_t>(TSDB_DATA_TYPE_UBIGINT, 8); }
+TEST_P(MinMaxTest, timestamp) { checkType<int64_t>(TSDB_DATA_TYPE_TIMESTAMP, 9); }
+TEST_P(MinMaxTest, float) { checkType<float>(TSDB_DATA_TYPE_FLOAT, 10); }
+TEST_P(MinMaxTest, double) { checkType<double>(TSDB_DATA_TYPE_DOUBLE, 11); }
+
+INSTANTIATE_TEST_CASE_P(Simd, MinMaxTest, ::testing::Values(MINMAX_SCALAR, MINMAX_AVX2, MINMAX_AVX512),
+                        [](const ::testing::TestParamInfo<EMinMaxSimd> &info) { return simdName(info.param); });
+
+#pragma GCC diagnostic pop
@@ -452,6 +452,67 @@ static void monGenDiskJson(SMonInfo *pMonitor) {
   tjsonAddDoubleToObject(pTempdirJson, "total", pTempDesc->size.total);
 }
 
+static void monGenHistJson(SJson *pJson, const char *name, const int64_t *hist, int32_t size) {
+  SJson *pHistJson = tjsonAddArrayToObject(pJson, name);
+  if (pHistJson == NULL) return;
+
+  for (int32_t i = 0; i < size; ++i) {
+    if (hist[i] == 0) continue;
+
+    SJson *pBucketJson = tjsonCreateObject();
+    if (pBucketJson == NULL) continue;
+    tjsonAddDoubleToObject(pBucketJson, "min", (double)(1LL << i));
+    tjsonAddDoubleToObject(pBucketJson, "count", hist[i]);
+    if (tjsonAddItemToArray(pHistJson, pBucketJson) != 0) tjsonDelete(pBucketJson);
+  }
+}
+
+static void monGenWalJson(SMonInfo *pMonitor) {
+  SMonWalInfo *pInfo = &pMonitor->vmInfo.wal;
+  if (pInfo->requests == 0) return;
+
+  SJson *pJson = tjsonCreateObject();
+  if (pJson == NULL) return;
+  if (tjsonAddItemToObject(pMonitor->pJson, "wal_infos", pJson) != 0) {
+    tjsonDelete(pJson);
+    return;
+  }
+
+  tjsonAddDoubleToObject(pJson, "group_commit_requests", pInfo->requests);
+  tjsonAddDoubleToObject(pJson, "group_commit_fsyncs", pInfo->fsyncs);
+  monGenHistJson(pJson, "group_commit_depth", pInfo->depth, MON_WAL_HIST_SIZE);
+  monGenHistJson(pJson, "group_commit_fsync_us", pInfo->fsync_us, MON_WAL_HIST_SIZE);
+}
+
+static void monGenWorkerPoolJson(SJson *pJson, const char *name, SMonWorkerInfo *pInfo) {
+  SJson *pPoolJson = tjsonCreateObject();
+  if (pPoolJson == NULL) return;
+  if (tjsonAddItemToArray(pJson, pPoolJson) != 0) {
+    tjsonDelete(pPoolJson);
+    return;
+  }
+
+  tjsonAddStringToObject(pPoolJson, "name", name);
+  tjsonAddDoubleToObject(pPoolJson, "workers", pInfo->workers);
+  tjsonAddDoubleToObject(pPoolJson, "queued", pInfo->queued);
+  tjsonAddDoubleToObject(pPoolJson, "items", pInfo->items);
+  tjsonAddDoubleToObject(pPoolJson, "steals", pInfo->steals);
+  tjsonAddDoubleToObject(pPoolJson, "busy_us", pInfo->busy_us);
+  monGenHistJson(pPoolJson, "wait_us_high", pInfo->wait_us_high, MON_WORKER_HIST_SIZE);
+  monGenHistJson(pPoolJson, "wait_us_low", pInfo->wait_us_low, MON_WORKER_HIST_SIZE);
+}
+
+static void monGenWorkerJson(SMonInfo *pMonitor) {
+  SMonVmInfo *pInfo = &pMonitor->vmInfo;
+  if (pInfo->query.workers == 0 && pInfo->fetch.workers == 0) return;
+
+  SJson *pJson = tjsonAddArrayToObject(pMonitor->pJson, "worker_infos");
+  if (pJson == NULL) return;
+
+  monGenWorkerPoolJson(pJson, "vnode-query", &pInfo->query);
+  monGenWorkerPoolJson(pJson, "vnode-fetch", &pInfo->fetch);
+}
+
 static const char *monLogLevelStr(ELogLevel level) {
   if (level == DEBUG_ERROR) {
     return "error";
@@ -528,6 +589,8 @@ void monSendReport() {
   monGenGrantJson(pMonitor);
   monGenDnodeJson(pMonitor);
   monGenDiskJson(pMonitor);
+  monGenWalJson(pMonitor);
+  monGenWorkerJson(pMonitor);
   monGenLogJson(pMonitor);
 
   char *pCont = tjsonToString(pMonitor->pJson);
@@ -41,6 +41,7 @@ class MonitorTest : public ::testing::Test {
   void GetGrantInfo(SMonGrantInfo *pInfo);
 
   void GetVnodeStat(SVnodesStat *pStat);
+  void GetWorkerInfo(SMonWorkerInfo *pInfo);
   void GetDiskInfo(SMonDiskInfo *pInfo);
 
   void GetLogInfo(SMonLogs *logs);
@@ -178,6 +179,16 @@ void MonitorTest::GetVnodeStat(SVnodesStat *pInfo) {
   pInfo->masterNum = 6;
 }
 
+void MonitorTest::GetWorkerInfo(SMonWorkerInfo *pInfo) {
+  pInfo->workers = 4;
+  pInfo->queued = 2;
+  pInfo->items = 100;
+  pInfo->steals = 7;
+  pInfo->busy_us = 5000;
+  pInfo->wait_us_high[3] = 90;
+  pInfo->wait_us_low[10] = 10;
+}
+
 void MonitorTest::GetDiskInfo(SMonDiskInfo *pInfo) {
   pInfo->datadirs = taosArrayInit(2, sizeof(SMonDiskDesc));
   SMonDiskDesc d1 = {0};
@@ -256,6 +267,8 @@ TEST_F(MonitorTest, 01_Full) {
   SMonVmInfo vmInfo = {0};
   GetDiskInfo(&vmInfo.tfs);
   GetVnodeStat(&vmInfo.vstat);
+  GetWorkerInfo(&vmInfo.query);
+  GetWorkerInfo(&vmInfo.fetch);
   GetSysInfo(&vmInfo.sys);
   GetLogInfo(&vmInfo.log);
 
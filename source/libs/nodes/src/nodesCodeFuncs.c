@@ -4544,6 +4544,7 @@ static const char* jkColumnDefColName = "ColName";
 static const char* jkColumnDefDataType = "DataType";
 static const char* jkColumnDefComments = "Comments";
 static const char* jkColumnDefSma = "Sma";
+static const char* jkColumnDefBloomFilter = "BloomFilter";
 
 static int32_t columnDefNodeToJson(const void* pObj, SJson* pJson) {
   const SColumnDefNode* pNode = (const SColumnDefNode*)pObj;
@@ -4558,6 +4559,9 @@ static int32_t columnDefNodeToJson(const void* pObj, SJson* pJson) {
   if (TSDB_CODE_SUCCESS == code) {
     code = tjsonAddBoolToObject(pJson, jkColumnDefSma, pNode->sma);
   }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = tjsonAddBoolToObject(pJson, jkColumnDefBloomFilter, pNode->bloomFilter);
+  }
 
   return code;
 }
@@ -4575,6 +4579,9 @@ static int32_t jsonToColumnDefNode(const SJson* pJson, void* pObj) {
   if (TSDB_CODE_SUCCESS == code) {
     code = tjsonGetBoolValue(pJson, jkColumnDefSma, &pNode->sma);
   }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = tjsonGetBoolValue(pJson, jkColumnDefBloomFilter, &pNode->bloomFilter);
+  }
 
   return code;
 }
@@ -4776,6 +4783,7 @@ static const char* jkTableOptionsDeleteMark = "DeleteMark";
 static const char* jkTableOptionsRollupFuncs = "RollupFuncs";
 static const char* jkTableOptionsTtl = "Ttl";
 static const char* jkTableOptionsSma = "Sma";
+static const char* jkTableOptionsBloomFilter = "BloomFilter";
 
 static int32_t tableOptionsToJson(const void* pObj, SJson* pJson) {
   const STableOptions* pNode = (const STableOptions*)pObj;
@@ -4799,6 +4807,9 @@ static int32_t tableOptionsToJson(const void* pObj, SJson* pJson) {
   if (TSDB_CODE_SUCCESS == code) {
     code = nodeListToJson(pJson, jkTableOptionsSma, pNode->pSma);
   }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = nodeListToJson(pJson, jkTableOptionsBloomFilter, pNode->pBloomFilter);
+  }
 
   return code;
 }
@@ -4825,6 +4836,9 @@ static int32_t jsonToTableOptions(const SJson* pJson, void* pObj) {
   if (TSDB_CODE_SUCCESS == code) {
     code = jsonToNodeList(pJson, jkTableOptionsSma, &pNode->pSma);
   }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = jsonToNodeList(pJson, jkTableOptionsBloomFilter, &pNode->pBloomFilter);
+  }
 
   return code;
 }
@@ -797,6 +797,7 @@ void nodesDestroyNode(SNode* pNode) {
       nodesDestroyList(pOptions->pWatermark);
       nodesDestroyList(pOptions->pRollupFuncs);
       nodesDestroyList(pOptions->pSma);
+      nodesDestroyList(pOptions->pBloomFilter);
       nodesDestroyList(pOptions->pDeleteMark);
       break;
     }
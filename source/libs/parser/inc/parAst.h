@@ -64,7 +64,8 @@ typedef enum EDatabaseOptionType {
   DB_OPTION_STT_TRIGGER,
   DB_OPTION_TABLE_PREFIX,
   DB_OPTION_TABLE_SUFFIX,
-  DB_OPTION_KEEP_TIME_OFFSET
+  DB_OPTION_KEEP_TIME_OFFSET,
+  DB_OPTION_STT_MERGE_POLICY
 } EDatabaseOptionType;
 
 typedef enum ETableOptionType {
@@ -74,7 +75,8 @@ typedef enum ETableOptionType {
   TABLE_OPTION_ROLLUP,
   TABLE_OPTION_TTL,
   TABLE_OPTION_SMA,
-  TABLE_OPTION_DELETE_MARK
+  TABLE_OPTION_DELETE_MARK,
+  TABLE_OPTION_BLOOM_FILTER
 } ETableOptionType;
 
 typedef struct SAlterOption {
@@ -1127,6 +1127,7 @@ SNode* createDefaultDatabaseOptions(SAstCreateContext* pCxt) {
   updateWalOptionsDefault(pOptions);
   pOptions->walSegmentSize = TSDB_DEFAULT_DB_WAL_SEGMENT_SIZE;
   pOptions->sstTrigger = TSDB_DEFAULT_SST_TRIGGER;
+  pOptions->sttMergePolicy = TSDB_DEFAULT_STT_MERGE_POLICY;
   pOptions->tablePrefix = TSDB_DEFAULT_HASH_PREFIX;
   pOptions->tableSuffix = TSDB_DEFAULT_HASH_SUFFIX;
   return (SNode*)pOptions;
@@ -1162,6 +1163,7 @@ SNode* createAlterDatabaseOptions(SAstCreateContext* pCxt) {
   pOptions->walRollPeriod = -1;
   pOptions->walSegmentSize = -1;
   pOptions->sstTrigger = -1;
+  pOptions->sttMergePolicy = -1;
   pOptions->tablePrefix = -1;
   pOptions->tableSuffix = -1;
   return (SNode*)pOptions;
@@ -1282,6 +1284,9 @@ static SNode* setDatabaseOptionImpl(SAstCreateContext* pCxt, SNode* pOptions, ED
       pDbOptions->keepTimeOffset = taosStr2Int32(((SToken*)pVal)->z, NULL, 10);
       break;
     }
+    case DB_OPTION_STT_MERGE_POLICY:
+      COPY_STRING_FORM_STR_TOKEN(pDbOptions->sttMergePolicyStr, (SToken*)pVal);
+      break;
     default:
       break;
   }
@@ -1432,6 +1437,9 @@ SNode* setTableOption(SAstCreateContext* pCxt, SNode* pOptions, ETableOptionType
     case TABLE_OPTION_DELETE_MARK:
       ((STableOptions*)pOptions)->pDeleteMark = pVal;
       break;
+    case TABLE_OPTION_BLOOM_FILTER:
+      ((STableOptions*)pOptions)->pBloomFilter = pVal;
+      break;
     default:
       break;
   }
@@ -46,6 +46,7 @@ static SKeyword keywordTable[] = {
     {"BETWEEN",              TK_BETWEEN},
     {"BIGINT",               TK_BIGINT},
     {"BINARY",               TK_BINARY},
+    {"BLOOM_FILTER",         TK_BLOOM_FILTER},
     {"BNODE",                TK_BNODE},
     {"BNODES",               TK_BNODES},
     {"BOOL",                 TK_BOOL},
@@ -222,6 +223,7 @@ static SKeyword keywordTable[] = {
     {"STREAM",               TK_STREAM},
     {"STREAMS",              TK_STREAMS},
     {"STRICT",               TK_STRICT},
+    {"STT_MERGE_POLICY",     TK_STT_MERGE_POLICY},
     {"STT_TRIGGER",          TK_STT_TRIGGER},
     {"SUBSCRIBE",            TK_SUBSCRIBE},
     {"SUBSCRIPTIONS",        TK_SUBSCRIPTIONS},
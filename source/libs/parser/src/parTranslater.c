@@ -4781,6 +4781,7 @@ static int32_t buildCreateDbReq(STranslateContext* pCxt, SCreateDatabaseStmt* pS
   pReq->walRollPeriod = pStmt->pOptions->walRollPeriod;
   pReq->walSegmentSize = pStmt->pOptions->walSegmentSize;
   pReq->sstTrigger = pStmt->pOptions->sstTrigger;
+  pReq->sttMergePolicy = pStmt->pOptions->sttMergePolicy;
   pReq->hashPrefix = pStmt->pOptions->tablePrefix;
   pReq->hashSuffix = pStmt->pOptions->tableSuffix;
   pReq->tsdbPageSize = pStmt->pOptions->tsdbPageSize;
@@ -4914,6 +4915,20 @@ static int32_t checkDbCacheModelOption(STranslateContext* pCxt, SDatabaseOptions
   return TSDB_CODE_SUCCESS;
 }
 
+static int32_t checkDbSttMergePolicyOption(STranslateContext* pCxt, SDatabaseOptions* pOptions) {
+  if ('\0' != pOptions->sttMergePolicyStr[0]) {
+    if (0 == strcasecmp(pOptions->sttMergePolicyStr, TSDB_STT_MERGE_POLICY_COUNT_STR)) {
+      pOptions->sttMergePolicy = TSDB_STT_MERGE_POLICY_COUNT;
+    } else if (0 == strcasecmp(pOptions->sttMergePolicyStr, TSDB_STT_MERGE_POLICY_TIERED_STR)) {
+      pOptions->sttMergePolicy = TSDB_STT_MERGE_POLICY_TIERED;
+    } else {
+      return generateSyntaxErrMsgExt(&pCxt->msgBuf, TSDB_CODE_PAR_INVALID_DB_OPTION,
+                                     "Invalid option sttMergePolicy: %s", pOptions->sttMergePolicyStr);
+    }
+  }
+  return TSDB_CODE_SUCCESS;
+}
+
 static int32_t checkDbPrecisionOption(STranslateContext* pCxt, SDatabaseOptions* pOptions) {
   if ('\0' != pOptions->precisionStr[0]) {
     if (0 == strcasecmp(pOptions->precisionStr, TSDB_TIME_PRECISION_MILLI_STR)) {
@@ -5178,6 +5193,9 @@ static int32_t checkDatabaseOptions(STranslateContext* pCxt, const char* pDbName
   if (TSDB_CODE_SUCCESS == code) {
     code = checkDbRangeOption(pCxt, "sstTrigger", pOptions->sstTrigger, TSDB_MIN_STT_TRIGGER, TSDB_MAX_STT_TRIGGER);
   }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = checkDbSttMergePolicyOption(pCxt, pOptions);
+  }
   if (TSDB_CODE_SUCCESS == code) {
     code = checkDbTbPrefixSuffixOptions(pCxt, pOptions->tablePrefix, pOptions->tableSuffix);
   }
@@ -5382,6 +5400,7 @@ static void buildAlterDbReq(STranslateContext* pCxt, SAlterDatabaseStmt* pStmt,
   pReq->cacheLastSize = pStmt->pOptions->cacheLastSize;
   pReq->replications = pStmt->pOptions->replica;
   pReq->sstTrigger = pStmt->pOptions->sstTrigger;
+  pReq->sttMergePolicy = pStmt->pOptions->sttMergePolicy;
   pReq->minRows = pStmt->pOptions->minRowsPerBlock;
   pReq->walRetentionPeriod = pStmt->pOptions->walRetentionPeriod;
   pReq->walRetentionSize = pStmt->pOptions->walRetentionSize;
@@ -5420,6 +5439,9 @@ static int32_t columnDefNodeToField(SNodeList* pList, SArray** pArray) {
     if (pCol->sma) {
       field.flags |= COL_SMA_ON;
     }
+    if (pCol->bloomFilter) {
+      field.flags |= COL_BLOOM_ON;
+    }
     taosArrayPush(*pArray, &field);
   }
   return TSDB_CODE_SUCCESS;
@@ -5452,6 +5474,27 @@ static int32_t checkTableSmaOption(STranslateContext* pCxt, SCreateTableStmt* pS
   return TSDB_CODE_SUCCESS;
 }
 
+static int32_t checkTableBloomFilterOption(STranslateContext* pCxt, SCreateTableStmt* pStmt) {
+  SNode* pNode = NULL;
+  FOREACH(pNode, pStmt->pOptions->pBloomFilter) {
+    SColumnNode*    pCol = (SColumnNode*)pNode;
+    SColumnDefNode* pColDef = findColDef(pStmt->pCols, pCol);
+    if (NULL == pColDef) {
+      return generateSyntaxErrMsg(&pCxt->msgBuf, TSDB_CODE_PAR_INVALID_COLUMN, pCol->colName);
+    }
+    uint8_t type = pColDef->dataType.type;
+    if (pColDef == (SColumnDefNode*)nodesListGetNode(pStmt->pCols, 0) || IS_FLOAT_TYPE(type) ||
+        TSDB_DATA_TYPE_JSON == type || TSDB_DATA_TYPE_GEOMETRY == type || TSDB_DATA_TYPE_DECIMAL == type ||
+        TSDB_DATA_TYPE_BLOB == type || TSDB_DATA_TYPE_MEDIUMBLOB == type) {
+      return generateSyntaxErrMsgExt(&pCxt->msgBuf, TSDB_CODE_PAR_INVALID_TABLE_OPTION,
+                                     "BLOOM_FILTER is not supported on column %s", pCol->colName);
+    }
+    pCol->node.resType = pColDef->dataType;
+    pColDef->bloomFilter = true;
+  }
+  return TSDB_CODE_SUCCESS;
+}
+
 static bool validRollupFunc(const char* pFunc) {
   static const char* rollupFuncs[] = {"avg", "sum", "min", "max", "last", "first"};
   static const int32_t numOfRollupFuncs = (sizeof(rollupFuncs) / sizeof(char*));
@@ -5777,6 +5820,9 @@ static int32_t checkCreateTable(STranslateContext* pCxt, SCreateTableStmt* pStmt
   if (TSDB_CODE_SUCCESS == code) {
     code = checkTableSmaOption(pCxt, pStmt);
   }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = checkTableBloomFilterOption(pCxt, pStmt);
+  }
   if (TSDB_CODE_SUCCESS == code) {
     code = checkTableSchema(pCxt, pStmt);
   }
@@ -5798,6 +5844,9 @@ static void toSchema(const SColumnDefNode* pCol, col_id_t colId, SSchema* pSchem
   if (pCol->sma) {
     flags |= COL_SMA_ON;
   }
+  if (pCol->bloomFilter) {
+    flags |= COL_BLOOM_ON;
+  }
   pSchema->colId = colId;
   pSchema->type = pCol->dataType.type;
   pSchema->bytes = calcTypeBytes(pCol->dataType);
@@ -143,256 +143,258 @@
 #define TK_WAL_ROLL_PERIOD                94
 #define TK_WAL_SEGMENT_SIZE               95
 #define TK_STT_TRIGGER                    96
-#define TK_TABLE_PREFIX                   97
-#define TK_TABLE_SUFFIX                   98
-#define TK_KEEP_TIME_OFFSET               99
-#define TK_NK_COLON                       100
-#define TK_BWLIMIT                        101
-#define TK_START                          102
-#define TK_TIMESTAMP                      103
-#define TK_END                            104
-#define TK_TABLE                          105
-#define TK_NK_LP                          106
-#define TK_NK_RP                          107
-#define TK_STABLE                         108
-#define TK_COLUMN                         109
-#define TK_MODIFY                         110
-#define TK_RENAME                         111
-#define TK_TAG                            112
-#define TK_SET                            113
-#define TK_NK_EQ                          114
-#define TK_USING                          115
-#define TK_TAGS                           116
-#define TK_BOOL                           117
-#define TK_TINYINT                        118
-#define TK_SMALLINT                       119
-#define TK_INT                            120
-#define TK_INTEGER                        121
-#define TK_BIGINT                         122
-#define TK_FLOAT                          123
-#define TK_DOUBLE                         124
-#define TK_BINARY                         125
-#define TK_NCHAR                          126
-#define TK_UNSIGNED                       127
-#define TK_JSON                           128
-#define TK_VARCHAR                        129
-#define TK_MEDIUMBLOB                     130
-#define TK_BLOB                           131
-#define TK_VARBINARY                      132
-#define TK_GEOMETRY                       133
-#define TK_DECIMAL                        134
-#define TK_COMMENT                        135
-#define TK_MAX_DELAY                      136
-#define TK_WATERMARK                      137
-#define TK_ROLLUP                         138
-#define TK_TTL                            139
-#define TK_SMA                            140
-#define TK_DELETE_MARK                    141
-#define TK_FIRST                          142
-#define TK_LAST                           143
-#define TK_SHOW                           144
-#define TK_PRIVILEGES                     145
-#define TK_DATABASES                      146
-#define TK_TABLES                         147
-#define TK_STABLES                        148
-#define TK_MNODES                         149
-#define TK_QNODES                         150
-#define TK_FUNCTIONS                      151
-#define TK_INDEXES                        152
-#define TK_ACCOUNTS                       153
-#define TK_APPS                           154
-#define TK_CONNECTIONS                    155
-#define TK_LICENCES                       156
-#define TK_GRANTS                         157
-#define TK_QUERIES                        158
-#define TK_SCORES                         159
-#define TK_TOPICS                         160
-#define TK_VARIABLES                      161
-#define TK_CLUSTER                        162
-#define TK_BNODES                         163
-#define TK_SNODES                         164
-#define TK_TRANSACTIONS                   165
-#define TK_DISTRIBUTED                    166
-#define TK_CONSUMERS                      167
-#define TK_SUBSCRIPTIONS                  168
-#define TK_VNODES                         169
-#define TK_ALIVE                          170
-#define TK_VIEWS                          171
-#define TK_VIEW                           172
-#define TK_COMPACTS                       173
-#define TK_NORMAL                         174
-#define TK_CHILD                          175
-#define TK_LIKE                           176
-#define TK_TBNAME                         177
-#define TK_QTAGS                          178
-#define TK_AS                             179
-#define TK_SYSTEM                         180
-#define TK_INDEX                          181
-#define TK_FUNCTION                       182
-#define TK_INTERVAL                       183
-#define TK_COUNT                          184
-#define TK_LAST_ROW                       185
-#define TK_META                           186
-#define TK_ONLY                           187
-#define TK_TOPIC                          188
-#define TK_CONSUMER                       189
-#define TK_GROUP                          190
-#define TK_DESC                           191
-#define TK_DESCRIBE                       192
-#define TK_RESET                          193
-#define TK_QUERY                          194
-#define TK_CACHE                          195
-#define TK_EXPLAIN                        196
-#define TK_ANALYZE                        197
-#define TK_VERBOSE                        198
-#define TK_NK_BOOL                        199
-#define TK_RATIO                          200
-#define TK_NK_FLOAT                       201
-#define TK_OUTPUTTYPE                     202
-#define TK_AGGREGATE                      203
-#define TK_BUFSIZE                        204
-#define TK_LANGUAGE                       205
-#define TK_REPLACE                        206
-#define TK_STREAM                         207
-#define TK_INTO                           208
-#define TK_PAUSE                          209
-#define TK_RESUME                         210
-#define TK_TRIGGER                        211
-#define TK_AT_ONCE                        212
-#define TK_WINDOW_CLOSE                   213
-#define TK_IGNORE                         214
-#define TK_EXPIRED                        215
-#define TK_FILL_HISTORY                   216
-#define TK_UPDATE                         217
-#define TK_SUBTABLE                       218
-#define TK_UNTREATED                      219
-#define TK_KILL                           220
-#define TK_CONNECTION                     221
-#define TK_TRANSACTION                    222
-#define TK_BALANCE                        223
-#define TK_VGROUP                         224
-#define TK_LEADER                         225
-#define TK_MERGE                          226
-#define TK_REDISTRIBUTE                   227
-#define TK_SPLIT                          228
-#define TK_DELETE                         229
-#define TK_INSERT                         230
-#define TK_NULL                           231
-#define TK_NK_QUESTION                    232
-#define TK_NK_ALIAS                       233
-#define TK_NK_ARROW                       234
-#define TK_ROWTS                          235
-#define TK_QSTART                         236
-#define TK_QEND                           237
-#define TK_QDURATION                      238
-#define TK_WSTART                         239
-#define TK_WEND                           240
-#define TK_WDURATION                      241
-#define TK_IROWTS                         242
-#define TK_ISFILLED                       243
-#define TK_CAST                           244
-#define TK_NOW                            245
-#define TK_TODAY                          246
-#define TK_TIMEZONE                       247
-#define TK_CLIENT_VERSION                 248
-#define TK_SERVER_VERSION                 249
-#define TK_SERVER_STATUS                  250
-#define TK_CURRENT_USER                   251
-#define TK_CASE                           252
-#define TK_WHEN                           253
-#define TK_THEN                           254
-#define TK_ELSE                           255
-#define TK_BETWEEN                        256
-#define TK_IS                             257
-#define TK_NK_LT                          258
-#define TK_NK_GT                          259
-#define TK_NK_LE                          260
-#define TK_NK_GE                          261
-#define TK_NK_NE                          262
-#define TK_MATCH                          263
-#define TK_NMATCH                         264
-#define TK_CONTAINS                       265
-#define TK_IN                             266
-#define TK_JOIN                           267
-#define TK_INNER                          268
-#define TK_SELECT                         269
-#define TK_NK_HINT                        270
-#define TK_DISTINCT                       271
-#define TK_WHERE                          272
-#define TK_PARTITION                      273
-#define TK_BY                             274
-#define TK_SESSION                        275
-#define TK_STATE_WINDOW                   276
-#define TK_EVENT_WINDOW                   277
-#define TK_SLIDING                        278
-#define TK_FILL                           279
-#define TK_VALUE                          280
-#define TK_VALUE_F                        281
-#define TK_NONE                           282
-#define TK_PREV                           283
-#define TK_NULL_F                         284
-#define TK_LINEAR                         285
-#define TK_NEXT                           286
-#define TK_HAVING                         287
-#define TK_RANGE                          288
-#define TK_EVERY                          289
-#define TK_ORDER                          290
-#define TK_SLIMIT                         291
-#define TK_SOFFSET                        292
-#define TK_LIMIT                          293
-#define TK_OFFSET                         294
-#define TK_ASC                            295
-#define TK_NULLS                          296
-#define TK_ABORT                          297
-#define TK_AFTER                          298
-#define TK_ATTACH                         299
-#define TK_BEFORE                         300
-#define TK_BEGIN                          301
-#define TK_BITAND                         302
-#define TK_BITNOT                         303
-#define TK_BITOR                          304
-#define TK_BLOCKS                         305
-#define TK_CHANGE                         306
-#define TK_COMMA                          307
-#define TK_CONCAT                         308
-#define TK_CONFLICT                       309
-#define TK_COPY                           310
-#define TK_DEFERRED                       311
-#define TK_DELIMITERS                     312
-#define TK_DETACH                         313
-#define TK_DIVIDE                         314
-#define TK_DOT                            315
-#define TK_EACH                           316
-#define TK_FAIL                           317
-#define TK_FILE                           318
-#define TK_FOR                            319
-#define TK_GLOB                           320
-#define TK_ID                             321
-#define TK_IMMEDIATE                      322
-#define TK_IMPORT                         323
-#define TK_INITIALLY                      324
-#define TK_INSTEAD                        325
-#define TK_ISNULL                         326
-#define TK_KEY                            327
-#define TK_MODULES                        328
-#define TK_NK_BITNOT                      329
-#define TK_NK_SEMI                        330
-#define TK_NOTNULL                        331
-#define TK_OF                             332
-#define TK_PLUS                           333
-#define TK_PRIVILEGE                      334
-#define TK_RAISE                          335
-#define TK_RESTRICT                       336
-#define TK_ROW                            337
-#define TK_SEMI                           338
-#define TK_STAR                           339
-#define TK_STATEMENT                      340
-#define TK_STRICT                         341
-#define TK_STRING                         342
-#define TK_TIMES                          343
-#define TK_VALUES                         344
-#define TK_VARIABLE                       345
-#define TK_WAL                            346
+#define TK_STT_MERGE_POLICY               97
+#define TK_TABLE_PREFIX                   98
+#define TK_TABLE_SUFFIX                   99
+#define TK_KEEP_TIME_OFFSET               100
+#define TK_NK_COLON                       101
+#define TK_BWLIMIT                        102
+#define TK_START                          103
+#define TK_TIMESTAMP                      104
+#define TK_END                            105
+#define TK_TABLE                          106
+#define TK_NK_LP                          107
+#define TK_NK_RP                          108
+#define TK_STABLE                         109
+#define TK_COLUMN                         110
+#define TK_MODIFY                         111
+#define TK_RENAME                         112
+#define TK_TAG                            113
+#define TK_SET                            114
+#define TK_NK_EQ                          115
+#define TK_USING                          116
+#define TK_TAGS                           117
+#define TK_BOOL                           118
+#define TK_TINYINT                        119
+#define TK_SMALLINT                       120
+#define TK_INT                            121
+#define TK_INTEGER                        122
+#define TK_BIGINT                         123
+#define TK_FLOAT                          124
+#define TK_DOUBLE                         125
+#define TK_BINARY                         126
+#define TK_NCHAR                          127
+#define TK_UNSIGNED                       128
+#define TK_JSON                           129
+#define TK_VARCHAR                        130
+#define TK_MEDIUMBLOB                     131
+#define TK_BLOB                           132
+#define TK_VARBINARY                      133
+#define TK_GEOMETRY                       134
+#define TK_DECIMAL                        135
+#define TK_COMMENT                        136
+#define TK_MAX_DELAY                      137
+#define TK_WATERMARK                      138
+#define TK_ROLLUP                         139
+#define TK_TTL                            140
+#define TK_SMA                            141
+#define TK_BLOOM_FILTER                   142
+#define TK_DELETE_MARK                    143
+#define TK_FIRST                          144
+#define TK_LAST                           145
+#define TK_SHOW                           146
+#define TK_PRIVILEGES                     147
+#define TK_DATABASES                      148
+#define TK_TABLES                         149
+#define TK_STABLES                        150
+#define TK_MNODES                         151
+#define TK_QNODES                         152
+#define TK_FUNCTIONS                      153
+#define TK_INDEXES                        154
+#define TK_ACCOUNTS                       155
+#define TK_APPS                           156
+#define TK_CONNECTIONS                    157
+#define TK_LICENCES                       158
+#define TK_GRANTS                         159
+#define TK_QUERIES                        160
+#define TK_SCORES                         161
+#define TK_TOPICS                         162
+#define TK_VARIABLES                      163
+#define TK_CLUSTER                        164
+#define TK_BNODES                         165
+#define TK_SNODES                         166
+#define TK_TRANSACTIONS                   167
+#define TK_DISTRIBUTED                    168
+#define TK_CONSUMERS                      169
+#define TK_SUBSCRIPTIONS                  170
+#define TK_VNODES                         171
+#define TK_ALIVE                          172
+#define TK_VIEWS                          173
+#define TK_VIEW                           174
+#define TK_COMPACTS                       175
+#define TK_NORMAL                         176
+#define TK_CHILD                          177
+#define TK_LIKE                           178
+#define TK_TBNAME                         179
+#define TK_QTAGS                          180
+#define TK_AS                             181
+#define TK_SYSTEM                         182
+#define TK_INDEX                          183
+#define TK_FUNCTION                       184
+#define TK_INTERVAL                       185
+#define TK_COUNT                          186
+#define TK_LAST_ROW                       187
+#define TK_META                           188
+#define TK_ONLY                           189
+#define TK_TOPIC                          190
+#define TK_CONSUMER                       191
+#define TK_GROUP                          192
+#define TK_DESC                           193
+#define TK_DESCRIBE                       194
+#define TK_RESET                          195
+#define TK_QUERY                          196
+#define TK_CACHE                          197
+#define TK_EXPLAIN                        198
+#define TK_ANALYZE                        199
+#define TK_VERBOSE                        200
+#define TK_NK_BOOL                        201
+#define TK_RATIO                          202
+#define TK_NK_FLOAT                       203
+#define TK_OUTPUTTYPE                     204
+#define TK_AGGREGATE                      205
+#define TK_BUFSIZE                        206
+#define TK_LANGUAGE                       207
+#define TK_REPLACE                        208
+#define TK_STREAM                         209
+#define TK_INTO                           210
+#define TK_PAUSE                          211
+#define TK_RESUME                         212
+#define TK_TRIGGER                        213
+#define TK_AT_ONCE                        214
+#define TK_WINDOW_CLOSE                   215
+#define TK_IGNORE                         216
+#define TK_EXPIRED                        217
+#define TK_FILL_HISTORY                   218
+#define TK_UPDATE                         219
+#define TK_SUBTABLE                       220
+#define TK_UNTREATED                      221
+#define TK_KILL                           222
+#define TK_CONNECTION                     223
+#define TK_TRANSACTION                    224
+#define TK_BALANCE                        225
+#define TK_VGROUP                         226
+#define TK_LEADER                         227
+#define TK_MERGE                          228
+#define TK_REDISTRIBUTE                   229
+#define TK_SPLIT                          230
+#define TK_DELETE                         231
+#define TK_INSERT                         232
+#define TK_NULL                           233
+#define TK_NK_QUESTION                    234
+#define TK_NK_ALIAS                       235
+#define TK_NK_ARROW                       236
+#define TK_ROWTS                          237
+#define TK_QSTART                         238
+#define TK_QEND                           239
+#define TK_QDURATION                      240
+#define TK_WSTART                         241
+#define TK_WEND                           242
+#define TK_WDURATION                      243
+#define TK_IROWTS                         244
+#define TK_ISFILLED                       245
+#define TK_CAST                           246
+#define TK_NOW                            247
+#define TK_TODAY                          248
+#define TK_TIMEZONE                       249
+#define TK_CLIENT_VERSION                 250
+#define TK_SERVER_VERSION                 251
+#define TK_SERVER_STATUS                  252
+#define TK_CURRENT_USER                   253
+#define TK_CASE                           254
+#define TK_WHEN                           255
+#define TK_THEN                           256
+#define TK_ELSE                           257
+#define TK_BETWEEN                        258
+#define TK_IS                             259
+#define TK_NK_LT                          260
+#define TK_NK_GT                          261
+#define TK_NK_LE                          262
+#define TK_NK_GE                          263
+#define TK_NK_NE                          264
+#define TK_MATCH                          265
+#define TK_NMATCH                         266
+#define TK_CONTAINS                       267
+#define TK_IN                             268
+#define TK_JOIN                           269
+#define TK_INNER                          270
+#define TK_SELECT                         271
+#define TK_NK_HINT                        272
+#define TK_DISTINCT                       273
+#define TK_WHERE                          274
+#define TK_PARTITION                      275
+#define TK_BY                             276
+#define TK_SESSION                        277
+#define TK_STATE_WINDOW                   278
+#define TK_EVENT_WINDOW                   279
+#define TK_SLIDING                        280
+#define TK_FILL                           281
+#define TK_VALUE                          282
+#define TK_VALUE_F                        283
+#define TK_NONE                           284
+#define TK_PREV                           285
+#define TK_NULL_F                         286
+#define TK_LINEAR                         287
+#define TK_NEXT                           288
+#define TK_HAVING                         289
+#define TK_RANGE                          290
+#define TK_EVERY                          291
+#define TK_ORDER                          292
+#define TK_SLIMIT                         293
+#define TK_SOFFSET                        294
+#define TK_LIMIT                          295
+#define TK_OFFSET                         296
+#define TK_ASC                            297
+#define TK_NULLS                          298
+#define TK_ABORT                          299
+#define TK_AFTER                          300
+#define TK_ATTACH                         301
+#define TK_BEFORE                         302
+#define TK_BEGIN                          303
+#define TK_BITAND                         304
+#define TK_BITNOT                         305
+#define TK_BITOR                          306
+#define TK_BLOCKS                         307
+#define TK_CHANGE                         308
+#define TK_COMMA                          309
+#define TK_CONCAT                         310
+#define TK_CONFLICT                       311
+#define TK_COPY                           312
+#define TK_DEFERRED                       313
+#define TK_DELIMITERS                     314
+#define TK_DETACH                         315
+#define TK_DIVIDE                         316
+#define TK_DOT                            317
+#define TK_EACH                           318
+#define TK_FAIL                           319
+#define TK_FILE                           320
+#define TK_FOR                            321
+#define TK_GLOB                           322
+#define TK_ID                             323
+#define TK_IMMEDIATE                      324
+#define TK_IMPORT                         325
+#define TK_INITIALLY                      326
+#define TK_INSTEAD                        327
+#define TK_ISNULL                         328
+#define TK_KEY                            329
+#define TK_MODULES                        330
+#define TK_NK_BITNOT                      331
+#define TK_NK_SEMI                        332
+#define TK_NOTNULL                        333
+#define TK_OF                             334
+#define TK_PLUS                           335
+#define TK_PRIVILEGE                      336
+#define TK_RAISE                          337
+#define TK_RESTRICT                       338
+#define TK_ROW                            339
+#define TK_SEMI                           340
+#define TK_STAR                           341
+#define TK_STATEMENT                      342
+#define TK_STRICT                         343
+#define TK_STRING                         344
+#define TK_TIMES                          345
+#define TK_VALUES                         346
+#define TK_VARIABLE                       347
+#define TK_WAL                            348
 #endif
 /**************** End token definitions ***************************************/
 
@@ -452,29 +454,29 @@
 #endif
 /************* Begin control #defines *****************************************/
 #define YYCODETYPE unsigned short int
-#define YYNOCODE 508
+#define YYNOCODE 510
 #define YYACTIONTYPE unsigned short int
 #define ParseTOKENTYPE  SToken 
 typedef union {
   int yyinit;
   ParseTOKENTYPE yy0;
-  SNodeList* yy88;
-  int32_t yy92;
-  SAlterOption yy117;
-  SShowTablesOption yy133;
-  ENullOrder yy153;
-  int64_t yy221;
-  SNode* yy232;
-  STokenPair yy241;
-  EFillMode yy246;
-  int8_t yy279;
-  EShowKind yy281;
-  SDataType yy400;
-  EJoinType yy436;
-  EOperatorType yy708;
-  EOrder yy834;
-  bool yy985;
-  SToken yy993;
+  EOperatorType yy20;
+  int32_t yy40;
+  EFillMode yy114;
+  int8_t yy143;
+  SDataType yy184;
+  SShowTablesOption yy277;
+  SNodeList* yy364;
+  int64_t yy429;
+  EShowKind yy430;
+  bool yy437;
+  ENullOrder yy517;
+  SAlterOption yy665;
+  EJoinType yy732;
+  STokenPair yy777;
+  SToken yy929;
+  EOrder yy938;
+  SNode* yy992;
 } YYMINORTYPE;
 #ifndef YYSTACKDEPTH
 #define YYSTACKDEPTH 100
@@ -490,18 +492,18 @@ typedef union {
 #define ParseCTX_FETCH
 #define ParseCTX_STORE
 #define YYFALLBACK 1
-#define YYNSTATE             840
-#define YYNRULE              642
-#define YYNRULE_WITH_ACTION  642
-#define YYNTOKEN             347
-#define YY_MAX_SHIFT         839
-#define YY_MIN_SHIFTREDUCE   1242
-#define YY_MAX_SHIFTREDUCE   1883
-#define YY_ERROR_ACTION      1884
-#define YY_ACCEPT_ACTION     1885
-#define YY_NO_ACTION         1886
-#define YY_MIN_REDUCE        1887
-#define YY_MAX_REDUCE        2528
+#define YYNSTATE             845
+#define YYNRULE              645
+#define YYNRULE_WITH_ACTION  645
+#define YYNTOKEN             349
+#define YY_MAX_SHIFT         844
+#define YY_MIN_SHIFTREDUCE   1250
+#define YY_MAX_SHIFTREDUCE   1894
+#define YY_ERROR_ACTION      1895
+#define YY_ACCEPT_ACTION     1896
+#define YY_NO_ACTION         1897
+#define YY_MIN_REDUCE        1898
+#define YY_MAX_REDUCE        2542
 /************* End control #defines *******************************************/
 #define YY_NLOOKAHEAD ((int)(sizeof(yy_lookahead)/sizeof(yy_lookahead[0])))
 
@@ -568,874 +570,861 @@ typedef union {
 **  yy_default[]       Default action for each state.
 **
 *********** Begin parsing tables **********************************************/
-#define YY_ACTTAB_COUNT (3071)
+#define YY_ACTTAB_COUNT (2994)
 static const YYACTIONTYPE yy_action[] = {
- /*     0 */   409,  561,  197,  418,  562, 1930,  569, 2064,  171,  562,
- /*    10 */  1930,  168,   48,   46, 1807, 2210, 2077,   34,  397, 2077,
- /*    20 */   415,  471, 1648,   41,   40, 1673, 2126,   47,   45,   44,
- /*    30 */    43,   42,   36, 2208,  712, 1733, 1971, 1646,   41,   40,
- /*    40 */    38,  320,   47,   45,   44,   43,   42, 2330,   41,   40,
- /*    50 */   480, 2186,   47,   45,   44,   43,   42,  704,  146, 1674,
- /*    60 */   707,  184, 2122, 2123, 1728, 1888,  528,  526,  420,  365,
- /*    70 */    19, 2121, 2123,  217,   41,   40,  173, 1654,   47,   45,
- /*    80 */    44,   43,   42,  383, 2014, 2190,  127,   95, 2348,  126,
- /*    90 */   125,  124,  123,  122,  121,  120,  119,  118, 1673,  219,
- /*   100 */  2296,  237,  741,  836,  385,  564,   15, 1938,  811,  810,
- /*   110 */   809,  808,  427, 2070,  807,  806,  151,  801,  800,  799,
- /*   120 */   798,  797,  796,  795,  150,  789,  788,  787,  426,  425,
- /*   130 */   784,  783,  782,  183,  182,  781,  692,  486, 2186, 2499,
- /*   140 */  1648, 2329, 1735, 1736, 2367,  686,  184,  114, 2331,  745,
- /*   150 */  2333, 2334,  740,  148,  735, 1646, 2391,  691,  203,  186,
- /*   160 */   581, 2420, 2500,  693, 1282,  411, 2416,  300, 2428,  703,
- /*   170 */  2191,  138,  702, 2348, 2499,  704,  146, 1708, 1718, 2435,
- /*   180 */   205, 1479, 1480, 1289, 1734, 1737,  221,  724, 2450, 2128,
- /*   190 */  1674,  724,  691,  203, 2210, 1654,  381, 2500,  693, 1649,
- /*   200 */   174, 1647, 1899, 2504, 2126, 2432, 1284, 1287, 1288,  408,
- /*   210 */    41,   40, 2207,  712,   47,   45,   44,   43,   42,  127,
- /*   220 */  1676,  836,  126,  125,  124,  123,  122,  121,  120,  119,
- /*   230 */   118, 1652, 1653, 1705,  685, 1707, 1710, 1711, 1712, 1713,
- /*   240 */  1714, 1715, 1716, 1717,  737,  733, 1726, 1727, 1729, 1730,
- /*   250 */  1731, 1732,    2,   48,   46, 1547, 1548, 1880,  364,  682,
- /*   260 */  1671,  415, 1308, 1648, 1307,  514, 2186,  512, 1830, 2330,
- /*   270 */   531,  724,  375,   51,  692,  530, 1733, 2499, 1646,  142,
- /*   280 */  2306,  650,  742, 1831,  706,  201, 2428, 2429,  272,  144,
- /*   290 */  2433,  494,  271,  532, 2066,  691,  203, 1309,  496, 2504,
- /*   300 */  2500,  693, 2499,  112, 2310, 1728, 1887, 1873,  474,  566,
- /*   310 */  2348,   19, 1567, 1568,  226,  563, 1762, 1649, 1654, 1647,
- /*   320 */   147, 2503, 2296, 1829,  741, 2500, 2502, 2330, 2067,  196,
- /*   330 */   136,  135,  134,  133,  132,  131,  130,  129,  128,  608,
- /*   340 */   742, 2115, 1940,  607,  836,  384,  687,   15, 2312, 1652,
- /*   350 */  1653,  688,  683,  676, 1566, 1569,  482,   51,  735,   98,
- /*   360 */   578, 1879,  370, 2329, 2051,  395, 2367,  641, 2348,  175,
- /*   370 */  2331,  745, 2333, 2334,  740,  577,  735,  666, 1763,  302,
- /*   380 */  2296,  106,  741, 1735, 1736, 1910, 2197, 2176, 1958,  519,
- /*   390 */   518,  517,  516,  511,  510,  509,  508,  507,  502,  501,
- /*   400 */   500,  499,  367,  491,  490,  489, 2068,  484,  483,  382,
- /*   410 */   624,  668, 2461,  475, 1535, 1536,  579, 2203, 1708, 1718,
- /*   420 */  1554, 2329, 1673,  648, 2367, 1734, 1737,  114, 2331,  745,
- /*   430 */  2333, 2334,  740,  780,  735, 1676,  304,  639, 2296, 2519,
- /*   440 */  1649, 2420, 1647,   41,   40,  411, 2416,   47,   45,   44,
- /*   450 */    43,   42,  637, 1654,  635,  269,  268, 2289,   37,  413,
- /*   460 */  1757, 1758, 1759, 1760, 1761, 1765, 1766, 1767, 1768,  780,
- /*   470 */   311,  312, 1652, 1653, 1705,  310, 1707, 1710, 1711, 1712,
- /*   480 */  1713, 1714, 1715, 1716, 1717,  737,  733, 1726, 1727, 1729,
- /*   490 */  1730, 1731, 1732,    2,   12,   48,   46,  255,  239, 2330,
- /*   500 */  1673, 1399,  564,  415, 1938, 1648,   61,  667,   63, 1909,
- /*   510 */  2499,   63,  742,  178,  664,   12, 1398,   68, 1733,  558,
- /*   520 */  1646,  598,  594,  590,  586,  223,  254,  556, 2505,  203,
- /*   530 */   552,  548, 1908, 2500,  693, 2330,  159,  623,  622,  621,
- /*   540 */  2348,  651, 1849,  522,  613,  143,  617, 1728,  707,  651,
- /*   550 */   616, 2052, 2296,   19,  741,  615,  620,  391,  390, 1705,
- /*   560 */  1654,  614, 2296,    3,  610, 2504,   90,   96, 2499,   89,
- /*   570 */   252, 1311, 1312,   41,   40,   54, 2348,   47,   45,   44,
- /*   580 */    43,   42,  533,  424,  423, 2296,  836, 2503, 2296,   15,
- /*   590 */   741, 2500, 2501, 2329,  302, 1308, 2367, 1307,   30,  114,
- /*   600 */  2331,  745, 2333, 2334,  740,  227,  735, 2306, 1655,  149,
- /*   610 */    55,  156, 2391, 2420, 1811,  571, 2249,  411, 2416,   63,
- /*   620 */  1673, 2315,  771,  653, 2249, 1735, 1736,  521,  520, 2329,
- /*   630 */  1309, 2310, 2367,   88,  242,  114, 2331,  745, 2333, 2334,
- /*   640 */   740, 2128,  735,  251,  244,  600,  599,  186,  396, 2420,
- /*   650 */   249,  575,  325,  411, 2416, 2435, 2126, 1709,   41,   40,
- /*   660 */  1708, 1718,   47,   45,   44,   43,   42, 1734, 1737,  241,
- /*   670 */   699,  304, 1850, 1743,  304, 2312, 2451, 1974, 2159, 1673,
- /*   680 */  1444, 2431, 1649, 2060, 1647,  735,  778,  161,  160,  775,
- /*   690 */   774,  773,  158,   52, 1435,  770,  769,  768, 1439,  767,
- /*   700 */  1441, 1442,  766,  763,  171, 1450,  760, 1452, 1453,  757,
- /*   710 */   754,  751, 2078, 1706, 1652, 1653, 1705,   99, 1707, 1710,
- /*   720 */  1711, 1712, 1713, 1714, 1715, 1716, 1717,  737,  733, 1726,
- /*   730 */  1727, 1729, 1730, 1731, 1732,    2,   48,   46, 1738, 2062,
- /*   740 */  2330,   44,   43,   42,  415, 2128, 1648, 1907, 1595,  623,
- /*   750 */   622,  621,  405,  742, 1838, 2458,  613,  143,  617, 1733,
- /*   760 */  2126, 1646,  616,  725, 2075,  725, 2075,  615,  620,  391,
- /*   770 */   390, 2330, 1658,  614,  725, 2075,  610, 1709, 1885, 2050,
- /*   780 */     9, 2348,  304,  137,  742,  137, 2471, 2058, 1728,   12,
- /*   790 */   604,   10,  609, 2296,  208,  741,  602,  601,  448, 2435,
- /*   800 */  2296, 1654, 1906,  679,  678, 1836, 1837, 1839, 1840, 1841,
- /*   810 */   464, 2079, 2348,   41,   40,  463, 2128,   47,   45,   44,
- /*   820 */    43,   42, 1291,  410, 2296, 2430,  741,  836, 1672,  170,
- /*   830 */    49, 2126,  280, 1706, 2329, 1905, 1709, 2367, 2330,  498,
- /*   840 */   114, 2331,  745, 2333, 2334,  740, 2128,  735,  497,  725,
- /*   850 */  2075,  739, 2519,  419, 2420, 2296,  304,  430,  411, 2416,
- /*   860 */   667, 2126,  429, 2499, 2503, 2329, 1735, 1736, 2367,   56,
- /*   870 */   736,  114, 2331,  745, 2333, 2334,  740, 2290,  735, 2348,
- /*   880 */    95, 2505,  203, 2519, 1904, 2420, 2500,  693, 2296,  411,
- /*   890 */  2416, 2296, 1706,  741,  778,  161,  160,  775,  774,  773,
- /*   900 */   158, 1708, 1718,  704,  146,  418, 2071,  667, 1734, 1737,
- /*   910 */  2499, 2128, 1823,  171,  778,  161,  160,  775,  774,  773,
- /*   920 */   158, 2077, 2317, 1649,  452, 1647,  711,  667, 2505,  203,
- /*   930 */  2499,  700, 2329, 2500,  693, 2367, 1949, 2296,  356, 2331,
- /*   940 */   745, 2333, 2334,  740,  738,  735,  726, 2385, 2505,  203,
- /*   950 */  1764,  454,  450, 2500,  693, 1652, 1653, 1705,  626, 1707,
- /*   960 */  1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717,  737,  733,
- /*   970 */  1726, 1727, 1729, 1730, 1731, 1732,    2,   48,   46, 2319,
- /*   980 */  2330,  725, 2075, 1403,  646,  415, 1387, 1648, 1903,  649,
- /*   990 */   725, 2075,  727,  742, 2392,  674,  725, 2075, 1402,  273,
- /*  1000 */  1733,  468, 1646,  421,  725, 2075, 1796,  839,  619,  618,
- /*  1010 */   469,  171, 2330,  202, 2428, 2429,  488,  144, 2433, 2077,
- /*  1020 */  2169, 2348, 2306,  327,  275,  742, 1389, 2492, 1657, 1728,
- /*  1030 */    35,  725, 2075, 2296,  667,  741, 2314, 2499, 1804,  193,
- /*  1040 */  1769, 2296, 1654,  725, 2075,  284, 2310,  827,  823,  819,
- /*  1050 */   815,  503,  324, 2348,  791, 2505,  203, 2258,  725, 2075,
- /*  1060 */  2500,  693,  478,  504,  535, 2296, 2015,  741,  836,  704,
- /*  1070 */   146,   49, 1902,  628, 2329, 1616, 1617, 2367,  505, 1677,
- /*  1080 */   114, 2331,  745, 2333, 2334,  740,  652,  735,  640,  100,
- /*  1090 */  2312,  412, 2519,  113, 2420, 1677,  318, 1673,  411, 2416,
- /*  1100 */   735,  725, 2075, 2277,  270, 1900, 2329, 1735, 1736, 2367,
- /*  1110 */  1289,  274,  114, 2331,  745, 2333, 2334,  740,  793,  735,
- /*  1120 */   631,  580, 1677,  696, 2519, 2296, 2420,  625,  721,  794,
- /*  1130 */   411, 2416, 2036,  267, 1287, 1288,  667,  805,  803, 2499,
- /*  1140 */    41,   40, 1708, 1718,   47,   45,   44,   43,   42, 1734,
- /*  1150 */  1737,  695, 1677,  389,  388,  725, 2075, 2505,  203,  729,
- /*  1160 */   159, 2392, 2500,  693, 1649,  772, 1647, 2128, 2119,  307,
- /*  1170 */  1901,  725, 2075, 2128,   72, 2072,  306,   71,  111,  204,
- /*  1180 */  2428, 2429,  720,  144, 2433,   14,   13,  108, 2127,  708,
- /*  1190 */    63,  283, 1660, 1898, 1897,  277, 1652, 1653, 1705, 1896,
- /*  1200 */  1707, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717,  737,
- /*  1210 */   733, 1726, 1727, 1729, 1730, 1731, 1732,    2,   48,   46,
- /*  1220 */   725, 2075, 2330, 2296,  387,  386,  415,  606, 1648,   47,
- /*  1230 */    45,   44,   43,   42, 1611,  742, 1895, 2439,  194,  667,
- /*  1240 */   710, 1733, 2499, 1646,  725, 2075, 2296, 2296, 1894,  608,
- /*  1250 */  1893, 1892, 2296,  607,  725, 2075,  725, 2075,  725, 2075,
- /*  1260 */  2505,  203, 2280, 2348,  315, 2500,  693,  725, 2075,  776,
- /*  1270 */  1728,   76, 2119,  732,  722, 2296,  723,  741,  321, 1891,
- /*  1280 */  1890,  198,  462, 1654,  461,  777, 2464,  422, 2119, 2296,
- /*  1290 */   334, 1776, 1678, 2105, 1915,  831,  260, 2440, 1796,  258,
- /*  1300 */   643, 2296,  642, 2296, 2296, 1803,  139,   50, 1678,  836,
- /*  1310 */  1706,  199,   15,  437,  460, 1656, 2329, 2330,   86, 2367,
- /*  1320 */   611,   87,  114, 2331,  745, 2333, 2334,  740,  210,  735,
- /*  1330 */   742, 2053, 2296, 2296, 2519, 1678, 2420,  424,  423,  262,
- /*  1340 */   411, 2416,  261,  264, 1384,  612,  263, 1662, 1735, 1736,
- /*  1350 */   680,  266, 1947,  304,  265,  785,  159, 1342, 2348,   50,
- /*  1360 */  1733,  786, 1655,  297,  152, 1678,   50, 1882, 1883, 1382,
- /*  1370 */  2296,  141,  741, 2349,  629,  291,   14,   13, 2012, 1361,
- /*  1380 */  1941, 1719,  697, 1708, 1718, 1359, 2011,  187,  159, 1728,
- /*  1390 */  1734, 1737,   50,  309,   75, 2195,  157, 1343,  159,   66,
- /*  1400 */    50,  749, 1654,  157,  159, 1649,  140, 1647, 1931, 2454,
- /*  1410 */   157, 2329,  677,  401, 2367,  684,  714,  114, 2331,  745,
- /*  1420 */  2333, 2334,  740,  398,  735, 2196,  428, 1937,  731, 2395,
- /*  1430 */  1614, 2420,  829, 1835, 1754,  411, 2416, 1652, 1653, 1705,
- /*  1440 */  1834, 1707, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717,
- /*  1450 */   737,  733, 1726, 1727, 1729, 1730, 1731, 1732,    2, 2116,
- /*  1460 */   172,  289,  709,  705,  660,  341, 1564,  313,  717, 2455,
- /*  1470 */   317, 2465, 1429, 1770,  333, 1457,  299, 1461, 1468, 1659,
- /*  1480 */  1466,  296,  338,   74,  162,  303,   73, 2037,    5,  431,
- /*  1490 */   436,  379,  444,  445, 1681,  455,  366,  211, 1588,  456,
- /*  1500 */  2330,  212,  214,  458, 1671,  328,  472,  235,  543,  541,
- /*  1510 */   538, 1672,  479,  742,  225,  485,  481,  487,  492,  524,
- /*  1520 */   506,  523,  513, 2188, 1663,  515, 1658,  525,  536,  537,
- /*  1530 */   534,  229,  230,  539,  232,  540,  542,  544, 1679,    4,
- /*  1540 */   559, 2348,  560,  567,  240,  568,  570,   92,   63, 1674,
- /*  1550 */   572,  243, 1680, 2296,  573,  741, 1666, 1668, 1682,  576,
- /*  1560 */   246,  574,  248, 1683,   93, 2204,  582,   94,  253,  603,
- /*  1570 */   733, 1726, 1727, 1729, 1730, 1731, 1732,  632,  360,  633,
- /*  1580 */   116, 2267, 2264,  605, 2263, 2065,   64,  645,   97,  257,
- /*  1590 */  2061,  259,  164,  165, 2329,  647, 2063, 2367, 2059,  166,
- /*  1600 */   114, 2331,  745, 2333, 2334,  740,  167,  735,  153,  329,
- /*  1610 */   276, 1675, 2393,  655, 2420,  654,  659,  656,  411, 2416,
- /*  1620 */   281,  662,  671,  681, 2470,  715, 2330, 2469,    8, 2442,
- /*  1630 */   690,  290,  293,   84,   83,  467,  402,  292,  216,  742,
- /*  1640 */   661,  286,  288,  179,  279,  672, 2250,  669,  294,  295,
- /*  1650 */   670,  459,  457, 1796,  145, 2522, 1676,  701, 1801,    1,
- /*  1660 */  2330, 2498,  363,  698, 1799,  446,  298, 2348,  443,  439,
- /*  1670 */   435,  432,  460,  742,  305,  190, 2436,  154,  330, 2296,
- /*  1680 */   713,  741, 2218, 2217,  331, 2216,  407,  718,  719,  332,
- /*  1690 */   155,  105,  206, 2076,   62, 2401,  107, 2120,  747,  335,
- /*  1700 */  1266, 2348,  833,  323,  830,  163,  835,  359,  371,  372,
- /*  1710 */  2288,  304,  344, 2296,   53,  741,  337, 2287, 2286,   81,
- /*  1720 */  2329,  358, 2281, 2367,  348,  433,  114, 2331,  745, 2333,
- /*  1730 */  2334,  740,  434,  735, 2330,  339, 1639, 1640,  728,  209,
- /*  1740 */  2420,  438, 2279,  440,  411, 2416,  441,  742,  442, 1638,
- /*  1750 */  2278, 2276,  380,  447, 2329, 2275,  449, 2367, 2274,  451,
- /*  1760 */   115, 2331,  745, 2333, 2334,  740, 2273,  735, 2330,  453,
- /*  1770 */  1627, 2254,  213, 2253, 2420, 2348,  215, 1591, 2419, 2416,
- /*  1780 */    82,  742, 1590, 2231, 2230, 2229,  466, 2296,  465,  741,
- /*  1790 */  2228, 2227, 2178,  470, 1534, 2175,  473, 2174, 2168,  476,
- /*  1800 */   477, 2330, 2165,  218, 2164,   85, 2163, 2162, 2167, 2348,
- /*  1810 */   220, 2166, 2161, 2160,  742, 2158, 2157, 2156,  222,  493,
- /*  1820 */  2155, 2296,  495,  741, 2171, 2154, 2153, 2152, 2329,  224,
- /*  1830 */  2139, 2367, 2151, 2150,  115, 2331,  745, 2333, 2334,  740,
- /*  1840 */  2173,  735, 2348, 2149, 2148, 2147, 2146, 2145, 2420,  527,
- /*  1850 */    91, 2138,  730, 2416, 2296, 2144,  741, 2143, 2142, 2141,
- /*  1860 */  2140, 2137,  743, 2136, 2172, 2367, 2170, 2135,  115, 2331,
- /*  1870 */   745, 2333, 2334,  740, 2134,  735, 1540, 2330, 2133, 2132,
- /*  1880 */   228, 2131, 2420,  529, 2130, 2129,  374, 2416,  368,  369,
- /*  1890 */   742, 1400, 1404, 1977, 1976, 2329, 1975, 1973, 2367,  231,
- /*  1900 */   233,  176, 2331,  745, 2333, 2334,  740, 2330,  735, 1970,
- /*  1910 */  1396, 1969,  234,  545,  549, 1962,  546,  547, 2348,  550,
- /*  1920 */   742, 1951,  551,  553, 1926,  555,  557, 1290,  185, 1925,
- /*  1930 */  2296, 2252,  741,  554,   78,  236, 2248, 2316, 2238, 2226,
- /*  1940 */   195, 2225,  238,   79,  245, 2202,  247,  565, 2348,  250,
- /*  1950 */  2054, 1972, 1968,  583,  584,  694, 2520, 1966,  588,  585,
- /*  1960 */  2296,  589,  741,  587, 1964,  591, 1961,  593, 1946,  592,
- /*  1970 */   595, 2329,  597,  596, 2367, 1335, 1944,  115, 2331,  745,
- /*  1980 */  2333, 2334,  740, 1945,  735, 2330, 1943, 1922, 2056, 1472,
- /*  1990 */  1473, 2420, 2055, 1386,  802, 1385, 2417, 1383,  742, 1381,
- /*  2000 */  1380, 2329, 2330,  804, 2367, 1959, 1379,  175, 2331,  745,
- /*  2010 */  2333, 2334,  740, 1372,  735,  742, 1378,  256, 1377, 2330,
- /*  2020 */   392, 1374,   65, 1950,  393,  627, 2348, 1373, 1948,  394,
- /*  2030 */  1371,  399,  742,  630, 1921, 1920, 1919,  634, 2296, 1918,
- /*  2040 */   741,  636, 1917, 2348,  638,  117, 1621, 1623,  400, 1620,
- /*  2050 */  2462, 1625,   29, 2251,   69, 2296, 1601,  741, 2247, 1599,
- /*  2060 */  2348, 1597,  278, 2237,  169,  657, 2224, 2223, 2504,    6,
- /*  2070 */    17,   20, 2296,   21,  741,   23,    7,   31,  673, 2329,
- /*  2080 */  1852,  285, 2367,   22, 2330,  357, 2331,  745, 2333, 2334,
- /*  2090 */   740,   57,  735,   58,  189,  177, 2329,  742,  200, 2367,
- /*  2100 */  2317,  287,  357, 2331,  745, 2333, 2334,  740,  675,  735,
- /*  2110 */  1833,  658,   33, 2329, 2330, 1822, 2367,  282, 1872,  350,
- /*  2120 */  2331,  745, 2333, 2334,  740, 2348,  735,  742, 1576,  663,
- /*  2130 */    67,   24, 1867, 1575, 1873,  188,   32, 2296,   80,  741,
- /*  2140 */  1866,  665,  403, 1871, 1870,   18,  404,   60, 1793,  301,
- /*  2150 */   180, 1792, 2222, 2201,  101, 2348, 2200,  102,   25,  103,
- /*  2160 */   406,  308, 1828,  191,   26,  689,  314, 2296,  716,  741,
- /*  2170 */    70,  108,  319, 1745,  104, 1744,  316,   59, 2329, 2330,
- /*  2180 */    13, 2367, 1664, 2370,  176, 2331,  745, 2333, 2334,  740,
- /*  2190 */  1755,  735,  739, 1723,   11,  734,  181, 1721,   39, 2330,
- /*  2200 */  1720, 1690,   16,  192, 1698,   27,  748,  746, 2329, 1458,
- /*  2210 */    28, 2367,  742,  417,  357, 2331,  745, 2333, 2334,  740,
- /*  2220 */  2348,  735, 2330, 1455,  750,  752,  753,  755, 1454, 1451,
- /*  2230 */   756,  744, 2296,  758,  741,  742,  759, 2330,  761, 2521,
- /*  2240 */  2348, 1445,  762,  764, 1443,  414, 1449,  765,  109,  322,
- /*  2250 */   742,  110, 2296, 1448,  741, 1447, 2330, 1467, 1463, 1446,
- /*  2260 */  1333,   77,  779, 2348, 1368, 1365, 1364, 1363,  416,  742,
- /*  2270 */  1394, 1362, 1360, 2329, 1358, 2296, 2367,  741, 2348,  356,
- /*  2280 */  2331,  745, 2333, 2334,  740, 1357,  735, 1356, 2386, 1393,
- /*  2290 */  2296,  790,  741, 2329,  792,  207, 2367, 2348, 1354,  357,
- /*  2300 */  2331,  745, 2333, 2334,  740, 1353,  735, 1352, 1351, 2296,
- /*  2310 */  1350,  741, 1349, 1967, 1348, 1390, 2329, 1388, 1345, 2367,
- /*  2320 */  1344, 1341,  357, 2331,  745, 2333, 2334,  740, 1339,  735,
- /*  2330 */  2330,  644, 1340, 1338, 2367,  812,  813,  352, 2331,  745,
- /*  2340 */  2333, 2334,  740,  742,  735,  814, 1965,  816,  817, 2330,
- /*  2350 */  2329,  818, 1963, 2367,  820,  821,  342, 2331,  745, 2333,
- /*  2360 */  2334,  740,  742,  735,  822, 2330, 1960,  824,  826,  825,
- /*  2370 */  1942, 2348,  828, 1279, 1916, 1267,  832,  326,  742,  834,
- /*  2380 */  1886, 1650,  336, 2296,  837,  741, 1886,  838, 1886, 1886,
- /*  2390 */  2348, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  2400 */  1886, 1886, 2296, 1886,  741, 1886, 2348, 1886, 1886, 1886,
- /*  2410 */  1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 2296, 1886,
- /*  2420 */   741, 1886, 1886, 2330, 2329, 1886, 1886, 2367, 1886, 1886,
- /*  2430 */   340, 2331,  745, 2333, 2334,  740,  742,  735, 1886, 1886,
- /*  2440 */  1886, 1886, 1886, 2329, 1886, 1886, 2367, 2330, 1886,  343,
- /*  2450 */  2331,  745, 2333, 2334,  740, 1886,  735, 1886, 1886, 2329,
- /*  2460 */   742, 1886, 2367, 1886, 2348,  349, 2331,  745, 2333, 2334,
- /*  2470 */   740, 1886,  735, 1886, 1886, 1886, 2296, 1886,  741, 1886,
- /*  2480 */  1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 2348, 1886,
- /*  2490 */  2330, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  2500 */  2296, 1886,  741,  742, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  2510 */  1886, 1886, 1886, 1886, 1886, 1886, 2330, 2329, 1886, 1886,
- /*  2520 */  2367, 1886, 1886,  353, 2331,  745, 2333, 2334,  740,  742,
- /*  2530 */   735, 2348, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  2540 */  1886, 2329, 1886, 2296, 2367,  741, 1886,  345, 2331,  745,
- /*  2550 */  2333, 2334,  740, 1886,  735, 1886, 1886, 2348, 1886, 2330,
- /*  2560 */  1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 2296,
- /*  2570 */  1886,  741,  742, 1886, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  2580 */  1886, 1886, 1886, 2330, 2329, 1886, 1886, 2367, 1886, 1886,
- /*  2590 */   354, 2331,  745, 2333, 2334,  740,  742,  735, 1886, 1886,
- /*  2600 */  2348, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  2610 */  2329, 1886, 2296, 2367,  741, 1886,  346, 2331,  745, 2333,
- /*  2620 */  2334,  740, 1886,  735, 2348, 1886, 2330, 1886, 1886, 1886,
- /*  2630 */  1886, 1886, 1886, 1886, 1886, 1886, 2296, 1886,  741,  742,
- /*  2640 */  1886, 2330, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  2650 */  1886, 1886, 1886, 2329,  742, 1886, 2367, 2330, 1886,  355,
- /*  2660 */  2331,  745, 2333, 2334,  740, 1886,  735, 2348, 1886, 1886,
- /*  2670 */   742, 1886, 1886, 1886, 1886, 1886, 1886, 2329, 1886, 2296,
- /*  2680 */  2367,  741, 2348,  347, 2331,  745, 2333, 2334,  740, 1886,
- /*  2690 */   735, 1886, 1886, 1886, 2296, 1886,  741, 1886, 2348, 1886,
- /*  2700 */  1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  2710 */  2296, 1886,  741, 1886, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  2720 */  2329, 1886, 1886, 2367, 1886, 1886,  361, 2331,  745, 2333,
- /*  2730 */  2334,  740, 1886,  735, 2330, 2329, 1886, 1886, 2367, 1886,
- /*  2740 */  1886,  362, 2331,  745, 2333, 2334,  740,  742,  735, 1886,
- /*  2750 */  1886, 2329, 1886, 2330, 2367, 1886, 1886, 2342, 2331,  745,
- /*  2760 */  2333, 2334,  740, 1886,  735, 1886,  742, 1886, 1886, 2330,
- /*  2770 */  1886, 1886, 1886, 1886, 1886, 2348, 1886, 1886, 1886, 1886,
- /*  2780 */  1886, 1886,  742, 1886, 1886, 1886, 1886, 2296, 1886,  741,
- /*  2790 */  1886, 1886, 1886, 1886, 2348, 1886, 1886, 1886, 1886, 1886,
- /*  2800 */  1886, 1886, 1886, 1886, 1886, 1886, 2296, 1886,  741, 1886,
- /*  2810 */  2348, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  2820 */  1886, 1886, 2296, 1886,  741, 1886, 1886, 2330, 2329, 1886,
- /*  2830 */  1886, 2367, 1886, 1886, 2341, 2331,  745, 2333, 2334,  740,
- /*  2840 */   742,  735, 1886, 1886, 1886, 1886, 1886, 2329, 1886, 1886,
- /*  2850 */  2367, 2330, 1886, 2340, 2331,  745, 2333, 2334,  740, 1886,
- /*  2860 */   735, 1886, 1886, 2329,  742, 1886, 2367, 1886, 2348,  376,
- /*  2870 */  2331,  745, 2333, 2334,  740, 1886,  735, 1886, 1886, 1886,
- /*  2880 */  2296, 1886,  741, 1886, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  2890 */  1886, 1886, 2348, 1886, 2330, 1886, 1886, 1886, 1886, 1886,
- /*  2900 */  1886, 1886, 1886, 1886, 2296, 1886,  741,  742, 1886, 1886,
- /*  2910 */  1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  2920 */  2330, 2329, 1886, 1886, 2367, 1886, 1886,  377, 2331,  745,
- /*  2930 */  2333, 2334,  740,  742,  735, 2348, 1886, 1886, 1886, 1886,
- /*  2940 */  1886, 1886, 1886, 1886, 1886, 2329, 1886, 2296, 2367,  741,
- /*  2950 */  1886,  373, 2331,  745, 2333, 2334,  740, 1886,  735, 1886,
- /*  2960 */  1886, 2348, 1886, 2330, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  2970 */  1886, 1886, 1886, 2296, 1886,  741,  742, 1886, 1886, 1886,
- /*  2980 */  1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 2329, 1886,
- /*  2990 */  1886, 2367, 1886, 1886,  378, 2331,  745, 2333, 2334,  740,
- /*  3000 */  1886,  735, 1886, 1886, 2348, 1886, 1886, 1886, 1886, 1886,
- /*  3010 */  1886, 1886, 1886, 1886,  743, 1886, 2296, 2367,  741, 1886,
- /*  3020 */   352, 2331,  745, 2333, 2334,  740, 1886,  735, 1886, 1886,
- /*  3030 */  1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  3040 */  1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886, 1886,
- /*  3050 */  1886, 1886, 1886, 1886, 1886, 1886, 1886, 2329, 1886, 1886,
- /*  3060 */  2367, 1886, 1886,  351, 2331,  745, 2333, 2334,  740, 1886,
- /*  3070 */   735,
+ /*     0 */   563, 1952,  695,  564, 1941, 2513,  707,  147,   38,  321,
+ /*    10 */  2136, 2137,   48,   46, 1818,   47,   45,   44,   43,   42,
+ /*    20 */   416, 2224, 1659,  694,  204, 2344,  707,  147, 2514,  696,
+ /*    30 */   571,  622,  621,  564, 1941, 1744,  409, 1657,  742, 2221,
+ /*    40 */   715,  185,   14,   13,   41,   40, 1684,  473,   47,   45,
+ /*    50 */    44,   43,   42,  834,   41,   40, 2344, 1898,   47,   45,
+ /*    60 */    44,   43,   42,  384, 1739, 2204, 2362,   41,   40,  710,
+ /*    70 */    19,   47,   45,   44,   43,   42,  106, 1665, 2310,   30,
+ /*    80 */   744,  137,  136,  135,  134,  133,  132,  131,  130,  129,
+ /*    90 */    48,   46,  530,  528,  410,  366,  727, 2362,  416,  218,
+ /*   100 */  1659, 2081,  172,  727,  841, 1685,  376,   15,  238, 2310,
+ /*   110 */  2090,  744,  566, 1744, 1949, 1657,  203, 2442, 2443, 2343,
+ /*   120 */   145, 2447, 2381, 2303, 2142,  358, 2345,  748, 2347, 2348,
+ /*   130 */   743,  741,  738,  729, 2399,  709,  202, 2442, 2443,  714,
+ /*   140 */   145, 2447, 1739,  583, 1746, 1747,  426,  425,   19, 1787,
+ /*   150 */  2343, 1773,  653, 2381, 1861, 1665,  115, 2345,  748, 2347,
+ /*   160 */  2348,  743,  579,  738,  728, 2088, 2518, 1860,  187, 2513,
+ /*   170 */  2434, 1666,   68,  670,  412, 2430, 2513,  312,  313, 1719,
+ /*   180 */  1729, 1899,  841,  311,  138,   15, 1745, 1748, 2517,  206,
+ /*   190 */    51,  606, 2514, 2516, 2519,  204,  173, 2464, 2224, 2514,
+ /*   200 */   696, 1660,  128, 1658, 2026,  127,  126,  125,  124,  123,
+ /*   210 */   122,  121,  120,  119, 1774,   63, 2222,  715, 1684,  727,
+ /*   220 */    41,   40, 1746, 1747,   47,   45,   44,   43,   42, 1490,
+ /*   230 */  1491,  690, 1688, 1663, 1664, 1716, 2066, 1718, 1721, 1722,
+ /*   240 */  1723, 1724, 1725, 1726, 1727, 1728,  740,  736, 1737, 1738,
+ /*   250 */  1740, 1741, 1742, 1743,    2,   41,   40, 1719, 1729,   47,
+ /*   260 */    45,   44,   43,   42, 1745, 1748,  568, 1409, 1896,  153,
+ /*   270 */   707,  147,  565,  273, 1684,   63, 1319, 1320,  272, 1660,
+ /*   280 */   128, 1658, 1408,  127,  126,  125,  124,  123,  122,  121,
+ /*   290 */   120,  119, 2294,  450,   37,  414, 1768, 1769, 1770, 1771,
+ /*   300 */  1772, 1776, 1777, 1778, 1779,   63,   51,  175,  464, 1910,
+ /*   310 */   463, 1663, 1664, 1716, 2065, 1718, 1721, 1722, 1723, 1724,
+ /*   320 */  1725, 1726, 1727, 1728,  740,  736, 1737, 1738, 1740, 1741,
+ /*   330 */  1742, 1743,    2,   12,   48,   46,  784, 1669,  728, 2088,
+ /*   340 */   462, 1841,  416,  439, 1659,   98, 1454,  432,  371,  535,
+ /*   350 */   274,  396,  431,  644,  305, 1834, 1842, 1744,  209, 1657,
+ /*   360 */  1445,  773,  772,  771, 1449,  770, 1451, 1452,  769,  766,
+ /*   370 */  1688, 1460,  763, 1462, 1463,  760,  757,  754,   63,  305,
+ /*   380 */   301, 2442,  706,  560,  139,  705, 1739, 2513,  728, 2088,
+ /*   390 */  2344,  558,   19,  200,  554,  550, 1840,  670,  422, 1665,
+ /*   400 */  2513, 2135, 2137,  745,    3,  694,  204, 1316,  138, 1315,
+ /*   410 */  2514,  696,   48,   46, 1749,  611,   54, 2344, 2519,  204,
+ /*   420 */   416,  454, 1659, 2514,  696,  654,  841, 1627, 1628,   15,
+ /*   430 */   745, 2362,  240, 1558, 1559, 1744,  566, 1657, 1949,  305,
+ /*   440 */   390,  389, 1317, 2310,  642,  744, 1716, 1689,  456,  452,
+ /*   450 */   782,  162,  161,  779,  778,  777,  776,  159, 2362,  640,
+ /*   460 */   651,  638,  270,  269, 1739,   99, 1746, 1747, 1684,  305,
+ /*   470 */  2310, 1316,  744, 1315, 2142,   41,   40, 1665,   12,   47,
+ /*   480 */    45,   44,   43,   42, 2343,  728, 2088, 2381,  143,  723,
+ /*   490 */   176, 2345,  748, 2347, 2348,  743, 1606,  738, 1849,  573,
+ /*   500 */  2263, 1719, 1729,  654,  841,   56, 1317,   49, 1745, 1748,
+ /*   510 */  1665, 2343,  388,  387, 2381,  608,  185,  115, 2345,  748,
+ /*   520 */  2347, 2348,  743, 1660,  738, 1658, 1985,  150, 1822,  157,
+ /*   530 */  2405, 2434,  671, 2475, 1684,  412, 2430,  610,  466, 2142,
+ /*   540 */  2205,  609,  305,  465, 1746, 1747,  397,  682,  681, 1847,
+ /*   550 */  1848, 1850, 1851, 1852, 2140, 1663, 1664, 1716, 2449, 1718,
+ /*   560 */  1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728,  740,  736,
+ /*   570 */  1737, 1738, 1740, 1741, 1742, 1743,    2,  656, 2263, 1719,
+ /*   580 */  1729, 1397, 2449,   34, 2446, 1689, 1745, 1748,  670,   41,
+ /*   590 */    40, 2513,  689,   47,   45,   44,   43,   42,  626,  625,
+ /*   600 */   624, 1660,  580, 1658,  774,  615,  144,  620, 2445, 2519,
+ /*   610 */   204,  619,  482, 2200, 2514,  696,  618,  623,  392,  391,
+ /*   620 */  2362, 1399,  617,  616,   41,   40,  612, 1720,   47,   45,
+ /*   630 */    44,   43,   42, 1663, 1664, 1716,    9, 1718, 1721, 1722,
+ /*   640 */  1723, 1724, 1725, 1726, 1727, 1728,  740,  736, 1737, 1738,
+ /*   650 */  1740, 1741, 1742, 1743,    2,   48,   46,   52,  581, 2217,
+ /*   660 */  1891,  220, 1921,  416, 2518, 1659, 2449, 2513, 1920,   41,
+ /*   670 */    40,  256, 2344,   47,   45,   44,   43,   42, 1744,   95,
+ /*   680 */  1657,  688, 1754, 1717, 1685,  710, 2517,  179, 1684, 2518,
+ /*   690 */  2514, 2515, 2444, 1720, 2142,  600,  596,  592,  588, 2344,
+ /*   700 */   255,  406, 2320,  728, 2088, 2084, 1687, 1739, 1688, 2140,
+ /*   710 */   728, 2088,  745, 2362, 2320, 2310, 2328, 2142,  488, 2200,
+ /*   720 */  1665, 2310,   95,  470,  411, 2310, 2324,  744, 2079, 2142,
+ /*   730 */   471,  610, 2140,   48,   46,  609,  382, 2320, 2324,  386,
+ /*   740 */  2362,  416,   96, 1659, 2140,  253, 2173,  841, 2083, 1717,
+ /*   750 */    49, 2329, 2310, 2142,  744,   12, 1744,   10, 1657,  326,
+ /*   760 */   420, 2324,  516, 2200, 1890, 1919, 2343,  222, 2140, 2381,
+ /*   770 */  2326,  413,  115, 2345,  748, 2347, 2348,  743, 1775,  738,
+ /*   780 */   738,  730, 2326, 2406,  187, 1739, 2434, 1746, 1747, 2063,
+ /*   790 */   412, 2430,  738, 2343, 1884, 1918, 2381, 1659, 1665,  177,
+ /*   800 */  2345,  748, 2347, 2348,  743, 2326,  738, 2027, 1578, 1579,
+ /*   810 */   243,  227, 1657, 2465,  695,  738,  419, 2513, 2310,  252,
+ /*   820 */   245,  305, 1719, 1729,  169,  841,  250,  577,   15, 1745,
+ /*   830 */  1748,  398, 2090, 2183,  524,  694,  204,  728, 2088, 2140,
+ /*   840 */  2514,  696,  171, 1684, 1660,  242, 1658, 1720, 2310,   36,
+ /*   850 */  1577, 1580, 1665,  697, 2534,   41,   40,  490,   35,   47,
+ /*   860 */    45,   44,   43,   42, 1807, 1746, 1747,  303, 1780,  195,
+ /*   870 */   224,  602,  601,  707,  147,  480, 1663, 1664, 1716,  841,
+ /*   880 */  1718, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728,  740,
+ /*   890 */   736, 1737, 1738, 1740, 1741, 1742, 1743,    2,  228,  685,
+ /*   900 */  1719, 1729,  365, 1717, 1682,  604,  603, 1745, 1748,  500,
+ /*   910 */  2064,  514,   90, 2077,  533,   89,  728, 2088,  499,  532,
+ /*   920 */   523,  522, 1660, 1689, 1658,  782,  162,  161,  779,  778,
+ /*   930 */   777,  776,  159,  728, 2088,  496,  505,  534,  799,  197,
+ /*   940 */   669, 2049,  498,  782,  162,  161,  779,  778,  777,  776,
+ /*   950 */   159, 2129,  476,  506, 1663, 1664, 1716, 1687, 1718, 1721,
+ /*   960 */  1722, 1723, 1724, 1725, 1726, 1727, 1728,  740,  736, 1737,
+ /*   970 */  1738, 1740, 1741, 1742, 1743,    2, 1660, 1290, 1658,  784,
+ /*   980 */    88,  174, 2142,  205, 2442, 2443,  344,  145, 2447,  421,
+ /*   990 */   385,  691,  686,  679,  728, 2088, 1297, 2140,  728, 2088,
+ /*  1000 */  2073,  484, 1982,  339,   74,  728, 2088,   73, 1663, 1664,
+ /*  1010 */  1917,   44,   43,   42,  507, 1916, 1688,  367,  582, 1292,
+ /*  1020 */  1295, 1296,  732, 2517, 2406, 2085,  810,  808,  236,  545,
+ /*  1030 */   543,  540, 2211, 2190, 2291,  521,  520,  519,  518,  513,
+ /*  1040 */   512,  511,  510,  509,  504,  503,  502,  501,  368,  493,
+ /*  1050 */   492,  491, 1915,  486,  485,  383,  419,  423, 1717,  477,
+ /*  1060 */  1546, 1547, 1815, 2310,  172,  172, 1565, 2075, 2310, 1914,
+ /*  1070 */    63,   61, 2090, 2090,  816,  815,  814,  813,  429,  667,
+ /*  1080 */   812,  811,  152,  806,  805,  804,  803,  802,  801,  800,
+ /*  1090 */   151,  794,  793,  792,  428,  427,  789,  788,  787,  786,
+ /*  1100 */   184,  183,  785,  728, 2088, 2310,  702,  728, 2088,   64,
+ /*  1110 */   699, 2344,  626,  625,  624,  728, 2088, 1913,  303,  615,
+ /*  1120 */   144,  620, 2310,  276,  745,  619, 1951,  284,  728, 2088,
+ /*  1130 */   618,  623,  392,  391,  160,  713,  617,  616,  113, 1413,
+ /*  1140 */   612, 2071,  728, 2088, 1912,  728, 2088, 1297,  316,  728,
+ /*  1150 */  2088, 1909, 2362, 1908, 1412,  148,   84,   83,  469,  728,
+ /*  1160 */  2088,  217,  725, 2080, 2310,  726,  744, 1907,  796,  322,
+ /*  1170 */  2310, 1295, 1296, 1906,  461,  459,  172,  199,  149,  424,
+ /*  1180 */  1905, 2405, 1904, 2344, 2091,  364, 2142, 1903,  448, 1902,
+ /*  1190 */  1901,  445,  441,  437,  434,  462,  745, 2310, 2472, 2272,
+ /*  1200 */   775, 2141,  735, 2133, 2310, 2343, 2310,  780, 2381,   55,
+ /*  1210 */  2133,  115, 2345,  748, 2347, 2348,  743,   76,  738,  781,
+ /*  1220 */  2310,  537, 2133, 2533, 2362, 2434, 2310,  426,  425,  412,
+ /*  1230 */  2430, 1689,  798, 2310,  305, 2310, 2310, 1673,  744, 1299,
+ /*  1240 */  2310, 2344, 2310, 2310,  335, 1683, 2092, 2118, 1926,  836,
+ /*  1250 */  1744,  613, 1666,  275,  745,  140, 2485, 2304, 2454, 1807,
+ /*  1260 */   261,  211,  263,  259,  285,  262,  265,   86,   87,  264,
+ /*  1270 */   267, 1969,  160,  266,  614, 1394,  646, 2343,  645, 1739,
+ /*  1280 */  2381, 1960, 2362,  115, 2345,  748, 2347, 2348,  743, 1958,
+ /*  1290 */   738,  160, 1665,  627, 2310, 2533,  744, 2434, 1392,   50,
+ /*  1300 */    50,  412, 2430,  629,   14,   13,  188,  670, 2344,  100,
+ /*  1310 */  2513,  632,  698,  160,  649, 1893, 1894,  281,   50,  734,
+ /*  1320 */   739,  745,  198,  677,  310,   75,  158,  112, 2519,  204,
+ /*  1330 */  1911, 1814,  160, 2514,  696, 2343,  108, 1668, 2381, 2344,
+ /*  1340 */  2478,  115, 2345,  748, 2347, 2348,  743, 1622,  738, 2362,
+ /*  1350 */    66, 1667,  745, 2533, 2506, 2434, 2331,  298,  683,  412,
+ /*  1360 */  2430, 2310,  142,  744,  670, 1765, 1625, 2513,  292,  703,
+ /*  1370 */  2209,  700,   50, 2363, 1846, 1845, 2024,   50, 1942,  752,
+ /*  1380 */  2362,  290, 2344, 2468,  158, 2519,  204, 2023,  712, 1350,
+ /*  1390 */  2514,  696, 2310, 1575,  744,  745,  680, 2453,  160,  314,
+ /*  1400 */   720,  318, 2343,  160,  402, 2381,  141, 1439,  115, 2345,
+ /*  1410 */   748, 2347, 2348,  743, 2333,  738, 1674,  687, 1669, 2344,
+ /*  1420 */  2533,  790, 2434, 2362,  158, 1781,  412, 2430,  399, 1351,
+ /*  1430 */   717,  430,  745, 2343, 2210, 2310, 2381,  744,  663,  115,
+ /*  1440 */  2345,  748, 2347, 2348,  743, 1369,  738, 1730, 1677, 1679,
+ /*  1450 */  1948, 2533,  334, 2434, 1467, 2130,  791,  412, 2430, 1471,
+ /*  1460 */  2362, 2469,  736, 1737, 1738, 1740, 1741, 1742, 1743,  300,
+ /*  1470 */  2479,  708, 2310, 1479,  744,  655, 2343, 2344, 1478, 2381,
+ /*  1480 */  1367, 1476,  115, 2345,  748, 2347, 2348,  743,  304,  738,
+ /*  1490 */   745,  297, 2050,    5, 2533,  433, 2434,  438,  380,  163,
+ /*  1500 */   412, 2430,  446, 1671,  447, 1692,  457,  212,  458,  213,
+ /*  1510 */   460,  215, 1599, 2343, 2344,  329, 2381, 1670, 2362,  115,
+ /*  1520 */  2345,  748, 2347, 2348,  743,  670,  738,  745, 2513, 1682,
+ /*  1530 */  2310, 2409,  744, 2434,  474, 1683,  226,  412, 2430,  481,
+ /*  1540 */   483,  489,  487,  508, 2344,  526, 2519,  204,  494,  515,
+ /*  1550 */  2202, 2514,  696,  517,  525, 2362,  527,  745,  538,  539,
+ /*  1560 */   536,  230,  231,  541,  542,  233,  544, 2310,  546,  744,
+ /*  1570 */  1690, 2343,    4,  561, 2381,  562,  241,  115, 2345,  748,
+ /*  1580 */  2347, 2348,  743,  569,  738, 2362,  572, 1685,  570, 2407,
+ /*  1590 */    92, 2434, 1691, 1693,  574,  412, 2430, 2310,  575,  744,
+ /*  1600 */   578,  244,  576,  247,  711, 1694,  249,  584, 2343, 2218,
+ /*  1610 */    93, 2381,  605,   94,  115, 2345,  748, 2347, 2348,  743,
+ /*  1620 */   254,  738,  607,  117, 2078,  635,  731,  636, 2434,  258,
+ /*  1630 */  2344,  361,  412, 2430, 2074,  260,  648,  631, 2343,  165,
+ /*  1640 */  2281, 2381,  166,  745,  116, 2345,  748, 2347, 2348,  743,
+ /*  1650 */  2076,  738,  643, 2072,  670,  167,  168, 2513, 2434, 2278,
+ /*  1660 */    97, 2344, 2433, 2430, 1686,  650,  154,  277,  271, 2277,
+ /*  1670 */   658, 2362,  657,  282,  745, 2519,  204,  684,  718,  665,
+ /*  1680 */  2514,  696,  659, 2310,  634,  744,  662, 2264, 2344,  280,
+ /*  1690 */   330,  628,  674,    8,  664, 2484, 2483,  268,  287,  289,
+ /*  1700 */  2456,  745, 2362,  693,  291,  675,  672,  180,  673,  403,
+ /*  1710 */   704,  293,  296, 2512, 2310,  701,  744, 1807, 2536,  146,
+ /*  1720 */  1687, 1812, 1810,  191, 2343,  716,  306, 2381, 2450, 2362,
+ /*  1730 */   116, 2345,  748, 2347, 2348,  743,    1,  738,  294,   72,
+ /*  1740 */   155, 2310,   71,  744, 2434,  331,  299, 2232,  733, 2430,
+ /*  1750 */  2231,  207, 2230,  332,  295,  746,  722,  156, 2381,  721,
+ /*  1760 */   333,  116, 2345,  748, 2347, 2348,  743,  408,  738,   62,
+ /*  1770 */   105, 2344, 2089, 2415,  107, 2434,  750, 2134, 1274,  375,
+ /*  1780 */  2430,  336, 2343,  324,  745, 2381, 2344,  838,  116, 2345,
+ /*  1790 */   748, 2347, 2348,  743,  164,  738,  835,  840,   53,  745,
+ /*  1800 */   360, 2344, 2434, 2302,  372,  373,  340, 2431,  342,  338,
+ /*  1810 */   350,  343, 2362, 2301,  745, 2300,   81, 2295,  435,  436,
+ /*  1820 */  1650, 1651,  210, 2293, 2310,  440,  744, 2362,  442,  443,
+ /*  1830 */  1649,  444,  400, 2292,  381, 2290,  449, 2289,  451, 2310,
+ /*  1840 */   453,  744, 2362, 2288, 2287,  455, 1638,  401, 2268,  214,
+ /*  1850 */  2267,  216, 1602,   82, 2310, 1601,  744, 2245, 2244, 2243,
+ /*  1860 */   467,  468, 2242, 2241, 2192, 2343, 2344, 2189, 2381,  472,
+ /*  1870 */  1545,  176, 2345,  748, 2347, 2348,  743, 2188,  738,  745,
+ /*  1880 */  2343, 2182,  475, 2381, 2344,  479,  359, 2345,  748, 2347,
+ /*  1890 */  2348,  743,  652,  738, 2179, 2343,  219,  745, 2381, 2178,
+ /*  1900 */  2177,  359, 2345,  748, 2347, 2348,  743, 2362,  738,   85,
+ /*  1910 */   844,  478, 2176, 2181, 2476,  221, 2180, 2175, 2174, 2310,
+ /*  1920 */  2172,  744, 2171, 2170,  223, 2362,  328,  495, 2169,  497,
+ /*  1930 */  2185, 2168, 2167, 2166, 2165, 2164, 2187, 2310, 2163,  744,
+ /*  1940 */  2162, 2161,  194, 2160, 2159, 2158, 2157, 2156, 2155, 2344,
+ /*  1950 */   832,  828,  824,  820, 2154,  325,  225, 2153, 2152,   91,
+ /*  1960 */  2343, 2151,  745, 2381, 2344,  229,  352, 2345,  748, 2347,
+ /*  1970 */  2348,  743, 2150,  738, 2186, 2184, 2149,  742, 2343, 2148,
+ /*  1980 */  2147, 2381, 1551, 2344,  177, 2345,  748, 2347, 2348,  743,
+ /*  1990 */  2362,  738, 2146, 2145,  529,  407,  745,  114,  531, 2144,
+ /*  2000 */   319, 2143, 2310, 1410,  744, 2362,  369, 1414, 1988,  370,
+ /*  2010 */  1406, 1987,  692,  232,  234, 1986,  235, 2310, 1984,  744,
+ /*  2020 */  1981,  548, 1980,  547, 2362,  549,  551, 1973,  552,  415,
+ /*  2030 */   553,  555,  724,  556, 1962,  559, 2310,  557,  744, 2535,
+ /*  2040 */  1937,  237,   78, 2343, 1298,  186, 2381, 1936,  239,  359,
+ /*  2050 */  2345,  748, 2347, 2348,  743, 2330,  738, 2266, 2343,  196,
+ /*  2060 */  2262, 2381,  567,   79,  358, 2345,  748, 2347, 2348,  743,
+ /*  2070 */  2252,  738, 2240, 2400,  308,  246,  248, 2343, 2239, 2216,
+ /*  2080 */  2381,  307, 2344,  359, 2345,  748, 2347, 2348,  743, 2067,
+ /*  2090 */   738,  251, 1983, 1979, 1343,  745,  585, 2344,  587,  586,
+ /*  2100 */   278, 1977,  589,  590,  591, 1975,  593, 1972,  595,  594,
+ /*  2110 */   745,  597,  598,  599, 2344, 1957, 1955, 1956, 1954, 1933,
+ /*  2120 */  2069, 1484,   65, 2362, 1483, 2068, 1390,  745,  417,  257,
+ /*  2130 */  1970, 1396, 1395, 1393, 1391, 2310, 1389,  744, 2362, 1961,
+ /*  2140 */  1388,  630,  807, 1387,  809, 1386, 1381, 1383,  393, 1382,
+ /*  2150 */  2310, 1380,  744,  394, 1959, 2362,  395, 1932,  633, 1931,
+ /*  2160 */  1930, 1929, 1928,  641,  637,  639,  118, 2310,   57,  744,
+ /*  2170 */  1632, 1636, 1634, 1631,   29, 2265, 2343, 1612,  279, 2381,
+ /*  2180 */    69, 2261,  359, 2345,  748, 2347, 2348,  743, 1608,  738,
+ /*  2190 */    58,  647, 2344, 1610, 2381, 2251,  660,  354, 2345,  748,
+ /*  2200 */  2347, 2348,  743,  283,  738,  745,  170, 2344, 2343,  661,
+ /*  2210 */  2238, 2381, 2237, 1587,  345, 2345,  748, 2347, 2348,  743,
+ /*  2220 */   745,  738, 1586,  666, 2344,  668, 2518,   20,    6,   17,
+ /*  2230 */    31,   21,    7, 2362,   22,  190,  201,  745, 2331,   33,
+ /*  2240 */  1863,   67,   23,  676,  286, 2310,  678,  744, 2362,  178,
+ /*  2250 */  2344,   24,  288, 1844,  189,   32, 1878, 1833, 1883,   80,
+ /*  2260 */  2310, 1884,  744,  745, 1877, 2362,   18,  404, 1882, 1881,
+ /*  2270 */   405, 1804, 1803,  302,   60,  181, 2236, 2310, 2215,  744,
+ /*  2280 */   101,  102, 2214,   59,   25,  719, 2343,  309, 1839, 2381,
+ /*  2290 */   192, 2362,  341, 2345,  748, 2347, 2348,  743,  315,  738,
+ /*  2300 */    70, 2343,  103, 2310, 2381,  744,  104,  346, 2345,  748,
+ /*  2310 */  2347, 2348,  743,  108,  738,  320,   26, 2344, 2343, 1756,
+ /*  2320 */    11, 2381, 1755,  317,  351, 2345,  748, 2347, 2348,  743,
+ /*  2330 */   745,  738,   13, 1675,  182, 2384, 2344, 1734,  193, 1709,
+ /*  2340 */   751,  737,  418, 1732, 2343, 1731, 1766, 2381, 1701,  745,
+ /*  2350 */   355, 2345,  748, 2347, 2348,  743,   39,  738, 2362,   16,
+ /*  2360 */    27,   28,  749, 1468,  753,  755, 1465, 1464,  758,  756,
+ /*  2370 */  2310,  759,  744, 1461,  761,  762,  764, 2362, 1455,  765,
+ /*  2380 */   767, 1453,  768,  323, 1459, 1477,  109,  110,  111, 2310,
+ /*  2390 */  1473,  744,  747,   77, 1341, 1458,  783, 1457, 1377, 1456,
+ /*  2400 */  1374, 1373, 1372, 2344, 1371,  795, 1370, 1368, 1366, 1365,
+ /*  2410 */  1364, 2343, 1404, 1403, 2381,  797,  745,  347, 2345,  748,
+ /*  2420 */  2347, 2348,  743, 1362,  738,  208, 1361, 1359, 1360, 1400,
+ /*  2430 */  2343, 1358, 1357, 2381, 2344, 1356,  356, 2345,  748, 2347,
+ /*  2440 */  2348,  743, 1347,  738, 2362, 1398, 1353,  745, 1352, 1349,
+ /*  2450 */  1348, 1346, 1978,  817,  818, 1976, 2310,  819,  744,  821,
+ /*  2460 */   823,  822, 1974,  825, 1971,  827,  829,  831,  826, 1953,
+ /*  2470 */   830,  833, 1287, 1927,  837, 2362, 1275,  843,  327,  839,
+ /*  2480 */  1897, 1661,  337, 1897,  842, 1897, 1897, 2310, 1897,  744,
+ /*  2490 */  1897, 1897, 1897, 1897, 1897, 1897, 1897, 2343, 1897, 1897,
+ /*  2500 */  2381, 1897, 1897,  348, 2345,  748, 2347, 2348,  743, 1897,
+ /*  2510 */   738, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897,
+ /*  2520 */  2344, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 2343, 1897,
+ /*  2530 */  1897, 2381, 1897,  745,  357, 2345,  748, 2347, 2348,  743,
+ /*  2540 */  2344,  738, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897,
+ /*  2550 */  1897, 1897, 1897,  745, 1897, 2344, 1897, 1897, 1897, 1897,
+ /*  2560 */  1897, 2362, 1897, 1897, 1897, 1897, 1897, 1897,  745, 1897,
+ /*  2570 */  1897, 1897, 1897, 2310, 1897,  744, 1897, 2344, 1897, 1897,
+ /*  2580 */  1897, 2362, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897,
+ /*  2590 */   745, 1897, 1897, 2310, 1897,  744, 2362, 1897, 2344, 1897,
+ /*  2600 */  1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 2310, 1897,
+ /*  2610 */   744,  745, 1897, 2344, 2343, 1897, 1897, 2381, 2362, 1897,
+ /*  2620 */   349, 2345,  748, 2347, 2348,  743,  745,  738, 1897, 1897,
+ /*  2630 */  2310, 1897,  744, 1897, 2343, 1897, 1897, 2381, 1897, 2362,
+ /*  2640 */   362, 2345,  748, 2347, 2348,  743, 1897,  738, 1897, 2343,
+ /*  2650 */  1897, 2310, 2381,  744, 2362,  363, 2345,  748, 2347, 2348,
+ /*  2660 */   743, 1897,  738, 1897, 1897, 1897, 2310, 1897,  744, 1897,
+ /*  2670 */  2344, 2343, 1897, 1897, 2381, 1897, 1897, 2356, 2345,  748,
+ /*  2680 */  2347, 2348,  743,  745,  738, 1897, 1897, 1897, 1897, 1897,
+ /*  2690 */  1897, 1897, 2343, 1897, 1897, 2381, 1897, 1897, 2355, 2345,
+ /*  2700 */   748, 2347, 2348,  743, 1897,  738, 2344, 2343, 1897, 1897,
+ /*  2710 */  2381, 2362, 1897, 2354, 2345,  748, 2347, 2348,  743,  745,
+ /*  2720 */   738, 1897, 1897, 2310, 1897,  744, 1897, 1897, 1897, 1897,
+ /*  2730 */  1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897,
+ /*  2740 */  1897, 1897, 2344, 1897, 1897, 1897, 1897, 2362, 1897, 1897,
+ /*  2750 */  1897, 1897, 1897, 1897, 1897,  745, 1897, 1897, 1897, 2310,
+ /*  2760 */  1897,  744, 1897, 1897, 2343, 1897, 1897, 2381, 1897, 1897,
+ /*  2770 */   377, 2345,  748, 2347, 2348,  743, 1897,  738, 1897, 1897,
+ /*  2780 */  1897, 1897, 1897, 2362, 1897, 1897, 1897, 1897, 1897, 1897,
+ /*  2790 */  1897, 1897, 1897, 1897, 1897, 2310, 1897,  744, 1897, 1897,
+ /*  2800 */  2343, 1897, 1897, 2381, 1897, 1897,  378, 2345,  748, 2347,
+ /*  2810 */  2348,  743, 1897,  738, 1897, 1897, 1897, 1897, 1897, 1897,
+ /*  2820 */  1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 2344, 1897,
+ /*  2830 */  1897, 1897, 1897, 1897, 1897, 1897, 2343, 1897, 1897, 2381,
+ /*  2840 */  1897,  745,  374, 2345,  748, 2347, 2348,  743, 1897,  738,
+ /*  2850 */  2344, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897,
+ /*  2860 */  1897, 1897, 1897,  745, 1897, 1897, 1897, 1897, 1897, 2362,
+ /*  2870 */  1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897,
+ /*  2880 */  1897, 2310, 1897,  744, 1897, 1897, 2344, 1897, 1897, 1897,
+ /*  2890 */  1897, 2362, 1897, 1897, 1897, 1897, 1897, 1897, 1897,  745,
+ /*  2900 */  1897, 1897, 1897, 2310, 1897,  744, 1897, 1897, 1897, 1897,
+ /*  2910 */  1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897,
+ /*  2920 */  1897, 1897, 2343, 1897, 1897, 2381, 1897, 2362,  379, 2345,
+ /*  2930 */   748, 2347, 2348,  743, 1897,  738, 1897, 1897, 1897, 2310,
+ /*  2940 */  1897,  744, 1897, 1897,  746, 1897, 1897, 2381, 1897, 1897,
+ /*  2950 */   354, 2345,  748, 2347, 2348,  743, 1897,  738, 1897, 1897,
+ /*  2960 */  1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897,
+ /*  2970 */  1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 1897,
+ /*  2980 */  2343, 1897, 1897, 2381, 1897, 1897,  353, 2345,  748, 2347,
+ /*  2990 */  2348,  743, 1897,  738,
 };
 static const YYCODETYPE yy_lookahead[] = {
- /*     0 */   383,  357,  432,  383,  360,  361,  357,  392,  391,  360,
- /*    10 */   361,  391,   12,   13,   14,  405,  399,    2,  398,  399,
- /*    20 */    20,  362,   22,    8,    9,   20,  406,   12,   13,   14,
- /*    30 */    15,   16,    2,  423,  424,   35,    0,   37,    8,    9,
- /*    40 */   465,  466,   12,   13,   14,   15,   16,  350,    8,    9,
- /*    50 */   362,  363,   12,   13,   14,   15,   16,  362,  363,   20,
- /*    60 */   363,  391,  404,  405,   64,    0,  407,  408,  401,  410,
- /*    70 */    70,  404,  405,  414,    8,    9,  372,   77,   12,   13,
- /*    80 */    14,   15,   16,  413,  380,  415,   21,  371,  391,   24,
- /*    90 */    25,   26,   27,   28,   29,   30,   31,   32,   20,  411,
- /*   100 */   403,  358,  405,  103,  388,  362,  106,  364,   72,   73,
- /*   110 */    74,   75,   76,  397,   78,   79,   80,   81,   82,   83,
- /*   120 */    84,   85,   86,   87,   88,   89,   90,   91,   92,   93,
- /*   130 */    94,   95,   96,   97,   98,   99,  476,  362,  363,  479,
- /*   140 */    22,  444,  142,  143,  447,  363,  391,  450,  451,  452,
- /*   150 */   453,  454,  455,  460,  457,   37,  463,  497,  498,  462,
- /*   160 */    69,  464,  502,  503,    4,  468,  469,  472,  473,  474,
- /*   170 */   415,  476,  477,  391,  479,  362,  363,  177,  178,  449,
- /*   180 */   483,  142,  143,   23,  184,  185,  411,   20,  491,  391,
- /*   190 */    20,   20,  497,  498,  405,   77,  398,  502,  503,  199,
- /*   200 */   349,  201,  351,    3,  406,  475,   46,   47,   48,  420,
- /*   210 */     8,    9,  423,  424,   12,   13,   14,   15,   16,   21,
- /*   220 */    20,  103,   24,   25,   26,   27,   28,   29,   30,   31,
- /*   230 */    32,  231,  232,  233,  452,  235,  236,  237,  238,  239,
+ /*     0 */   359,    0,  478,  362,  363,  481,  364,  365,  467,  468,
+ /*    10 */   406,  407,   12,   13,   14,   12,   13,   14,   15,   16,
+ /*    20 */    20,  407,   22,  499,  500,  352,  364,  365,  504,  505,
+ /*    30 */   359,  378,  379,  362,  363,   35,  422,   37,  365,  425,
+ /*    40 */   426,  393,    1,    2,    8,    9,   20,  364,   12,   13,
+ /*    50 */    14,   15,   16,   52,    8,    9,  352,    0,   12,   13,
+ /*    60 */    14,   15,   16,  415,   64,  417,  393,    8,    9,  365,
+ /*    70 */    70,   12,   13,   14,   15,   16,  371,   77,  405,   33,
+ /*    80 */   407,   24,   25,   26,   27,   28,   29,   30,   31,   32,
+ /*    90 */    12,   13,  409,  410,  385,  412,   20,  393,   20,  416,
+ /*   100 */    22,  396,  393,   20,  104,   20,   70,  107,  360,  405,
+ /*   110 */   401,  407,  364,   35,  366,   37,  474,  475,  476,  446,
+ /*   120 */   478,  479,  449,  428,  393,  452,  453,  454,  455,  456,
+ /*   130 */   457,  458,  459,  460,  461,  473,  474,  475,  476,  408,
+ /*   140 */   478,  479,   64,   69,  144,  145,   12,   13,   70,  108,
+ /*   150 */   446,  115,   20,  449,  108,   77,  452,  453,  454,  455,
+ /*   160 */   456,  457,   20,  459,  364,  365,  478,  108,  464,  481,
+ /*   170 */   466,   37,    4,  478,  470,  471,  481,  137,  138,  179,
+ /*   180 */   180,    0,  104,  143,  384,  107,  186,  187,  500,  485,
+ /*   190 */   107,  391,  504,  505,  499,  500,  374,  493,  407,  504,
+ /*   200 */   505,  201,   21,  203,  382,   24,   25,   26,   27,   28,
+ /*   210 */    29,   30,   31,   32,  178,  107,  425,  426,   20,   20,
+ /*   220 */     8,    9,  144,  145,   12,   13,   14,   15,   16,  144,
+ /*   230 */   145,   20,   20,  233,  234,  235,    0,  237,  238,  239,
  /*   240 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
- /*   250 */   250,  251,  252,   12,   13,  177,  178,  191,   18,  183,
- /*   260 */    20,   20,   20,   22,   22,  362,  363,   27,   22,  350,
- /*   270 */    30,   20,   70,  106,  476,   35,   35,  479,   37,   37,
- /*   280 */   379,   20,  363,   37,  471,  472,  473,  474,  137,  476,
- /*   290 */   477,   51,  141,   53,  393,  497,  498,   55,   58,  476,
- /*   300 */   502,  503,  479,  369,  403,   64,    0,  107,   68,   14,
- /*   310 */   391,   70,  142,  143,  411,   20,  114,  199,   77,  201,
- /*   320 */   386,  498,  403,   77,  405,  502,  503,  350,  394,  390,
- /*   330 */    24,   25,   26,   27,   28,   29,   30,   31,   32,  135,
- /*   340 */   363,  402,  365,  139,  103,  105,   20,  106,  447,  231,
- /*   350 */   232,  275,  276,  277,  184,  185,  116,  106,  457,  208,
- /*   360 */   362,  295,  211,  444,    0,  214,  447,  216,  391,  450,
- /*   370 */   451,  452,  453,  454,  455,   20,  457,   50,  176,  179,
- /*   380 */   403,  369,  405,  142,  143,  350,  146,  147,    0,  149,
- /*   390 */   150,  151,  152,  153,  154,  155,  156,  157,  158,  159,
- /*   400 */   160,  161,  162,  163,  164,  165,  394,  167,  168,  169,
- /*   410 */    22,  492,  493,  173,  174,  175,  418,  419,  177,  178,
- /*   420 */   180,  444,   20,  116,  447,  184,  185,  450,  451,  452,
- /*   430 */   453,  454,  455,   69,  457,   20,  269,   21,  403,  462,
- /*   440 */   199,  464,  201,    8,    9,  468,  469,   12,   13,   14,
- /*   450 */    15,   16,   36,   77,   38,   39,   40,  426,  256,  257,
- /*   460 */   258,  259,  260,  261,  262,  263,  264,  265,  266,   69,
- /*   470 */   136,  137,  231,  232,  233,  141,  235,  236,  237,  238,
- /*   480 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
- /*   490 */   249,  250,  251,  252,  253,   12,   13,   35,  358,  350,
- /*   500 */    20,   22,  362,   20,  364,   22,  179,  476,  106,  350,
- /*   510 */   479,  106,  363,   51,  187,  253,   37,    4,   35,   51,
- /*   520 */    37,   59,   60,   61,   62,   64,   64,   59,  497,  498,
- /*   530 */    62,   63,  350,  502,  503,  350,   33,   72,   73,   74,
- /*   540 */   391,  362,  107,   86,   79,   80,   81,   64,  363,  362,
- /*   550 */    85,    0,  403,   70,  405,   90,   91,   92,   93,  233,
- /*   560 */    77,   96,  403,   33,   99,  476,  105,  105,  479,  108,
- /*   570 */   108,   56,   57,    8,    9,   45,  391,   12,   13,   14,
- /*   580 */    15,   16,  103,   12,   13,  403,  103,  498,  403,  106,
- /*   590 */   405,  502,  503,  444,  179,   20,  447,   22,   33,  450,
- /*   600 */   451,  452,  453,  454,  455,  148,  457,  379,   37,  460,
- /*   610 */   107,  462,  463,  464,   14,  436,  437,  468,  469,  106,
- /*   620 */    20,  393,  116,  436,  437,  142,  143,  170,  171,  444,
- /*   630 */    55,  403,  447,  172,  172,  450,  451,  452,  453,  454,
- /*   640 */   455,  391,  457,  181,  182,  367,  368,  462,  398,  464,
- /*   650 */   188,  189,   34,  468,  469,  449,  406,  177,    8,    9,
- /*   660 */   177,  178,   12,   13,   14,   15,   16,  184,  185,  207,
- /*   670 */    33,  269,  107,   14,  269,  447,  491,    0,    0,   20,
- /*   680 */   103,  475,  199,  392,  201,  457,  135,  136,  137,  138,
- /*   690 */   139,  140,  141,  106,  117,  118,  119,  120,  121,  122,
- /*   700 */   123,  124,  125,  126,  391,  128,  129,  130,  131,  132,
- /*   710 */   133,  134,  399,  233,  231,  232,  233,  172,  235,  236,
- /*   720 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
- /*   730 */   247,  248,  249,  250,  251,  252,   12,   13,   14,  392,
- /*   740 */   350,   14,   15,   16,   20,  391,   22,  350,  203,   72,
- /*   750 */    73,   74,  398,  363,  231,  365,   79,   80,   81,   35,
- /*   760 */   406,   37,   85,  362,  363,  362,  363,   90,   91,   92,
- /*   770 */    93,  350,  201,   96,  362,  363,   99,  177,  347,    0,
- /*   780 */    42,  391,  269,  382,  363,  382,  365,  392,   64,  253,
- /*   790 */   389,  255,  389,  403,  382,  405,  367,  368,   68,  449,
- /*   800 */   403,   77,  350,  280,  281,  282,  283,  284,  285,  286,
- /*   810 */   426,  392,  391,    8,    9,  431,  391,   12,   13,   14,
- /*   820 */    15,   16,   14,  398,  403,  475,  405,  103,   20,  179,
- /*   830 */   106,  406,  392,  233,  444,  350,  177,  447,  350,  161,
- /*   840 */   450,  451,  452,  453,  454,  455,  391,  457,  170,  362,
- /*   850 */   363,  363,  462,  398,  464,  403,  269,  426,  468,  469,
- /*   860 */   476,  406,  431,  479,    3,  444,  142,  143,  447,  382,
- /*   870 */   392,  450,  451,  452,  453,  454,  455,  426,  457,  391,
- /*   880 */   371,  497,  498,  462,  350,  464,  502,  503,  403,  468,
- /*   890 */   469,  403,  233,  405,  135,  136,  137,  138,  139,  140,
- /*   900 */   141,  177,  178,  362,  363,  383,  397,  476,  184,  185,
- /*   910 */   479,  391,  107,  391,  135,  136,  137,  138,  139,  140,
- /*   920 */   141,  399,   49,  199,  194,  201,  406,  476,  497,  498,
- /*   930 */   479,  294,  444,  502,  503,  447,    0,  403,  450,  451,
- /*   940 */   452,  453,  454,  455,  456,  457,  458,  459,  497,  498,
- /*   950 */   176,  221,  222,  502,  503,  231,  232,  233,   22,  235,
- /*   960 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
- /*   970 */   246,  247,  248,  249,  250,  251,  252,   12,   13,  106,
- /*   980 */   350,  362,  363,   22,  426,   20,   37,   22,  350,    1,
- /*   990 */   362,  363,  461,  363,  463,  365,  362,  363,   37,  136,
- /*  1000 */    35,  382,   37,  383,  362,  363,  268,   19,  376,  377,
- /*  1010 */   382,  391,  350,  472,  473,  474,  382,  476,  477,  399,
- /*  1020 */     0,  391,  379,   35,  382,  363,   77,  365,   37,   64,
- /*  1030 */   256,  362,  363,  403,  476,  405,  393,  479,    4,   51,
- /*  1040 */   266,  403,   77,  362,  363,   64,  403,   59,   60,   61,
- /*  1050 */    62,  382,   64,  391,   13,  497,  498,  387,  362,  363,
- /*  1060 */   502,  503,   42,  382,  103,  403,  380,  405,  103,  362,
- /*  1070 */   363,  106,  350,    4,  444,  212,  213,  447,  382,   20,
- /*  1080 */   450,  451,  452,  453,  454,  455,  426,  457,   19,  108,
- /*  1090 */   447,  448,  462,  105,  464,   20,  108,   20,  468,  469,
- /*  1100 */   457,  362,  363,    0,   35,  351,  444,  142,  143,  447,
- /*  1110 */    23,  441,  450,  451,  452,  453,  454,  455,   77,  457,
- /*  1120 */    51,  382,   20,   33,  462,  403,  464,   58,  140,  378,
- /*  1130 */   468,  469,  381,   64,   47,   48,  476,  376,  377,  479,
- /*  1140 */     8,    9,  177,  178,   12,   13,   14,   15,   16,  184,
- /*  1150 */   185,  290,   20,   39,   40,  362,  363,  497,  498,  461,
- /*  1160 */    33,  463,  502,  503,  199,  400,  201,  391,  403,  181,
- /*  1170 */   350,  362,  363,  391,  105,  382,  188,  108,  106,  472,
- /*  1180 */   473,  474,  406,  476,  477,    1,    2,  115,  406,  426,
- /*  1190 */   106,  382,  201,  350,  350,  207,  231,  232,  233,  350,
- /*  1200 */   235,  236,  237,  238,  239,  240,  241,  242,  243,  244,
- /*  1210 */   245,  246,  247,  248,  249,  250,  251,  252,   12,   13,
- /*  1220 */   362,  363,  350,  403,  110,  111,   20,  113,   22,   12,
- /*  1230 */    13,   14,   15,   16,  107,  363,  350,  365,  179,  476,
- /*  1240 */   382,   35,  479,   37,  362,  363,  403,  403,  350,  135,
- /*  1250 */   350,  350,  403,  139,  362,  363,  362,  363,  362,  363,
- /*  1260 */   497,  498,    0,  391,  382,  502,  503,  362,  363,  400,
- /*  1270 */    64,  116,  403,   70,  382,  403,  382,  405,  382,  350,
- /*  1280 */   350,  179,  198,   77,  200,  400,  416,  382,  403,  403,
- /*  1290 */   384,  107,  233,  387,  353,  354,  109,  267,  268,  112,
- /*  1300 */   215,  403,  217,  403,  403,  271,   33,   33,  233,  103,
- /*  1310 */   233,  179,  106,   51,  230,   37,  444,  350,   45,  447,
- /*  1320 */    13,  166,  450,  451,  452,  453,  454,  455,  225,  457,
- /*  1330 */   363,    0,  403,  403,  462,  233,  464,   12,   13,  109,
- /*  1340 */   468,  469,  112,  109,   37,   13,  112,   22,  142,  143,
- /*  1350 */   495,  109,    0,  269,  112,   13,   33,   37,  391,   33,
- /*  1360 */    35,   13,   37,  506,   33,  233,   33,  142,  143,   37,
- /*  1370 */   403,  366,  405,  391,   22,  488,    1,    2,  379,   37,
- /*  1380 */     0,  107,  292,  177,  178,   37,  379,   33,   33,   64,
- /*  1390 */   184,  185,   33,   33,   33,  416,   33,   77,   33,   33,
- /*  1400 */    33,   33,   77,   33,   33,  199,   33,  201,  361,  416,
- /*  1410 */    33,  444,  494,  494,  447,  494,  494,  450,  451,  452,
- /*  1420 */   453,  454,  455,  425,  457,  416,  366,  363,  103,  462,
- /*  1430 */   107,  464,   52,  107,  231,  468,  469,  231,  232,  233,
- /*  1440 */   107,  235,  236,  237,  238,  239,  240,  241,  242,  243,
- /*  1450 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  402,
- /*  1460 */    18,  107,  107,  478,  433,   23,  107,  107,  107,  416,
- /*  1470 */   107,  416,  107,  107,  107,  107,  499,  107,  107,  201,
- /*  1480 */   107,  470,   40,   41,  107,  481,   44,  381,  272,  427,
- /*  1490 */    51,  446,   42,  445,   20,  214,   54,  443,  197,  438,
- /*  1500 */   350,  371,  371,  438,   20,  429,  362,   65,   66,   67,
- /*  1510 */    68,   20,  363,  363,   45,  363,  412,  412,  409,  176,
- /*  1520 */   362,  409,  363,  362,  199,  412,  201,  409,  104,  375,
- /*  1530 */   102,  374,  362,  101,  362,  373,  362,  362,   20,   50,
- /*  1540 */   355,  391,  359,  355,  371,  359,  438,  371,  106,   20,
- /*  1550 */   405,  371,   20,  403,  364,  405,  231,  232,   20,  364,
- /*  1560 */   371,  428,  371,   20,  371,  419,  362,  371,  371,  355,
- /*  1570 */   245,  246,  247,  248,  249,  250,  251,  353,  355,  353,
- /*  1580 */   362,  403,  403,  391,  403,  391,  144,  218,  106,  391,
- /*  1590 */   391,  391,  391,  391,  444,  442,  391,  447,  391,  391,
- /*  1600 */   450,  451,  452,  453,  454,  455,  391,  457,  440,  438,
- /*  1610 */   369,   20,  462,  205,  464,  204,  405,  435,  468,  469,
- /*  1620 */   369,  362,  403,  279,  487,  278,  350,  487,  287,  490,
- /*  1630 */   190,  489,  485,  191,  192,  193,  296,  486,  196,  363,
- /*  1640 */   427,  421,  421,  487,  434,  289,  437,  273,  484,  427,
- /*  1650 */   288,  209,  210,  268,  363,  507,   20,  293,  116,  482,
- /*  1660 */   350,  501,  220,  291,  270,  223,  500,  391,  226,  227,
- /*  1670 */   228,  229,  230,  363,  369,  364,  449,  369,  421,  403,
- /*  1680 */   403,  405,  403,  403,  421,  403,  403,  182,  417,  387,
- /*  1690 */   369,  369,  480,  363,  106,  467,  106,  403,  395,  362,
- /*  1700 */    22,  391,  352,  369,   38,  356,  355,  439,  422,  422,
- /*  1710 */     0,  269,  385,  403,  430,  405,  370,    0,    0,   45,
- /*  1720 */   444,  385,    0,  447,  385,   37,  450,  451,  452,  453,
- /*  1730 */   454,  455,  224,  457,  350,  348,   37,   37,  462,   37,
- /*  1740 */   464,  224,    0,   37,  468,  469,   37,  363,  224,   37,
- /*  1750 */     0,    0,  224,   37,  444,    0,   37,  447,    0,   22,
- /*  1760 */   450,  451,  452,  453,  454,  455,    0,  457,  350,   37,
- /*  1770 */   219,    0,  207,    0,  464,  391,  207,  201,  468,  469,
- /*  1780 */   208,  363,  199,    0,    0,    0,  194,  403,  195,  405,
- /*  1790 */     0,    0,  147,   49,   49,    0,   37,    0,    0,   37,
- /*  1800 */    51,  350,    0,   49,    0,   45,    0,    0,    0,  391,
- /*  1810 */    49,    0,    0,    0,  363,    0,    0,    0,  161,   37,
- /*  1820 */     0,  403,  161,  405,    0,    0,    0,    0,  444,   49,
- /*  1830 */     0,  447,    0,    0,  450,  451,  452,  453,  454,  455,
- /*  1840 */     0,  457,  391,    0,    0,    0,    0,    0,  464,  146,
- /*  1850 */    45,    0,  468,  469,  403,    0,  405,    0,    0,    0,
- /*  1860 */     0,    0,  444,    0,    0,  447,    0,    0,  450,  451,
- /*  1870 */   452,  453,  454,  455,    0,  457,   22,  350,    0,    0,
- /*  1880 */   147,    0,  464,  145,    0,    0,  468,  469,   50,   50,
- /*  1890 */   363,   22,   22,    0,    0,  444,    0,    0,  447,   64,
- /*  1900 */    64,  450,  451,  452,  453,  454,  455,  350,  457,    0,
- /*  1910 */    37,    0,   64,   37,   37,    0,   51,   42,  391,   51,
- /*  1920 */   363,    0,   42,   37,    0,   42,   37,   14,   33,    0,
- /*  1930 */   403,    0,  405,   51,   42,   45,    0,   49,    0,    0,
- /*  1940 */    49,    0,   43,   42,   42,    0,  190,   49,  391,   49,
- /*  1950 */     0,    0,    0,   37,   51,  504,  505,    0,   51,   42,
- /*  1960 */   403,   42,  405,   37,    0,   37,    0,   42,    0,   51,
- /*  1970 */    37,  444,   42,   51,  447,   71,    0,  450,  451,  452,
- /*  1980 */   453,  454,  455,    0,  457,  350,    0,    0,    0,   22,
- /*  1990 */    37,  464,    0,   37,   33,   37,  469,   37,  363,   37,
- /*  2000 */    37,  444,  350,   33,  447,    0,   37,  450,  451,  452,
- /*  2010 */   453,  454,  455,   22,  457,  363,   37,  112,   37,  350,
- /*  2020 */    22,   37,  114,    0,   22,   53,  391,   37,    0,   22,
- /*  2030 */    37,  396,  363,   37,    0,    0,    0,   37,  403,    0,
- /*  2040 */   405,   37,    0,  391,   22,   20,   37,   37,  396,   37,
- /*  2050 */   493,  107,  106,    0,  106,  403,  206,  405,    0,   22,
- /*  2060 */   391,   37,   49,    0,  202,   22,    0,    0,    3,   50,
- /*  2070 */   274,   33,  403,   33,  405,  274,   50,  106,  104,  444,
- /*  2080 */   107,  106,  447,   33,  350,  450,  451,  452,  453,  454,
- /*  2090 */   455,  179,  457,  179,   33,  106,  444,  363,   49,  447,
- /*  2100 */    49,  107,  450,  451,  452,  453,  454,  455,  102,  457,
- /*  2110 */   107,  179,   33,  444,  350,  107,  447,  182,  107,  450,
- /*  2120 */   451,  452,  453,  454,  455,  391,  457,  363,  179,  186,
- /*  2130 */     3,   33,   37,  179,  107,  106,  106,  403,  106,  405,
- /*  2140 */    37,  186,   37,   37,   37,  274,   37,   33,  107,   49,
- /*  2150 */    49,  107,    0,    0,  106,  391,    0,   42,  106,   42,
- /*  2160 */   396,  107,  107,  106,   33,  496,  106,  403,  183,  405,
- /*  2170 */   106,  115,   49,  104,  106,  104,  181,  267,  444,  350,
- /*  2180 */     2,  447,   22,  106,  450,  451,  452,  453,  454,  455,
- /*  2190 */   231,  457,  363,  107,  254,  106,   49,  107,  106,  350,
- /*  2200 */   107,  107,  106,   49,   22,  106,   37,  116,  444,  107,
- /*  2210 */   106,  447,  363,   37,  450,  451,  452,  453,  454,  455,
- /*  2220 */   391,  457,  350,  107,  106,   37,  106,   37,  107,  107,
- /*  2230 */   106,  234,  403,   37,  405,  363,  106,  350,   37,  505,
- /*  2240 */   391,  107,  106,   37,  107,  396,  127,  106,  106,   33,
- /*  2250 */   363,  106,  403,  127,  405,  127,  350,   37,   22,  127,
- /*  2260 */    71,  106,   70,  391,   37,   37,   37,   37,  396,  363,
- /*  2270 */    77,   37,   37,  444,   37,  403,  447,  405,  391,  450,
- /*  2280 */   451,  452,  453,  454,  455,   37,  457,   37,  459,   77,
- /*  2290 */   403,  100,  405,  444,  100,   33,  447,  391,   37,  450,
- /*  2300 */   451,  452,  453,  454,  455,   37,  457,   37,   22,  403,
- /*  2310 */    37,  405,   37,    0,   37,   77,  444,   37,   37,  447,
- /*  2320 */    37,   37,  450,  451,  452,  453,  454,  455,   22,  457,
- /*  2330 */   350,  444,   37,   37,  447,   37,   51,  450,  451,  452,
- /*  2340 */   453,  454,  455,  363,  457,   42,    0,   37,   51,  350,
- /*  2350 */   444,   42,    0,  447,   37,   51,  450,  451,  452,  453,
- /*  2360 */   454,  455,  363,  457,   42,  350,    0,   37,   42,   51,
- /*  2370 */     0,  391,   37,   37,    0,   22,   33,   22,  363,   21,
- /*  2380 */   508,   22,   22,  403,   21,  405,  508,   20,  508,  508,
- /*  2390 */   391,  508,  508,  508,  508,  508,  508,  508,  508,  508,
- /*  2400 */   508,  508,  403,  508,  405,  508,  391,  508,  508,  508,
- /*  2410 */   508,  508,  508,  508,  508,  508,  508,  508,  403,  508,
- /*  2420 */   405,  508,  508,  350,  444,  508,  508,  447,  508,  508,
- /*  2430 */   450,  451,  452,  453,  454,  455,  363,  457,  508,  508,
- /*  2440 */   508,  508,  508,  444,  508,  508,  447,  350,  508,  450,
- /*  2450 */   451,  452,  453,  454,  455,  508,  457,  508,  508,  444,
- /*  2460 */   363,  508,  447,  508,  391,  450,  451,  452,  453,  454,
- /*  2470 */   455,  508,  457,  508,  508,  508,  403,  508,  405,  508,
- /*  2480 */   508,  508,  508,  508,  508,  508,  508,  508,  391,  508,
- /*  2490 */   350,  508,  508,  508,  508,  508,  508,  508,  508,  508,
- /*  2500 */   403,  508,  405,  363,  508,  508,  508,  508,  508,  508,
- /*  2510 */   508,  508,  508,  508,  508,  508,  350,  444,  508,  508,
- /*  2520 */   447,  508,  508,  450,  451,  452,  453,  454,  455,  363,
- /*  2530 */   457,  391,  508,  508,  508,  508,  508,  508,  508,  508,
- /*  2540 */   508,  444,  508,  403,  447,  405,  508,  450,  451,  452,
- /*  2550 */   453,  454,  455,  508,  457,  508,  508,  391,  508,  350,
- /*  2560 */   508,  508,  508,  508,  508,  508,  508,  508,  508,  403,
- /*  2570 */   508,  405,  363,  508,  508,  508,  508,  508,  508,  508,
- /*  2580 */   508,  508,  508,  350,  444,  508,  508,  447,  508,  508,
- /*  2590 */   450,  451,  452,  453,  454,  455,  363,  457,  508,  508,
- /*  2600 */   391,  508,  508,  508,  508,  508,  508,  508,  508,  508,
- /*  2610 */   444,  508,  403,  447,  405,  508,  450,  451,  452,  453,
- /*  2620 */   454,  455,  508,  457,  391,  508,  350,  508,  508,  508,
- /*  2630 */   508,  508,  508,  508,  508,  508,  403,  508,  405,  363,
- /*  2640 */   508,  350,  508,  508,  508,  508,  508,  508,  508,  508,
- /*  2650 */   508,  508,  508,  444,  363,  508,  447,  350,  508,  450,
- /*  2660 */   451,  452,  453,  454,  455,  508,  457,  391,  508,  508,
- /*  2670 */   363,  508,  508,  508,  508,  508,  508,  444,  508,  403,
- /*  2680 */   447,  405,  391,  450,  451,  452,  453,  454,  455,  508,
- /*  2690 */   457,  508,  508,  508,  403,  508,  405,  508,  391,  508,
- /*  2700 */   508,  508,  508,  508,  508,  508,  508,  508,  508,  508,
- /*  2710 */   403,  508,  405,  508,  508,  508,  508,  508,  508,  508,
- /*  2720 */   444,  508,  508,  447,  508,  508,  450,  451,  452,  453,
- /*  2730 */   454,  455,  508,  457,  350,  444,  508,  508,  447,  508,
- /*  2740 */   508,  450,  451,  452,  453,  454,  455,  363,  457,  508,
- /*  2750 */   508,  444,  508,  350,  447,  508,  508,  450,  451,  452,
- /*  2760 */   453,  454,  455,  508,  457,  508,  363,  508,  508,  350,
- /*  2770 */   508,  508,  508,  508,  508,  391,  508,  508,  508,  508,
- /*  2780 */   508,  508,  363,  508,  508,  508,  508,  403,  508,  405,
- /*  2790 */   508,  508,  508,  508,  391,  508,  508,  508,  508,  508,
- /*  2800 */   508,  508,  508,  508,  508,  508,  403,  508,  405,  508,
- /*  2810 */   391,  508,  508,  508,  508,  508,  508,  508,  508,  508,
- /*  2820 */   508,  508,  403,  508,  405,  508,  508,  350,  444,  508,
- /*  2830 */   508,  447,  508,  508,  450,  451,  452,  453,  454,  455,
- /*  2840 */   363,  457,  508,  508,  508,  508,  508,  444,  508,  508,
- /*  2850 */   447,  350,  508,  450,  451,  452,  453,  454,  455,  508,
- /*  2860 */   457,  508,  508,  444,  363,  508,  447,  508,  391,  450,
- /*  2870 */   451,  452,  453,  454,  455,  508,  457,  508,  508,  508,
- /*  2880 */   403,  508,  405,  508,  508,  508,  508,  508,  508,  508,
- /*  2890 */   508,  508,  391,  508,  350,  508,  508,  508,  508,  508,
- /*  2900 */   508,  508,  508,  508,  403,  508,  405,  363,  508,  508,
- /*  2910 */   508,  508,  508,  508,  508,  508,  508,  508,  508,  508,
- /*  2920 */   350,  444,  508,  508,  447,  508,  508,  450,  451,  452,
- /*  2930 */   453,  454,  455,  363,  457,  391,  508,  508,  508,  508,
- /*  2940 */   508,  508,  508,  508,  508,  444,  508,  403,  447,  405,
- /*  2950 */   508,  450,  451,  452,  453,  454,  455,  508,  457,  508,
- /*  2960 */   508,  391,  508,  350,  508,  508,  508,  508,  508,  508,
- /*  2970 */   508,  508,  508,  403,  508,  405,  363,  508,  508,  508,
- /*  2980 */   508,  508,  508,  508,  508,  508,  508,  508,  444,  508,
- /*  2990 */   508,  447,  508,  508,  450,  451,  452,  453,  454,  455,
- /*  3000 */   508,  457,  508,  508,  391,  508,  508,  508,  508,  508,
- /*  3010 */   508,  508,  508,  508,  444,  508,  403,  447,  405,  508,
- /*  3020 */   450,  451,  452,  453,  454,  455,  508,  457,  508,  508,
- /*  3030 */   508,  508,  508,  508,  508,  508,  508,  508,  508,  508,
- /*  3040 */   508,  508,  508,  508,  508,  508,  508,  508,  508,  508,
- /*  3050 */   508,  508,  508,  508,  508,  508,  508,  444,  508,  508,
- /*  3060 */   447,  508,  508,  450,  451,  452,  453,  454,  455,  508,
- /*  3070 */   457,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3080 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3090 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3100 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3110 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3120 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3130 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3140 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3150 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3160 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3170 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3180 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3190 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3200 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3210 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3220 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3230 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3240 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3250 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3260 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3270 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3280 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3290 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3300 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3310 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3320 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3330 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3340 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3350 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3360 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3370 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3380 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3390 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3400 */   347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
- /*  3410 */   347,  347,  347,  347,  347,  347,  347,  347,
+ /*   250 */   250,  251,  252,  253,  254,    8,    9,  179,  180,   12,
+ /*   260 */    13,   14,   15,   16,  186,  187,   14,   22,  349,   33,
+ /*   270 */   364,  365,   20,  138,   20,  107,   56,   57,  143,  201,
+ /*   280 */    21,  203,   37,   24,   25,   26,   27,   28,   29,   30,
+ /*   290 */    31,   32,    0,   68,  258,  259,  260,  261,  262,  263,
+ /*   300 */   264,  265,  266,  267,  268,  107,  107,  351,  200,  353,
+ /*   310 */   202,  233,  234,  235,    0,  237,  238,  239,  240,  241,
+ /*   320 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*   330 */   252,  253,  254,  255,   12,   13,   69,  203,  364,  365,
+ /*   340 */   232,   22,   20,   51,   22,  210,  104,  428,  213,  104,
+ /*   350 */   137,  216,  433,  218,  271,  108,   37,   35,  384,   37,
+ /*   360 */   118,  119,  120,  121,  122,  123,  124,  125,  126,  127,
+ /*   370 */    20,  129,  130,  131,  132,  133,  134,  135,  107,  271,
+ /*   380 */   474,  475,  476,   51,  478,  479,   64,  481,  364,  365,
+ /*   390 */   352,   59,   70,  181,   62,   63,   77,  478,  403,   77,
+ /*   400 */   481,  406,  407,  365,   33,  499,  500,   20,  384,   22,
+ /*   410 */   504,  505,   12,   13,   14,  391,   45,  352,  499,  500,
+ /*   420 */    20,  196,   22,  504,  505,  364,  104,  214,  215,  107,
+ /*   430 */   365,  393,  360,  179,  180,   35,  364,   37,  366,  271,
+ /*   440 */    39,   40,   55,  405,   21,  407,  235,  235,  223,  224,
+ /*   450 */   136,  137,  138,  139,  140,  141,  142,  143,  393,   36,
+ /*   460 */   117,   38,   39,   40,   64,  174,  144,  145,   20,  271,
+ /*   470 */   405,   20,  407,   22,  393,    8,    9,   77,  255,   12,
+ /*   480 */    13,   14,   15,   16,  446,  364,  365,  449,   37,  408,
+ /*   490 */   452,  453,  454,  455,  456,  457,  205,  459,  233,  438,
+ /*   500 */   439,  179,  180,  364,  104,  384,   55,  107,  186,  187,
+ /*   510 */    77,  446,  111,  112,  449,  114,  393,  452,  453,  454,
+ /*   520 */   455,  456,  457,  201,  459,  203,    0,  462,   14,  464,
+ /*   530 */   465,  466,  494,  495,   20,  470,  471,  136,  428,  393,
+ /*   540 */   417,  140,  271,  433,  144,  145,  400,  282,  283,  284,
+ /*   550 */   285,  286,  287,  288,  408,  233,  234,  235,  451,  237,
+ /*   560 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*   570 */   248,  249,  250,  251,  252,  253,  254,  438,  439,  179,
+ /*   580 */   180,   37,  451,    2,  477,  235,  186,  187,  478,    8,
+ /*   590 */     9,  481,  365,   12,   13,   14,   15,   16,   72,   73,
+ /*   600 */    74,  201,  364,  203,  117,   79,   80,   81,  477,  499,
+ /*   610 */   500,   85,  364,  365,  504,  505,   90,   91,   92,   93,
+ /*   620 */   393,   77,   96,   97,    8,    9,  100,  179,   12,   13,
+ /*   630 */    14,   15,   16,  233,  234,  235,   42,  237,  238,  239,
+ /*   640 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*   650 */   250,  251,  252,  253,  254,   12,   13,  107,  420,  421,
+ /*   660 */   193,  413,  352,   20,  478,   22,  451,  481,  352,    8,
+ /*   670 */     9,   35,  352,   12,   13,   14,   15,   16,   35,  373,
+ /*   680 */    37,  454,   14,  235,   20,  365,  500,   51,   20,    3,
+ /*   690 */   504,  505,  477,  179,  393,   59,   60,   61,   62,  352,
+ /*   700 */    64,  400,  381,  364,  365,  399,   20,   64,   20,  408,
+ /*   710 */   364,  365,  365,  393,  381,  405,  395,  393,  364,  365,
+ /*   720 */    77,  405,  373,  384,  400,  405,  405,  407,  395,  393,
+ /*   730 */   384,  136,  408,   12,   13,  140,  400,  381,  405,  390,
+ /*   740 */   393,   20,  106,   22,  408,  109,    0,  104,  399,  235,
+ /*   750 */   107,  395,  405,  393,  407,  255,   35,  257,   37,   34,
+ /*   760 */   400,  405,  364,  365,  297,  352,  446,  413,  408,  449,
+ /*   770 */   449,  450,  452,  453,  454,  455,  456,  457,  178,  459,
+ /*   780 */   459,  463,  449,  465,  464,   64,  466,  144,  145,    0,
+ /*   790 */   470,  471,  459,  446,  108,  352,  449,   22,   77,  452,
+ /*   800 */   453,  454,  455,  456,  457,  449,  459,  382,  144,  145,
+ /*   810 */   174,  413,   37,  493,  478,  459,  385,  481,  405,  183,
+ /*   820 */   184,  271,  179,  180,  393,  104,  190,  191,  107,  186,
+ /*   830 */   187,  400,  401,    0,   86,  499,  500,  364,  365,  408,
+ /*   840 */   504,  505,  181,   20,  201,  209,  203,  179,  405,    2,
+ /*   850 */   186,  187,   77,  506,  507,    8,    9,  384,  258,   12,
+ /*   860 */    13,   14,   15,   16,  270,  144,  145,  181,  268,  181,
+ /*   870 */    64,  369,  370,  364,  365,   42,  233,  234,  235,  104,
+ /*   880 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /*   890 */   247,  248,  249,  250,  251,  252,  253,  254,  150,  185,
+ /*   900 */   179,  180,   18,  235,   20,  369,  370,  186,  187,  163,
+ /*   910 */     0,   27,  106,  394,   30,  109,  364,  365,  172,   35,
+ /*   920 */   172,  173,  201,  235,  203,  136,  137,  138,  139,  140,
+ /*   930 */   141,  142,  143,  364,  365,   51,  384,   53,  380,  392,
+ /*   940 */    50,  383,   58,  136,  137,  138,  139,  140,  141,  142,
+ /*   950 */   143,  404,   68,  384,  233,  234,  235,   20,  237,  238,
+ /*   960 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*   970 */   249,  250,  251,  252,  253,  254,  201,    4,  203,   69,
+ /*   980 */   174,   18,  393,  474,  475,  476,   23,  478,  479,  400,
+ /*   990 */   106,  277,  278,  279,  364,  365,   23,  408,  364,  365,
+ /*  1000 */   394,  117,    0,   40,   41,  364,  365,   44,  233,  234,
+ /*  1010 */   352,   14,   15,   16,  384,  352,   20,   54,  384,   46,
+ /*  1020 */    47,   48,  463,    3,  465,  384,  378,  379,   65,   66,
+ /*  1030 */    67,   68,  148,  149,    0,  151,  152,  153,  154,  155,
+ /*  1040 */   156,  157,  158,  159,  160,  161,  162,  163,  164,  165,
+ /*  1050 */   166,  167,  352,  169,  170,  171,  385,  385,  235,  175,
+ /*  1060 */   176,  177,    4,  405,  393,  393,  182,  394,  405,  352,
+ /*  1070 */   107,  181,  401,  401,   72,   73,   74,   75,   76,  189,
+ /*  1080 */    78,   79,   80,   81,   82,   83,   84,   85,   86,   87,
+ /*  1090 */    88,   89,   90,   91,   92,   93,   94,   95,   96,   97,
+ /*  1100 */    98,   99,  100,  364,  365,  405,   33,  364,  365,  146,
+ /*  1110 */    33,  352,   72,   73,   74,  364,  365,  352,  181,   79,
+ /*  1120 */    80,   81,  405,  384,  365,   85,  367,  384,  364,  365,
+ /*  1130 */    90,   91,   92,   93,   33,  384,   96,   97,  371,   22,
+ /*  1140 */   100,  394,  364,  365,  352,  364,  365,   23,  384,  364,
+ /*  1150 */   365,  352,  393,  352,   37,  388,  193,  194,  195,  364,
+ /*  1160 */   365,  198,  384,  396,  405,  384,  407,  352,   13,  384,
+ /*  1170 */   405,   47,   48,  352,  211,  212,  393,  181,  462,  384,
+ /*  1180 */   352,  465,  352,  352,  401,  222,  393,  352,  225,  352,
+ /*  1190 */   352,  228,  229,  230,  231,  232,  365,  405,  367,  389,
+ /*  1200 */   402,  408,   70,  405,  405,  446,  405,  402,  449,  108,
+ /*  1210 */   405,  452,  453,  454,  455,  456,  457,  117,  459,  402,
+ /*  1220 */   405,  104,  405,  464,  393,  466,  405,   12,   13,  470,
+ /*  1230 */   471,  235,   77,  405,  271,  405,  405,   22,  407,   14,
+ /*  1240 */   405,  352,  405,  405,  386,   20,  394,  389,  355,  356,
+ /*  1250 */    35,   13,   37,  443,  365,   33,  367,  428,  269,  270,
+ /*  1260 */   110,  227,  110,  113,   64,  113,  110,   45,  168,  113,
+ /*  1270 */   110,    0,   33,  113,   13,   37,  217,  446,  219,   64,
+ /*  1280 */   449,    0,  393,  452,  453,  454,  455,  456,  457,    0,
+ /*  1290 */   459,   33,   77,   22,  405,  464,  407,  466,   37,   33,
+ /*  1300 */    33,  470,  471,   22,    1,    2,   33,  478,  352,  109,
+ /*  1310 */   481,   22,  292,   33,  428,  144,  145,  394,   33,  104,
+ /*  1320 */   394,  365,  434,  367,   33,   33,   33,  107,  499,  500,
+ /*  1330 */   353,  273,   33,  504,  505,  446,  116,   37,  449,  352,
+ /*  1340 */   418,  452,  453,  454,  455,  456,  457,  108,  459,  393,
+ /*  1350 */    33,   37,  365,  464,  367,  466,   49,  508,  497,  470,
+ /*  1360 */   471,  405,  368,  407,  478,  233,  108,  481,  490,  296,
+ /*  1370 */   418,  294,   33,  393,  108,  108,  381,   33,  363,   33,
+ /*  1380 */   393,  108,  352,  418,   33,  499,  500,  381,  108,   37,
+ /*  1390 */   504,  505,  405,  108,  407,  365,  496,  367,   33,  108,
+ /*  1400 */   108,  108,  446,   33,  496,  449,   33,  108,  452,  453,
+ /*  1410 */   454,  455,  456,  457,  107,  459,  201,  496,  203,  352,
+ /*  1420 */   464,   13,  466,  393,   33,  108,  470,  471,  427,   77,
+ /*  1430 */   496,  368,  365,  446,  418,  405,  449,  407,  435,  452,
+ /*  1440 */   453,  454,  455,  456,  457,   37,  459,  108,  233,  234,
+ /*  1450 */   365,  464,  108,  466,  108,  404,   13,  470,  471,  108,
+ /*  1460 */   393,  418,  247,  248,  249,  250,  251,  252,  253,  501,
+ /*  1470 */   418,  480,  405,  108,  407,  428,  446,  352,  108,  449,
+ /*  1480 */    37,  108,  452,  453,  454,  455,  456,  457,  483,  459,
+ /*  1490 */   365,  472,  383,  274,  464,  429,  466,   51,  448,  108,
+ /*  1500 */   470,  471,   42,  203,  447,   20,  216,  445,  440,  373,
+ /*  1510 */   440,  373,  199,  446,  352,  431,  449,  203,  393,  452,
+ /*  1520 */   453,  454,  455,  456,  457,  478,  459,  365,  481,   20,
+ /*  1530 */   405,  464,  407,  466,  364,   20,   45,  470,  471,  365,
+ /*  1540 */   414,  414,  365,  364,  352,  178,  499,  500,  411,  365,
+ /*  1550 */   364,  504,  505,  414,  411,  393,  411,  365,  105,  377,
+ /*  1560 */   103,  376,  364,  102,  375,  364,  364,  405,  364,  407,
+ /*  1570 */    20,  446,   50,  357,  449,  361,  373,  452,  453,  454,
+ /*  1580 */   455,  456,  457,  357,  459,  393,  440,   20,  361,  464,
+ /*  1590 */   373,  466,   20,   20,  407,  470,  471,  405,  366,  407,
+ /*  1600 */   366,  373,  430,  373,  428,   20,  373,  364,  446,  421,
+ /*  1610 */   373,  449,  357,  373,  452,  453,  454,  455,  456,  457,
+ /*  1620 */   373,  459,  393,  364,  393,  355,  464,  355,  466,  393,
+ /*  1630 */   352,  357,  470,  471,  393,  393,  220,    4,  446,  393,
+ /*  1640 */   405,  449,  393,  365,  452,  453,  454,  455,  456,  457,
+ /*  1650 */   393,  459,   19,  393,  478,  393,  393,  481,  466,  405,
+ /*  1660 */   107,  352,  470,  471,   20,  444,  442,  371,   35,  405,
+ /*  1670 */   207,  393,  206,  371,  365,  499,  500,  281,  280,  364,
+ /*  1680 */   504,  505,  437,  405,   51,  407,  407,  439,  352,  436,
+ /*  1690 */   440,   58,  405,  289,  429,  489,  489,   64,  423,  423,
+ /*  1700 */   492,  365,  393,  192,  491,  291,  275,  489,  290,  298,
+ /*  1710 */   295,  488,  429,  503,  405,  293,  407,  270,  509,  365,
+ /*  1720 */    20,  117,  272,  366,  446,  405,  371,  449,  451,  393,
+ /*  1730 */   452,  453,  454,  455,  456,  457,  484,  459,  487,  106,
+ /*  1740 */   371,  405,  109,  407,  466,  423,  502,  405,  470,  471,
+ /*  1750 */   405,  482,  405,  423,  486,  446,  419,  371,  449,  184,
+ /*  1760 */   389,  452,  453,  454,  455,  456,  457,  405,  459,  107,
+ /*  1770 */   371,  352,  365,  469,  107,  466,  397,  405,   22,  470,
+ /*  1780 */   471,  364,  446,  371,  365,  449,  352,  354,  452,  453,
+ /*  1790 */   454,  455,  456,  457,  358,  459,   38,  357,  432,  365,
+ /*  1800 */   441,  352,  466,    0,  424,  424,  350,  471,  387,  372,
+ /*  1810 */   387,  387,  393,    0,  365,    0,   45,    0,   37,  226,
+ /*  1820 */    37,   37,   37,    0,  405,  226,  407,  393,   37,   37,
+ /*  1830 */    37,  226,  398,    0,  226,    0,   37,    0,   37,  405,
+ /*  1840 */    22,  407,  393,    0,    0,   37,  221,  398,    0,  209,
+ /*  1850 */     0,  209,  203,  210,  405,  201,  407,    0,    0,    0,
+ /*  1860 */   197,  196,    0,    0,  149,  446,  352,    0,  449,   49,
+ /*  1870 */    49,  452,  453,  454,  455,  456,  457,    0,  459,  365,
+ /*  1880 */   446,    0,   37,  449,  352,   51,  452,  453,  454,  455,
+ /*  1890 */   456,  457,    1,  459,    0,  446,   49,  365,  449,    0,
+ /*  1900 */     0,  452,  453,  454,  455,  456,  457,  393,  459,   45,
+ /*  1910 */    19,   37,    0,    0,  495,   49,    0,    0,    0,  405,
+ /*  1920 */     0,  407,    0,    0,  163,  393,   35,   37,    0,  163,
+ /*  1930 */     0,    0,    0,    0,    0,    0,    0,  405,    0,  407,
+ /*  1940 */     0,    0,   51,    0,    0,    0,    0,    0,    0,  352,
+ /*  1950 */    59,   60,   61,   62,    0,   64,   49,    0,    0,   45,
+ /*  1960 */   446,    0,  365,  449,  352,  149,  452,  453,  454,  455,
+ /*  1970 */   456,  457,    0,  459,    0,    0,    0,  365,  446,    0,
+ /*  1980 */     0,  449,   22,  352,  452,  453,  454,  455,  456,  457,
+ /*  1990 */   393,  459,    0,    0,  148,  398,  365,  106,  147,    0,
+ /*  2000 */   109,    0,  405,   22,  407,  393,   50,   22,    0,   50,
+ /*  2010 */    37,    0,  498,   64,   64,    0,   64,  405,    0,  407,
+ /*  2020 */     0,   51,    0,   37,  393,   42,   37,    0,   51,  398,
+ /*  2030 */    42,   37,  141,   51,    0,   37,  405,   42,  407,  507,
+ /*  2040 */     0,   45,   42,  446,   14,   33,  449,    0,   43,  452,
+ /*  2050 */   453,  454,  455,  456,  457,   49,  459,    0,  446,   49,
+ /*  2060 */     0,  449,   49,   42,  452,  453,  454,  455,  456,  457,
+ /*  2070 */     0,  459,    0,  461,  183,   42,  192,  446,    0,    0,
+ /*  2080 */   449,  190,  352,  452,  453,  454,  455,  456,  457,    0,
+ /*  2090 */   459,   49,    0,    0,   71,  365,   37,  352,   42,   51,
+ /*  2100 */   209,    0,   37,   51,   42,    0,   37,    0,   42,   51,
+ /*  2110 */   365,   37,   51,   42,  352,    0,    0,    0,    0,    0,
+ /*  2120 */     0,   37,  115,  393,   22,    0,   22,  365,  398,  113,
+ /*  2130 */     0,   37,   37,   37,   37,  405,   37,  407,  393,    0,
+ /*  2140 */    37,   53,   33,   37,   33,   37,   22,   37,   22,   37,
+ /*  2150 */   405,   37,  407,   22,    0,  393,   22,    0,   37,    0,
+ /*  2160 */     0,    0,    0,   22,   37,   37,   20,  405,  181,  407,
+ /*  2170 */    37,  108,   37,   37,  107,    0,  446,  208,   49,  449,
+ /*  2180 */   107,    0,  452,  453,  454,  455,  456,  457,   37,  459,
+ /*  2190 */   181,  446,  352,   22,  449,    0,   22,  452,  453,  454,
+ /*  2200 */   455,  456,  457,  184,  459,  365,  204,  352,  446,  181,
+ /*  2210 */     0,  449,    0,  181,  452,  453,  454,  455,  456,  457,
+ /*  2220 */   365,  459,  181,  188,  352,  188,    3,   33,   50,  276,
+ /*  2230 */   107,   33,   50,  393,   33,   33,   49,  365,   49,   33,
+ /*  2240 */   108,    3,  276,  105,  107,  405,  103,  407,  393,  107,
+ /*  2250 */   352,   33,  108,  108,  107,  107,   37,  108,  108,  107,
+ /*  2260 */   405,  108,  407,  365,   37,  393,  276,   37,   37,   37,
+ /*  2270 */    37,  108,  108,   49,   33,   49,    0,  405,    0,  407,
+ /*  2280 */   107,   42,    0,  269,  107,  185,  446,  108,  108,  449,
+ /*  2290 */   107,  393,  452,  453,  454,  455,  456,  457,  107,  459,
+ /*  2300 */   107,  446,   42,  405,  449,  407,  107,  452,  453,  454,
+ /*  2310 */   455,  456,  457,  116,  459,   49,   33,  352,  446,  105,
+ /*  2320 */   256,  449,  105,  183,  452,  453,  454,  455,  456,  457,
+ /*  2330 */   365,  459,    2,   22,   49,  107,  352,  108,   49,   22,
+ /*  2340 */    37,  107,   37,  108,  446,  108,  233,  449,  108,  365,
+ /*  2350 */   452,  453,  454,  455,  456,  457,  107,  459,  393,  107,
+ /*  2360 */   107,  107,  117,  108,  107,   37,  108,  108,   37,  107,
+ /*  2370 */   405,  107,  407,  108,   37,  107,   37,  393,  108,  107,
+ /*  2380 */    37,  108,  107,   33,  128,   37,  107,  107,  107,  405,
+ /*  2390 */    22,  407,  236,  107,   71,  128,   70,  128,   37,  128,
+ /*  2400 */    22,   37,   37,  352,   37,  101,   37,   37,   37,   37,
+ /*  2410 */    37,  446,   77,   77,  449,  101,  365,  452,  453,  454,
+ /*  2420 */   455,  456,  457,   37,  459,   33,   37,   22,   37,   77,
+ /*  2430 */   446,   37,   37,  449,  352,   37,  452,  453,  454,  455,
+ /*  2440 */   456,  457,   22,  459,  393,   37,   37,  365,   37,   37,
+ /*  2450 */    37,   37,    0,   37,   51,    0,  405,   42,  407,   37,
+ /*  2460 */    42,   51,    0,   37,    0,   42,   37,   42,   51,    0,
+ /*  2470 */    51,   37,   37,    0,   33,  393,   22,   20,   22,   21,
+ /*  2480 */   510,   22,   22,  510,   21,  510,  510,  405,  510,  407,
+ /*  2490 */   510,  510,  510,  510,  510,  510,  510,  446,  510,  510,
+ /*  2500 */   449,  510,  510,  452,  453,  454,  455,  456,  457,  510,
+ /*  2510 */   459,  510,  510,  510,  510,  510,  510,  510,  510,  510,
+ /*  2520 */   352,  510,  510,  510,  510,  510,  510,  510,  446,  510,
+ /*  2530 */   510,  449,  510,  365,  452,  453,  454,  455,  456,  457,
+ /*  2540 */   352,  459,  510,  510,  510,  510,  510,  510,  510,  510,
+ /*  2550 */   510,  510,  510,  365,  510,  352,  510,  510,  510,  510,
+ /*  2560 */   510,  393,  510,  510,  510,  510,  510,  510,  365,  510,
+ /*  2570 */   510,  510,  510,  405,  510,  407,  510,  352,  510,  510,
+ /*  2580 */   510,  393,  510,  510,  510,  510,  510,  510,  510,  510,
+ /*  2590 */   365,  510,  510,  405,  510,  407,  393,  510,  352,  510,
+ /*  2600 */   510,  510,  510,  510,  510,  510,  510,  510,  405,  510,
+ /*  2610 */   407,  365,  510,  352,  446,  510,  510,  449,  393,  510,
+ /*  2620 */   452,  453,  454,  455,  456,  457,  365,  459,  510,  510,
+ /*  2630 */   405,  510,  407,  510,  446,  510,  510,  449,  510,  393,
+ /*  2640 */   452,  453,  454,  455,  456,  457,  510,  459,  510,  446,
+ /*  2650 */   510,  405,  449,  407,  393,  452,  453,  454,  455,  456,
+ /*  2660 */   457,  510,  459,  510,  510,  510,  405,  510,  407,  510,
+ /*  2670 */   352,  446,  510,  510,  449,  510,  510,  452,  453,  454,
+ /*  2680 */   455,  456,  457,  365,  459,  510,  510,  510,  510,  510,
+ /*  2690 */   510,  510,  446,  510,  510,  449,  510,  510,  452,  453,
+ /*  2700 */   454,  455,  456,  457,  510,  459,  352,  446,  510,  510,
+ /*  2710 */   449,  393,  510,  452,  453,  454,  455,  456,  457,  365,
+ /*  2720 */   459,  510,  510,  405,  510,  407,  510,  510,  510,  510,
+ /*  2730 */   510,  510,  510,  510,  510,  510,  510,  510,  510,  510,
+ /*  2740 */   510,  510,  352,  510,  510,  510,  510,  393,  510,  510,
+ /*  2750 */   510,  510,  510,  510,  510,  365,  510,  510,  510,  405,
+ /*  2760 */   510,  407,  510,  510,  446,  510,  510,  449,  510,  510,
+ /*  2770 */   452,  453,  454,  455,  456,  457,  510,  459,  510,  510,
+ /*  2780 */   510,  510,  510,  393,  510,  510,  510,  510,  510,  510,
+ /*  2790 */   510,  510,  510,  510,  510,  405,  510,  407,  510,  510,
+ /*  2800 */   446,  510,  510,  449,  510,  510,  452,  453,  454,  455,
+ /*  2810 */   456,  457,  510,  459,  510,  510,  510,  510,  510,  510,
+ /*  2820 */   510,  510,  510,  510,  510,  510,  510,  510,  352,  510,
+ /*  2830 */   510,  510,  510,  510,  510,  510,  446,  510,  510,  449,
+ /*  2840 */   510,  365,  452,  453,  454,  455,  456,  457,  510,  459,
+ /*  2850 */   352,  510,  510,  510,  510,  510,  510,  510,  510,  510,
+ /*  2860 */   510,  510,  510,  365,  510,  510,  510,  510,  510,  393,
+ /*  2870 */   510,  510,  510,  510,  510,  510,  510,  510,  510,  510,
+ /*  2880 */   510,  405,  510,  407,  510,  510,  352,  510,  510,  510,
+ /*  2890 */   510,  393,  510,  510,  510,  510,  510,  510,  510,  365,
+ /*  2900 */   510,  510,  510,  405,  510,  407,  510,  510,  510,  510,
+ /*  2910 */   510,  510,  510,  510,  510,  510,  510,  510,  510,  510,
+ /*  2920 */   510,  510,  446,  510,  510,  449,  510,  393,  452,  453,
+ /*  2930 */   454,  455,  456,  457,  510,  459,  510,  510,  510,  405,
+ /*  2940 */   510,  407,  510,  510,  446,  510,  510,  449,  510,  510,
+ /*  2950 */   452,  453,  454,  455,  456,  457,  510,  459,  510,  510,
+ /*  2960 */   510,  510,  510,  510,  510,  510,  510,  510,  510,  510,
+ /*  2970 */   510,  510,  510,  510,  510,  510,  510,  510,  510,  510,
+ /*  2980 */   446,  510,  510,  449,  510,  510,  452,  453,  454,  455,
+ /*  2990 */   456,  457,  510,  459,  349,  349,  349,  349,  349,  349,
+ /*  3000 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3010 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3020 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3030 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3040 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3050 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3060 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3070 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3080 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3090 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3100 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3110 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3120 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3130 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3140 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3150 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3160 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3170 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3180 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3190 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3200 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3210 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3220 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3230 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3240 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3250 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3260 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3270 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3280 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3290 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3300 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3310 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3320 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3330 */   349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+ /*  3340 */   349,  349,  349,
 };
-#define YY_SHIFT_COUNT    (839)
+#define YY_SHIFT_COUNT    (844)
 #define YY_SHIFT_MIN      (0)
-#define YY_SHIFT_MAX      (2374)
+#define YY_SHIFT_MAX      (2473)
 static const unsigned short int yy_shift_ofst[] = {
- /*     0 */  1442,    0,  241,    0,  483,  483,  483,  483,  483,  483,
- /*    10 */   483,  483,  483,  483,  483,  483,  724,  965,  965, 1206,
- /*    20 */   965,  965,  965,  965,  965,  965,  965,  965,  965,  965,
- /*    30 */   965,  965,  965,  965,  965,  965,  965,  965,  965,  965,
- /*    40 */   965,  965,  965,  965,  965,  965,  965,  965,  965,  965,
- /*    50 */   965,  167,  402, 1084,  251,  405,  587,  405,  405,  251,
- /*    60 */   251,  405, 1325,  405,  240, 1325, 1325,  513,  405,    5,
- /*    70 */   170,  171,  171,  160,  160,  170,   78,   39,  295,  295,
- /*    80 */   326,  171,  171,  171,  171,  171,  171,  171,  171,  171,
- /*    90 */   171,  171,  261,  355,  171,  171,   91,    5,  171,  261,
- /*   100 */   171,    5,  171,  171,    5,  171,  171,    5,  171,    5,
- /*   110 */     5,    5,  171,  400,  202,  202,  465,  198,  118,  118,
- /*   120 */   118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
- /*   130 */   118,  118,  118,  118,  118,  118,  118, 1114,  200,   78,
- /*   140 */    39,  515,  515,  949,  415,  415,  415,  364,  536,  536,
- /*   150 */  1041,  949,   91,  307,    5,    5,  262,    5,  376,    5,
- /*   160 */   376,  376,  506,  618,  577,  577,  577,  577,  577,  577,
- /*   170 */   577,  577,  988,  677,   65, 1132,   66,  523,  242,   76,
- /*   180 */   600,  659,  571,  571, 1059, 1087, 1102,  246,  246,  246,
- /*   190 */   327,  246,  480,  575, 1075,  808,  204,  545, 1075, 1075,
- /*   200 */  1077, 1030,  738,  861, 1030,  530, 1034, 1041, 1216, 1439,
- /*   210 */  1450, 1474, 1281,   91, 1474,   91, 1301, 1484, 1491, 1469,
- /*   220 */  1491, 1469, 1343, 1484, 1491, 1484, 1469, 1343, 1343, 1424,
- /*   230 */  1428, 1484, 1432, 1484, 1484, 1484, 1518, 1489, 1518, 1489,
- /*   240 */  1474,   91,   91, 1529,   91, 1532, 1538,   91, 1532,   91,
- /*   250 */  1543,   91,   91, 1484,   91, 1518,    5,    5,    5,    5,
- /*   260 */     5,    5,    5,    5,    5,    5,    5, 1484,  618,  618,
- /*   270 */  1518,  376,  376,  376, 1369, 1482, 1474,  400, 1591, 1408,
- /*   280 */  1411, 1529,  400, 1216, 1484,  376, 1344, 1347, 1344, 1347,
- /*   290 */  1341, 1440, 1344, 1356, 1362, 1374, 1216, 1340, 1364, 1372,
- /*   300 */  1385, 1491, 1636, 1542, 1394, 1532,  400,  400, 1347,  376,
- /*   310 */   376,  376,  376, 1347,  376, 1505,  400,  506,  400, 1491,
- /*   320 */  1588, 1590,  376, 1484,  400, 1678, 1666, 1518, 3071, 3071,
- /*   330 */  3071, 3071, 3071, 3071, 3071, 3071, 3071,   36,  462,  306,
- /*   340 */   565, 1069,  435,  805,  551,   15,   30,  650,  779,   40,
- /*   350 */    40,   40,   40,   40,   40,   40,   40,   40,  759,  151,
- /*   360 */   416, 1217, 1217,  730,  461,  457,  468,  678,  479,  961,
- /*   370 */   863,  334,  334,  727, 1184,  774,  727,  727,  727, 1262,
- /*   380 */  1103,  503, 1020, 1273, 1155, 1331, 1187, 1230, 1234, 1242,
- /*   390 */  1307, 1332,  388,  936, 1352, 1085, 1127, 1323,  981, 1326,
- /*   400 */  1333, 1354, 1225, 1090,  637, 1355, 1359, 1360, 1361, 1363,
- /*   410 */  1365, 1375, 1366, 1203, 1274,  873, 1367, 1368, 1370, 1371,
- /*   420 */  1373, 1377, 1072,  991, 1278, 1342, 1348, 1320, 1380, 1710,
- /*   430 */  1717, 1718, 1674, 1722, 1688, 1508, 1699, 1700, 1702, 1517,
- /*   440 */  1742, 1706, 1709, 1524, 1712, 1750, 1528, 1751, 1716, 1755,
- /*   450 */  1719, 1758, 1737, 1766, 1732, 1551, 1771, 1565, 1773, 1569,
- /*   460 */  1572, 1576, 1583, 1783, 1784, 1785, 1593, 1592, 1790, 1791,
- /*   470 */  1645, 1744, 1745, 1795, 1759, 1797, 1798, 1762, 1749, 1802,
- /*   480 */  1754, 1804, 1760, 1806, 1807, 1808, 1761, 1811, 1812, 1813,
- /*   490 */  1815, 1816, 1817, 1657, 1782, 1820, 1661, 1824, 1825, 1826,
- /*   500 */  1827, 1832, 1833, 1840, 1843, 1844, 1845, 1846, 1847, 1855,
- /*   510 */  1857, 1858, 1859, 1860, 1780, 1830, 1805, 1851, 1861, 1863,
- /*   520 */  1864, 1866, 1867, 1874, 1854, 1878, 1733, 1879, 1703, 1881,
- /*   530 */  1738, 1884, 1885, 1869, 1838, 1870, 1839, 1893, 1835, 1873,
- /*   540 */  1894, 1836, 1896, 1848, 1897, 1909, 1876, 1865, 1875, 1911,
- /*   550 */  1877, 1868, 1880, 1915, 1886, 1882, 1883, 1921, 1889, 1924,
- /*   560 */  1890, 1892, 1895, 1888, 1891, 1913, 1898, 1929, 1899, 1901,
- /*   570 */  1931, 1936, 1938, 1939, 1902, 1756, 1941, 1888, 1900, 1945,
- /*   580 */  1950, 1904, 1951, 1952, 1916, 1903, 1917, 1957, 1926, 1907,
- /*   590 */  1919, 1964, 1928, 1918, 1925, 1966, 1933, 1922, 1930, 1968,
- /*   600 */  1976, 1983, 1986, 1987, 1988, 1908, 1905, 1953, 1967, 1992,
- /*   610 */  1956, 1958, 1960, 1962, 1963, 1969, 1979, 1981, 1961, 1970,
- /*   620 */  1984, 1990, 1991, 1993, 2005, 1998, 2023, 2002, 1972, 2028,
- /*   630 */  2007, 1996, 2034, 2035, 2036, 2000, 2039, 2004, 2042, 2022,
- /*   640 */  2025, 2009, 2010, 2012, 1944, 1946, 2053, 1912, 1948, 1850,
- /*   650 */  1888, 2013, 2058, 1914, 2024, 2037, 2063, 1862, 2043, 1932,
- /*   660 */  1935, 2066, 2067, 1949, 1943, 1954, 1955, 2065, 2038, 1796,
- /*   670 */  1971, 1973, 1975, 2019, 1974, 2026, 2006, 1994, 2040, 2050,
- /*   680 */  2003, 1989, 2029, 2030, 2008, 2061, 2049, 2051, 2032, 2079,
- /*   690 */  1801, 2011, 2027, 2127, 2098, 1871, 2095, 2103, 2105, 2106,
- /*   700 */  2107, 2109, 2041, 2044, 2100, 1910, 2114, 2101, 2152, 2153,
- /*   710 */  2048, 2115, 2052, 2054, 2055, 2057, 2060, 1985, 2064, 2156,
- /*   720 */  2117, 1995, 2068, 2056, 1888, 2123, 2131, 2069, 1940, 2071,
- /*   730 */  2178, 2160, 1959, 2077, 2086, 2089, 2090, 2092, 2093, 2147,
- /*   740 */  2096, 2099, 2154, 2094, 2182, 1997, 2104, 2091, 2102, 2169,
- /*   750 */  2176, 2118, 2116, 2188, 2120, 2121, 2190, 2124, 2122, 2196,
- /*   760 */  2130, 2134, 2201, 2136, 2137, 2206, 2141, 2119, 2126, 2128,
- /*   770 */  2132, 2142, 2216, 2145, 2220, 2155, 2216, 2216, 2236, 2189,
- /*   780 */  2192, 2227, 2228, 2229, 2230, 2234, 2235, 2237, 2248, 2250,
- /*   790 */  2193, 2191, 2212, 2194, 2262, 2261, 2268, 2270, 2286, 2273,
- /*   800 */  2275, 2277, 2238, 1961, 2280, 1970, 2281, 2283, 2284, 2295,
- /*   810 */  2306, 2296, 2313, 2298, 2285, 2303, 2346, 2310, 2297, 2309,
- /*   820 */  2352, 2317, 2304, 2322, 2366, 2330, 2318, 2326, 2370, 2335,
- /*   830 */  2336, 2374, 2353, 2343, 2355, 2358, 2359, 2360, 2363, 2367,
+ /*     0 */   963,    0,   78,    0,  322,  322,  322,  322,  322,  322,
+ /*    10 */   322,  322,  322,  322,  322,  322,  400,  643,  643,  721,
+ /*    20 */   643,  643,  643,  643,  643,  643,  643,  643,  643,  643,
+ /*    30 */   643,  643,  643,  643,  643,  643,  643,  643,  643,  643,
+ /*    40 */   643,  643,  643,  643,  643,  643,  643,  643,  643,  643,
+ /*    50 */   643,   83,  198,  108,  199,  271,  550,  271,  271,  199,
+ /*    60 */   199,  271, 1215,  271,  884, 1215, 1215,  168,  271,   26,
+ /*    70 */   664,   76,   76,  973,  973,  664,  254,   85,  252,  252,
+ /*    80 */   211,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+ /*    90 */    76,   76,  132,  142,   76,   76,   74,   26,   76,  132,
+ /*   100 */    76,   26,   76,   76,   26,   76,   76,   26,   76,   26,
+ /*   110 */    26,   26,   26,   76,  267,   36,   36, 1040,  259,  775,
+ /*   120 */   775,  775,  775,  775,  775,  775,  775,  775,  775,  775,
+ /*   130 */   775,  775,  775,  775,  775,  775,  775,  775,  401,  686,
+ /*   140 */   254,   85,  220,  220,  544,  937,  937,  937,  910,  500,
+ /*   150 */   500, 1155,  544,   74,  343,   26,   26,  223,   26,  433,
+ /*   160 */    26,  433,  433,  487,  725,  242,  242,  242,  242,  242,
+ /*   170 */   242,  242,  242,  526, 1891,  181,  212,  467,  265,  451,
+ /*   180 */   714,  514,  668,  134,  134,  688, 1124,  996,  319,  319,
+ /*   190 */   319,  890,  319,  448,  387,  350, 1225,  595,  291,  350,
+ /*   200 */   350,  823,  989,  594, 1020,  989,  371, 1058, 1155, 1219,
+ /*   210 */  1446, 1460, 1485, 1290,   74, 1485,   74, 1313, 1509, 1515,
+ /*   220 */  1491, 1515, 1491, 1367, 1509, 1515, 1509, 1491, 1367, 1367,
+ /*   230 */  1453, 1457, 1509, 1461, 1509, 1509, 1509, 1550, 1522, 1550,
+ /*   240 */  1522, 1485,   74,   74, 1567,   74, 1572, 1573,   74, 1572,
+ /*   250 */    74, 1585,   74,   74, 1509,   74, 1550,   26,   26,   26,
+ /*   260 */    26,   26,   26,   26,   26,   26,   26,   26, 1509,  725,
+ /*   270 */   725, 1550,  433,  433,  433, 1416, 1553, 1485,  267, 1644,
+ /*   280 */  1463, 1466, 1567,  267, 1219, 1509,  433, 1396, 1398, 1396,
+ /*   290 */  1398, 1404, 1511, 1396, 1414, 1418, 1431, 1219, 1411, 1415,
+ /*   300 */  1422, 1447, 1515, 1700, 1604, 1450, 1572,  267,  267, 1398,
+ /*   310 */   433,  433,  433,  433, 1398,  433, 1575,  267,  487,  267,
+ /*   320 */  1515, 1662, 1667,  433, 1509,  267, 1756, 1758, 1550, 2994,
+ /*   330 */  2994, 2994, 2994, 2994, 2994, 2994, 2994, 2994, 1002,  636,
+ /*   340 */    57,   46,  314,  789, 1633,   59,  247,  581,  847,  661,
+ /*   350 */   807,  616,  616,  616,  616,  616,  616,  616,  616,  616,
+ /*   360 */   135,  423,    3,    3,  225,  806,  748,  332,  746,  245,
+ /*   370 */  1117,  213,   40,   40,  997,   41,  600,  997,  997,  997,
+ /*   380 */   292, 1034, 1101,  833, 1222, 1100,  236, 1150, 1152, 1156,
+ /*   390 */  1160, 1238, 1261, 1271, 1281, 1289, 1059, 1239, 1258, 1200,
+ /*   400 */  1266, 1267, 1273, 1171, 1077, 1073, 1280, 1285, 1291, 1292,
+ /*   410 */  1293, 1299, 1303, 1317, 1132, 1339, 1307, 1344, 1346, 1351,
+ /*   420 */  1365, 1370, 1373, 1391, 1220, 1300, 1314, 1408, 1443, 1352,
+ /*   430 */     1, 1803, 1813, 1815, 1771, 1817, 1781, 1593, 1783, 1784,
+ /*   440 */  1785, 1599, 1823, 1791, 1792, 1605, 1793, 1833, 1608, 1835,
+ /*   450 */  1799, 1837, 1801, 1843, 1818, 1844, 1808, 1625, 1848, 1640,
+ /*   460 */  1850, 1642, 1643, 1649, 1654, 1857, 1858, 1859, 1663, 1665,
+ /*   470 */  1862, 1863, 1715, 1820, 1821, 1867, 1845, 1877, 1881, 1874,
+ /*   480 */  1834, 1894, 1847, 1899, 1864, 1900, 1912, 1913, 1866, 1916,
+ /*   490 */  1917, 1918, 1920, 1922, 1923, 1761, 1890, 1928, 1766, 1930,
+ /*   500 */  1931, 1932, 1933, 1934, 1935, 1936, 1938, 1940, 1941, 1943,
+ /*   510 */  1944, 1945, 1946, 1947, 1948, 1954, 1907, 1957, 1914, 1958,
+ /*   520 */  1961, 1972, 1974, 1975, 1976, 1979, 1960, 1980, 1816, 1992,
+ /*   530 */  1846, 1993, 1851, 1999, 2001, 1981, 1956, 1985, 1959, 2008,
+ /*   540 */  1949, 1973, 2011, 1950, 2015, 1952, 2018, 2020, 1986, 1970,
+ /*   550 */  1983, 2022, 1989, 1977, 1988, 2027, 1994, 1982, 1995, 2034,
+ /*   560 */  1998, 2040, 1996, 2000, 2012, 2006, 2010, 2030, 2013, 2047,
+ /*   570 */  2005, 2021, 2057, 2060, 2070, 2072, 2033, 1884, 2078, 2006,
+ /*   580 */  2042, 2079, 2089, 2023, 2092, 2093, 2059, 2048, 2056, 2101,
+ /*   590 */  2065, 2052, 2062, 2105, 2069, 2058, 2066, 2107, 2074, 2061,
+ /*   600 */  2071, 2115, 2116, 2117, 2118, 2119, 2120, 2007, 2016, 2084,
+ /*   610 */  2102, 2125, 2094, 2095, 2096, 2097, 2104, 2099, 2103, 2106,
+ /*   620 */  2108, 2109, 2111, 2110, 2112, 2124, 2114, 2130, 2126, 2139,
+ /*   630 */  2131, 2088, 2154, 2134, 2121, 2157, 2159, 2160, 2127, 2161,
+ /*   640 */  2128, 2162, 2141, 2146, 2133, 2135, 2136, 2063, 2067, 2175,
+ /*   650 */  1987, 2073, 1969, 2006, 2129, 2181, 2009, 2151, 2171, 2195,
+ /*   660 */  2002, 2174, 2028, 2019, 2210, 2212, 2032, 2035, 2041, 2037,
+ /*   670 */  2223, 2194, 1953, 2123, 2132, 2137, 2178, 2138, 2182, 2143,
+ /*   680 */  2144, 2198, 2201, 2145, 2142, 2147, 2148, 2149, 2202, 2187,
+ /*   690 */  2189, 2152, 2206, 1966, 2150, 2153, 2238, 2218, 1990, 2219,
+ /*   700 */  2227, 2230, 2231, 2232, 2233, 2163, 2164, 2224, 2014, 2241,
+ /*   710 */  2226, 2276, 2278, 2173, 2239, 2177, 2179, 2180, 2183, 2191,
+ /*   720 */  2100, 2193, 2282, 2260, 2140, 2199, 2197, 2006, 2266, 2283,
+ /*   730 */  2214, 2064, 2217, 2330, 2311, 2113, 2228, 2229, 2234, 2235,
+ /*   740 */  2249, 2237, 2285, 2252, 2253, 2289, 2240, 2317, 2156, 2254,
+ /*   750 */  2245, 2255, 2303, 2305, 2257, 2258, 2328, 2262, 2259, 2331,
+ /*   760 */  2264, 2265, 2337, 2268, 2270, 2339, 2272, 2273, 2343, 2275,
+ /*   770 */  2256, 2267, 2269, 2271, 2279, 2350, 2280, 2281, 2348, 2286,
+ /*   780 */  2350, 2350, 2368, 2323, 2326, 2361, 2378, 2364, 2365, 2367,
+ /*   790 */  2369, 2370, 2371, 2372, 2373, 2335, 2304, 2336, 2314, 2392,
+ /*   800 */  2386, 2389, 2391, 2405, 2394, 2395, 2398, 2352, 2109, 2408,
+ /*   810 */  2111, 2409, 2411, 2412, 2413, 2420, 2414, 2452, 2416, 2403,
+ /*   820 */  2415, 2455, 2422, 2410, 2418, 2462, 2426, 2417, 2423, 2464,
+ /*   830 */  2429, 2419, 2425, 2469, 2434, 2435, 2473, 2454, 2441, 2456,
+ /*   840 */  2458, 2459, 2460, 2463, 2457,
 };
-#define YY_REDUCE_COUNT (336)
-#define YY_REDUCE_MIN   (-430)
-#define YY_REDUCE_MAX   (2613)
+#define YY_REDUCE_COUNT (337)
+#define YY_REDUCE_MIN   (-476)
+#define YY_REDUCE_MAX   (2534)
 static const short yy_reduce_ofst[] = {
- /*     0 */   431, -303,  149,  185,  -23,  390,  421,  630,  662,  872,
- /*    10 */   967, 1150, 1276, 1310, 1384, 1418,  488,  -81, 1451, 1527,
- /*    20 */  1557, 1635, 1652, 1669, 1734, 1764, 1829, 1849, 1872, 1887,
- /*    30 */  1906, 1980, 1999, 2015, 2073, 2097, 2140, 2166, 2209, 2233,
- /*    40 */  2276, 2291, 2307, 2384, 2403, 2419, 2477, 2501, 2544, 2570,
- /*    50 */  2613, -305, -202,  384, -187,   31,  451,  558,  660,  541,
- /*    60 */   707,  763,  643, -340, -341,  -99,  228, -177,   89, -380,
- /*    70 */  -211,  401,  403, -356, -351, -390, -330, -333, -257,  140,
- /*    80 */  -218,  412,  487,  619,  628, -312, -225,  634,  669,  681,
- /*    90 */   696,  -97,  179,   -2,  739,  793, -284,  250,  642,  187,
- /*   100 */   809,  354,  858,  882, -383,  892,  894,  425,  896,  522,
- /*   110 */   455,  620,  905,  -66, -425, -425, -296, -149,   35,  159,
- /*   120 */   182,  397,  452,  485,  534,  638,  722,  820,  843,  844,
- /*   130 */   849,  886,  898,  900,  901,  929,  930,  -61, -270, -245,
- /*   140 */  -342,  278,  429,  632, -270,  206,  350,   12,  531,  698,
- /*   150 */   751,  761,  509,  670,  520,  776, -307,  313,  765,  782,
- /*   160 */   869,  885,  906,  941, -385,  291,  347,  395,  419,  440,
- /*   170 */   478,  419, -430,  686,  754,  870,  857,  855, 1005,  887,
- /*   180 */   982,  982,  999, 1007,  979, 1047,  993,  918,  919,  921,
- /*   190 */   998,  922,  982, 1060, 1009, 1064, 1057, 1031, 1053, 1055,
- /*   200 */   982,  985,  985,  977,  985, 1011, 1004, 1106, 1062, 1045,
- /*   210 */  1048, 1061, 1054, 1130, 1065, 1131, 1076, 1144, 1149, 1104,
- /*   220 */  1152, 1105, 1109, 1158, 1159, 1161, 1113, 1112, 1118, 1154,
- /*   230 */  1157, 1170, 1162, 1172, 1174, 1175, 1185, 1183, 1188, 1186,
- /*   240 */  1108, 1173, 1176, 1145, 1180, 1190, 1133, 1189, 1195, 1191,
- /*   250 */  1146, 1193, 1196, 1204, 1197, 1214, 1192, 1194, 1198, 1199,
- /*   260 */  1200, 1201, 1202, 1205, 1207, 1208, 1215, 1218, 1224, 1226,
- /*   270 */  1223, 1178, 1179, 1181, 1153, 1168, 1171, 1241, 1209, 1182,
- /*   280 */  1210, 1211, 1251, 1213, 1259, 1219, 1137, 1220, 1140, 1221,
- /*   290 */  1139, 1142, 1156, 1151, 1147, 1164, 1222, 1148, 1160, 1166,
- /*   300 */   985, 1291, 1227, 1177, 1212, 1311, 1305, 1308, 1257, 1277,
- /*   310 */  1279, 1280, 1282, 1263, 1283, 1271, 1321, 1302, 1322, 1330,
- /*   320 */  1228, 1303, 1294, 1337, 1334, 1350, 1349, 1351, 1284, 1268,
- /*   330 */  1286, 1287, 1327, 1336, 1339, 1346, 1387,
+ /*     0 */   -81, -296,   65,  320,  759,  831,  889,  956,  987, 1030,
+ /*    10 */  1067, 1125, 1162, 1192, 1278, 1309, -327,   38,  347, 1336,
+ /*    20 */  1419, 1434, 1449, 1514, 1532, 1597, 1612, 1631, 1730, 1745,
+ /*    30 */  1762, 1840, 1855, 1872, 1898, 1965, 1984, 2051, 2082, 2168,
+ /*    40 */  2188, 2203, 2225, 2246, 2261, 2318, 2354, 2390, 2476, 2498,
+ /*    50 */  2534,  -94,  336,  110, -338, -305,  829,  886, 1047, -358,
+ /*    60 */   509, 1176,  321, -476, -317,  333,  356, -312,  186,  431,
+ /*    70 */  -386, -200,   24, -359, -329, -209, -352,   -5, -252,   72,
+ /*    80 */   227,  -26,  121,  339,  346,  248,  354,  473,  552,  569,
+ /*    90 */   630,  398,   61,  238,  634,  641,  349,  146,  739,  139,
+ /*   100 */   743,  301,  751,  764, -291,  778,  781,  324,  785,  671,
+ /*   110 */   360,  589,  672,  795,  767, -459, -459, -178,  -44,  310,
+ /*   120 */   316,  413,  443,  658,  663,  700,  717,  765,  792,  799,
+ /*   130 */   801,  815,  821,  828,  830,  835,  837,  838,  547,  107,
+ /*   140 */   123, -396,  502,  536, -347,  107,  131,  215, -295,  318,
+ /*   150 */   559,  558,  648,  306,  810, -269,   81,  716,  783,  798,
+ /*   160 */   793,  805,  817,  858,  893,  519,  606,  673,  747,  852,
+ /*   170 */   923,  926,  852,  425,  888,  977,  922,  849,  861,  994,
+ /*   180 */   878,  980,  980,  995, 1006,  952, 1015,  965,  900,  908,
+ /*   190 */   921, 1001,  934,  980, 1063, 1016, 1085, 1051, 1003, 1043,
+ /*   200 */  1052,  980,  991,  991,  968,  991, 1019, 1005, 1109, 1066,
+ /*   210 */  1050, 1057, 1068, 1062, 1136, 1070, 1138, 1084, 1170, 1174,
+ /*   220 */  1126, 1177, 1127, 1137, 1179, 1184, 1186, 1139, 1143, 1145,
+ /*   230 */  1182, 1185, 1198, 1189, 1201, 1202, 1204, 1216, 1214, 1226,
+ /*   240 */  1227, 1146, 1203, 1217, 1187, 1228, 1232, 1172, 1230, 1234,
+ /*   250 */  1233, 1188, 1237, 1240, 1243, 1247, 1255, 1229, 1231, 1236,
+ /*   260 */  1241, 1242, 1246, 1249, 1257, 1260, 1262, 1263, 1259, 1270,
+ /*   270 */  1272, 1274, 1235, 1254, 1264, 1221, 1224, 1250, 1296, 1248,
+ /*   280 */  1245, 1253, 1279, 1302, 1265, 1315, 1287, 1206, 1275, 1207,
+ /*   290 */  1276, 1208, 1213, 1218, 1223, 1251, 1268, 1283, 1209, 1210,
+ /*   300 */  1244,  991, 1354, 1277, 1252, 1269, 1357, 1355, 1369, 1322,
+ /*   310 */  1320, 1342, 1345, 1347, 1330, 1362, 1337, 1386, 1371, 1399,
+ /*   320 */  1407, 1304, 1379, 1372, 1417, 1412, 1433, 1436, 1440, 1366,
+ /*   330 */  1359, 1380, 1381, 1421, 1423, 1424, 1437, 1456,
 };
 static const YYACTIONTYPE yy_default[] = {
- /*     0 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*    10 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*    20 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*    30 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*    40 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*    50 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*    60 */  1884, 2219, 1884, 1884, 2182, 1884, 1884, 1884, 1884, 1884,
- /*    70 */  1884, 1884, 1884, 1884, 1884, 1884, 2189, 1884, 1884, 1884,
- /*    80 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*    90 */  1884, 1884, 1884, 1884, 1884, 1884, 1981, 1884, 1884, 1884,
- /*   100 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   110 */  1884, 1884, 1884, 1979, 2422, 1884, 1884, 1884, 1884, 1884,
- /*   120 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   130 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 2434, 1884,
- /*   140 */  1884, 1955, 1955, 1884, 2434, 2434, 2434, 1979, 2394, 2394,
- /*   150 */  1884, 1884, 1981, 2257, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   160 */  1884, 1884, 2104, 1914, 1884, 1884, 1884, 1884, 2128, 1884,
- /*   170 */  1884, 1884, 2245, 1884, 1884, 2463, 2523, 1884, 1884, 2466,
- /*   180 */  1884, 1884, 1884, 1884, 2194, 1884, 2453, 1884, 1884, 1884,
- /*   190 */  1884, 1884, 1884, 1884, 1884, 1884, 2057, 2239, 1884, 1884,
- /*   200 */  1884, 2426, 2440, 2507, 2427, 2424, 2447, 1884, 2457, 1884,
- /*   210 */  2282, 1884, 2271, 1981, 1884, 1981, 2232, 2177, 1884, 2187,
- /*   220 */  1884, 2187, 2184, 1884, 1884, 1884, 2187, 2184, 2184, 2046,
- /*   230 */  2042, 1884, 2040, 1884, 1884, 1884, 1884, 1939, 1884, 1939,
- /*   240 */  1884, 1981, 1981, 1884, 1981, 1884, 1884, 1981, 1884, 1981,
- /*   250 */  1884, 1981, 1981, 1884, 1981, 1884, 1884, 1884, 1884, 1884,
- /*   260 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   270 */  1884, 1884, 1884, 1884, 2269, 2255, 1884, 1979, 1884, 2243,
- /*   280 */  2241, 1884, 1979, 2457, 1884, 1884, 2477, 2472, 2477, 2472,
- /*   290 */  2491, 2487, 2477, 2496, 2493, 2459, 2457, 2526, 2513, 2509,
- /*   300 */  2440, 1884, 1884, 2445, 2443, 1884, 1979, 1979, 2472, 1884,
- /*   310 */  1884, 1884, 1884, 2472, 1884, 1884, 1979, 1884, 1979, 1884,
- /*   320 */  1884, 2073, 1884, 1884, 1979, 1884, 1923, 1884, 2234, 2260,
- /*   330 */  2215, 2215, 2107, 2107, 2107, 1982, 1889, 1884, 1884, 1884,
- /*   340 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 2490,
- /*   350 */  2489, 2347, 1884, 2398, 2397, 2396, 2387, 2346, 2069, 1884,
- /*   360 */  1884, 2345, 2344, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   370 */  1884, 2206, 2205, 2338, 1884, 1884, 2339, 2337, 2336, 1884,
- /*   380 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   390 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   400 */  1884, 1884, 1884, 2510, 2514, 1884, 1884, 1884, 1884, 1884,
- /*   410 */  1884, 2423, 1884, 1884, 1884, 2318, 1884, 1884, 1884, 1884,
- /*   420 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   430 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   440 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   450 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   460 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   470 */  2183, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   480 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   490 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   500 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   510 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   520 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   530 */  2198, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   540 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   550 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   560 */  1884, 1884, 1928, 2325, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   570 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 2328, 1884, 1884,
- /*   580 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   590 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   600 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   610 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 2021, 2020,
- /*   620 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   630 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   640 */  1884, 1884, 1884, 1884, 2329, 1884, 1884, 1884, 1884, 1884,
- /*   650 */  2320, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   660 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 2506, 2460, 1884,
- /*   670 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   680 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 2318, 1884, 2488,
- /*   690 */  1884, 1884, 2504, 1884, 2508, 1884, 1884, 1884, 1884, 1884,
- /*   700 */  1884, 1884, 2433, 2429, 1884, 1884, 2425, 1884, 1884, 1884,
- /*   710 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   720 */  1884, 1884, 1884, 1884, 2317, 1884, 2384, 1884, 1884, 1884,
- /*   730 */  2418, 1884, 1884, 2369, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   740 */  1884, 1884, 1884, 2329, 1884, 2332, 1884, 1884, 1884, 1884,
- /*   750 */  1884, 2101, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   760 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 2085, 2083, 2082,
- /*   770 */  2081, 1884, 2114, 1884, 1884, 1884, 2110, 2109, 1884, 1884,
- /*   780 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   790 */  1884, 1884, 1884, 1884, 2000, 1884, 1884, 1884, 1884, 1884,
- /*   800 */  1884, 1884, 1884, 1992, 1884, 1991, 1884, 1884, 1884, 1884,
- /*   810 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   820 */  1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884, 1884,
- /*   830 */  1884, 1884, 1884, 1913, 1884, 1884, 1884, 1884, 1884, 1884,
+ /*     0 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*    10 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*    20 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*    30 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*    40 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*    50 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*    60 */  1895, 2233, 1895, 1895, 2196, 1895, 1895, 1895, 1895, 1895,
+ /*    70 */  1895, 1895, 1895, 1895, 1895, 1895, 2203, 1895, 1895, 1895,
+ /*    80 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*    90 */  1895, 1895, 1895, 1895, 1895, 1895, 1992, 1895, 1895, 1895,
+ /*   100 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   110 */  1895, 1895, 1895, 1895, 1990, 2436, 1895, 1895, 1895, 1895,
+ /*   120 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   130 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 2448,
+ /*   140 */  1895, 1895, 1966, 1966, 1895, 2448, 2448, 2448, 1990, 2408,
+ /*   150 */  2408, 1895, 1895, 1992, 2271, 1895, 1895, 1895, 1895, 1895,
+ /*   160 */  1895, 1895, 1895, 2117, 1925, 1895, 1895, 1895, 1895, 2142,
+ /*   170 */  1895, 1895, 1895, 1895, 2259, 1895, 2477, 2537, 1895, 1895,
+ /*   180 */  2480, 1895, 1895, 1895, 1895, 2208, 1895, 2467, 1895, 1895,
+ /*   190 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 2070, 2253, 1895,
+ /*   200 */  1895, 1895, 2440, 2454, 2521, 2441, 2438, 2461, 1895, 2471,
+ /*   210 */  1895, 2296, 1895, 2285, 1992, 1895, 1992, 2246, 2191, 1895,
+ /*   220 */  2201, 1895, 2201, 2198, 1895, 1895, 1895, 2201, 2198, 2198,
+ /*   230 */  2059, 2055, 1895, 2053, 1895, 1895, 1895, 1895, 1950, 1895,
+ /*   240 */  1950, 1895, 1992, 1992, 1895, 1992, 1895, 1895, 1992, 1895,
+ /*   250 */  1992, 1895, 1992, 1992, 1895, 1992, 1895, 1895, 1895, 1895,
+ /*   260 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   270 */  1895, 1895, 1895, 1895, 1895, 2283, 2269, 1895, 1990, 1895,
+ /*   280 */  2257, 2255, 1895, 1990, 2471, 1895, 1895, 2491, 2486, 2491,
+ /*   290 */  2486, 2505, 2501, 2491, 2510, 2507, 2473, 2471, 2540, 2527,
+ /*   300 */  2523, 2454, 1895, 1895, 2459, 2457, 1895, 1990, 1990, 2486,
+ /*   310 */  1895, 1895, 1895, 1895, 2486, 1895, 1895, 1990, 1895, 1990,
+ /*   320 */  1895, 1895, 2086, 1895, 1895, 1990, 1895, 1934, 1895, 2248,
+ /*   330 */  2274, 2229, 2229, 2120, 2120, 2120, 1993, 1900, 1895, 1895,
+ /*   340 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   350 */  2082, 2504, 2503, 2361, 1895, 2412, 2411, 2410, 2401, 2360,
+ /*   360 */  1895, 1895, 2359, 2358, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   370 */  1895, 1895, 2220, 2219, 2352, 1895, 1895, 2353, 2351, 2350,
+ /*   380 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   390 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   400 */  1895, 1895, 1895, 1895, 2524, 2528, 1895, 1895, 1895, 1895,
+ /*   410 */  1895, 1895, 2437, 1895, 1895, 1895, 2332, 1895, 1895, 1895,
+ /*   420 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   430 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   440 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   450 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   460 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   470 */  1895, 1895, 2197, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   480 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   490 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   500 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   510 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   520 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   530 */  1895, 1895, 2212, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   540 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   550 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   560 */  1895, 1895, 1895, 1895, 1939, 2339, 1895, 1895, 1895, 1895,
+ /*   570 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 2342,
+ /*   580 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   590 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   600 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   610 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   620 */  1895, 2033, 2032, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   630 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   640 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 2343, 1895, 1895,
+ /*   650 */  1895, 1895, 1895, 2334, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   660 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   670 */  2520, 2474, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   680 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   690 */  2332, 1895, 2502, 1895, 1895, 2518, 1895, 2522, 1895, 1895,
+ /*   700 */  1895, 1895, 1895, 1895, 1895, 2447, 2443, 1895, 1895, 2439,
+ /*   710 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   720 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 2331, 1895, 2398,
+ /*   730 */  1895, 1895, 1895, 2432, 1895, 1895, 2383, 1895, 1895, 1895,
+ /*   740 */  1895, 1895, 1895, 1895, 1895, 1895, 2343, 1895, 2346, 1895,
+ /*   750 */  1895, 1895, 1895, 1895, 2114, 1895, 1895, 1895, 1895, 1895,
+ /*   760 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   770 */  2098, 2096, 2095, 2094, 1895, 2128, 1895, 1895, 1895, 1895,
+ /*   780 */  2123, 2122, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   790 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 2011,
+ /*   800 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 2003, 1895,
+ /*   810 */  2002, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   820 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+ /*   830 */  1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1924, 1895,
+ /*   840 */  1895, 1895, 1895, 1895, 1895,
 };
 /********** End of lemon-generated parsing tables *****************************/
 
@@ -1552,6 +1541,7 @@ static const YYCODETYPE yyFallback[] = {
     0,  /* WAL_ROLL_PERIOD => nothing */
     0,  /* WAL_SEGMENT_SIZE => nothing */
     0,  /* STT_TRIGGER => nothing */
+   20,  /* STT_MERGE_POLICY => NK_ID */
     0,  /* TABLE_PREFIX => nothing */
     0,  /* TABLE_SUFFIX => nothing */
     0,  /* KEEP_TIME_OFFSET => nothing */
@@ -1559,7 +1549,7 @@ static const YYCODETYPE yyFallback[] = {
     0,  /*    BWLIMIT => nothing */
     0,  /*      START => nothing */
     0,  /*  TIMESTAMP => nothing */
-  297,  /*        END => ABORT */
+  299,  /*        END => ABORT */
     0,  /*      TABLE => nothing */
     0,  /*      NK_LP => nothing */
     0,  /*      NK_RP => nothing */
@@ -1596,6 +1586,7 @@ static const YYCODETYPE yyFallback[] = {
     0,  /*     ROLLUP => nothing */
     0,  /*        TTL => nothing */
     0,  /*        SMA => nothing */
+   20,  /* BLOOM_FILTER => NK_ID */
     0,  /* DELETE_MARK => nothing */
     0,  /*      FIRST => nothing */
     0,  /*       LAST => nothing */
@@ -1627,7 +1618,7 @@ static const YYCODETYPE yyFallback[] = {
     0,  /*     VNODES => nothing */
     0,  /*      ALIVE => nothing */
     0,  /*      VIEWS => nothing */
-  297,  /*       VIEW => ABORT */
+  299,  /*       VIEW => ABORT */
     0,  /*   COMPACTS => nothing */
     0,  /*     NORMAL => nothing */
     0,  /*      CHILD => nothing */
@@ -1753,55 +1744,55 @@ static const YYCODETYPE yyFallback[] = {
     0,  /*        ASC => nothing */
     0,  /*      NULLS => nothing */
     0,  /*      ABORT => nothing */
-  297,  /*      AFTER => ABORT */
-  297,  /*     ATTACH => ABORT */
-  297,  /*     BEFORE => ABORT */
-  297,  /*      BEGIN => ABORT */
-  297,  /*     BITAND => ABORT */
-  297,  /*     BITNOT => ABORT */
-  297,  /*      BITOR => ABORT */
-  297,  /*     BLOCKS => ABORT */
-  297,  /*     CHANGE => ABORT */
-  297,  /*      COMMA => ABORT */
-  297,  /*     CONCAT => ABORT */
-  297,  /*   CONFLICT => ABORT */
-  297,  /*       COPY => ABORT */
-  297,  /*   DEFERRED => ABORT */
-  297,  /* DELIMITERS => ABORT */
-  297,  /*     DETACH => ABORT */
-  297,  /*     DIVIDE => ABORT */
-  297,  /*        DOT => ABORT */
-  297,  /*       EACH => ABORT */
-  297,  /*       FAIL => ABORT */
-  297,  /*       FILE => ABORT */
-  297,  /*        FOR => ABORT */
-  297,  /*       GLOB => ABORT */
-  297,  /*         ID => ABORT */
-  297,  /*  IMMEDIATE => ABORT */
-  297,  /*     IMPORT => ABORT */
-  297,  /*  INITIALLY => ABORT */
-  297,  /*    INSTEAD => ABORT */
-  297,  /*     ISNULL => ABORT */
-  297,  /*        KEY => ABORT */
-  297,  /*    MODULES => ABORT */
-  297,  /*  NK_BITNOT => ABORT */
-  297,  /*    NK_SEMI => ABORT */
-  297,  /*    NOTNULL => ABORT */
-  297,  /*         OF => ABORT */
-  297,  /*       PLUS => ABORT */
-  297,  /*  PRIVILEGE => ABORT */
-  297,  /*      RAISE => ABORT */
-  297,  /*   RESTRICT => ABORT */
-  297,  /*        ROW => ABORT */
-  297,  /*       SEMI => ABORT */
-  297,  /*       STAR => ABORT */
-  297,  /*  STATEMENT => ABORT */
-  297,  /*     STRICT => ABORT */
-  297,  /*     STRING => ABORT */
-  297,  /*      TIMES => ABORT */
-  297,  /*     VALUES => ABORT */
-  297,  /*   VARIABLE => ABORT */
-  297,  /*        WAL => ABORT */
+  299,  /*      AFTER => ABORT */
+  299,  /*     ATTACH => ABORT */
+  299,  /*     BEFORE => ABORT */
+  299,  /*      BEGIN => ABORT */
+  299,  /*     BITAND => ABORT */
+  299,  /*     BITNOT => ABORT */
+  299,  /*      BITOR => ABORT */
+  299,  /*     BLOCKS => ABORT */
+  299,  /*     CHANGE => ABORT */
+  299,  /*      COMMA => ABORT */
+  299,  /*     CONCAT => ABORT */
+  299,  /*   CONFLICT => ABORT */
+  299,  /*       COPY => ABORT */
+  299,  /*   DEFERRED => ABORT */
+  299,  /* DELIMITERS => ABORT */
+  299,  /*     DETACH => ABORT */
+  299,  /*     DIVIDE => ABORT */
+  299,  /*        DOT => ABORT */
+  299,  /*       EACH => ABORT */
+  299,  /*       FAIL => ABORT */
+  299,  /*       FILE => ABORT */
+  299,  /*        FOR => ABORT */
+  299,  /*       GLOB => ABORT */
+  299,  /*         ID => ABORT */
+  299,  /*  IMMEDIATE => ABORT */
+  299,  /*     IMPORT => ABORT */
+  299,  /*  INITIALLY => ABORT */
+  299,  /*    INSTEAD => ABORT */
+  299,  /*     ISNULL => ABORT */
+  299,  /*        KEY => ABORT */
+  299,  /*    MODULES => ABORT */
+  299,  /*  NK_BITNOT => ABORT */
+  299,  /*    NK_SEMI => ABORT */
+  299,  /*    NOTNULL => ABORT */
+  299,  /*         OF => ABORT */
+  299,  /*       PLUS => ABORT */
+  299,  /*  PRIVILEGE => ABORT */
+  299,  /*      RAISE => ABORT */
+  299,  /*   RESTRICT => ABORT */
+  299,  /*        ROW => ABORT */
+  299,  /*       SEMI => ABORT */
+  299,  /*       STAR => ABORT */
+  299,  /*  STATEMENT => ABORT */
+  299,  /*     STRICT => ABORT */
+  299,  /*     STRING => ABORT */
+  299,  /*      TIMES => ABORT */
+  299,  /*     VALUES => ABORT */
+  299,  /*   VARIABLE => ABORT */
+  299,  /*        WAL => ABORT */
 };
 #endif /* YYFALLBACK */
 
@@ -1987,417 +1978,419 @@ static const char *const yyTokenName[] = {
   /*   94 */ "WAL_ROLL_PERIOD",
   /*   95 */ "WAL_SEGMENT_SIZE",
   /*   96 */ "STT_TRIGGER",
-  /*   97 */ "TABLE_PREFIX",
-  /*   98 */ "TABLE_SUFFIX",
-  /*   99 */ "KEEP_TIME_OFFSET",
-  /*  100 */ "NK_COLON",
-  /*  101 */ "BWLIMIT",
-  /*  102 */ "START",
-  /*  103 */ "TIMESTAMP",
-  /*  104 */ "END",
-  /*  105 */ "TABLE",
-  /*  106 */ "NK_LP",
-  /*  107 */ "NK_RP",
-  /*  108 */ "STABLE",
-  /*  109 */ "COLUMN",
-  /*  110 */ "MODIFY",
-  /*  111 */ "RENAME",
-  /*  112 */ "TAG",
-  /*  113 */ "SET",
-  /*  114 */ "NK_EQ",
-  /*  115 */ "USING",
-  /*  116 */ "TAGS",
-  /*  117 */ "BOOL",
-  /*  118 */ "TINYINT",
-  /*  119 */ "SMALLINT",
-  /*  120 */ "INT",
-  /*  121 */ "INTEGER",
-  /*  122 */ "BIGINT",
-  /*  123 */ "FLOAT",
-  /*  124 */ "DOUBLE",
-  /*  125 */ "BINARY",
-  /*  126 */ "NCHAR",
-  /*  127 */ "UNSIGNED",
-  /*  128 */ "JSON",
-  /*  129 */ "VARCHAR",
-  /*  130 */ "MEDIUMBLOB",
-  /*  131 */ "BLOB",
-  /*  132 */ "VARBINARY",
-  /*  133 */ "GEOMETRY",
-  /*  134 */ "DECIMAL",
-  /*  135 */ "COMMENT",
-  /*  136 */ "MAX_DELAY",
-  /*  137 */ "WATERMARK",
-  /*  138 */ "ROLLUP",
-  /*  139 */ "TTL",
-  /*  140 */ "SMA",
-  /*  141 */ "DELETE_MARK",
-  /*  142 */ "FIRST",
-  /*  143 */ "LAST",
-  /*  144 */ "SHOW",
-  /*  145 */ "PRIVILEGES",
-  /*  146 */ "DATABASES",
-  /*  147 */ "TABLES",
-  /*  148 */ "STABLES",
-  /*  149 */ "MNODES",
-  /*  150 */ "QNODES",
-  /*  151 */ "FUNCTIONS",
-  /*  152 */ "INDEXES",
-  /*  153 */ "ACCOUNTS",
-  /*  154 */ "APPS",
-  /*  155 */ "CONNECTIONS",
-  /*  156 */ "LICENCES",
-  /*  157 */ "GRANTS",
-  /*  158 */ "QUERIES",
-  /*  159 */ "SCORES",
-  /*  160 */ "TOPICS",
-  /*  161 */ "VARIABLES",
-  /*  162 */ "CLUSTER",
-  /*  163 */ "BNODES",
-  /*  164 */ "SNODES",
-  /*  165 */ "TRANSACTIONS",
-  /*  166 */ "DISTRIBUTED",
-  /*  167 */ "CONSUMERS",
-  /*  168 */ "SUBSCRIPTIONS",
-  /*  169 */ "VNODES",
-  /*  170 */ "ALIVE",
-  /*  171 */ "VIEWS",
-  /*  172 */ "VIEW",
-  /*  173 */ "COMPACTS",
-  /*  174 */ "NORMAL",
-  /*  175 */ "CHILD",
-  /*  176 */ "LIKE",
-  /*  177 */ "TBNAME",
-  /*  178 */ "QTAGS",
-  /*  179 */ "AS",
-  /*  180 */ "SYSTEM",
-  /*  181 */ "INDEX",
-  /*  182 */ "FUNCTION",
-  /*  183 */ "INTERVAL",
-  /*  184 */ "COUNT",
-  /*  185 */ "LAST_ROW",
-  /*  186 */ "META",
-  /*  187 */ "ONLY",
-  /*  188 */ "TOPIC",
-  /*  189 */ "CONSUMER",
-  /*  190 */ "GROUP",
-  /*  191 */ "DESC",
-  /*  192 */ "DESCRIBE",
-  /*  193 */ "RESET",
-  /*  194 */ "QUERY",
-  /*  195 */ "CACHE",
-  /*  196 */ "EXPLAIN",
-  /*  197 */ "ANALYZE",
-  /*  198 */ "VERBOSE",
-  /*  199 */ "NK_BOOL",
-  /*  200 */ "RATIO",
-  /*  201 */ "NK_FLOAT",
-  /*  202 */ "OUTPUTTYPE",
-  /*  203 */ "AGGREGATE",
-  /*  204 */ "BUFSIZE",
-  /*  205 */ "LANGUAGE",
-  /*  206 */ "REPLACE",
-  /*  207 */ "STREAM",
-  /*  208 */ "INTO",
-  /*  209 */ "PAUSE",
-  /*  210 */ "RESUME",
-  /*  211 */ "TRIGGER",
-  /*  212 */ "AT_ONCE",
-  /*  213 */ "WINDOW_CLOSE",
-  /*  214 */ "IGNORE",
-  /*  215 */ "EXPIRED",
-  /*  216 */ "FILL_HISTORY",
-  /*  217 */ "UPDATE",
-  /*  218 */ "SUBTABLE",
-  /*  219 */ "UNTREATED",
-  /*  220 */ "KILL",
-  /*  221 */ "CONNECTION",
-  /*  222 */ "TRANSACTION",
-  /*  223 */ "BALANCE",
-  /*  224 */ "VGROUP",
-  /*  225 */ "LEADER",
-  /*  226 */ "MERGE",
-  /*  227 */ "REDISTRIBUTE",
-  /*  228 */ "SPLIT",
-  /*  229 */ "DELETE",
-  /*  230 */ "INSERT",
-  /*  231 */ "NULL",
-  /*  232 */ "NK_QUESTION",
-  /*  233 */ "NK_ALIAS",
-  /*  234 */ "NK_ARROW",
-  /*  235 */ "ROWTS",
-  /*  236 */ "QSTART",
-  /*  237 */ "QEND",
-  /*  238 */ "QDURATION",
-  /*  239 */ "WSTART",
-  /*  240 */ "WEND",
-  /*  241 */ "WDURATION",
-  /*  242 */ "IROWTS",
-  /*  243 */ "ISFILLED",
-  /*  244 */ "CAST",
-  /*  245 */ "NOW",
-  /*  246 */ "TODAY",
-  /*  247 */ "TIMEZONE",
-  /*  248 */ "CLIENT_VERSION",
-  /*  249 */ "SERVER_VERSION",
-  /*  250 */ "SERVER_STATUS",
-  /*  251 */ "CURRENT_USER",
-  /*  252 */ "CASE",
-  /*  253 */ "WHEN",
-  /*  254 */ "THEN",
-  /*  255 */ "ELSE",
-  /*  256 */ "BETWEEN",
-  /*  257 */ "IS",
-  /*  258 */ "NK_LT",
-  /*  259 */ "NK_GT",
-  /*  260 */ "NK_LE",
-  /*  261 */ "NK_GE",
-  /*  262 */ "NK_NE",
-  /*  263 */ "MATCH",
-  /*  264 */ "NMATCH",
-  /*  265 */ "CONTAINS",
-  /*  266 */ "IN",
-  /*  267 */ "JOIN",
-  /*  268 */ "INNER",
-  /*  269 */ "SELECT",
-  /*  270 */ "NK_HINT",
-  /*  271 */ "DISTINCT",
-  /*  272 */ "WHERE",
-  /*  273 */ "PARTITION",
-  /*  274 */ "BY",
-  /*  275 */ "SESSION",
-  /*  276 */ "STATE_WINDOW",
-  /*  277 */ "EVENT_WINDOW",
-  /*  278 */ "SLIDING",
-  /*  279 */ "FILL",
-  /*  280 */ "VALUE",
-  /*  281 */ "VALUE_F",
-  /*  282 */ "NONE",
-  /*  283 */ "PREV",
-  /*  284 */ "NULL_F",
-  /*  285 */ "LINEAR",
-  /*  286 */ "NEXT",
-  /*  287 */ "HAVING",
-  /*  288 */ "RANGE",
-  /*  289 */ "EVERY",
-  /*  290 */ "ORDER",
-  /*  291 */ "SLIMIT",
-  /*  292 */ "SOFFSET",
-  /*  293 */ "LIMIT",
-  /*  294 */ "OFFSET",
-  /*  295 */ "ASC",
-  /*  296 */ "NULLS",
-  /*  297 */ "ABORT",
-  /*  298 */ "AFTER",
-  /*  299 */ "ATTACH",
-  /*  300 */ "BEFORE",
-  /*  301 */ "BEGIN",
-  /*  302 */ "BITAND",
-  /*  303 */ "BITNOT",
-  /*  304 */ "BITOR",
-  /*  305 */ "BLOCKS",
-  /*  306 */ "CHANGE",
-  /*  307 */ "COMMA",
-  /*  308 */ "CONCAT",
-  /*  309 */ "CONFLICT",
-  /*  310 */ "COPY",
-  /*  311 */ "DEFERRED",
-  /*  312 */ "DELIMITERS",
-  /*  313 */ "DETACH",
-  /*  314 */ "DIVIDE",
-  /*  315 */ "DOT",
-  /*  316 */ "EACH",
-  /*  317 */ "FAIL",
-  /*  318 */ "FILE",
-  /*  319 */ "FOR",
-  /*  320 */ "GLOB",
-  /*  321 */ "ID",
-  /*  322 */ "IMMEDIATE",
-  /*  323 */ "IMPORT",
-  /*  324 */ "INITIALLY",
-  /*  325 */ "INSTEAD",
-  /*  326 */ "ISNULL",
-  /*  327 */ "KEY",
-  /*  328 */ "MODULES",
-  /*  329 */ "NK_BITNOT",
-  /*  330 */ "NK_SEMI",
-  /*  331 */ "NOTNULL",
-  /*  332 */ "OF",
-  /*  333 */ "PLUS",
-  /*  334 */ "PRIVILEGE",
-  /*  335 */ "RAISE",
-  /*  336 */ "RESTRICT",
-  /*  337 */ "ROW",
-  /*  338 */ "SEMI",
-  /*  339 */ "STAR",
-  /*  340 */ "STATEMENT",
-  /*  341 */ "STRICT",
-  /*  342 */ "STRING",
-  /*  343 */ "TIMES",
-  /*  344 */ "VALUES",
-  /*  345 */ "VARIABLE",
-  /*  346 */ "WAL",
-  /*  347 */ "cmd",
-  /*  348 */ "account_options",
-  /*  349 */ "alter_account_options",
-  /*  350 */ "literal",
-  /*  351 */ "alter_account_option",
-  /*  352 */ "ip_range_list",
-  /*  353 */ "white_list",
-  /*  354 */ "white_list_opt",
-  /*  355 */ "user_name",
-  /*  356 */ "sysinfo_opt",
-  /*  357 */ "privileges",
-  /*  358 */ "priv_level",
-  /*  359 */ "with_opt",
-  /*  360 */ "priv_type_list",
-  /*  361 */ "priv_type",
-  /*  362 */ "db_name",
-  /*  363 */ "table_name",
-  /*  364 */ "topic_name",
-  /*  365 */ "search_condition",
-  /*  366 */ "dnode_endpoint",
-  /*  367 */ "force_opt",
-  /*  368 */ "unsafe_opt",
-  /*  369 */ "not_exists_opt",
-  /*  370 */ "db_options",
-  /*  371 */ "exists_opt",
-  /*  372 */ "alter_db_options",
-  /*  373 */ "speed_opt",
-  /*  374 */ "start_opt",
-  /*  375 */ "end_opt",
-  /*  376 */ "integer_list",
-  /*  377 */ "variable_list",
-  /*  378 */ "retention_list",
-  /*  379 */ "signed",
-  /*  380 */ "alter_db_option",
-  /*  381 */ "retention",
-  /*  382 */ "full_table_name",
-  /*  383 */ "column_def_list",
-  /*  384 */ "tags_def_opt",
-  /*  385 */ "table_options",
-  /*  386 */ "multi_create_clause",
-  /*  387 */ "tags_def",
-  /*  388 */ "multi_drop_clause",
-  /*  389 */ "alter_table_clause",
-  /*  390 */ "alter_table_options",
-  /*  391 */ "column_name",
-  /*  392 */ "type_name",
-  /*  393 */ "signed_literal",
-  /*  394 */ "create_subtable_clause",
-  /*  395 */ "specific_cols_opt",
-  /*  396 */ "expression_list",
-  /*  397 */ "drop_table_clause",
-  /*  398 */ "col_name_list",
-  /*  399 */ "column_def",
-  /*  400 */ "duration_list",
-  /*  401 */ "rollup_func_list",
-  /*  402 */ "alter_table_option",
-  /*  403 */ "duration_literal",
-  /*  404 */ "rollup_func_name",
-  /*  405 */ "function_name",
-  /*  406 */ "col_name",
-  /*  407 */ "db_kind_opt",
-  /*  408 */ "table_kind_db_name_cond_opt",
-  /*  409 */ "like_pattern_opt",
-  /*  410 */ "db_name_cond_opt",
-  /*  411 */ "table_name_cond",
-  /*  412 */ "from_db_opt",
-  /*  413 */ "tag_list_opt",
-  /*  414 */ "table_kind",
-  /*  415 */ "tag_item",
-  /*  416 */ "column_alias",
-  /*  417 */ "index_options",
-  /*  418 */ "full_index_name",
-  /*  419 */ "index_name",
-  /*  420 */ "func_list",
-  /*  421 */ "sliding_opt",
-  /*  422 */ "sma_stream_opt",
-  /*  423 */ "func",
-  /*  424 */ "sma_func_name",
-  /*  425 */ "with_meta",
-  /*  426 */ "query_or_subquery",
-  /*  427 */ "where_clause_opt",
-  /*  428 */ "cgroup_name",
-  /*  429 */ "analyze_opt",
-  /*  430 */ "explain_options",
-  /*  431 */ "insert_query",
-  /*  432 */ "or_replace_opt",
-  /*  433 */ "agg_func_opt",
-  /*  434 */ "bufsize_opt",
-  /*  435 */ "language_opt",
-  /*  436 */ "full_view_name",
-  /*  437 */ "view_name",
-  /*  438 */ "stream_name",
-  /*  439 */ "stream_options",
-  /*  440 */ "col_list_opt",
-  /*  441 */ "tag_def_or_ref_opt",
-  /*  442 */ "subtable_opt",
-  /*  443 */ "ignore_opt",
-  /*  444 */ "expression",
-  /*  445 */ "on_vgroup_id",
-  /*  446 */ "dnode_list",
-  /*  447 */ "literal_func",
-  /*  448 */ "literal_list",
-  /*  449 */ "table_alias",
-  /*  450 */ "expr_or_subquery",
-  /*  451 */ "pseudo_column",
-  /*  452 */ "column_reference",
-  /*  453 */ "function_expression",
-  /*  454 */ "case_when_expression",
-  /*  455 */ "star_func",
-  /*  456 */ "star_func_para_list",
-  /*  457 */ "noarg_func",
-  /*  458 */ "other_para_list",
-  /*  459 */ "star_func_para",
-  /*  460 */ "when_then_list",
-  /*  461 */ "case_when_else_opt",
-  /*  462 */ "common_expression",
-  /*  463 */ "when_then_expr",
-  /*  464 */ "predicate",
-  /*  465 */ "compare_op",
-  /*  466 */ "in_op",
-  /*  467 */ "in_predicate_value",
-  /*  468 */ "boolean_value_expression",
-  /*  469 */ "boolean_primary",
-  /*  470 */ "from_clause_opt",
-  /*  471 */ "table_reference_list",
-  /*  472 */ "table_reference",
-  /*  473 */ "table_primary",
-  /*  474 */ "joined_table",
-  /*  475 */ "alias_opt",
-  /*  476 */ "subquery",
-  /*  477 */ "parenthesized_joined_table",
-  /*  478 */ "join_type",
-  /*  479 */ "query_specification",
-  /*  480 */ "hint_list",
-  /*  481 */ "set_quantifier_opt",
-  /*  482 */ "tag_mode_opt",
-  /*  483 */ "select_list",
-  /*  484 */ "partition_by_clause_opt",
-  /*  485 */ "range_opt",
-  /*  486 */ "every_opt",
-  /*  487 */ "fill_opt",
-  /*  488 */ "twindow_clause_opt",
-  /*  489 */ "group_by_clause_opt",
-  /*  490 */ "having_clause_opt",
-  /*  491 */ "select_item",
-  /*  492 */ "partition_list",
-  /*  493 */ "partition_item",
-  /*  494 */ "interval_sliding_duration_literal",
-  /*  495 */ "fill_mode",
-  /*  496 */ "group_by_list",
-  /*  497 */ "query_expression",
-  /*  498 */ "query_simple",
-  /*  499 */ "order_by_clause_opt",
-  /*  500 */ "slimit_clause_opt",
-  /*  501 */ "limit_clause_opt",
-  /*  502 */ "union_query_expression",
-  /*  503 */ "query_simple_or_subquery",
-  /*  504 */ "sort_specification_list",
-  /*  505 */ "sort_specification",
-  /*  506 */ "ordering_specification_opt",
-  /*  507 */ "null_ordering_opt",
+  /*   97 */ "STT_MERGE_POLICY",
+  /*   98 */ "TABLE_PREFIX",
+  /*   99 */ "TABLE_SUFFIX",
+  /*  100 */ "KEEP_TIME_OFFSET",
+  /*  101 */ "NK_COLON",
+  /*  102 */ "BWLIMIT",
+  /*  103 */ "START",
+  /*  104 */ "TIMESTAMP",
+  /*  105 */ "END",
+  /*  106 */ "TABLE",
+  /*  107 */ "NK_LP",
+  /*  108 */ "NK_RP",
+  /*  109 */ "STABLE",
+  /*  110 */ "COLUMN",
+  /*  111 */ "MODIFY",
+  /*  112 */ "RENAME",
+  /*  113 */ "TAG",
+  /*  114 */ "SET",
+  /*  115 */ "NK_EQ",
+  /*  116 */ "USING",
+  /*  117 */ "TAGS",
+  /*  118 */ "BOOL",
+  /*  119 */ "TINYINT",
+  /*  120 */ "SMALLINT",
+  /*  121 */ "INT",
+  /*  122 */ "INTEGER",
+  /*  123 */ "BIGINT",
+  /*  124 */ "FLOAT",
+  /*  125 */ "DOUBLE",
+  /*  126 */ "BINARY",
+  /*  127 */ "NCHAR",
+  /*  128 */ "UNSIGNED",
+  /*  129 */ "JSON",
+  /*  130 */ "VARCHAR",
+  /*  131 */ "MEDIUMBLOB",
+  /*  132 */ "BLOB",
+  /*  133 */ "VARBINARY",
+  /*  134 */ "GEOMETRY",
+  /*  135 */ "DECIMAL",
+  /*  136 */ "COMMENT",
+  /*  137 */ "MAX_DELAY",
+  /*  138 */ "WATERMARK",
+  /*  139 */ "ROLLUP",
+  /*  140 */ "TTL",
+  /*  141 */ "SMA",
+  /*  142 */ "BLOOM_FILTER",
+  /*  143 */ "DELETE_MARK",
+  /*  144 */ "FIRST",
+  /*  145 */ "LAST",
+  /*  146 */ "SHOW",
+  /*  147 */ "PRIVILEGES",
+  /*  148 */ "DATABASES",
+  /*  149 */ "TABLES",
+  /*  150 */ "STABLES",
+  /*  151 */ "MNODES",
+  /*  152 */ "QNODES",
+  /*  153 */ "FUNCTIONS",
+  /*  154 */ "INDEXES",
+  /*  155 */ "ACCOUNTS",
+  /*  156 */ "APPS",
+  /*  157 */ "CONNECTIONS",
+  /*  158 */ "LICENCES",
+  /*  159 */ "GRANTS",
+  /*  160 */ "QUERIES",
+  /*  161 */ "SCORES",
+  /*  162 */ "TOPICS",
+  /*  163 */ "VARIABLES",
+  /*  164 */ "CLUSTER",
+  /*  165 */ "BNODES",
+  /*  166 */ "SNODES",
+  /*  167 */ "TRANSACTIONS",
+  /*  168 */ "DISTRIBUTED",
+  /*  169 */ "CONSUMERS",
+  /*  170 */ "SUBSCRIPTIONS",
+  /*  171 */ "VNODES",
+  /*  172 */ "ALIVE",
+  /*  173 */ "VIEWS",
+  /*  174 */ "VIEW",
+  /*  175 */ "COMPACTS",
+  /*  176 */ "NORMAL",
+  /*  177 */ "CHILD",
+  /*  178 */ "LIKE",
+  /*  179 */ "TBNAME",
+  /*  180 */ "QTAGS",
+  /*  181 */ "AS",
+  /*  182 */ "SYSTEM",
+  /*  183 */ "INDEX",
+  /*  184 */ "FUNCTION",
+  /*  185 */ "INTERVAL",
+  /*  186 */ "COUNT",
+  /*  187 */ "LAST_ROW",
+  /*  188 */ "META",
+  /*  189 */ "ONLY",
+  /*  190 */ "TOPIC",
+  /*  191 */ "CONSUMER",
+  /*  192 */ "GROUP",
+  /*  193 */ "DESC",
+  /*  194 */ "DESCRIBE",
+  /*  195 */ "RESET",
+  /*  196 */ "QUERY",
+  /*  197 */ "CACHE",
+  /*  198 */ "EXPLAIN",
+  /*  199 */ "ANALYZE",
+  /*  200 */ "VERBOSE",
+  /*  201 */ "NK_BOOL",
+  /*  202 */ "RATIO",
+  /*  203 */ "NK_FLOAT",
+  /*  204 */ "OUTPUTTYPE",
+  /*  205 */ "AGGREGATE",
+  /*  206 */ "BUFSIZE",
+  /*  207 */ "LANGUAGE",
+  /*  208 */ "REPLACE",
+  /*  209 */ "STREAM",
+  /*  210 */ "INTO",
+  /*  211 */ "PAUSE",
+  /*  212 */ "RESUME",
+  /*  213 */ "TRIGGER",
+  /*  214 */ "AT_ONCE",
+  /*  215 */ "WINDOW_CLOSE",
+  /*  216 */ "IGNORE",
+  /*  217 */ "EXPIRED",
+  /*  218 */ "FILL_HISTORY",
+  /*  219 */ "UPDATE",
+  /*  220 */ "SUBTABLE",
+  /*  221 */ "UNTREATED",
+  /*  222 */ "KILL",
+  /*  223 */ "CONNECTION",
+  /*  224 */ "TRANSACTION",
+  /*  225 */ "BALANCE",
+  /*  226 */ "VGROUP",
+  /*  227 */ "LEADER",
+  /*  228 */ "MERGE",
+  /*  229 */ "REDISTRIBUTE",
+  /*  230 */ "SPLIT",
+  /*  231 */ "DELETE",
+  /*  232 */ "INSERT",
+  /*  233 */ "NULL",
+  /*  234 */ "NK_QUESTION",
+  /*  235 */ "NK_ALIAS",
+  /*  236 */ "NK_ARROW",
+  /*  237 */ "ROWTS",
+  /*  238 */ "QSTART",
+  /*  239 */ "QEND",
+  /*  240 */ "QDURATION",
+  /*  241 */ "WSTART",
+  /*  242 */ "WEND",
+  /*  243 */ "WDURATION",
+  /*  244 */ "IROWTS",
+  /*  245 */ "ISFILLED",
+  /*  246 */ "CAST",
+  /*  247 */ "NOW",
+  /*  248 */ "TODAY",
+  /*  249 */ "TIMEZONE",
+  /*  250 */ "CLIENT_VERSION",
+  /*  251 */ "SERVER_VERSION",
+  /*  252 */ "SERVER_STATUS",
+  /*  253 */ "CURRENT_USER",
+  /*  254 */ "CASE",
+  /*  255 */ "WHEN",
+  /*  256 */ "THEN",
+  /*  257 */ "ELSE",
+  /*  258 */ "BETWEEN",
+  /*  259 */ "IS",
+  /*  260 */ "NK_LT",
+  /*  261 */ "NK_GT",
+  /*  262 */ "NK_LE",
+  /*  263 */ "NK_GE",
+  /*  264 */ "NK_NE",
+  /*  265 */ "MATCH",
+  /*  266 */ "NMATCH",
+  /*  267 */ "CONTAINS",
+  /*  268 */ "IN",
+  /*  269 */ "JOIN",
+  /*  270 */ "INNER",
+  /*  271 */ "SELECT",
+  /*  272 */ "NK_HINT",
+  /*  273 */ "DISTINCT",
+  /*  274 */ "WHERE",
+  /*  275 */ "PARTITION",
+  /*  276 */ "BY",
+  /*  277 */ "SESSION",
+  /*  278 */ "STATE_WINDOW",
+  /*  279 */ "EVENT_WINDOW",
+  /*  280 */ "SLIDING",
+  /*  281 */ "FILL",
+  /*  282 */ "VALUE",
+  /*  283 */ "VALUE_F",
+  /*  284 */ "NONE",
+  /*  285 */ "PREV",
+  /*  286 */ "NULL_F",
+  /*  287 */ "LINEAR",
+  /*  288 */ "NEXT",
+  /*  289 */ "HAVING",
+  /*  290 */ "RANGE",
+  /*  291 */ "EVERY",
+  /*  292 */ "ORDER",
+  /*  293 */ "SLIMIT",
+  /*  294 */ "SOFFSET",
+  /*  295 */ "LIMIT",
+  /*  296 */ "OFFSET",
+  /*  297 */ "ASC",
+  /*  298 */ "NULLS",
+  /*  299 */ "ABORT",
+  /*  300 */ "AFTER",
+  /*  301 */ "ATTACH",
+  /*  302 */ "BEFORE",
+  /*  303 */ "BEGIN",
+  /*  304 */ "BITAND",
+  /*  305 */ "BITNOT",
+  /*  306 */ "BITOR",
+  /*  307 */ "BLOCKS",
+  /*  308 */ "CHANGE",
+  /*  309 */ "COMMA",
+  /*  310 */ "CONCAT",
+  /*  311 */ "CONFLICT",
+  /*  312 */ "COPY",
+  /*  313 */ "DEFERRED",
+  /*  314 */ "DELIMITERS",
+  /*  315 */ "DETACH",
+  /*  316 */ "DIVIDE",
+  /*  317 */ "DOT",
+  /*  318 */ "EACH",
+  /*  319 */ "FAIL",
+  /*  320 */ "FILE",
+  /*  321 */ "FOR",
+  /*  322 */ "GLOB",
+  /*  323 */ "ID",
+  /*  324 */ "IMMEDIATE",
+  /*  325 */ "IMPORT",
+  /*  326 */ "INITIALLY",
+  /*  327 */ "INSTEAD",
+  /*  328 */ "ISNULL",
+  /*  329 */ "KEY",
+  /*  330 */ "MODULES",
+  /*  331 */ "NK_BITNOT",
+  /*  332 */ "NK_SEMI",
+  /*  333 */ "NOTNULL",
+  /*  334 */ "OF",
+  /*  335 */ "PLUS",
+  /*  336 */ "PRIVILEGE",
+  /*  337 */ "RAISE",
+  /*  338 */ "RESTRICT",
+  /*  339 */ "ROW",
+  /*  340 */ "SEMI",
+  /*  341 */ "STAR",
+  /*  342 */ "STATEMENT",
+  /*  343 */ "STRICT",
+  /*  344 */ "STRING",
+  /*  345 */ "TIMES",
+  /*  346 */ "VALUES",
+  /*  347 */ "VARIABLE",
+  /*  348 */ "WAL",
+  /*  349 */ "cmd",
+  /*  350 */ "account_options",
+  /*  351 */ "alter_account_options",
+  /*  352 */ "literal",
+  /*  353 */ "alter_account_option",
+  /*  354 */ "ip_range_list",
+  /*  355 */ "white_list",
+  /*  356 */ "white_list_opt",
+  /*  357 */ "user_name",
+  /*  358 */ "sysinfo_opt",
+  /*  359 */ "privileges",
+  /*  360 */ "priv_level",
+  /*  361 */ "with_opt",
+  /*  362 */ "priv_type_list",
+  /*  363 */ "priv_type",
+  /*  364 */ "db_name",
+  /*  365 */ "table_name",
+  /*  366 */ "topic_name",
+  /*  367 */ "search_condition",
+  /*  368 */ "dnode_endpoint",
+  /*  369 */ "force_opt",
+  /*  370 */ "unsafe_opt",
+  /*  371 */ "not_exists_opt",
+  /*  372 */ "db_options",
+  /*  373 */ "exists_opt",
+  /*  374 */ "alter_db_options",
+  /*  375 */ "speed_opt",
+  /*  376 */ "start_opt",
+  /*  377 */ "end_opt",
+  /*  378 */ "integer_list",
+  /*  379 */ "variable_list",
+  /*  380 */ "retention_list",
+  /*  381 */ "signed",
+  /*  382 */ "alter_db_option",
+  /*  383 */ "retention",
+  /*  384 */ "full_table_name",
+  /*  385 */ "column_def_list",
+  /*  386 */ "tags_def_opt",
+  /*  387 */ "table_options",
+  /*  388 */ "multi_create_clause",
+  /*  389 */ "tags_def",
+  /*  390 */ "multi_drop_clause",
+  /*  391 */ "alter_table_clause",
+  /*  392 */ "alter_table_options",
+  /*  393 */ "column_name",
+  /*  394 */ "type_name",
+  /*  395 */ "signed_literal",
+  /*  396 */ "create_subtable_clause",
+  /*  397 */ "specific_cols_opt",
+  /*  398 */ "expression_list",
+  /*  399 */ "drop_table_clause",
+  /*  400 */ "col_name_list",
+  /*  401 */ "column_def",
+  /*  402 */ "duration_list",
+  /*  403 */ "rollup_func_list",
+  /*  404 */ "alter_table_option",
+  /*  405 */ "duration_literal",
+  /*  406 */ "rollup_func_name",
+  /*  407 */ "function_name",
+  /*  408 */ "col_name",
+  /*  409 */ "db_kind_opt",
+  /*  410 */ "table_kind_db_name_cond_opt",
+  /*  411 */ "like_pattern_opt",
+  /*  412 */ "db_name_cond_opt",
+  /*  413 */ "table_name_cond",
+  /*  414 */ "from_db_opt",
+  /*  415 */ "tag_list_opt",
+  /*  416 */ "table_kind",
+  /*  417 */ "tag_item",
+  /*  418 */ "column_alias",
+  /*  419 */ "index_options",
+  /*  420 */ "full_index_name",
+  /*  421 */ "index_name",
+  /*  422 */ "func_list",
+  /*  423 */ "sliding_opt",
+  /*  424 */ "sma_stream_opt",
+  /*  425 */ "func",
+  /*  426 */ "sma_func_name",
+  /*  427 */ "with_meta",
+  /*  428 */ "query_or_subquery",
+  /*  429 */ "where_clause_opt",
+  /*  430 */ "cgroup_name",
+  /*  431 */ "analyze_opt",
+  /*  432 */ "explain_options",
+  /*  433 */ "insert_query",
+  /*  434 */ "or_replace_opt",
+  /*  435 */ "agg_func_opt",
+  /*  436 */ "bufsize_opt",
+  /*  437 */ "language_opt",
+  /*  438 */ "full_view_name",
+  /*  439 */ "view_name",
+  /*  440 */ "stream_name",
+  /*  441 */ "stream_options",
+  /*  442 */ "col_list_opt",
+  /*  443 */ "tag_def_or_ref_opt",
+  /*  444 */ "subtable_opt",
+  /*  445 */ "ignore_opt",
+  /*  446 */ "expression",
+  /*  447 */ "on_vgroup_id",
+  /*  448 */ "dnode_list",
+  /*  449 */ "literal_func",
+  /*  450 */ "literal_list",
+  /*  451 */ "table_alias",
+  /*  452 */ "expr_or_subquery",
+  /*  453 */ "pseudo_column",
+  /*  454 */ "column_reference",
+  /*  455 */ "function_expression",
+  /*  456 */ "case_when_expression",
+  /*  457 */ "star_func",
+  /*  458 */ "star_func_para_list",
+  /*  459 */ "noarg_func",
+  /*  460 */ "other_para_list",
+  /*  461 */ "star_func_para",
+  /*  462 */ "when_then_list",
+  /*  463 */ "case_when_else_opt",
+  /*  464 */ "common_expression",
+  /*  465 */ "when_then_expr",
+  /*  466 */ "predicate",
+  /*  467 */ "compare_op",
+  /*  468 */ "in_op",
+  /*  469 */ "in_predicate_value",
+  /*  470 */ "boolean_value_expression",
+  /*  471 */ "boolean_primary",
+  /*  472 */ "from_clause_opt",
+  /*  473 */ "table_reference_list",
+  /*  474 */ "table_reference",
+  /*  475 */ "table_primary",
+  /*  476 */ "joined_table",
+  /*  477 */ "alias_opt",
+  /*  478 */ "subquery",
+  /*  479 */ "parenthesized_joined_table",
+  /*  480 */ "join_type",
+  /*  481 */ "query_specification",
+  /*  482 */ "hint_list",
+  /*  483 */ "set_quantifier_opt",
+  /*  484 */ "tag_mode_opt",
+  /*  485 */ "select_list",
+  /*  486 */ "partition_by_clause_opt",
+  /*  487 */ "range_opt",
+  /*  488 */ "every_opt",
+  /*  489 */ "fill_opt",
+  /*  490 */ "twindow_clause_opt",
+  /*  491 */ "group_by_clause_opt",
+  /*  492 */ "having_clause_opt",
+  /*  493 */ "select_item",
+  /*  494 */ "partition_list",
+  /*  495 */ "partition_item",
+  /*  496 */ "interval_sliding_duration_literal",
+  /*  497 */ "fill_mode",
+  /*  498 */ "group_by_list",
+  /*  499 */ "query_expression",
+  /*  500 */ "query_simple",
+  /*  501 */ "order_by_clause_opt",
+  /*  502 */ "slimit_clause_opt",
+  /*  503 */ "limit_clause_opt",
+  /*  504 */ "union_query_expression",
+  /*  505 */ "query_simple_or_subquery",
+  /*  506 */ "sort_specification_list",
+  /*  507 */ "sort_specification",
+  /*  508 */ "ordering_specification_opt",
+  /*  509 */ "null_ordering_opt",
 };
 #endif /* defined(YYCOVERAGE) || !defined(NDEBUG) */
 
@@ -2529,524 +2522,527 @@ static const char *const yyRuleName[] = {
  /* 121 */ "db_options ::= db_options WAL_ROLL_PERIOD NK_INTEGER",
  /* 122 */ "db_options ::= db_options WAL_SEGMENT_SIZE NK_INTEGER",
  /* 123 */ "db_options ::= db_options STT_TRIGGER NK_INTEGER",
- /* 124 */ "db_options ::= db_options TABLE_PREFIX signed",
- /* 125 */ "db_options ::= db_options TABLE_SUFFIX signed",
- /* 126 */ "db_options ::= db_options KEEP_TIME_OFFSET NK_INTEGER",
- /* 127 */ "alter_db_options ::= alter_db_option",
- /* 128 */ "alter_db_options ::= alter_db_options alter_db_option",
- /* 129 */ "alter_db_option ::= BUFFER NK_INTEGER",
- /* 130 */ "alter_db_option ::= CACHEMODEL NK_STRING",
- /* 131 */ "alter_db_option ::= CACHESIZE NK_INTEGER",
- /* 132 */ "alter_db_option ::= WAL_FSYNC_PERIOD NK_INTEGER",
- /* 133 */ "alter_db_option ::= KEEP integer_list",
- /* 134 */ "alter_db_option ::= KEEP variable_list",
- /* 135 */ "alter_db_option ::= PAGES NK_INTEGER",
- /* 136 */ "alter_db_option ::= REPLICA NK_INTEGER",
- /* 137 */ "alter_db_option ::= WAL_LEVEL NK_INTEGER",
- /* 138 */ "alter_db_option ::= STT_TRIGGER NK_INTEGER",
- /* 139 */ "alter_db_option ::= MINROWS NK_INTEGER",
- /* 140 */ "alter_db_option ::= WAL_RETENTION_PERIOD NK_INTEGER",
- /* 141 */ "alter_db_option ::= WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER",
- /* 142 */ "alter_db_option ::= WAL_RETENTION_SIZE NK_INTEGER",
- /* 143 */ "alter_db_option ::= WAL_RETENTION_SIZE NK_MINUS NK_INTEGER",
- /* 144 */ "alter_db_option ::= KEEP_TIME_OFFSET NK_INTEGER",
- /* 145 */ "integer_list ::= NK_INTEGER",
- /* 146 */ "integer_list ::= integer_list NK_COMMA NK_INTEGER",
- /* 147 */ "variable_list ::= NK_VARIABLE",
- /* 148 */ "variable_list ::= variable_list NK_COMMA NK_VARIABLE",
- /* 149 */ "retention_list ::= retention",
- /* 150 */ "retention_list ::= retention_list NK_COMMA retention",
- /* 151 */ "retention ::= NK_VARIABLE NK_COLON NK_VARIABLE",
- /* 152 */ "retention ::= NK_MINUS NK_COLON NK_VARIABLE",
- /* 153 */ "speed_opt ::=",
- /* 154 */ "speed_opt ::= BWLIMIT NK_INTEGER",
- /* 155 */ "start_opt ::=",
- /* 156 */ "start_opt ::= START WITH NK_INTEGER",
- /* 157 */ "start_opt ::= START WITH NK_STRING",
- /* 158 */ "start_opt ::= START WITH TIMESTAMP NK_STRING",
- /* 159 */ "end_opt ::=",
- /* 160 */ "end_opt ::= END WITH NK_INTEGER",
- /* 161 */ "end_opt ::= END WITH NK_STRING",
- /* 162 */ "end_opt ::= END WITH TIMESTAMP NK_STRING",
- /* 163 */ "cmd ::= CREATE TABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def_opt table_options",
- /* 164 */ "cmd ::= CREATE TABLE multi_create_clause",
- /* 165 */ "cmd ::= CREATE STABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def table_options",
- /* 166 */ "cmd ::= DROP TABLE multi_drop_clause",
- /* 167 */ "cmd ::= DROP STABLE exists_opt full_table_name",
- /* 168 */ "cmd ::= ALTER TABLE alter_table_clause",
- /* 169 */ "cmd ::= ALTER STABLE alter_table_clause",
- /* 170 */ "alter_table_clause ::= full_table_name alter_table_options",
- /* 171 */ "alter_table_clause ::= full_table_name ADD COLUMN column_name type_name",
- /* 172 */ "alter_table_clause ::= full_table_name DROP COLUMN column_name",
- /* 173 */ "alter_table_clause ::= full_table_name MODIFY COLUMN column_name type_name",
- /* 174 */ "alter_table_clause ::= full_table_name RENAME COLUMN column_name column_name",
- /* 175 */ "alter_table_clause ::= full_table_name ADD TAG column_name type_name",
- /* 176 */ "alter_table_clause ::= full_table_name DROP TAG column_name",
- /* 177 */ "alter_table_clause ::= full_table_name MODIFY TAG column_name type_name",
- /* 178 */ "alter_table_clause ::= full_table_name RENAME TAG column_name column_name",
- /* 179 */ "alter_table_clause ::= full_table_name SET TAG column_name NK_EQ signed_literal",
- /* 180 */ "multi_create_clause ::= create_subtable_clause",
- /* 181 */ "multi_create_clause ::= multi_create_clause create_subtable_clause",
- /* 182 */ "create_subtable_clause ::= not_exists_opt full_table_name USING full_table_name specific_cols_opt TAGS NK_LP expression_list NK_RP table_options",
- /* 183 */ "multi_drop_clause ::= drop_table_clause",
- /* 184 */ "multi_drop_clause ::= multi_drop_clause NK_COMMA drop_table_clause",
- /* 185 */ "drop_table_clause ::= exists_opt full_table_name",
- /* 186 */ "specific_cols_opt ::=",
- /* 187 */ "specific_cols_opt ::= NK_LP col_name_list NK_RP",
- /* 188 */ "full_table_name ::= table_name",
- /* 189 */ "full_table_name ::= db_name NK_DOT table_name",
- /* 190 */ "column_def_list ::= column_def",
- /* 191 */ "column_def_list ::= column_def_list NK_COMMA column_def",
- /* 192 */ "column_def ::= column_name type_name",
- /* 193 */ "type_name ::= BOOL",
- /* 194 */ "type_name ::= TINYINT",
- /* 195 */ "type_name ::= SMALLINT",
- /* 196 */ "type_name ::= INT",
- /* 197 */ "type_name ::= INTEGER",
- /* 198 */ "type_name ::= BIGINT",
- /* 199 */ "type_name ::= FLOAT",
- /* 200 */ "type_name ::= DOUBLE",
- /* 201 */ "type_name ::= BINARY NK_LP NK_INTEGER NK_RP",
- /* 202 */ "type_name ::= TIMESTAMP",
- /* 203 */ "type_name ::= NCHAR NK_LP NK_INTEGER NK_RP",
- /* 204 */ "type_name ::= TINYINT UNSIGNED",
- /* 205 */ "type_name ::= SMALLINT UNSIGNED",
- /* 206 */ "type_name ::= INT UNSIGNED",
- /* 207 */ "type_name ::= BIGINT UNSIGNED",
- /* 208 */ "type_name ::= JSON",
- /* 209 */ "type_name ::= VARCHAR NK_LP NK_INTEGER NK_RP",
- /* 210 */ "type_name ::= MEDIUMBLOB",
- /* 211 */ "type_name ::= BLOB",
- /* 212 */ "type_name ::= VARBINARY NK_LP NK_INTEGER NK_RP",
- /* 213 */ "type_name ::= GEOMETRY NK_LP NK_INTEGER NK_RP",
- /* 214 */ "type_name ::= DECIMAL",
- /* 215 */ "type_name ::= DECIMAL NK_LP NK_INTEGER NK_RP",
- /* 216 */ "type_name ::= DECIMAL NK_LP NK_INTEGER NK_COMMA NK_INTEGER NK_RP",
- /* 217 */ "tags_def_opt ::=",
- /* 218 */ "tags_def_opt ::= tags_def",
- /* 219 */ "tags_def ::= TAGS NK_LP column_def_list NK_RP",
- /* 220 */ "table_options ::=",
- /* 221 */ "table_options ::= table_options COMMENT NK_STRING",
- /* 222 */ "table_options ::= table_options MAX_DELAY duration_list",
- /* 223 */ "table_options ::= table_options WATERMARK duration_list",
- /* 224 */ "table_options ::= table_options ROLLUP NK_LP rollup_func_list NK_RP",
- /* 225 */ "table_options ::= table_options TTL NK_INTEGER",
- /* 226 */ "table_options ::= table_options SMA NK_LP col_name_list NK_RP",
- /* 227 */ "table_options ::= table_options DELETE_MARK duration_list",
- /* 228 */ "alter_table_options ::= alter_table_option",
- /* 229 */ "alter_table_options ::= alter_table_options alter_table_option",
- /* 230 */ "alter_table_option ::= COMMENT NK_STRING",
- /* 231 */ "alter_table_option ::= TTL NK_INTEGER",
- /* 232 */ "duration_list ::= duration_literal",
- /* 233 */ "duration_list ::= duration_list NK_COMMA duration_literal",
- /* 234 */ "rollup_func_list ::= rollup_func_name",
- /* 235 */ "rollup_func_list ::= rollup_func_list NK_COMMA rollup_func_name",
- /* 236 */ "rollup_func_name ::= function_name",
- /* 237 */ "rollup_func_name ::= FIRST",
- /* 238 */ "rollup_func_name ::= LAST",
- /* 239 */ "col_name_list ::= col_name",
- /* 240 */ "col_name_list ::= col_name_list NK_COMMA col_name",
- /* 241 */ "col_name ::= column_name",
- /* 242 */ "cmd ::= SHOW DNODES",
- /* 243 */ "cmd ::= SHOW USERS",
- /* 244 */ "cmd ::= SHOW USER PRIVILEGES",
- /* 245 */ "cmd ::= SHOW db_kind_opt DATABASES",
- /* 246 */ "cmd ::= SHOW table_kind_db_name_cond_opt TABLES like_pattern_opt",
- /* 247 */ "cmd ::= SHOW db_name_cond_opt STABLES like_pattern_opt",
- /* 248 */ "cmd ::= SHOW db_name_cond_opt VGROUPS",
- /* 249 */ "cmd ::= SHOW MNODES",
- /* 250 */ "cmd ::= SHOW QNODES",
- /* 251 */ "cmd ::= SHOW FUNCTIONS",
- /* 252 */ "cmd ::= SHOW INDEXES FROM table_name_cond from_db_opt",
- /* 253 */ "cmd ::= SHOW INDEXES FROM db_name NK_DOT table_name",
- /* 254 */ "cmd ::= SHOW STREAMS",
- /* 255 */ "cmd ::= SHOW ACCOUNTS",
- /* 256 */ "cmd ::= SHOW APPS",
- /* 257 */ "cmd ::= SHOW CONNECTIONS",
- /* 258 */ "cmd ::= SHOW LICENCES",
- /* 259 */ "cmd ::= SHOW GRANTS",
- /* 260 */ "cmd ::= SHOW CREATE DATABASE db_name",
- /* 261 */ "cmd ::= SHOW CREATE TABLE full_table_name",
- /* 262 */ "cmd ::= SHOW CREATE STABLE full_table_name",
- /* 263 */ "cmd ::= SHOW QUERIES",
- /* 264 */ "cmd ::= SHOW SCORES",
- /* 265 */ "cmd ::= SHOW TOPICS",
- /* 266 */ "cmd ::= SHOW VARIABLES",
- /* 267 */ "cmd ::= SHOW CLUSTER VARIABLES",
- /* 268 */ "cmd ::= SHOW LOCAL VARIABLES",
- /* 269 */ "cmd ::= SHOW DNODE NK_INTEGER VARIABLES like_pattern_opt",
- /* 270 */ "cmd ::= SHOW BNODES",
- /* 271 */ "cmd ::= SHOW SNODES",
- /* 272 */ "cmd ::= SHOW CLUSTER",
- /* 273 */ "cmd ::= SHOW TRANSACTIONS",
- /* 274 */ "cmd ::= SHOW TABLE DISTRIBUTED full_table_name",
- /* 275 */ "cmd ::= SHOW CONSUMERS",
- /* 276 */ "cmd ::= SHOW SUBSCRIPTIONS",
- /* 277 */ "cmd ::= SHOW TAGS FROM table_name_cond from_db_opt",
- /* 278 */ "cmd ::= SHOW TAGS FROM db_name NK_DOT table_name",
- /* 279 */ "cmd ::= SHOW TABLE TAGS tag_list_opt FROM table_name_cond from_db_opt",
- /* 280 */ "cmd ::= SHOW TABLE TAGS tag_list_opt FROM db_name NK_DOT table_name",
- /* 281 */ "cmd ::= SHOW VNODES ON DNODE NK_INTEGER",
- /* 282 */ "cmd ::= SHOW VNODES",
- /* 283 */ "cmd ::= SHOW db_name_cond_opt ALIVE",
- /* 284 */ "cmd ::= SHOW CLUSTER ALIVE",
- /* 285 */ "cmd ::= SHOW db_name_cond_opt VIEWS",
- /* 286 */ "cmd ::= SHOW CREATE VIEW full_table_name",
- /* 287 */ "cmd ::= SHOW COMPACTS",
- /* 288 */ "cmd ::= SHOW COMPACT NK_INTEGER",
- /* 289 */ "table_kind_db_name_cond_opt ::=",
- /* 290 */ "table_kind_db_name_cond_opt ::= table_kind",
- /* 291 */ "table_kind_db_name_cond_opt ::= db_name NK_DOT",
- /* 292 */ "table_kind_db_name_cond_opt ::= table_kind db_name NK_DOT",
- /* 293 */ "table_kind ::= NORMAL",
- /* 294 */ "table_kind ::= CHILD",
- /* 295 */ "db_name_cond_opt ::=",
- /* 296 */ "db_name_cond_opt ::= db_name NK_DOT",
- /* 297 */ "like_pattern_opt ::=",
- /* 298 */ "like_pattern_opt ::= LIKE NK_STRING",
- /* 299 */ "table_name_cond ::= table_name",
- /* 300 */ "from_db_opt ::=",
- /* 301 */ "from_db_opt ::= FROM db_name",
- /* 302 */ "tag_list_opt ::=",
- /* 303 */ "tag_list_opt ::= tag_item",
- /* 304 */ "tag_list_opt ::= tag_list_opt NK_COMMA tag_item",
- /* 305 */ "tag_item ::= TBNAME",
- /* 306 */ "tag_item ::= QTAGS",
- /* 307 */ "tag_item ::= column_name",
- /* 308 */ "tag_item ::= column_name column_alias",
- /* 309 */ "tag_item ::= column_name AS column_alias",
- /* 310 */ "db_kind_opt ::=",
- /* 311 */ "db_kind_opt ::= USER",
- /* 312 */ "db_kind_opt ::= SYSTEM",
- /* 313 */ "cmd ::= CREATE SMA INDEX not_exists_opt col_name ON full_table_name index_options",
- /* 314 */ "cmd ::= CREATE INDEX not_exists_opt col_name ON full_table_name NK_LP col_name_list NK_RP",
- /* 315 */ "cmd ::= DROP INDEX exists_opt full_index_name",
- /* 316 */ "full_index_name ::= index_name",
- /* 317 */ "full_index_name ::= db_name NK_DOT index_name",
- /* 318 */ "index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_RP sliding_opt sma_stream_opt",
- /* 319 */ "index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt sma_stream_opt",
- /* 320 */ "func_list ::= func",
- /* 321 */ "func_list ::= func_list NK_COMMA func",
- /* 322 */ "func ::= sma_func_name NK_LP expression_list NK_RP",
- /* 323 */ "sma_func_name ::= function_name",
- /* 324 */ "sma_func_name ::= COUNT",
- /* 325 */ "sma_func_name ::= FIRST",
- /* 326 */ "sma_func_name ::= LAST",
- /* 327 */ "sma_func_name ::= LAST_ROW",
- /* 328 */ "sma_stream_opt ::=",
- /* 329 */ "sma_stream_opt ::= sma_stream_opt WATERMARK duration_literal",
- /* 330 */ "sma_stream_opt ::= sma_stream_opt MAX_DELAY duration_literal",
- /* 331 */ "sma_stream_opt ::= sma_stream_opt DELETE_MARK duration_literal",
- /* 332 */ "with_meta ::= AS",
- /* 333 */ "with_meta ::= WITH META AS",
- /* 334 */ "with_meta ::= ONLY META AS",
- /* 335 */ "cmd ::= CREATE TOPIC not_exists_opt topic_name AS query_or_subquery",
- /* 336 */ "cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta DATABASE db_name",
- /* 337 */ "cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta STABLE full_table_name where_clause_opt",
- /* 338 */ "cmd ::= DROP TOPIC exists_opt topic_name",
- /* 339 */ "cmd ::= DROP CONSUMER GROUP exists_opt cgroup_name ON topic_name",
- /* 340 */ "cmd ::= DESC full_table_name",
- /* 341 */ "cmd ::= DESCRIBE full_table_name",
- /* 342 */ "cmd ::= RESET QUERY CACHE",
- /* 343 */ "cmd ::= EXPLAIN analyze_opt explain_options query_or_subquery",
- /* 344 */ "cmd ::= EXPLAIN analyze_opt explain_options insert_query",
- /* 345 */ "analyze_opt ::=",
- /* 346 */ "analyze_opt ::= ANALYZE",
- /* 347 */ "explain_options ::=",
- /* 348 */ "explain_options ::= explain_options VERBOSE NK_BOOL",
- /* 349 */ "explain_options ::= explain_options RATIO NK_FLOAT",
- /* 350 */ "cmd ::= CREATE or_replace_opt agg_func_opt FUNCTION not_exists_opt function_name AS NK_STRING OUTPUTTYPE type_name bufsize_opt language_opt",
- /* 351 */ "cmd ::= DROP FUNCTION exists_opt function_name",
- /* 352 */ "agg_func_opt ::=",
- /* 353 */ "agg_func_opt ::= AGGREGATE",
- /* 354 */ "bufsize_opt ::=",
- /* 355 */ "bufsize_opt ::= BUFSIZE NK_INTEGER",
- /* 356 */ "language_opt ::=",
- /* 357 */ "language_opt ::= LANGUAGE NK_STRING",
- /* 358 */ "or_replace_opt ::=",
- /* 359 */ "or_replace_opt ::= OR REPLACE",
- /* 360 */ "cmd ::= CREATE or_replace_opt VIEW full_view_name AS query_or_subquery",
- /* 361 */ "cmd ::= DROP VIEW exists_opt full_view_name",
- /* 362 */ "full_view_name ::= view_name",
- /* 363 */ "full_view_name ::= db_name NK_DOT view_name",
- /* 364 */ "cmd ::= CREATE STREAM not_exists_opt stream_name stream_options INTO full_table_name col_list_opt tag_def_or_ref_opt subtable_opt AS query_or_subquery",
- /* 365 */ "cmd ::= DROP STREAM exists_opt stream_name",
- /* 366 */ "cmd ::= PAUSE STREAM exists_opt stream_name",
- /* 367 */ "cmd ::= RESUME STREAM exists_opt ignore_opt stream_name",
- /* 368 */ "col_list_opt ::=",
- /* 369 */ "col_list_opt ::= NK_LP col_name_list NK_RP",
- /* 370 */ "tag_def_or_ref_opt ::=",
- /* 371 */ "tag_def_or_ref_opt ::= tags_def",
- /* 372 */ "tag_def_or_ref_opt ::= TAGS NK_LP col_name_list NK_RP",
- /* 373 */ "stream_options ::=",
- /* 374 */ "stream_options ::= stream_options TRIGGER AT_ONCE",
- /* 375 */ "stream_options ::= stream_options TRIGGER WINDOW_CLOSE",
- /* 376 */ "stream_options ::= stream_options TRIGGER MAX_DELAY duration_literal",
- /* 377 */ "stream_options ::= stream_options WATERMARK duration_literal",
- /* 378 */ "stream_options ::= stream_options IGNORE EXPIRED NK_INTEGER",
- /* 379 */ "stream_options ::= stream_options FILL_HISTORY NK_INTEGER",
- /* 380 */ "stream_options ::= stream_options DELETE_MARK duration_literal",
- /* 381 */ "stream_options ::= stream_options IGNORE UPDATE NK_INTEGER",
- /* 382 */ "subtable_opt ::=",
- /* 383 */ "subtable_opt ::= SUBTABLE NK_LP expression NK_RP",
- /* 384 */ "ignore_opt ::=",
- /* 385 */ "ignore_opt ::= IGNORE UNTREATED",
- /* 386 */ "cmd ::= KILL CONNECTION NK_INTEGER",
- /* 387 */ "cmd ::= KILL QUERY NK_STRING",
- /* 388 */ "cmd ::= KILL TRANSACTION NK_INTEGER",
- /* 389 */ "cmd ::= KILL COMPACT NK_INTEGER",
- /* 390 */ "cmd ::= BALANCE VGROUP",
- /* 391 */ "cmd ::= BALANCE VGROUP LEADER on_vgroup_id",
- /* 392 */ "cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER",
- /* 393 */ "cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list",
- /* 394 */ "cmd ::= SPLIT VGROUP NK_INTEGER",
- /* 395 */ "on_vgroup_id ::=",
- /* 396 */ "on_vgroup_id ::= ON NK_INTEGER",
- /* 397 */ "dnode_list ::= DNODE NK_INTEGER",
- /* 398 */ "dnode_list ::= dnode_list DNODE NK_INTEGER",
- /* 399 */ "cmd ::= DELETE FROM full_table_name where_clause_opt",
- /* 400 */ "cmd ::= query_or_subquery",
- /* 401 */ "cmd ::= insert_query",
- /* 402 */ "insert_query ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery",
- /* 403 */ "insert_query ::= INSERT INTO full_table_name query_or_subquery",
- /* 404 */ "literal ::= NK_INTEGER",
- /* 405 */ "literal ::= NK_FLOAT",
- /* 406 */ "literal ::= NK_STRING",
- /* 407 */ "literal ::= NK_BOOL",
- /* 408 */ "literal ::= TIMESTAMP NK_STRING",
- /* 409 */ "literal ::= duration_literal",
- /* 410 */ "literal ::= NULL",
- /* 411 */ "literal ::= NK_QUESTION",
- /* 412 */ "duration_literal ::= NK_VARIABLE",
- /* 413 */ "signed ::= NK_INTEGER",
- /* 414 */ "signed ::= NK_PLUS NK_INTEGER",
- /* 415 */ "signed ::= NK_MINUS NK_INTEGER",
- /* 416 */ "signed ::= NK_FLOAT",
- /* 417 */ "signed ::= NK_PLUS NK_FLOAT",
- /* 418 */ "signed ::= NK_MINUS NK_FLOAT",
- /* 419 */ "signed_literal ::= signed",
- /* 420 */ "signed_literal ::= NK_STRING",
- /* 421 */ "signed_literal ::= NK_BOOL",
- /* 422 */ "signed_literal ::= TIMESTAMP NK_STRING",
- /* 423 */ "signed_literal ::= duration_literal",
- /* 424 */ "signed_literal ::= NULL",
- /* 425 */ "signed_literal ::= literal_func",
- /* 426 */ "signed_literal ::= NK_QUESTION",
- /* 427 */ "literal_list ::= signed_literal",
- /* 428 */ "literal_list ::= literal_list NK_COMMA signed_literal",
- /* 429 */ "db_name ::= NK_ID",
- /* 430 */ "table_name ::= NK_ID",
- /* 431 */ "column_name ::= NK_ID",
- /* 432 */ "function_name ::= NK_ID",
- /* 433 */ "view_name ::= NK_ID",
- /* 434 */ "table_alias ::= NK_ID",
- /* 435 */ "column_alias ::= NK_ID",
- /* 436 */ "column_alias ::= NK_ALIAS",
- /* 437 */ "user_name ::= NK_ID",
- /* 438 */ "topic_name ::= NK_ID",
- /* 439 */ "stream_name ::= NK_ID",
- /* 440 */ "cgroup_name ::= NK_ID",
- /* 441 */ "index_name ::= NK_ID",
- /* 442 */ "expr_or_subquery ::= expression",
- /* 443 */ "expression ::= literal",
- /* 444 */ "expression ::= pseudo_column",
- /* 445 */ "expression ::= column_reference",
- /* 446 */ "expression ::= function_expression",
- /* 447 */ "expression ::= case_when_expression",
- /* 448 */ "expression ::= NK_LP expression NK_RP",
- /* 449 */ "expression ::= NK_PLUS expr_or_subquery",
- /* 450 */ "expression ::= NK_MINUS expr_or_subquery",
- /* 451 */ "expression ::= expr_or_subquery NK_PLUS expr_or_subquery",
- /* 452 */ "expression ::= expr_or_subquery NK_MINUS expr_or_subquery",
- /* 453 */ "expression ::= expr_or_subquery NK_STAR expr_or_subquery",
- /* 454 */ "expression ::= expr_or_subquery NK_SLASH expr_or_subquery",
- /* 455 */ "expression ::= expr_or_subquery NK_REM expr_or_subquery",
- /* 456 */ "expression ::= column_reference NK_ARROW NK_STRING",
- /* 457 */ "expression ::= expr_or_subquery NK_BITAND expr_or_subquery",
- /* 458 */ "expression ::= expr_or_subquery NK_BITOR expr_or_subquery",
- /* 459 */ "expression_list ::= expr_or_subquery",
- /* 460 */ "expression_list ::= expression_list NK_COMMA expr_or_subquery",
- /* 461 */ "column_reference ::= column_name",
- /* 462 */ "column_reference ::= table_name NK_DOT column_name",
- /* 463 */ "column_reference ::= NK_ALIAS",
- /* 464 */ "column_reference ::= table_name NK_DOT NK_ALIAS",
- /* 465 */ "pseudo_column ::= ROWTS",
- /* 466 */ "pseudo_column ::= TBNAME",
- /* 467 */ "pseudo_column ::= table_name NK_DOT TBNAME",
- /* 468 */ "pseudo_column ::= QSTART",
- /* 469 */ "pseudo_column ::= QEND",
- /* 470 */ "pseudo_column ::= QDURATION",
- /* 471 */ "pseudo_column ::= WSTART",
- /* 472 */ "pseudo_column ::= WEND",
- /* 473 */ "pseudo_column ::= WDURATION",
- /* 474 */ "pseudo_column ::= IROWTS",
- /* 475 */ "pseudo_column ::= ISFILLED",
- /* 476 */ "pseudo_column ::= QTAGS",
- /* 477 */ "function_expression ::= function_name NK_LP expression_list NK_RP",
- /* 478 */ "function_expression ::= star_func NK_LP star_func_para_list NK_RP",
- /* 479 */ "function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP",
- /* 480 */ "function_expression ::= literal_func",
- /* 481 */ "literal_func ::= noarg_func NK_LP NK_RP",
- /* 482 */ "literal_func ::= NOW",
- /* 483 */ "noarg_func ::= NOW",
- /* 484 */ "noarg_func ::= TODAY",
- /* 485 */ "noarg_func ::= TIMEZONE",
- /* 486 */ "noarg_func ::= DATABASE",
- /* 487 */ "noarg_func ::= CLIENT_VERSION",
- /* 488 */ "noarg_func ::= SERVER_VERSION",
- /* 489 */ "noarg_func ::= SERVER_STATUS",
- /* 490 */ "noarg_func ::= CURRENT_USER",
- /* 491 */ "noarg_func ::= USER",
- /* 492 */ "star_func ::= COUNT",
- /* 493 */ "star_func ::= FIRST",
- /* 494 */ "star_func ::= LAST",
- /* 495 */ "star_func ::= LAST_ROW",
- /* 496 */ "star_func_para_list ::= NK_STAR",
- /* 497 */ "star_func_para_list ::= other_para_list",
- /* 498 */ "other_para_list ::= star_func_para",
- /* 499 */ "other_para_list ::= other_para_list NK_COMMA star_func_para",
- /* 500 */ "star_func_para ::= expr_or_subquery",
- /* 501 */ "star_func_para ::= table_name NK_DOT NK_STAR",
- /* 502 */ "case_when_expression ::= CASE when_then_list case_when_else_opt END",
- /* 503 */ "case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END",
- /* 504 */ "when_then_list ::= when_then_expr",
- /* 505 */ "when_then_list ::= when_then_list when_then_expr",
- /* 506 */ "when_then_expr ::= WHEN common_expression THEN common_expression",
- /* 507 */ "case_when_else_opt ::=",
- /* 508 */ "case_when_else_opt ::= ELSE common_expression",
- /* 509 */ "predicate ::= expr_or_subquery compare_op expr_or_subquery",
- /* 510 */ "predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery",
- /* 511 */ "predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery",
- /* 512 */ "predicate ::= expr_or_subquery IS NULL",
- /* 513 */ "predicate ::= expr_or_subquery IS NOT NULL",
- /* 514 */ "predicate ::= expr_or_subquery in_op in_predicate_value",
- /* 515 */ "compare_op ::= NK_LT",
- /* 516 */ "compare_op ::= NK_GT",
- /* 517 */ "compare_op ::= NK_LE",
- /* 518 */ "compare_op ::= NK_GE",
- /* 519 */ "compare_op ::= NK_NE",
- /* 520 */ "compare_op ::= NK_EQ",
- /* 521 */ "compare_op ::= LIKE",
- /* 522 */ "compare_op ::= NOT LIKE",
- /* 523 */ "compare_op ::= MATCH",
- /* 524 */ "compare_op ::= NMATCH",
- /* 525 */ "compare_op ::= CONTAINS",
- /* 526 */ "in_op ::= IN",
- /* 527 */ "in_op ::= NOT IN",
- /* 528 */ "in_predicate_value ::= NK_LP literal_list NK_RP",
- /* 529 */ "boolean_value_expression ::= boolean_primary",
- /* 530 */ "boolean_value_expression ::= NOT boolean_primary",
- /* 531 */ "boolean_value_expression ::= boolean_value_expression OR boolean_value_expression",
- /* 532 */ "boolean_value_expression ::= boolean_value_expression AND boolean_value_expression",
- /* 533 */ "boolean_primary ::= predicate",
- /* 534 */ "boolean_primary ::= NK_LP boolean_value_expression NK_RP",
- /* 535 */ "common_expression ::= expr_or_subquery",
- /* 536 */ "common_expression ::= boolean_value_expression",
- /* 537 */ "from_clause_opt ::=",
- /* 538 */ "from_clause_opt ::= FROM table_reference_list",
- /* 539 */ "table_reference_list ::= table_reference",
- /* 540 */ "table_reference_list ::= table_reference_list NK_COMMA table_reference",
- /* 541 */ "table_reference ::= table_primary",
- /* 542 */ "table_reference ::= joined_table",
- /* 543 */ "table_primary ::= table_name alias_opt",
- /* 544 */ "table_primary ::= db_name NK_DOT table_name alias_opt",
- /* 545 */ "table_primary ::= subquery alias_opt",
- /* 546 */ "table_primary ::= parenthesized_joined_table",
- /* 547 */ "alias_opt ::=",
- /* 548 */ "alias_opt ::= table_alias",
- /* 549 */ "alias_opt ::= AS table_alias",
- /* 550 */ "parenthesized_joined_table ::= NK_LP joined_table NK_RP",
- /* 551 */ "parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP",
- /* 552 */ "joined_table ::= table_reference join_type JOIN table_reference ON search_condition",
- /* 553 */ "join_type ::=",
- /* 554 */ "join_type ::= INNER",
- /* 555 */ "query_specification ::= SELECT hint_list set_quantifier_opt tag_mode_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt",
- /* 556 */ "hint_list ::=",
- /* 557 */ "hint_list ::= NK_HINT",
- /* 558 */ "tag_mode_opt ::=",
- /* 559 */ "tag_mode_opt ::= TAGS",
- /* 560 */ "set_quantifier_opt ::=",
- /* 561 */ "set_quantifier_opt ::= DISTINCT",
- /* 562 */ "set_quantifier_opt ::= ALL",
- /* 563 */ "select_list ::= select_item",
- /* 564 */ "select_list ::= select_list NK_COMMA select_item",
- /* 565 */ "select_item ::= NK_STAR",
- /* 566 */ "select_item ::= common_expression",
- /* 567 */ "select_item ::= common_expression column_alias",
- /* 568 */ "select_item ::= common_expression AS column_alias",
- /* 569 */ "select_item ::= table_name NK_DOT NK_STAR",
- /* 570 */ "where_clause_opt ::=",
- /* 571 */ "where_clause_opt ::= WHERE search_condition",
- /* 572 */ "partition_by_clause_opt ::=",
- /* 573 */ "partition_by_clause_opt ::= PARTITION BY partition_list",
- /* 574 */ "partition_list ::= partition_item",
- /* 575 */ "partition_list ::= partition_list NK_COMMA partition_item",
- /* 576 */ "partition_item ::= expr_or_subquery",
- /* 577 */ "partition_item ::= expr_or_subquery column_alias",
- /* 578 */ "partition_item ::= expr_or_subquery AS column_alias",
- /* 579 */ "twindow_clause_opt ::=",
- /* 580 */ "twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA interval_sliding_duration_literal NK_RP",
- /* 581 */ "twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP",
- /* 582 */ "twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_RP sliding_opt fill_opt",
- /* 583 */ "twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_COMMA interval_sliding_duration_literal NK_RP sliding_opt fill_opt",
- /* 584 */ "twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition",
- /* 585 */ "sliding_opt ::=",
- /* 586 */ "sliding_opt ::= SLIDING NK_LP interval_sliding_duration_literal NK_RP",
- /* 587 */ "interval_sliding_duration_literal ::= NK_VARIABLE",
- /* 588 */ "interval_sliding_duration_literal ::= NK_STRING",
- /* 589 */ "interval_sliding_duration_literal ::= NK_INTEGER",
- /* 590 */ "fill_opt ::=",
- /* 591 */ "fill_opt ::= FILL NK_LP fill_mode NK_RP",
- /* 592 */ "fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP",
- /* 593 */ "fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP",
- /* 594 */ "fill_mode ::= NONE",
- /* 595 */ "fill_mode ::= PREV",
- /* 596 */ "fill_mode ::= NULL",
- /* 597 */ "fill_mode ::= NULL_F",
- /* 598 */ "fill_mode ::= LINEAR",
- /* 599 */ "fill_mode ::= NEXT",
- /* 600 */ "group_by_clause_opt ::=",
- /* 601 */ "group_by_clause_opt ::= GROUP BY group_by_list",
- /* 602 */ "group_by_list ::= expr_or_subquery",
- /* 603 */ "group_by_list ::= group_by_list NK_COMMA expr_or_subquery",
- /* 604 */ "having_clause_opt ::=",
- /* 605 */ "having_clause_opt ::= HAVING search_condition",
- /* 606 */ "range_opt ::=",
- /* 607 */ "range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP",
- /* 608 */ "range_opt ::= RANGE NK_LP expr_or_subquery NK_RP",
- /* 609 */ "every_opt ::=",
- /* 610 */ "every_opt ::= EVERY NK_LP duration_literal NK_RP",
- /* 611 */ "query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt",
- /* 612 */ "query_simple ::= query_specification",
- /* 613 */ "query_simple ::= union_query_expression",
- /* 614 */ "union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery",
- /* 615 */ "union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery",
- /* 616 */ "query_simple_or_subquery ::= query_simple",
- /* 617 */ "query_simple_or_subquery ::= subquery",
- /* 618 */ "query_or_subquery ::= query_expression",
- /* 619 */ "query_or_subquery ::= subquery",
- /* 620 */ "order_by_clause_opt ::=",
- /* 621 */ "order_by_clause_opt ::= ORDER BY sort_specification_list",
- /* 622 */ "slimit_clause_opt ::=",
- /* 623 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER",
- /* 624 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER",
- /* 625 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER",
- /* 626 */ "limit_clause_opt ::=",
- /* 627 */ "limit_clause_opt ::= LIMIT NK_INTEGER",
- /* 628 */ "limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER",
- /* 629 */ "limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER",
- /* 630 */ "subquery ::= NK_LP query_expression NK_RP",
- /* 631 */ "subquery ::= NK_LP subquery NK_RP",
- /* 632 */ "search_condition ::= common_expression",
- /* 633 */ "sort_specification_list ::= sort_specification",
- /* 634 */ "sort_specification_list ::= sort_specification_list NK_COMMA sort_specification",
- /* 635 */ "sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt",
- /* 636 */ "ordering_specification_opt ::=",
- /* 637 */ "ordering_specification_opt ::= ASC",
- /* 638 */ "ordering_specification_opt ::= DESC",
- /* 639 */ "null_ordering_opt ::=",
- /* 640 */ "null_ordering_opt ::= NULLS FIRST",
- /* 641 */ "null_ordering_opt ::= NULLS LAST",
+ /* 124 */ "db_options ::= db_options STT_MERGE_POLICY NK_STRING",
+ /* 125 */ "db_options ::= db_options TABLE_PREFIX signed",
+ /* 126 */ "db_options ::= db_options TABLE_SUFFIX signed",
+ /* 127 */ "db_options ::= db_options KEEP_TIME_OFFSET NK_INTEGER",
+ /* 128 */ "alter_db_options ::= alter_db_option",
+ /* 129 */ "alter_db_options ::= alter_db_options alter_db_option",
+ /* 130 */ "alter_db_option ::= BUFFER NK_INTEGER",
+ /* 131 */ "alter_db_option ::= CACHEMODEL NK_STRING",
+ /* 132 */ "alter_db_option ::= CACHESIZE NK_INTEGER",
+ /* 133 */ "alter_db_option ::= WAL_FSYNC_PERIOD NK_INTEGER",
+ /* 134 */ "alter_db_option ::= KEEP integer_list",
+ /* 135 */ "alter_db_option ::= KEEP variable_list",
+ /* 136 */ "alter_db_option ::= PAGES NK_INTEGER",
+ /* 137 */ "alter_db_option ::= REPLICA NK_INTEGER",
+ /* 138 */ "alter_db_option ::= WAL_LEVEL NK_INTEGER",
+ /* 139 */ "alter_db_option ::= STT_TRIGGER NK_INTEGER",
+ /* 140 */ "alter_db_option ::= STT_MERGE_POLICY NK_STRING",
+ /* 141 */ "alter_db_option ::= MINROWS NK_INTEGER",
+ /* 142 */ "alter_db_option ::= WAL_RETENTION_PERIOD NK_INTEGER",
+ /* 143 */ "alter_db_option ::= WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER",
+ /* 144 */ "alter_db_option ::= WAL_RETENTION_SIZE NK_INTEGER",
+ /* 145 */ "alter_db_option ::= WAL_RETENTION_SIZE NK_MINUS NK_INTEGER",
+ /* 146 */ "alter_db_option ::= KEEP_TIME_OFFSET NK_INTEGER",
+ /* 147 */ "integer_list ::= NK_INTEGER",
+ /* 148 */ "integer_list ::= integer_list NK_COMMA NK_INTEGER",
+ /* 149 */ "variable_list ::= NK_VARIABLE",
+ /* 150 */ "variable_list ::= variable_list NK_COMMA NK_VARIABLE",
+ /* 151 */ "retention_list ::= retention",
+ /* 152 */ "retention_list ::= retention_list NK_COMMA retention",
+ /* 153 */ "retention ::= NK_VARIABLE NK_COLON NK_VARIABLE",
+ /* 154 */ "retention ::= NK_MINUS NK_COLON NK_VARIABLE",
+ /* 155 */ "speed_opt ::=",
+ /* 156 */ "speed_opt ::= BWLIMIT NK_INTEGER",
+ /* 157 */ "start_opt ::=",
+ /* 158 */ "start_opt ::= START WITH NK_INTEGER",
+ /* 159 */ "start_opt ::= START WITH NK_STRING",
+ /* 160 */ "start_opt ::= START WITH TIMESTAMP NK_STRING",
+ /* 161 */ "end_opt ::=",
+ /* 162 */ "end_opt ::= END WITH NK_INTEGER",
+ /* 163 */ "end_opt ::= END WITH NK_STRING",
+ /* 164 */ "end_opt ::= END WITH TIMESTAMP NK_STRING",
+ /* 165 */ "cmd ::= CREATE TABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def_opt table_options",
+ /* 166 */ "cmd ::= CREATE TABLE multi_create_clause",
+ /* 167 */ "cmd ::= CREATE STABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def table_options",
+ /* 168 */ "cmd ::= DROP TABLE multi_drop_clause",
+ /* 169 */ "cmd ::= DROP STABLE exists_opt full_table_name",
+ /* 170 */ "cmd ::= ALTER TABLE alter_table_clause",
+ /* 171 */ "cmd ::= ALTER STABLE alter_table_clause",
+ /* 172 */ "alter_table_clause ::= full_table_name alter_table_options",
+ /* 173 */ "alter_table_clause ::= full_table_name ADD COLUMN column_name type_name",
+ /* 174 */ "alter_table_clause ::= full_table_name DROP COLUMN column_name",
+ /* 175 */ "alter_table_clause ::= full_table_name MODIFY COLUMN column_name type_name",
+ /* 176 */ "alter_table_clause ::= full_table_name RENAME COLUMN column_name column_name",
+ /* 177 */ "alter_table_clause ::= full_table_name ADD TAG column_name type_name",
+ /* 178 */ "alter_table_clause ::= full_table_name DROP TAG column_name",
+ /* 179 */ "alter_table_clause ::= full_table_name MODIFY TAG column_name type_name",
+ /* 180 */ "alter_table_clause ::= full_table_name RENAME TAG column_name column_name",
+ /* 181 */ "alter_table_clause ::= full_table_name SET TAG column_name NK_EQ signed_literal",
+ /* 182 */ "multi_create_clause ::= create_subtable_clause",
+ /* 183 */ "multi_create_clause ::= multi_create_clause create_subtable_clause",
+ /* 184 */ "create_subtable_clause ::= not_exists_opt full_table_name USING full_table_name specific_cols_opt TAGS NK_LP expression_list NK_RP table_options",
+ /* 185 */ "multi_drop_clause ::= drop_table_clause",
+ /* 186 */ "multi_drop_clause ::= multi_drop_clause NK_COMMA drop_table_clause",
+ /* 187 */ "drop_table_clause ::= exists_opt full_table_name",
+ /* 188 */ "specific_cols_opt ::=",
+ /* 189 */ "specific_cols_opt ::= NK_LP col_name_list NK_RP",
+ /* 190 */ "full_table_name ::= table_name",
+ /* 191 */ "full_table_name ::= db_name NK_DOT table_name",
+ /* 192 */ "column_def_list ::= column_def",
+ /* 193 */ "column_def_list ::= column_def_list NK_COMMA column_def",
+ /* 194 */ "column_def ::= column_name type_name",
+ /* 195 */ "type_name ::= BOOL",
+ /* 196 */ "type_name ::= TINYINT",
+ /* 197 */ "type_name ::= SMALLINT",
+ /* 198 */ "type_name ::= INT",
+ /* 199 */ "type_name ::= INTEGER",
+ /* 200 */ "type_name ::= BIGINT",
+ /* 201 */ "type_name ::= FLOAT",
+ /* 202 */ "type_name ::= DOUBLE",
+ /* 203 */ "type_name ::= BINARY NK_LP NK_INTEGER NK_RP",
+ /* 204 */ "type_name ::= TIMESTAMP",
+ /* 205 */ "type_name ::= NCHAR NK_LP NK_INTEGER NK_RP",
+ /* 206 */ "type_name ::= TINYINT UNSIGNED",
+ /* 207 */ "type_name ::= SMALLINT UNSIGNED",
+ /* 208 */ "type_name ::= INT UNSIGNED",
+ /* 209 */ "type_name ::= BIGINT UNSIGNED",
+ /* 210 */ "type_name ::= JSON",
+ /* 211 */ "type_name ::= VARCHAR NK_LP NK_INTEGER NK_RP",
+ /* 212 */ "type_name ::= MEDIUMBLOB",
+ /* 213 */ "type_name ::= BLOB",
+ /* 214 */ "type_name ::= VARBINARY NK_LP NK_INTEGER NK_RP",
+ /* 215 */ "type_name ::= GEOMETRY NK_LP NK_INTEGER NK_RP",
+ /* 216 */ "type_name ::= DECIMAL",
+ /* 217 */ "type_name ::= DECIMAL NK_LP NK_INTEGER NK_RP",
+ /* 218 */ "type_name ::= DECIMAL NK_LP NK_INTEGER NK_COMMA NK_INTEGER NK_RP",
+ /* 219 */ "tags_def_opt ::=",
+ /* 220 */ "tags_def_opt ::= tags_def",
+ /* 221 */ "tags_def ::= TAGS NK_LP column_def_list NK_RP",
+ /* 222 */ "table_options ::=",
+ /* 223 */ "table_options ::= table_options COMMENT NK_STRING",
+ /* 224 */ "table_options ::= table_options MAX_DELAY duration_list",
+ /* 225 */ "table_options ::= table_options WATERMARK duration_list",
+ /* 226 */ "table_options ::= table_options ROLLUP NK_LP rollup_func_list NK_RP",
+ /* 227 */ "table_options ::= table_options TTL NK_INTEGER",
+ /* 228 */ "table_options ::= table_options SMA NK_LP col_name_list NK_RP",
+ /* 229 */ "table_options ::= table_options BLOOM_FILTER NK_LP col_name_list NK_RP",
+ /* 230 */ "table_options ::= table_options DELETE_MARK duration_list",
+ /* 231 */ "alter_table_options ::= alter_table_option",
+ /* 232 */ "alter_table_options ::= alter_table_options alter_table_option",
+ /* 233 */ "alter_table_option ::= COMMENT NK_STRING",
+ /* 234 */ "alter_table_option ::= TTL NK_INTEGER",
+ /* 235 */ "duration_list ::= duration_literal",
+ /* 236 */ "duration_list ::= duration_list NK_COMMA duration_literal",
+ /* 237 */ "rollup_func_list ::= rollup_func_name",
+ /* 238 */ "rollup_func_list ::= rollup_func_list NK_COMMA rollup_func_name",
+ /* 239 */ "rollup_func_name ::= function_name",
+ /* 240 */ "rollup_func_name ::= FIRST",
+ /* 241 */ "rollup_func_name ::= LAST",
+ /* 242 */ "col_name_list ::= col_name",
+ /* 243 */ "col_name_list ::= col_name_list NK_COMMA col_name",
+ /* 244 */ "col_name ::= column_name",
+ /* 245 */ "cmd ::= SHOW DNODES",
+ /* 246 */ "cmd ::= SHOW USERS",
+ /* 247 */ "cmd ::= SHOW USER PRIVILEGES",
+ /* 248 */ "cmd ::= SHOW db_kind_opt DATABASES",
+ /* 249 */ "cmd ::= SHOW table_kind_db_name_cond_opt TABLES like_pattern_opt",
+ /* 250 */ "cmd ::= SHOW db_name_cond_opt STABLES like_pattern_opt",
+ /* 251 */ "cmd ::= SHOW db_name_cond_opt VGROUPS",
+ /* 252 */ "cmd ::= SHOW MNODES",
+ /* 253 */ "cmd ::= SHOW QNODES",
+ /* 254 */ "cmd ::= SHOW FUNCTIONS",
+ /* 255 */ "cmd ::= SHOW INDEXES FROM table_name_cond from_db_opt",
+ /* 256 */ "cmd ::= SHOW INDEXES FROM db_name NK_DOT table_name",
+ /* 257 */ "cmd ::= SHOW STREAMS",
+ /* 258 */ "cmd ::= SHOW ACCOUNTS",
+ /* 259 */ "cmd ::= SHOW APPS",
+ /* 260 */ "cmd ::= SHOW CONNECTIONS",
+ /* 261 */ "cmd ::= SHOW LICENCES",
+ /* 262 */ "cmd ::= SHOW GRANTS",
+ /* 263 */ "cmd ::= SHOW CREATE DATABASE db_name",
+ /* 264 */ "cmd ::= SHOW CREATE TABLE full_table_name",
+ /* 265 */ "cmd ::= SHOW CREATE STABLE full_table_name",
+ /* 266 */ "cmd ::= SHOW QUERIES",
+ /* 267 */ "cmd ::= SHOW SCORES",
+ /* 268 */ "cmd ::= SHOW TOPICS",
+ /* 269 */ "cmd ::= SHOW VARIABLES",
+ /* 270 */ "cmd ::= SHOW CLUSTER VARIABLES",
+ /* 271 */ "cmd ::= SHOW LOCAL VARIABLES",
+ /* 272 */ "cmd ::= SHOW DNODE NK_INTEGER VARIABLES like_pattern_opt",
+ /* 273 */ "cmd ::= SHOW BNODES",
+ /* 274 */ "cmd ::= SHOW SNODES",
+ /* 275 */ "cmd ::= SHOW CLUSTER",
+ /* 276 */ "cmd ::= SHOW TRANSACTIONS",
+ /* 277 */ "cmd ::= SHOW TABLE DISTRIBUTED full_table_name",
+ /* 278 */ "cmd ::= SHOW CONSUMERS",
+ /* 279 */ "cmd ::= SHOW SUBSCRIPTIONS",
+ /* 280 */ "cmd ::= SHOW TAGS FROM table_name_cond from_db_opt",
+ /* 281 */ "cmd ::= SHOW TAGS FROM db_name NK_DOT table_name",
+ /* 282 */ "cmd ::= SHOW TABLE TAGS tag_list_opt FROM table_name_cond from_db_opt",
+ /* 283 */ "cmd ::= SHOW TABLE TAGS tag_list_opt FROM db_name NK_DOT table_name",
+ /* 284 */ "cmd ::= SHOW VNODES ON DNODE NK_INTEGER",
+ /* 285 */ "cmd ::= SHOW VNODES",
+ /* 286 */ "cmd ::= SHOW db_name_cond_opt ALIVE",
+ /* 287 */ "cmd ::= SHOW CLUSTER ALIVE",
+ /* 288 */ "cmd ::= SHOW db_name_cond_opt VIEWS",
+ /* 289 */ "cmd ::= SHOW CREATE VIEW full_table_name",
+ /* 290 */ "cmd ::= SHOW COMPACTS",
+ /* 291 */ "cmd ::= SHOW COMPACT NK_INTEGER",
+ /* 292 */ "table_kind_db_name_cond_opt ::=",
+ /* 293 */ "table_kind_db_name_cond_opt ::= table_kind",
+ /* 294 */ "table_kind_db_name_cond_opt ::= db_name NK_DOT",
+ /* 295 */ "table_kind_db_name_cond_opt ::= table_kind db_name NK_DOT",
+ /* 296 */ "table_kind ::= NORMAL",
+ /* 297 */ "table_kind ::= CHILD",
+ /* 298 */ "db_name_cond_opt ::=",
+ /* 299 */ "db_name_cond_opt ::= db_name NK_DOT",
+ /* 300 */ "like_pattern_opt ::=",
+ /* 301 */ "like_pattern_opt ::= LIKE NK_STRING",
+ /* 302 */ "table_name_cond ::= table_name",
+ /* 303 */ "from_db_opt ::=",
+ /* 304 */ "from_db_opt ::= FROM db_name",
+ /* 305 */ "tag_list_opt ::=",
+ /* 306 */ "tag_list_opt ::= tag_item",
+ /* 307 */ "tag_list_opt ::= tag_list_opt NK_COMMA tag_item",
+ /* 308 */ "tag_item ::= TBNAME",
+ /* 309 */ "tag_item ::= QTAGS",
+ /* 310 */ "tag_item ::= column_name",
+ /* 311 */ "tag_item ::= column_name column_alias",
+ /* 312 */ "tag_item ::= column_name AS column_alias",
+ /* 313 */ "db_kind_opt ::=",
+ /* 314 */ "db_kind_opt ::= USER",
+ /* 315 */ "db_kind_opt ::= SYSTEM",
+ /* 316 */ "cmd ::= CREATE SMA INDEX not_exists_opt col_name ON full_table_name index_options",
+ /* 317 */ "cmd ::= CREATE INDEX not_exists_opt col_name ON full_table_name NK_LP col_name_list NK_RP",
+ /* 318 */ "cmd ::= DROP INDEX exists_opt full_index_name",
+ /* 319 */ "full_index_name ::= index_name",
+ /* 320 */ "full_index_name ::= db_name NK_DOT index_name",
+ /* 321 */ "index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_RP sliding_opt sma_stream_opt",
+ /* 322 */ "index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt sma_stream_opt",
+ /* 323 */ "func_list ::= func",
+ /* 324 */ "func_list ::= func_list NK_COMMA func",
+ /* 325 */ "func ::= sma_func_name NK_LP expression_list NK_RP",
+ /* 326 */ "sma_func_name ::= function_name",
+ /* 327 */ "sma_func_name ::= COUNT",
+ /* 328 */ "sma_func_name ::= FIRST",
+ /* 329 */ "sma_func_name ::= LAST",
+ /* 330 */ "sma_func_name ::= LAST_ROW",
+ /* 331 */ "sma_stream_opt ::=",
+ /* 332 */ "sma_stream_opt ::= sma_stream_opt WATERMARK duration_literal",
+ /* 333 */ "sma_stream_opt ::= sma_stream_opt MAX_DELAY duration_literal",
+ /* 334 */ "sma_stream_opt ::= sma_stream_opt DELETE_MARK duration_literal",
+ /* 335 */ "with_meta ::= AS",
+ /* 336 */ "with_meta ::= WITH META AS",
+ /* 337 */ "with_meta ::= ONLY META AS",
+ /* 338 */ "cmd ::= CREATE TOPIC not_exists_opt topic_name AS query_or_subquery",
+ /* 339 */ "cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta DATABASE db_name",
+ /* 340 */ "cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta STABLE full_table_name where_clause_opt",
+ /* 341 */ "cmd ::= DROP TOPIC exists_opt topic_name",
+ /* 342 */ "cmd ::= DROP CONSUMER GROUP exists_opt cgroup_name ON topic_name",
+ /* 343 */ "cmd ::= DESC full_table_name",
+ /* 344 */ "cmd ::= DESCRIBE full_table_name",
+ /* 345 */ "cmd ::= RESET QUERY CACHE",
+ /* 346 */ "cmd ::= EXPLAIN analyze_opt explain_options query_or_subquery",
+ /* 347 */ "cmd ::= EXPLAIN analyze_opt explain_options insert_query",
+ /* 348 */ "analyze_opt ::=",
+ /* 349 */ "analyze_opt ::= ANALYZE",
+ /* 350 */ "explain_options ::=",
+ /* 351 */ "explain_options ::= explain_options VERBOSE NK_BOOL",
+ /* 352 */ "explain_options ::= explain_options RATIO NK_FLOAT",
+ /* 353 */ "cmd ::= CREATE or_replace_opt agg_func_opt FUNCTION not_exists_opt function_name AS NK_STRING OUTPUTTYPE type_name bufsize_opt language_opt",
+ /* 354 */ "cmd ::= DROP FUNCTION exists_opt function_name",
+ /* 355 */ "agg_func_opt ::=",
+ /* 356 */ "agg_func_opt ::= AGGREGATE",
+ /* 357 */ "bufsize_opt ::=",
+ /* 358 */ "bufsize_opt ::= BUFSIZE NK_INTEGER",
+ /* 359 */ "language_opt ::=",
+ /* 360 */ "language_opt ::= LANGUAGE NK_STRING",
+ /* 361 */ "or_replace_opt ::=",
+ /* 362 */ "or_replace_opt ::= OR REPLACE",
+ /* 363 */ "cmd ::= CREATE or_replace_opt VIEW full_view_name AS query_or_subquery",
+ /* 364 */ "cmd ::= DROP VIEW exists_opt full_view_name",
+ /* 365 */ "full_view_name ::= view_name",
+ /* 366 */ "full_view_name ::= db_name NK_DOT view_name",
+ /* 367 */ "cmd ::= CREATE STREAM not_exists_opt stream_name stream_options INTO full_table_name col_list_opt tag_def_or_ref_opt subtable_opt AS query_or_subquery",
+ /* 368 */ "cmd ::= DROP STREAM exists_opt stream_name",
+ /* 369 */ "cmd ::= PAUSE STREAM exists_opt stream_name",
+ /* 370 */ "cmd ::= RESUME STREAM exists_opt ignore_opt stream_name",
+ /* 371 */ "col_list_opt ::=",
+ /* 372 */ "col_list_opt ::= NK_LP col_name_list NK_RP",
+ /* 373 */ "tag_def_or_ref_opt ::=",
+ /* 374 */ "tag_def_or_ref_opt ::= tags_def",
+ /* 375 */ "tag_def_or_ref_opt ::= TAGS NK_LP col_name_list NK_RP",
+ /* 376 */ "stream_options ::=",
+ /* 377 */ "stream_options ::= stream_options TRIGGER AT_ONCE",
+ /* 378 */ "stream_options ::= stream_options TRIGGER WINDOW_CLOSE",
+ /* 379 */ "stream_options ::= stream_options TRIGGER MAX_DELAY duration_literal",
+ /* 380 */ "stream_options ::= stream_options WATERMARK duration_literal",
+ /* 381 */ "stream_options ::= stream_options IGNORE EXPIRED NK_INTEGER",
+ /* 382 */ "stream_options ::= stream_options FILL_HISTORY NK_INTEGER",
+ /* 383 */ "stream_options ::= stream_options DELETE_MARK duration_literal",
+ /* 384 */ "stream_options ::= stream_options IGNORE UPDATE NK_INTEGER",
+ /* 385 */ "subtable_opt ::=",
+ /* 386 */ "subtable_opt ::= SUBTABLE NK_LP expression NK_RP",
+ /* 387 */ "ignore_opt ::=",
+ /* 388 */ "ignore_opt ::= IGNORE UNTREATED",
+ /* 389 */ "cmd ::= KILL CONNECTION NK_INTEGER",
+ /* 390 */ "cmd ::= KILL QUERY NK_STRING",
+ /* 391 */ "cmd ::= KILL TRANSACTION NK_INTEGER",
+ /* 392 */ "cmd ::= KILL COMPACT NK_INTEGER",
+ /* 393 */ "cmd ::= BALANCE VGROUP",
+ /* 394 */ "cmd ::= BALANCE VGROUP LEADER on_vgroup_id",
+ /* 395 */ "cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER",
+ /* 396 */ "cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list",
+ /* 397 */ "cmd ::= SPLIT VGROUP NK_INTEGER",
+ /* 398 */ "on_vgroup_id ::=",
+ /* 399 */ "on_vgroup_id ::= ON NK_INTEGER",
+ /* 400 */ "dnode_list ::= DNODE NK_INTEGER",
+ /* 401 */ "dnode_list ::= dnode_list DNODE NK_INTEGER",
+ /* 402 */ "cmd ::= DELETE FROM full_table_name where_clause_opt",
+ /* 403 */ "cmd ::= query_or_subquery",
+ /* 404 */ "cmd ::= insert_query",
+ /* 405 */ "insert_query ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery",
+ /* 406 */ "insert_query ::= INSERT INTO full_table_name query_or_subquery",
+ /* 407 */ "literal ::= NK_INTEGER",
+ /* 408 */ "literal ::= NK_FLOAT",
+ /* 409 */ "literal ::= NK_STRING",
+ /* 410 */ "literal ::= NK_BOOL",
+ /* 411 */ "literal ::= TIMESTAMP NK_STRING",
+ /* 412 */ "literal ::= duration_literal",
+ /* 413 */ "literal ::= NULL",
+ /* 414 */ "literal ::= NK_QUESTION",
+ /* 415 */ "duration_literal ::= NK_VARIABLE",
+ /* 416 */ "signed ::= NK_INTEGER",
+ /* 417 */ "signed ::= NK_PLUS NK_INTEGER",
+ /* 418 */ "signed ::= NK_MINUS NK_INTEGER",
+ /* 419 */ "signed ::= NK_FLOAT",
+ /* 420 */ "signed ::= NK_PLUS NK_FLOAT",
+ /* 421 */ "signed ::= NK_MINUS NK_FLOAT",
+ /* 422 */ "signed_literal ::= signed",
+ /* 423 */ "signed_literal ::= NK_STRING",
+ /* 424 */ "signed_literal ::= NK_BOOL",
+ /* 425 */ "signed_literal ::= TIMESTAMP NK_STRING",
+ /* 426 */ "signed_literal ::= duration_literal",
+ /* 427 */ "signed_literal ::= NULL",
+ /* 428 */ "signed_literal ::= literal_func",
+ /* 429 */ "signed_literal ::= NK_QUESTION",
+ /* 430 */ "literal_list ::= signed_literal",
+ /* 431 */ "literal_list ::= literal_list NK_COMMA signed_literal",
+ /* 432 */ "db_name ::= NK_ID",
+ /* 433 */ "table_name ::= NK_ID",
+ /* 434 */ "column_name ::= NK_ID",
+ /* 435 */ "function_name ::= NK_ID",
+ /* 436 */ "view_name ::= NK_ID",
+ /* 437 */ "table_alias ::= NK_ID",
+ /* 438 */ "column_alias ::= NK_ID",
+ /* 439 */ "column_alias ::= NK_ALIAS",
+ /* 440 */ "user_name ::= NK_ID",
+ /* 441 */ "topic_name ::= NK_ID",
+ /* 442 */ "stream_name ::= NK_ID",
+ /* 443 */ "cgroup_name ::= NK_ID",
+ /* 444 */ "index_name ::= NK_ID",
+ /* 445 */ "expr_or_subquery ::= expression",
+ /* 446 */ "expression ::= literal",
+ /* 447 */ "expression ::= pseudo_column",
+ /* 448 */ "expression ::= column_reference",
+ /* 449 */ "expression ::= function_expression",
+ /* 450 */ "expression ::= case_when_expression",
+ /* 451 */ "expression ::= NK_LP expression NK_RP",
+ /* 452 */ "expression ::= NK_PLUS expr_or_subquery",
+ /* 453 */ "expression ::= NK_MINUS expr_or_subquery",
+ /* 454 */ "expression ::= expr_or_subquery NK_PLUS expr_or_subquery",
+ /* 455 */ "expression ::= expr_or_subquery NK_MINUS expr_or_subquery",
+ /* 456 */ "expression ::= expr_or_subquery NK_STAR expr_or_subquery",
+ /* 457 */ "expression ::= expr_or_subquery NK_SLASH expr_or_subquery",
+ /* 458 */ "expression ::= expr_or_subquery NK_REM expr_or_subquery",
+ /* 459 */ "expression ::= column_reference NK_ARROW NK_STRING",
+ /* 460 */ "expression ::= expr_or_subquery NK_BITAND expr_or_subquery",
+ /* 461 */ "expression ::= expr_or_subquery NK_BITOR expr_or_subquery",
+ /* 462 */ "expression_list ::= expr_or_subquery",
+ /* 463 */ "expression_list ::= expression_list NK_COMMA expr_or_subquery",
+ /* 464 */ "column_reference ::= column_name",
+ /* 465 */ "column_reference ::= table_name NK_DOT column_name",
+ /* 466 */ "column_reference ::= NK_ALIAS",
+ /* 467 */ "column_reference ::= table_name NK_DOT NK_ALIAS",
+ /* 468 */ "pseudo_column ::= ROWTS",
+ /* 469 */ "pseudo_column ::= TBNAME",
+ /* 470 */ "pseudo_column ::= table_name NK_DOT TBNAME",
+ /* 471 */ "pseudo_column ::= QSTART",
+ /* 472 */ "pseudo_column ::= QEND",
+ /* 473 */ "pseudo_column ::= QDURATION",
+ /* 474 */ "pseudo_column ::= WSTART",
+ /* 475 */ "pseudo_column ::= WEND",
+ /* 476 */ "pseudo_column ::= WDURATION",
+ /* 477 */ "pseudo_column ::= IROWTS",
+ /* 478 */ "pseudo_column ::= ISFILLED",
+ /* 479 */ "pseudo_column ::= QTAGS",
+ /* 480 */ "function_expression ::= function_name NK_LP expression_list NK_RP",
+ /* 481 */ "function_expression ::= star_func NK_LP star_func_para_list NK_RP",
+ /* 482 */ "function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP",
+ /* 483 */ "function_expression ::= literal_func",
+ /* 484 */ "literal_func ::= noarg_func NK_LP NK_RP",
+ /* 485 */ "literal_func ::= NOW",
+ /* 486 */ "noarg_func ::= NOW",
+ /* 487 */ "noarg_func ::= TODAY",
+ /* 488 */ "noarg_func ::= TIMEZONE",
+ /* 489 */ "noarg_func ::= DATABASE",
+ /* 490 */ "noarg_func ::= CLIENT_VERSION",
+ /* 491 */ "noarg_func ::= SERVER_VERSION",
+ /* 492 */ "noarg_func ::= SERVER_STATUS",
+ /* 493 */ "noarg_func ::= CURRENT_USER",
+ /* 494 */ "noarg_func ::= USER",
+ /* 495 */ "star_func ::= COUNT",
+ /* 496 */ "star_func ::= FIRST",
+ /* 497 */ "star_func ::= LAST",
+ /* 498 */ "star_func ::= LAST_ROW",
+ /* 499 */ "star_func_para_list ::= NK_STAR",
+ /* 500 */ "star_func_para_list ::= other_para_list",
+ /* 501 */ "other_para_list ::= star_func_para",
+ /* 502 */ "other_para_list ::= other_para_list NK_COMMA star_func_para",
+ /* 503 */ "star_func_para ::= expr_or_subquery",
+ /* 504 */ "star_func_para ::= table_name NK_DOT NK_STAR",
+ /* 505 */ "case_when_expression ::= CASE when_then_list case_when_else_opt END",
+ /* 506 */ "case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END",
+ /* 507 */ "when_then_list ::= when_then_expr",
+ /* 508 */ "when_then_list ::= when_then_list when_then_expr",
+ /* 509 */ "when_then_expr ::= WHEN common_expression THEN common_expression",
+ /* 510 */ "case_when_else_opt ::=",
+ /* 511 */ "case_when_else_opt ::= ELSE common_expression",
+ /* 512 */ "predicate ::= expr_or_subquery compare_op expr_or_subquery",
+ /* 513 */ "predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery",
+ /* 514 */ "predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery",
+ /* 515 */ "predicate ::= expr_or_subquery IS NULL",
+ /* 516 */ "predicate ::= expr_or_subquery IS NOT NULL",
+ /* 517 */ "predicate ::= expr_or_subquery in_op in_predicate_value",
+ /* 518 */ "compare_op ::= NK_LT",
+ /* 519 */ "compare_op ::= NK_GT",
+ /* 520 */ "compare_op ::= NK_LE",
+ /* 521 */ "compare_op ::= NK_GE",
+ /* 522 */ "compare_op ::= NK_NE",
+ /* 523 */ "compare_op ::= NK_EQ",
+ /* 524 */ "compare_op ::= LIKE",
+ /* 525 */ "compare_op ::= NOT LIKE",
+ /* 526 */ "compare_op ::= MATCH",
+ /* 527 */ "compare_op ::= NMATCH",
+ /* 528 */ "compare_op ::= CONTAINS",
+ /* 529 */ "in_op ::= IN",
+ /* 530 */ "in_op ::= NOT IN",
+ /* 531 */ "in_predicate_value ::= NK_LP literal_list NK_RP",
+ /* 532 */ "boolean_value_expression ::= boolean_primary",
+ /* 533 */ "boolean_value_expression ::= NOT boolean_primary",
+ /* 534 */ "boolean_value_expression ::= boolean_value_expression OR boolean_value_expression",
+ /* 535 */ "boolean_value_expression ::= boolean_value_expression AND boolean_value_expression",
+ /* 536 */ "boolean_primary ::= predicate",
+ /* 537 */ "boolean_primary ::= NK_LP boolean_value_expression NK_RP",
+ /* 538 */ "common_expression ::= expr_or_subquery",
+ /* 539 */ "common_expression ::= boolean_value_expression",
+ /* 540 */ "from_clause_opt ::=",
+ /* 541 */ "from_clause_opt ::= FROM table_reference_list",
+ /* 542 */ "table_reference_list ::= table_reference",
+ /* 543 */ "table_reference_list ::= table_reference_list NK_COMMA table_reference",
+ /* 544 */ "table_reference ::= table_primary",
+ /* 545 */ "table_reference ::= joined_table",
+ /* 546 */ "table_primary ::= table_name alias_opt",
+ /* 547 */ "table_primary ::= db_name NK_DOT table_name alias_opt",
+ /* 548 */ "table_primary ::= subquery alias_opt",
+ /* 549 */ "table_primary ::= parenthesized_joined_table",
+ /* 550 */ "alias_opt ::=",
+ /* 551 */ "alias_opt ::= table_alias",
+ /* 552 */ "alias_opt ::= AS table_alias",
+ /* 553 */ "parenthesized_joined_table ::= NK_LP joined_table NK_RP",
+ /* 554 */ "parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP",
+ /* 555 */ "joined_table ::= table_reference join_type JOIN table_reference ON search_condition",
+ /* 556 */ "join_type ::=",
+ /* 557 */ "join_type ::= INNER",
+ /* 558 */ "query_specification ::= SELECT hint_list set_quantifier_opt tag_mode_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt",
+ /* 559 */ "hint_list ::=",
+ /* 560 */ "hint_list ::= NK_HINT",
+ /* 561 */ "tag_mode_opt ::=",
+ /* 562 */ "tag_mode_opt ::= TAGS",
+ /* 563 */ "set_quantifier_opt ::=",
+ /* 564 */ "set_quantifier_opt ::= DISTINCT",
+ /* 565 */ "set_quantifier_opt ::= ALL",
+ /* 566 */ "select_list ::= select_item",
+ /* 567 */ "select_list ::= select_list NK_COMMA select_item",
+ /* 568 */ "select_item ::= NK_STAR",
+ /* 569 */ "select_item ::= common_expression",
+ /* 570 */ "select_item ::= common_expression column_alias",
+ /* 571 */ "select_item ::= common_expression AS column_alias",
+ /* 572 */ "select_item ::= table_name NK_DOT NK_STAR",
+ /* 573 */ "where_clause_opt ::=",
+ /* 574 */ "where_clause_opt ::= WHERE search_condition",
+ /* 575 */ "partition_by_clause_opt ::=",
+ /* 576 */ "partition_by_clause_opt ::= PARTITION BY partition_list",
+ /* 577 */ "partition_list ::= partition_item",
+ /* 578 */ "partition_list ::= partition_list NK_COMMA partition_item",
+ /* 579 */ "partition_item ::= expr_or_subquery",
+ /* 580 */ "partition_item ::= expr_or_subquery column_alias",
+ /* 581 */ "partition_item ::= expr_or_subquery AS column_alias",
+ /* 582 */ "twindow_clause_opt ::=",
+ /* 583 */ "twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA interval_sliding_duration_literal NK_RP",
+ /* 584 */ "twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP",
+ /* 585 */ "twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_RP sliding_opt fill_opt",
+ /* 586 */ "twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_COMMA interval_sliding_duration_literal NK_RP sliding_opt fill_opt",
+ /* 587 */ "twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition",
+ /* 588 */ "sliding_opt ::=",
+ /* 589 */ "sliding_opt ::= SLIDING NK_LP interval_sliding_duration_literal NK_RP",
+ /* 590 */ "interval_sliding_duration_literal ::= NK_VARIABLE",
+ /* 591 */ "interval_sliding_duration_literal ::= NK_STRING",
+ /* 592 */ "interval_sliding_duration_literal ::= NK_INTEGER",
+ /* 593 */ "fill_opt ::=",
+ /* 594 */ "fill_opt ::= FILL NK_LP fill_mode NK_RP",
+ /* 595 */ "fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP",
+ /* 596 */ "fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP",
+ /* 597 */ "fill_mode ::= NONE",
+ /* 598 */ "fill_mode ::= PREV",
+ /* 599 */ "fill_mode ::= NULL",
+ /* 600 */ "fill_mode ::= NULL_F",
+ /* 601 */ "fill_mode ::= LINEAR",
+ /* 602 */ "fill_mode ::= NEXT",
+ /* 603 */ "group_by_clause_opt ::=",
+ /* 604 */ "group_by_clause_opt ::= GROUP BY group_by_list",
+ /* 605 */ "group_by_list ::= expr_or_subquery",
+ /* 606 */ "group_by_list ::= group_by_list NK_COMMA expr_or_subquery",
+ /* 607 */ "having_clause_opt ::=",
+ /* 608 */ "having_clause_opt ::= HAVING search_condition",
+ /* 609 */ "range_opt ::=",
+ /* 610 */ "range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP",
+ /* 611 */ "range_opt ::= RANGE NK_LP expr_or_subquery NK_RP",
+ /* 612 */ "every_opt ::=",
+ /* 613 */ "every_opt ::= EVERY NK_LP duration_literal NK_RP",
+ /* 614 */ "query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt",
+ /* 615 */ "query_simple ::= query_specification",
+ /* 616 */ "query_simple ::= union_query_expression",
+ /* 617 */ "union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery",
+ /* 618 */ "union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery",
+ /* 619 */ "query_simple_or_subquery ::= query_simple",
+ /* 620 */ "query_simple_or_subquery ::= subquery",
+ /* 621 */ "query_or_subquery ::= query_expression",
+ /* 622 */ "query_or_subquery ::= subquery",
+ /* 623 */ "order_by_clause_opt ::=",
+ /* 624 */ "order_by_clause_opt ::= ORDER BY sort_specification_list",
+ /* 625 */ "slimit_clause_opt ::=",
+ /* 626 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER",
+ /* 627 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER",
+ /* 628 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER",
+ /* 629 */ "limit_clause_opt ::=",
+ /* 630 */ "limit_clause_opt ::= LIMIT NK_INTEGER",
+ /* 631 */ "limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER",
+ /* 632 */ "limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER",
+ /* 633 */ "subquery ::= NK_LP query_expression NK_RP",
+ /* 634 */ "subquery ::= NK_LP subquery NK_RP",
+ /* 635 */ "search_condition ::= common_expression",
+ /* 636 */ "sort_specification_list ::= sort_specification",
+ /* 637 */ "sort_specification_list ::= sort_specification_list NK_COMMA sort_specification",
+ /* 638 */ "sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt",
+ /* 639 */ "ordering_specification_opt ::=",
+ /* 640 */ "ordering_specification_opt ::= ASC",
+ /* 641 */ "ordering_specification_opt ::= DESC",
+ /* 642 */ "null_ordering_opt ::=",
+ /* 643 */ "null_ordering_opt ::= NULLS FIRST",
+ /* 644 */ "null_ordering_opt ::= NULLS LAST",
 };
 #endif /* NDEBUG */
 
@@ -3173,267 +3169,267 @@ static void yy_destructor(
     */
 /********* Begin destructor definitions ***************************************/
       /* Default NON-TERMINAL Destructor */
-    case 347: /* cmd */
-    case 350: /* literal */
-    case 359: /* with_opt */
-    case 365: /* search_condition */
-    case 370: /* db_options */
-    case 372: /* alter_db_options */
-    case 374: /* start_opt */
-    case 375: /* end_opt */
-    case 379: /* signed */
-    case 381: /* retention */
-    case 382: /* full_table_name */
-    case 385: /* table_options */
-    case 389: /* alter_table_clause */
-    case 390: /* alter_table_options */
-    case 393: /* signed_literal */
-    case 394: /* create_subtable_clause */
-    case 397: /* drop_table_clause */
-    case 399: /* column_def */
-    case 403: /* duration_literal */
-    case 404: /* rollup_func_name */
-    case 406: /* col_name */
-    case 409: /* like_pattern_opt */
-    case 410: /* db_name_cond_opt */
-    case 411: /* table_name_cond */
-    case 412: /* from_db_opt */
-    case 415: /* tag_item */
-    case 417: /* index_options */
-    case 418: /* full_index_name */
-    case 421: /* sliding_opt */
-    case 422: /* sma_stream_opt */
-    case 423: /* func */
-    case 426: /* query_or_subquery */
-    case 427: /* where_clause_opt */
-    case 430: /* explain_options */
-    case 431: /* insert_query */
-    case 436: /* full_view_name */
-    case 439: /* stream_options */
-    case 442: /* subtable_opt */
-    case 444: /* expression */
-    case 447: /* literal_func */
-    case 450: /* expr_or_subquery */
-    case 451: /* pseudo_column */
-    case 452: /* column_reference */
-    case 453: /* function_expression */
-    case 454: /* case_when_expression */
-    case 459: /* star_func_para */
-    case 461: /* case_when_else_opt */
-    case 462: /* common_expression */
-    case 463: /* when_then_expr */
-    case 464: /* predicate */
-    case 467: /* in_predicate_value */
-    case 468: /* boolean_value_expression */
-    case 469: /* boolean_primary */
-    case 470: /* from_clause_opt */
-    case 471: /* table_reference_list */
-    case 472: /* table_reference */
-    case 473: /* table_primary */
-    case 474: /* joined_table */
-    case 476: /* subquery */
-    case 477: /* parenthesized_joined_table */
-    case 479: /* query_specification */
-    case 485: /* range_opt */
-    case 486: /* every_opt */
-    case 487: /* fill_opt */
-    case 488: /* twindow_clause_opt */
-    case 490: /* having_clause_opt */
-    case 491: /* select_item */
-    case 493: /* partition_item */
-    case 494: /* interval_sliding_duration_literal */
-    case 497: /* query_expression */
-    case 498: /* query_simple */
-    case 500: /* slimit_clause_opt */
-    case 501: /* limit_clause_opt */
-    case 502: /* union_query_expression */
-    case 503: /* query_simple_or_subquery */
-    case 505: /* sort_specification */
+    case 349: /* cmd */
+    case 352: /* literal */
+    case 361: /* with_opt */
+    case 367: /* search_condition */
+    case 372: /* db_options */
+    case 374: /* alter_db_options */
+    case 376: /* start_opt */
+    case 377: /* end_opt */
+    case 381: /* signed */
+    case 383: /* retention */
+    case 384: /* full_table_name */
+    case 387: /* table_options */
+    case 391: /* alter_table_clause */
+    case 392: /* alter_table_options */
+    case 395: /* signed_literal */
+    case 396: /* create_subtable_clause */
+    case 399: /* drop_table_clause */
+    case 401: /* column_def */
+    case 405: /* duration_literal */
+    case 406: /* rollup_func_name */
+    case 408: /* col_name */
+    case 411: /* like_pattern_opt */
+    case 412: /* db_name_cond_opt */
+    case 413: /* table_name_cond */
+    case 414: /* from_db_opt */
+    case 417: /* tag_item */
+    case 419: /* index_options */
+    case 420: /* full_index_name */
+    case 423: /* sliding_opt */
+    case 424: /* sma_stream_opt */
+    case 425: /* func */
+    case 428: /* query_or_subquery */
+    case 429: /* where_clause_opt */
+    case 432: /* explain_options */
+    case 433: /* insert_query */
+    case 438: /* full_view_name */
+    case 441: /* stream_options */
+    case 444: /* subtable_opt */
+    case 446: /* expression */
+    case 449: /* literal_func */
+    case 452: /* expr_or_subquery */
+    case 453: /* pseudo_column */
+    case 454: /* column_reference */
+    case 455: /* function_expression */
+    case 456: /* case_when_expression */
+    case 461: /* star_func_para */
+    case 463: /* case_when_else_opt */
+    case 464: /* common_expression */
+    case 465: /* when_then_expr */
+    case 466: /* predicate */
+    case 469: /* in_predicate_value */
+    case 470: /* boolean_value_expression */
+    case 471: /* boolean_primary */
+    case 472: /* from_clause_opt */
+    case 473: /* table_reference_list */
+    case 474: /* table_reference */
+    case 475: /* table_primary */
+    case 476: /* joined_table */
+    case 478: /* subquery */
+    case 479: /* parenthesized_joined_table */
+    case 481: /* query_specification */
+    case 487: /* range_opt */
+    case 488: /* every_opt */
+    case 489: /* fill_opt */
+    case 490: /* twindow_clause_opt */
+    case 492: /* having_clause_opt */
+    case 493: /* select_item */
+    case 495: /* partition_item */
+    case 496: /* interval_sliding_duration_literal */
+    case 499: /* query_expression */
+    case 500: /* query_simple */
+    case 502: /* slimit_clause_opt */
+    case 503: /* limit_clause_opt */
+    case 504: /* union_query_expression */
+    case 505: /* query_simple_or_subquery */
+    case 507: /* sort_specification */
 {
 #line 7 "sql.y"
- nodesDestroyNode((yypminor->yy232)); 
-#line 3255 "sql.c"
+ nodesDestroyNode((yypminor->yy992)); 
+#line 3251 "sql.c"
 }
       break;
-    case 348: /* account_options */
-    case 349: /* alter_account_options */
-    case 351: /* alter_account_option */
-    case 373: /* speed_opt */
-    case 425: /* with_meta */
-    case 434: /* bufsize_opt */
+    case 350: /* account_options */
+    case 351: /* alter_account_options */
+    case 353: /* alter_account_option */
+    case 375: /* speed_opt */
+    case 427: /* with_meta */
+    case 436: /* bufsize_opt */
 {
 #line 54 "sql.y"
  
-#line 3267 "sql.c"
+#line 3263 "sql.c"
 }
       break;
-    case 352: /* ip_range_list */
-    case 353: /* white_list */
-    case 354: /* white_list_opt */
-    case 376: /* integer_list */
-    case 377: /* variable_list */
-    case 378: /* retention_list */
-    case 383: /* column_def_list */
-    case 384: /* tags_def_opt */
-    case 386: /* multi_create_clause */
-    case 387: /* tags_def */
-    case 388: /* multi_drop_clause */
-    case 395: /* specific_cols_opt */
-    case 396: /* expression_list */
-    case 398: /* col_name_list */
-    case 400: /* duration_list */
-    case 401: /* rollup_func_list */
-    case 413: /* tag_list_opt */
-    case 420: /* func_list */
-    case 440: /* col_list_opt */
-    case 441: /* tag_def_or_ref_opt */
-    case 446: /* dnode_list */
-    case 448: /* literal_list */
-    case 456: /* star_func_para_list */
-    case 458: /* other_para_list */
-    case 460: /* when_then_list */
-    case 480: /* hint_list */
-    case 483: /* select_list */
-    case 484: /* partition_by_clause_opt */
-    case 489: /* group_by_clause_opt */
-    case 492: /* partition_list */
-    case 496: /* group_by_list */
-    case 499: /* order_by_clause_opt */
-    case 504: /* sort_specification_list */
+    case 354: /* ip_range_list */
+    case 355: /* white_list */
+    case 356: /* white_list_opt */
+    case 378: /* integer_list */
+    case 379: /* variable_list */
+    case 380: /* retention_list */
+    case 385: /* column_def_list */
+    case 386: /* tags_def_opt */
+    case 388: /* multi_create_clause */
+    case 389: /* tags_def */
+    case 390: /* multi_drop_clause */
+    case 397: /* specific_cols_opt */
+    case 398: /* expression_list */
+    case 400: /* col_name_list */
+    case 402: /* duration_list */
+    case 403: /* rollup_func_list */
+    case 415: /* tag_list_opt */
+    case 422: /* func_list */
+    case 442: /* col_list_opt */
+    case 443: /* tag_def_or_ref_opt */
+    case 448: /* dnode_list */
+    case 450: /* literal_list */
+    case 458: /* star_func_para_list */
+    case 460: /* other_para_list */
+    case 462: /* when_then_list */
+    case 482: /* hint_list */
+    case 485: /* select_list */
+    case 486: /* partition_by_clause_opt */
+    case 491: /* group_by_clause_opt */
+    case 494: /* partition_list */
+    case 498: /* group_by_list */
+    case 501: /* order_by_clause_opt */
+    case 506: /* sort_specification_list */
 {
 #line 85 "sql.y"
- nodesDestroyList((yypminor->yy88)); 
-#line 3306 "sql.c"
+ nodesDestroyList((yypminor->yy364)); 
+#line 3302 "sql.c"
 }
       break;
-    case 355: /* user_name */
-    case 362: /* db_name */
-    case 363: /* table_name */
-    case 364: /* topic_name */
-    case 366: /* dnode_endpoint */
-    case 391: /* column_name */
-    case 405: /* function_name */
-    case 416: /* column_alias */
-    case 419: /* index_name */
-    case 424: /* sma_func_name */
-    case 428: /* cgroup_name */
-    case 435: /* language_opt */
-    case 437: /* view_name */
-    case 438: /* stream_name */
-    case 445: /* on_vgroup_id */
-    case 449: /* table_alias */
-    case 455: /* star_func */
-    case 457: /* noarg_func */
-    case 475: /* alias_opt */
+    case 357: /* user_name */
+    case 364: /* db_name */
+    case 365: /* table_name */
+    case 366: /* topic_name */
+    case 368: /* dnode_endpoint */
+    case 393: /* column_name */
+    case 407: /* function_name */
+    case 418: /* column_alias */
+    case 421: /* index_name */
+    case 426: /* sma_func_name */
+    case 430: /* cgroup_name */
+    case 437: /* language_opt */
+    case 439: /* view_name */
+    case 440: /* stream_name */
+    case 447: /* on_vgroup_id */
+    case 451: /* table_alias */
+    case 457: /* star_func */
+    case 459: /* noarg_func */
+    case 477: /* alias_opt */
 {
-#line 812 "sql.y"
+#line 815 "sql.y"
  
-#line 3331 "sql.c"
+#line 3327 "sql.c"
 }
       break;
-    case 356: /* sysinfo_opt */
+    case 358: /* sysinfo_opt */
 {
 #line 112 "sql.y"
  
-#line 3338 "sql.c"
+#line 3334 "sql.c"
 }
       break;
-    case 357: /* privileges */
-    case 360: /* priv_type_list */
-    case 361: /* priv_type */
+    case 359: /* privileges */
+    case 362: /* priv_type_list */
+    case 363: /* priv_type */
 {
 #line 121 "sql.y"
  
-#line 3347 "sql.c"
+#line 3343 "sql.c"
 }
       break;
-    case 358: /* priv_level */
+    case 360: /* priv_level */
 {
 #line 138 "sql.y"
  
-#line 3354 "sql.c"
+#line 3350 "sql.c"
 }
       break;
-    case 367: /* force_opt */
-    case 368: /* unsafe_opt */
-    case 369: /* not_exists_opt */
-    case 371: /* exists_opt */
-    case 429: /* analyze_opt */
-    case 432: /* or_replace_opt */
-    case 433: /* agg_func_opt */
-    case 443: /* ignore_opt */
-    case 481: /* set_quantifier_opt */
-    case 482: /* tag_mode_opt */
+    case 369: /* force_opt */
+    case 370: /* unsafe_opt */
+    case 371: /* not_exists_opt */
+    case 373: /* exists_opt */
+    case 431: /* analyze_opt */
+    case 434: /* or_replace_opt */
+    case 435: /* agg_func_opt */
+    case 445: /* ignore_opt */
+    case 483: /* set_quantifier_opt */
+    case 484: /* tag_mode_opt */
 {
 #line 167 "sql.y"
  
-#line 3370 "sql.c"
+#line 3366 "sql.c"
 }
       break;
-    case 380: /* alter_db_option */
-    case 402: /* alter_table_option */
+    case 382: /* alter_db_option */
+    case 404: /* alter_table_option */
 {
-#line 265 "sql.y"
+#line 266 "sql.y"
  
-#line 3378 "sql.c"
+#line 3374 "sql.c"
 }
       break;
-    case 392: /* type_name */
+    case 394: /* type_name */
 {
-#line 388 "sql.y"
+#line 390 "sql.y"
  
-#line 3385 "sql.c"
+#line 3381 "sql.c"
 }
       break;
-    case 407: /* db_kind_opt */
-    case 414: /* table_kind */
+    case 409: /* db_kind_opt */
+    case 416: /* table_kind */
 {
-#line 553 "sql.y"
+#line 556 "sql.y"
  
-#line 3393 "sql.c"
+#line 3389 "sql.c"
 }
       break;
-    case 408: /* table_kind_db_name_cond_opt */
+    case 410: /* table_kind_db_name_cond_opt */
 {
-#line 518 "sql.y"
+#line 521 "sql.y"
  
-#line 3400 "sql.c"
+#line 3396 "sql.c"
 }
       break;
-    case 465: /* compare_op */
-    case 466: /* in_op */
+    case 467: /* compare_op */
+    case 468: /* in_op */
 {
-#line 1002 "sql.y"
+#line 1005 "sql.y"
  
-#line 3408 "sql.c"
+#line 3404 "sql.c"
 }
       break;
-    case 478: /* join_type */
+    case 480: /* join_type */
 {
-#line 1078 "sql.y"
+#line 1081 "sql.y"
  
-#line 3415 "sql.c"
+#line 3411 "sql.c"
 }
       break;
-    case 495: /* fill_mode */
+    case 497: /* fill_mode */
 {
-#line 1169 "sql.y"
+#line 1172 "sql.y"
  
-#line 3422 "sql.c"
+#line 3418 "sql.c"
 }
       break;
-    case 506: /* ordering_specification_opt */
+    case 508: /* ordering_specification_opt */
 {
-#line 1254 "sql.y"
+#line 1257 "sql.y"
  
-#line 3429 "sql.c"
+#line 3425 "sql.c"
 }
       break;
-    case 507: /* null_ordering_opt */
+    case 509: /* null_ordering_opt */
 {
-#line 1260 "sql.y"
+#line 1263 "sql.y"
  
-#line 3436 "sql.c"
+#line 3432 "sql.c"
 }
       break;
 /********* End destructor definitions *****************************************/
@@ -3722,648 +3718,651 @@ static void yy_shift(
 /* For rule J, yyRuleInfoLhs[J] contains the symbol on the left-hand side
 ** of that rule */
 static const YYCODETYPE yyRuleInfoLhs[] = {
-   347,  /* (0) cmd ::= CREATE ACCOUNT NK_ID PASS NK_STRING account_options */
-   347,  /* (1) cmd ::= ALTER ACCOUNT NK_ID alter_account_options */
-   348,  /* (2) account_options ::= */
-   348,  /* (3) account_options ::= account_options PPS literal */
-   348,  /* (4) account_options ::= account_options TSERIES literal */
-   348,  /* (5) account_options ::= account_options STORAGE literal */
-   348,  /* (6) account_options ::= account_options STREAMS literal */
-   348,  /* (7) account_options ::= account_options QTIME literal */
-   348,  /* (8) account_options ::= account_options DBS literal */
-   348,  /* (9) account_options ::= account_options USERS literal */
-   348,  /* (10) account_options ::= account_options CONNS literal */
-   348,  /* (11) account_options ::= account_options STATE literal */
-   349,  /* (12) alter_account_options ::= alter_account_option */
-   349,  /* (13) alter_account_options ::= alter_account_options alter_account_option */
-   351,  /* (14) alter_account_option ::= PASS literal */
-   351,  /* (15) alter_account_option ::= PPS literal */
-   351,  /* (16) alter_account_option ::= TSERIES literal */
-   351,  /* (17) alter_account_option ::= STORAGE literal */
-   351,  /* (18) alter_account_option ::= STREAMS literal */
-   351,  /* (19) alter_account_option ::= QTIME literal */
-   351,  /* (20) alter_account_option ::= DBS literal */
-   351,  /* (21) alter_account_option ::= USERS literal */
-   351,  /* (22) alter_account_option ::= CONNS literal */
-   351,  /* (23) alter_account_option ::= STATE literal */
-   352,  /* (24) ip_range_list ::= NK_STRING */
-   352,  /* (25) ip_range_list ::= ip_range_list NK_COMMA NK_STRING */
-   353,  /* (26) white_list ::= HOST ip_range_list */
-   354,  /* (27) white_list_opt ::= */
-   354,  /* (28) white_list_opt ::= white_list */
-   347,  /* (29) cmd ::= CREATE USER user_name PASS NK_STRING sysinfo_opt white_list_opt */
-   347,  /* (30) cmd ::= ALTER USER user_name PASS NK_STRING */
-   347,  /* (31) cmd ::= ALTER USER user_name ENABLE NK_INTEGER */
-   347,  /* (32) cmd ::= ALTER USER user_name SYSINFO NK_INTEGER */
-   347,  /* (33) cmd ::= ALTER USER user_name ADD white_list */
-   347,  /* (34) cmd ::= ALTER USER user_name DROP white_list */
-   347,  /* (35) cmd ::= DROP USER user_name */
-   356,  /* (36) sysinfo_opt ::= */
-   356,  /* (37) sysinfo_opt ::= SYSINFO NK_INTEGER */
-   347,  /* (38) cmd ::= GRANT privileges ON priv_level with_opt TO user_name */
-   347,  /* (39) cmd ::= REVOKE privileges ON priv_level with_opt FROM user_name */
-   357,  /* (40) privileges ::= ALL */
-   357,  /* (41) privileges ::= priv_type_list */
-   357,  /* (42) privileges ::= SUBSCRIBE */
-   360,  /* (43) priv_type_list ::= priv_type */
-   360,  /* (44) priv_type_list ::= priv_type_list NK_COMMA priv_type */
-   361,  /* (45) priv_type ::= READ */
-   361,  /* (46) priv_type ::= WRITE */
-   361,  /* (47) priv_type ::= ALTER */
-   358,  /* (48) priv_level ::= NK_STAR NK_DOT NK_STAR */
-   358,  /* (49) priv_level ::= db_name NK_DOT NK_STAR */
-   358,  /* (50) priv_level ::= db_name NK_DOT table_name */
-   358,  /* (51) priv_level ::= topic_name */
-   359,  /* (52) with_opt ::= */
-   359,  /* (53) with_opt ::= WITH search_condition */
-   347,  /* (54) cmd ::= CREATE DNODE dnode_endpoint */
-   347,  /* (55) cmd ::= CREATE DNODE dnode_endpoint PORT NK_INTEGER */
-   347,  /* (56) cmd ::= DROP DNODE NK_INTEGER force_opt */
-   347,  /* (57) cmd ::= DROP DNODE dnode_endpoint force_opt */
-   347,  /* (58) cmd ::= DROP DNODE NK_INTEGER unsafe_opt */
-   347,  /* (59) cmd ::= DROP DNODE dnode_endpoint unsafe_opt */
-   347,  /* (60) cmd ::= ALTER DNODE NK_INTEGER NK_STRING */
-   347,  /* (61) cmd ::= ALTER DNODE NK_INTEGER NK_STRING NK_STRING */
-   347,  /* (62) cmd ::= ALTER ALL DNODES NK_STRING */
-   347,  /* (63) cmd ::= ALTER ALL DNODES NK_STRING NK_STRING */
-   347,  /* (64) cmd ::= RESTORE DNODE NK_INTEGER */
-   366,  /* (65) dnode_endpoint ::= NK_STRING */
-   366,  /* (66) dnode_endpoint ::= NK_ID */
-   366,  /* (67) dnode_endpoint ::= NK_IPTOKEN */
-   367,  /* (68) force_opt ::= */
-   367,  /* (69) force_opt ::= FORCE */
-   368,  /* (70) unsafe_opt ::= UNSAFE */
-   347,  /* (71) cmd ::= ALTER LOCAL NK_STRING */
-   347,  /* (72) cmd ::= ALTER LOCAL NK_STRING NK_STRING */
-   347,  /* (73) cmd ::= CREATE QNODE ON DNODE NK_INTEGER */
-   347,  /* (74) cmd ::= DROP QNODE ON DNODE NK_INTEGER */
-   347,  /* (75) cmd ::= RESTORE QNODE ON DNODE NK_INTEGER */
-   347,  /* (76) cmd ::= CREATE BNODE ON DNODE NK_INTEGER */
-   347,  /* (77) cmd ::= DROP BNODE ON DNODE NK_INTEGER */
-   347,  /* (78) cmd ::= CREATE SNODE ON DNODE NK_INTEGER */
-   347,  /* (79) cmd ::= DROP SNODE ON DNODE NK_INTEGER */
-   347,  /* (80) cmd ::= CREATE MNODE ON DNODE NK_INTEGER */
-   347,  /* (81) cmd ::= DROP MNODE ON DNODE NK_INTEGER */
-   347,  /* (82) cmd ::= RESTORE MNODE ON DNODE NK_INTEGER */
-   347,  /* (83) cmd ::= RESTORE VNODE ON DNODE NK_INTEGER */
-   347,  /* (84) cmd ::= CREATE DATABASE not_exists_opt db_name db_options */
-   347,  /* (85) cmd ::= DROP DATABASE exists_opt db_name */
-   347,  /* (86) cmd ::= USE db_name */
-   347,  /* (87) cmd ::= ALTER DATABASE db_name alter_db_options */
-   347,  /* (88) cmd ::= FLUSH DATABASE db_name */
-   347,  /* (89) cmd ::= TRIM DATABASE db_name speed_opt */
-   347,  /* (90) cmd ::= COMPACT DATABASE db_name start_opt end_opt */
-   369,  /* (91) not_exists_opt ::= IF NOT EXISTS */
-   369,  /* (92) not_exists_opt ::= */
-   371,  /* (93) exists_opt ::= IF EXISTS */
-   371,  /* (94) exists_opt ::= */
-   370,  /* (95) db_options ::= */
-   370,  /* (96) db_options ::= db_options BUFFER NK_INTEGER */
-   370,  /* (97) db_options ::= db_options CACHEMODEL NK_STRING */
-   370,  /* (98) db_options ::= db_options CACHESIZE NK_INTEGER */
-   370,  /* (99) db_options ::= db_options COMP NK_INTEGER */
-   370,  /* (100) db_options ::= db_options DURATION NK_INTEGER */
-   370,  /* (101) db_options ::= db_options DURATION NK_VARIABLE */
-   370,  /* (102) db_options ::= db_options MAXROWS NK_INTEGER */
-   370,  /* (103) db_options ::= db_options MINROWS NK_INTEGER */
-   370,  /* (104) db_options ::= db_options KEEP integer_list */
-   370,  /* (105) db_options ::= db_options KEEP variable_list */
-   370,  /* (106) db_options ::= db_options PAGES NK_INTEGER */
-   370,  /* (107) db_options ::= db_options PAGESIZE NK_INTEGER */
-   370,  /* (108) db_options ::= db_options TSDB_PAGESIZE NK_INTEGER */
-   370,  /* (109) db_options ::= db_options PRECISION NK_STRING */
-   370,  /* (110) db_options ::= db_options REPLICA NK_INTEGER */
-   370,  /* (111) db_options ::= db_options VGROUPS NK_INTEGER */
-   370,  /* (112) db_options ::= db_options SINGLE_STABLE NK_INTEGER */
-   370,  /* (113) db_options ::= db_options RETENTIONS retention_list */
-   370,  /* (114) db_options ::= db_options SCHEMALESS NK_INTEGER */
-   370,  /* (115) db_options ::= db_options WAL_LEVEL NK_INTEGER */
-   370,  /* (116) db_options ::= db_options WAL_FSYNC_PERIOD NK_INTEGER */
-   370,  /* (117) db_options ::= db_options WAL_RETENTION_PERIOD NK_INTEGER */
-   370,  /* (118) db_options ::= db_options WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
-   370,  /* (119) db_options ::= db_options WAL_RETENTION_SIZE NK_INTEGER */
-   370,  /* (120) db_options ::= db_options WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
-   370,  /* (121) db_options ::= db_options WAL_ROLL_PERIOD NK_INTEGER */
-   370,  /* (122) db_options ::= db_options WAL_SEGMENT_SIZE NK_INTEGER */
-   370,  /* (123) db_options ::= db_options STT_TRIGGER NK_INTEGER */
-   370,  /* (124) db_options ::= db_options TABLE_PREFIX signed */
-   370,  /* (125) db_options ::= db_options TABLE_SUFFIX signed */
-   370,  /* (126) db_options ::= db_options KEEP_TIME_OFFSET NK_INTEGER */
-   372,  /* (127) alter_db_options ::= alter_db_option */
-   372,  /* (128) alter_db_options ::= alter_db_options alter_db_option */
-   380,  /* (129) alter_db_option ::= BUFFER NK_INTEGER */
-   380,  /* (130) alter_db_option ::= CACHEMODEL NK_STRING */
-   380,  /* (131) alter_db_option ::= CACHESIZE NK_INTEGER */
-   380,  /* (132) alter_db_option ::= WAL_FSYNC_PERIOD NK_INTEGER */
-   380,  /* (133) alter_db_option ::= KEEP integer_list */
-   380,  /* (134) alter_db_option ::= KEEP variable_list */
-   380,  /* (135) alter_db_option ::= PAGES NK_INTEGER */
-   380,  /* (136) alter_db_option ::= REPLICA NK_INTEGER */
-   380,  /* (137) alter_db_option ::= WAL_LEVEL NK_INTEGER */
-   380,  /* (138) alter_db_option ::= STT_TRIGGER NK_INTEGER */
-   380,  /* (139) alter_db_option ::= MINROWS NK_INTEGER */
-   380,  /* (140) alter_db_option ::= WAL_RETENTION_PERIOD NK_INTEGER */
-   380,  /* (141) alter_db_option ::= WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
-   380,  /* (142) alter_db_option ::= WAL_RETENTION_SIZE NK_INTEGER */
-   380,  /* (143) alter_db_option ::= WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
-   380,  /* (144) alter_db_option ::= KEEP_TIME_OFFSET NK_INTEGER */
-   376,  /* (145) integer_list ::= NK_INTEGER */
-   376,  /* (146) integer_list ::= integer_list NK_COMMA NK_INTEGER */
-   377,  /* (147) variable_list ::= NK_VARIABLE */
-   377,  /* (148) variable_list ::= variable_list NK_COMMA NK_VARIABLE */
-   378,  /* (149) retention_list ::= retention */
-   378,  /* (150) retention_list ::= retention_list NK_COMMA retention */
-   381,  /* (151) retention ::= NK_VARIABLE NK_COLON NK_VARIABLE */
-   381,  /* (152) retention ::= NK_MINUS NK_COLON NK_VARIABLE */
-   373,  /* (153) speed_opt ::= */
-   373,  /* (154) speed_opt ::= BWLIMIT NK_INTEGER */
-   374,  /* (155) start_opt ::= */
-   374,  /* (156) start_opt ::= START WITH NK_INTEGER */
-   374,  /* (157) start_opt ::= START WITH NK_STRING */
-   374,  /* (158) start_opt ::= START WITH TIMESTAMP NK_STRING */
-   375,  /* (159) end_opt ::= */
-   375,  /* (160) end_opt ::= END WITH NK_INTEGER */
-   375,  /* (161) end_opt ::= END WITH NK_STRING */
-   375,  /* (162) end_opt ::= END WITH TIMESTAMP NK_STRING */
-   347,  /* (163) cmd ::= CREATE TABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def_opt table_options */
-   347,  /* (164) cmd ::= CREATE TABLE multi_create_clause */
-   347,  /* (165) cmd ::= CREATE STABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def table_options */
-   347,  /* (166) cmd ::= DROP TABLE multi_drop_clause */
-   347,  /* (167) cmd ::= DROP STABLE exists_opt full_table_name */
-   347,  /* (168) cmd ::= ALTER TABLE alter_table_clause */
-   347,  /* (169) cmd ::= ALTER STABLE alter_table_clause */
-   389,  /* (170) alter_table_clause ::= full_table_name alter_table_options */
-   389,  /* (171) alter_table_clause ::= full_table_name ADD COLUMN column_name type_name */
-   389,  /* (172) alter_table_clause ::= full_table_name DROP COLUMN column_name */
-   389,  /* (173) alter_table_clause ::= full_table_name MODIFY COLUMN column_name type_name */
-   389,  /* (174) alter_table_clause ::= full_table_name RENAME COLUMN column_name column_name */
-   389,  /* (175) alter_table_clause ::= full_table_name ADD TAG column_name type_name */
-   389,  /* (176) alter_table_clause ::= full_table_name DROP TAG column_name */
-   389,  /* (177) alter_table_clause ::= full_table_name MODIFY TAG column_name type_name */
-   389,  /* (178) alter_table_clause ::= full_table_name RENAME TAG column_name column_name */
-   389,  /* (179) alter_table_clause ::= full_table_name SET TAG column_name NK_EQ signed_literal */
-   386,  /* (180) multi_create_clause ::= create_subtable_clause */
-   386,  /* (181) multi_create_clause ::= multi_create_clause create_subtable_clause */
-   394,  /* (182) create_subtable_clause ::= not_exists_opt full_table_name USING full_table_name specific_cols_opt TAGS NK_LP expression_list NK_RP table_options */
-   388,  /* (183) multi_drop_clause ::= drop_table_clause */
-   388,  /* (184) multi_drop_clause ::= multi_drop_clause NK_COMMA drop_table_clause */
-   397,  /* (185) drop_table_clause ::= exists_opt full_table_name */
-   395,  /* (186) specific_cols_opt ::= */
-   395,  /* (187) specific_cols_opt ::= NK_LP col_name_list NK_RP */
-   382,  /* (188) full_table_name ::= table_name */
-   382,  /* (189) full_table_name ::= db_name NK_DOT table_name */
-   383,  /* (190) column_def_list ::= column_def */
-   383,  /* (191) column_def_list ::= column_def_list NK_COMMA column_def */
-   399,  /* (192) column_def ::= column_name type_name */
-   392,  /* (193) type_name ::= BOOL */
-   392,  /* (194) type_name ::= TINYINT */
-   392,  /* (195) type_name ::= SMALLINT */
-   392,  /* (196) type_name ::= INT */
-   392,  /* (197) type_name ::= INTEGER */
-   392,  /* (198) type_name ::= BIGINT */
-   392,  /* (199) type_name ::= FLOAT */
-   392,  /* (200) type_name ::= DOUBLE */
-   392,  /* (201) type_name ::= BINARY NK_LP NK_INTEGER NK_RP */
-   392,  /* (202) type_name ::= TIMESTAMP */
-   392,  /* (203) type_name ::= NCHAR NK_LP NK_INTEGER NK_RP */
-   392,  /* (204) type_name ::= TINYINT UNSIGNED */
-   392,  /* (205) type_name ::= SMALLINT UNSIGNED */
-   392,  /* (206) type_name ::= INT UNSIGNED */
-   392,  /* (207) type_name ::= BIGINT UNSIGNED */
-   392,  /* (208) type_name ::= JSON */
-   392,  /* (209) type_name ::= VARCHAR NK_LP NK_INTEGER NK_RP */
-   392,  /* (210) type_name ::= MEDIUMBLOB */
-   392,  /* (211) type_name ::= BLOB */
-   392,  /* (212) type_name ::= VARBINARY NK_LP NK_INTEGER NK_RP */
-   392,  /* (213) type_name ::= GEOMETRY NK_LP NK_INTEGER NK_RP */
-   392,  /* (214) type_name ::= DECIMAL */
-   392,  /* (215) type_name ::= DECIMAL NK_LP NK_INTEGER NK_RP */
-   392,  /* (216) type_name ::= DECIMAL NK_LP NK_INTEGER NK_COMMA NK_INTEGER NK_RP */
-   384,  /* (217) tags_def_opt ::= */
-   384,  /* (218) tags_def_opt ::= tags_def */
-   387,  /* (219) tags_def ::= TAGS NK_LP column_def_list NK_RP */
-   385,  /* (220) table_options ::= */
-   385,  /* (221) table_options ::= table_options COMMENT NK_STRING */
-   385,  /* (222) table_options ::= table_options MAX_DELAY duration_list */
-   385,  /* (223) table_options ::= table_options WATERMARK duration_list */
-   385,  /* (224) table_options ::= table_options ROLLUP NK_LP rollup_func_list NK_RP */
-   385,  /* (225) table_options ::= table_options TTL NK_INTEGER */
-   385,  /* (226) table_options ::= table_options SMA NK_LP col_name_list NK_RP */
-   385,  /* (227) table_options ::= table_options DELETE_MARK duration_list */
-   390,  /* (228) alter_table_options ::= alter_table_option */
-   390,  /* (229) alter_table_options ::= alter_table_options alter_table_option */
-   402,  /* (230) alter_table_option ::= COMMENT NK_STRING */
-   402,  /* (231) alter_table_option ::= TTL NK_INTEGER */
-   400,  /* (232) duration_list ::= duration_literal */
-   400,  /* (233) duration_list ::= duration_list NK_COMMA duration_literal */
-   401,  /* (234) rollup_func_list ::= rollup_func_name */
-   401,  /* (235) rollup_func_list ::= rollup_func_list NK_COMMA rollup_func_name */
-   404,  /* (236) rollup_func_name ::= function_name */
-   404,  /* (237) rollup_func_name ::= FIRST */
-   404,  /* (238) rollup_func_name ::= LAST */
-   398,  /* (239) col_name_list ::= col_name */
-   398,  /* (240) col_name_list ::= col_name_list NK_COMMA col_name */
-   406,  /* (241) col_name ::= column_name */
-   347,  /* (242) cmd ::= SHOW DNODES */
-   347,  /* (243) cmd ::= SHOW USERS */
-   347,  /* (244) cmd ::= SHOW USER PRIVILEGES */
-   347,  /* (245) cmd ::= SHOW db_kind_opt DATABASES */
-   347,  /* (246) cmd ::= SHOW table_kind_db_name_cond_opt TABLES like_pattern_opt */
-   347,  /* (247) cmd ::= SHOW db_name_cond_opt STABLES like_pattern_opt */
-   347,  /* (248) cmd ::= SHOW db_name_cond_opt VGROUPS */
-   347,  /* (249) cmd ::= SHOW MNODES */
-   347,  /* (250) cmd ::= SHOW QNODES */
-   347,  /* (251) cmd ::= SHOW FUNCTIONS */
-   347,  /* (252) cmd ::= SHOW INDEXES FROM table_name_cond from_db_opt */
-   347,  /* (253) cmd ::= SHOW INDEXES FROM db_name NK_DOT table_name */
-   347,  /* (254) cmd ::= SHOW STREAMS */
-   347,  /* (255) cmd ::= SHOW ACCOUNTS */
-   347,  /* (256) cmd ::= SHOW APPS */
-   347,  /* (257) cmd ::= SHOW CONNECTIONS */
-   347,  /* (258) cmd ::= SHOW LICENCES */
-   347,  /* (259) cmd ::= SHOW GRANTS */
-   347,  /* (260) cmd ::= SHOW CREATE DATABASE db_name */
-   347,  /* (261) cmd ::= SHOW CREATE TABLE full_table_name */
-   347,  /* (262) cmd ::= SHOW CREATE STABLE full_table_name */
-   347,  /* (263) cmd ::= SHOW QUERIES */
-   347,  /* (264) cmd ::= SHOW SCORES */
-   347,  /* (265) cmd ::= SHOW TOPICS */
-   347,  /* (266) cmd ::= SHOW VARIABLES */
-   347,  /* (267) cmd ::= SHOW CLUSTER VARIABLES */
-   347,  /* (268) cmd ::= SHOW LOCAL VARIABLES */
-   347,  /* (269) cmd ::= SHOW DNODE NK_INTEGER VARIABLES like_pattern_opt */
-   347,  /* (270) cmd ::= SHOW BNODES */
-   347,  /* (271) cmd ::= SHOW SNODES */
-   347,  /* (272) cmd ::= SHOW CLUSTER */
-   347,  /* (273) cmd ::= SHOW TRANSACTIONS */
-   347,  /* (274) cmd ::= SHOW TABLE DISTRIBUTED full_table_name */
-   347,  /* (275) cmd ::= SHOW CONSUMERS */
-   347,  /* (276) cmd ::= SHOW SUBSCRIPTIONS */
-   347,  /* (277) cmd ::= SHOW TAGS FROM table_name_cond from_db_opt */
-   347,  /* (278) cmd ::= SHOW TAGS FROM db_name NK_DOT table_name */
-   347,  /* (279) cmd ::= SHOW TABLE TAGS tag_list_opt FROM table_name_cond from_db_opt */
-   347,  /* (280) cmd ::= SHOW TABLE TAGS tag_list_opt FROM db_name NK_DOT table_name */
-   347,  /* (281) cmd ::= SHOW VNODES ON DNODE NK_INTEGER */
-   347,  /* (282) cmd ::= SHOW VNODES */
-   347,  /* (283) cmd ::= SHOW db_name_cond_opt ALIVE */
-   347,  /* (284) cmd ::= SHOW CLUSTER ALIVE */
-   347,  /* (285) cmd ::= SHOW db_name_cond_opt VIEWS */
-   347,  /* (286) cmd ::= SHOW CREATE VIEW full_table_name */
-   347,  /* (287) cmd ::= SHOW COMPACTS */
-   347,  /* (288) cmd ::= SHOW COMPACT NK_INTEGER */
-   408,  /* (289) table_kind_db_name_cond_opt ::= */
-   408,  /* (290) table_kind_db_name_cond_opt ::= table_kind */
-   408,  /* (291) table_kind_db_name_cond_opt ::= db_name NK_DOT */
-   408,  /* (292) table_kind_db_name_cond_opt ::= table_kind db_name NK_DOT */
-   414,  /* (293) table_kind ::= NORMAL */
-   414,  /* (294) table_kind ::= CHILD */
-   410,  /* (295) db_name_cond_opt ::= */
-   410,  /* (296) db_name_cond_opt ::= db_name NK_DOT */
-   409,  /* (297) like_pattern_opt ::= */
-   409,  /* (298) like_pattern_opt ::= LIKE NK_STRING */
-   411,  /* (299) table_name_cond ::= table_name */
-   412,  /* (300) from_db_opt ::= */
-   412,  /* (301) from_db_opt ::= FROM db_name */
-   413,  /* (302) tag_list_opt ::= */
-   413,  /* (303) tag_list_opt ::= tag_item */
-   413,  /* (304) tag_list_opt ::= tag_list_opt NK_COMMA tag_item */
-   415,  /* (305) tag_item ::= TBNAME */
-   415,  /* (306) tag_item ::= QTAGS */
-   415,  /* (307) tag_item ::= column_name */
-   415,  /* (308) tag_item ::= column_name column_alias */
-   415,  /* (309) tag_item ::= column_name AS column_alias */
-   407,  /* (310) db_kind_opt ::= */
-   407,  /* (311) db_kind_opt ::= USER */
-   407,  /* (312) db_kind_opt ::= SYSTEM */
-   347,  /* (313) cmd ::= CREATE SMA INDEX not_exists_opt col_name ON full_table_name index_options */
-   347,  /* (314) cmd ::= CREATE INDEX not_exists_opt col_name ON full_table_name NK_LP col_name_list NK_RP */
-   347,  /* (315) cmd ::= DROP INDEX exists_opt full_index_name */
-   418,  /* (316) full_index_name ::= index_name */
-   418,  /* (317) full_index_name ::= db_name NK_DOT index_name */
-   417,  /* (318) index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_RP sliding_opt sma_stream_opt */
-   417,  /* (319) index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt sma_stream_opt */
-   420,  /* (320) func_list ::= func */
-   420,  /* (321) func_list ::= func_list NK_COMMA func */
-   423,  /* (322) func ::= sma_func_name NK_LP expression_list NK_RP */
-   424,  /* (323) sma_func_name ::= function_name */
-   424,  /* (324) sma_func_name ::= COUNT */
-   424,  /* (325) sma_func_name ::= FIRST */
-   424,  /* (326) sma_func_name ::= LAST */
-   424,  /* (327) sma_func_name ::= LAST_ROW */
-   422,  /* (328) sma_stream_opt ::= */
-   422,  /* (329) sma_stream_opt ::= sma_stream_opt WATERMARK duration_literal */
-   422,  /* (330) sma_stream_opt ::= sma_stream_opt MAX_DELAY duration_literal */
-   422,  /* (331) sma_stream_opt ::= sma_stream_opt DELETE_MARK duration_literal */
-   425,  /* (332) with_meta ::= AS */
-   425,  /* (333) with_meta ::= WITH META AS */
-   425,  /* (334) with_meta ::= ONLY META AS */
-   347,  /* (335) cmd ::= CREATE TOPIC not_exists_opt topic_name AS query_or_subquery */
-   347,  /* (336) cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta DATABASE db_name */
-   347,  /* (337) cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta STABLE full_table_name where_clause_opt */
-   347,  /* (338) cmd ::= DROP TOPIC exists_opt topic_name */
-   347,  /* (339) cmd ::= DROP CONSUMER GROUP exists_opt cgroup_name ON topic_name */
-   347,  /* (340) cmd ::= DESC full_table_name */
-   347,  /* (341) cmd ::= DESCRIBE full_table_name */
-   347,  /* (342) cmd ::= RESET QUERY CACHE */
-   347,  /* (343) cmd ::= EXPLAIN analyze_opt explain_options query_or_subquery */
-   347,  /* (344) cmd ::= EXPLAIN analyze_opt explain_options insert_query */
-   429,  /* (345) analyze_opt ::= */
-   429,  /* (346) analyze_opt ::= ANALYZE */
-   430,  /* (347) explain_options ::= */
-   430,  /* (348) explain_options ::= explain_options VERBOSE NK_BOOL */
-   430,  /* (349) explain_options ::= explain_options RATIO NK_FLOAT */
-   347,  /* (350) cmd ::= CREATE or_replace_opt agg_func_opt FUNCTION not_exists_opt function_name AS NK_STRING OUTPUTTYPE type_name bufsize_opt language_opt */
-   347,  /* (351) cmd ::= DROP FUNCTION exists_opt function_name */
-   433,  /* (352) agg_func_opt ::= */
-   433,  /* (353) agg_func_opt ::= AGGREGATE */
-   434,  /* (354) bufsize_opt ::= */
-   434,  /* (355) bufsize_opt ::= BUFSIZE NK_INTEGER */
-   435,  /* (356) language_opt ::= */
-   435,  /* (357) language_opt ::= LANGUAGE NK_STRING */
-   432,  /* (358) or_replace_opt ::= */
-   432,  /* (359) or_replace_opt ::= OR REPLACE */
-   347,  /* (360) cmd ::= CREATE or_replace_opt VIEW full_view_name AS query_or_subquery */
-   347,  /* (361) cmd ::= DROP VIEW exists_opt full_view_name */
-   436,  /* (362) full_view_name ::= view_name */
-   436,  /* (363) full_view_name ::= db_name NK_DOT view_name */
-   347,  /* (364) cmd ::= CREATE STREAM not_exists_opt stream_name stream_options INTO full_table_name col_list_opt tag_def_or_ref_opt subtable_opt AS query_or_subquery */
-   347,  /* (365) cmd ::= DROP STREAM exists_opt stream_name */
-   347,  /* (366) cmd ::= PAUSE STREAM exists_opt stream_name */
-   347,  /* (367) cmd ::= RESUME STREAM exists_opt ignore_opt stream_name */
-   440,  /* (368) col_list_opt ::= */
-   440,  /* (369) col_list_opt ::= NK_LP col_name_list NK_RP */
-   441,  /* (370) tag_def_or_ref_opt ::= */
-   441,  /* (371) tag_def_or_ref_opt ::= tags_def */
-   441,  /* (372) tag_def_or_ref_opt ::= TAGS NK_LP col_name_list NK_RP */
-   439,  /* (373) stream_options ::= */
-   439,  /* (374) stream_options ::= stream_options TRIGGER AT_ONCE */
-   439,  /* (375) stream_options ::= stream_options TRIGGER WINDOW_CLOSE */
-   439,  /* (376) stream_options ::= stream_options TRIGGER MAX_DELAY duration_literal */
-   439,  /* (377) stream_options ::= stream_options WATERMARK duration_literal */
-   439,  /* (378) stream_options ::= stream_options IGNORE EXPIRED NK_INTEGER */
-   439,  /* (379) stream_options ::= stream_options FILL_HISTORY NK_INTEGER */
-   439,  /* (380) stream_options ::= stream_options DELETE_MARK duration_literal */
-   439,  /* (381) stream_options ::= stream_options IGNORE UPDATE NK_INTEGER */
-   442,  /* (382) subtable_opt ::= */
-   442,  /* (383) subtable_opt ::= SUBTABLE NK_LP expression NK_RP */
-   443,  /* (384) ignore_opt ::= */
-   443,  /* (385) ignore_opt ::= IGNORE UNTREATED */
-   347,  /* (386) cmd ::= KILL CONNECTION NK_INTEGER */
-   347,  /* (387) cmd ::= KILL QUERY NK_STRING */
-   347,  /* (388) cmd ::= KILL TRANSACTION NK_INTEGER */
-   347,  /* (389) cmd ::= KILL COMPACT NK_INTEGER */
-   347,  /* (390) cmd ::= BALANCE VGROUP */
-   347,  /* (391) cmd ::= BALANCE VGROUP LEADER on_vgroup_id */
-   347,  /* (392) cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER */
-   347,  /* (393) cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list */
-   347,  /* (394) cmd ::= SPLIT VGROUP NK_INTEGER */
-   445,  /* (395) on_vgroup_id ::= */
-   445,  /* (396) on_vgroup_id ::= ON NK_INTEGER */
-   446,  /* (397) dnode_list ::= DNODE NK_INTEGER */
-   446,  /* (398) dnode_list ::= dnode_list DNODE NK_INTEGER */
-   347,  /* (399) cmd ::= DELETE FROM full_table_name where_clause_opt */
-   347,  /* (400) cmd ::= query_or_subquery */
-   347,  /* (401) cmd ::= insert_query */
-   431,  /* (402) insert_query ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery */
-   431,  /* (403) insert_query ::= INSERT INTO full_table_name query_or_subquery */
-   350,  /* (404) literal ::= NK_INTEGER */
-   350,  /* (405) literal ::= NK_FLOAT */
-   350,  /* (406) literal ::= NK_STRING */
-   350,  /* (407) literal ::= NK_BOOL */
-   350,  /* (408) literal ::= TIMESTAMP NK_STRING */
-   350,  /* (409) literal ::= duration_literal */
-   350,  /* (410) literal ::= NULL */
-   350,  /* (411) literal ::= NK_QUESTION */
-   403,  /* (412) duration_literal ::= NK_VARIABLE */
-   379,  /* (413) signed ::= NK_INTEGER */
-   379,  /* (414) signed ::= NK_PLUS NK_INTEGER */
-   379,  /* (415) signed ::= NK_MINUS NK_INTEGER */
-   379,  /* (416) signed ::= NK_FLOAT */
-   379,  /* (417) signed ::= NK_PLUS NK_FLOAT */
-   379,  /* (418) signed ::= NK_MINUS NK_FLOAT */
-   393,  /* (419) signed_literal ::= signed */
-   393,  /* (420) signed_literal ::= NK_STRING */
-   393,  /* (421) signed_literal ::= NK_BOOL */
-   393,  /* (422) signed_literal ::= TIMESTAMP NK_STRING */
-   393,  /* (423) signed_literal ::= duration_literal */
-   393,  /* (424) signed_literal ::= NULL */
-   393,  /* (425) signed_literal ::= literal_func */
-   393,  /* (426) signed_literal ::= NK_QUESTION */
-   448,  /* (427) literal_list ::= signed_literal */
-   448,  /* (428) literal_list ::= literal_list NK_COMMA signed_literal */
-   362,  /* (429) db_name ::= NK_ID */
-   363,  /* (430) table_name ::= NK_ID */
-   391,  /* (431) column_name ::= NK_ID */
-   405,  /* (432) function_name ::= NK_ID */
-   437,  /* (433) view_name ::= NK_ID */
-   449,  /* (434) table_alias ::= NK_ID */
-   416,  /* (435) column_alias ::= NK_ID */
-   416,  /* (436) column_alias ::= NK_ALIAS */
-   355,  /* (437) user_name ::= NK_ID */
-   364,  /* (438) topic_name ::= NK_ID */
-   438,  /* (439) stream_name ::= NK_ID */
-   428,  /* (440) cgroup_name ::= NK_ID */
-   419,  /* (441) index_name ::= NK_ID */
-   450,  /* (442) expr_or_subquery ::= expression */
-   444,  /* (443) expression ::= literal */
-   444,  /* (444) expression ::= pseudo_column */
-   444,  /* (445) expression ::= column_reference */
-   444,  /* (446) expression ::= function_expression */
-   444,  /* (447) expression ::= case_when_expression */
-   444,  /* (448) expression ::= NK_LP expression NK_RP */
-   444,  /* (449) expression ::= NK_PLUS expr_or_subquery */
-   444,  /* (450) expression ::= NK_MINUS expr_or_subquery */
-   444,  /* (451) expression ::= expr_or_subquery NK_PLUS expr_or_subquery */
-   444,  /* (452) expression ::= expr_or_subquery NK_MINUS expr_or_subquery */
-   444,  /* (453) expression ::= expr_or_subquery NK_STAR expr_or_subquery */
-   444,  /* (454) expression ::= expr_or_subquery NK_SLASH expr_or_subquery */
-   444,  /* (455) expression ::= expr_or_subquery NK_REM expr_or_subquery */
-   444,  /* (456) expression ::= column_reference NK_ARROW NK_STRING */
-   444,  /* (457) expression ::= expr_or_subquery NK_BITAND expr_or_subquery */
-   444,  /* (458) expression ::= expr_or_subquery NK_BITOR expr_or_subquery */
-   396,  /* (459) expression_list ::= expr_or_subquery */
-   396,  /* (460) expression_list ::= expression_list NK_COMMA expr_or_subquery */
-   452,  /* (461) column_reference ::= column_name */
-   452,  /* (462) column_reference ::= table_name NK_DOT column_name */
-   452,  /* (463) column_reference ::= NK_ALIAS */
-   452,  /* (464) column_reference ::= table_name NK_DOT NK_ALIAS */
-   451,  /* (465) pseudo_column ::= ROWTS */
-   451,  /* (466) pseudo_column ::= TBNAME */
-   451,  /* (467) pseudo_column ::= table_name NK_DOT TBNAME */
-   451,  /* (468) pseudo_column ::= QSTART */
-   451,  /* (469) pseudo_column ::= QEND */
-   451,  /* (470) pseudo_column ::= QDURATION */
-   451,  /* (471) pseudo_column ::= WSTART */
-   451,  /* (472) pseudo_column ::= WEND */
-   451,  /* (473) pseudo_column ::= WDURATION */
-   451,  /* (474) pseudo_column ::= IROWTS */
-   451,  /* (475) pseudo_column ::= ISFILLED */
-   451,  /* (476) pseudo_column ::= QTAGS */
-   453,  /* (477) function_expression ::= function_name NK_LP expression_list NK_RP */
-   453,  /* (478) function_expression ::= star_func NK_LP star_func_para_list NK_RP */
-   453,  /* (479) function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP */
-   453,  /* (480) function_expression ::= literal_func */
-   447,  /* (481) literal_func ::= noarg_func NK_LP NK_RP */
-   447,  /* (482) literal_func ::= NOW */
-   457,  /* (483) noarg_func ::= NOW */
-   457,  /* (484) noarg_func ::= TODAY */
-   457,  /* (485) noarg_func ::= TIMEZONE */
-   457,  /* (486) noarg_func ::= DATABASE */
-   457,  /* (487) noarg_func ::= CLIENT_VERSION */
-   457,  /* (488) noarg_func ::= SERVER_VERSION */
-   457,  /* (489) noarg_func ::= SERVER_STATUS */
-   457,  /* (490) noarg_func ::= CURRENT_USER */
-   457,  /* (491) noarg_func ::= USER */
-   455,  /* (492) star_func ::= COUNT */
-   455,  /* (493) star_func ::= FIRST */
-   455,  /* (494) star_func ::= LAST */
-   455,  /* (495) star_func ::= LAST_ROW */
-   456,  /* (496) star_func_para_list ::= NK_STAR */
-   456,  /* (497) star_func_para_list ::= other_para_list */
-   458,  /* (498) other_para_list ::= star_func_para */
-   458,  /* (499) other_para_list ::= other_para_list NK_COMMA star_func_para */
-   459,  /* (500) star_func_para ::= expr_or_subquery */
-   459,  /* (501) star_func_para ::= table_name NK_DOT NK_STAR */
-   454,  /* (502) case_when_expression ::= CASE when_then_list case_when_else_opt END */
-   454,  /* (503) case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END */
-   460,  /* (504) when_then_list ::= when_then_expr */
-   460,  /* (505) when_then_list ::= when_then_list when_then_expr */
-   463,  /* (506) when_then_expr ::= WHEN common_expression THEN common_expression */
-   461,  /* (507) case_when_else_opt ::= */
-   461,  /* (508) case_when_else_opt ::= ELSE common_expression */
-   464,  /* (509) predicate ::= expr_or_subquery compare_op expr_or_subquery */
-   464,  /* (510) predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery */
-   464,  /* (511) predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery */
-   464,  /* (512) predicate ::= expr_or_subquery IS NULL */
-   464,  /* (513) predicate ::= expr_or_subquery IS NOT NULL */
-   464,  /* (514) predicate ::= expr_or_subquery in_op in_predicate_value */
-   465,  /* (515) compare_op ::= NK_LT */
-   465,  /* (516) compare_op ::= NK_GT */
-   465,  /* (517) compare_op ::= NK_LE */
-   465,  /* (518) compare_op ::= NK_GE */
-   465,  /* (519) compare_op ::= NK_NE */
-   465,  /* (520) compare_op ::= NK_EQ */
-   465,  /* (521) compare_op ::= LIKE */
-   465,  /* (522) compare_op ::= NOT LIKE */
-   465,  /* (523) compare_op ::= MATCH */
-   465,  /* (524) compare_op ::= NMATCH */
-   465,  /* (525) compare_op ::= CONTAINS */
-   466,  /* (526) in_op ::= IN */
-   466,  /* (527) in_op ::= NOT IN */
-   467,  /* (528) in_predicate_value ::= NK_LP literal_list NK_RP */
-   468,  /* (529) boolean_value_expression ::= boolean_primary */
-   468,  /* (530) boolean_value_expression ::= NOT boolean_primary */
-   468,  /* (531) boolean_value_expression ::= boolean_value_expression OR boolean_value_expression */
-   468,  /* (532) boolean_value_expression ::= boolean_value_expression AND boolean_value_expression */
-   469,  /* (533) boolean_primary ::= predicate */
-   469,  /* (534) boolean_primary ::= NK_LP boolean_value_expression NK_RP */
-   462,  /* (535) common_expression ::= expr_or_subquery */
-   462,  /* (536) common_expression ::= boolean_value_expression */
-   470,  /* (537) from_clause_opt ::= */
-   470,  /* (538) from_clause_opt ::= FROM table_reference_list */
-   471,  /* (539) table_reference_list ::= table_reference */
-   471,  /* (540) table_reference_list ::= table_reference_list NK_COMMA table_reference */
-   472,  /* (541) table_reference ::= table_primary */
-   472,  /* (542) table_reference ::= joined_table */
-   473,  /* (543) table_primary ::= table_name alias_opt */
-   473,  /* (544) table_primary ::= db_name NK_DOT table_name alias_opt */
-   473,  /* (545) table_primary ::= subquery alias_opt */
-   473,  /* (546) table_primary ::= parenthesized_joined_table */
-   475,  /* (547) alias_opt ::= */
-   475,  /* (548) alias_opt ::= table_alias */
-   475,  /* (549) alias_opt ::= AS table_alias */
-   477,  /* (550) parenthesized_joined_table ::= NK_LP joined_table NK_RP */
-   477,  /* (551) parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP */
-   474,  /* (552) joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
-   478,  /* (553) join_type ::= */
-   478,  /* (554) join_type ::= INNER */
-   479,  /* (555) query_specification ::= SELECT hint_list set_quantifier_opt tag_mode_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
-   480,  /* (556) hint_list ::= */
-   480,  /* (557) hint_list ::= NK_HINT */
-   482,  /* (558) tag_mode_opt ::= */
-   482,  /* (559) tag_mode_opt ::= TAGS */
-   481,  /* (560) set_quantifier_opt ::= */
-   481,  /* (561) set_quantifier_opt ::= DISTINCT */
-   481,  /* (562) set_quantifier_opt ::= ALL */
-   483,  /* (563) select_list ::= select_item */
-   483,  /* (564) select_list ::= select_list NK_COMMA select_item */
-   491,  /* (565) select_item ::= NK_STAR */
-   491,  /* (566) select_item ::= common_expression */
-   491,  /* (567) select_item ::= common_expression column_alias */
-   491,  /* (568) select_item ::= common_expression AS column_alias */
-   491,  /* (569) select_item ::= table_name NK_DOT NK_STAR */
-   427,  /* (570) where_clause_opt ::= */
-   427,  /* (571) where_clause_opt ::= WHERE search_condition */
-   484,  /* (572) partition_by_clause_opt ::= */
-   484,  /* (573) partition_by_clause_opt ::= PARTITION BY partition_list */
-   492,  /* (574) partition_list ::= partition_item */
-   492,  /* (575) partition_list ::= partition_list NK_COMMA partition_item */
-   493,  /* (576) partition_item ::= expr_or_subquery */
-   493,  /* (577) partition_item ::= expr_or_subquery column_alias */
-   493,  /* (578) partition_item ::= expr_or_subquery AS column_alias */
-   488,  /* (579) twindow_clause_opt ::= */
-   488,  /* (580) twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA interval_sliding_duration_literal NK_RP */
-   488,  /* (581) twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
-   488,  /* (582) twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_RP sliding_opt fill_opt */
-   488,  /* (583) twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_COMMA interval_sliding_duration_literal NK_RP sliding_opt fill_opt */
-   488,  /* (584) twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition */
-   421,  /* (585) sliding_opt ::= */
-   421,  /* (586) sliding_opt ::= SLIDING NK_LP interval_sliding_duration_literal NK_RP */
-   494,  /* (587) interval_sliding_duration_literal ::= NK_VARIABLE */
-   494,  /* (588) interval_sliding_duration_literal ::= NK_STRING */
-   494,  /* (589) interval_sliding_duration_literal ::= NK_INTEGER */
-   487,  /* (590) fill_opt ::= */
-   487,  /* (591) fill_opt ::= FILL NK_LP fill_mode NK_RP */
-   487,  /* (592) fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP */
-   487,  /* (593) fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP */
-   495,  /* (594) fill_mode ::= NONE */
-   495,  /* (595) fill_mode ::= PREV */
-   495,  /* (596) fill_mode ::= NULL */
-   495,  /* (597) fill_mode ::= NULL_F */
-   495,  /* (598) fill_mode ::= LINEAR */
-   495,  /* (599) fill_mode ::= NEXT */
-   489,  /* (600) group_by_clause_opt ::= */
-   489,  /* (601) group_by_clause_opt ::= GROUP BY group_by_list */
-   496,  /* (602) group_by_list ::= expr_or_subquery */
-   496,  /* (603) group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
-   490,  /* (604) having_clause_opt ::= */
-   490,  /* (605) having_clause_opt ::= HAVING search_condition */
-   485,  /* (606) range_opt ::= */
-   485,  /* (607) range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
-   485,  /* (608) range_opt ::= RANGE NK_LP expr_or_subquery NK_RP */
-   486,  /* (609) every_opt ::= */
-   486,  /* (610) every_opt ::= EVERY NK_LP duration_literal NK_RP */
-   497,  /* (611) query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
-   498,  /* (612) query_simple ::= query_specification */
-   498,  /* (613) query_simple ::= union_query_expression */
-   502,  /* (614) union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
-   502,  /* (615) union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
-   503,  /* (616) query_simple_or_subquery ::= query_simple */
-   503,  /* (617) query_simple_or_subquery ::= subquery */
-   426,  /* (618) query_or_subquery ::= query_expression */
-   426,  /* (619) query_or_subquery ::= subquery */
-   499,  /* (620) order_by_clause_opt ::= */
-   499,  /* (621) order_by_clause_opt ::= ORDER BY sort_specification_list */
-   500,  /* (622) slimit_clause_opt ::= */
-   500,  /* (623) slimit_clause_opt ::= SLIMIT NK_INTEGER */
-   500,  /* (624) slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
-   500,  /* (625) slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
-   501,  /* (626) limit_clause_opt ::= */
-   501,  /* (627) limit_clause_opt ::= LIMIT NK_INTEGER */
-   501,  /* (628) limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */
-   501,  /* (629) limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */
-   476,  /* (630) subquery ::= NK_LP query_expression NK_RP */
-   476,  /* (631) subquery ::= NK_LP subquery NK_RP */
-   365,  /* (632) search_condition ::= common_expression */
-   504,  /* (633) sort_specification_list ::= sort_specification */
-   504,  /* (634) sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */
-   505,  /* (635) sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
-   506,  /* (636) ordering_specification_opt ::= */
-   506,  /* (637) ordering_specification_opt ::= ASC */
-   506,  /* (638) ordering_specification_opt ::= DESC */
-   507,  /* (639) null_ordering_opt ::= */
-   507,  /* (640) null_ordering_opt ::= NULLS FIRST */
-   507,  /* (641) null_ordering_opt ::= NULLS LAST */
+   349,  /* (0) cmd ::= CREATE ACCOUNT NK_ID PASS NK_STRING account_options */
+   349,  /* (1) cmd ::= ALTER ACCOUNT NK_ID alter_account_options */
+   350,  /* (2) account_options ::= */
+   350,  /* (3) account_options ::= account_options PPS literal */
+   350,  /* (4) account_options ::= account_options TSERIES literal */
+   350,  /* (5) account_options ::= account_options STORAGE literal */
+   350,  /* (6) account_options ::= account_options STREAMS literal */
+   350,  /* (7) account_options ::= account_options QTIME literal */
+   350,  /* (8) account_options ::= account_options DBS literal */
+   350,  /* (9) account_options ::= account_options USERS literal */
+   350,  /* (10) account_options ::= account_options CONNS literal */
+   350,  /* (11) account_options ::= account_options STATE literal */
+   351,  /* (12) alter_account_options ::= alter_account_option */
+   351,  /* (13) alter_account_options ::= alter_account_options alter_account_option */
+   353,  /* (14) alter_account_option ::= PASS literal */
+   353,  /* (15) alter_account_option ::= PPS literal */
+   353,  /* (16) alter_account_option ::= TSERIES literal */
+   353,  /* (17) alter_account_option ::= STORAGE literal */
+   353,  /* (18) alter_account_option ::= STREAMS literal */
+   353,  /* (19) alter_account_option ::= QTIME literal */
+   353,  /* (20) alter_account_option ::= DBS literal */
+   353,  /* (21) alter_account_option ::= USERS literal */
+   353,  /* (22) alter_account_option ::= CONNS literal */
+   353,  /* (23) alter_account_option ::= STATE literal */
+   354,  /* (24) ip_range_list ::= NK_STRING */
+   354,  /* (25) ip_range_list ::= ip_range_list NK_COMMA NK_STRING */
+   355,  /* (26) white_list ::= HOST ip_range_list */
+   356,  /* (27) white_list_opt ::= */
+   356,  /* (28) white_list_opt ::= white_list */
+   349,  /* (29) cmd ::= CREATE USER user_name PASS NK_STRING sysinfo_opt white_list_opt */
+   349,  /* (30) cmd ::= ALTER USER user_name PASS NK_STRING */
+   349,  /* (31) cmd ::= ALTER USER user_name ENABLE NK_INTEGER */
+   349,  /* (32) cmd ::= ALTER USER user_name SYSINFO NK_INTEGER */
+   349,  /* (33) cmd ::= ALTER USER user_name ADD white_list */
+   349,  /* (34) cmd ::= ALTER USER user_name DROP white_list */
+   349,  /* (35) cmd ::= DROP USER user_name */
+   358,  /* (36) sysinfo_opt ::= */
+   358,  /* (37) sysinfo_opt ::= SYSINFO NK_INTEGER */
+   349,  /* (38) cmd ::= GRANT privileges ON priv_level with_opt TO user_name */
+   349,  /* (39) cmd ::= REVOKE privileges ON priv_level with_opt FROM user_name */
+   359,  /* (40) privileges ::= ALL */
+   359,  /* (41) privileges ::= priv_type_list */
+   359,  /* (42) privileges ::= SUBSCRIBE */
+   362,  /* (43) priv_type_list ::= priv_type */
+   362,  /* (44) priv_type_list ::= priv_type_list NK_COMMA priv_type */
+   363,  /* (45) priv_type ::= READ */
+   363,  /* (46) priv_type ::= WRITE */
+   363,  /* (47) priv_type ::= ALTER */
+   360,  /* (48) priv_level ::= NK_STAR NK_DOT NK_STAR */
+   360,  /* (49) priv_level ::= db_name NK_DOT NK_STAR */
+   360,  /* (50) priv_level ::= db_name NK_DOT table_name */
+   360,  /* (51) priv_level ::= topic_name */
+   361,  /* (52) with_opt ::= */
+   361,  /* (53) with_opt ::= WITH search_condition */
+   349,  /* (54) cmd ::= CREATE DNODE dnode_endpoint */
+   349,  /* (55) cmd ::= CREATE DNODE dnode_endpoint PORT NK_INTEGER */
+   349,  /* (56) cmd ::= DROP DNODE NK_INTEGER force_opt */
+   349,  /* (57) cmd ::= DROP DNODE dnode_endpoint force_opt */
+   349,  /* (58) cmd ::= DROP DNODE NK_INTEGER unsafe_opt */
+   349,  /* (59) cmd ::= DROP DNODE dnode_endpoint unsafe_opt */
+   349,  /* (60) cmd ::= ALTER DNODE NK_INTEGER NK_STRING */
+   349,  /* (61) cmd ::= ALTER DNODE NK_INTEGER NK_STRING NK_STRING */
+   349,  /* (62) cmd ::= ALTER ALL DNODES NK_STRING */
+   349,  /* (63) cmd ::= ALTER ALL DNODES NK_STRING NK_STRING */
+   349,  /* (64) cmd ::= RESTORE DNODE NK_INTEGER */
+   368,  /* (65) dnode_endpoint ::= NK_STRING */
+   368,  /* (66) dnode_endpoint ::= NK_ID */
+   368,  /* (67) dnode_endpoint ::= NK_IPTOKEN */
+   369,  /* (68) force_opt ::= */
+   369,  /* (69) force_opt ::= FORCE */
+   370,  /* (70) unsafe_opt ::= UNSAFE */
+   349,  /* (71) cmd ::= ALTER LOCAL NK_STRING */
+   349,  /* (72) cmd ::= ALTER LOCAL NK_STRING NK_STRING */
+   349,  /* (73) cmd ::= CREATE QNODE ON DNODE NK_INTEGER */
+   349,  /* (74) cmd ::= DROP QNODE ON DNODE NK_INTEGER */
+   349,  /* (75) cmd ::= RESTORE QNODE ON DNODE NK_INTEGER */
+   349,  /* (76) cmd ::= CREATE BNODE ON DNODE NK_INTEGER */
+   349,  /* (77) cmd ::= DROP BNODE ON DNODE NK_INTEGER */
+   349,  /* (78) cmd ::= CREATE SNODE ON DNODE NK_INTEGER */
+   349,  /* (79) cmd ::= DROP SNODE ON DNODE NK_INTEGER */
+   349,  /* (80) cmd ::= CREATE MNODE ON DNODE NK_INTEGER */
+   349,  /* (81) cmd ::= DROP MNODE ON DNODE NK_INTEGER */
+   349,  /* (82) cmd ::= RESTORE MNODE ON DNODE NK_INTEGER */
+   349,  /* (83) cmd ::= RESTORE VNODE ON DNODE NK_INTEGER */
+   349,  /* (84) cmd ::= CREATE DATABASE not_exists_opt db_name db_options */
+   349,  /* (85) cmd ::= DROP DATABASE exists_opt db_name */
+   349,  /* (86) cmd ::= USE db_name */
+   349,  /* (87) cmd ::= ALTER DATABASE db_name alter_db_options */
+   349,  /* (88) cmd ::= FLUSH DATABASE db_name */
+   349,  /* (89) cmd ::= TRIM DATABASE db_name speed_opt */
+   349,  /* (90) cmd ::= COMPACT DATABASE db_name start_opt end_opt */
+   371,  /* (91) not_exists_opt ::= IF NOT EXISTS */
+   371,  /* (92) not_exists_opt ::= */
+   373,  /* (93) exists_opt ::= IF EXISTS */
+   373,  /* (94) exists_opt ::= */
+   372,  /* (95) db_options ::= */
+   372,  /* (96) db_options ::= db_options BUFFER NK_INTEGER */
+   372,  /* (97) db_options ::= db_options CACHEMODEL NK_STRING */
+   372,  /* (98) db_options ::= db_options CACHESIZE NK_INTEGER */
+   372,  /* (99) db_options ::= db_options COMP NK_INTEGER */
+   372,  /* (100) db_options ::= db_options DURATION NK_INTEGER */
+   372,  /* (101) db_options ::= db_options DURATION NK_VARIABLE */
+   372,  /* (102) db_options ::= db_options MAXROWS NK_INTEGER */
+   372,  /* (103) db_options ::= db_options MINROWS NK_INTEGER */
+   372,  /* (104) db_options ::= db_options KEEP integer_list */
+   372,  /* (105) db_options ::= db_options KEEP variable_list */
+   372,  /* (106) db_options ::= db_options PAGES NK_INTEGER */
+   372,  /* (107) db_options ::= db_options PAGESIZE NK_INTEGER */
+   372,  /* (108) db_options ::= db_options TSDB_PAGESIZE NK_INTEGER */
+   372,  /* (109) db_options ::= db_options PRECISION NK_STRING */
+   372,  /* (110) db_options ::= db_options REPLICA NK_INTEGER */
+   372,  /* (111) db_options ::= db_options VGROUPS NK_INTEGER */
+   372,  /* (112) db_options ::= db_options SINGLE_STABLE NK_INTEGER */
+   372,  /* (113) db_options ::= db_options RETENTIONS retention_list */
+   372,  /* (114) db_options ::= db_options SCHEMALESS NK_INTEGER */
+   372,  /* (115) db_options ::= db_options WAL_LEVEL NK_INTEGER */
+   372,  /* (116) db_options ::= db_options WAL_FSYNC_PERIOD NK_INTEGER */
+   372,  /* (117) db_options ::= db_options WAL_RETENTION_PERIOD NK_INTEGER */
+   372,  /* (118) db_options ::= db_options WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
+   372,  /* (119) db_options ::= db_options WAL_RETENTION_SIZE NK_INTEGER */
+   372,  /* (120) db_options ::= db_options WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
+   372,  /* (121) db_options ::= db_options WAL_ROLL_PERIOD NK_INTEGER */
+   372,  /* (122) db_options ::= db_options WAL_SEGMENT_SIZE NK_INTEGER */
+   372,  /* (123) db_options ::= db_options STT_TRIGGER NK_INTEGER */
+   372,  /* (124) db_options ::= db_options STT_MERGE_POLICY NK_STRING */
+   372,  /* (125) db_options ::= db_options TABLE_PREFIX signed */
+   372,  /* (126) db_options ::= db_options TABLE_SUFFIX signed */
+   372,  /* (127) db_options ::= db_options KEEP_TIME_OFFSET NK_INTEGER */
+   374,  /* (128) alter_db_options ::= alter_db_option */
+   374,  /* (129) alter_db_options ::= alter_db_options alter_db_option */
+   382,  /* (130) alter_db_option ::= BUFFER NK_INTEGER */
+   382,  /* (131) alter_db_option ::= CACHEMODEL NK_STRING */
+   382,  /* (132) alter_db_option ::= CACHESIZE NK_INTEGER */
+   382,  /* (133) alter_db_option ::= WAL_FSYNC_PERIOD NK_INTEGER */
+   382,  /* (134) alter_db_option ::= KEEP integer_list */
+   382,  /* (135) alter_db_option ::= KEEP variable_list */
+   382,  /* (136) alter_db_option ::= PAGES NK_INTEGER */
+   382,  /* (137) alter_db_option ::= REPLICA NK_INTEGER */
+   382,  /* (138) alter_db_option ::= WAL_LEVEL NK_INTEGER */
+   382,  /* (139) alter_db_option ::= STT_TRIGGER NK_INTEGER */
+   382,  /* (140) alter_db_option ::= STT_MERGE_POLICY NK_STRING */
+   382,  /* (141) alter_db_option ::= MINROWS NK_INTEGER */
+   382,  /* (142) alter_db_option ::= WAL_RETENTION_PERIOD NK_INTEGER */
+   382,  /* (143) alter_db_option ::= WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
+   382,  /* (144) alter_db_option ::= WAL_RETENTION_SIZE NK_INTEGER */
+   382,  /* (145) alter_db_option ::= WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
+   382,  /* (146) alter_db_option ::= KEEP_TIME_OFFSET NK_INTEGER */
+   378,  /* (147) integer_list ::= NK_INTEGER */
+   378,  /* (148) integer_list ::= integer_list NK_COMMA NK_INTEGER */
+   379,  /* (149) variable_list ::= NK_VARIABLE */
+   379,  /* (150) variable_list ::= variable_list NK_COMMA NK_VARIABLE */
+   380,  /* (151) retention_list ::= retention */
+   380,  /* (152) retention_list ::= retention_list NK_COMMA retention */
+   383,  /* (153) retention ::= NK_VARIABLE NK_COLON NK_VARIABLE */
+   383,  /* (154) retention ::= NK_MINUS NK_COLON NK_VARIABLE */
+   375,  /* (155) speed_opt ::= */
+   375,  /* (156) speed_opt ::= BWLIMIT NK_INTEGER */
+   376,  /* (157) start_opt ::= */
+   376,  /* (158) start_opt ::= START WITH NK_INTEGER */
+   376,  /* (159) start_opt ::= START WITH NK_STRING */
+   376,  /* (160) start_opt ::= START WITH TIMESTAMP NK_STRING */
+   377,  /* (161) end_opt ::= */
+   377,  /* (162) end_opt ::= END WITH NK_INTEGER */
+   377,  /* (163) end_opt ::= END WITH NK_STRING */
+   377,  /* (164) end_opt ::= END WITH TIMESTAMP NK_STRING */
+   349,  /* (165) cmd ::= CREATE TABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def_opt table_options */
+   349,  /* (166) cmd ::= CREATE TABLE multi_create_clause */
+   349,  /* (167) cmd ::= CREATE STABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def table_options */
+   349,  /* (168) cmd ::= DROP TABLE multi_drop_clause */
+   349,  /* (169) cmd ::= DROP STABLE exists_opt full_table_name */
+   349,  /* (170) cmd ::= ALTER TABLE alter_table_clause */
+   349,  /* (171) cmd ::= ALTER STABLE alter_table_clause */
+   391,  /* (172) alter_table_clause ::= full_table_name alter_table_options */
+   391,  /* (173) alter_table_clause ::= full_table_name ADD COLUMN column_name type_name */
+   391,  /* (174) alter_table_clause ::= full_table_name DROP COLUMN column_name */
+   391,  /* (175) alter_table_clause ::= full_table_name MODIFY COLUMN column_name type_name */
+   391,  /* (176) alter_table_clause ::= full_table_name RENAME COLUMN column_name column_name */
+   391,  /* (177) alter_table_clause ::= full_table_name ADD TAG column_name type_name */
+   391,  /* (178) alter_table_clause ::= full_table_name DROP TAG column_name */
+   391,  /* (179) alter_table_clause ::= full_table_name MODIFY TAG column_name type_name */
+   391,  /* (180) alter_table_clause ::= full_table_name RENAME TAG column_name column_name */
+   391,  /* (181) alter_table_clause ::= full_table_name SET TAG column_name NK_EQ signed_literal */
+   388,  /* (182) multi_create_clause ::= create_subtable_clause */
+   388,  /* (183) multi_create_clause ::= multi_create_clause create_subtable_clause */
+   396,  /* (184) create_subtable_clause ::= not_exists_opt full_table_name USING full_table_name specific_cols_opt TAGS NK_LP expression_list NK_RP table_options */
+   390,  /* (185) multi_drop_clause ::= drop_table_clause */
+   390,  /* (186) multi_drop_clause ::= multi_drop_clause NK_COMMA drop_table_clause */
+   399,  /* (187) drop_table_clause ::= exists_opt full_table_name */
+   397,  /* (188) specific_cols_opt ::= */
+   397,  /* (189) specific_cols_opt ::= NK_LP col_name_list NK_RP */
+   384,  /* (190) full_table_name ::= table_name */
+   384,  /* (191) full_table_name ::= db_name NK_DOT table_name */
+   385,  /* (192) column_def_list ::= column_def */
+   385,  /* (193) column_def_list ::= column_def_list NK_COMMA column_def */
+   401,  /* (194) column_def ::= column_name type_name */
+   394,  /* (195) type_name ::= BOOL */
+   394,  /* (196) type_name ::= TINYINT */
+   394,  /* (197) type_name ::= SMALLINT */
+   394,  /* (198) type_name ::= INT */
+   394,  /* (199) type_name ::= INTEGER */
+   394,  /* (200) type_name ::= BIGINT */
+   394,  /* (201) type_name ::= FLOAT */
+   394,  /* (202) type_name ::= DOUBLE */
+   394,  /* (203) type_name ::= BINARY NK_LP NK_INTEGER NK_RP */
+   394,  /* (204) type_name ::= TIMESTAMP */
+   394,  /* (205) type_name ::= NCHAR NK_LP NK_INTEGER NK_RP */
+   394,  /* (206) type_name ::= TINYINT UNSIGNED */
+   394,  /* (207) type_name ::= SMALLINT UNSIGNED */
+   394,  /* (208) type_name ::= INT UNSIGNED */
+   394,  /* (209) type_name ::= BIGINT UNSIGNED */
+   394,  /* (210) type_name ::= JSON */
+   394,  /* (211) type_name ::= VARCHAR NK_LP NK_INTEGER NK_RP */
+   394,  /* (212) type_name ::= MEDIUMBLOB */
+   394,  /* (213) type_name ::= BLOB */
+   394,  /* (214) type_name ::= VARBINARY NK_LP NK_INTEGER NK_RP */
+   394,  /* (215) type_name ::= GEOMETRY NK_LP NK_INTEGER NK_RP */
+   394,  /* (216) type_name ::= DECIMAL */
+   394,  /* (217) type_name ::= DECIMAL NK_LP NK_INTEGER NK_RP */
+   394,  /* (218) type_name ::= DECIMAL NK_LP NK_INTEGER NK_COMMA NK_INTEGER NK_RP */
+   386,  /* (219) tags_def_opt ::= */
+   386,  /* (220) tags_def_opt ::= tags_def */
+   389,  /* (221) tags_def ::= TAGS NK_LP column_def_list NK_RP */
+   387,  /* (222) table_options ::= */
+   387,  /* (223) table_options ::= table_options COMMENT NK_STRING */
+   387,  /* (224) table_options ::= table_options MAX_DELAY duration_list */
+   387,  /* (225) table_options ::= table_options WATERMARK duration_list */
+   387,  /* (226) table_options ::= table_options ROLLUP NK_LP rollup_func_list NK_RP */
+   387,  /* (227) table_options ::= table_options TTL NK_INTEGER */
+   387,  /* (228) table_options ::= table_options SMA NK_LP col_name_list NK_RP */
+   387,  /* (229) table_options ::= table_options BLOOM_FILTER NK_LP col_name_list NK_RP */
+   387,  /* (230) table_options ::= table_options DELETE_MARK duration_list */
+   392,  /* (231) alter_table_options ::= alter_table_option */
+   392,  /* (232) alter_table_options ::= alter_table_options alter_table_option */
+   404,  /* (233) alter_table_option ::= COMMENT NK_STRING */
+   404,  /* (234) alter_table_option ::= TTL NK_INTEGER */
+   402,  /* (235) duration_list ::= duration_literal */
+   402,  /* (236) duration_list ::= duration_list NK_COMMA duration_literal */
+   403,  /* (237) rollup_func_list ::= rollup_func_name */
+   403,  /* (238) rollup_func_list ::= rollup_func_list NK_COMMA rollup_func_name */
+   406,  /* (239) rollup_func_name ::= function_name */
+   406,  /* (240) rollup_func_name ::= FIRST */
+   406,  /* (241) rollup_func_name ::= LAST */
+   400,  /* (242) col_name_list ::= col_name */
+   400,  /* (243) col_name_list ::= col_name_list NK_COMMA col_name */
+   408,  /* (244) col_name ::= column_name */
+   349,  /* (245) cmd ::= SHOW DNODES */
+   349,  /* (246) cmd ::= SHOW USERS */
+   349,  /* (247) cmd ::= SHOW USER PRIVILEGES */
+   349,  /* (248) cmd ::= SHOW db_kind_opt DATABASES */
+   349,  /* (249) cmd ::= SHOW table_kind_db_name_cond_opt TABLES like_pattern_opt */
+   349,  /* (250) cmd ::= SHOW db_name_cond_opt STABLES like_pattern_opt */
+   349,  /* (251) cmd ::= SHOW db_name_cond_opt VGROUPS */
+   349,  /* (252) cmd ::= SHOW MNODES */
+   349,  /* (253) cmd ::= SHOW QNODES */
+   349,  /* (254) cmd ::= SHOW FUNCTIONS */
+   349,  /* (255) cmd ::= SHOW INDEXES FROM table_name_cond from_db_opt */
+   349,  /* (256) cmd ::= SHOW INDEXES FROM db_name NK_DOT table_name */
+   349,  /* (257) cmd ::= SHOW STREAMS */
+   349,  /* (258) cmd ::= SHOW ACCOUNTS */
+   349,  /* (259) cmd ::= SHOW APPS */
+   349,  /* (260) cmd ::= SHOW CONNECTIONS */
+   349,  /* (261) cmd ::= SHOW LICENCES */
+   349,  /* (262) cmd ::= SHOW GRANTS */
+   349,  /* (263) cmd ::= SHOW CREATE DATABASE db_name */
+   349,  /* (264) cmd ::= SHOW CREATE TABLE full_table_name */
+   349,  /* (265) cmd ::= SHOW CREATE STABLE full_table_name */
+   349,  /* (266) cmd ::= SHOW QUERIES */
+   349,  /* (267) cmd ::= SHOW SCORES */
+   349,  /* (268) cmd ::= SHOW TOPICS */
+   349,  /* (269) cmd ::= SHOW VARIABLES */
+   349,  /* (270) cmd ::= SHOW CLUSTER VARIABLES */
+   349,  /* (271) cmd ::= SHOW LOCAL VARIABLES */
+   349,  /* (272) cmd ::= SHOW DNODE NK_INTEGER VARIABLES like_pattern_opt */
+   349,  /* (273) cmd ::= SHOW BNODES */
+   349,  /* (274) cmd ::= SHOW SNODES */
+   349,  /* (275) cmd ::= SHOW CLUSTER */
+   349,  /* (276) cmd ::= SHOW TRANSACTIONS */
+   349,  /* (277) cmd ::= SHOW TABLE DISTRIBUTED full_table_name */
+   349,  /* (278) cmd ::= SHOW CONSUMERS */
+   349,  /* (279) cmd ::= SHOW SUBSCRIPTIONS */
+   349,  /* (280) cmd ::= SHOW TAGS FROM table_name_cond from_db_opt */
+   349,  /* (281) cmd ::= SHOW TAGS FROM db_name NK_DOT table_name */
+   349,  /* (282) cmd ::= SHOW TABLE TAGS tag_list_opt FROM table_name_cond from_db_opt */
+   349,  /* (283) cmd ::= SHOW TABLE TAGS tag_list_opt FROM db_name NK_DOT table_name */
+   349,  /* (284) cmd ::= SHOW VNODES ON DNODE NK_INTEGER */
+   349,  /* (285) cmd ::= SHOW VNODES */
+   349,  /* (286) cmd ::= SHOW db_name_cond_opt ALIVE */
+   349,  /* (287) cmd ::= SHOW CLUSTER ALIVE */
+   349,  /* (288) cmd ::= SHOW db_name_cond_opt VIEWS */
+   349,  /* (289) cmd ::= SHOW CREATE VIEW full_table_name */
+   349,  /* (290) cmd ::= SHOW COMPACTS */
+   349,  /* (291) cmd ::= SHOW COMPACT NK_INTEGER */
+   410,  /* (292) table_kind_db_name_cond_opt ::= */
+   410,  /* (293) table_kind_db_name_cond_opt ::= table_kind */
+   410,  /* (294) table_kind_db_name_cond_opt ::= db_name NK_DOT */
+   410,  /* (295) table_kind_db_name_cond_opt ::= table_kind db_name NK_DOT */
+   416,  /* (296) table_kind ::= NORMAL */
+   416,  /* (297) table_kind ::= CHILD */
+   412,  /* (298) db_name_cond_opt ::= */
+   412,  /* (299) db_name_cond_opt ::= db_name NK_DOT */
+   411,  /* (300) like_pattern_opt ::= */
+   411,  /* (301) like_pattern_opt ::= LIKE NK_STRING */
+   413,  /* (302) table_name_cond ::= table_name */
+   414,  /* (303) from_db_opt ::= */
+   414,  /* (304) from_db_opt ::= FROM db_name */
+   415,  /* (305) tag_list_opt ::= */
+   415,  /* (306) tag_list_opt ::= tag_item */
+   415,  /* (307) tag_list_opt ::= tag_list_opt NK_COMMA tag_item */
+   417,  /* (308) tag_item ::= TBNAME */
+   417,  /* (309) tag_item ::= QTAGS */
+   417,  /* (310) tag_item ::= column_name */
+   417,  /* (311) tag_item ::= column_name column_alias */
+   417,  /* (312) tag_item ::= column_name AS column_alias */
+   409,  /* (313) db_kind_opt ::= */
+   409,  /* (314) db_kind_opt ::= USER */
+   409,  /* (315) db_kind_opt ::= SYSTEM */
+   349,  /* (316) cmd ::= CREATE SMA INDEX not_exists_opt col_name ON full_table_name index_options */
+   349,  /* (317) cmd ::= CREATE INDEX not_exists_opt col_name ON full_table_name NK_LP col_name_list NK_RP */
+   349,  /* (318) cmd ::= DROP INDEX exists_opt full_index_name */
+   420,  /* (319) full_index_name ::= index_name */
+   420,  /* (320) full_index_name ::= db_name NK_DOT index_name */
+   419,  /* (321) index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_RP sliding_opt sma_stream_opt */
+   419,  /* (322) index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt sma_stream_opt */
+   422,  /* (323) func_list ::= func */
+   422,  /* (324) func_list ::= func_list NK_COMMA func */
+   425,  /* (325) func ::= sma_func_name NK_LP expression_list NK_RP */
+   426,  /* (326) sma_func_name ::= function_name */
+   426,  /* (327) sma_func_name ::= COUNT */
+   426,  /* (328) sma_func_name ::= FIRST */
+   426,  /* (329) sma_func_name ::= LAST */
+   426,  /* (330) sma_func_name ::= LAST_ROW */
+   424,  /* (331) sma_stream_opt ::= */
+   424,  /* (332) sma_stream_opt ::= sma_stream_opt WATERMARK duration_literal */
+   424,  /* (333) sma_stream_opt ::= sma_stream_opt MAX_DELAY duration_literal */
+   424,  /* (334) sma_stream_opt ::= sma_stream_opt DELETE_MARK duration_literal */
+   427,  /* (335) with_meta ::= AS */
+   427,  /* (336) with_meta ::= WITH META AS */
+   427,  /* (337) with_meta ::= ONLY META AS */
+   349,  /* (338) cmd ::= CREATE TOPIC not_exists_opt topic_name AS query_or_subquery */
+   349,  /* (339) cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta DATABASE db_name */
+   349,  /* (340) cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta STABLE full_table_name where_clause_opt */
+   349,  /* (341) cmd ::= DROP TOPIC exists_opt topic_name */
+   349,  /* (342) cmd ::= DROP CONSUMER GROUP exists_opt cgroup_name ON topic_name */
+   349,  /* (343) cmd ::= DESC full_table_name */
+   349,  /* (344) cmd ::= DESCRIBE full_table_name */
+   349,  /* (345) cmd ::= RESET QUERY CACHE */
+   349,  /* (346) cmd ::= EXPLAIN analyze_opt explain_options query_or_subquery */
+   349,  /* (347) cmd ::= EXPLAIN analyze_opt explain_options insert_query */
+   431,  /* (348) analyze_opt ::= */
+   431,  /* (349) analyze_opt ::= ANALYZE */
+   432,  /* (350) explain_options ::= */
+   432,  /* (351) explain_options ::= explain_options VERBOSE NK_BOOL */
+   432,  /* (352) explain_options ::= explain_options RATIO NK_FLOAT */
+   349,  /* (353) cmd ::= CREATE or_replace_opt agg_func_opt FUNCTION not_exists_opt function_name AS NK_STRING OUTPUTTYPE type_name bufsize_opt language_opt */
+   349,  /* (354) cmd ::= DROP FUNCTION exists_opt function_name */
+   435,  /* (355) agg_func_opt ::= */
+   435,  /* (356) agg_func_opt ::= AGGREGATE */
+   436,  /* (357) bufsize_opt ::= */
+   436,  /* (358) bufsize_opt ::= BUFSIZE NK_INTEGER */
+   437,  /* (359) language_opt ::= */
+   437,  /* (360) language_opt ::= LANGUAGE NK_STRING */
+   434,  /* (361) or_replace_opt ::= */
+   434,  /* (362) or_replace_opt ::= OR REPLACE */
+   349,  /* (363) cmd ::= CREATE or_replace_opt VIEW full_view_name AS query_or_subquery */
+   349,  /* (364) cmd ::= DROP VIEW exists_opt full_view_name */
+   438,  /* (365) full_view_name ::= view_name */
+   438,  /* (366) full_view_name ::= db_name NK_DOT view_name */
+   349,  /* (367) cmd ::= CREATE STREAM not_exists_opt stream_name stream_options INTO full_table_name col_list_opt tag_def_or_ref_opt subtable_opt AS query_or_subquery */
+   349,  /* (368) cmd ::= DROP STREAM exists_opt stream_name */
+   349,  /* (369) cmd ::= PAUSE STREAM exists_opt stream_name */
+   349,  /* (370) cmd ::= RESUME STREAM exists_opt ignore_opt stream_name */
+   442,  /* (371) col_list_opt ::= */
+   442,  /* (372) col_list_opt ::= NK_LP col_name_list NK_RP */
+   443,  /* (373) tag_def_or_ref_opt ::= */
+   443,  /* (374) tag_def_or_ref_opt ::= tags_def */
+   443,  /* (375) tag_def_or_ref_opt ::= TAGS NK_LP col_name_list NK_RP */
+   441,  /* (376) stream_options ::= */
+   441,  /* (377) stream_options ::= stream_options TRIGGER AT_ONCE */
+   441,  /* (378) stream_options ::= stream_options TRIGGER WINDOW_CLOSE */
+   441,  /* (379) stream_options ::= stream_options TRIGGER MAX_DELAY duration_literal */
+   441,  /* (380) stream_options ::= stream_options WATERMARK duration_literal */
+   441,  /* (381) stream_options ::= stream_options IGNORE EXPIRED NK_INTEGER */
+   441,  /* (382) stream_options ::= stream_options FILL_HISTORY NK_INTEGER */
+   441,  /* (383) stream_options ::= stream_options DELETE_MARK duration_literal */
+   441,  /* (384) stream_options ::= stream_options IGNORE UPDATE NK_INTEGER */
+   444,  /* (385) subtable_opt ::= */
+   444,  /* (386) subtable_opt ::= SUBTABLE NK_LP expression NK_RP */
+   445,  /* (387) ignore_opt ::= */
+   445,  /* (388) ignore_opt ::= IGNORE UNTREATED */
+   349,  /* (389) cmd ::= KILL CONNECTION NK_INTEGER */
+   349,  /* (390) cmd ::= KILL QUERY NK_STRING */
+   349,  /* (391) cmd ::= KILL TRANSACTION NK_INTEGER */
+   349,  /* (392) cmd ::= KILL COMPACT NK_INTEGER */
+   349,  /* (393) cmd ::= BALANCE VGROUP */
+   349,  /* (394) cmd ::= BALANCE VGROUP LEADER on_vgroup_id */
+   349,  /* (395) cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER */
+   349,  /* (396) cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list */
+   349,  /* (397) cmd ::= SPLIT VGROUP NK_INTEGER */
+   447,  /* (398) on_vgroup_id ::= */
+   447,  /* (399) on_vgroup_id ::= ON NK_INTEGER */
+   448,  /* (400) dnode_list ::= DNODE NK_INTEGER */
+   448,  /* (401) dnode_list ::= dnode_list DNODE NK_INTEGER */
+   349,  /* (402) cmd ::= DELETE FROM full_table_name where_clause_opt */
+   349,  /* (403) cmd ::= query_or_subquery */
+   349,  /* (404) cmd ::= insert_query */
+   433,  /* (405) insert_query ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery */
+   433,  /* (406) insert_query ::= INSERT INTO full_table_name query_or_subquery */
+   352,  /* (407) literal ::= NK_INTEGER */
+   352,  /* (408) literal ::= NK_FLOAT */
+   352,  /* (409) literal ::= NK_STRING */
+   352,  /* (410) literal ::= NK_BOOL */
+   352,  /* (411) literal ::= TIMESTAMP NK_STRING */
+   352,  /* (412) literal ::= duration_literal */
+   352,  /* (413) literal ::= NULL */
+   352,  /* (414) literal ::= NK_QUESTION */
+   405,  /* (415) duration_literal ::= NK_VARIABLE */
+   381,  /* (416) signed ::= NK_INTEGER */
+   381,  /* (417) signed ::= NK_PLUS NK_INTEGER */
+   381,  /* (418) signed ::= NK_MINUS NK_INTEGER */
+   381,  /* (419) signed ::= NK_FLOAT */
+   381,  /* (420) signed ::= NK_PLUS NK_FLOAT */
+   381,  /* (421) signed ::= NK_MINUS NK_FLOAT */
+   395,  /* (422) signed_literal ::= signed */
+   395,  /* (423) signed_literal ::= NK_STRING */
+   395,  /* (424) signed_literal ::= NK_BOOL */
+   395,  /* (425) signed_literal ::= TIMESTAMP NK_STRING */
+   395,  /* (426) signed_literal ::= duration_literal */
+   395,  /* (427) signed_literal ::= NULL */
+   395,  /* (428) signed_literal ::= literal_func */
+   395,  /* (429) signed_literal ::= NK_QUESTION */
+   450,  /* (430) literal_list ::= signed_literal */
+   450,  /* (431) literal_list ::= literal_list NK_COMMA signed_literal */
+   364,  /* (432) db_name ::= NK_ID */
+   365,  /* (433) table_name ::= NK_ID */
+   393,  /* (434) column_name ::= NK_ID */
+   407,  /* (435) function_name ::= NK_ID */
+   439,  /* (436) view_name ::= NK_ID */
+   451,  /* (437) table_alias ::= NK_ID */
+   418,  /* (438) column_alias ::= NK_ID */
+   418,  /* (439) column_alias ::= NK_ALIAS */
+   357,  /* (440) user_name ::= NK_ID */
+   366,  /* (441) topic_name ::= NK_ID */
+   440,  /* (442) stream_name ::= NK_ID */
+   430,  /* (443) cgroup_name ::= NK_ID */
+   421,  /* (444) index_name ::= NK_ID */
+   452,  /* (445) expr_or_subquery ::= expression */
+   446,  /* (446) expression ::= literal */
+   446,  /* (447) expression ::= pseudo_column */
+   446,  /* (448) expression ::= column_reference */
+   446,  /* (449) expression ::= function_expression */
+   446,  /* (450) expression ::= case_when_expression */
+   446,  /* (451) expression ::= NK_LP expression NK_RP */
+   446,  /* (452) expression ::= NK_PLUS expr_or_subquery */
+   446,  /* (453) expression ::= NK_MINUS expr_or_subquery */
+   446,  /* (454) expression ::= expr_or_subquery NK_PLUS expr_or_subquery */
+   446,  /* (455) expression ::= expr_or_subquery NK_MINUS expr_or_subquery */
+   446,  /* (456) expression ::= expr_or_subquery NK_STAR expr_or_subquery */
+   446,  /* (457) expression ::= expr_or_subquery NK_SLASH expr_or_subquery */
+   446,  /* (458) expression ::= expr_or_subquery NK_REM expr_or_subquery */
+   446,  /* (459) expression ::= column_reference NK_ARROW NK_STRING */
+   446,  /* (460) expression ::= expr_or_subquery NK_BITAND expr_or_subquery */
+   446,  /* (461) expression ::= expr_or_subquery NK_BITOR expr_or_subquery */
+   398,  /* (462) expression_list ::= expr_or_subquery */
+   398,  /* (463) expression_list ::= expression_list NK_COMMA expr_or_subquery */
+   454,  /* (464) column_reference ::= column_name */
+   454,  /* (465) column_reference ::= table_name NK_DOT column_name */
+   454,  /* (466) column_reference ::= NK_ALIAS */
+   454,  /* (467) column_reference ::= table_name NK_DOT NK_ALIAS */
+   453,  /* (468) pseudo_column ::= ROWTS */
+   453,  /* (469) pseudo_column ::= TBNAME */
+   453,  /* (470) pseudo_column ::= table_name NK_DOT TBNAME */
+   453,  /* (471) pseudo_column ::= QSTART */
+   453,  /* (472) pseudo_column ::= QEND */
+   453,  /* (473) pseudo_column ::= QDURATION */
+   453,  /* (474) pseudo_column ::= WSTART */
+   453,  /* (475) pseudo_column ::= WEND */
+   453,  /* (476) pseudo_column ::= WDURATION */
+   453,  /* (477) pseudo_column ::= IROWTS */
+   453,  /* (478) pseudo_column ::= ISFILLED */
+   453,  /* (479) pseudo_column ::= QTAGS */
+   455,  /* (480) function_expression ::= function_name NK_LP expression_list NK_RP */
+   455,  /* (481) function_expression ::= star_func NK_LP star_func_para_list NK_RP */
+   455,  /* (482) function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP */
+   455,  /* (483) function_expression ::= literal_func */
+   449,  /* (484) literal_func ::= noarg_func NK_LP NK_RP */
+   449,  /* (485) literal_func ::= NOW */
+   459,  /* (486) noarg_func ::= NOW */
+   459,  /* (487) noarg_func ::= TODAY */
+   459,  /* (488) noarg_func ::= TIMEZONE */
+   459,  /* (489) noarg_func ::= DATABASE */
+   459,  /* (490) noarg_func ::= CLIENT_VERSION */
+   459,  /* (491) noarg_func ::= SERVER_VERSION */
+   459,  /* (492) noarg_func ::= SERVER_STATUS */
+   459,  /* (493) noarg_func ::= CURRENT_USER */
+   459,  /* (494) noarg_func ::= USER */
+   457,  /* (495) star_func ::= COUNT */
+   457,  /* (496) star_func ::= FIRST */
+   457,  /* (497) star_func ::= LAST */
+   457,  /* (498) star_func ::= LAST_ROW */
+   458,  /* (499) star_func_para_list ::= NK_STAR */
+   458,  /* (500) star_func_para_list ::= other_para_list */
+   460,  /* (501) other_para_list ::= star_func_para */
+   460,  /* (502) other_para_list ::= other_para_list NK_COMMA star_func_para */
+   461,  /* (503) star_func_para ::= expr_or_subquery */
+   461,  /* (504) star_func_para ::= table_name NK_DOT NK_STAR */
+   456,  /* (505) case_when_expression ::= CASE when_then_list case_when_else_opt END */
+   456,  /* (506) case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END */
+   462,  /* (507) when_then_list ::= when_then_expr */
+   462,  /* (508) when_then_list ::= when_then_list when_then_expr */
+   465,  /* (509) when_then_expr ::= WHEN common_expression THEN common_expression */
+   463,  /* (510) case_when_else_opt ::= */
+   463,  /* (511) case_when_else_opt ::= ELSE common_expression */
+   466,  /* (512) predicate ::= expr_or_subquery compare_op expr_or_subquery */
+   466,  /* (513) predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery */
+   466,  /* (514) predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery */
+   466,  /* (515) predicate ::= expr_or_subquery IS NULL */
+   466,  /* (516) predicate ::= expr_or_subquery IS NOT NULL */
+   466,  /* (517) predicate ::= expr_or_subquery in_op in_predicate_value */
+   467,  /* (518) compare_op ::= NK_LT */
+   467,  /* (519) compare_op ::= NK_GT */
+   467,  /* (520) compare_op ::= NK_LE */
+   467,  /* (521) compare_op ::= NK_GE */
+   467,  /* (522) compare_op ::= NK_NE */
+   467,  /* (523) compare_op ::= NK_EQ */
+   467,  /* (524) compare_op ::= LIKE */
+   467,  /* (525) compare_op ::= NOT LIKE */
+   467,  /* (526) compare_op ::= MATCH */
+   467,  /* (527) compare_op ::= NMATCH */
+   467,  /* (528) compare_op ::= CONTAINS */
+   468,  /* (529) in_op ::= IN */
+   468,  /* (530) in_op ::= NOT IN */
+   469,  /* (531) in_predicate_value ::= NK_LP literal_list NK_RP */
+   470,  /* (532) boolean_value_expression ::= boolean_primary */
+   470,  /* (533) boolean_value_expression ::= NOT boolean_primary */
+   470,  /* (534) boolean_value_expression ::= boolean_value_expression OR boolean_value_expression */
+   470,  /* (535) boolean_value_expression ::= boolean_value_expression AND boolean_value_expression */
+   471,  /* (536) boolean_primary ::= predicate */
+   471,  /* (537) boolean_primary ::= NK_LP boolean_value_expression NK_RP */
+   464,  /* (538) common_expression ::= expr_or_subquery */
+   464,  /* (539) common_expression ::= boolean_value_expression */
+   472,  /* (540) from_clause_opt ::= */
+   472,  /* (541) from_clause_opt ::= FROM table_reference_list */
+   473,  /* (542) table_reference_list ::= table_reference */
+   473,  /* (543) table_reference_list ::= table_reference_list NK_COMMA table_reference */
+   474,  /* (544) table_reference ::= table_primary */
+   474,  /* (545) table_reference ::= joined_table */
+   475,  /* (546) table_primary ::= table_name alias_opt */
+   475,  /* (547) table_primary ::= db_name NK_DOT table_name alias_opt */
+   475,  /* (548) table_primary ::= subquery alias_opt */
+   475,  /* (549) table_primary ::= parenthesized_joined_table */
+   477,  /* (550) alias_opt ::= */
+   477,  /* (551) alias_opt ::= table_alias */
+   477,  /* (552) alias_opt ::= AS table_alias */
+   479,  /* (553) parenthesized_joined_table ::= NK_LP joined_table NK_RP */
+   479,  /* (554) parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP */
+   476,  /* (555) joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
+   480,  /* (556) join_type ::= */
+   480,  /* (557) join_type ::= INNER */
+   481,  /* (558) query_specification ::= SELECT hint_list set_quantifier_opt tag_mode_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
+   482,  /* (559) hint_list ::= */
+   482,  /* (560) hint_list ::= NK_HINT */
+   484,  /* (561) tag_mode_opt ::= */
+   484,  /* (562) tag_mode_opt ::= TAGS */
+   483,  /* (563) set_quantifier_opt ::= */
+   483,  /* (564) set_quantifier_opt ::= DISTINCT */
+   483,  /* (565) set_quantifier_opt ::= ALL */
+   485,  /* (566) select_list ::= select_item */
+   485,  /* (567) select_list ::= select_list NK_COMMA select_item */
+   493,  /* (568) select_item ::= NK_STAR */
+   493,  /* (569) select_item ::= common_expression */
+   493,  /* (570) select_item ::= common_expression column_alias */
+   493,  /* (571) select_item ::= common_expression AS column_alias */
+   493,  /* (572) select_item ::= table_name NK_DOT NK_STAR */
+   429,  /* (573) where_clause_opt ::= */
+   429,  /* (574) where_clause_opt ::= WHERE search_condition */
+   486,  /* (575) partition_by_clause_opt ::= */
+   486,  /* (576) partition_by_clause_opt ::= PARTITION BY partition_list */
+   494,  /* (577) partition_list ::= partition_item */
+   494,  /* (578) partition_list ::= partition_list NK_COMMA partition_item */
+   495,  /* (579) partition_item ::= expr_or_subquery */
+   495,  /* (580) partition_item ::= expr_or_subquery column_alias */
+   495,  /* (581) partition_item ::= expr_or_subquery AS column_alias */
+   490,  /* (582) twindow_clause_opt ::= */
+   490,  /* (583) twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA interval_sliding_duration_literal NK_RP */
+   490,  /* (584) twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
+   490,  /* (585) twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_RP sliding_opt fill_opt */
+   490,  /* (586) twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_COMMA interval_sliding_duration_literal NK_RP sliding_opt fill_opt */
+   490,  /* (587) twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition */
+   423,  /* (588) sliding_opt ::= */
+   423,  /* (589) sliding_opt ::= SLIDING NK_LP interval_sliding_duration_literal NK_RP */
+   496,  /* (590) interval_sliding_duration_literal ::= NK_VARIABLE */
+   496,  /* (591) interval_sliding_duration_literal ::= NK_STRING */
+   496,  /* (592) interval_sliding_duration_literal ::= NK_INTEGER */
+   489,  /* (593) fill_opt ::= */
+   489,  /* (594) fill_opt ::= FILL NK_LP fill_mode NK_RP */
+   489,  /* (595) fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP */
+   489,  /* (596) fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP */
+   497,  /* (597) fill_mode ::= NONE */
+   497,  /* (598) fill_mode ::= PREV */
+   497,  /* (599) fill_mode ::= NULL */
+   497,  /* (600) fill_mode ::= NULL_F */
+   497,  /* (601) fill_mode ::= LINEAR */
+   497,  /* (602) fill_mode ::= NEXT */
+   491,  /* (603) group_by_clause_opt ::= */
+   491,  /* (604) group_by_clause_opt ::= GROUP BY group_by_list */
+   498,  /* (605) group_by_list ::= expr_or_subquery */
+   498,  /* (606) group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
+   492,  /* (607) having_clause_opt ::= */
+   492,  /* (608) having_clause_opt ::= HAVING search_condition */
+   487,  /* (609) range_opt ::= */
+   487,  /* (610) range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
+   487,  /* (611) range_opt ::= RANGE NK_LP expr_or_subquery NK_RP */
+   488,  /* (612) every_opt ::= */
+   488,  /* (613) every_opt ::= EVERY NK_LP duration_literal NK_RP */
+   499,  /* (614) query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
+   500,  /* (615) query_simple ::= query_specification */
+   500,  /* (616) query_simple ::= union_query_expression */
+   504,  /* (617) union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
+   504,  /* (618) union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
+   505,  /* (619) query_simple_or_subquery ::= query_simple */
+   505,  /* (620) query_simple_or_subquery ::= subquery */
+   428,  /* (621) query_or_subquery ::= query_expression */
+   428,  /* (622) query_or_subquery ::= subquery */
+   501,  /* (623) order_by_clause_opt ::= */
+   501,  /* (624) order_by_clause_opt ::= ORDER BY sort_specification_list */
+   502,  /* (625) slimit_clause_opt ::= */
+   502,  /* (626) slimit_clause_opt ::= SLIMIT NK_INTEGER */
+   502,  /* (627) slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
+   502,  /* (628) slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
+   503,  /* (629) limit_clause_opt ::= */
+   503,  /* (630) limit_clause_opt ::= LIMIT NK_INTEGER */
+   503,  /* (631) limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */
+   503,  /* (632) limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */
+   478,  /* (633) subquery ::= NK_LP query_expression NK_RP */
+   478,  /* (634) subquery ::= NK_LP subquery NK_RP */
+   367,  /* (635) search_condition ::= common_expression */
+   506,  /* (636) sort_specification_list ::= sort_specification */
+   506,  /* (637) sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */
+   507,  /* (638) sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
+   508,  /* (639) ordering_specification_opt ::= */
+   508,  /* (640) ordering_specification_opt ::= ASC */
+   508,  /* (641) ordering_specification_opt ::= DESC */
+   509,  /* (642) null_ordering_opt ::= */
+   509,  /* (643) null_ordering_opt ::= NULLS FIRST */
+   509,  /* (644) null_ordering_opt ::= NULLS LAST */
 };
 
 /* For rule J, yyRuleInfoNRhs[J] contains the negative of the number
@@ -4493,524 +4492,527 @@ static const signed char yyRuleInfoNRhs[] = {
    -3,  /* (121) db_options ::= db_options WAL_ROLL_PERIOD NK_INTEGER */
    -3,  /* (122) db_options ::= db_options WAL_SEGMENT_SIZE NK_INTEGER */
    -3,  /* (123) db_options ::= db_options STT_TRIGGER NK_INTEGER */
-   -3,  /* (124) db_options ::= db_options TABLE_PREFIX signed */
-   -3,  /* (125) db_options ::= db_options TABLE_SUFFIX signed */
-   -3,  /* (126) db_options ::= db_options KEEP_TIME_OFFSET NK_INTEGER */
-   -1,  /* (127) alter_db_options ::= alter_db_option */
-   -2,  /* (128) alter_db_options ::= alter_db_options alter_db_option */
-   -2,  /* (129) alter_db_option ::= BUFFER NK_INTEGER */
-   -2,  /* (130) alter_db_option ::= CACHEMODEL NK_STRING */
-   -2,  /* (131) alter_db_option ::= CACHESIZE NK_INTEGER */
-   -2,  /* (132) alter_db_option ::= WAL_FSYNC_PERIOD NK_INTEGER */
-   -2,  /* (133) alter_db_option ::= KEEP integer_list */
-   -2,  /* (134) alter_db_option ::= KEEP variable_list */
-   -2,  /* (135) alter_db_option ::= PAGES NK_INTEGER */
-   -2,  /* (136) alter_db_option ::= REPLICA NK_INTEGER */
-   -2,  /* (137) alter_db_option ::= WAL_LEVEL NK_INTEGER */
-   -2,  /* (138) alter_db_option ::= STT_TRIGGER NK_INTEGER */
-   -2,  /* (139) alter_db_option ::= MINROWS NK_INTEGER */
-   -2,  /* (140) alter_db_option ::= WAL_RETENTION_PERIOD NK_INTEGER */
-   -3,  /* (141) alter_db_option ::= WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
-   -2,  /* (142) alter_db_option ::= WAL_RETENTION_SIZE NK_INTEGER */
-   -3,  /* (143) alter_db_option ::= WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
-   -2,  /* (144) alter_db_option ::= KEEP_TIME_OFFSET NK_INTEGER */
-   -1,  /* (145) integer_list ::= NK_INTEGER */
-   -3,  /* (146) integer_list ::= integer_list NK_COMMA NK_INTEGER */
-   -1,  /* (147) variable_list ::= NK_VARIABLE */
-   -3,  /* (148) variable_list ::= variable_list NK_COMMA NK_VARIABLE */
-   -1,  /* (149) retention_list ::= retention */
-   -3,  /* (150) retention_list ::= retention_list NK_COMMA retention */
-   -3,  /* (151) retention ::= NK_VARIABLE NK_COLON NK_VARIABLE */
-   -3,  /* (152) retention ::= NK_MINUS NK_COLON NK_VARIABLE */
-    0,  /* (153) speed_opt ::= */
-   -2,  /* (154) speed_opt ::= BWLIMIT NK_INTEGER */
-    0,  /* (155) start_opt ::= */
-   -3,  /* (156) start_opt ::= START WITH NK_INTEGER */
-   -3,  /* (157) start_opt ::= START WITH NK_STRING */
-   -4,  /* (158) start_opt ::= START WITH TIMESTAMP NK_STRING */
-    0,  /* (159) end_opt ::= */
-   -3,  /* (160) end_opt ::= END WITH NK_INTEGER */
-   -3,  /* (161) end_opt ::= END WITH NK_STRING */
-   -4,  /* (162) end_opt ::= END WITH TIMESTAMP NK_STRING */
-   -9,  /* (163) cmd ::= CREATE TABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def_opt table_options */
-   -3,  /* (164) cmd ::= CREATE TABLE multi_create_clause */
-   -9,  /* (165) cmd ::= CREATE STABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def table_options */
-   -3,  /* (166) cmd ::= DROP TABLE multi_drop_clause */
-   -4,  /* (167) cmd ::= DROP STABLE exists_opt full_table_name */
-   -3,  /* (168) cmd ::= ALTER TABLE alter_table_clause */
-   -3,  /* (169) cmd ::= ALTER STABLE alter_table_clause */
-   -2,  /* (170) alter_table_clause ::= full_table_name alter_table_options */
-   -5,  /* (171) alter_table_clause ::= full_table_name ADD COLUMN column_name type_name */
-   -4,  /* (172) alter_table_clause ::= full_table_name DROP COLUMN column_name */
-   -5,  /* (173) alter_table_clause ::= full_table_name MODIFY COLUMN column_name type_name */
-   -5,  /* (174) alter_table_clause ::= full_table_name RENAME COLUMN column_name column_name */
-   -5,  /* (175) alter_table_clause ::= full_table_name ADD TAG column_name type_name */
-   -4,  /* (176) alter_table_clause ::= full_table_name DROP TAG column_name */
-   -5,  /* (177) alter_table_clause ::= full_table_name MODIFY TAG column_name type_name */
-   -5,  /* (178) alter_table_clause ::= full_table_name RENAME TAG column_name column_name */
-   -6,  /* (179) alter_table_clause ::= full_table_name SET TAG column_name NK_EQ signed_literal */
-   -1,  /* (180) multi_create_clause ::= create_subtable_clause */
-   -2,  /* (181) multi_create_clause ::= multi_create_clause create_subtable_clause */
-  -10,  /* (182) create_subtable_clause ::= not_exists_opt full_table_name USING full_table_name specific_cols_opt TAGS NK_LP expression_list NK_RP table_options */
-   -1,  /* (183) multi_drop_clause ::= drop_table_clause */
-   -3,  /* (184) multi_drop_clause ::= multi_drop_clause NK_COMMA drop_table_clause */
-   -2,  /* (185) drop_table_clause ::= exists_opt full_table_name */
-    0,  /* (186) specific_cols_opt ::= */
-   -3,  /* (187) specific_cols_opt ::= NK_LP col_name_list NK_RP */
-   -1,  /* (188) full_table_name ::= table_name */
-   -3,  /* (189) full_table_name ::= db_name NK_DOT table_name */
-   -1,  /* (190) column_def_list ::= column_def */
-   -3,  /* (191) column_def_list ::= column_def_list NK_COMMA column_def */
-   -2,  /* (192) column_def ::= column_name type_name */
-   -1,  /* (193) type_name ::= BOOL */
-   -1,  /* (194) type_name ::= TINYINT */
-   -1,  /* (195) type_name ::= SMALLINT */
-   -1,  /* (196) type_name ::= INT */
-   -1,  /* (197) type_name ::= INTEGER */
-   -1,  /* (198) type_name ::= BIGINT */
-   -1,  /* (199) type_name ::= FLOAT */
-   -1,  /* (200) type_name ::= DOUBLE */
-   -4,  /* (201) type_name ::= BINARY NK_LP NK_INTEGER NK_RP */
-   -1,  /* (202) type_name ::= TIMESTAMP */
-   -4,  /* (203) type_name ::= NCHAR NK_LP NK_INTEGER NK_RP */
-   -2,  /* (204) type_name ::= TINYINT UNSIGNED */
-   -2,  /* (205) type_name ::= SMALLINT UNSIGNED */
-   -2,  /* (206) type_name ::= INT UNSIGNED */
-   -2,  /* (207) type_name ::= BIGINT UNSIGNED */
-   -1,  /* (208) type_name ::= JSON */
-   -4,  /* (209) type_name ::= VARCHAR NK_LP NK_INTEGER NK_RP */
-   -1,  /* (210) type_name ::= MEDIUMBLOB */
-   -1,  /* (211) type_name ::= BLOB */
-   -4,  /* (212) type_name ::= VARBINARY NK_LP NK_INTEGER NK_RP */
-   -4,  /* (213) type_name ::= GEOMETRY NK_LP NK_INTEGER NK_RP */
-   -1,  /* (214) type_name ::= DECIMAL */
-   -4,  /* (215) type_name ::= DECIMAL NK_LP NK_INTEGER NK_RP */
-   -6,  /* (216) type_name ::= DECIMAL NK_LP NK_INTEGER NK_COMMA NK_INTEGER NK_RP */
-    0,  /* (217) tags_def_opt ::= */
-   -1,  /* (218) tags_def_opt ::= tags_def */
-   -4,  /* (219) tags_def ::= TAGS NK_LP column_def_list NK_RP */
-    0,  /* (220) table_options ::= */
-   -3,  /* (221) table_options ::= table_options COMMENT NK_STRING */
-   -3,  /* (222) table_options ::= table_options MAX_DELAY duration_list */
-   -3,  /* (223) table_options ::= table_options WATERMARK duration_list */
-   -5,  /* (224) table_options ::= table_options ROLLUP NK_LP rollup_func_list NK_RP */
-   -3,  /* (225) table_options ::= table_options TTL NK_INTEGER */
-   -5,  /* (226) table_options ::= table_options SMA NK_LP col_name_list NK_RP */
-   -3,  /* (227) table_options ::= table_options DELETE_MARK duration_list */
-   -1,  /* (228) alter_table_options ::= alter_table_option */
-   -2,  /* (229) alter_table_options ::= alter_table_options alter_table_option */
-   -2,  /* (230) alter_table_option ::= COMMENT NK_STRING */
-   -2,  /* (231) alter_table_option ::= TTL NK_INTEGER */
-   -1,  /* (232) duration_list ::= duration_literal */
-   -3,  /* (233) duration_list ::= duration_list NK_COMMA duration_literal */
-   -1,  /* (234) rollup_func_list ::= rollup_func_name */
-   -3,  /* (235) rollup_func_list ::= rollup_func_list NK_COMMA rollup_func_name */
-   -1,  /* (236) rollup_func_name ::= function_name */
-   -1,  /* (237) rollup_func_name ::= FIRST */
-   -1,  /* (238) rollup_func_name ::= LAST */
-   -1,  /* (239) col_name_list ::= col_name */
-   -3,  /* (240) col_name_list ::= col_name_list NK_COMMA col_name */
-   -1,  /* (241) col_name ::= column_name */
-   -2,  /* (242) cmd ::= SHOW DNODES */
-   -2,  /* (243) cmd ::= SHOW USERS */
-   -3,  /* (244) cmd ::= SHOW USER PRIVILEGES */
-   -3,  /* (245) cmd ::= SHOW db_kind_opt DATABASES */
-   -4,  /* (246) cmd ::= SHOW table_kind_db_name_cond_opt TABLES like_pattern_opt */
-   -4,  /* (247) cmd ::= SHOW db_name_cond_opt STABLES like_pattern_opt */
-   -3,  /* (248) cmd ::= SHOW db_name_cond_opt VGROUPS */
-   -2,  /* (249) cmd ::= SHOW MNODES */
-   -2,  /* (250) cmd ::= SHOW QNODES */
-   -2,  /* (251) cmd ::= SHOW FUNCTIONS */
-   -5,  /* (252) cmd ::= SHOW INDEXES FROM table_name_cond from_db_opt */
-   -6,  /* (253) cmd ::= SHOW INDEXES FROM db_name NK_DOT table_name */
-   -2,  /* (254) cmd ::= SHOW STREAMS */
-   -2,  /* (255) cmd ::= SHOW ACCOUNTS */
-   -2,  /* (256) cmd ::= SHOW APPS */
-   -2,  /* (257) cmd ::= SHOW CONNECTIONS */
-   -2,  /* (258) cmd ::= SHOW LICENCES */
-   -2,  /* (259) cmd ::= SHOW GRANTS */
-   -4,  /* (260) cmd ::= SHOW CREATE DATABASE db_name */
-   -4,  /* (261) cmd ::= SHOW CREATE TABLE full_table_name */
-   -4,  /* (262) cmd ::= SHOW CREATE STABLE full_table_name */
-   -2,  /* (263) cmd ::= SHOW QUERIES */
-   -2,  /* (264) cmd ::= SHOW SCORES */
-   -2,  /* (265) cmd ::= SHOW TOPICS */
-   -2,  /* (266) cmd ::= SHOW VARIABLES */
-   -3,  /* (267) cmd ::= SHOW CLUSTER VARIABLES */
-   -3,  /* (268) cmd ::= SHOW LOCAL VARIABLES */
-   -5,  /* (269) cmd ::= SHOW DNODE NK_INTEGER VARIABLES like_pattern_opt */
-   -2,  /* (270) cmd ::= SHOW BNODES */
-   -2,  /* (271) cmd ::= SHOW SNODES */
-   -2,  /* (272) cmd ::= SHOW CLUSTER */
-   -2,  /* (273) cmd ::= SHOW TRANSACTIONS */
-   -4,  /* (274) cmd ::= SHOW TABLE DISTRIBUTED full_table_name */
-   -2,  /* (275) cmd ::= SHOW CONSUMERS */
-   -2,  /* (276) cmd ::= SHOW SUBSCRIPTIONS */
-   -5,  /* (277) cmd ::= SHOW TAGS FROM table_name_cond from_db_opt */
-   -6,  /* (278) cmd ::= SHOW TAGS FROM db_name NK_DOT table_name */
-   -7,  /* (279) cmd ::= SHOW TABLE TAGS tag_list_opt FROM table_name_cond from_db_opt */
-   -8,  /* (280) cmd ::= SHOW TABLE TAGS tag_list_opt FROM db_name NK_DOT table_name */
-   -5,  /* (281) cmd ::= SHOW VNODES ON DNODE NK_INTEGER */
-   -2,  /* (282) cmd ::= SHOW VNODES */
-   -3,  /* (283) cmd ::= SHOW db_name_cond_opt ALIVE */
-   -3,  /* (284) cmd ::= SHOW CLUSTER ALIVE */
-   -3,  /* (285) cmd ::= SHOW db_name_cond_opt VIEWS */
-   -4,  /* (286) cmd ::= SHOW CREATE VIEW full_table_name */
-   -2,  /* (287) cmd ::= SHOW COMPACTS */
-   -3,  /* (288) cmd ::= SHOW COMPACT NK_INTEGER */
-    0,  /* (289) table_kind_db_name_cond_opt ::= */
-   -1,  /* (290) table_kind_db_name_cond_opt ::= table_kind */
-   -2,  /* (291) table_kind_db_name_cond_opt ::= db_name NK_DOT */
-   -3,  /* (292) table_kind_db_name_cond_opt ::= table_kind db_name NK_DOT */
-   -1,  /* (293) table_kind ::= NORMAL */
-   -1,  /* (294) table_kind ::= CHILD */
-    0,  /* (295) db_name_cond_opt ::= */
-   -2,  /* (296) db_name_cond_opt ::= db_name NK_DOT */
-    0,  /* (297) like_pattern_opt ::= */
-   -2,  /* (298) like_pattern_opt ::= LIKE NK_STRING */
-   -1,  /* (299) table_name_cond ::= table_name */
-    0,  /* (300) from_db_opt ::= */
-   -2,  /* (301) from_db_opt ::= FROM db_name */
-    0,  /* (302) tag_list_opt ::= */
-   -1,  /* (303) tag_list_opt ::= tag_item */
-   -3,  /* (304) tag_list_opt ::= tag_list_opt NK_COMMA tag_item */
-   -1,  /* (305) tag_item ::= TBNAME */
-   -1,  /* (306) tag_item ::= QTAGS */
-   -1,  /* (307) tag_item ::= column_name */
-   -2,  /* (308) tag_item ::= column_name column_alias */
-   -3,  /* (309) tag_item ::= column_name AS column_alias */
-    0,  /* (310) db_kind_opt ::= */
-   -1,  /* (311) db_kind_opt ::= USER */
-   -1,  /* (312) db_kind_opt ::= SYSTEM */
-   -8,  /* (313) cmd ::= CREATE SMA INDEX not_exists_opt col_name ON full_table_name index_options */
-   -9,  /* (314) cmd ::= CREATE INDEX not_exists_opt col_name ON full_table_name NK_LP col_name_list NK_RP */
-   -4,  /* (315) cmd ::= DROP INDEX exists_opt full_index_name */
-   -1,  /* (316) full_index_name ::= index_name */
-   -3,  /* (317) full_index_name ::= db_name NK_DOT index_name */
-  -10,  /* (318) index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_RP sliding_opt sma_stream_opt */
-  -12,  /* (319) index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt sma_stream_opt */
-   -1,  /* (320) func_list ::= func */
-   -3,  /* (321) func_list ::= func_list NK_COMMA func */
-   -4,  /* (322) func ::= sma_func_name NK_LP expression_list NK_RP */
-   -1,  /* (323) sma_func_name ::= function_name */
-   -1,  /* (324) sma_func_name ::= COUNT */
-   -1,  /* (325) sma_func_name ::= FIRST */
-   -1,  /* (326) sma_func_name ::= LAST */
-   -1,  /* (327) sma_func_name ::= LAST_ROW */
-    0,  /* (328) sma_stream_opt ::= */
-   -3,  /* (329) sma_stream_opt ::= sma_stream_opt WATERMARK duration_literal */
-   -3,  /* (330) sma_stream_opt ::= sma_stream_opt MAX_DELAY duration_literal */
-   -3,  /* (331) sma_stream_opt ::= sma_stream_opt DELETE_MARK duration_literal */
-   -1,  /* (332) with_meta ::= AS */
-   -3,  /* (333) with_meta ::= WITH META AS */
-   -3,  /* (334) with_meta ::= ONLY META AS */
-   -6,  /* (335) cmd ::= CREATE TOPIC not_exists_opt topic_name AS query_or_subquery */
-   -7,  /* (336) cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta DATABASE db_name */
-   -8,  /* (337) cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta STABLE full_table_name where_clause_opt */
-   -4,  /* (338) cmd ::= DROP TOPIC exists_opt topic_name */
-   -7,  /* (339) cmd ::= DROP CONSUMER GROUP exists_opt cgroup_name ON topic_name */
-   -2,  /* (340) cmd ::= DESC full_table_name */
-   -2,  /* (341) cmd ::= DESCRIBE full_table_name */
-   -3,  /* (342) cmd ::= RESET QUERY CACHE */
-   -4,  /* (343) cmd ::= EXPLAIN analyze_opt explain_options query_or_subquery */
-   -4,  /* (344) cmd ::= EXPLAIN analyze_opt explain_options insert_query */
-    0,  /* (345) analyze_opt ::= */
-   -1,  /* (346) analyze_opt ::= ANALYZE */
-    0,  /* (347) explain_options ::= */
-   -3,  /* (348) explain_options ::= explain_options VERBOSE NK_BOOL */
-   -3,  /* (349) explain_options ::= explain_options RATIO NK_FLOAT */
-  -12,  /* (350) cmd ::= CREATE or_replace_opt agg_func_opt FUNCTION not_exists_opt function_name AS NK_STRING OUTPUTTYPE type_name bufsize_opt language_opt */
-   -4,  /* (351) cmd ::= DROP FUNCTION exists_opt function_name */
-    0,  /* (352) agg_func_opt ::= */
-   -1,  /* (353) agg_func_opt ::= AGGREGATE */
-    0,  /* (354) bufsize_opt ::= */
-   -2,  /* (355) bufsize_opt ::= BUFSIZE NK_INTEGER */
-    0,  /* (356) language_opt ::= */
-   -2,  /* (357) language_opt ::= LANGUAGE NK_STRING */
-    0,  /* (358) or_replace_opt ::= */
-   -2,  /* (359) or_replace_opt ::= OR REPLACE */
-   -6,  /* (360) cmd ::= CREATE or_replace_opt VIEW full_view_name AS query_or_subquery */
-   -4,  /* (361) cmd ::= DROP VIEW exists_opt full_view_name */
-   -1,  /* (362) full_view_name ::= view_name */
-   -3,  /* (363) full_view_name ::= db_name NK_DOT view_name */
-  -12,  /* (364) cmd ::= CREATE STREAM not_exists_opt stream_name stream_options INTO full_table_name col_list_opt tag_def_or_ref_opt subtable_opt AS query_or_subquery */
-   -4,  /* (365) cmd ::= DROP STREAM exists_opt stream_name */
-   -4,  /* (366) cmd ::= PAUSE STREAM exists_opt stream_name */
-   -5,  /* (367) cmd ::= RESUME STREAM exists_opt ignore_opt stream_name */
-    0,  /* (368) col_list_opt ::= */
-   -3,  /* (369) col_list_opt ::= NK_LP col_name_list NK_RP */
-    0,  /* (370) tag_def_or_ref_opt ::= */
-   -1,  /* (371) tag_def_or_ref_opt ::= tags_def */
-   -4,  /* (372) tag_def_or_ref_opt ::= TAGS NK_LP col_name_list NK_RP */
-    0,  /* (373) stream_options ::= */
-   -3,  /* (374) stream_options ::= stream_options TRIGGER AT_ONCE */
-   -3,  /* (375) stream_options ::= stream_options TRIGGER WINDOW_CLOSE */
-   -4,  /* (376) stream_options ::= stream_options TRIGGER MAX_DELAY duration_literal */
-   -3,  /* (377) stream_options ::= stream_options WATERMARK duration_literal */
-   -4,  /* (378) stream_options ::= stream_options IGNORE EXPIRED NK_INTEGER */
-   -3,  /* (379) stream_options ::= stream_options FILL_HISTORY NK_INTEGER */
-   -3,  /* (380) stream_options ::= stream_options DELETE_MARK duration_literal */
-   -4,  /* (381) stream_options ::= stream_options IGNORE UPDATE NK_INTEGER */
-    0,  /* (382) subtable_opt ::= */
-   -4,  /* (383) subtable_opt ::= SUBTABLE NK_LP expression NK_RP */
-    0,  /* (384) ignore_opt ::= */
-   -2,  /* (385) ignore_opt ::= IGNORE UNTREATED */
-   -3,  /* (386) cmd ::= KILL CONNECTION NK_INTEGER */
-   -3,  /* (387) cmd ::= KILL QUERY NK_STRING */
-   -3,  /* (388) cmd ::= KILL TRANSACTION NK_INTEGER */
-   -3,  /* (389) cmd ::= KILL COMPACT NK_INTEGER */
-   -2,  /* (390) cmd ::= BALANCE VGROUP */
-   -4,  /* (391) cmd ::= BALANCE VGROUP LEADER on_vgroup_id */
-   -4,  /* (392) cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER */
-   -4,  /* (393) cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list */
-   -3,  /* (394) cmd ::= SPLIT VGROUP NK_INTEGER */
-    0,  /* (395) on_vgroup_id ::= */
-   -2,  /* (396) on_vgroup_id ::= ON NK_INTEGER */
-   -2,  /* (397) dnode_list ::= DNODE NK_INTEGER */
-   -3,  /* (398) dnode_list ::= dnode_list DNODE NK_INTEGER */
-   -4,  /* (399) cmd ::= DELETE FROM full_table_name where_clause_opt */
-   -1,  /* (400) cmd ::= query_or_subquery */
-   -1,  /* (401) cmd ::= insert_query */
-   -7,  /* (402) insert_query ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery */
-   -4,  /* (403) insert_query ::= INSERT INTO full_table_name query_or_subquery */
-   -1,  /* (404) literal ::= NK_INTEGER */
-   -1,  /* (405) literal ::= NK_FLOAT */
-   -1,  /* (406) literal ::= NK_STRING */
-   -1,  /* (407) literal ::= NK_BOOL */
-   -2,  /* (408) literal ::= TIMESTAMP NK_STRING */
-   -1,  /* (409) literal ::= duration_literal */
-   -1,  /* (410) literal ::= NULL */
-   -1,  /* (411) literal ::= NK_QUESTION */
-   -1,  /* (412) duration_literal ::= NK_VARIABLE */
-   -1,  /* (413) signed ::= NK_INTEGER */
-   -2,  /* (414) signed ::= NK_PLUS NK_INTEGER */
-   -2,  /* (415) signed ::= NK_MINUS NK_INTEGER */
-   -1,  /* (416) signed ::= NK_FLOAT */
-   -2,  /* (417) signed ::= NK_PLUS NK_FLOAT */
-   -2,  /* (418) signed ::= NK_MINUS NK_FLOAT */
-   -1,  /* (419) signed_literal ::= signed */
-   -1,  /* (420) signed_literal ::= NK_STRING */
-   -1,  /* (421) signed_literal ::= NK_BOOL */
-   -2,  /* (422) signed_literal ::= TIMESTAMP NK_STRING */
-   -1,  /* (423) signed_literal ::= duration_literal */
-   -1,  /* (424) signed_literal ::= NULL */
-   -1,  /* (425) signed_literal ::= literal_func */
-   -1,  /* (426) signed_literal ::= NK_QUESTION */
-   -1,  /* (427) literal_list ::= signed_literal */
-   -3,  /* (428) literal_list ::= literal_list NK_COMMA signed_literal */
-   -1,  /* (429) db_name ::= NK_ID */
-   -1,  /* (430) table_name ::= NK_ID */
-   -1,  /* (431) column_name ::= NK_ID */
-   -1,  /* (432) function_name ::= NK_ID */
-   -1,  /* (433) view_name ::= NK_ID */
-   -1,  /* (434) table_alias ::= NK_ID */
-   -1,  /* (435) column_alias ::= NK_ID */
-   -1,  /* (436) column_alias ::= NK_ALIAS */
-   -1,  /* (437) user_name ::= NK_ID */
-   -1,  /* (438) topic_name ::= NK_ID */
-   -1,  /* (439) stream_name ::= NK_ID */
-   -1,  /* (440) cgroup_name ::= NK_ID */
-   -1,  /* (441) index_name ::= NK_ID */
-   -1,  /* (442) expr_or_subquery ::= expression */
-   -1,  /* (443) expression ::= literal */
-   -1,  /* (444) expression ::= pseudo_column */
-   -1,  /* (445) expression ::= column_reference */
-   -1,  /* (446) expression ::= function_expression */
-   -1,  /* (447) expression ::= case_when_expression */
-   -3,  /* (448) expression ::= NK_LP expression NK_RP */
-   -2,  /* (449) expression ::= NK_PLUS expr_or_subquery */
-   -2,  /* (450) expression ::= NK_MINUS expr_or_subquery */
-   -3,  /* (451) expression ::= expr_or_subquery NK_PLUS expr_or_subquery */
-   -3,  /* (452) expression ::= expr_or_subquery NK_MINUS expr_or_subquery */
-   -3,  /* (453) expression ::= expr_or_subquery NK_STAR expr_or_subquery */
-   -3,  /* (454) expression ::= expr_or_subquery NK_SLASH expr_or_subquery */
-   -3,  /* (455) expression ::= expr_or_subquery NK_REM expr_or_subquery */
-   -3,  /* (456) expression ::= column_reference NK_ARROW NK_STRING */
-   -3,  /* (457) expression ::= expr_or_subquery NK_BITAND expr_or_subquery */
-   -3,  /* (458) expression ::= expr_or_subquery NK_BITOR expr_or_subquery */
-   -1,  /* (459) expression_list ::= expr_or_subquery */
-   -3,  /* (460) expression_list ::= expression_list NK_COMMA expr_or_subquery */
-   -1,  /* (461) column_reference ::= column_name */
-   -3,  /* (462) column_reference ::= table_name NK_DOT column_name */
-   -1,  /* (463) column_reference ::= NK_ALIAS */
-   -3,  /* (464) column_reference ::= table_name NK_DOT NK_ALIAS */
-   -1,  /* (465) pseudo_column ::= ROWTS */
-   -1,  /* (466) pseudo_column ::= TBNAME */
-   -3,  /* (467) pseudo_column ::= table_name NK_DOT TBNAME */
-   -1,  /* (468) pseudo_column ::= QSTART */
-   -1,  /* (469) pseudo_column ::= QEND */
-   -1,  /* (470) pseudo_column ::= QDURATION */
-   -1,  /* (471) pseudo_column ::= WSTART */
-   -1,  /* (472) pseudo_column ::= WEND */
-   -1,  /* (473) pseudo_column ::= WDURATION */
-   -1,  /* (474) pseudo_column ::= IROWTS */
-   -1,  /* (475) pseudo_column ::= ISFILLED */
-   -1,  /* (476) pseudo_column ::= QTAGS */
-   -4,  /* (477) function_expression ::= function_name NK_LP expression_list NK_RP */
-   -4,  /* (478) function_expression ::= star_func NK_LP star_func_para_list NK_RP */
-   -6,  /* (479) function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP */
-   -1,  /* (480) function_expression ::= literal_func */
-   -3,  /* (481) literal_func ::= noarg_func NK_LP NK_RP */
-   -1,  /* (482) literal_func ::= NOW */
-   -1,  /* (483) noarg_func ::= NOW */
-   -1,  /* (484) noarg_func ::= TODAY */
-   -1,  /* (485) noarg_func ::= TIMEZONE */
-   -1,  /* (486) noarg_func ::= DATABASE */
-   -1,  /* (487) noarg_func ::= CLIENT_VERSION */
-   -1,  /* (488) noarg_func ::= SERVER_VERSION */
-   -1,  /* (489) noarg_func ::= SERVER_STATUS */
-   -1,  /* (490) noarg_func ::= CURRENT_USER */
-   -1,  /* (491) noarg_func ::= USER */
-   -1,  /* (492) star_func ::= COUNT */
-   -1,  /* (493) star_func ::= FIRST */
-   -1,  /* (494) star_func ::= LAST */
-   -1,  /* (495) star_func ::= LAST_ROW */
-   -1,  /* (496) star_func_para_list ::= NK_STAR */
-   -1,  /* (497) star_func_para_list ::= other_para_list */
-   -1,  /* (498) other_para_list ::= star_func_para */
-   -3,  /* (499) other_para_list ::= other_para_list NK_COMMA star_func_para */
-   -1,  /* (500) star_func_para ::= expr_or_subquery */
-   -3,  /* (501) star_func_para ::= table_name NK_DOT NK_STAR */
-   -4,  /* (502) case_when_expression ::= CASE when_then_list case_when_else_opt END */
-   -5,  /* (503) case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END */
-   -1,  /* (504) when_then_list ::= when_then_expr */
-   -2,  /* (505) when_then_list ::= when_then_list when_then_expr */
-   -4,  /* (506) when_then_expr ::= WHEN common_expression THEN common_expression */
-    0,  /* (507) case_when_else_opt ::= */
-   -2,  /* (508) case_when_else_opt ::= ELSE common_expression */
-   -3,  /* (509) predicate ::= expr_or_subquery compare_op expr_or_subquery */
-   -5,  /* (510) predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery */
-   -6,  /* (511) predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery */
-   -3,  /* (512) predicate ::= expr_or_subquery IS NULL */
-   -4,  /* (513) predicate ::= expr_or_subquery IS NOT NULL */
-   -3,  /* (514) predicate ::= expr_or_subquery in_op in_predicate_value */
-   -1,  /* (515) compare_op ::= NK_LT */
-   -1,  /* (516) compare_op ::= NK_GT */
-   -1,  /* (517) compare_op ::= NK_LE */
-   -1,  /* (518) compare_op ::= NK_GE */
-   -1,  /* (519) compare_op ::= NK_NE */
-   -1,  /* (520) compare_op ::= NK_EQ */
-   -1,  /* (521) compare_op ::= LIKE */
-   -2,  /* (522) compare_op ::= NOT LIKE */
-   -1,  /* (523) compare_op ::= MATCH */
-   -1,  /* (524) compare_op ::= NMATCH */
-   -1,  /* (525) compare_op ::= CONTAINS */
-   -1,  /* (526) in_op ::= IN */
-   -2,  /* (527) in_op ::= NOT IN */
-   -3,  /* (528) in_predicate_value ::= NK_LP literal_list NK_RP */
-   -1,  /* (529) boolean_value_expression ::= boolean_primary */
-   -2,  /* (530) boolean_value_expression ::= NOT boolean_primary */
-   -3,  /* (531) boolean_value_expression ::= boolean_value_expression OR boolean_value_expression */
-   -3,  /* (532) boolean_value_expression ::= boolean_value_expression AND boolean_value_expression */
-   -1,  /* (533) boolean_primary ::= predicate */
-   -3,  /* (534) boolean_primary ::= NK_LP boolean_value_expression NK_RP */
-   -1,  /* (535) common_expression ::= expr_or_subquery */
-   -1,  /* (536) common_expression ::= boolean_value_expression */
-    0,  /* (537) from_clause_opt ::= */
-   -2,  /* (538) from_clause_opt ::= FROM table_reference_list */
-   -1,  /* (539) table_reference_list ::= table_reference */
-   -3,  /* (540) table_reference_list ::= table_reference_list NK_COMMA table_reference */
-   -1,  /* (541) table_reference ::= table_primary */
-   -1,  /* (542) table_reference ::= joined_table */
-   -2,  /* (543) table_primary ::= table_name alias_opt */
-   -4,  /* (544) table_primary ::= db_name NK_DOT table_name alias_opt */
-   -2,  /* (545) table_primary ::= subquery alias_opt */
-   -1,  /* (546) table_primary ::= parenthesized_joined_table */
-    0,  /* (547) alias_opt ::= */
-   -1,  /* (548) alias_opt ::= table_alias */
-   -2,  /* (549) alias_opt ::= AS table_alias */
-   -3,  /* (550) parenthesized_joined_table ::= NK_LP joined_table NK_RP */
-   -3,  /* (551) parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP */
-   -6,  /* (552) joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
-    0,  /* (553) join_type ::= */
-   -1,  /* (554) join_type ::= INNER */
-  -14,  /* (555) query_specification ::= SELECT hint_list set_quantifier_opt tag_mode_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
-    0,  /* (556) hint_list ::= */
-   -1,  /* (557) hint_list ::= NK_HINT */
-    0,  /* (558) tag_mode_opt ::= */
-   -1,  /* (559) tag_mode_opt ::= TAGS */
-    0,  /* (560) set_quantifier_opt ::= */
-   -1,  /* (561) set_quantifier_opt ::= DISTINCT */
-   -1,  /* (562) set_quantifier_opt ::= ALL */
-   -1,  /* (563) select_list ::= select_item */
-   -3,  /* (564) select_list ::= select_list NK_COMMA select_item */
-   -1,  /* (565) select_item ::= NK_STAR */
-   -1,  /* (566) select_item ::= common_expression */
-   -2,  /* (567) select_item ::= common_expression column_alias */
-   -3,  /* (568) select_item ::= common_expression AS column_alias */
-   -3,  /* (569) select_item ::= table_name NK_DOT NK_STAR */
-    0,  /* (570) where_clause_opt ::= */
-   -2,  /* (571) where_clause_opt ::= WHERE search_condition */
-    0,  /* (572) partition_by_clause_opt ::= */
-   -3,  /* (573) partition_by_clause_opt ::= PARTITION BY partition_list */
-   -1,  /* (574) partition_list ::= partition_item */
-   -3,  /* (575) partition_list ::= partition_list NK_COMMA partition_item */
-   -1,  /* (576) partition_item ::= expr_or_subquery */
-   -2,  /* (577) partition_item ::= expr_or_subquery column_alias */
-   -3,  /* (578) partition_item ::= expr_or_subquery AS column_alias */
-    0,  /* (579) twindow_clause_opt ::= */
-   -6,  /* (580) twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA interval_sliding_duration_literal NK_RP */
-   -4,  /* (581) twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
-   -6,  /* (582) twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_RP sliding_opt fill_opt */
-   -8,  /* (583) twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_COMMA interval_sliding_duration_literal NK_RP sliding_opt fill_opt */
-   -7,  /* (584) twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition */
-    0,  /* (585) sliding_opt ::= */
-   -4,  /* (586) sliding_opt ::= SLIDING NK_LP interval_sliding_duration_literal NK_RP */
-   -1,  /* (587) interval_sliding_duration_literal ::= NK_VARIABLE */
-   -1,  /* (588) interval_sliding_duration_literal ::= NK_STRING */
-   -1,  /* (589) interval_sliding_duration_literal ::= NK_INTEGER */
-    0,  /* (590) fill_opt ::= */
-   -4,  /* (591) fill_opt ::= FILL NK_LP fill_mode NK_RP */
-   -6,  /* (592) fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP */
-   -6,  /* (593) fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP */
-   -1,  /* (594) fill_mode ::= NONE */
-   -1,  /* (595) fill_mode ::= PREV */
-   -1,  /* (596) fill_mode ::= NULL */
-   -1,  /* (597) fill_mode ::= NULL_F */
-   -1,  /* (598) fill_mode ::= LINEAR */
-   -1,  /* (599) fill_mode ::= NEXT */
-    0,  /* (600) group_by_clause_opt ::= */
-   -3,  /* (601) group_by_clause_opt ::= GROUP BY group_by_list */
-   -1,  /* (602) group_by_list ::= expr_or_subquery */
-   -3,  /* (603) group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
-    0,  /* (604) having_clause_opt ::= */
-   -2,  /* (605) having_clause_opt ::= HAVING search_condition */
-    0,  /* (606) range_opt ::= */
-   -6,  /* (607) range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
-   -4,  /* (608) range_opt ::= RANGE NK_LP expr_or_subquery NK_RP */
-    0,  /* (609) every_opt ::= */
-   -4,  /* (610) every_opt ::= EVERY NK_LP duration_literal NK_RP */
-   -4,  /* (611) query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
-   -1,  /* (612) query_simple ::= query_specification */
-   -1,  /* (613) query_simple ::= union_query_expression */
-   -4,  /* (614) union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
-   -3,  /* (615) union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
-   -1,  /* (616) query_simple_or_subquery ::= query_simple */
-   -1,  /* (617) query_simple_or_subquery ::= subquery */
-   -1,  /* (618) query_or_subquery ::= query_expression */
-   -1,  /* (619) query_or_subquery ::= subquery */
-    0,  /* (620) order_by_clause_opt ::= */
-   -3,  /* (621) order_by_clause_opt ::= ORDER BY sort_specification_list */
-    0,  /* (622) slimit_clause_opt ::= */
-   -2,  /* (623) slimit_clause_opt ::= SLIMIT NK_INTEGER */
-   -4,  /* (624) slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
-   -4,  /* (625) slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
-    0,  /* (626) limit_clause_opt ::= */
-   -2,  /* (627) limit_clause_opt ::= LIMIT NK_INTEGER */
-   -4,  /* (628) limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */
-   -4,  /* (629) limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */
-   -3,  /* (630) subquery ::= NK_LP query_expression NK_RP */
-   -3,  /* (631) subquery ::= NK_LP subquery NK_RP */
-   -1,  /* (632) search_condition ::= common_expression */
-   -1,  /* (633) sort_specification_list ::= sort_specification */
-   -3,  /* (634) sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */
-   -3,  /* (635) sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
-    0,  /* (636) ordering_specification_opt ::= */
-   -1,  /* (637) ordering_specification_opt ::= ASC */
-   -1,  /* (638) ordering_specification_opt ::= DESC */
-    0,  /* (639) null_ordering_opt ::= */
-   -2,  /* (640) null_ordering_opt ::= NULLS FIRST */
-   -2,  /* (641) null_ordering_opt ::= NULLS LAST */
+   -3,  /* (124) db_options ::= db_options STT_MERGE_POLICY NK_STRING */
+   -3,  /* (125) db_options ::= db_options TABLE_PREFIX signed */
+   -3,  /* (126) db_options ::= db_options TABLE_SUFFIX signed */
+   -3,  /* (127) db_options ::= db_options KEEP_TIME_OFFSET NK_INTEGER */
+   -1,  /* (128) alter_db_options ::= alter_db_option */
+   -2,  /* (129) alter_db_options ::= alter_db_options alter_db_option */
+   -2,  /* (130) alter_db_option ::= BUFFER NK_INTEGER */
+   -2,  /* (131) alter_db_option ::= CACHEMODEL NK_STRING */
+   -2,  /* (132) alter_db_option ::= CACHESIZE NK_INTEGER */
+   -2,  /* (133) alter_db_option ::= WAL_FSYNC_PERIOD NK_INTEGER */
+   -2,  /* (134) alter_db_option ::= KEEP integer_list */
+   -2,  /* (135) alter_db_option ::= KEEP variable_list */
+   -2,  /* (136) alter_db_option ::= PAGES NK_INTEGER */
+   -2,  /* (137) alter_db_option ::= REPLICA NK_INTEGER */
+   -2,  /* (138) alter_db_option ::= WAL_LEVEL NK_INTEGER */
+   -2,  /* (139) alter_db_option ::= STT_TRIGGER NK_INTEGER */
+   -2,  /* (140) alter_db_option ::= STT_MERGE_POLICY NK_STRING */
+   -2,  /* (141) alter_db_option ::= MINROWS NK_INTEGER */
+   -2,  /* (142) alter_db_option ::= WAL_RETENTION_PERIOD NK_INTEGER */
+   -3,  /* (143) alter_db_option ::= WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
+   -2,  /* (144) alter_db_option ::= WAL_RETENTION_SIZE NK_INTEGER */
+   -3,  /* (145) alter_db_option ::= WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
+   -2,  /* (146) alter_db_option ::= KEEP_TIME_OFFSET NK_INTEGER */
+   -1,  /* (147) integer_list ::= NK_INTEGER */
+   -3,  /* (148) integer_list ::= integer_list NK_COMMA NK_INTEGER */
+   -1,  /* (149) variable_list ::= NK_VARIABLE */
+   -3,  /* (150) variable_list ::= variable_list NK_COMMA NK_VARIABLE */
+   -1,  /* (151) retention_list ::= retention */
+   -3,  /* (152) retention_list ::= retention_list NK_COMMA retention */
+   -3,  /* (153) retention ::= NK_VARIABLE NK_COLON NK_VARIABLE */
+   -3,  /* (154) retention ::= NK_MINUS NK_COLON NK_VARIABLE */
+    0,  /* (155) speed_opt ::= */
+   -2,  /* (156) speed_opt ::= BWLIMIT NK_INTEGER */
+    0,  /* (157) start_opt ::= */
+   -3,  /* (158) start_opt ::= START WITH NK_INTEGER */
+   -3,  /* (159) start_opt ::= START WITH NK_STRING */
+   -4,  /* (160) start_opt ::= START WITH TIMESTAMP NK_STRING */
+    0,  /* (161) end_opt ::= */
+   -3,  /* (162) end_opt ::= END WITH NK_INTEGER */
+   -3,  /* (163) end_opt ::= END WITH NK_STRING */
+   -4,  /* (164) end_opt ::= END WITH TIMESTAMP NK_STRING */
+   -9,  /* (165) cmd ::= CREATE TABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def_opt table_options */
+   -3,  /* (166) cmd ::= CREATE TABLE multi_create_clause */
+   -9,  /* (167) cmd ::= CREATE STABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def table_options */
+   -3,  /* (168) cmd ::= DROP TABLE multi_drop_clause */
+   -4,  /* (169) cmd ::= DROP STABLE exists_opt full_table_name */
+   -3,  /* (170) cmd ::= ALTER TABLE alter_table_clause */
+   -3,  /* (171) cmd ::= ALTER STABLE alter_table_clause */
+   -2,  /* (172) alter_table_clause ::= full_table_name alter_table_options */
+   -5,  /* (173) alter_table_clause ::= full_table_name ADD COLUMN column_name type_name */
+   -4,  /* (174) alter_table_clause ::= full_table_name DROP COLUMN column_name */
+   -5,  /* (175) alter_table_clause ::= full_table_name MODIFY COLUMN column_name type_name */
+   -5,  /* (176) alter_table_clause ::= full_table_name RENAME COLUMN column_name column_name */
+   -5,  /* (177) alter_table_clause ::= full_table_name ADD TAG column_name type_name */
+   -4,  /* (178) alter_table_clause ::= full_table_name DROP TAG column_name */
+   -5,  /* (179) alter_table_clause ::= full_table_name MODIFY TAG column_name type_name */
+   -5,  /* (180) alter_table_clause ::= full_table_name RENAME TAG column_name column_name */
+   -6,  /* (181) alter_table_clause ::= full_table_name SET TAG column_name NK_EQ signed_literal */
+   -1,  /* (182) multi_create_clause ::= create_subtable_clause */
+   -2,  /* (183) multi_create_clause ::= multi_create_clause create_subtable_clause */
+  -10,  /* (184) create_subtable_clause ::= not_exists_opt full_table_name USING full_table_name specific_cols_opt TAGS NK_LP expression_list NK_RP table_options */
+   -1,  /* (185) multi_drop_clause ::= drop_table_clause */
+   -3,  /* (186) multi_drop_clause ::= multi_drop_clause NK_COMMA drop_table_clause */
+   -2,  /* (187) drop_table_clause ::= exists_opt full_table_name */
+    0,  /* (188) specific_cols_opt ::= */
+   -3,  /* (189) specific_cols_opt ::= NK_LP col_name_list NK_RP */
+   -1,  /* (190) full_table_name ::= table_name */
+   -3,  /* (191) full_table_name ::= db_name NK_DOT table_name */
+   -1,  /* (192) column_def_list ::= column_def */
+   -3,  /* (193) column_def_list ::= column_def_list NK_COMMA column_def */
+   -2,  /* (194) column_def ::= column_name type_name */
+   -1,  /* (195) type_name ::= BOOL */
+   -1,  /* (196) type_name ::= TINYINT */
+   -1,  /* (197) type_name ::= SMALLINT */
+   -1,  /* (198) type_name ::= INT */
+   -1,  /* (199) type_name ::= INTEGER */
+   -1,  /* (200) type_name ::= BIGINT */
+   -1,  /* (201) type_name ::= FLOAT */
+   -1,  /* (202) type_name ::= DOUBLE */
+   -4,  /* (203) type_name ::= BINARY NK_LP NK_INTEGER NK_RP */
+   -1,  /* (204) type_name ::= TIMESTAMP */
+   -4,  /* (205) type_name ::= NCHAR NK_LP NK_INTEGER NK_RP */
+   -2,  /* (206) type_name ::= TINYINT UNSIGNED */
+   -2,  /* (207) type_name ::= SMALLINT UNSIGNED */
+   -2,  /* (208) type_name ::= INT UNSIGNED */
+   -2,  /* (209) type_name ::= BIGINT UNSIGNED */
+   -1,  /* (210) type_name ::= JSON */
+   -4,  /* (211) type_name ::= VARCHAR NK_LP NK_INTEGER NK_RP */
+   -1,  /* (212) type_name ::= MEDIUMBLOB */
+   -1,  /* (213) type_name ::= BLOB */
+   -4,  /* (214) type_name ::= VARBINARY NK_LP NK_INTEGER NK_RP */
+   -4,  /* (215) type_name ::= GEOMETRY NK_LP NK_INTEGER NK_RP */
+   -1,  /* (216) type_name ::= DECIMAL */
+   -4,  /* (217) type_name ::= DECIMAL NK_LP NK_INTEGER NK_RP */
+   -6,  /* (218) type_name ::= DECIMAL NK_LP NK_INTEGER NK_COMMA NK_INTEGER NK_RP */
+    0,  /* (219) tags_def_opt ::= */
+   -1,  /* (220) tags_def_opt ::= tags_def */
+   -4,  /* (221) tags_def ::= TAGS NK_LP column_def_list NK_RP */
+    0,  /* (222) table_options ::= */
+   -3,  /* (223) table_options ::= table_options COMMENT NK_STRING */
+   -3,  /* (224) table_options ::= table_options MAX_DELAY duration_list */
+   -3,  /* (225) table_options ::= table_options WATERMARK duration_list */
+   -5,  /* (226) table_options ::= table_options ROLLUP NK_LP rollup_func_list NK_RP */
+   -3,  /* (227) table_options ::= table_options TTL NK_INTEGER */
+   -5,  /* (228) table_options ::= table_options SMA NK_LP col_name_list NK_RP */
+   -5,  /* (229) table_options ::= table_options BLOOM_FILTER NK_LP col_name_list NK_RP */
+   -3,  /* (230) table_options ::= table_options DELETE_MARK duration_list */
+   -1,  /* (231) alter_table_options ::= alter_table_option */
+   -2,  /* (232) alter_table_options ::= alter_table_options alter_table_option */
+   -2,  /* (233) alter_table_option ::= COMMENT NK_STRING */
+   -2,  /* (234) alter_table_option ::= TTL NK_INTEGER */
+   -1,  /* (235) duration_list ::= duration_literal */
+   -3,  /* (236) duration_list ::= duration_list NK_COMMA duration_literal */
+   -1,  /* (237) rollup_func_list ::= rollup_func_name */
+   -3,  /* (238) rollup_func_list ::= rollup_func_list NK_COMMA rollup_func_name */
+   -1,  /* (239) rollup_func_name ::= function_name */
+   -1,  /* (240) rollup_func_name ::= FIRST */
+   -1,  /* (241) rollup_func_name ::= LAST */
+   -1,  /* (242) col_name_list ::= col_name */
+   -3,  /* (243) col_name_list ::= col_name_list NK_COMMA col_name */
+   -1,  /* (244) col_name ::= column_name */
+   -2,  /* (245) cmd ::= SHOW DNODES */
+   -2,  /* (246) cmd ::= SHOW USERS */
+   -3,  /* (247) cmd ::= SHOW USER PRIVILEGES */
+   -3,  /* (248) cmd ::= SHOW db_kind_opt DATABASES */
+   -4,  /* (249) cmd ::= SHOW table_kind_db_name_cond_opt TABLES like_pattern_opt */
+   -4,  /* (250) cmd ::= SHOW db_name_cond_opt STABLES like_pattern_opt */
+   -3,  /* (251) cmd ::= SHOW db_name_cond_opt VGROUPS */
+   -2,  /* (252) cmd ::= SHOW MNODES */
+   -2,  /* (253) cmd ::= SHOW QNODES */
+   -2,  /* (254) cmd ::= SHOW FUNCTIONS */
+   -5,  /* (255) cmd ::= SHOW INDEXES FROM table_name_cond from_db_opt */
+   -6,  /* (256) cmd ::= SHOW INDEXES FROM db_name NK_DOT table_name */
+   -2,  /* (257) cmd ::= SHOW STREAMS */
+   -2,  /* (258) cmd ::= SHOW ACCOUNTS */
+   -2,  /* (259) cmd ::= SHOW APPS */
+   -2,  /* (260) cmd ::= SHOW CONNECTIONS */
+   -2,  /* (261) cmd ::= SHOW LICENCES */
+   -2,  /* (262) cmd ::= SHOW GRANTS */
+   -4,  /* (263) cmd ::= SHOW CREATE DATABASE db_name */
+   -4,  /* (264) cmd ::= SHOW CREATE TABLE full_table_name */
+   -4,  /* (265) cmd ::= SHOW CREATE STABLE full_table_name */
+   -2,  /* (266) cmd ::= SHOW QUERIES */
+   -2,  /* (267) cmd ::= SHOW SCORES */
+   -2,  /* (268) cmd ::= SHOW TOPICS */
+   -2,  /* (269) cmd ::= SHOW VARIABLES */
+   -3,  /* (270) cmd ::= SHOW CLUSTER VARIABLES */
+   -3,  /* (271) cmd ::= SHOW LOCAL VARIABLES */
+   -5,  /* (272) cmd ::= SHOW DNODE NK_INTEGER VARIABLES like_pattern_opt */
+   -2,  /* (273) cmd ::= SHOW BNODES */
+   -2,  /* (274) cmd ::= SHOW SNODES */
+   -2,  /* (275) cmd ::= SHOW CLUSTER */
+   -2,  /* (276) cmd ::= SHOW TRANSACTIONS */
+   -4,  /* (277) cmd ::= SHOW TABLE DISTRIBUTED full_table_name */
+   -2,  /* (278) cmd ::= SHOW CONSUMERS */
+   -2,  /* (279) cmd ::= SHOW SUBSCRIPTIONS */
+   -5,  /* (280) cmd ::= SHOW TAGS FROM table_name_cond from_db_opt */
+   -6,  /* (281) cmd ::= SHOW TAGS FROM db_name NK_DOT table_name */
+   -7,  /* (282) cmd ::= SHOW TABLE TAGS tag_list_opt FROM table_name_cond from_db_opt */
+   -8,  /* (283) cmd ::= SHOW TABLE TAGS tag_list_opt FROM db_name NK_DOT table_name */
+   -5,  /* (284) cmd ::= SHOW VNODES ON DNODE NK_INTEGER */
+   -2,  /* (285) cmd ::= SHOW VNODES */
+   -3,  /* (286) cmd ::= SHOW db_name_cond_opt ALIVE */
+   -3,  /* (287) cmd ::= SHOW CLUSTER ALIVE */
+   -3,  /* (288) cmd ::= SHOW db_name_cond_opt VIEWS */
+   -4,  /* (289) cmd ::= SHOW CREATE VIEW full_table_name */
+   -2,  /* (290) cmd ::= SHOW COMPACTS */
+   -3,  /* (291) cmd ::= SHOW COMPACT NK_INTEGER */
+    0,  /* (292) table_kind_db_name_cond_opt ::= */
+   -1,  /* (293) table_kind_db_name_cond_opt ::= table_kind */
+   -2,  /* (294) table_kind_db_name_cond_opt ::= db_name NK_DOT */
+   -3,  /* (295) table_kind_db_name_cond_opt ::= table_kind db_name NK_DOT */
+   -1,  /* (296) table_kind ::= NORMAL */
+   -1,  /* (297) table_kind ::= CHILD */
+    0,  /* (298) db_name_cond_opt ::= */
+   -2,  /* (299) db_name_cond_opt ::= db_name NK_DOT */
+    0,  /* (300) like_pattern_opt ::= */
+   -2,  /* (301) like_pattern_opt ::= LIKE NK_STRING */
+   -1,  /* (302) table_name_cond ::= table_name */
+    0,  /* (303) from_db_opt ::= */
+   -2,  /* (304) from_db_opt ::= FROM db_name */
+    0,  /* (305) tag_list_opt ::= */
+   -1,  /* (306) tag_list_opt ::= tag_item */
+   -3,  /* (307) tag_list_opt ::= tag_list_opt NK_COMMA tag_item */
+   -1,  /* (308) tag_item ::= TBNAME */
+   -1,  /* (309) tag_item ::= QTAGS */
+   -1,  /* (310) tag_item ::= column_name */
+   -2,  /* (311) tag_item ::= column_name column_alias */
+   -3,  /* (312) tag_item ::= column_name AS column_alias */
+    0,  /* (313) db_kind_opt ::= */
+   -1,  /* (314) db_kind_opt ::= USER */
+   -1,  /* (315) db_kind_opt ::= SYSTEM */
+   -8,  /* (316) cmd ::= CREATE SMA INDEX not_exists_opt col_name ON full_table_name index_options */
+   -9,  /* (317) cmd ::= CREATE INDEX not_exists_opt col_name ON full_table_name NK_LP col_name_list NK_RP */
+   -4,  /* (318) cmd ::= DROP INDEX exists_opt full_index_name */
+   -1,  /* (319) full_index_name ::= index_name */
+   -3,  /* (320) full_index_name ::= db_name NK_DOT index_name */
+  -10,  /* (321) index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_RP sliding_opt sma_stream_opt */
+  -12,  /* (322) index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt sma_stream_opt */
+   -1,  /* (323) func_list ::= func */
+   -3,  /* (324) func_list ::= func_list NK_COMMA func */
+   -4,  /* (325) func ::= sma_func_name NK_LP expression_list NK_RP */
+   -1,  /* (326) sma_func_name ::= function_name */
+   -1,  /* (327) sma_func_name ::= COUNT */
+   -1,  /* (328) sma_func_name ::= FIRST */
+   -1,  /* (329) sma_func_name ::= LAST */
+   -1,  /* (330) sma_func_name ::= LAST_ROW */
+    0,  /* (331) sma_stream_opt ::= */
+   -3,  /* (332) sma_stream_opt ::= sma_stream_opt WATERMARK duration_literal */
+   -3,  /* (333) sma_stream_opt ::= sma_stream_opt MAX_DELAY duration_literal */
+   -3,  /* (334) sma_stream_opt ::= sma_stream_opt DELETE_MARK duration_literal */
+   -1,  /* (335) with_meta ::= AS */
+   -3,  /* (336) with_meta ::= WITH META AS */
+   -3,  /* (337) with_meta ::= ONLY META AS */
+   -6,  /* (338) cmd ::= CREATE TOPIC not_exists_opt topic_name AS query_or_subquery */
+   -7,  /* (339) cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta DATABASE db_name */
+   -8,  /* (340) cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta STABLE full_table_name where_clause_opt */
+   -4,  /* (341) cmd ::= DROP TOPIC exists_opt topic_name */
+   -7,  /* (342) cmd ::= DROP CONSUMER GROUP exists_opt cgroup_name ON topic_name */
+   -2,  /* (343) cmd ::= DESC full_table_name */
+   -2,  /* (344) cmd ::= DESCRIBE full_table_name */
+   -3,  /* (345) cmd ::= RESET QUERY CACHE */
+   -4,  /* (346) cmd ::= EXPLAIN analyze_opt explain_options query_or_subquery */
+   -4,  /* (347) cmd ::= EXPLAIN analyze_opt explain_options insert_query */
+    0,  /* (348) analyze_opt ::= */
+   -1,  /* (349) analyze_opt ::= ANALYZE */
+    0,  /* (350) explain_options ::= */
+   -3,  /* (351) explain_options ::= explain_options VERBOSE NK_BOOL */
+   -3,  /* (352) explain_options ::= explain_options RATIO NK_FLOAT */
+  -12,  /* (353) cmd ::= CREATE or_replace_opt agg_func_opt FUNCTION not_exists_opt function_name AS NK_STRING OUTPUTTYPE type_name bufsize_opt language_opt */
+   -4,  /* (354) cmd ::= DROP FUNCTION exists_opt function_name */
+    0,  /* (355) agg_func_opt ::= */
+   -1,  /* (356) agg_func_opt ::= AGGREGATE */
+    0,  /* (357) bufsize_opt ::= */
+   -2,  /* (358) bufsize_opt ::= BUFSIZE NK_INTEGER */
+    0,  /* (359) language_opt ::= */
+   -2,  /* (360) language_opt ::= LANGUAGE NK_STRING */
+    0,  /* (361) or_replace_opt ::= */
+   -2,  /* (362) or_replace_opt ::= OR REPLACE */
+   -6,  /* (363) cmd ::= CREATE or_replace_opt VIEW full_view_name AS query_or_subquery */
+   -4,  /* (364) cmd ::= DROP VIEW exists_opt full_view_name */
+   -1,  /* (365) full_view_name ::= view_name */
+   -3,  /* (366) full_view_name ::= db_name NK_DOT view_name */
+  -12,  /* (367) cmd ::= CREATE STREAM not_exists_opt stream_name stream_options INTO full_table_name col_list_opt tag_def_or_ref_opt subtable_opt AS query_or_subquery */
+   -4,  /* (368) cmd ::= DROP STREAM exists_opt stream_name */
+   -4,  /* (369) cmd ::= PAUSE STREAM exists_opt stream_name */
+   -5,  /* (370) cmd ::= RESUME STREAM exists_opt ignore_opt stream_name */
+    0,  /* (371) col_list_opt ::= */
+   -3,  /* (372) col_list_opt ::= NK_LP col_name_list NK_RP */
+    0,  /* (373) tag_def_or_ref_opt ::= */
+   -1,  /* (374) tag_def_or_ref_opt ::= tags_def */
+   -4,  /* (375) tag_def_or_ref_opt ::= TAGS NK_LP col_name_list NK_RP */
+    0,  /* (376) stream_options ::= */
+   -3,  /* (377) stream_options ::= stream_options TRIGGER AT_ONCE */
+   -3,  /* (378) stream_options ::= stream_options TRIGGER WINDOW_CLOSE */
+   -4,  /* (379) stream_options ::= stream_options TRIGGER MAX_DELAY duration_literal */
+   -3,  /* (380) stream_options ::= stream_options WATERMARK duration_literal */
+   -4,  /* (381) stream_options ::= stream_options IGNORE EXPIRED NK_INTEGER */
+   -3,  /* (382) stream_options ::= stream_options FILL_HISTORY NK_INTEGER */
+   -3,  /* (383) stream_options ::= stream_options DELETE_MARK duration_literal */
+   -4,  /* (384) stream_options ::= stream_options IGNORE UPDATE NK_INTEGER */
+    0,  /* (385) subtable_opt ::= */
+   -4,  /* (386) subtable_opt ::= SUBTABLE NK_LP expression NK_RP */
+    0,  /* (387) ignore_opt ::= */
+   -2,  /* (388) ignore_opt ::= IGNORE UNTREATED */
+   -3,  /* (389) cmd ::= KILL CONNECTION NK_INTEGER */
+   -3,  /* (390) cmd ::= KILL QUERY NK_STRING */
+   -3,  /* (391) cmd ::= KILL TRANSACTION NK_INTEGER */
+   -3,  /* (392) cmd ::= KILL COMPACT NK_INTEGER */
+   -2,  /* (393) cmd ::= BALANCE VGROUP */
+   -4,  /* (394) cmd ::= BALANCE VGROUP LEADER on_vgroup_id */
+   -4,  /* (395) cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER */
+   -4,  /* (396) cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list */
+   -3,  /* (397) cmd ::= SPLIT VGROUP NK_INTEGER */
+    0,  /* (398) on_vgroup_id ::= */
+   -2,  /* (399) on_vgroup_id ::= ON NK_INTEGER */
+   -2,  /* (400) dnode_list ::= DNODE NK_INTEGER */
+   -3,  /* (401) dnode_list ::= dnode_list DNODE NK_INTEGER */
+   -4,  /* (402) cmd ::= DELETE FROM full_table_name where_clause_opt */
+   -1,  /* (403) cmd ::= query_or_subquery */
+   -1,  /* (404) cmd ::= insert_query */
+   -7,  /* (405) insert_query ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery */
+   -4,  /* (406) insert_query ::= INSERT INTO full_table_name query_or_subquery */
+   -1,  /* (407) literal ::= NK_INTEGER */
+   -1,  /* (408) literal ::= NK_FLOAT */
+   -1,  /* (409) literal ::= NK_STRING */
+   -1,  /* (410) literal ::= NK_BOOL */
+   -2,  /* (411) literal ::= TIMESTAMP NK_STRING */
+   -1,  /* (412) literal ::= duration_literal */
+   -1,  /* (413) literal ::= NULL */
+   -1,  /* (414) literal ::= NK_QUESTION */
+   -1,  /* (415) duration_literal ::= NK_VARIABLE */
+   -1,  /* (416) signed ::= NK_INTEGER */
+   -2,  /* (417) signed ::= NK_PLUS NK_INTEGER */
+   -2,  /* (418) signed ::= NK_MINUS NK_INTEGER */
+   -1,  /* (419) signed ::= NK_FLOAT */
+   -2,  /* (420) signed ::= NK_PLUS NK_FLOAT */
+   -2,  /* (421) signed ::= NK_MINUS NK_FLOAT */
+   -1,  /* (422) signed_literal ::= signed */
+   -1,  /* (423) signed_literal ::= NK_STRING */
+   -1,  /* (424) signed_literal ::= NK_BOOL */
+   -2,  /* (425) signed_literal ::= TIMESTAMP NK_STRING */
+   -1,  /* (426) signed_literal ::= duration_literal */
+   -1,  /* (427) signed_literal ::= NULL */
+   -1,  /* (428) signed_literal ::= literal_func */
+   -1,  /* (429) signed_literal ::= NK_QUESTION */
+   -1,  /* (430) literal_list ::= signed_literal */
+   -3,  /* (431) literal_list ::= literal_list NK_COMMA signed_literal */
+   -1,  /* (432) db_name ::= NK_ID */
+   -1,  /* (433) table_name ::= NK_ID */
+   -1,  /* (434) column_name ::= NK_ID */
+   -1,  /* (435) function_name ::= NK_ID */
+   -1,  /* (436) view_name ::= NK_ID */
+   -1,  /* (437) table_alias ::= NK_ID */
+   -1,  /* (438) column_alias ::= NK_ID */
+   -1,  /* (439) column_alias ::= NK_ALIAS */
+   -1,  /* (440) user_name ::= NK_ID */
+   -1,  /* (441) topic_name ::= NK_ID */
+   -1,  /* (442) stream_name ::= NK_ID */
+   -1,  /* (443) cgroup_name ::= NK_ID */
+   -1,  /* (444) index_name ::= NK_ID */
+   -1,  /* (445) expr_or_subquery ::= expression */
+   -1,  /* (446) expression ::= literal */
+   -1,  /* (447) expression ::= pseudo_column */
+   -1,  /* (448) expression ::= column_reference */
+   -1,  /* (449) expression ::= function_expression */
+   -1,  /* (450) expression ::= case_when_expression */
+   -3,  /* (451) expression ::= NK_LP expression NK_RP */
+   -2,  /* (452) expression ::= NK_PLUS expr_or_subquery */
+   -2,  /* (453) expression ::= NK_MINUS expr_or_subquery */
+   -3,  /* (454) expression ::= expr_or_subquery NK_PLUS expr_or_subquery */
+   -3,  /* (455) expression ::= expr_or_subquery NK_MINUS expr_or_subquery */
+   -3,  /* (456) expression ::= expr_or_subquery NK_STAR expr_or_subquery */
+   -3,  /* (457) expression ::= expr_or_subquery NK_SLASH expr_or_subquery */
+   -3,  /* (458) expression ::= expr_or_subquery NK_REM expr_or_subquery */
+   -3,  /* (459) expression ::= column_reference NK_ARROW NK_STRING */
+   -3,  /* (460) expression ::= expr_or_subquery NK_BITAND expr_or_subquery */
+   -3,  /* (461) expression ::= expr_or_subquery NK_BITOR expr_or_subquery */
+   -1,  /* (462) expression_list ::= expr_or_subquery */
+   -3,  /* (463) expression_list ::= expression_list NK_COMMA expr_or_subquery */
+   -1,  /* (464) column_reference ::= column_name */
+   -3,  /* (465) column_reference ::= table_name NK_DOT column_name */
+   -1,  /* (466) column_reference ::= NK_ALIAS */
+   -3,  /* (467) column_reference ::= table_name NK_DOT NK_ALIAS */
+   -1,  /* (468) pseudo_column ::= ROWTS */
+   -1,  /* (469) pseudo_column ::= TBNAME */
+   -3,  /* (470) pseudo_column ::= table_name NK_DOT TBNAME */
+   -1,  /* (471) pseudo_column ::= QSTART */
+   -1,  /* (472) pseudo_column ::= QEND */
+   -1,  /* (473) pseudo_column ::= QDURATION */
+   -1,  /* (474) pseudo_column ::= WSTART */
+   -1,  /* (475) pseudo_column ::= WEND */
+   -1,  /* (476) pseudo_column ::= WDURATION */
+   -1,  /* (477) pseudo_column ::= IROWTS */
+   -1,  /* (478) pseudo_column ::= ISFILLED */
+   -1,  /* (479) pseudo_column ::= QTAGS */
+   -4,  /* (480) function_expression ::= function_name NK_LP expression_list NK_RP */
+   -4,  /* (481) function_expression ::= star_func NK_LP star_func_para_list NK_RP */
+   -6,  /* (482) function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP */
+   -1,  /* (483) function_expression ::= literal_func */
+   -3,  /* (484) literal_func ::= noarg_func NK_LP NK_RP */
+   -1,  /* (485) literal_func ::= NOW */
+   -1,  /* (486) noarg_func ::= NOW */
+   -1,  /* (487) noarg_func ::= TODAY */
+   -1,  /* (488) noarg_func ::= TIMEZONE */
+   -1,  /* (489) noarg_func ::= DATABASE */
+   -1,  /* (490) noarg_func ::= CLIENT_VERSION */
+   -1,  /* (491) noarg_func ::= SERVER_VERSION */
+   -1,  /* (492) noarg_func ::= SERVER_STATUS */
+   -1,  /* (493) noarg_func ::= CURRENT_USER */
+   -1,  /* (494) noarg_func ::= USER */
+   -1,  /* (495) star_func ::= COUNT */
+   -1,  /* (496) star_func ::= FIRST */
+   -1,  /* (497) star_func ::= LAST */
+   -1,  /* (498) star_func ::= LAST_ROW */
+   -1,  /* (499) star_func_para_list ::= NK_STAR */
+   -1,  /* (500) star_func_para_list ::= other_para_list */
+   -1,  /* (501) other_para_list ::= star_func_para */
+   -3,  /* (502) other_para_list ::= other_para_list NK_COMMA star_func_para */
+   -1,  /* (503) star_func_para ::= expr_or_subquery */
+   -3,  /* (504) star_func_para ::= table_name NK_DOT NK_STAR */
+   -4,  /* (505) case_when_expression ::= CASE when_then_list case_when_else_opt END */
+   -5,  /* (506) case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END */
+   -1,  /* (507) when_then_list ::= when_then_expr */
+   -2,  /* (508) when_then_list ::= when_then_list when_then_expr */
+   -4,  /* (509) when_then_expr ::= WHEN common_expression THEN common_expression */
+    0,  /* (510) case_when_else_opt ::= */
+   -2,  /* (511) case_when_else_opt ::= ELSE common_expression */
+   -3,  /* (512) predicate ::= expr_or_subquery compare_op expr_or_subquery */
+   -5,  /* (513) predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery */
+   -6,  /* (514) predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery */
+   -3,  /* (515) predicate ::= expr_or_subquery IS NULL */
+   -4,  /* (516) predicate ::= expr_or_subquery IS NOT NULL */
+   -3,  /* (517) predicate ::= expr_or_subquery in_op in_predicate_value */
+   -1,  /* (518) compare_op ::= NK_LT */
+   -1,  /* (519) compare_op ::= NK_GT */
+   -1,  /* (520) compare_op ::= NK_LE */
+   -1,  /* (521) compare_op ::= NK_GE */
+   -1,  /* (522) compare_op ::= NK_NE */
+   -1,  /* (523) compare_op ::= NK_EQ */
+   -1,  /* (524) compare_op ::= LIKE */
+   -2,  /* (525) compare_op ::= NOT LIKE */
+   -1,  /* (526) compare_op ::= MATCH */
+   -1,  /* (527) compare_op ::= NMATCH */
+   -1,  /* (528) compare_op ::= CONTAINS */
+   -1,  /* (529) in_op ::= IN */
+   -2,  /* (530) in_op ::= NOT IN */
+   -3,  /* (531) in_predicate_value ::= NK_LP literal_list NK_RP */
+   -1,  /* (532) boolean_value_expression ::= boolean_primary */
+   -2,  /* (533) boolean_value_expression ::= NOT boolean_primary */
+   -3,  /* (534) boolean_value_expression ::= boolean_value_expression OR boolean_value_expression */
+   -3,  /* (535) boolean_value_expression ::= boolean_value_expression AND boolean_value_expression */
+   -1,  /* (536) boolean_primary ::= predicate */
+   -3,  /* (537) boolean_primary ::= NK_LP boolean_value_expression NK_RP */
+   -1,  /* (538) common_expression ::= expr_or_subquery */
+   -1,  /* (539) common_expression ::= boolean_value_expression */
+    0,  /* (540) from_clause_opt ::= */
+   -2,  /* (541) from_clause_opt ::= FROM table_reference_list */
+   -1,  /* (542) table_reference_list ::= table_reference */
+   -3,  /* (543) table_reference_list ::= table_reference_list NK_COMMA table_reference */
+   -1,  /* (544) table_reference ::= table_primary */
+   -1,  /* (545) table_reference ::= joined_table */
+   -2,  /* (546) table_primary ::= table_name alias_opt */
+   -4,  /* (547) table_primary ::= db_name NK_DOT table_name alias_opt */
+   -2,  /* (548) table_primary ::= subquery alias_opt */
+   -1,  /* (549) table_primary ::= parenthesized_joined_table */
+    0,  /* (550) alias_opt ::= */
+   -1,  /* (551) alias_opt ::= table_alias */
+   -2,  /* (552) alias_opt ::= AS table_alias */
+   -3,  /* (553) parenthesized_joined_table ::= NK_LP joined_table NK_RP */
+   -3,  /* (554) parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP */
+   -6,  /* (555) joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
+    0,  /* (556) join_type ::= */
+   -1,  /* (557) join_type ::= INNER */
+  -14,  /* (558) query_specification ::= SELECT hint_list set_quantifier_opt tag_mode_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
+    0,  /* (559) hint_list ::= */
+   -1,  /* (560) hint_list ::= NK_HINT */
+    0,  /* (561) tag_mode_opt ::= */
+   -1,  /* (562) tag_mode_opt ::= TAGS */
+    0,  /* (563) set_quantifier_opt ::= */
+   -1,  /* (564) set_quantifier_opt ::= DISTINCT */
+   -1,  /* (565) set_quantifier_opt ::= ALL */
+   -1,  /* (566) select_list ::= select_item */
+   -3,  /* (567) select_list ::= select_list NK_COMMA select_item */
+   -1,  /* (568) select_item ::= NK_STAR */
+   -1,  /* (569) select_item ::= common_expression */
+   -2,  /* (570) select_item ::= common_expression column_alias */
+   -3,  /* (571) select_item ::= common_expression AS column_alias */
+   -3,  /* (572) select_item ::= table_name NK_DOT NK_STAR */
+    0,  /* (573) where_clause_opt ::= */
+   -2,  /* (574) where_clause_opt ::= WHERE search_condition */
+    0,  /* (575) partition_by_clause_opt ::= */
+   -3,  /* (576) partition_by_clause_opt ::= PARTITION BY partition_list */
+   -1,  /* (577) partition_list ::= partition_item */
+   -3,  /* (578) partition_list ::= partition_list NK_COMMA partition_item */
+   -1,  /* (579) partition_item ::= expr_or_subquery */
+   -2,  /* (580) partition_item ::= expr_or_subquery column_alias */
+   -3,  /* (581) partition_item ::= expr_or_subquery AS column_alias */
+    0,  /* (582) twindow_clause_opt ::= */
+   -6,  /* (583) twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA interval_sliding_duration_literal NK_RP */
+   -4,  /* (584) twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
+   -6,  /* (585) twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_RP sliding_opt fill_opt */
+   -8,  /* (586) twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_COMMA interval_sliding_duration_literal NK_RP sliding_opt fill_opt */
+   -7,  /* (587) twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition */
+    0,  /* (588) sliding_opt ::= */
+   -4,  /* (589) sliding_opt ::= SLIDING NK_LP interval_sliding_duration_literal NK_RP */
+   -1,  /* (590) interval_sliding_duration_literal ::= NK_VARIABLE */
+   -1,  /* (591) interval_sliding_duration_literal ::= NK_STRING */
+   -1,  /* (592) interval_sliding_duration_literal ::= NK_INTEGER */
+    0,  /* (593) fill_opt ::= */
+   -4,  /* (594) fill_opt ::= FILL NK_LP fill_mode NK_RP */
+   -6,  /* (595) fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP */
+   -6,  /* (596) fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP */
+   -1,  /* (597) fill_mode ::= NONE */
+   -1,  /* (598) fill_mode ::= PREV */
+   -1,  /* (599) fill_mode ::= NULL */
+   -1,  /* (600) fill_mode ::= NULL_F */
+   -1,  /* (601) fill_mode ::= LINEAR */
+   -1,  /* (602) fill_mode ::= NEXT */
+    0,  /* (603) group_by_clause_opt ::= */
+   -3,  /* (604) group_by_clause_opt ::= GROUP BY group_by_list */
+   -1,  /* (605) group_by_list ::= expr_or_subquery */
+   -3,  /* (606) group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
+    0,  /* (607) having_clause_opt ::= */
+   -2,  /* (608) having_clause_opt ::= HAVING search_condition */
+    0,  /* (609) range_opt ::= */
+   -6,  /* (610) range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
+   -4,  /* (611) range_opt ::= RANGE NK_LP expr_or_subquery NK_RP */
+    0,  /* (612) every_opt ::= */
+   -4,  /* (613) every_opt ::= EVERY NK_LP duration_literal NK_RP */
+   -4,  /* (614) query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
+   -1,  /* (615) query_simple ::= query_specification */
+   -1,  /* (616) query_simple ::= union_query_expression */
+   -4,  /* (617) union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
+   -3,  /* (618) union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
+   -1,  /* (619) query_simple_or_subquery ::= query_simple */
+   -1,  /* (620) query_simple_or_subquery ::= subquery */
+   -1,  /* (621) query_or_subquery ::= query_expression */
+   -1,  /* (622) query_or_subquery ::= subquery */
+    0,  /* (623) order_by_clause_opt ::= */
+   -3,  /* (624) order_by_clause_opt ::= ORDER BY sort_specification_list */
+    0,  /* (625) slimit_clause_opt ::= */
+   -2,  /* (626) slimit_clause_opt ::= SLIMIT NK_INTEGER */
+   -4,  /* (627) slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
+   -4,  /* (628) slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
+    0,  /* (629) limit_clause_opt ::= */
+   -2,  /* (630) limit_clause_opt ::= LIMIT NK_INTEGER */
+   -4,  /* (631) limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */
+   -4,  /* (632) limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */
+   -3,  /* (633) subquery ::= NK_LP query_expression NK_RP */
+   -3,  /* (634) subquery ::= NK_LP subquery NK_RP */
+   -1,  /* (635) search_condition ::= common_expression */
+   -1,  /* (636) sort_specification_list ::= sort_specification */
+   -3,  /* (637) sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */
+   -3,  /* (638) sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
+    0,  /* (639) ordering_specification_opt ::= */
+   -1,  /* (640) ordering_specification_opt ::= ASC */
+   -1,  /* (641) ordering_specification_opt ::= DESC */
+    0,  /* (642) null_ordering_opt ::= */
+   -2,  /* (643) null_ordering_opt ::= NULLS FIRST */
+   -2,  /* (644) null_ordering_opt ::= NULLS LAST */
 };
 
 static void yy_accept(yyParser*);  /* Forward Declaration */
@@ -5055,19 +5057,19 @@ static YYACTIONTYPE yy_reduce(
       case 0: /* cmd ::= CREATE ACCOUNT NK_ID PASS NK_STRING account_options */
 #line 50 "sql.y"
 { pCxt->errCode = generateSyntaxErrMsg(&pCxt->msgBuf, TSDB_CODE_PAR_EXPRIE_STATEMENT); }
-#line 5058 "sql.c"
-  yy_destructor(yypParser,348,&yymsp[0].minor);
+#line 5060 "sql.c"
+  yy_destructor(yypParser,350,&yymsp[0].minor);
         break;
       case 1: /* cmd ::= ALTER ACCOUNT NK_ID alter_account_options */
 #line 51 "sql.y"
 { pCxt->errCode = generateSyntaxErrMsg(&pCxt->msgBuf, TSDB_CODE_PAR_EXPRIE_STATEMENT); }
-#line 5064 "sql.c"
-  yy_destructor(yypParser,349,&yymsp[0].minor);
+#line 5066 "sql.c"
+  yy_destructor(yypParser,351,&yymsp[0].minor);
         break;
       case 2: /* account_options ::= */
 #line 55 "sql.y"
 { }
-#line 5070 "sql.c"
+#line 5072 "sql.c"
         break;
       case 3: /* account_options ::= account_options PPS literal */
       case 4: /* account_options ::= account_options TSERIES literal */ yytestcase(yyruleno==4);
@@ -5078,26 +5080,26 @@ static YYACTIONTYPE yy_reduce(
       case 9: /* account_options ::= account_options USERS literal */ yytestcase(yyruleno==9);
       case 10: /* account_options ::= account_options CONNS literal */ yytestcase(yyruleno==10);
       case 11: /* account_options ::= account_options STATE literal */ yytestcase(yyruleno==11);
-{  yy_destructor(yypParser,348,&yymsp[-2].minor);
+{  yy_destructor(yypParser,350,&yymsp[-2].minor);
 #line 56 "sql.y"
 { }
-#line 5084 "sql.c"
-  yy_destructor(yypParser,350,&yymsp[0].minor);
+#line 5086 "sql.c"
+  yy_destructor(yypParser,352,&yymsp[0].minor);
 }
         break;
       case 12: /* alter_account_options ::= alter_account_option */
-{  yy_destructor(yypParser,351,&yymsp[0].minor);
+{  yy_destructor(yypParser,353,&yymsp[0].minor);
 #line 68 "sql.y"
 { }
-#line 5092 "sql.c"
+#line 5094 "sql.c"
 }
         break;
       case 13: /* alter_account_options ::= alter_account_options alter_account_option */
-{  yy_destructor(yypParser,349,&yymsp[-1].minor);
+{  yy_destructor(yypParser,351,&yymsp[-1].minor);
 #line 69 "sql.y"
 { }
-#line 5099 "sql.c"
-  yy_destructor(yypParser,351,&yymsp[0].minor);
+#line 5101 "sql.c"
+  yy_destructor(yypParser,353,&yymsp[0].minor);
 }
         break;
       case 14: /* alter_account_option ::= PASS literal */
@@ -5112,2631 +5114,2648 @@ static YYACTIONTYPE yy_reduce(
       case 23: /* alter_account_option ::= STATE literal */ yytestcase(yyruleno==23);
 #line 73 "sql.y"
 { }
-#line 5115 "sql.c"
-  yy_destructor(yypParser,350,&yymsp[0].minor);
+#line 5117 "sql.c"
+  yy_destructor(yypParser,352,&yymsp[0].minor);
         break;
       case 24: /* ip_range_list ::= NK_STRING */
 #line 86 "sql.y"
-{ yylhsminor.yy88 = createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0)); }
-#line 5121 "sql.c"
-  yymsp[0].minor.yy88 = yylhsminor.yy88;
+{ yylhsminor.yy364 = createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0)); }
+#line 5123 "sql.c"
+  yymsp[0].minor.yy364 = yylhsminor.yy364;
         break;
       case 25: /* ip_range_list ::= ip_range_list NK_COMMA NK_STRING */
 #line 87 "sql.y"
-{ yylhsminor.yy88 = addNodeToList(pCxt, yymsp[-2].minor.yy88, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0)); }
-#line 5127 "sql.c"
-  yymsp[-2].minor.yy88 = yylhsminor.yy88;
+{ yylhsminor.yy364 = addNodeToList(pCxt, yymsp[-2].minor.yy364, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0)); }
+#line 5129 "sql.c"
+  yymsp[-2].minor.yy364 = yylhsminor.yy364;
         break;
       case 26: /* white_list ::= HOST ip_range_list */
 #line 91 "sql.y"
-{ yymsp[-1].minor.yy88 = yymsp[0].minor.yy88; }
-#line 5133 "sql.c"
+{ yymsp[-1].minor.yy364 = yymsp[0].minor.yy364; }
+#line 5135 "sql.c"
         break;
       case 27: /* white_list_opt ::= */
-      case 186: /* specific_cols_opt ::= */ yytestcase(yyruleno==186);
-      case 217: /* tags_def_opt ::= */ yytestcase(yyruleno==217);
-      case 302: /* tag_list_opt ::= */ yytestcase(yyruleno==302);
-      case 368: /* col_list_opt ::= */ yytestcase(yyruleno==368);
-      case 370: /* tag_def_or_ref_opt ::= */ yytestcase(yyruleno==370);
-      case 572: /* partition_by_clause_opt ::= */ yytestcase(yyruleno==572);
-      case 600: /* group_by_clause_opt ::= */ yytestcase(yyruleno==600);
-      case 620: /* order_by_clause_opt ::= */ yytestcase(yyruleno==620);
+      case 188: /* specific_cols_opt ::= */ yytestcase(yyruleno==188);
+      case 219: /* tags_def_opt ::= */ yytestcase(yyruleno==219);
+      case 305: /* tag_list_opt ::= */ yytestcase(yyruleno==305);
+      case 371: /* col_list_opt ::= */ yytestcase(yyruleno==371);
+      case 373: /* tag_def_or_ref_opt ::= */ yytestcase(yyruleno==373);
+      case 575: /* partition_by_clause_opt ::= */ yytestcase(yyruleno==575);
+      case 603: /* group_by_clause_opt ::= */ yytestcase(yyruleno==603);
+      case 623: /* order_by_clause_opt ::= */ yytestcase(yyruleno==623);
 #line 95 "sql.y"
-{ yymsp[1].minor.yy88 = NULL; }
-#line 5146 "sql.c"
+{ yymsp[1].minor.yy364 = NULL; }
+#line 5148 "sql.c"
         break;
       case 28: /* white_list_opt ::= white_list */
-      case 218: /* tags_def_opt ::= tags_def */ yytestcase(yyruleno==218);
-      case 371: /* tag_def_or_ref_opt ::= tags_def */ yytestcase(yyruleno==371);
-      case 497: /* star_func_para_list ::= other_para_list */ yytestcase(yyruleno==497);
+      case 220: /* tags_def_opt ::= tags_def */ yytestcase(yyruleno==220);
+      case 374: /* tag_def_or_ref_opt ::= tags_def */ yytestcase(yyruleno==374);
+      case 500: /* star_func_para_list ::= other_para_list */ yytestcase(yyruleno==500);
 #line 96 "sql.y"
-{ yylhsminor.yy88 = yymsp[0].minor.yy88; }
-#line 5154 "sql.c"
-  yymsp[0].minor.yy88 = yylhsminor.yy88;
+{ yylhsminor.yy364 = yymsp[0].minor.yy364; }
+#line 5156 "sql.c"
+  yymsp[0].minor.yy364 = yylhsminor.yy364;
         break;
       case 29: /* cmd ::= CREATE USER user_name PASS NK_STRING sysinfo_opt white_list_opt */
 #line 100 "sql.y"
 {
-                                                                                    pCxt->pRootNode = createCreateUserStmt(pCxt, &yymsp[-4].minor.yy993, &yymsp[-2].minor.yy0, yymsp[-1].minor.yy279);
-                                                                                    pCxt->pRootNode = addCreateUserStmtWhiteList(pCxt, pCxt->pRootNode, yymsp[0].minor.yy88);
+                                                                                    pCxt->pRootNode = createCreateUserStmt(pCxt, &yymsp[-4].minor.yy929, &yymsp[-2].minor.yy0, yymsp[-1].minor.yy143);
+                                                                                    pCxt->pRootNode = addCreateUserStmtWhiteList(pCxt, pCxt->pRootNode, yymsp[0].minor.yy364);
                                                                                   }
-#line 5163 "sql.c"
+#line 5165 "sql.c"
         break;
       case 30: /* cmd ::= ALTER USER user_name PASS NK_STRING */
 #line 104 "sql.y"
-{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy993, TSDB_ALTER_USER_PASSWD, &yymsp[0].minor.yy0); }
-#line 5168 "sql.c"
+{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy929, TSDB_ALTER_USER_PASSWD, &yymsp[0].minor.yy0); }
+#line 5170 "sql.c"
         break;
       case 31: /* cmd ::= ALTER USER user_name ENABLE NK_INTEGER */
 #line 105 "sql.y"
-{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy993, TSDB_ALTER_USER_ENABLE, &yymsp[0].minor.yy0); }
-#line 5173 "sql.c"
+{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy929, TSDB_ALTER_USER_ENABLE, &yymsp[0].minor.yy0); }
+#line 5175 "sql.c"
         break;
       case 32: /* cmd ::= ALTER USER user_name SYSINFO NK_INTEGER */
 #line 106 "sql.y"
-{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy993, TSDB_ALTER_USER_SYSINFO, &yymsp[0].minor.yy0); }
-#line 5178 "sql.c"
+{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy929, TSDB_ALTER_USER_SYSINFO, &yymsp[0].minor.yy0); }
+#line 5180 "sql.c"
         break;
       case 33: /* cmd ::= ALTER USER user_name ADD white_list */
 #line 107 "sql.y"
-{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy993, TSDB_ALTER_USER_ADD_WHITE_LIST, yymsp[0].minor.yy88); }
-#line 5183 "sql.c"
+{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy929, TSDB_ALTER_USER_ADD_WHITE_LIST, yymsp[0].minor.yy364); }
+#line 5185 "sql.c"
         break;
       case 34: /* cmd ::= ALTER USER user_name DROP white_list */
 #line 108 "sql.y"
-{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy993, TSDB_ALTER_USER_DROP_WHITE_LIST, yymsp[0].minor.yy88); }
-#line 5188 "sql.c"
+{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy929, TSDB_ALTER_USER_DROP_WHITE_LIST, yymsp[0].minor.yy364); }
+#line 5190 "sql.c"
         break;
       case 35: /* cmd ::= DROP USER user_name */
 #line 109 "sql.y"
-{ pCxt->pRootNode = createDropUserStmt(pCxt, &yymsp[0].minor.yy993); }
-#line 5193 "sql.c"
+{ pCxt->pRootNode = createDropUserStmt(pCxt, &yymsp[0].minor.yy929); }
+#line 5195 "sql.c"
         break;
       case 36: /* sysinfo_opt ::= */
 #line 113 "sql.y"
-{ yymsp[1].minor.yy279 = 1; }
-#line 5198 "sql.c"
+{ yymsp[1].minor.yy143 = 1; }
+#line 5200 "sql.c"
         break;
       case 37: /* sysinfo_opt ::= SYSINFO NK_INTEGER */
 #line 114 "sql.y"
-{ yymsp[-1].minor.yy279 = taosStr2Int8(yymsp[0].minor.yy0.z, NULL, 10); }
-#line 5203 "sql.c"
+{ yymsp[-1].minor.yy143 = taosStr2Int8(yymsp[0].minor.yy0.z, NULL, 10); }
+#line 5205 "sql.c"
         break;
       case 38: /* cmd ::= GRANT privileges ON priv_level with_opt TO user_name */
 #line 117 "sql.y"
-{ pCxt->pRootNode = createGrantStmt(pCxt, yymsp[-5].minor.yy221, &yymsp[-3].minor.yy241, &yymsp[0].minor.yy993, yymsp[-2].minor.yy232); }
-#line 5208 "sql.c"
+{ pCxt->pRootNode = createGrantStmt(pCxt, yymsp[-5].minor.yy429, &yymsp[-3].minor.yy777, &yymsp[0].minor.yy929, yymsp[-2].minor.yy992); }
+#line 5210 "sql.c"
         break;
       case 39: /* cmd ::= REVOKE privileges ON priv_level with_opt FROM user_name */
 #line 118 "sql.y"
-{ pCxt->pRootNode = createRevokeStmt(pCxt, yymsp[-5].minor.yy221, &yymsp[-3].minor.yy241, &yymsp[0].minor.yy993, yymsp[-2].minor.yy232); }
-#line 5213 "sql.c"
+{ pCxt->pRootNode = createRevokeStmt(pCxt, yymsp[-5].minor.yy429, &yymsp[-3].minor.yy777, &yymsp[0].minor.yy929, yymsp[-2].minor.yy992); }
+#line 5215 "sql.c"
         break;
       case 40: /* privileges ::= ALL */
 #line 122 "sql.y"
-{ yymsp[0].minor.yy221 = PRIVILEGE_TYPE_ALL; }
-#line 5218 "sql.c"
+{ yymsp[0].minor.yy429 = PRIVILEGE_TYPE_ALL; }
+#line 5220 "sql.c"
         break;
       case 41: /* privileges ::= priv_type_list */
       case 43: /* priv_type_list ::= priv_type */ yytestcase(yyruleno==43);
 #line 123 "sql.y"
-{ yylhsminor.yy221 = yymsp[0].minor.yy221; }
-#line 5224 "sql.c"
-  yymsp[0].minor.yy221 = yylhsminor.yy221;
+{ yylhsminor.yy429 = yymsp[0].minor.yy429; }
+#line 5226 "sql.c"
+  yymsp[0].minor.yy429 = yylhsminor.yy429;
         break;
       case 42: /* privileges ::= SUBSCRIBE */
 #line 124 "sql.y"
-{ yymsp[0].minor.yy221 = PRIVILEGE_TYPE_SUBSCRIBE; }
-#line 5230 "sql.c"
+{ yymsp[0].minor.yy429 = PRIVILEGE_TYPE_SUBSCRIBE; }
+#line 5232 "sql.c"
         break;
       case 44: /* priv_type_list ::= priv_type_list NK_COMMA priv_type */
 #line 129 "sql.y"
-{ yylhsminor.yy221 = yymsp[-2].minor.yy221 | yymsp[0].minor.yy221; }
-#line 5235 "sql.c"
-  yymsp[-2].minor.yy221 = yylhsminor.yy221;
+{ yylhsminor.yy429 = yymsp[-2].minor.yy429 | yymsp[0].minor.yy429; }
+#line 5237 "sql.c"
+  yymsp[-2].minor.yy429 = yylhsminor.yy429;
         break;
       case 45: /* priv_type ::= READ */
 #line 133 "sql.y"
-{ yymsp[0].minor.yy221 = PRIVILEGE_TYPE_READ; }
-#line 5241 "sql.c"
+{ yymsp[0].minor.yy429 = PRIVILEGE_TYPE_READ; }
+#line 5243 "sql.c"
         break;
       case 46: /* priv_type ::= WRITE */
 #line 134 "sql.y"
-{ yymsp[0].minor.yy221 = PRIVILEGE_TYPE_WRITE; }
-#line 5246 "sql.c"
+{ yymsp[0].minor.yy429 = PRIVILEGE_TYPE_WRITE; }
+#line 5248 "sql.c"
         break;
       case 47: /* priv_type ::= ALTER */
 #line 135 "sql.y"
-{ yymsp[0].minor.yy221 = PRIVILEGE_TYPE_ALTER; }
-#line 5251 "sql.c"
+{ yymsp[0].minor.yy429 = PRIVILEGE_TYPE_ALTER; }
+#line 5253 "sql.c"
         break;
       case 48: /* priv_level ::= NK_STAR NK_DOT NK_STAR */
 #line 139 "sql.y"
-{ yylhsminor.yy241.first = yymsp[-2].minor.yy0; yylhsminor.yy241.second = yymsp[0].minor.yy0; }
-#line 5256 "sql.c"
-  yymsp[-2].minor.yy241 = yylhsminor.yy241;
+{ yylhsminor.yy777.first = yymsp[-2].minor.yy0; yylhsminor.yy777.second = yymsp[0].minor.yy0; }
+#line 5258 "sql.c"
+  yymsp[-2].minor.yy777 = yylhsminor.yy777;
         break;
       case 49: /* priv_level ::= db_name NK_DOT NK_STAR */
 #line 140 "sql.y"
-{ yylhsminor.yy241.first = yymsp[-2].minor.yy993; yylhsminor.yy241.second = yymsp[0].minor.yy0; }
-#line 5262 "sql.c"
-  yymsp[-2].minor.yy241 = yylhsminor.yy241;
+{ yylhsminor.yy777.first = yymsp[-2].minor.yy929; yylhsminor.yy777.second = yymsp[0].minor.yy0; }
+#line 5264 "sql.c"
+  yymsp[-2].minor.yy777 = yylhsminor.yy777;
         break;
       case 50: /* priv_level ::= db_name NK_DOT table_name */
 #line 141 "sql.y"
-{ yylhsminor.yy241.first = yymsp[-2].minor.yy993; yylhsminor.yy241.second = yymsp[0].minor.yy993; }
-#line 5268 "sql.c"
-  yymsp[-2].minor.yy241 = yylhsminor.yy241;
+{ yylhsminor.yy777.first = yymsp[-2].minor.yy929; yylhsminor.yy777.second = yymsp[0].minor.yy929; }
+#line 5270 "sql.c"
+  yymsp[-2].minor.yy777 = yylhsminor.yy777;
         break;
       case 51: /* priv_level ::= topic_name */
 #line 142 "sql.y"
-{ yylhsminor.yy241.first = yymsp[0].minor.yy993; yylhsminor.yy241.second = nil_token; }
-#line 5274 "sql.c"
-  yymsp[0].minor.yy241 = yylhsminor.yy241;
+{ yylhsminor.yy777.first = yymsp[0].minor.yy929; yylhsminor.yy777.second = nil_token; }
+#line 5276 "sql.c"
+  yymsp[0].minor.yy777 = yylhsminor.yy777;
         break;
       case 52: /* with_opt ::= */
-      case 155: /* start_opt ::= */ yytestcase(yyruleno==155);
-      case 159: /* end_opt ::= */ yytestcase(yyruleno==159);
-      case 297: /* like_pattern_opt ::= */ yytestcase(yyruleno==297);
-      case 382: /* subtable_opt ::= */ yytestcase(yyruleno==382);
-      case 507: /* case_when_else_opt ::= */ yytestcase(yyruleno==507);
-      case 537: /* from_clause_opt ::= */ yytestcase(yyruleno==537);
-      case 570: /* where_clause_opt ::= */ yytestcase(yyruleno==570);
-      case 579: /* twindow_clause_opt ::= */ yytestcase(yyruleno==579);
-      case 585: /* sliding_opt ::= */ yytestcase(yyruleno==585);
-      case 590: /* fill_opt ::= */ yytestcase(yyruleno==590);
-      case 604: /* having_clause_opt ::= */ yytestcase(yyruleno==604);
-      case 606: /* range_opt ::= */ yytestcase(yyruleno==606);
-      case 609: /* every_opt ::= */ yytestcase(yyruleno==609);
-      case 622: /* slimit_clause_opt ::= */ yytestcase(yyruleno==622);
-      case 626: /* limit_clause_opt ::= */ yytestcase(yyruleno==626);
+      case 157: /* start_opt ::= */ yytestcase(yyruleno==157);
+      case 161: /* end_opt ::= */ yytestcase(yyruleno==161);
+      case 300: /* like_pattern_opt ::= */ yytestcase(yyruleno==300);
+      case 385: /* subtable_opt ::= */ yytestcase(yyruleno==385);
+      case 510: /* case_when_else_opt ::= */ yytestcase(yyruleno==510);
+      case 540: /* from_clause_opt ::= */ yytestcase(yyruleno==540);
+      case 573: /* where_clause_opt ::= */ yytestcase(yyruleno==573);
+      case 582: /* twindow_clause_opt ::= */ yytestcase(yyruleno==582);
+      case 588: /* sliding_opt ::= */ yytestcase(yyruleno==588);
+      case 593: /* fill_opt ::= */ yytestcase(yyruleno==593);
+      case 607: /* having_clause_opt ::= */ yytestcase(yyruleno==607);
+      case 609: /* range_opt ::= */ yytestcase(yyruleno==609);
+      case 612: /* every_opt ::= */ yytestcase(yyruleno==612);
+      case 625: /* slimit_clause_opt ::= */ yytestcase(yyruleno==625);
+      case 629: /* limit_clause_opt ::= */ yytestcase(yyruleno==629);
 #line 144 "sql.y"
-{ yymsp[1].minor.yy232 = NULL; }
-#line 5295 "sql.c"
+{ yymsp[1].minor.yy992 = NULL; }
+#line 5297 "sql.c"
         break;
       case 53: /* with_opt ::= WITH search_condition */
-      case 538: /* from_clause_opt ::= FROM table_reference_list */ yytestcase(yyruleno==538);
-      case 571: /* where_clause_opt ::= WHERE search_condition */ yytestcase(yyruleno==571);
-      case 605: /* having_clause_opt ::= HAVING search_condition */ yytestcase(yyruleno==605);
+      case 541: /* from_clause_opt ::= FROM table_reference_list */ yytestcase(yyruleno==541);
+      case 574: /* where_clause_opt ::= WHERE search_condition */ yytestcase(yyruleno==574);
+      case 608: /* having_clause_opt ::= HAVING search_condition */ yytestcase(yyruleno==608);
 #line 145 "sql.y"
-{ yymsp[-1].minor.yy232 = yymsp[0].minor.yy232; }
-#line 5303 "sql.c"
+{ yymsp[-1].minor.yy992 = yymsp[0].minor.yy992; }
+#line 5305 "sql.c"
         break;
       case 54: /* cmd ::= CREATE DNODE dnode_endpoint */
 #line 148 "sql.y"
-{ pCxt->pRootNode = createCreateDnodeStmt(pCxt, &yymsp[0].minor.yy993, NULL); }
-#line 5308 "sql.c"
+{ pCxt->pRootNode = createCreateDnodeStmt(pCxt, &yymsp[0].minor.yy929, NULL); }
+#line 5310 "sql.c"
         break;
       case 55: /* cmd ::= CREATE DNODE dnode_endpoint PORT NK_INTEGER */
 #line 149 "sql.y"
-{ pCxt->pRootNode = createCreateDnodeStmt(pCxt, &yymsp[-2].minor.yy993, &yymsp[0].minor.yy0); }
-#line 5313 "sql.c"
+{ pCxt->pRootNode = createCreateDnodeStmt(pCxt, &yymsp[-2].minor.yy929, &yymsp[0].minor.yy0); }
+#line 5315 "sql.c"
         break;
       case 56: /* cmd ::= DROP DNODE NK_INTEGER force_opt */
 #line 150 "sql.y"
-{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy0, yymsp[0].minor.yy985, false); }
-#line 5318 "sql.c"
+{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy0, yymsp[0].minor.yy437, false); }
+#line 5320 "sql.c"
         break;
       case 57: /* cmd ::= DROP DNODE dnode_endpoint force_opt */
 #line 151 "sql.y"
-{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy993, yymsp[0].minor.yy985, false); }
-#line 5323 "sql.c"
+{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy929, yymsp[0].minor.yy437, false); }
+#line 5325 "sql.c"
         break;
       case 58: /* cmd ::= DROP DNODE NK_INTEGER unsafe_opt */
 #line 152 "sql.y"
-{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy0, false, yymsp[0].minor.yy985); }
-#line 5328 "sql.c"
+{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy0, false, yymsp[0].minor.yy437); }
+#line 5330 "sql.c"
         break;
       case 59: /* cmd ::= DROP DNODE dnode_endpoint unsafe_opt */
 #line 153 "sql.y"
-{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy993, false, yymsp[0].minor.yy985); }
-#line 5333 "sql.c"
+{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy929, false, yymsp[0].minor.yy437); }
+#line 5335 "sql.c"
         break;
       case 60: /* cmd ::= ALTER DNODE NK_INTEGER NK_STRING */
 #line 154 "sql.y"
 { pCxt->pRootNode = createAlterDnodeStmt(pCxt, &yymsp[-1].minor.yy0, &yymsp[0].minor.yy0, NULL); }
-#line 5338 "sql.c"
+#line 5340 "sql.c"
         break;
       case 61: /* cmd ::= ALTER DNODE NK_INTEGER NK_STRING NK_STRING */
 #line 155 "sql.y"
 { pCxt->pRootNode = createAlterDnodeStmt(pCxt, &yymsp[-2].minor.yy0, &yymsp[-1].minor.yy0, &yymsp[0].minor.yy0); }
-#line 5343 "sql.c"
+#line 5345 "sql.c"
         break;
       case 62: /* cmd ::= ALTER ALL DNODES NK_STRING */
 #line 156 "sql.y"
 { pCxt->pRootNode = createAlterDnodeStmt(pCxt, NULL, &yymsp[0].minor.yy0, NULL); }
-#line 5348 "sql.c"
+#line 5350 "sql.c"
         break;
       case 63: /* cmd ::= ALTER ALL DNODES NK_STRING NK_STRING */
 #line 157 "sql.y"
 { pCxt->pRootNode = createAlterDnodeStmt(pCxt, NULL, &yymsp[-1].minor.yy0, &yymsp[0].minor.yy0); }
-#line 5353 "sql.c"
+#line 5355 "sql.c"
         break;
       case 64: /* cmd ::= RESTORE DNODE NK_INTEGER */
 #line 158 "sql.y"
 { pCxt->pRootNode = createRestoreComponentNodeStmt(pCxt, QUERY_NODE_RESTORE_DNODE_STMT, &yymsp[0].minor.yy0); }
-#line 5358 "sql.c"
+#line 5360 "sql.c"
         break;
       case 65: /* dnode_endpoint ::= NK_STRING */
       case 66: /* dnode_endpoint ::= NK_ID */ yytestcase(yyruleno==66);
       case 67: /* dnode_endpoint ::= NK_IPTOKEN */ yytestcase(yyruleno==67);
-      case 324: /* sma_func_name ::= COUNT */ yytestcase(yyruleno==324);
-      case 325: /* sma_func_name ::= FIRST */ yytestcase(yyruleno==325);
-      case 326: /* sma_func_name ::= LAST */ yytestcase(yyruleno==326);
-      case 327: /* sma_func_name ::= LAST_ROW */ yytestcase(yyruleno==327);
-      case 429: /* db_name ::= NK_ID */ yytestcase(yyruleno==429);
-      case 430: /* table_name ::= NK_ID */ yytestcase(yyruleno==430);
-      case 431: /* column_name ::= NK_ID */ yytestcase(yyruleno==431);
-      case 432: /* function_name ::= NK_ID */ yytestcase(yyruleno==432);
-      case 433: /* view_name ::= NK_ID */ yytestcase(yyruleno==433);
-      case 434: /* table_alias ::= NK_ID */ yytestcase(yyruleno==434);
-      case 435: /* column_alias ::= NK_ID */ yytestcase(yyruleno==435);
-      case 436: /* column_alias ::= NK_ALIAS */ yytestcase(yyruleno==436);
-      case 437: /* user_name ::= NK_ID */ yytestcase(yyruleno==437);
-      case 438: /* topic_name ::= NK_ID */ yytestcase(yyruleno==438);
-      case 439: /* stream_name ::= NK_ID */ yytestcase(yyruleno==439);
-      case 440: /* cgroup_name ::= NK_ID */ yytestcase(yyruleno==440);
-      case 441: /* index_name ::= NK_ID */ yytestcase(yyruleno==441);
-      case 483: /* noarg_func ::= NOW */ yytestcase(yyruleno==483);
-      case 484: /* noarg_func ::= TODAY */ yytestcase(yyruleno==484);
-      case 485: /* noarg_func ::= TIMEZONE */ yytestcase(yyruleno==485);
-      case 486: /* noarg_func ::= DATABASE */ yytestcase(yyruleno==486);
-      case 487: /* noarg_func ::= CLIENT_VERSION */ yytestcase(yyruleno==487);
-      case 488: /* noarg_func ::= SERVER_VERSION */ yytestcase(yyruleno==488);
-      case 489: /* noarg_func ::= SERVER_STATUS */ yytestcase(yyruleno==489);
-      case 490: /* noarg_func ::= CURRENT_USER */ yytestcase(yyruleno==490);
-      case 491: /* noarg_func ::= USER */ yytestcase(yyruleno==491);
-      case 492: /* star_func ::= COUNT */ yytestcase(yyruleno==492);
-      case 493: /* star_func ::= FIRST */ yytestcase(yyruleno==493);
-      case 494: /* star_func ::= LAST */ yytestcase(yyruleno==494);
-      case 495: /* star_func ::= LAST_ROW */ yytestcase(yyruleno==495);
+      case 327: /* sma_func_name ::= COUNT */ yytestcase(yyruleno==327);
+      case 328: /* sma_func_name ::= FIRST */ yytestcase(yyruleno==328);
+      case 329: /* sma_func_name ::= LAST */ yytestcase(yyruleno==329);
+      case 330: /* sma_func_name ::= LAST_ROW */ yytestcase(yyruleno==330);
+      case 432: /* db_name ::= NK_ID */ yytestcase(yyruleno==432);
+      case 433: /* table_name ::= NK_ID */ yytestcase(yyruleno==433);
+      case 434: /* column_name ::= NK_ID */ yytestcase(yyruleno==434);
+      case 435: /* function_name ::= NK_ID */ yytestcase(yyruleno==435);
+      case 436: /* view_name ::= NK_ID */ yytestcase(yyruleno==436);
+      case 437: /* table_alias ::= NK_ID */ yytestcase(yyruleno==437);
+      case 438: /* column_alias ::= NK_ID */ yytestcase(yyruleno==438);
+      case 439: /* column_alias ::= NK_ALIAS */ yytestcase(yyruleno==439);
+      case 440: /* user_name ::= NK_ID */ yytestcase(yyruleno==440);
+      case 441: /* topic_name ::= NK_ID */ yytestcase(yyruleno==441);
+      case 442: /* stream_name ::= NK_ID */ yytestcase(yyruleno==442);
+      case 443: /* cgroup_name ::= NK_ID */ yytestcase(yyruleno==443);
+      case 444: /* index_name ::= NK_ID */ yytestcase(yyruleno==444);
+      case 486: /* noarg_func ::= NOW */ yytestcase(yyruleno==486);
+      case 487: /* noarg_func ::= TODAY */ yytestcase(yyruleno==487);
+      case 488: /* noarg_func ::= TIMEZONE */ yytestcase(yyruleno==488);
+      case 489: /* noarg_func ::= DATABASE */ yytestcase(yyruleno==489);
+      case 490: /* noarg_func ::= CLIENT_VERSION */ yytestcase(yyruleno==490);
+      case 491: /* noarg_func ::= SERVER_VERSION */ yytestcase(yyruleno==491);
+      case 492: /* noarg_func ::= SERVER_STATUS */ yytestcase(yyruleno==492);
+      case 493: /* noarg_func ::= CURRENT_USER */ yytestcase(yyruleno==493);
+      case 494: /* noarg_func ::= USER */ yytestcase(yyruleno==494);
+      case 495: /* star_func ::= COUNT */ yytestcase(yyruleno==495);
+      case 496: /* star_func ::= FIRST */ yytestcase(yyruleno==496);
+      case 497: /* star_func ::= LAST */ yytestcase(yyruleno==497);
+      case 498: /* star_func ::= LAST_ROW */ yytestcase(yyruleno==498);
 #line 162 "sql.y"
-{ yylhsminor.yy993 = yymsp[0].minor.yy0; }
-#line 5395 "sql.c"
-  yymsp[0].minor.yy993 = yylhsminor.yy993;
+{ yylhsminor.yy929 = yymsp[0].minor.yy0; }
+#line 5397 "sql.c"
+  yymsp[0].minor.yy929 = yylhsminor.yy929;
         break;
       case 68: /* force_opt ::= */
       case 92: /* not_exists_opt ::= */ yytestcase(yyruleno==92);
       case 94: /* exists_opt ::= */ yytestcase(yyruleno==94);
-      case 345: /* analyze_opt ::= */ yytestcase(yyruleno==345);
-      case 352: /* agg_func_opt ::= */ yytestcase(yyruleno==352);
-      case 358: /* or_replace_opt ::= */ yytestcase(yyruleno==358);
-      case 384: /* ignore_opt ::= */ yytestcase(yyruleno==384);
-      case 558: /* tag_mode_opt ::= */ yytestcase(yyruleno==558);
-      case 560: /* set_quantifier_opt ::= */ yytestcase(yyruleno==560);
+      case 348: /* analyze_opt ::= */ yytestcase(yyruleno==348);
+      case 355: /* agg_func_opt ::= */ yytestcase(yyruleno==355);
+      case 361: /* or_replace_opt ::= */ yytestcase(yyruleno==361);
+      case 387: /* ignore_opt ::= */ yytestcase(yyruleno==387);
+      case 561: /* tag_mode_opt ::= */ yytestcase(yyruleno==561);
+      case 563: /* set_quantifier_opt ::= */ yytestcase(yyruleno==563);
 #line 168 "sql.y"
-{ yymsp[1].minor.yy985 = false; }
-#line 5409 "sql.c"
+{ yymsp[1].minor.yy437 = false; }
+#line 5411 "sql.c"
         break;
       case 69: /* force_opt ::= FORCE */
       case 70: /* unsafe_opt ::= UNSAFE */ yytestcase(yyruleno==70);
-      case 346: /* analyze_opt ::= ANALYZE */ yytestcase(yyruleno==346);
-      case 353: /* agg_func_opt ::= AGGREGATE */ yytestcase(yyruleno==353);
-      case 559: /* tag_mode_opt ::= TAGS */ yytestcase(yyruleno==559);
-      case 561: /* set_quantifier_opt ::= DISTINCT */ yytestcase(yyruleno==561);
+      case 349: /* analyze_opt ::= ANALYZE */ yytestcase(yyruleno==349);
+      case 356: /* agg_func_opt ::= AGGREGATE */ yytestcase(yyruleno==356);
+      case 562: /* tag_mode_opt ::= TAGS */ yytestcase(yyruleno==562);
+      case 564: /* set_quantifier_opt ::= DISTINCT */ yytestcase(yyruleno==564);
 #line 169 "sql.y"
-{ yymsp[0].minor.yy985 = true; }
-#line 5419 "sql.c"
+{ yymsp[0].minor.yy437 = true; }
+#line 5421 "sql.c"
         break;
       case 71: /* cmd ::= ALTER LOCAL NK_STRING */
 #line 176 "sql.y"
 { pCxt->pRootNode = createAlterLocalStmt(pCxt, &yymsp[0].minor.yy0, NULL); }
-#line 5424 "sql.c"
+#line 5426 "sql.c"
         break;
       case 72: /* cmd ::= ALTER LOCAL NK_STRING NK_STRING */
 #line 177 "sql.y"
 { pCxt->pRootNode = createAlterLocalStmt(pCxt, &yymsp[-1].minor.yy0, &yymsp[0].minor.yy0); }
-#line 5429 "sql.c"
+#line 5431 "sql.c"
         break;
       case 73: /* cmd ::= CREATE QNODE ON DNODE NK_INTEGER */
 #line 180 "sql.y"
 { pCxt->pRootNode = createCreateComponentNodeStmt(pCxt, QUERY_NODE_CREATE_QNODE_STMT, &yymsp[0].minor.yy0); }
-#line 5434 "sql.c"
+#line 5436 "sql.c"
         break;
       case 74: /* cmd ::= DROP QNODE ON DNODE NK_INTEGER */
 #line 181 "sql.y"
 { pCxt->pRootNode = createDropComponentNodeStmt(pCxt, QUERY_NODE_DROP_QNODE_STMT, &yymsp[0].minor.yy0); }
-#line 5439 "sql.c"
+#line 5441 "sql.c"
         break;
       case 75: /* cmd ::= RESTORE QNODE ON DNODE NK_INTEGER */
 #line 182 "sql.y"
 { pCxt->pRootNode = createRestoreComponentNodeStmt(pCxt, QUERY_NODE_RESTORE_QNODE_STMT, &yymsp[0].minor.yy0); }
-#line 5444 "sql.c"
+#line 5446 "sql.c"
         break;
       case 76: /* cmd ::= CREATE BNODE ON DNODE NK_INTEGER */
 #line 185 "sql.y"
 { pCxt->pRootNode = createCreateComponentNodeStmt(pCxt, QUERY_NODE_CREATE_BNODE_STMT, &yymsp[0].minor.yy0); }
-#line 5449 "sql.c"
+#line 5451 "sql.c"
         break;
       case 77: /* cmd ::= DROP BNODE ON DNODE NK_INTEGER */
 #line 186 "sql.y"
 { pCxt->pRootNode = createDropComponentNodeStmt(pCxt, QUERY_NODE_DROP_BNODE_STMT, &yymsp[0].minor.yy0); }
-#line 5454 "sql.c"
+#line 5456 "sql.c"
         break;
       case 78: /* cmd ::= CREATE SNODE ON DNODE NK_INTEGER */
 #line 189 "sql.y"
 { pCxt->pRootNode = createCreateComponentNodeStmt(pCxt, QUERY_NODE_CREATE_SNODE_STMT, &yymsp[0].minor.yy0); }
-#line 5459 "sql.c"
+#line 5461 "sql.c"
         break;
       case 79: /* cmd ::= DROP SNODE ON DNODE NK_INTEGER */
 #line 190 "sql.y"
 { pCxt->pRootNode = createDropComponentNodeStmt(pCxt, QUERY_NODE_DROP_SNODE_STMT, &yymsp[0].minor.yy0); }
-#line 5464 "sql.c"
+#line 5466 "sql.c"
         break;
       case 80: /* cmd ::= CREATE MNODE ON DNODE NK_INTEGER */
 #line 193 "sql.y"
 { pCxt->pRootNode = createCreateComponentNodeStmt(pCxt, QUERY_NODE_CREATE_MNODE_STMT, &yymsp[0].minor.yy0); }
-#line 5469 "sql.c"
+#line 5471 "sql.c"
         break;
       case 81: /* cmd ::= DROP MNODE ON DNODE NK_INTEGER */
 #line 194 "sql.y"
 { pCxt->pRootNode = createDropComponentNodeStmt(pCxt, QUERY_NODE_DROP_MNODE_STMT, &yymsp[0].minor.yy0); }
-#line 5474 "sql.c"
+#line 5476 "sql.c"
         break;
       case 82: /* cmd ::= RESTORE MNODE ON DNODE NK_INTEGER */
 #line 195 "sql.y"
 { pCxt->pRootNode = createRestoreComponentNodeStmt(pCxt, QUERY_NODE_RESTORE_MNODE_STMT, &yymsp[0].minor.yy0); }
-#line 5479 "sql.c"
+#line 5481 "sql.c"
         break;
       case 83: /* cmd ::= RESTORE VNODE ON DNODE NK_INTEGER */
 #line 198 "sql.y"
 { pCxt->pRootNode = createRestoreComponentNodeStmt(pCxt, QUERY_NODE_RESTORE_VNODE_STMT, &yymsp[0].minor.yy0); }
-#line 5484 "sql.c"
+#line 5486 "sql.c"
         break;
       case 84: /* cmd ::= CREATE DATABASE not_exists_opt db_name db_options */
 #line 201 "sql.y"
-{ pCxt->pRootNode = createCreateDatabaseStmt(pCxt, yymsp[-2].minor.yy985, &yymsp[-1].minor.yy993, yymsp[0].minor.yy232); }
-#line 5489 "sql.c"
+{ pCxt->pRootNode = createCreateDatabaseStmt(pCxt, yymsp[-2].minor.yy437, &yymsp[-1].minor.yy929, yymsp[0].minor.yy992); }
+#line 5491 "sql.c"
         break;
       case 85: /* cmd ::= DROP DATABASE exists_opt db_name */
 #line 202 "sql.y"
-{ pCxt->pRootNode = createDropDatabaseStmt(pCxt, yymsp[-1].minor.yy985, &yymsp[0].minor.yy993); }
-#line 5494 "sql.c"
+{ pCxt->pRootNode = createDropDatabaseStmt(pCxt, yymsp[-1].minor.yy437, &yymsp[0].minor.yy929); }
+#line 5496 "sql.c"
         break;
       case 86: /* cmd ::= USE db_name */
 #line 203 "sql.y"
-{ pCxt->pRootNode = createUseDatabaseStmt(pCxt, &yymsp[0].minor.yy993); }
-#line 5499 "sql.c"
+{ pCxt->pRootNode = createUseDatabaseStmt(pCxt, &yymsp[0].minor.yy929); }
+#line 5501 "sql.c"
         break;
       case 87: /* cmd ::= ALTER DATABASE db_name alter_db_options */
 #line 204 "sql.y"
-{ pCxt->pRootNode = createAlterDatabaseStmt(pCxt, &yymsp[-1].minor.yy993, yymsp[0].minor.yy232); }
-#line 5504 "sql.c"
+{ pCxt->pRootNode = createAlterDatabaseStmt(pCxt, &yymsp[-1].minor.yy929, yymsp[0].minor.yy992); }
+#line 5506 "sql.c"
         break;
       case 88: /* cmd ::= FLUSH DATABASE db_name */
 #line 205 "sql.y"
-{ pCxt->pRootNode = createFlushDatabaseStmt(pCxt, &yymsp[0].minor.yy993); }
-#line 5509 "sql.c"
+{ pCxt->pRootNode = createFlushDatabaseStmt(pCxt, &yymsp[0].minor.yy929); }
+#line 5511 "sql.c"
         break;
       case 89: /* cmd ::= TRIM DATABASE db_name speed_opt */
 #line 206 "sql.y"
-{ pCxt->pRootNode = createTrimDatabaseStmt(pCxt, &yymsp[-1].minor.yy993, yymsp[0].minor.yy92); }
-#line 5514 "sql.c"
+{ pCxt->pRootNode = createTrimDatabaseStmt(pCxt, &yymsp[-1].minor.yy929, yymsp[0].minor.yy40); }
+#line 5516 "sql.c"
         break;
       case 90: /* cmd ::= COMPACT DATABASE db_name start_opt end_opt */
 #line 207 "sql.y"
-{ pCxt->pRootNode = createCompactStmt(pCxt, &yymsp[-2].minor.yy993, yymsp[-1].minor.yy232, yymsp[0].minor.yy232); }
-#line 5519 "sql.c"
+{ pCxt->pRootNode = createCompactStmt(pCxt, &yymsp[-2].minor.yy929, yymsp[-1].minor.yy992, yymsp[0].minor.yy992); }
+#line 5521 "sql.c"
         break;
       case 91: /* not_exists_opt ::= IF NOT EXISTS */
 #line 211 "sql.y"
-{ yymsp[-2].minor.yy985 = true; }
-#line 5524 "sql.c"
+{ yymsp[-2].minor.yy437 = true; }
+#line 5526 "sql.c"
         break;
       case 93: /* exists_opt ::= IF EXISTS */
-      case 359: /* or_replace_opt ::= OR REPLACE */ yytestcase(yyruleno==359);
-      case 385: /* ignore_opt ::= IGNORE UNTREATED */ yytestcase(yyruleno==385);
+      case 362: /* or_replace_opt ::= OR REPLACE */ yytestcase(yyruleno==362);
+      case 388: /* ignore_opt ::= IGNORE UNTREATED */ yytestcase(yyruleno==388);
 #line 216 "sql.y"
-{ yymsp[-1].minor.yy985 = true; }
-#line 5531 "sql.c"
+{ yymsp[-1].minor.yy437 = true; }
+#line 5533 "sql.c"
         break;
       case 95: /* db_options ::= */
 #line 219 "sql.y"
-{ yymsp[1].minor.yy232 = createDefaultDatabaseOptions(pCxt); }
-#line 5536 "sql.c"
+{ yymsp[1].minor.yy992 = createDefaultDatabaseOptions(pCxt); }
+#line 5538 "sql.c"
         break;
       case 96: /* db_options ::= db_options BUFFER NK_INTEGER */
 #line 220 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_BUFFER, &yymsp[0].minor.yy0); }
-#line 5541 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_BUFFER, &yymsp[0].minor.yy0); }
+#line 5543 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 97: /* db_options ::= db_options CACHEMODEL NK_STRING */
 #line 221 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_CACHEMODEL, &yymsp[0].minor.yy0); }
-#line 5547 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_CACHEMODEL, &yymsp[0].minor.yy0); }
+#line 5549 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 98: /* db_options ::= db_options CACHESIZE NK_INTEGER */
 #line 222 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_CACHESIZE, &yymsp[0].minor.yy0); }
-#line 5553 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_CACHESIZE, &yymsp[0].minor.yy0); }
+#line 5555 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 99: /* db_options ::= db_options COMP NK_INTEGER */
 #line 223 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_COMP, &yymsp[0].minor.yy0); }
-#line 5559 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_COMP, &yymsp[0].minor.yy0); }
+#line 5561 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 100: /* db_options ::= db_options DURATION NK_INTEGER */
       case 101: /* db_options ::= db_options DURATION NK_VARIABLE */ yytestcase(yyruleno==101);
 #line 224 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_DAYS, &yymsp[0].minor.yy0); }
-#line 5566 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_DAYS, &yymsp[0].minor.yy0); }
+#line 5568 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 102: /* db_options ::= db_options MAXROWS NK_INTEGER */
 #line 226 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_MAXROWS, &yymsp[0].minor.yy0); }
-#line 5572 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_MAXROWS, &yymsp[0].minor.yy0); }
+#line 5574 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 103: /* db_options ::= db_options MINROWS NK_INTEGER */
 #line 227 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_MINROWS, &yymsp[0].minor.yy0); }
-#line 5578 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_MINROWS, &yymsp[0].minor.yy0); }
+#line 5580 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 104: /* db_options ::= db_options KEEP integer_list */
       case 105: /* db_options ::= db_options KEEP variable_list */ yytestcase(yyruleno==105);
 #line 228 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_KEEP, yymsp[0].minor.yy88); }
-#line 5585 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_KEEP, yymsp[0].minor.yy364); }
+#line 5587 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 106: /* db_options ::= db_options PAGES NK_INTEGER */
 #line 230 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_PAGES, &yymsp[0].minor.yy0); }
-#line 5591 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_PAGES, &yymsp[0].minor.yy0); }
+#line 5593 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 107: /* db_options ::= db_options PAGESIZE NK_INTEGER */
 #line 231 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_PAGESIZE, &yymsp[0].minor.yy0); }
-#line 5597 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_PAGESIZE, &yymsp[0].minor.yy0); }
+#line 5599 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 108: /* db_options ::= db_options TSDB_PAGESIZE NK_INTEGER */
 #line 232 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_TSDB_PAGESIZE, &yymsp[0].minor.yy0); }
-#line 5603 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_TSDB_PAGESIZE, &yymsp[0].minor.yy0); }
+#line 5605 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 109: /* db_options ::= db_options PRECISION NK_STRING */
 #line 233 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_PRECISION, &yymsp[0].minor.yy0); }
-#line 5609 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_PRECISION, &yymsp[0].minor.yy0); }
+#line 5611 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 110: /* db_options ::= db_options REPLICA NK_INTEGER */
 #line 234 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_REPLICA, &yymsp[0].minor.yy0); }
-#line 5615 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_REPLICA, &yymsp[0].minor.yy0); }
+#line 5617 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 111: /* db_options ::= db_options VGROUPS NK_INTEGER */
 #line 236 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_VGROUPS, &yymsp[0].minor.yy0); }
-#line 5621 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_VGROUPS, &yymsp[0].minor.yy0); }
+#line 5623 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 112: /* db_options ::= db_options SINGLE_STABLE NK_INTEGER */
 #line 237 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_SINGLE_STABLE, &yymsp[0].minor.yy0); }
-#line 5627 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_SINGLE_STABLE, &yymsp[0].minor.yy0); }
+#line 5629 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 113: /* db_options ::= db_options RETENTIONS retention_list */
 #line 238 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_RETENTIONS, yymsp[0].minor.yy88); }
-#line 5633 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_RETENTIONS, yymsp[0].minor.yy364); }
+#line 5635 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 114: /* db_options ::= db_options SCHEMALESS NK_INTEGER */
 #line 239 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_SCHEMALESS, &yymsp[0].minor.yy0); }
-#line 5639 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_SCHEMALESS, &yymsp[0].minor.yy0); }
+#line 5641 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 115: /* db_options ::= db_options WAL_LEVEL NK_INTEGER */
 #line 240 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_WAL, &yymsp[0].minor.yy0); }
-#line 5645 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_WAL, &yymsp[0].minor.yy0); }
+#line 5647 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 116: /* db_options ::= db_options WAL_FSYNC_PERIOD NK_INTEGER */
 #line 241 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_FSYNC, &yymsp[0].minor.yy0); }
-#line 5651 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_FSYNC, &yymsp[0].minor.yy0); }
+#line 5653 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 117: /* db_options ::= db_options WAL_RETENTION_PERIOD NK_INTEGER */
 #line 242 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_WAL_RETENTION_PERIOD, &yymsp[0].minor.yy0); }
-#line 5657 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_WAL_RETENTION_PERIOD, &yymsp[0].minor.yy0); }
+#line 5659 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 118: /* db_options ::= db_options WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
 #line 243 "sql.y"
 {
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
-                                                                                    yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-3].minor.yy232, DB_OPTION_WAL_RETENTION_PERIOD, &t);
+                                                                                    yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-3].minor.yy992, DB_OPTION_WAL_RETENTION_PERIOD, &t);
                                                                                   }
-#line 5667 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
+#line 5669 "sql.c"
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
         break;
       case 119: /* db_options ::= db_options WAL_RETENTION_SIZE NK_INTEGER */
 #line 248 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_WAL_RETENTION_SIZE, &yymsp[0].minor.yy0); }
-#line 5673 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_WAL_RETENTION_SIZE, &yymsp[0].minor.yy0); }
+#line 5675 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 120: /* db_options ::= db_options WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
 #line 249 "sql.y"
 {
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
-                                                                                    yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-3].minor.yy232, DB_OPTION_WAL_RETENTION_SIZE, &t);
+                                                                                    yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-3].minor.yy992, DB_OPTION_WAL_RETENTION_SIZE, &t);
                                                                                   }
-#line 5683 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
+#line 5685 "sql.c"
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
         break;
       case 121: /* db_options ::= db_options WAL_ROLL_PERIOD NK_INTEGER */
 #line 254 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_WAL_ROLL_PERIOD, &yymsp[0].minor.yy0); }
-#line 5689 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_WAL_ROLL_PERIOD, &yymsp[0].minor.yy0); }
+#line 5691 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 122: /* db_options ::= db_options WAL_SEGMENT_SIZE NK_INTEGER */
 #line 255 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_WAL_SEGMENT_SIZE, &yymsp[0].minor.yy0); }
-#line 5695 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_WAL_SEGMENT_SIZE, &yymsp[0].minor.yy0); }
+#line 5697 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
       case 123: /* db_options ::= db_options STT_TRIGGER NK_INTEGER */
 #line 256 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_STT_TRIGGER, &yymsp[0].minor.yy0); }
-#line 5701 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_STT_TRIGGER, &yymsp[0].minor.yy0); }
+#line 5703 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 124: /* db_options ::= db_options TABLE_PREFIX signed */
+      case 124: /* db_options ::= db_options STT_MERGE_POLICY NK_STRING */
 #line 257 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_TABLE_PREFIX, yymsp[0].minor.yy232); }
-#line 5707 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_STT_MERGE_POLICY, &yymsp[0].minor.yy0); }
+#line 5709 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 125: /* db_options ::= db_options TABLE_SUFFIX signed */
+      case 125: /* db_options ::= db_options TABLE_PREFIX signed */
 #line 258 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_TABLE_SUFFIX, yymsp[0].minor.yy232); }
-#line 5713 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_TABLE_PREFIX, yymsp[0].minor.yy992); }
+#line 5715 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 126: /* db_options ::= db_options KEEP_TIME_OFFSET NK_INTEGER */
+      case 126: /* db_options ::= db_options TABLE_SUFFIX signed */
 #line 259 "sql.y"
-{ yylhsminor.yy232 = setDatabaseOption(pCxt, yymsp[-2].minor.yy232, DB_OPTION_KEEP_TIME_OFFSET, &yymsp[0].minor.yy0); }
-#line 5719 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_TABLE_SUFFIX, yymsp[0].minor.yy992); }
+#line 5721 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 127: /* alter_db_options ::= alter_db_option */
-#line 261 "sql.y"
-{ yylhsminor.yy232 = createAlterDatabaseOptions(pCxt); yylhsminor.yy232 = setAlterDatabaseOption(pCxt, yylhsminor.yy232, &yymsp[0].minor.yy117); }
-#line 5725 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
+      case 127: /* db_options ::= db_options KEEP_TIME_OFFSET NK_INTEGER */
+#line 260 "sql.y"
+{ yylhsminor.yy992 = setDatabaseOption(pCxt, yymsp[-2].minor.yy992, DB_OPTION_KEEP_TIME_OFFSET, &yymsp[0].minor.yy0); }
+#line 5727 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 128: /* alter_db_options ::= alter_db_options alter_db_option */
+      case 128: /* alter_db_options ::= alter_db_option */
 #line 262 "sql.y"
-{ yylhsminor.yy232 = setAlterDatabaseOption(pCxt, yymsp[-1].minor.yy232, &yymsp[0].minor.yy117); }
-#line 5731 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = createAlterDatabaseOptions(pCxt); yylhsminor.yy992 = setAlterDatabaseOption(pCxt, yylhsminor.yy992, &yymsp[0].minor.yy665); }
+#line 5733 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
         break;
-      case 129: /* alter_db_option ::= BUFFER NK_INTEGER */
-#line 266 "sql.y"
-{ yymsp[-1].minor.yy117.type = DB_OPTION_BUFFER; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 5737 "sql.c"
+      case 129: /* alter_db_options ::= alter_db_options alter_db_option */
+#line 263 "sql.y"
+{ yylhsminor.yy992 = setAlterDatabaseOption(pCxt, yymsp[-1].minor.yy992, &yymsp[0].minor.yy665); }
+#line 5739 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
         break;
-      case 130: /* alter_db_option ::= CACHEMODEL NK_STRING */
+      case 130: /* alter_db_option ::= BUFFER NK_INTEGER */
 #line 267 "sql.y"
-{ yymsp[-1].minor.yy117.type = DB_OPTION_CACHEMODEL; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 5742 "sql.c"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_BUFFER; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 5745 "sql.c"
         break;
-      case 131: /* alter_db_option ::= CACHESIZE NK_INTEGER */
+      case 131: /* alter_db_option ::= CACHEMODEL NK_STRING */
 #line 268 "sql.y"
-{ yymsp[-1].minor.yy117.type = DB_OPTION_CACHESIZE; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 5747 "sql.c"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_CACHEMODEL; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 5750 "sql.c"
         break;
-      case 132: /* alter_db_option ::= WAL_FSYNC_PERIOD NK_INTEGER */
+      case 132: /* alter_db_option ::= CACHESIZE NK_INTEGER */
 #line 269 "sql.y"
-{ yymsp[-1].minor.yy117.type = DB_OPTION_FSYNC; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 5752 "sql.c"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_CACHESIZE; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 5755 "sql.c"
         break;
-      case 133: /* alter_db_option ::= KEEP integer_list */
-      case 134: /* alter_db_option ::= KEEP variable_list */ yytestcase(yyruleno==134);
+      case 133: /* alter_db_option ::= WAL_FSYNC_PERIOD NK_INTEGER */
 #line 270 "sql.y"
-{ yymsp[-1].minor.yy117.type = DB_OPTION_KEEP; yymsp[-1].minor.yy117.pList = yymsp[0].minor.yy88; }
-#line 5758 "sql.c"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_FSYNC; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 5760 "sql.c"
         break;
-      case 135: /* alter_db_option ::= PAGES NK_INTEGER */
-#line 272 "sql.y"
-{ yymsp[-1].minor.yy117.type = DB_OPTION_PAGES; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 5763 "sql.c"
+      case 134: /* alter_db_option ::= KEEP integer_list */
+      case 135: /* alter_db_option ::= KEEP variable_list */ yytestcase(yyruleno==135);
+#line 271 "sql.y"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_KEEP; yymsp[-1].minor.yy665.pList = yymsp[0].minor.yy364; }
+#line 5766 "sql.c"
         break;
-      case 136: /* alter_db_option ::= REPLICA NK_INTEGER */
+      case 136: /* alter_db_option ::= PAGES NK_INTEGER */
 #line 273 "sql.y"
-{ yymsp[-1].minor.yy117.type = DB_OPTION_REPLICA; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 5768 "sql.c"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_PAGES; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 5771 "sql.c"
         break;
-      case 137: /* alter_db_option ::= WAL_LEVEL NK_INTEGER */
-#line 275 "sql.y"
-{ yymsp[-1].minor.yy117.type = DB_OPTION_WAL; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 5773 "sql.c"
+      case 137: /* alter_db_option ::= REPLICA NK_INTEGER */
+#line 274 "sql.y"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_REPLICA; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 5776 "sql.c"
         break;
-      case 138: /* alter_db_option ::= STT_TRIGGER NK_INTEGER */
+      case 138: /* alter_db_option ::= WAL_LEVEL NK_INTEGER */
 #line 276 "sql.y"
-{ yymsp[-1].minor.yy117.type = DB_OPTION_STT_TRIGGER; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 5778 "sql.c"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_WAL; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 5781 "sql.c"
         break;
-      case 139: /* alter_db_option ::= MINROWS NK_INTEGER */
+      case 139: /* alter_db_option ::= STT_TRIGGER NK_INTEGER */
 #line 277 "sql.y"
-{ yymsp[-1].minor.yy117.type = DB_OPTION_MINROWS; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 5783 "sql.c"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_STT_TRIGGER; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 5786 "sql.c"
         break;
-      case 140: /* alter_db_option ::= WAL_RETENTION_PERIOD NK_INTEGER */
+      case 140: /* alter_db_option ::= STT_MERGE_POLICY NK_STRING */
 #line 278 "sql.y"
-{ yymsp[-1].minor.yy117.type = DB_OPTION_WAL_RETENTION_PERIOD; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 5788 "sql.c"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_STT_MERGE_POLICY; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 5791 "sql.c"
         break;
-      case 141: /* alter_db_option ::= WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
+      case 141: /* alter_db_option ::= MINROWS NK_INTEGER */
 #line 279 "sql.y"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_MINROWS; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 5796 "sql.c"
+        break;
+      case 142: /* alter_db_option ::= WAL_RETENTION_PERIOD NK_INTEGER */
+#line 280 "sql.y"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_WAL_RETENTION_PERIOD; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 5801 "sql.c"
+        break;
+      case 143: /* alter_db_option ::= WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
+#line 281 "sql.y"
 {
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
-                                                                                    yymsp[-2].minor.yy117.type = DB_OPTION_WAL_RETENTION_PERIOD; yymsp[-2].minor.yy117.val = t;
+                                                                                    yymsp[-2].minor.yy665.type = DB_OPTION_WAL_RETENTION_PERIOD; yymsp[-2].minor.yy665.val = t;
                                                                                   }
-#line 5797 "sql.c"
+#line 5810 "sql.c"
         break;
-      case 142: /* alter_db_option ::= WAL_RETENTION_SIZE NK_INTEGER */
-#line 284 "sql.y"
-{ yymsp[-1].minor.yy117.type = DB_OPTION_WAL_RETENTION_SIZE; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 5802 "sql.c"
+      case 144: /* alter_db_option ::= WAL_RETENTION_SIZE NK_INTEGER */
+#line 286 "sql.y"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_WAL_RETENTION_SIZE; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 5815 "sql.c"
         break;
-      case 143: /* alter_db_option ::= WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
-#line 285 "sql.y"
+      case 145: /* alter_db_option ::= WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
+#line 287 "sql.y"
 {
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
-                                                                                    yymsp[-2].minor.yy117.type = DB_OPTION_WAL_RETENTION_SIZE; yymsp[-2].minor.yy117.val = t;
+                                                                                    yymsp[-2].minor.yy665.type = DB_OPTION_WAL_RETENTION_SIZE; yymsp[-2].minor.yy665.val = t;
                                                                                   }
-#line 5811 "sql.c"
-        break;
-      case 144: /* alter_db_option ::= KEEP_TIME_OFFSET NK_INTEGER */
-#line 290 "sql.y"
-{ yymsp[-1].minor.yy117.type = DB_OPTION_KEEP_TIME_OFFSET; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 5816 "sql.c"
-        break;
-      case 145: /* integer_list ::= NK_INTEGER */
-#line 294 "sql.y"
-{ yylhsminor.yy88 = createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
-#line 5821 "sql.c"
-  yymsp[0].minor.yy88 = yylhsminor.yy88;
-        break;
-      case 146: /* integer_list ::= integer_list NK_COMMA NK_INTEGER */
-      case 398: /* dnode_list ::= dnode_list DNODE NK_INTEGER */ yytestcase(yyruleno==398);
-#line 295 "sql.y"
-{ yylhsminor.yy88 = addNodeToList(pCxt, yymsp[-2].minor.yy88, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
-#line 5828 "sql.c"
-  yymsp[-2].minor.yy88 = yylhsminor.yy88;
-        break;
-      case 147: /* variable_list ::= NK_VARIABLE */
-#line 299 "sql.y"
-{ yylhsminor.yy88 = createNodeList(pCxt, createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
+#line 5824 "sql.c"
+        break;
+      case 146: /* alter_db_option ::= KEEP_TIME_OFFSET NK_INTEGER */
+#line 292 "sql.y"
+{ yymsp[-1].minor.yy665.type = DB_OPTION_KEEP_TIME_OFFSET; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 5829 "sql.c"
+        break;
+      case 147: /* integer_list ::= NK_INTEGER */
+#line 296 "sql.y"
+{ yylhsminor.yy364 = createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
 #line 5834 "sql.c"
-  yymsp[0].minor.yy88 = yylhsminor.yy88;
-        break;
-      case 148: /* variable_list ::= variable_list NK_COMMA NK_VARIABLE */
-#line 300 "sql.y"
-{ yylhsminor.yy88 = addNodeToList(pCxt, yymsp[-2].minor.yy88, createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
-#line 5840 "sql.c"
-  yymsp[-2].minor.yy88 = yylhsminor.yy88;
-        break;
-      case 149: /* retention_list ::= retention */
-      case 180: /* multi_create_clause ::= create_subtable_clause */ yytestcase(yyruleno==180);
-      case 183: /* multi_drop_clause ::= drop_table_clause */ yytestcase(yyruleno==183);
-      case 190: /* column_def_list ::= column_def */ yytestcase(yyruleno==190);
-      case 234: /* rollup_func_list ::= rollup_func_name */ yytestcase(yyruleno==234);
-      case 239: /* col_name_list ::= col_name */ yytestcase(yyruleno==239);
-      case 303: /* tag_list_opt ::= tag_item */ yytestcase(yyruleno==303);
-      case 320: /* func_list ::= func */ yytestcase(yyruleno==320);
-      case 427: /* literal_list ::= signed_literal */ yytestcase(yyruleno==427);
-      case 498: /* other_para_list ::= star_func_para */ yytestcase(yyruleno==498);
-      case 504: /* when_then_list ::= when_then_expr */ yytestcase(yyruleno==504);
-      case 563: /* select_list ::= select_item */ yytestcase(yyruleno==563);
-      case 574: /* partition_list ::= partition_item */ yytestcase(yyruleno==574);
-      case 633: /* sort_specification_list ::= sort_specification */ yytestcase(yyruleno==633);
-#line 304 "sql.y"
-{ yylhsminor.yy88 = createNodeList(pCxt, yymsp[0].minor.yy232); }
-#line 5859 "sql.c"
-  yymsp[0].minor.yy88 = yylhsminor.yy88;
-        break;
-      case 150: /* retention_list ::= retention_list NK_COMMA retention */
-      case 184: /* multi_drop_clause ::= multi_drop_clause NK_COMMA drop_table_clause */ yytestcase(yyruleno==184);
-      case 191: /* column_def_list ::= column_def_list NK_COMMA column_def */ yytestcase(yyruleno==191);
-      case 235: /* rollup_func_list ::= rollup_func_list NK_COMMA rollup_func_name */ yytestcase(yyruleno==235);
-      case 240: /* col_name_list ::= col_name_list NK_COMMA col_name */ yytestcase(yyruleno==240);
-      case 304: /* tag_list_opt ::= tag_list_opt NK_COMMA tag_item */ yytestcase(yyruleno==304);
-      case 321: /* func_list ::= func_list NK_COMMA func */ yytestcase(yyruleno==321);
-      case 428: /* literal_list ::= literal_list NK_COMMA signed_literal */ yytestcase(yyruleno==428);
-      case 499: /* other_para_list ::= other_para_list NK_COMMA star_func_para */ yytestcase(yyruleno==499);
-      case 564: /* select_list ::= select_list NK_COMMA select_item */ yytestcase(yyruleno==564);
-      case 575: /* partition_list ::= partition_list NK_COMMA partition_item */ yytestcase(yyruleno==575);
-      case 634: /* sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */ yytestcase(yyruleno==634);
-#line 305 "sql.y"
-{ yylhsminor.yy88 = addNodeToList(pCxt, yymsp[-2].minor.yy88, yymsp[0].minor.yy232); }
-#line 5876 "sql.c"
-  yymsp[-2].minor.yy88 = yylhsminor.yy88;
-        break;
-      case 151: /* retention ::= NK_VARIABLE NK_COLON NK_VARIABLE */
-      case 152: /* retention ::= NK_MINUS NK_COLON NK_VARIABLE */ yytestcase(yyruleno==152);
+  yymsp[0].minor.yy364 = yylhsminor.yy364;
+        break;
+      case 148: /* integer_list ::= integer_list NK_COMMA NK_INTEGER */
+      case 401: /* dnode_list ::= dnode_list DNODE NK_INTEGER */ yytestcase(yyruleno==401);
+#line 297 "sql.y"
+{ yylhsminor.yy364 = addNodeToList(pCxt, yymsp[-2].minor.yy364, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
+#line 5841 "sql.c"
+  yymsp[-2].minor.yy364 = yylhsminor.yy364;
+        break;
+      case 149: /* variable_list ::= NK_VARIABLE */
+#line 301 "sql.y"
+{ yylhsminor.yy364 = createNodeList(pCxt, createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
+#line 5847 "sql.c"
+  yymsp[0].minor.yy364 = yylhsminor.yy364;
+        break;
+      case 150: /* variable_list ::= variable_list NK_COMMA NK_VARIABLE */
+#line 302 "sql.y"
+{ yylhsminor.yy364 = addNodeToList(pCxt, yymsp[-2].minor.yy364, createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
+#line 5853 "sql.c"
+  yymsp[-2].minor.yy364 = yylhsminor.yy364;
+        break;
+      case 151: /* retention_list ::= retention */
+      case 182: /* multi_create_clause ::= create_subtable_clause */ yytestcase(yyruleno==182);
+      case 185: /* multi_drop_clause ::= drop_table_clause */ yytestcase(yyruleno==185);
+      case 192: /* column_def_list ::= column_def */ yytestcase(yyruleno==192);
+      case 237: /* rollup_func_list ::= rollup_func_name */ yytestcase(yyruleno==237);
+      case 242: /* col_name_list ::= col_name */ yytestcase(yyruleno==242);
+      case 306: /* tag_list_opt ::= tag_item */ yytestcase(yyruleno==306);
+      case 323: /* func_list ::= func */ yytestcase(yyruleno==323);
+      case 430: /* literal_list ::= signed_literal */ yytestcase(yyruleno==430);
+      case 501: /* other_para_list ::= star_func_para */ yytestcase(yyruleno==501);
+      case 507: /* when_then_list ::= when_then_expr */ yytestcase(yyruleno==507);
+      case 566: /* select_list ::= select_item */ yytestcase(yyruleno==566);
+      case 577: /* partition_list ::= partition_item */ yytestcase(yyruleno==577);
+      case 636: /* sort_specification_list ::= sort_specification */ yytestcase(yyruleno==636);
+#line 306 "sql.y"
+{ yylhsminor.yy364 = createNodeList(pCxt, yymsp[0].minor.yy992); }
+#line 5872 "sql.c"
+  yymsp[0].minor.yy364 = yylhsminor.yy364;
+        break;
+      case 152: /* retention_list ::= retention_list NK_COMMA retention */
+      case 186: /* multi_drop_clause ::= multi_drop_clause NK_COMMA drop_table_clause */ yytestcase(yyruleno==186);
+      case 193: /* column_def_list ::= column_def_list NK_COMMA column_def */ yytestcase(yyruleno==193);
+      case 238: /* rollup_func_list ::= rollup_func_list NK_COMMA rollup_func_name */ yytestcase(yyruleno==238);
+      case 243: /* col_name_list ::= col_name_list NK_COMMA col_name */ yytestcase(yyruleno==243);
+      case 307: /* tag_list_opt ::= tag_list_opt NK_COMMA tag_item */ yytestcase(yyruleno==307);
+      case 324: /* func_list ::= func_list NK_COMMA func */ yytestcase(yyruleno==324);
+      case 431: /* literal_list ::= literal_list NK_COMMA signed_literal */ yytestcase(yyruleno==431);
+      case 502: /* other_para_list ::= other_para_list NK_COMMA star_func_para */ yytestcase(yyruleno==502);
+      case 567: /* select_list ::= select_list NK_COMMA select_item */ yytestcase(yyruleno==567);
+      case 578: /* partition_list ::= partition_list NK_COMMA partition_item */ yytestcase(yyruleno==578);
+      case 637: /* sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */ yytestcase(yyruleno==637);
 #line 307 "sql.y"
-{ yylhsminor.yy232 = createNodeListNodeEx(pCxt, createDurationValueNode(pCxt, &yymsp[-2].minor.yy0), createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
-#line 5883 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 153: /* speed_opt ::= */
-      case 354: /* bufsize_opt ::= */ yytestcase(yyruleno==354);
-#line 312 "sql.y"
-{ yymsp[1].minor.yy92 = 0; }
-#line 5890 "sql.c"
-        break;
-      case 154: /* speed_opt ::= BWLIMIT NK_INTEGER */
-      case 355: /* bufsize_opt ::= BUFSIZE NK_INTEGER */ yytestcase(yyruleno==355);
-#line 313 "sql.y"
-{ yymsp[-1].minor.yy92 = taosStr2Int32(yymsp[0].minor.yy0.z, NULL, 10); }
+{ yylhsminor.yy364 = addNodeToList(pCxt, yymsp[-2].minor.yy364, yymsp[0].minor.yy992); }
+#line 5889 "sql.c"
+  yymsp[-2].minor.yy364 = yylhsminor.yy364;
+        break;
+      case 153: /* retention ::= NK_VARIABLE NK_COLON NK_VARIABLE */
+      case 154: /* retention ::= NK_MINUS NK_COLON NK_VARIABLE */ yytestcase(yyruleno==154);
+#line 309 "sql.y"
+{ yylhsminor.yy992 = createNodeListNodeEx(pCxt, createDurationValueNode(pCxt, &yymsp[-2].minor.yy0), createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
 #line 5896 "sql.c"
-        break;
-      case 156: /* start_opt ::= START WITH NK_INTEGER */
-      case 160: /* end_opt ::= END WITH NK_INTEGER */ yytestcase(yyruleno==160);
-#line 316 "sql.y"
-{ yymsp[-2].minor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0); }
-#line 5902 "sql.c"
-        break;
-      case 157: /* start_opt ::= START WITH NK_STRING */
-      case 161: /* end_opt ::= END WITH NK_STRING */ yytestcase(yyruleno==161);
-#line 317 "sql.y"
-{ yymsp[-2].minor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0); }
-#line 5908 "sql.c"
-        break;
-      case 158: /* start_opt ::= START WITH TIMESTAMP NK_STRING */
-      case 162: /* end_opt ::= END WITH TIMESTAMP NK_STRING */ yytestcase(yyruleno==162);
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 155: /* speed_opt ::= */
+      case 357: /* bufsize_opt ::= */ yytestcase(yyruleno==357);
+#line 314 "sql.y"
+{ yymsp[1].minor.yy40 = 0; }
+#line 5903 "sql.c"
+        break;
+      case 156: /* speed_opt ::= BWLIMIT NK_INTEGER */
+      case 358: /* bufsize_opt ::= BUFSIZE NK_INTEGER */ yytestcase(yyruleno==358);
+#line 315 "sql.y"
+{ yymsp[-1].minor.yy40 = taosStr2Int32(yymsp[0].minor.yy0.z, NULL, 10); }
+#line 5909 "sql.c"
+        break;
+      case 158: /* start_opt ::= START WITH NK_INTEGER */
+      case 162: /* end_opt ::= END WITH NK_INTEGER */ yytestcase(yyruleno==162);
 #line 318 "sql.y"
-{ yymsp[-3].minor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0); }
-#line 5914 "sql.c"
-        break;
-      case 163: /* cmd ::= CREATE TABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def_opt table_options */
-      case 165: /* cmd ::= CREATE STABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def table_options */ yytestcase(yyruleno==165);
-#line 327 "sql.y"
-{ pCxt->pRootNode = createCreateTableStmt(pCxt, yymsp[-6].minor.yy985, yymsp[-5].minor.yy232, yymsp[-3].minor.yy88, yymsp[-1].minor.yy88, yymsp[0].minor.yy232); }
-#line 5920 "sql.c"
-        break;
-      case 164: /* cmd ::= CREATE TABLE multi_create_clause */
-#line 328 "sql.y"
-{ pCxt->pRootNode = createCreateMultiTableStmt(pCxt, yymsp[0].minor.yy88); }
-#line 5925 "sql.c"
-        break;
-      case 166: /* cmd ::= DROP TABLE multi_drop_clause */
-#line 331 "sql.y"
-{ pCxt->pRootNode = createDropTableStmt(pCxt, yymsp[0].minor.yy88); }
-#line 5930 "sql.c"
-        break;
-      case 167: /* cmd ::= DROP STABLE exists_opt full_table_name */
-#line 332 "sql.y"
-{ pCxt->pRootNode = createDropSuperTableStmt(pCxt, yymsp[-1].minor.yy985, yymsp[0].minor.yy232); }
-#line 5935 "sql.c"
-        break;
-      case 168: /* cmd ::= ALTER TABLE alter_table_clause */
-      case 400: /* cmd ::= query_or_subquery */ yytestcase(yyruleno==400);
-      case 401: /* cmd ::= insert_query */ yytestcase(yyruleno==401);
+{ yymsp[-2].minor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0); }
+#line 5915 "sql.c"
+        break;
+      case 159: /* start_opt ::= START WITH NK_STRING */
+      case 163: /* end_opt ::= END WITH NK_STRING */ yytestcase(yyruleno==163);
+#line 319 "sql.y"
+{ yymsp[-2].minor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0); }
+#line 5921 "sql.c"
+        break;
+      case 160: /* start_opt ::= START WITH TIMESTAMP NK_STRING */
+      case 164: /* end_opt ::= END WITH TIMESTAMP NK_STRING */ yytestcase(yyruleno==164);
+#line 320 "sql.y"
+{ yymsp[-3].minor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0); }
+#line 5927 "sql.c"
+        break;
+      case 165: /* cmd ::= CREATE TABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def_opt table_options */
+      case 167: /* cmd ::= CREATE STABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def table_options */ yytestcase(yyruleno==167);
+#line 329 "sql.y"
+{ pCxt->pRootNode = createCreateTableStmt(pCxt, yymsp[-6].minor.yy437, yymsp[-5].minor.yy992, yymsp[-3].minor.yy364, yymsp[-1].minor.yy364, yymsp[0].minor.yy992); }
+#line 5933 "sql.c"
+        break;
+      case 166: /* cmd ::= CREATE TABLE multi_create_clause */
+#line 330 "sql.y"
+{ pCxt->pRootNode = createCreateMultiTableStmt(pCxt, yymsp[0].minor.yy364); }
+#line 5938 "sql.c"
+        break;
+      case 168: /* cmd ::= DROP TABLE multi_drop_clause */
+#line 333 "sql.y"
+{ pCxt->pRootNode = createDropTableStmt(pCxt, yymsp[0].minor.yy364); }
+#line 5943 "sql.c"
+        break;
+      case 169: /* cmd ::= DROP STABLE exists_opt full_table_name */
 #line 334 "sql.y"
-{ pCxt->pRootNode = yymsp[0].minor.yy232; }
-#line 5942 "sql.c"
+{ pCxt->pRootNode = createDropSuperTableStmt(pCxt, yymsp[-1].minor.yy437, yymsp[0].minor.yy992); }
+#line 5948 "sql.c"
         break;
-      case 169: /* cmd ::= ALTER STABLE alter_table_clause */
-#line 335 "sql.y"
-{ pCxt->pRootNode = setAlterSuperTableType(yymsp[0].minor.yy232); }
-#line 5947 "sql.c"
+      case 170: /* cmd ::= ALTER TABLE alter_table_clause */
+      case 403: /* cmd ::= query_or_subquery */ yytestcase(yyruleno==403);
+      case 404: /* cmd ::= insert_query */ yytestcase(yyruleno==404);
+#line 336 "sql.y"
+{ pCxt->pRootNode = yymsp[0].minor.yy992; }
+#line 5955 "sql.c"
         break;
-      case 170: /* alter_table_clause ::= full_table_name alter_table_options */
+      case 171: /* cmd ::= ALTER STABLE alter_table_clause */
 #line 337 "sql.y"
-{ yylhsminor.yy232 = createAlterTableModifyOptions(pCxt, yymsp[-1].minor.yy232, yymsp[0].minor.yy232); }
-#line 5952 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
+{ pCxt->pRootNode = setAlterSuperTableType(yymsp[0].minor.yy992); }
+#line 5960 "sql.c"
         break;
-      case 171: /* alter_table_clause ::= full_table_name ADD COLUMN column_name type_name */
+      case 172: /* alter_table_clause ::= full_table_name alter_table_options */
 #line 339 "sql.y"
-{ yylhsminor.yy232 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy232, TSDB_ALTER_TABLE_ADD_COLUMN, &yymsp[-1].minor.yy993, yymsp[0].minor.yy400); }
-#line 5958 "sql.c"
-  yymsp[-4].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = createAlterTableModifyOptions(pCxt, yymsp[-1].minor.yy992, yymsp[0].minor.yy992); }
+#line 5965 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
         break;
-      case 172: /* alter_table_clause ::= full_table_name DROP COLUMN column_name */
-#line 340 "sql.y"
-{ yylhsminor.yy232 = createAlterTableDropCol(pCxt, yymsp[-3].minor.yy232, TSDB_ALTER_TABLE_DROP_COLUMN, &yymsp[0].minor.yy993); }
-#line 5964 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
+      case 173: /* alter_table_clause ::= full_table_name ADD COLUMN column_name type_name */
+#line 341 "sql.y"
+{ yylhsminor.yy992 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy992, TSDB_ALTER_TABLE_ADD_COLUMN, &yymsp[-1].minor.yy929, yymsp[0].minor.yy184); }
+#line 5971 "sql.c"
+  yymsp[-4].minor.yy992 = yylhsminor.yy992;
         break;
-      case 173: /* alter_table_clause ::= full_table_name MODIFY COLUMN column_name type_name */
+      case 174: /* alter_table_clause ::= full_table_name DROP COLUMN column_name */
 #line 342 "sql.y"
-{ yylhsminor.yy232 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy232, TSDB_ALTER_TABLE_UPDATE_COLUMN_BYTES, &yymsp[-1].minor.yy993, yymsp[0].minor.yy400); }
-#line 5970 "sql.c"
-  yymsp[-4].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = createAlterTableDropCol(pCxt, yymsp[-3].minor.yy992, TSDB_ALTER_TABLE_DROP_COLUMN, &yymsp[0].minor.yy929); }
+#line 5977 "sql.c"
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
         break;
-      case 174: /* alter_table_clause ::= full_table_name RENAME COLUMN column_name column_name */
+      case 175: /* alter_table_clause ::= full_table_name MODIFY COLUMN column_name type_name */
 #line 344 "sql.y"
-{ yylhsminor.yy232 = createAlterTableRenameCol(pCxt, yymsp[-4].minor.yy232, TSDB_ALTER_TABLE_UPDATE_COLUMN_NAME, &yymsp[-1].minor.yy993, &yymsp[0].minor.yy993); }
-#line 5976 "sql.c"
-  yymsp[-4].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy992, TSDB_ALTER_TABLE_UPDATE_COLUMN_BYTES, &yymsp[-1].minor.yy929, yymsp[0].minor.yy184); }
+#line 5983 "sql.c"
+  yymsp[-4].minor.yy992 = yylhsminor.yy992;
         break;
-      case 175: /* alter_table_clause ::= full_table_name ADD TAG column_name type_name */
+      case 176: /* alter_table_clause ::= full_table_name RENAME COLUMN column_name column_name */
 #line 346 "sql.y"
-{ yylhsminor.yy232 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy232, TSDB_ALTER_TABLE_ADD_TAG, &yymsp[-1].minor.yy993, yymsp[0].minor.yy400); }
-#line 5982 "sql.c"
-  yymsp[-4].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = createAlterTableRenameCol(pCxt, yymsp[-4].minor.yy992, TSDB_ALTER_TABLE_UPDATE_COLUMN_NAME, &yymsp[-1].minor.yy929, &yymsp[0].minor.yy929); }
+#line 5989 "sql.c"
+  yymsp[-4].minor.yy992 = yylhsminor.yy992;
         break;
-      case 176: /* alter_table_clause ::= full_table_name DROP TAG column_name */
-#line 347 "sql.y"
-{ yylhsminor.yy232 = createAlterTableDropCol(pCxt, yymsp[-3].minor.yy232, TSDB_ALTER_TABLE_DROP_TAG, &yymsp[0].minor.yy993); }
-#line 5988 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
+      case 177: /* alter_table_clause ::= full_table_name ADD TAG column_name type_name */
+#line 348 "sql.y"
+{ yylhsminor.yy992 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy992, TSDB_ALTER_TABLE_ADD_TAG, &yymsp[-1].minor.yy929, yymsp[0].minor.yy184); }
+#line 5995 "sql.c"
+  yymsp[-4].minor.yy992 = yylhsminor.yy992;
         break;
-      case 177: /* alter_table_clause ::= full_table_name MODIFY TAG column_name type_name */
+      case 178: /* alter_table_clause ::= full_table_name DROP TAG column_name */
 #line 349 "sql.y"
-{ yylhsminor.yy232 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy232, TSDB_ALTER_TABLE_UPDATE_TAG_BYTES, &yymsp[-1].minor.yy993, yymsp[0].minor.yy400); }
-#line 5994 "sql.c"
-  yymsp[-4].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = createAlterTableDropCol(pCxt, yymsp[-3].minor.yy992, TSDB_ALTER_TABLE_DROP_TAG, &yymsp[0].minor.yy929); }
+#line 6001 "sql.c"
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
         break;
-      case 178: /* alter_table_clause ::= full_table_name RENAME TAG column_name column_name */
+      case 179: /* alter_table_clause ::= full_table_name MODIFY TAG column_name type_name */
 #line 351 "sql.y"
-{ yylhsminor.yy232 = createAlterTableRenameCol(pCxt, yymsp[-4].minor.yy232, TSDB_ALTER_TABLE_UPDATE_TAG_NAME, &yymsp[-1].minor.yy993, &yymsp[0].minor.yy993); }
-#line 6000 "sql.c"
-  yymsp[-4].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy992, TSDB_ALTER_TABLE_UPDATE_TAG_BYTES, &yymsp[-1].minor.yy929, yymsp[0].minor.yy184); }
+#line 6007 "sql.c"
+  yymsp[-4].minor.yy992 = yylhsminor.yy992;
         break;
-      case 179: /* alter_table_clause ::= full_table_name SET TAG column_name NK_EQ signed_literal */
+      case 180: /* alter_table_clause ::= full_table_name RENAME TAG column_name column_name */
 #line 353 "sql.y"
-{ yylhsminor.yy232 = createAlterTableSetTag(pCxt, yymsp[-5].minor.yy232, &yymsp[-2].minor.yy993, yymsp[0].minor.yy232); }
-#line 6006 "sql.c"
-  yymsp[-5].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 181: /* multi_create_clause ::= multi_create_clause create_subtable_clause */
-      case 505: /* when_then_list ::= when_then_list when_then_expr */ yytestcase(yyruleno==505);
-#line 358 "sql.y"
-{ yylhsminor.yy88 = addNodeToList(pCxt, yymsp[-1].minor.yy88, yymsp[0].minor.yy232); }
+{ yylhsminor.yy992 = createAlterTableRenameCol(pCxt, yymsp[-4].minor.yy992, TSDB_ALTER_TABLE_UPDATE_TAG_NAME, &yymsp[-1].minor.yy929, &yymsp[0].minor.yy929); }
 #line 6013 "sql.c"
-  yymsp[-1].minor.yy88 = yylhsminor.yy88;
+  yymsp[-4].minor.yy992 = yylhsminor.yy992;
         break;
-      case 182: /* create_subtable_clause ::= not_exists_opt full_table_name USING full_table_name specific_cols_opt TAGS NK_LP expression_list NK_RP table_options */
-#line 362 "sql.y"
-{ yylhsminor.yy232 = createCreateSubTableClause(pCxt, yymsp[-9].minor.yy985, yymsp[-8].minor.yy232, yymsp[-6].minor.yy232, yymsp[-5].minor.yy88, yymsp[-2].minor.yy88, yymsp[0].minor.yy232); }
+      case 181: /* alter_table_clause ::= full_table_name SET TAG column_name NK_EQ signed_literal */
+#line 355 "sql.y"
+{ yylhsminor.yy992 = createAlterTableSetTag(pCxt, yymsp[-5].minor.yy992, &yymsp[-2].minor.yy929, yymsp[0].minor.yy992); }
 #line 6019 "sql.c"
-  yymsp[-9].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 185: /* drop_table_clause ::= exists_opt full_table_name */
-#line 369 "sql.y"
-{ yylhsminor.yy232 = createDropTableClause(pCxt, yymsp[-1].minor.yy985, yymsp[0].minor.yy232); }
-#line 6025 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 187: /* specific_cols_opt ::= NK_LP col_name_list NK_RP */
-      case 369: /* col_list_opt ::= NK_LP col_name_list NK_RP */ yytestcase(yyruleno==369);
-#line 374 "sql.y"
-{ yymsp[-2].minor.yy88 = yymsp[-1].minor.yy88; }
+  yymsp[-5].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 183: /* multi_create_clause ::= multi_create_clause create_subtable_clause */
+      case 508: /* when_then_list ::= when_then_list when_then_expr */ yytestcase(yyruleno==508);
+#line 360 "sql.y"
+{ yylhsminor.yy364 = addNodeToList(pCxt, yymsp[-1].minor.yy364, yymsp[0].minor.yy992); }
+#line 6026 "sql.c"
+  yymsp[-1].minor.yy364 = yylhsminor.yy364;
+        break;
+      case 184: /* create_subtable_clause ::= not_exists_opt full_table_name USING full_table_name specific_cols_opt TAGS NK_LP expression_list NK_RP table_options */
+#line 364 "sql.y"
+{ yylhsminor.yy992 = createCreateSubTableClause(pCxt, yymsp[-9].minor.yy437, yymsp[-8].minor.yy992, yymsp[-6].minor.yy992, yymsp[-5].minor.yy364, yymsp[-2].minor.yy364, yymsp[0].minor.yy992); }
 #line 6032 "sql.c"
+  yymsp[-9].minor.yy992 = yylhsminor.yy992;
         break;
-      case 188: /* full_table_name ::= table_name */
-#line 376 "sql.y"
-{ yylhsminor.yy232 = createRealTableNode(pCxt, NULL, &yymsp[0].minor.yy993, NULL); }
-#line 6037 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 189: /* full_table_name ::= db_name NK_DOT table_name */
-#line 377 "sql.y"
-{ yylhsminor.yy232 = createRealTableNode(pCxt, &yymsp[-2].minor.yy993, &yymsp[0].minor.yy993, NULL); }
-#line 6043 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 192: /* column_def ::= column_name type_name */
-#line 384 "sql.y"
-{ yylhsminor.yy232 = createColumnDefNode(pCxt, &yymsp[-1].minor.yy993, yymsp[0].minor.yy400, NULL); }
-#line 6049 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 193: /* type_name ::= BOOL */
-#line 389 "sql.y"
-{ yymsp[0].minor.yy400 = createDataType(TSDB_DATA_TYPE_BOOL); }
-#line 6055 "sql.c"
-        break;
-      case 194: /* type_name ::= TINYINT */
-#line 390 "sql.y"
-{ yymsp[0].minor.yy400 = createDataType(TSDB_DATA_TYPE_TINYINT); }
-#line 6060 "sql.c"
+      case 187: /* drop_table_clause ::= exists_opt full_table_name */
+#line 371 "sql.y"
+{ yylhsminor.yy992 = createDropTableClause(pCxt, yymsp[-1].minor.yy437, yymsp[0].minor.yy992); }
+#line 6038 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
         break;
-      case 195: /* type_name ::= SMALLINT */
+      case 189: /* specific_cols_opt ::= NK_LP col_name_list NK_RP */
+      case 372: /* col_list_opt ::= NK_LP col_name_list NK_RP */ yytestcase(yyruleno==372);
+#line 376 "sql.y"
+{ yymsp[-2].minor.yy364 = yymsp[-1].minor.yy364; }
+#line 6045 "sql.c"
+        break;
+      case 190: /* full_table_name ::= table_name */
+#line 378 "sql.y"
+{ yylhsminor.yy992 = createRealTableNode(pCxt, NULL, &yymsp[0].minor.yy929, NULL); }
+#line 6050 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 191: /* full_table_name ::= db_name NK_DOT table_name */
+#line 379 "sql.y"
+{ yylhsminor.yy992 = createRealTableNode(pCxt, &yymsp[-2].minor.yy929, &yymsp[0].minor.yy929, NULL); }
+#line 6056 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 194: /* column_def ::= column_name type_name */
+#line 386 "sql.y"
+{ yylhsminor.yy992 = createColumnDefNode(pCxt, &yymsp[-1].minor.yy929, yymsp[0].minor.yy184, NULL); }
+#line 6062 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 195: /* type_name ::= BOOL */
 #line 391 "sql.y"
-{ yymsp[0].minor.yy400 = createDataType(TSDB_DATA_TYPE_SMALLINT); }
-#line 6065 "sql.c"
+{ yymsp[0].minor.yy184 = createDataType(TSDB_DATA_TYPE_BOOL); }
+#line 6068 "sql.c"
         break;
-      case 196: /* type_name ::= INT */
-      case 197: /* type_name ::= INTEGER */ yytestcase(yyruleno==197);
+      case 196: /* type_name ::= TINYINT */
 #line 392 "sql.y"
-{ yymsp[0].minor.yy400 = createDataType(TSDB_DATA_TYPE_INT); }
-#line 6071 "sql.c"
+{ yymsp[0].minor.yy184 = createDataType(TSDB_DATA_TYPE_TINYINT); }
+#line 6073 "sql.c"
         break;
-      case 198: /* type_name ::= BIGINT */
-#line 394 "sql.y"
-{ yymsp[0].minor.yy400 = createDataType(TSDB_DATA_TYPE_BIGINT); }
-#line 6076 "sql.c"
+      case 197: /* type_name ::= SMALLINT */
+#line 393 "sql.y"
+{ yymsp[0].minor.yy184 = createDataType(TSDB_DATA_TYPE_SMALLINT); }
+#line 6078 "sql.c"
         break;
-      case 199: /* type_name ::= FLOAT */
-#line 395 "sql.y"
-{ yymsp[0].minor.yy400 = createDataType(TSDB_DATA_TYPE_FLOAT); }
-#line 6081 "sql.c"
+      case 198: /* type_name ::= INT */
+      case 199: /* type_name ::= INTEGER */ yytestcase(yyruleno==199);
+#line 394 "sql.y"
+{ yymsp[0].minor.yy184 = createDataType(TSDB_DATA_TYPE_INT); }
+#line 6084 "sql.c"
         break;
-      case 200: /* type_name ::= DOUBLE */
+      case 200: /* type_name ::= BIGINT */
 #line 396 "sql.y"
-{ yymsp[0].minor.yy400 = createDataType(TSDB_DATA_TYPE_DOUBLE); }
-#line 6086 "sql.c"
+{ yymsp[0].minor.yy184 = createDataType(TSDB_DATA_TYPE_BIGINT); }
+#line 6089 "sql.c"
         break;
-      case 201: /* type_name ::= BINARY NK_LP NK_INTEGER NK_RP */
+      case 201: /* type_name ::= FLOAT */
 #line 397 "sql.y"
-{ yymsp[-3].minor.yy400 = createVarLenDataType(TSDB_DATA_TYPE_BINARY, &yymsp[-1].minor.yy0); }
-#line 6091 "sql.c"
+{ yymsp[0].minor.yy184 = createDataType(TSDB_DATA_TYPE_FLOAT); }
+#line 6094 "sql.c"
         break;
-      case 202: /* type_name ::= TIMESTAMP */
+      case 202: /* type_name ::= DOUBLE */
 #line 398 "sql.y"
-{ yymsp[0].minor.yy400 = createDataType(TSDB_DATA_TYPE_TIMESTAMP); }
-#line 6096 "sql.c"
+{ yymsp[0].minor.yy184 = createDataType(TSDB_DATA_TYPE_DOUBLE); }
+#line 6099 "sql.c"
         break;
-      case 203: /* type_name ::= NCHAR NK_LP NK_INTEGER NK_RP */
+      case 203: /* type_name ::= BINARY NK_LP NK_INTEGER NK_RP */
 #line 399 "sql.y"
-{ yymsp[-3].minor.yy400 = createVarLenDataType(TSDB_DATA_TYPE_NCHAR, &yymsp[-1].minor.yy0); }
-#line 6101 "sql.c"
+{ yymsp[-3].minor.yy184 = createVarLenDataType(TSDB_DATA_TYPE_BINARY, &yymsp[-1].minor.yy0); }
+#line 6104 "sql.c"
         break;
-      case 204: /* type_name ::= TINYINT UNSIGNED */
+      case 204: /* type_name ::= TIMESTAMP */
 #line 400 "sql.y"
-{ yymsp[-1].minor.yy400 = createDataType(TSDB_DATA_TYPE_UTINYINT); }
-#line 6106 "sql.c"
+{ yymsp[0].minor.yy184 = createDataType(TSDB_DATA_TYPE_TIMESTAMP); }
+#line 6109 "sql.c"
         break;
-      case 205: /* type_name ::= SMALLINT UNSIGNED */
+      case 205: /* type_name ::= NCHAR NK_LP NK_INTEGER NK_RP */
 #line 401 "sql.y"
-{ yymsp[-1].minor.yy400 = createDataType(TSDB_DATA_TYPE_USMALLINT); }
-#line 6111 "sql.c"
+{ yymsp[-3].minor.yy184 = createVarLenDataType(TSDB_DATA_TYPE_NCHAR, &yymsp[-1].minor.yy0); }
+#line 6114 "sql.c"
         break;
-      case 206: /* type_name ::= INT UNSIGNED */
+      case 206: /* type_name ::= TINYINT UNSIGNED */
 #line 402 "sql.y"
-{ yymsp[-1].minor.yy400 = createDataType(TSDB_DATA_TYPE_UINT); }
-#line 6116 "sql.c"
+{ yymsp[-1].minor.yy184 = createDataType(TSDB_DATA_TYPE_UTINYINT); }
+#line 6119 "sql.c"
         break;
-      case 207: /* type_name ::= BIGINT UNSIGNED */
+      case 207: /* type_name ::= SMALLINT UNSIGNED */
 #line 403 "sql.y"
-{ yymsp[-1].minor.yy400 = createDataType(TSDB_DATA_TYPE_UBIGINT); }
-#line 6121 "sql.c"
+{ yymsp[-1].minor.yy184 = createDataType(TSDB_DATA_TYPE_USMALLINT); }
+#line 6124 "sql.c"
         break;
-      case 208: /* type_name ::= JSON */
+      case 208: /* type_name ::= INT UNSIGNED */
 #line 404 "sql.y"
-{ yymsp[0].minor.yy400 = createDataType(TSDB_DATA_TYPE_JSON); }
-#line 6126 "sql.c"
+{ yymsp[-1].minor.yy184 = createDataType(TSDB_DATA_TYPE_UINT); }
+#line 6129 "sql.c"
         break;
-      case 209: /* type_name ::= VARCHAR NK_LP NK_INTEGER NK_RP */
+      case 209: /* type_name ::= BIGINT UNSIGNED */
 #line 405 "sql.y"
-{ yymsp[-3].minor.yy400 = createVarLenDataType(TSDB_DATA_TYPE_VARCHAR, &yymsp[-1].minor.yy0); }
-#line 6131 "sql.c"
+{ yymsp[-1].minor.yy184 = createDataType(TSDB_DATA_TYPE_UBIGINT); }
+#line 6134 "sql.c"
         break;
-      case 210: /* type_name ::= MEDIUMBLOB */
+      case 210: /* type_name ::= JSON */
 #line 406 "sql.y"
-{ yymsp[0].minor.yy400 = createDataType(TSDB_DATA_TYPE_MEDIUMBLOB); }
-#line 6136 "sql.c"
+{ yymsp[0].minor.yy184 = createDataType(TSDB_DATA_TYPE_JSON); }
+#line 6139 "sql.c"
         break;
-      case 211: /* type_name ::= BLOB */
+      case 211: /* type_name ::= VARCHAR NK_LP NK_INTEGER NK_RP */
 #line 407 "sql.y"
-{ yymsp[0].minor.yy400 = createDataType(TSDB_DATA_TYPE_BLOB); }
-#line 6141 "sql.c"
+{ yymsp[-3].minor.yy184 = createVarLenDataType(TSDB_DATA_TYPE_VARCHAR, &yymsp[-1].minor.yy0); }
+#line 6144 "sql.c"
         break;
-      case 212: /* type_name ::= VARBINARY NK_LP NK_INTEGER NK_RP */
+      case 212: /* type_name ::= MEDIUMBLOB */
 #line 408 "sql.y"
-{ yymsp[-3].minor.yy400 = createVarLenDataType(TSDB_DATA_TYPE_VARBINARY, &yymsp[-1].minor.yy0); }
-#line 6146 "sql.c"
+{ yymsp[0].minor.yy184 = createDataType(TSDB_DATA_TYPE_MEDIUMBLOB); }
+#line 6149 "sql.c"
         break;
-      case 213: /* type_name ::= GEOMETRY NK_LP NK_INTEGER NK_RP */
+      case 213: /* type_name ::= BLOB */
 #line 409 "sql.y"
-{ yymsp[-3].minor.yy400 = createVarLenDataType(TSDB_DATA_TYPE_GEOMETRY, &yymsp[-1].minor.yy0); }
-#line 6151 "sql.c"
+{ yymsp[0].minor.yy184 = createDataType(TSDB_DATA_TYPE_BLOB); }
+#line 6154 "sql.c"
         break;
-      case 214: /* type_name ::= DECIMAL */
+      case 214: /* type_name ::= VARBINARY NK_LP NK_INTEGER NK_RP */
 #line 410 "sql.y"
-{ yymsp[0].minor.yy400 = createDataType(TSDB_DATA_TYPE_DECIMAL); }
-#line 6156 "sql.c"
+{ yymsp[-3].minor.yy184 = createVarLenDataType(TSDB_DATA_TYPE_VARBINARY, &yymsp[-1].minor.yy0); }
+#line 6159 "sql.c"
         break;
-      case 215: /* type_name ::= DECIMAL NK_LP NK_INTEGER NK_RP */
+      case 215: /* type_name ::= GEOMETRY NK_LP NK_INTEGER NK_RP */
 #line 411 "sql.y"
-{ yymsp[-3].minor.yy400 = createDataType(TSDB_DATA_TYPE_DECIMAL); }
-#line 6161 "sql.c"
+{ yymsp[-3].minor.yy184 = createVarLenDataType(TSDB_DATA_TYPE_GEOMETRY, &yymsp[-1].minor.yy0); }
+#line 6164 "sql.c"
         break;
-      case 216: /* type_name ::= DECIMAL NK_LP NK_INTEGER NK_COMMA NK_INTEGER NK_RP */
+      case 216: /* type_name ::= DECIMAL */
 #line 412 "sql.y"
-{ yymsp[-5].minor.yy400 = createDataType(TSDB_DATA_TYPE_DECIMAL); }
-#line 6166 "sql.c"
+{ yymsp[0].minor.yy184 = createDataType(TSDB_DATA_TYPE_DECIMAL); }
+#line 6169 "sql.c"
         break;
-      case 219: /* tags_def ::= TAGS NK_LP column_def_list NK_RP */
-      case 372: /* tag_def_or_ref_opt ::= TAGS NK_LP col_name_list NK_RP */ yytestcase(yyruleno==372);
-#line 421 "sql.y"
-{ yymsp[-3].minor.yy88 = yymsp[-1].minor.yy88; }
-#line 6172 "sql.c"
+      case 217: /* type_name ::= DECIMAL NK_LP NK_INTEGER NK_RP */
+#line 413 "sql.y"
+{ yymsp[-3].minor.yy184 = createDataType(TSDB_DATA_TYPE_DECIMAL); }
+#line 6174 "sql.c"
         break;
-      case 220: /* table_options ::= */
-#line 423 "sql.y"
-{ yymsp[1].minor.yy232 = createDefaultTableOptions(pCxt); }
-#line 6177 "sql.c"
+      case 218: /* type_name ::= DECIMAL NK_LP NK_INTEGER NK_COMMA NK_INTEGER NK_RP */
+#line 414 "sql.y"
+{ yymsp[-5].minor.yy184 = createDataType(TSDB_DATA_TYPE_DECIMAL); }
+#line 6179 "sql.c"
         break;
-      case 221: /* table_options ::= table_options COMMENT NK_STRING */
-#line 424 "sql.y"
-{ yylhsminor.yy232 = setTableOption(pCxt, yymsp[-2].minor.yy232, TABLE_OPTION_COMMENT, &yymsp[0].minor.yy0); }
-#line 6182 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+      case 221: /* tags_def ::= TAGS NK_LP column_def_list NK_RP */
+      case 375: /* tag_def_or_ref_opt ::= TAGS NK_LP col_name_list NK_RP */ yytestcase(yyruleno==375);
+#line 423 "sql.y"
+{ yymsp[-3].minor.yy364 = yymsp[-1].minor.yy364; }
+#line 6185 "sql.c"
         break;
-      case 222: /* table_options ::= table_options MAX_DELAY duration_list */
+      case 222: /* table_options ::= */
 #line 425 "sql.y"
-{ yylhsminor.yy232 = setTableOption(pCxt, yymsp[-2].minor.yy232, TABLE_OPTION_MAXDELAY, yymsp[0].minor.yy88); }
-#line 6188 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yymsp[1].minor.yy992 = createDefaultTableOptions(pCxt); }
+#line 6190 "sql.c"
         break;
-      case 223: /* table_options ::= table_options WATERMARK duration_list */
+      case 223: /* table_options ::= table_options COMMENT NK_STRING */
 #line 426 "sql.y"
-{ yylhsminor.yy232 = setTableOption(pCxt, yymsp[-2].minor.yy232, TABLE_OPTION_WATERMARK, yymsp[0].minor.yy88); }
-#line 6194 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setTableOption(pCxt, yymsp[-2].minor.yy992, TABLE_OPTION_COMMENT, &yymsp[0].minor.yy0); }
+#line 6195 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 224: /* table_options ::= table_options ROLLUP NK_LP rollup_func_list NK_RP */
+      case 224: /* table_options ::= table_options MAX_DELAY duration_list */
 #line 427 "sql.y"
-{ yylhsminor.yy232 = setTableOption(pCxt, yymsp[-4].minor.yy232, TABLE_OPTION_ROLLUP, yymsp[-1].minor.yy88); }
-#line 6200 "sql.c"
-  yymsp[-4].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setTableOption(pCxt, yymsp[-2].minor.yy992, TABLE_OPTION_MAXDELAY, yymsp[0].minor.yy364); }
+#line 6201 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 225: /* table_options ::= table_options TTL NK_INTEGER */
+      case 225: /* table_options ::= table_options WATERMARK duration_list */
 #line 428 "sql.y"
-{ yylhsminor.yy232 = setTableOption(pCxt, yymsp[-2].minor.yy232, TABLE_OPTION_TTL, &yymsp[0].minor.yy0); }
-#line 6206 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setTableOption(pCxt, yymsp[-2].minor.yy992, TABLE_OPTION_WATERMARK, yymsp[0].minor.yy364); }
+#line 6207 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 226: /* table_options ::= table_options SMA NK_LP col_name_list NK_RP */
+      case 226: /* table_options ::= table_options ROLLUP NK_LP rollup_func_list NK_RP */
 #line 429 "sql.y"
-{ yylhsminor.yy232 = setTableOption(pCxt, yymsp[-4].minor.yy232, TABLE_OPTION_SMA, yymsp[-1].minor.yy88); }
-#line 6212 "sql.c"
-  yymsp[-4].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setTableOption(pCxt, yymsp[-4].minor.yy992, TABLE_OPTION_ROLLUP, yymsp[-1].minor.yy364); }
+#line 6213 "sql.c"
+  yymsp[-4].minor.yy992 = yylhsminor.yy992;
         break;
-      case 227: /* table_options ::= table_options DELETE_MARK duration_list */
+      case 227: /* table_options ::= table_options TTL NK_INTEGER */
 #line 430 "sql.y"
-{ yylhsminor.yy232 = setTableOption(pCxt, yymsp[-2].minor.yy232, TABLE_OPTION_DELETE_MARK, yymsp[0].minor.yy88); }
-#line 6218 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setTableOption(pCxt, yymsp[-2].minor.yy992, TABLE_OPTION_TTL, &yymsp[0].minor.yy0); }
+#line 6219 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 228: /* table_options ::= table_options SMA NK_LP col_name_list NK_RP */
+#line 431 "sql.y"
+{ yylhsminor.yy992 = setTableOption(pCxt, yymsp[-4].minor.yy992, TABLE_OPTION_SMA, yymsp[-1].minor.yy364); }
+#line 6225 "sql.c"
+  yymsp[-4].minor.yy992 = yylhsminor.yy992;
         break;
-      case 228: /* alter_table_options ::= alter_table_option */
+      case 229: /* table_options ::= table_options BLOOM_FILTER NK_LP col_name_list NK_RP */
 #line 432 "sql.y"
-{ yylhsminor.yy232 = createAlterTableOptions(pCxt); yylhsminor.yy232 = setTableOption(pCxt, yylhsminor.yy232, yymsp[0].minor.yy117.type, &yymsp[0].minor.yy117.val); }
-#line 6224 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setTableOption(pCxt, yymsp[-4].minor.yy992, TABLE_OPTION_BLOOM_FILTER, yymsp[-1].minor.yy364); }
+#line 6231 "sql.c"
+  yymsp[-4].minor.yy992 = yylhsminor.yy992;
         break;
-      case 229: /* alter_table_options ::= alter_table_options alter_table_option */
+      case 230: /* table_options ::= table_options DELETE_MARK duration_list */
 #line 433 "sql.y"
-{ yylhsminor.yy232 = setTableOption(pCxt, yymsp[-1].minor.yy232, yymsp[0].minor.yy117.type, &yymsp[0].minor.yy117.val); }
-#line 6230 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 230: /* alter_table_option ::= COMMENT NK_STRING */
-#line 437 "sql.y"
-{ yymsp[-1].minor.yy117.type = TABLE_OPTION_COMMENT; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 6236 "sql.c"
-        break;
-      case 231: /* alter_table_option ::= TTL NK_INTEGER */
-#line 438 "sql.y"
-{ yymsp[-1].minor.yy117.type = TABLE_OPTION_TTL; yymsp[-1].minor.yy117.val = yymsp[0].minor.yy0; }
-#line 6241 "sql.c"
-        break;
-      case 232: /* duration_list ::= duration_literal */
-      case 459: /* expression_list ::= expr_or_subquery */ yytestcase(yyruleno==459);
-#line 442 "sql.y"
-{ yylhsminor.yy88 = createNodeList(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy232)); }
-#line 6247 "sql.c"
-  yymsp[0].minor.yy88 = yylhsminor.yy88;
-        break;
-      case 233: /* duration_list ::= duration_list NK_COMMA duration_literal */
-      case 460: /* expression_list ::= expression_list NK_COMMA expr_or_subquery */ yytestcase(yyruleno==460);
-#line 443 "sql.y"
-{ yylhsminor.yy88 = addNodeToList(pCxt, yymsp[-2].minor.yy88, releaseRawExprNode(pCxt, yymsp[0].minor.yy232)); }
-#line 6254 "sql.c"
-  yymsp[-2].minor.yy88 = yylhsminor.yy88;
-        break;
-      case 236: /* rollup_func_name ::= function_name */
-#line 450 "sql.y"
-{ yylhsminor.yy232 = createFunctionNode(pCxt, &yymsp[0].minor.yy993, NULL); }
+{ yylhsminor.yy992 = setTableOption(pCxt, yymsp[-2].minor.yy992, TABLE_OPTION_DELETE_MARK, yymsp[0].minor.yy364); }
+#line 6237 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 231: /* alter_table_options ::= alter_table_option */
+#line 435 "sql.y"
+{ yylhsminor.yy992 = createAlterTableOptions(pCxt); yylhsminor.yy992 = setTableOption(pCxt, yylhsminor.yy992, yymsp[0].minor.yy665.type, &yymsp[0].minor.yy665.val); }
+#line 6243 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 232: /* alter_table_options ::= alter_table_options alter_table_option */
+#line 436 "sql.y"
+{ yylhsminor.yy992 = setTableOption(pCxt, yymsp[-1].minor.yy992, yymsp[0].minor.yy665.type, &yymsp[0].minor.yy665.val); }
+#line 6249 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 233: /* alter_table_option ::= COMMENT NK_STRING */
+#line 440 "sql.y"
+{ yymsp[-1].minor.yy665.type = TABLE_OPTION_COMMENT; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
+#line 6255 "sql.c"
+        break;
+      case 234: /* alter_table_option ::= TTL NK_INTEGER */
+#line 441 "sql.y"
+{ yymsp[-1].minor.yy665.type = TABLE_OPTION_TTL; yymsp[-1].minor.yy665.val = yymsp[0].minor.yy0; }
 #line 6260 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 237: /* rollup_func_name ::= FIRST */
-      case 238: /* rollup_func_name ::= LAST */ yytestcase(yyruleno==238);
-      case 306: /* tag_item ::= QTAGS */ yytestcase(yyruleno==306);
-#line 451 "sql.y"
-{ yylhsminor.yy232 = createFunctionNode(pCxt, &yymsp[0].minor.yy0, NULL); }
-#line 6268 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 241: /* col_name ::= column_name */
-      case 307: /* tag_item ::= column_name */ yytestcase(yyruleno==307);
-#line 459 "sql.y"
-{ yylhsminor.yy232 = createColumnNode(pCxt, NULL, &yymsp[0].minor.yy993); }
-#line 6275 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 242: /* cmd ::= SHOW DNODES */
+        break;
+      case 235: /* duration_list ::= duration_literal */
+      case 462: /* expression_list ::= expr_or_subquery */ yytestcase(yyruleno==462);
+#line 445 "sql.y"
+{ yylhsminor.yy364 = createNodeList(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy992)); }
+#line 6266 "sql.c"
+  yymsp[0].minor.yy364 = yylhsminor.yy364;
+        break;
+      case 236: /* duration_list ::= duration_list NK_COMMA duration_literal */
+      case 463: /* expression_list ::= expression_list NK_COMMA expr_or_subquery */ yytestcase(yyruleno==463);
+#line 446 "sql.y"
+{ yylhsminor.yy364 = addNodeToList(pCxt, yymsp[-2].minor.yy364, releaseRawExprNode(pCxt, yymsp[0].minor.yy992)); }
+#line 6273 "sql.c"
+  yymsp[-2].minor.yy364 = yylhsminor.yy364;
+        break;
+      case 239: /* rollup_func_name ::= function_name */
+#line 453 "sql.y"
+{ yylhsminor.yy992 = createFunctionNode(pCxt, &yymsp[0].minor.yy929, NULL); }
+#line 6279 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 240: /* rollup_func_name ::= FIRST */
+      case 241: /* rollup_func_name ::= LAST */ yytestcase(yyruleno==241);
+      case 309: /* tag_item ::= QTAGS */ yytestcase(yyruleno==309);
+#line 454 "sql.y"
+{ yylhsminor.yy992 = createFunctionNode(pCxt, &yymsp[0].minor.yy0, NULL); }
+#line 6287 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 244: /* col_name ::= column_name */
+      case 310: /* tag_item ::= column_name */ yytestcase(yyruleno==310);
 #line 462 "sql.y"
+{ yylhsminor.yy992 = createColumnNode(pCxt, NULL, &yymsp[0].minor.yy929); }
+#line 6294 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 245: /* cmd ::= SHOW DNODES */
+#line 465 "sql.y"
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_DNODES_STMT); }
-#line 6281 "sql.c"
+#line 6300 "sql.c"
         break;
-      case 243: /* cmd ::= SHOW USERS */
-#line 463 "sql.y"
+      case 246: /* cmd ::= SHOW USERS */
+#line 466 "sql.y"
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_USERS_STMT); }
-#line 6286 "sql.c"
+#line 6305 "sql.c"
         break;
-      case 244: /* cmd ::= SHOW USER PRIVILEGES */
-#line 464 "sql.y"
+      case 247: /* cmd ::= SHOW USER PRIVILEGES */
+#line 467 "sql.y"
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_USER_PRIVILEGES_STMT); }
-#line 6291 "sql.c"
+#line 6310 "sql.c"
         break;
-      case 245: /* cmd ::= SHOW db_kind_opt DATABASES */
-#line 465 "sql.y"
+      case 248: /* cmd ::= SHOW db_kind_opt DATABASES */
+#line 468 "sql.y"
 {
                                                                                     pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_DATABASES_STMT);
-                                                                                    setShowKind(pCxt, pCxt->pRootNode, yymsp[-1].minor.yy281);
+                                                                                    setShowKind(pCxt, pCxt->pRootNode, yymsp[-1].minor.yy430);
                                                                                   }
-#line 6299 "sql.c"
+#line 6318 "sql.c"
         break;
-      case 246: /* cmd ::= SHOW table_kind_db_name_cond_opt TABLES like_pattern_opt */
-#line 469 "sql.y"
+      case 249: /* cmd ::= SHOW table_kind_db_name_cond_opt TABLES like_pattern_opt */
+#line 472 "sql.y"
 {
-                                                                                    pCxt->pRootNode = createShowTablesStmt(pCxt, yymsp[-2].minor.yy133, yymsp[0].minor.yy232, OP_TYPE_LIKE);
+                                                                                    pCxt->pRootNode = createShowTablesStmt(pCxt, yymsp[-2].minor.yy277, yymsp[0].minor.yy992, OP_TYPE_LIKE);
                                                                                   }
-#line 6306 "sql.c"
-        break;
-      case 247: /* cmd ::= SHOW db_name_cond_opt STABLES like_pattern_opt */
-#line 472 "sql.y"
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_STABLES_STMT, yymsp[-2].minor.yy232, yymsp[0].minor.yy232, OP_TYPE_LIKE); }
-#line 6311 "sql.c"
+#line 6325 "sql.c"
         break;
-      case 248: /* cmd ::= SHOW db_name_cond_opt VGROUPS */
-#line 473 "sql.y"
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_VGROUPS_STMT, yymsp[-1].minor.yy232, NULL, OP_TYPE_LIKE); }
-#line 6316 "sql.c"
-        break;
-      case 249: /* cmd ::= SHOW MNODES */
-#line 474 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_MNODES_STMT); }
-#line 6321 "sql.c"
+      case 250: /* cmd ::= SHOW db_name_cond_opt STABLES like_pattern_opt */
+#line 475 "sql.y"
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_STABLES_STMT, yymsp[-2].minor.yy992, yymsp[0].minor.yy992, OP_TYPE_LIKE); }
+#line 6330 "sql.c"
         break;
-      case 250: /* cmd ::= SHOW QNODES */
+      case 251: /* cmd ::= SHOW db_name_cond_opt VGROUPS */
 #line 476 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_QNODES_STMT); }
-#line 6326 "sql.c"
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_VGROUPS_STMT, yymsp[-1].minor.yy992, NULL, OP_TYPE_LIKE); }
+#line 6335 "sql.c"
         break;
-      case 251: /* cmd ::= SHOW FUNCTIONS */
+      case 252: /* cmd ::= SHOW MNODES */
 #line 477 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_FUNCTIONS_STMT); }
-#line 6331 "sql.c"
-        break;
-      case 252: /* cmd ::= SHOW INDEXES FROM table_name_cond from_db_opt */
-#line 478 "sql.y"
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_INDEXES_STMT, yymsp[0].minor.yy232, yymsp[-1].minor.yy232, OP_TYPE_EQUAL); }
-#line 6336 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_MNODES_STMT); }
+#line 6340 "sql.c"
         break;
-      case 253: /* cmd ::= SHOW INDEXES FROM db_name NK_DOT table_name */
+      case 253: /* cmd ::= SHOW QNODES */
 #line 479 "sql.y"
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_INDEXES_STMT, createIdentifierValueNode(pCxt, &yymsp[-2].minor.yy993), createIdentifierValueNode(pCxt, &yymsp[0].minor.yy993), OP_TYPE_EQUAL); }
-#line 6341 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_QNODES_STMT); }
+#line 6345 "sql.c"
         break;
-      case 254: /* cmd ::= SHOW STREAMS */
+      case 254: /* cmd ::= SHOW FUNCTIONS */
 #line 480 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_STREAMS_STMT); }
-#line 6346 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_FUNCTIONS_STMT); }
+#line 6350 "sql.c"
         break;
-      case 255: /* cmd ::= SHOW ACCOUNTS */
+      case 255: /* cmd ::= SHOW INDEXES FROM table_name_cond from_db_opt */
 #line 481 "sql.y"
-{ pCxt->errCode = generateSyntaxErrMsg(&pCxt->msgBuf, TSDB_CODE_PAR_EXPRIE_STATEMENT); }
-#line 6351 "sql.c"
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_INDEXES_STMT, yymsp[0].minor.yy992, yymsp[-1].minor.yy992, OP_TYPE_EQUAL); }
+#line 6355 "sql.c"
         break;
-      case 256: /* cmd ::= SHOW APPS */
+      case 256: /* cmd ::= SHOW INDEXES FROM db_name NK_DOT table_name */
 #line 482 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_APPS_STMT); }
-#line 6356 "sql.c"
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_INDEXES_STMT, createIdentifierValueNode(pCxt, &yymsp[-2].minor.yy929), createIdentifierValueNode(pCxt, &yymsp[0].minor.yy929), OP_TYPE_EQUAL); }
+#line 6360 "sql.c"
         break;
-      case 257: /* cmd ::= SHOW CONNECTIONS */
+      case 257: /* cmd ::= SHOW STREAMS */
 #line 483 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_CONNECTIONS_STMT); }
-#line 6361 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_STREAMS_STMT); }
+#line 6365 "sql.c"
         break;
-      case 258: /* cmd ::= SHOW LICENCES */
-      case 259: /* cmd ::= SHOW GRANTS */ yytestcase(yyruleno==259);
+      case 258: /* cmd ::= SHOW ACCOUNTS */
 #line 484 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_LICENCES_STMT); }
-#line 6367 "sql.c"
+{ pCxt->errCode = generateSyntaxErrMsg(&pCxt->msgBuf, TSDB_CODE_PAR_EXPRIE_STATEMENT); }
+#line 6370 "sql.c"
+        break;
+      case 259: /* cmd ::= SHOW APPS */
+#line 485 "sql.y"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_APPS_STMT); }
+#line 6375 "sql.c"
         break;
-      case 260: /* cmd ::= SHOW CREATE DATABASE db_name */
+      case 260: /* cmd ::= SHOW CONNECTIONS */
 #line 486 "sql.y"
-{ pCxt->pRootNode = createShowCreateDatabaseStmt(pCxt, &yymsp[0].minor.yy993); }
-#line 6372 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_CONNECTIONS_STMT); }
+#line 6380 "sql.c"
         break;
-      case 261: /* cmd ::= SHOW CREATE TABLE full_table_name */
+      case 261: /* cmd ::= SHOW LICENCES */
+      case 262: /* cmd ::= SHOW GRANTS */ yytestcase(yyruleno==262);
 #line 487 "sql.y"
-{ pCxt->pRootNode = createShowCreateTableStmt(pCxt, QUERY_NODE_SHOW_CREATE_TABLE_STMT, yymsp[0].minor.yy232); }
-#line 6377 "sql.c"
-        break;
-      case 262: /* cmd ::= SHOW CREATE STABLE full_table_name */
-#line 488 "sql.y"
-{ pCxt->pRootNode = createShowCreateTableStmt(pCxt, QUERY_NODE_SHOW_CREATE_STABLE_STMT, yymsp[0].minor.yy232); }
-#line 6382 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_LICENCES_STMT); }
+#line 6386 "sql.c"
         break;
-      case 263: /* cmd ::= SHOW QUERIES */
+      case 263: /* cmd ::= SHOW CREATE DATABASE db_name */
 #line 489 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_QUERIES_STMT); }
-#line 6387 "sql.c"
+{ pCxt->pRootNode = createShowCreateDatabaseStmt(pCxt, &yymsp[0].minor.yy929); }
+#line 6391 "sql.c"
         break;
-      case 264: /* cmd ::= SHOW SCORES */
+      case 264: /* cmd ::= SHOW CREATE TABLE full_table_name */
 #line 490 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_SCORES_STMT); }
-#line 6392 "sql.c"
+{ pCxt->pRootNode = createShowCreateTableStmt(pCxt, QUERY_NODE_SHOW_CREATE_TABLE_STMT, yymsp[0].minor.yy992); }
+#line 6396 "sql.c"
         break;
-      case 265: /* cmd ::= SHOW TOPICS */
+      case 265: /* cmd ::= SHOW CREATE STABLE full_table_name */
 #line 491 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_TOPICS_STMT); }
-#line 6397 "sql.c"
+{ pCxt->pRootNode = createShowCreateTableStmt(pCxt, QUERY_NODE_SHOW_CREATE_STABLE_STMT, yymsp[0].minor.yy992); }
+#line 6401 "sql.c"
         break;
-      case 266: /* cmd ::= SHOW VARIABLES */
-      case 267: /* cmd ::= SHOW CLUSTER VARIABLES */ yytestcase(yyruleno==267);
+      case 266: /* cmd ::= SHOW QUERIES */
 #line 492 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_VARIABLES_STMT); }
-#line 6403 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_QUERIES_STMT); }
+#line 6406 "sql.c"
+        break;
+      case 267: /* cmd ::= SHOW SCORES */
+#line 493 "sql.y"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_SCORES_STMT); }
+#line 6411 "sql.c"
         break;
-      case 268: /* cmd ::= SHOW LOCAL VARIABLES */
+      case 268: /* cmd ::= SHOW TOPICS */
 #line 494 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_LOCAL_VARIABLES_STMT); }
-#line 6408 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_TOPICS_STMT); }
+#line 6416 "sql.c"
         break;
-      case 269: /* cmd ::= SHOW DNODE NK_INTEGER VARIABLES like_pattern_opt */
+      case 269: /* cmd ::= SHOW VARIABLES */
+      case 270: /* cmd ::= SHOW CLUSTER VARIABLES */ yytestcase(yyruleno==270);
 #line 495 "sql.y"
-{ pCxt->pRootNode = createShowDnodeVariablesStmt(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[-2].minor.yy0), yymsp[0].minor.yy232); }
-#line 6413 "sql.c"
-        break;
-      case 270: /* cmd ::= SHOW BNODES */
-#line 496 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_BNODES_STMT); }
-#line 6418 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_VARIABLES_STMT); }
+#line 6422 "sql.c"
         break;
-      case 271: /* cmd ::= SHOW SNODES */
+      case 271: /* cmd ::= SHOW LOCAL VARIABLES */
 #line 497 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_SNODES_STMT); }
-#line 6423 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_LOCAL_VARIABLES_STMT); }
+#line 6427 "sql.c"
         break;
-      case 272: /* cmd ::= SHOW CLUSTER */
+      case 272: /* cmd ::= SHOW DNODE NK_INTEGER VARIABLES like_pattern_opt */
 #line 498 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_CLUSTER_STMT); }
-#line 6428 "sql.c"
+{ pCxt->pRootNode = createShowDnodeVariablesStmt(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[-2].minor.yy0), yymsp[0].minor.yy992); }
+#line 6432 "sql.c"
         break;
-      case 273: /* cmd ::= SHOW TRANSACTIONS */
+      case 273: /* cmd ::= SHOW BNODES */
 #line 499 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_TRANSACTIONS_STMT); }
-#line 6433 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_BNODES_STMT); }
+#line 6437 "sql.c"
         break;
-      case 274: /* cmd ::= SHOW TABLE DISTRIBUTED full_table_name */
+      case 274: /* cmd ::= SHOW SNODES */
 #line 500 "sql.y"
-{ pCxt->pRootNode = createShowTableDistributedStmt(pCxt, yymsp[0].minor.yy232); }
-#line 6438 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_SNODES_STMT); }
+#line 6442 "sql.c"
         break;
-      case 275: /* cmd ::= SHOW CONSUMERS */
+      case 275: /* cmd ::= SHOW CLUSTER */
 #line 501 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_CONSUMERS_STMT); }
-#line 6443 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_CLUSTER_STMT); }
+#line 6447 "sql.c"
         break;
-      case 276: /* cmd ::= SHOW SUBSCRIPTIONS */
+      case 276: /* cmd ::= SHOW TRANSACTIONS */
 #line 502 "sql.y"
-{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_SUBSCRIPTIONS_STMT); }
-#line 6448 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_TRANSACTIONS_STMT); }
+#line 6452 "sql.c"
         break;
-      case 277: /* cmd ::= SHOW TAGS FROM table_name_cond from_db_opt */
+      case 277: /* cmd ::= SHOW TABLE DISTRIBUTED full_table_name */
 #line 503 "sql.y"
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_TAGS_STMT, yymsp[0].minor.yy232, yymsp[-1].minor.yy232, OP_TYPE_EQUAL); }
-#line 6453 "sql.c"
+{ pCxt->pRootNode = createShowTableDistributedStmt(pCxt, yymsp[0].minor.yy992); }
+#line 6457 "sql.c"
         break;
-      case 278: /* cmd ::= SHOW TAGS FROM db_name NK_DOT table_name */
+      case 278: /* cmd ::= SHOW CONSUMERS */
 #line 504 "sql.y"
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_TAGS_STMT, createIdentifierValueNode(pCxt, &yymsp[-2].minor.yy993), createIdentifierValueNode(pCxt, &yymsp[0].minor.yy993), OP_TYPE_EQUAL); }
-#line 6458 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_CONSUMERS_STMT); }
+#line 6462 "sql.c"
         break;
-      case 279: /* cmd ::= SHOW TABLE TAGS tag_list_opt FROM table_name_cond from_db_opt */
+      case 279: /* cmd ::= SHOW SUBSCRIPTIONS */
 #line 505 "sql.y"
-{ pCxt->pRootNode = createShowTableTagsStmt(pCxt, yymsp[-1].minor.yy232, yymsp[0].minor.yy232, yymsp[-3].minor.yy88); }
-#line 6463 "sql.c"
+{ pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_SUBSCRIPTIONS_STMT); }
+#line 6467 "sql.c"
         break;
-      case 280: /* cmd ::= SHOW TABLE TAGS tag_list_opt FROM db_name NK_DOT table_name */
+      case 280: /* cmd ::= SHOW TAGS FROM table_name_cond from_db_opt */
 #line 506 "sql.y"
-{ pCxt->pRootNode = createShowTableTagsStmt(pCxt, createIdentifierValueNode(pCxt, &yymsp[0].minor.yy993), createIdentifierValueNode(pCxt, &yymsp[-2].minor.yy993), yymsp[-4].minor.yy88); }
-#line 6468 "sql.c"
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_TAGS_STMT, yymsp[0].minor.yy992, yymsp[-1].minor.yy992, OP_TYPE_EQUAL); }
+#line 6472 "sql.c"
         break;
-      case 281: /* cmd ::= SHOW VNODES ON DNODE NK_INTEGER */
+      case 281: /* cmd ::= SHOW TAGS FROM db_name NK_DOT table_name */
 #line 507 "sql.y"
-{ pCxt->pRootNode = createShowVnodesStmt(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0), NULL); }
-#line 6473 "sql.c"
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_TAGS_STMT, createIdentifierValueNode(pCxt, &yymsp[-2].minor.yy929), createIdentifierValueNode(pCxt, &yymsp[0].minor.yy929), OP_TYPE_EQUAL); }
+#line 6477 "sql.c"
         break;
-      case 282: /* cmd ::= SHOW VNODES */
+      case 282: /* cmd ::= SHOW TABLE TAGS tag_list_opt FROM table_name_cond from_db_opt */
 #line 508 "sql.y"
-{ pCxt->pRootNode = createShowVnodesStmt(pCxt, NULL, NULL); }
-#line 6478 "sql.c"
+{ pCxt->pRootNode = createShowTableTagsStmt(pCxt, yymsp[-1].minor.yy992, yymsp[0].minor.yy992, yymsp[-3].minor.yy364); }
+#line 6482 "sql.c"
+        break;
+      case 283: /* cmd ::= SHOW TABLE TAGS tag_list_opt FROM db_name NK_DOT table_name */
+#line 509 "sql.y"
+{ pCxt->pRootNode = createShowTableTagsStmt(pCxt, createIdentifierValueNode(pCxt, &yymsp[0].minor.yy929), createIdentifierValueNode(pCxt, &yymsp[-2].minor.yy929), yymsp[-4].minor.yy364); }
+#line 6487 "sql.c"
         break;
-      case 283: /* cmd ::= SHOW db_name_cond_opt ALIVE */
+      case 284: /* cmd ::= SHOW VNODES ON DNODE NK_INTEGER */
 #line 510 "sql.y"
-{ pCxt->pRootNode = createShowAliveStmt(pCxt, yymsp[-1].minor.yy232,    QUERY_NODE_SHOW_DB_ALIVE_STMT); }
-#line 6483 "sql.c"
+{ pCxt->pRootNode = createShowVnodesStmt(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0), NULL); }
+#line 6492 "sql.c"
         break;
-      case 284: /* cmd ::= SHOW CLUSTER ALIVE */
+      case 285: /* cmd ::= SHOW VNODES */
 #line 511 "sql.y"
-{ pCxt->pRootNode = createShowAliveStmt(pCxt, NULL, QUERY_NODE_SHOW_CLUSTER_ALIVE_STMT); }
-#line 6488 "sql.c"
-        break;
-      case 285: /* cmd ::= SHOW db_name_cond_opt VIEWS */
-#line 512 "sql.y"
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_VIEWS_STMT, yymsp[-1].minor.yy232, NULL, OP_TYPE_LIKE); }
-#line 6493 "sql.c"
+{ pCxt->pRootNode = createShowVnodesStmt(pCxt, NULL, NULL); }
+#line 6497 "sql.c"
         break;
-      case 286: /* cmd ::= SHOW CREATE VIEW full_table_name */
+      case 286: /* cmd ::= SHOW db_name_cond_opt ALIVE */
 #line 513 "sql.y"
-{ pCxt->pRootNode = createShowCreateViewStmt(pCxt, QUERY_NODE_SHOW_CREATE_VIEW_STMT, yymsp[0].minor.yy232); }
-#line 6498 "sql.c"
+{ pCxt->pRootNode = createShowAliveStmt(pCxt, yymsp[-1].minor.yy992,    QUERY_NODE_SHOW_DB_ALIVE_STMT); }
+#line 6502 "sql.c"
         break;
-      case 287: /* cmd ::= SHOW COMPACTS */
+      case 287: /* cmd ::= SHOW CLUSTER ALIVE */
 #line 514 "sql.y"
-{ pCxt->pRootNode = createShowCompactsStmt(pCxt, QUERY_NODE_SHOW_COMPACTS_STMT); }
-#line 6503 "sql.c"
+{ pCxt->pRootNode = createShowAliveStmt(pCxt, NULL, QUERY_NODE_SHOW_CLUSTER_ALIVE_STMT); }
+#line 6507 "sql.c"
         break;
-      case 288: /* cmd ::= SHOW COMPACT NK_INTEGER */
+      case 288: /* cmd ::= SHOW db_name_cond_opt VIEWS */
 #line 515 "sql.y"
-{ pCxt->pRootNode = createShowCompactDetailsStmt(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
-#line 6508 "sql.c"
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_VIEWS_STMT, yymsp[-1].minor.yy992, NULL, OP_TYPE_LIKE); }
+#line 6512 "sql.c"
         break;
-      case 289: /* table_kind_db_name_cond_opt ::= */
-#line 519 "sql.y"
-{ yymsp[1].minor.yy133.kind = SHOW_KIND_ALL; yymsp[1].minor.yy133.dbName = nil_token; }
-#line 6513 "sql.c"
+      case 289: /* cmd ::= SHOW CREATE VIEW full_table_name */
+#line 516 "sql.y"
+{ pCxt->pRootNode = createShowCreateViewStmt(pCxt, QUERY_NODE_SHOW_CREATE_VIEW_STMT, yymsp[0].minor.yy992); }
+#line 6517 "sql.c"
         break;
-      case 290: /* table_kind_db_name_cond_opt ::= table_kind */
-#line 520 "sql.y"
-{ yylhsminor.yy133.kind = yymsp[0].minor.yy281; yylhsminor.yy133.dbName = nil_token; }
-#line 6518 "sql.c"
-  yymsp[0].minor.yy133 = yylhsminor.yy133;
+      case 290: /* cmd ::= SHOW COMPACTS */
+#line 517 "sql.y"
+{ pCxt->pRootNode = createShowCompactsStmt(pCxt, QUERY_NODE_SHOW_COMPACTS_STMT); }
+#line 6522 "sql.c"
         break;
-      case 291: /* table_kind_db_name_cond_opt ::= db_name NK_DOT */
-#line 521 "sql.y"
-{ yylhsminor.yy133.kind = SHOW_KIND_ALL; yylhsminor.yy133.dbName = yymsp[-1].minor.yy993; }
-#line 6524 "sql.c"
-  yymsp[-1].minor.yy133 = yylhsminor.yy133;
+      case 291: /* cmd ::= SHOW COMPACT NK_INTEGER */
+#line 518 "sql.y"
+{ pCxt->pRootNode = createShowCompactDetailsStmt(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
+#line 6527 "sql.c"
         break;
-      case 292: /* table_kind_db_name_cond_opt ::= table_kind db_name NK_DOT */
+      case 292: /* table_kind_db_name_cond_opt ::= */
 #line 522 "sql.y"
-{ yylhsminor.yy133.kind = yymsp[-2].minor.yy281; yylhsminor.yy133.dbName = yymsp[-1].minor.yy993; }
-#line 6530 "sql.c"
-  yymsp[-2].minor.yy133 = yylhsminor.yy133;
-        break;
-      case 293: /* table_kind ::= NORMAL */
-#line 526 "sql.y"
-{ yymsp[0].minor.yy281 = SHOW_KIND_TABLES_NORMAL; }
-#line 6536 "sql.c"
-        break;
-      case 294: /* table_kind ::= CHILD */
-#line 527 "sql.y"
-{ yymsp[0].minor.yy281 = SHOW_KIND_TABLES_CHILD; }
-#line 6541 "sql.c"
-        break;
-      case 295: /* db_name_cond_opt ::= */
-      case 300: /* from_db_opt ::= */ yytestcase(yyruleno==300);
+{ yymsp[1].minor.yy277.kind = SHOW_KIND_ALL; yymsp[1].minor.yy277.dbName = nil_token; }
+#line 6532 "sql.c"
+        break;
+      case 293: /* table_kind_db_name_cond_opt ::= table_kind */
+#line 523 "sql.y"
+{ yylhsminor.yy277.kind = yymsp[0].minor.yy430; yylhsminor.yy277.dbName = nil_token; }
+#line 6537 "sql.c"
+  yymsp[0].minor.yy277 = yylhsminor.yy277;
+        break;
+      case 294: /* table_kind_db_name_cond_opt ::= db_name NK_DOT */
+#line 524 "sql.y"
+{ yylhsminor.yy277.kind = SHOW_KIND_ALL; yylhsminor.yy277.dbName = yymsp[-1].minor.yy929; }
+#line 6543 "sql.c"
+  yymsp[-1].minor.yy277 = yylhsminor.yy277;
+        break;
+      case 295: /* table_kind_db_name_cond_opt ::= table_kind db_name NK_DOT */
+#line 525 "sql.y"
+{ yylhsminor.yy277.kind = yymsp[-2].minor.yy430; yylhsminor.yy277.dbName = yymsp[-1].minor.yy929; }
+#line 6549 "sql.c"
+  yymsp[-2].minor.yy277 = yylhsminor.yy277;
+        break;
+      case 296: /* table_kind ::= NORMAL */
 #line 529 "sql.y"
-{ yymsp[1].minor.yy232 = createDefaultDatabaseCondValue(pCxt); }
-#line 6547 "sql.c"
+{ yymsp[0].minor.yy430 = SHOW_KIND_TABLES_NORMAL; }
+#line 6555 "sql.c"
         break;
-      case 296: /* db_name_cond_opt ::= db_name NK_DOT */
+      case 297: /* table_kind ::= CHILD */
 #line 530 "sql.y"
-{ yylhsminor.yy232 = createIdentifierValueNode(pCxt, &yymsp[-1].minor.yy993); }
-#line 6552 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
+{ yymsp[0].minor.yy430 = SHOW_KIND_TABLES_CHILD; }
+#line 6560 "sql.c"
+        break;
+      case 298: /* db_name_cond_opt ::= */
+      case 303: /* from_db_opt ::= */ yytestcase(yyruleno==303);
+#line 532 "sql.y"
+{ yymsp[1].minor.yy992 = createDefaultDatabaseCondValue(pCxt); }
+#line 6566 "sql.c"
         break;
-      case 298: /* like_pattern_opt ::= LIKE NK_STRING */
+      case 299: /* db_name_cond_opt ::= db_name NK_DOT */
 #line 533 "sql.y"
-{ yymsp[-1].minor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0); }
-#line 6558 "sql.c"
+{ yylhsminor.yy992 = createIdentifierValueNode(pCxt, &yymsp[-1].minor.yy929); }
+#line 6571 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
         break;
-      case 299: /* table_name_cond ::= table_name */
-#line 535 "sql.y"
-{ yylhsminor.yy232 = createIdentifierValueNode(pCxt, &yymsp[0].minor.yy993); }
-#line 6563 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
+      case 301: /* like_pattern_opt ::= LIKE NK_STRING */
+#line 536 "sql.y"
+{ yymsp[-1].minor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0); }
+#line 6577 "sql.c"
         break;
-      case 301: /* from_db_opt ::= FROM db_name */
+      case 302: /* table_name_cond ::= table_name */
 #line 538 "sql.y"
-{ yymsp[-1].minor.yy232 = createIdentifierValueNode(pCxt, &yymsp[0].minor.yy993); }
-#line 6569 "sql.c"
+{ yylhsminor.yy992 = createIdentifierValueNode(pCxt, &yymsp[0].minor.yy929); }
+#line 6582 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
         break;
-      case 305: /* tag_item ::= TBNAME */
-#line 546 "sql.y"
-{ yylhsminor.yy232 = setProjectionAlias(pCxt, createFunctionNode(pCxt, &yymsp[0].minor.yy0, NULL), &yymsp[0].minor.yy0); }
-#line 6574 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
+      case 304: /* from_db_opt ::= FROM db_name */
+#line 541 "sql.y"
+{ yymsp[-1].minor.yy992 = createIdentifierValueNode(pCxt, &yymsp[0].minor.yy929); }
+#line 6588 "sql.c"
         break;
-      case 308: /* tag_item ::= column_name column_alias */
+      case 308: /* tag_item ::= TBNAME */
 #line 549 "sql.y"
-{ yylhsminor.yy232 = setProjectionAlias(pCxt, createColumnNode(pCxt, NULL, &yymsp[-1].minor.yy993), &yymsp[0].minor.yy993); }
-#line 6580 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 309: /* tag_item ::= column_name AS column_alias */
-#line 550 "sql.y"
-{ yylhsminor.yy232 = setProjectionAlias(pCxt, createColumnNode(pCxt, NULL, &yymsp[-2].minor.yy993), &yymsp[0].minor.yy993); }
-#line 6586 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 310: /* db_kind_opt ::= */
-#line 554 "sql.y"
-{ yymsp[1].minor.yy281 = SHOW_KIND_ALL; }
-#line 6592 "sql.c"
-        break;
-      case 311: /* db_kind_opt ::= USER */
-#line 555 "sql.y"
-{ yymsp[0].minor.yy281 = SHOW_KIND_DATABASES_USER; }
-#line 6597 "sql.c"
-        break;
-      case 312: /* db_kind_opt ::= SYSTEM */
-#line 556 "sql.y"
-{ yymsp[0].minor.yy281 = SHOW_KIND_DATABASES_SYSTEM; }
-#line 6602 "sql.c"
-        break;
-      case 313: /* cmd ::= CREATE SMA INDEX not_exists_opt col_name ON full_table_name index_options */
-#line 560 "sql.y"
-{ pCxt->pRootNode = createCreateIndexStmt(pCxt, INDEX_TYPE_SMA, yymsp[-4].minor.yy985, yymsp[-3].minor.yy232, yymsp[-1].minor.yy232, NULL, yymsp[0].minor.yy232); }
-#line 6607 "sql.c"
+{ yylhsminor.yy992 = setProjectionAlias(pCxt, createFunctionNode(pCxt, &yymsp[0].minor.yy0, NULL), &yymsp[0].minor.yy0); }
+#line 6593 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
         break;
-      case 314: /* cmd ::= CREATE INDEX not_exists_opt col_name ON full_table_name NK_LP col_name_list NK_RP */
-#line 562 "sql.y"
-{ pCxt->pRootNode = createCreateIndexStmt(pCxt, INDEX_TYPE_NORMAL, yymsp[-6].minor.yy985, yymsp[-5].minor.yy232, yymsp[-3].minor.yy232, yymsp[-1].minor.yy88, NULL); }
-#line 6612 "sql.c"
+      case 311: /* tag_item ::= column_name column_alias */
+#line 552 "sql.y"
+{ yylhsminor.yy992 = setProjectionAlias(pCxt, createColumnNode(pCxt, NULL, &yymsp[-1].minor.yy929), &yymsp[0].minor.yy929); }
+#line 6599 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
         break;
-      case 315: /* cmd ::= DROP INDEX exists_opt full_index_name */
+      case 312: /* tag_item ::= column_name AS column_alias */
+#line 553 "sql.y"
+{ yylhsminor.yy992 = setProjectionAlias(pCxt, createColumnNode(pCxt, NULL, &yymsp[-2].minor.yy929), &yymsp[0].minor.yy929); }
+#line 6605 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 313: /* db_kind_opt ::= */
+#line 557 "sql.y"
+{ yymsp[1].minor.yy430 = SHOW_KIND_ALL; }
+#line 6611 "sql.c"
+        break;
+      case 314: /* db_kind_opt ::= USER */
+#line 558 "sql.y"
+{ yymsp[0].minor.yy430 = SHOW_KIND_DATABASES_USER; }
+#line 6616 "sql.c"
+        break;
+      case 315: /* db_kind_opt ::= SYSTEM */
+#line 559 "sql.y"
+{ yymsp[0].minor.yy430 = SHOW_KIND_DATABASES_SYSTEM; }
+#line 6621 "sql.c"
+        break;
+      case 316: /* cmd ::= CREATE SMA INDEX not_exists_opt col_name ON full_table_name index_options */
 #line 563 "sql.y"
-{ pCxt->pRootNode = createDropIndexStmt(pCxt, yymsp[-1].minor.yy985, yymsp[0].minor.yy232); }
-#line 6617 "sql.c"
+{ pCxt->pRootNode = createCreateIndexStmt(pCxt, INDEX_TYPE_SMA, yymsp[-4].minor.yy437, yymsp[-3].minor.yy992, yymsp[-1].minor.yy992, NULL, yymsp[0].minor.yy992); }
+#line 6626 "sql.c"
         break;
-      case 316: /* full_index_name ::= index_name */
+      case 317: /* cmd ::= CREATE INDEX not_exists_opt col_name ON full_table_name NK_LP col_name_list NK_RP */
 #line 565 "sql.y"
-{ yylhsminor.yy232 = createRealTableNodeForIndexName(pCxt, NULL, &yymsp[0].minor.yy993); }
-#line 6622 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
+{ pCxt->pRootNode = createCreateIndexStmt(pCxt, INDEX_TYPE_NORMAL, yymsp[-6].minor.yy437, yymsp[-5].minor.yy992, yymsp[-3].minor.yy992, yymsp[-1].minor.yy364, NULL); }
+#line 6631 "sql.c"
         break;
-      case 317: /* full_index_name ::= db_name NK_DOT index_name */
+      case 318: /* cmd ::= DROP INDEX exists_opt full_index_name */
 #line 566 "sql.y"
-{ yylhsminor.yy232 = createRealTableNodeForIndexName(pCxt, &yymsp[-2].minor.yy993, &yymsp[0].minor.yy993); }
-#line 6628 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ pCxt->pRootNode = createDropIndexStmt(pCxt, yymsp[-1].minor.yy437, yymsp[0].minor.yy992); }
+#line 6636 "sql.c"
         break;
-      case 318: /* index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_RP sliding_opt sma_stream_opt */
+      case 319: /* full_index_name ::= index_name */
+#line 568 "sql.y"
+{ yylhsminor.yy992 = createRealTableNodeForIndexName(pCxt, NULL, &yymsp[0].minor.yy929); }
+#line 6641 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 320: /* full_index_name ::= db_name NK_DOT index_name */
 #line 569 "sql.y"
-{ yymsp[-9].minor.yy232 = createIndexOption(pCxt, yymsp[-7].minor.yy88, releaseRawExprNode(pCxt, yymsp[-3].minor.yy232), NULL, yymsp[-1].minor.yy232, yymsp[0].minor.yy232); }
-#line 6634 "sql.c"
+{ yylhsminor.yy992 = createRealTableNodeForIndexName(pCxt, &yymsp[-2].minor.yy929, &yymsp[0].minor.yy929); }
+#line 6647 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 319: /* index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt sma_stream_opt */
+      case 321: /* index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_RP sliding_opt sma_stream_opt */
 #line 572 "sql.y"
-{ yymsp[-11].minor.yy232 = createIndexOption(pCxt, yymsp[-9].minor.yy88, releaseRawExprNode(pCxt, yymsp[-5].minor.yy232), releaseRawExprNode(pCxt, yymsp[-3].minor.yy232), yymsp[-1].minor.yy232, yymsp[0].minor.yy232); }
-#line 6639 "sql.c"
-        break;
-      case 322: /* func ::= sma_func_name NK_LP expression_list NK_RP */
-#line 579 "sql.y"
-{ yylhsminor.yy232 = createFunctionNode(pCxt, &yymsp[-3].minor.yy993, yymsp[-1].minor.yy88); }
-#line 6644 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 323: /* sma_func_name ::= function_name */
-      case 548: /* alias_opt ::= table_alias */ yytestcase(yyruleno==548);
-#line 583 "sql.y"
-{ yylhsminor.yy993 = yymsp[0].minor.yy993; }
-#line 6651 "sql.c"
-  yymsp[0].minor.yy993 = yylhsminor.yy993;
-        break;
-      case 328: /* sma_stream_opt ::= */
-      case 373: /* stream_options ::= */ yytestcase(yyruleno==373);
-#line 589 "sql.y"
-{ yymsp[1].minor.yy232 = createStreamOptions(pCxt); }
+{ yymsp[-9].minor.yy992 = createIndexOption(pCxt, yymsp[-7].minor.yy364, releaseRawExprNode(pCxt, yymsp[-3].minor.yy992), NULL, yymsp[-1].minor.yy992, yymsp[0].minor.yy992); }
+#line 6653 "sql.c"
+        break;
+      case 322: /* index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt sma_stream_opt */
+#line 575 "sql.y"
+{ yymsp[-11].minor.yy992 = createIndexOption(pCxt, yymsp[-9].minor.yy364, releaseRawExprNode(pCxt, yymsp[-5].minor.yy992), releaseRawExprNode(pCxt, yymsp[-3].minor.yy992), yymsp[-1].minor.yy992, yymsp[0].minor.yy992); }
 #line 6658 "sql.c"
         break;
-      case 329: /* sma_stream_opt ::= sma_stream_opt WATERMARK duration_literal */
-#line 590 "sql.y"
-{ ((SStreamOptions*)yymsp[-2].minor.yy232)->pWatermark = releaseRawExprNode(pCxt, yymsp[0].minor.yy232); yylhsminor.yy232 = yymsp[-2].minor.yy232; }
+      case 325: /* func ::= sma_func_name NK_LP expression_list NK_RP */
+#line 582 "sql.y"
+{ yylhsminor.yy992 = createFunctionNode(pCxt, &yymsp[-3].minor.yy929, yymsp[-1].minor.yy364); }
 #line 6663 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
         break;
-      case 330: /* sma_stream_opt ::= sma_stream_opt MAX_DELAY duration_literal */
-#line 591 "sql.y"
-{ ((SStreamOptions*)yymsp[-2].minor.yy232)->pDelay = releaseRawExprNode(pCxt, yymsp[0].minor.yy232); yylhsminor.yy232 = yymsp[-2].minor.yy232; }
-#line 6669 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+      case 326: /* sma_func_name ::= function_name */
+      case 551: /* alias_opt ::= table_alias */ yytestcase(yyruleno==551);
+#line 586 "sql.y"
+{ yylhsminor.yy929 = yymsp[0].minor.yy929; }
+#line 6670 "sql.c"
+  yymsp[0].minor.yy929 = yylhsminor.yy929;
         break;
-      case 331: /* sma_stream_opt ::= sma_stream_opt DELETE_MARK duration_literal */
+      case 331: /* sma_stream_opt ::= */
+      case 376: /* stream_options ::= */ yytestcase(yyruleno==376);
 #line 592 "sql.y"
-{ ((SStreamOptions*)yymsp[-2].minor.yy232)->pDeleteMark = releaseRawExprNode(pCxt, yymsp[0].minor.yy232); yylhsminor.yy232 = yymsp[-2].minor.yy232; }
-#line 6675 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 332: /* with_meta ::= AS */
-#line 597 "sql.y"
-{ yymsp[0].minor.yy92 = 0; }
-#line 6681 "sql.c"
-        break;
-      case 333: /* with_meta ::= WITH META AS */
-#line 598 "sql.y"
-{ yymsp[-2].minor.yy92 = 1; }
-#line 6686 "sql.c"
-        break;
-      case 334: /* with_meta ::= ONLY META AS */
-#line 599 "sql.y"
-{ yymsp[-2].minor.yy92 = 2; }
-#line 6691 "sql.c"
-        break;
-      case 335: /* cmd ::= CREATE TOPIC not_exists_opt topic_name AS query_or_subquery */
+{ yymsp[1].minor.yy992 = createStreamOptions(pCxt); }
+#line 6677 "sql.c"
+        break;
+      case 332: /* sma_stream_opt ::= sma_stream_opt WATERMARK duration_literal */
+#line 593 "sql.y"
+{ ((SStreamOptions*)yymsp[-2].minor.yy992)->pWatermark = releaseRawExprNode(pCxt, yymsp[0].minor.yy992); yylhsminor.yy992 = yymsp[-2].minor.yy992; }
+#line 6682 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 333: /* sma_stream_opt ::= sma_stream_opt MAX_DELAY duration_literal */
+#line 594 "sql.y"
+{ ((SStreamOptions*)yymsp[-2].minor.yy992)->pDelay = releaseRawExprNode(pCxt, yymsp[0].minor.yy992); yylhsminor.yy992 = yymsp[-2].minor.yy992; }
+#line 6688 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 334: /* sma_stream_opt ::= sma_stream_opt DELETE_MARK duration_literal */
+#line 595 "sql.y"
+{ ((SStreamOptions*)yymsp[-2].minor.yy992)->pDeleteMark = releaseRawExprNode(pCxt, yymsp[0].minor.yy992); yylhsminor.yy992 = yymsp[-2].minor.yy992; }
+#line 6694 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 335: /* with_meta ::= AS */
+#line 600 "sql.y"
+{ yymsp[0].minor.yy40 = 0; }
+#line 6700 "sql.c"
+        break;
+      case 336: /* with_meta ::= WITH META AS */
 #line 601 "sql.y"
-{ pCxt->pRootNode = createCreateTopicStmtUseQuery(pCxt, yymsp[-3].minor.yy985, &yymsp[-2].minor.yy993, yymsp[0].minor.yy232); }
-#line 6696 "sql.c"
+{ yymsp[-2].minor.yy40 = 1; }
+#line 6705 "sql.c"
         break;
-      case 336: /* cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta DATABASE db_name */
-#line 603 "sql.y"
-{ pCxt->pRootNode = createCreateTopicStmtUseDb(pCxt, yymsp[-4].minor.yy985, &yymsp[-3].minor.yy993, &yymsp[0].minor.yy993, yymsp[-2].minor.yy92); }
-#line 6701 "sql.c"
+      case 337: /* with_meta ::= ONLY META AS */
+#line 602 "sql.y"
+{ yymsp[-2].minor.yy40 = 2; }
+#line 6710 "sql.c"
         break;
-      case 337: /* cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta STABLE full_table_name where_clause_opt */
-#line 605 "sql.y"
-{ pCxt->pRootNode = createCreateTopicStmtUseTable(pCxt, yymsp[-5].minor.yy985, &yymsp[-4].minor.yy993, yymsp[-1].minor.yy232, yymsp[-3].minor.yy92, yymsp[0].minor.yy232); }
-#line 6706 "sql.c"
+      case 338: /* cmd ::= CREATE TOPIC not_exists_opt topic_name AS query_or_subquery */
+#line 604 "sql.y"
+{ pCxt->pRootNode = createCreateTopicStmtUseQuery(pCxt, yymsp[-3].minor.yy437, &yymsp[-2].minor.yy929, yymsp[0].minor.yy992); }
+#line 6715 "sql.c"
         break;
-      case 338: /* cmd ::= DROP TOPIC exists_opt topic_name */
-#line 607 "sql.y"
-{ pCxt->pRootNode = createDropTopicStmt(pCxt, yymsp[-1].minor.yy985, &yymsp[0].minor.yy993); }
-#line 6711 "sql.c"
+      case 339: /* cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta DATABASE db_name */
+#line 606 "sql.y"
+{ pCxt->pRootNode = createCreateTopicStmtUseDb(pCxt, yymsp[-4].minor.yy437, &yymsp[-3].minor.yy929, &yymsp[0].minor.yy929, yymsp[-2].minor.yy40); }
+#line 6720 "sql.c"
         break;
-      case 339: /* cmd ::= DROP CONSUMER GROUP exists_opt cgroup_name ON topic_name */
+      case 340: /* cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta STABLE full_table_name where_clause_opt */
 #line 608 "sql.y"
-{ pCxt->pRootNode = createDropCGroupStmt(pCxt, yymsp[-3].minor.yy985, &yymsp[-2].minor.yy993, &yymsp[0].minor.yy993); }
-#line 6716 "sql.c"
+{ pCxt->pRootNode = createCreateTopicStmtUseTable(pCxt, yymsp[-5].minor.yy437, &yymsp[-4].minor.yy929, yymsp[-1].minor.yy992, yymsp[-3].minor.yy40, yymsp[0].minor.yy992); }
+#line 6725 "sql.c"
+        break;
+      case 341: /* cmd ::= DROP TOPIC exists_opt topic_name */
+#line 610 "sql.y"
+{ pCxt->pRootNode = createDropTopicStmt(pCxt, yymsp[-1].minor.yy437, &yymsp[0].minor.yy929); }
+#line 6730 "sql.c"
         break;
-      case 340: /* cmd ::= DESC full_table_name */
-      case 341: /* cmd ::= DESCRIBE full_table_name */ yytestcase(yyruleno==341);
+      case 342: /* cmd ::= DROP CONSUMER GROUP exists_opt cgroup_name ON topic_name */
 #line 611 "sql.y"
-{ pCxt->pRootNode = createDescribeStmt(pCxt, yymsp[0].minor.yy232); }
-#line 6722 "sql.c"
+{ pCxt->pRootNode = createDropCGroupStmt(pCxt, yymsp[-3].minor.yy437, &yymsp[-2].minor.yy929, &yymsp[0].minor.yy929); }
+#line 6735 "sql.c"
         break;
-      case 342: /* cmd ::= RESET QUERY CACHE */
-#line 615 "sql.y"
-{ pCxt->pRootNode = createResetQueryCacheStmt(pCxt); }
-#line 6727 "sql.c"
+      case 343: /* cmd ::= DESC full_table_name */
+      case 344: /* cmd ::= DESCRIBE full_table_name */ yytestcase(yyruleno==344);
+#line 614 "sql.y"
+{ pCxt->pRootNode = createDescribeStmt(pCxt, yymsp[0].minor.yy992); }
+#line 6741 "sql.c"
         break;
-      case 343: /* cmd ::= EXPLAIN analyze_opt explain_options query_or_subquery */
-      case 344: /* cmd ::= EXPLAIN analyze_opt explain_options insert_query */ yytestcase(yyruleno==344);
+      case 345: /* cmd ::= RESET QUERY CACHE */
 #line 618 "sql.y"
-{ pCxt->pRootNode = createExplainStmt(pCxt, yymsp[-2].minor.yy985, yymsp[-1].minor.yy232, yymsp[0].minor.yy232); }
-#line 6733 "sql.c"
-        break;
-      case 347: /* explain_options ::= */
-#line 626 "sql.y"
-{ yymsp[1].minor.yy232 = createDefaultExplainOptions(pCxt); }
-#line 6738 "sql.c"
-        break;
-      case 348: /* explain_options ::= explain_options VERBOSE NK_BOOL */
-#line 627 "sql.y"
-{ yylhsminor.yy232 = setExplainVerbose(pCxt, yymsp[-2].minor.yy232, &yymsp[0].minor.yy0); }
-#line 6743 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 349: /* explain_options ::= explain_options RATIO NK_FLOAT */
-#line 628 "sql.y"
-{ yylhsminor.yy232 = setExplainRatio(pCxt, yymsp[-2].minor.yy232, &yymsp[0].minor.yy0); }
-#line 6749 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 350: /* cmd ::= CREATE or_replace_opt agg_func_opt FUNCTION not_exists_opt function_name AS NK_STRING OUTPUTTYPE type_name bufsize_opt language_opt */
-#line 633 "sql.y"
-{ pCxt->pRootNode = createCreateFunctionStmt(pCxt, yymsp[-7].minor.yy985, yymsp[-9].minor.yy985, &yymsp[-6].minor.yy993, &yymsp[-4].minor.yy0, yymsp[-2].minor.yy400, yymsp[-1].minor.yy92, &yymsp[0].minor.yy993, yymsp[-10].minor.yy985); }
-#line 6755 "sql.c"
-        break;
-      case 351: /* cmd ::= DROP FUNCTION exists_opt function_name */
-#line 634 "sql.y"
-{ pCxt->pRootNode = createDropFunctionStmt(pCxt, yymsp[-1].minor.yy985, &yymsp[0].minor.yy993); }
-#line 6760 "sql.c"
-        break;
-      case 356: /* language_opt ::= */
-      case 395: /* on_vgroup_id ::= */ yytestcase(yyruleno==395);
-#line 648 "sql.y"
-{ yymsp[1].minor.yy993 = nil_token; }
-#line 6766 "sql.c"
-        break;
-      case 357: /* language_opt ::= LANGUAGE NK_STRING */
-      case 396: /* on_vgroup_id ::= ON NK_INTEGER */ yytestcase(yyruleno==396);
-#line 649 "sql.y"
-{ yymsp[-1].minor.yy993 = yymsp[0].minor.yy0; }
-#line 6772 "sql.c"
-        break;
-      case 360: /* cmd ::= CREATE or_replace_opt VIEW full_view_name AS query_or_subquery */
-#line 658 "sql.y"
-{ pCxt->pRootNode = createCreateViewStmt(pCxt, yymsp[-4].minor.yy985, yymsp[-2].minor.yy232, &yymsp[-1].minor.yy0, yymsp[0].minor.yy232); }
-#line 6777 "sql.c"
-        break;
-      case 361: /* cmd ::= DROP VIEW exists_opt full_view_name */
-#line 659 "sql.y"
-{ pCxt->pRootNode = createDropViewStmt(pCxt, yymsp[-1].minor.yy985, yymsp[0].minor.yy232); }
-#line 6782 "sql.c"
-        break;
-      case 362: /* full_view_name ::= view_name */
+{ pCxt->pRootNode = createResetQueryCacheStmt(pCxt); }
+#line 6746 "sql.c"
+        break;
+      case 346: /* cmd ::= EXPLAIN analyze_opt explain_options query_or_subquery */
+      case 347: /* cmd ::= EXPLAIN analyze_opt explain_options insert_query */ yytestcase(yyruleno==347);
+#line 621 "sql.y"
+{ pCxt->pRootNode = createExplainStmt(pCxt, yymsp[-2].minor.yy437, yymsp[-1].minor.yy992, yymsp[0].minor.yy992); }
+#line 6752 "sql.c"
+        break;
+      case 350: /* explain_options ::= */
+#line 629 "sql.y"
+{ yymsp[1].minor.yy992 = createDefaultExplainOptions(pCxt); }
+#line 6757 "sql.c"
+        break;
+      case 351: /* explain_options ::= explain_options VERBOSE NK_BOOL */
+#line 630 "sql.y"
+{ yylhsminor.yy992 = setExplainVerbose(pCxt, yymsp[-2].minor.yy992, &yymsp[0].minor.yy0); }
+#line 6762 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 352: /* explain_options ::= explain_options RATIO NK_FLOAT */
+#line 631 "sql.y"
+{ yylhsminor.yy992 = setExplainRatio(pCxt, yymsp[-2].minor.yy992, &yymsp[0].minor.yy0); }
+#line 6768 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 353: /* cmd ::= CREATE or_replace_opt agg_func_opt FUNCTION not_exists_opt function_name AS NK_STRING OUTPUTTYPE type_name bufsize_opt language_opt */
+#line 636 "sql.y"
+{ pCxt->pRootNode = createCreateFunctionStmt(pCxt, yymsp[-7].minor.yy437, yymsp[-9].minor.yy437, &yymsp[-6].minor.yy929, &yymsp[-4].minor.yy0, yymsp[-2].minor.yy184, yymsp[-1].minor.yy40, &yymsp[0].minor.yy929, yymsp[-10].minor.yy437); }
+#line 6774 "sql.c"
+        break;
+      case 354: /* cmd ::= DROP FUNCTION exists_opt function_name */
+#line 637 "sql.y"
+{ pCxt->pRootNode = createDropFunctionStmt(pCxt, yymsp[-1].minor.yy437, &yymsp[0].minor.yy929); }
+#line 6779 "sql.c"
+        break;
+      case 359: /* language_opt ::= */
+      case 398: /* on_vgroup_id ::= */ yytestcase(yyruleno==398);
+#line 651 "sql.y"
+{ yymsp[1].minor.yy929 = nil_token; }
+#line 6785 "sql.c"
+        break;
+      case 360: /* language_opt ::= LANGUAGE NK_STRING */
+      case 399: /* on_vgroup_id ::= ON NK_INTEGER */ yytestcase(yyruleno==399);
+#line 652 "sql.y"
+{ yymsp[-1].minor.yy929 = yymsp[0].minor.yy0; }
+#line 6791 "sql.c"
+        break;
+      case 363: /* cmd ::= CREATE or_replace_opt VIEW full_view_name AS query_or_subquery */
 #line 661 "sql.y"
-{ yylhsminor.yy232 = createViewNode(pCxt, NULL, &yymsp[0].minor.yy993); }
-#line 6787 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
+{ pCxt->pRootNode = createCreateViewStmt(pCxt, yymsp[-4].minor.yy437, yymsp[-2].minor.yy992, &yymsp[-1].minor.yy0, yymsp[0].minor.yy992); }
+#line 6796 "sql.c"
         break;
-      case 363: /* full_view_name ::= db_name NK_DOT view_name */
+      case 364: /* cmd ::= DROP VIEW exists_opt full_view_name */
 #line 662 "sql.y"
-{ yylhsminor.yy232 = createViewNode(pCxt, &yymsp[-2].minor.yy993, &yymsp[0].minor.yy993); }
-#line 6793 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 364: /* cmd ::= CREATE STREAM not_exists_opt stream_name stream_options INTO full_table_name col_list_opt tag_def_or_ref_opt subtable_opt AS query_or_subquery */
-#line 667 "sql.y"
-{ pCxt->pRootNode = createCreateStreamStmt(pCxt, yymsp[-9].minor.yy985, &yymsp[-8].minor.yy993, yymsp[-5].minor.yy232, yymsp[-7].minor.yy232, yymsp[-3].minor.yy88, yymsp[-2].minor.yy232, yymsp[0].minor.yy232, yymsp[-4].minor.yy88); }
-#line 6799 "sql.c"
-        break;
-      case 365: /* cmd ::= DROP STREAM exists_opt stream_name */
-#line 668 "sql.y"
-{ pCxt->pRootNode = createDropStreamStmt(pCxt, yymsp[-1].minor.yy985, &yymsp[0].minor.yy993); }
-#line 6804 "sql.c"
-        break;
-      case 366: /* cmd ::= PAUSE STREAM exists_opt stream_name */
-#line 669 "sql.y"
-{ pCxt->pRootNode = createPauseStreamStmt(pCxt, yymsp[-1].minor.yy985, &yymsp[0].minor.yy993); }
-#line 6809 "sql.c"
-        break;
-      case 367: /* cmd ::= RESUME STREAM exists_opt ignore_opt stream_name */
+{ pCxt->pRootNode = createDropViewStmt(pCxt, yymsp[-1].minor.yy437, yymsp[0].minor.yy992); }
+#line 6801 "sql.c"
+        break;
+      case 365: /* full_view_name ::= view_name */
+#line 664 "sql.y"
+{ yylhsminor.yy992 = createViewNode(pCxt, NULL, &yymsp[0].minor.yy929); }
+#line 6806 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 366: /* full_view_name ::= db_name NK_DOT view_name */
+#line 665 "sql.y"
+{ yylhsminor.yy992 = createViewNode(pCxt, &yymsp[-2].minor.yy929, &yymsp[0].minor.yy929); }
+#line 6812 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 367: /* cmd ::= CREATE STREAM not_exists_opt stream_name stream_options INTO full_table_name col_list_opt tag_def_or_ref_opt subtable_opt AS query_or_subquery */
 #line 670 "sql.y"
-{ pCxt->pRootNode = createResumeStreamStmt(pCxt, yymsp[-2].minor.yy985, yymsp[-1].minor.yy985, &yymsp[0].minor.yy993); }
-#line 6814 "sql.c"
-        break;
-      case 374: /* stream_options ::= stream_options TRIGGER AT_ONCE */
-      case 375: /* stream_options ::= stream_options TRIGGER WINDOW_CLOSE */ yytestcase(yyruleno==375);
-#line 684 "sql.y"
-{ yylhsminor.yy232 = setStreamOptions(pCxt, yymsp[-2].minor.yy232, SOPT_TRIGGER_TYPE_SET, &yymsp[0].minor.yy0, NULL); }
-#line 6820 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 376: /* stream_options ::= stream_options TRIGGER MAX_DELAY duration_literal */
-#line 686 "sql.y"
-{ yylhsminor.yy232 = setStreamOptions(pCxt, yymsp[-3].minor.yy232, SOPT_TRIGGER_TYPE_SET, &yymsp[-1].minor.yy0, releaseRawExprNode(pCxt, yymsp[0].minor.yy232)); }
-#line 6826 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 377: /* stream_options ::= stream_options WATERMARK duration_literal */
+{ pCxt->pRootNode = createCreateStreamStmt(pCxt, yymsp[-9].minor.yy437, &yymsp[-8].minor.yy929, yymsp[-5].minor.yy992, yymsp[-7].minor.yy992, yymsp[-3].minor.yy364, yymsp[-2].minor.yy992, yymsp[0].minor.yy992, yymsp[-4].minor.yy364); }
+#line 6818 "sql.c"
+        break;
+      case 368: /* cmd ::= DROP STREAM exists_opt stream_name */
+#line 671 "sql.y"
+{ pCxt->pRootNode = createDropStreamStmt(pCxt, yymsp[-1].minor.yy437, &yymsp[0].minor.yy929); }
+#line 6823 "sql.c"
+        break;
+      case 369: /* cmd ::= PAUSE STREAM exists_opt stream_name */
+#line 672 "sql.y"
+{ pCxt->pRootNode = createPauseStreamStmt(pCxt, yymsp[-1].minor.yy437, &yymsp[0].minor.yy929); }
+#line 6828 "sql.c"
+        break;
+      case 370: /* cmd ::= RESUME STREAM exists_opt ignore_opt stream_name */
+#line 673 "sql.y"
+{ pCxt->pRootNode = createResumeStreamStmt(pCxt, yymsp[-2].minor.yy437, yymsp[-1].minor.yy437, &yymsp[0].minor.yy929); }
+#line 6833 "sql.c"
+        break;
+      case 377: /* stream_options ::= stream_options TRIGGER AT_ONCE */
+      case 378: /* stream_options ::= stream_options TRIGGER WINDOW_CLOSE */ yytestcase(yyruleno==378);
 #line 687 "sql.y"
-{ yylhsminor.yy232 = setStreamOptions(pCxt, yymsp[-2].minor.yy232, SOPT_WATERMARK_SET, NULL, releaseRawExprNode(pCxt, yymsp[0].minor.yy232)); }
-#line 6832 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setStreamOptions(pCxt, yymsp[-2].minor.yy992, SOPT_TRIGGER_TYPE_SET, &yymsp[0].minor.yy0, NULL); }
+#line 6839 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 378: /* stream_options ::= stream_options IGNORE EXPIRED NK_INTEGER */
-#line 688 "sql.y"
-{ yylhsminor.yy232 = setStreamOptions(pCxt, yymsp[-3].minor.yy232, SOPT_IGNORE_EXPIRED_SET, &yymsp[0].minor.yy0, NULL); }
-#line 6838 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 379: /* stream_options ::= stream_options FILL_HISTORY NK_INTEGER */
+      case 379: /* stream_options ::= stream_options TRIGGER MAX_DELAY duration_literal */
 #line 689 "sql.y"
-{ yylhsminor.yy232 = setStreamOptions(pCxt, yymsp[-2].minor.yy232, SOPT_FILL_HISTORY_SET, &yymsp[0].minor.yy0, NULL); }
-#line 6844 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setStreamOptions(pCxt, yymsp[-3].minor.yy992, SOPT_TRIGGER_TYPE_SET, &yymsp[-1].minor.yy0, releaseRawExprNode(pCxt, yymsp[0].minor.yy992)); }
+#line 6845 "sql.c"
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
         break;
-      case 380: /* stream_options ::= stream_options DELETE_MARK duration_literal */
+      case 380: /* stream_options ::= stream_options WATERMARK duration_literal */
 #line 690 "sql.y"
-{ yylhsminor.yy232 = setStreamOptions(pCxt, yymsp[-2].minor.yy232, SOPT_DELETE_MARK_SET, NULL, releaseRawExprNode(pCxt, yymsp[0].minor.yy232)); }
-#line 6850 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setStreamOptions(pCxt, yymsp[-2].minor.yy992, SOPT_WATERMARK_SET, NULL, releaseRawExprNode(pCxt, yymsp[0].minor.yy992)); }
+#line 6851 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 381: /* stream_options ::= stream_options IGNORE UPDATE NK_INTEGER */
+      case 381: /* stream_options ::= stream_options IGNORE EXPIRED NK_INTEGER */
 #line 691 "sql.y"
-{ yylhsminor.yy232 = setStreamOptions(pCxt, yymsp[-3].minor.yy232, SOPT_IGNORE_UPDATE_SET, &yymsp[0].minor.yy0, NULL); }
-#line 6856 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = setStreamOptions(pCxt, yymsp[-3].minor.yy992, SOPT_IGNORE_EXPIRED_SET, &yymsp[0].minor.yy0, NULL); }
+#line 6857 "sql.c"
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 382: /* stream_options ::= stream_options FILL_HISTORY NK_INTEGER */
+#line 692 "sql.y"
+{ yylhsminor.yy992 = setStreamOptions(pCxt, yymsp[-2].minor.yy992, SOPT_FILL_HISTORY_SET, &yymsp[0].minor.yy0, NULL); }
+#line 6863 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 383: /* stream_options ::= stream_options DELETE_MARK duration_literal */
+#line 693 "sql.y"
+{ yylhsminor.yy992 = setStreamOptions(pCxt, yymsp[-2].minor.yy992, SOPT_DELETE_MARK_SET, NULL, releaseRawExprNode(pCxt, yymsp[0].minor.yy992)); }
+#line 6869 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 383: /* subtable_opt ::= SUBTABLE NK_LP expression NK_RP */
-      case 586: /* sliding_opt ::= SLIDING NK_LP interval_sliding_duration_literal NK_RP */ yytestcase(yyruleno==586);
-      case 610: /* every_opt ::= EVERY NK_LP duration_literal NK_RP */ yytestcase(yyruleno==610);
+      case 384: /* stream_options ::= stream_options IGNORE UPDATE NK_INTEGER */
 #line 694 "sql.y"
-{ yymsp[-3].minor.yy232 = releaseRawExprNode(pCxt, yymsp[-1].minor.yy232); }
-#line 6864 "sql.c"
-        break;
-      case 386: /* cmd ::= KILL CONNECTION NK_INTEGER */
-#line 702 "sql.y"
+{ yylhsminor.yy992 = setStreamOptions(pCxt, yymsp[-3].minor.yy992, SOPT_IGNORE_UPDATE_SET, &yymsp[0].minor.yy0, NULL); }
+#line 6875 "sql.c"
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 386: /* subtable_opt ::= SUBTABLE NK_LP expression NK_RP */
+      case 589: /* sliding_opt ::= SLIDING NK_LP interval_sliding_duration_literal NK_RP */ yytestcase(yyruleno==589);
+      case 613: /* every_opt ::= EVERY NK_LP duration_literal NK_RP */ yytestcase(yyruleno==613);
+#line 697 "sql.y"
+{ yymsp[-3].minor.yy992 = releaseRawExprNode(pCxt, yymsp[-1].minor.yy992); }
+#line 6883 "sql.c"
+        break;
+      case 389: /* cmd ::= KILL CONNECTION NK_INTEGER */
+#line 705 "sql.y"
 { pCxt->pRootNode = createKillStmt(pCxt, QUERY_NODE_KILL_CONNECTION_STMT, &yymsp[0].minor.yy0); }
-#line 6869 "sql.c"
+#line 6888 "sql.c"
         break;
-      case 387: /* cmd ::= KILL QUERY NK_STRING */
-#line 703 "sql.y"
+      case 390: /* cmd ::= KILL QUERY NK_STRING */
+#line 706 "sql.y"
 { pCxt->pRootNode = createKillQueryStmt(pCxt, &yymsp[0].minor.yy0); }
-#line 6874 "sql.c"
+#line 6893 "sql.c"
         break;
-      case 388: /* cmd ::= KILL TRANSACTION NK_INTEGER */
-#line 704 "sql.y"
+      case 391: /* cmd ::= KILL TRANSACTION NK_INTEGER */
+#line 707 "sql.y"
 { pCxt->pRootNode = createKillStmt(pCxt, QUERY_NODE_KILL_TRANSACTION_STMT, &yymsp[0].minor.yy0); }
-#line 6879 "sql.c"
+#line 6898 "sql.c"
         break;
-      case 389: /* cmd ::= KILL COMPACT NK_INTEGER */
-#line 705 "sql.y"
+      case 392: /* cmd ::= KILL COMPACT NK_INTEGER */
+#line 708 "sql.y"
 { pCxt->pRootNode = createKillStmt(pCxt, QUERY_NODE_KILL_COMPACT_STMT, &yymsp[0].minor.yy0); }
-#line 6884 "sql.c"
+#line 6903 "sql.c"
         break;
-      case 390: /* cmd ::= BALANCE VGROUP */
-#line 708 "sql.y"
+      case 393: /* cmd ::= BALANCE VGROUP */
+#line 711 "sql.y"
 { pCxt->pRootNode = createBalanceVgroupStmt(pCxt); }
-#line 6889 "sql.c"
+#line 6908 "sql.c"
         break;
-      case 391: /* cmd ::= BALANCE VGROUP LEADER on_vgroup_id */
-#line 709 "sql.y"
-{ pCxt->pRootNode = createBalanceVgroupLeaderStmt(pCxt, &yymsp[0].minor.yy993); }
-#line 6894 "sql.c"
+      case 394: /* cmd ::= BALANCE VGROUP LEADER on_vgroup_id */
+#line 712 "sql.y"
+{ pCxt->pRootNode = createBalanceVgroupLeaderStmt(pCxt, &yymsp[0].minor.yy929); }
+#line 6913 "sql.c"
         break;
-      case 392: /* cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER */
-#line 710 "sql.y"
+      case 395: /* cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER */
+#line 713 "sql.y"
 { pCxt->pRootNode = createMergeVgroupStmt(pCxt, &yymsp[-1].minor.yy0, &yymsp[0].minor.yy0); }
-#line 6899 "sql.c"
+#line 6918 "sql.c"
         break;
-      case 393: /* cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list */
-#line 711 "sql.y"
-{ pCxt->pRootNode = createRedistributeVgroupStmt(pCxt, &yymsp[-1].minor.yy0, yymsp[0].minor.yy88); }
-#line 6904 "sql.c"
+      case 396: /* cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list */
+#line 714 "sql.y"
+{ pCxt->pRootNode = createRedistributeVgroupStmt(pCxt, &yymsp[-1].minor.yy0, yymsp[0].minor.yy364); }
+#line 6923 "sql.c"
         break;
-      case 394: /* cmd ::= SPLIT VGROUP NK_INTEGER */
-#line 712 "sql.y"
+      case 397: /* cmd ::= SPLIT VGROUP NK_INTEGER */
+#line 715 "sql.y"
 { pCxt->pRootNode = createSplitVgroupStmt(pCxt, &yymsp[0].minor.yy0); }
-#line 6909 "sql.c"
-        break;
-      case 397: /* dnode_list ::= DNODE NK_INTEGER */
-#line 721 "sql.y"
-{ yymsp[-1].minor.yy88 = createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
-#line 6914 "sql.c"
+#line 6928 "sql.c"
         break;
-      case 399: /* cmd ::= DELETE FROM full_table_name where_clause_opt */
-#line 728 "sql.y"
-{ pCxt->pRootNode = createDeleteStmt(pCxt, yymsp[-1].minor.yy232, yymsp[0].minor.yy232); }
-#line 6919 "sql.c"
+      case 400: /* dnode_list ::= DNODE NK_INTEGER */
+#line 724 "sql.y"
+{ yymsp[-1].minor.yy364 = createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
+#line 6933 "sql.c"
         break;
-      case 402: /* insert_query ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery */
-#line 737 "sql.y"
-{ yymsp[-6].minor.yy232 = createInsertStmt(pCxt, yymsp[-4].minor.yy232, yymsp[-2].minor.yy88, yymsp[0].minor.yy232); }
-#line 6924 "sql.c"
+      case 402: /* cmd ::= DELETE FROM full_table_name where_clause_opt */
+#line 731 "sql.y"
+{ pCxt->pRootNode = createDeleteStmt(pCxt, yymsp[-1].minor.yy992, yymsp[0].minor.yy992); }
+#line 6938 "sql.c"
         break;
-      case 403: /* insert_query ::= INSERT INTO full_table_name query_or_subquery */
-#line 738 "sql.y"
-{ yymsp[-3].minor.yy232 = createInsertStmt(pCxt, yymsp[-1].minor.yy232, NULL, yymsp[0].minor.yy232); }
-#line 6929 "sql.c"
+      case 405: /* insert_query ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery */
+#line 740 "sql.y"
+{ yymsp[-6].minor.yy992 = createInsertStmt(pCxt, yymsp[-4].minor.yy992, yymsp[-2].minor.yy364, yymsp[0].minor.yy992); }
+#line 6943 "sql.c"
         break;
-      case 404: /* literal ::= NK_INTEGER */
+      case 406: /* insert_query ::= INSERT INTO full_table_name query_or_subquery */
 #line 741 "sql.y"
-{ yylhsminor.yy232 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0)); }
-#line 6934 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 405: /* literal ::= NK_FLOAT */
-#line 742 "sql.y"
-{ yylhsminor.yy232 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0)); }
-#line 6940 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 406: /* literal ::= NK_STRING */
-#line 743 "sql.y"
-{ yylhsminor.yy232 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0)); }
-#line 6946 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 407: /* literal ::= NK_BOOL */
+{ yymsp[-3].minor.yy992 = createInsertStmt(pCxt, yymsp[-1].minor.yy992, NULL, yymsp[0].minor.yy992); }
+#line 6948 "sql.c"
+        break;
+      case 407: /* literal ::= NK_INTEGER */
 #line 744 "sql.y"
-{ yylhsminor.yy232 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_BOOL, &yymsp[0].minor.yy0)); }
-#line 6952 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0)); }
+#line 6953 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
         break;
-      case 408: /* literal ::= TIMESTAMP NK_STRING */
+      case 408: /* literal ::= NK_FLOAT */
 #line 745 "sql.y"
-{ yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0)); }
-#line 6958 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 409: /* literal ::= duration_literal */
-      case 419: /* signed_literal ::= signed */ yytestcase(yyruleno==419);
-      case 442: /* expr_or_subquery ::= expression */ yytestcase(yyruleno==442);
-      case 443: /* expression ::= literal */ yytestcase(yyruleno==443);
-      case 445: /* expression ::= column_reference */ yytestcase(yyruleno==445);
-      case 446: /* expression ::= function_expression */ yytestcase(yyruleno==446);
-      case 447: /* expression ::= case_when_expression */ yytestcase(yyruleno==447);
-      case 480: /* function_expression ::= literal_func */ yytestcase(yyruleno==480);
-      case 529: /* boolean_value_expression ::= boolean_primary */ yytestcase(yyruleno==529);
-      case 533: /* boolean_primary ::= predicate */ yytestcase(yyruleno==533);
-      case 535: /* common_expression ::= expr_or_subquery */ yytestcase(yyruleno==535);
-      case 536: /* common_expression ::= boolean_value_expression */ yytestcase(yyruleno==536);
-      case 539: /* table_reference_list ::= table_reference */ yytestcase(yyruleno==539);
-      case 541: /* table_reference ::= table_primary */ yytestcase(yyruleno==541);
-      case 542: /* table_reference ::= joined_table */ yytestcase(yyruleno==542);
-      case 546: /* table_primary ::= parenthesized_joined_table */ yytestcase(yyruleno==546);
-      case 612: /* query_simple ::= query_specification */ yytestcase(yyruleno==612);
-      case 613: /* query_simple ::= union_query_expression */ yytestcase(yyruleno==613);
-      case 616: /* query_simple_or_subquery ::= query_simple */ yytestcase(yyruleno==616);
-      case 618: /* query_or_subquery ::= query_expression */ yytestcase(yyruleno==618);
+{ yylhsminor.yy992 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0)); }
+#line 6959 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 409: /* literal ::= NK_STRING */
 #line 746 "sql.y"
-{ yylhsminor.yy232 = yymsp[0].minor.yy232; }
-#line 6983 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0)); }
+#line 6965 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
         break;
-      case 410: /* literal ::= NULL */
+      case 410: /* literal ::= NK_BOOL */
 #line 747 "sql.y"
-{ yylhsminor.yy232 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_NULL, &yymsp[0].minor.yy0)); }
-#line 6989 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_BOOL, &yymsp[0].minor.yy0)); }
+#line 6971 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
         break;
-      case 411: /* literal ::= NK_QUESTION */
+      case 411: /* literal ::= TIMESTAMP NK_STRING */
 #line 748 "sql.y"
-{ yylhsminor.yy232 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createPlaceholderValueNode(pCxt, &yymsp[0].minor.yy0)); }
-#line 6995 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 412: /* duration_literal ::= NK_VARIABLE */
-      case 587: /* interval_sliding_duration_literal ::= NK_VARIABLE */ yytestcase(yyruleno==587);
-      case 588: /* interval_sliding_duration_literal ::= NK_STRING */ yytestcase(yyruleno==588);
-      case 589: /* interval_sliding_duration_literal ::= NK_INTEGER */ yytestcase(yyruleno==589);
+{ yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0)); }
+#line 6977 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 412: /* literal ::= duration_literal */
+      case 422: /* signed_literal ::= signed */ yytestcase(yyruleno==422);
+      case 445: /* expr_or_subquery ::= expression */ yytestcase(yyruleno==445);
+      case 446: /* expression ::= literal */ yytestcase(yyruleno==446);
+      case 448: /* expression ::= column_reference */ yytestcase(yyruleno==448);
+      case 449: /* expression ::= function_expression */ yytestcase(yyruleno==449);
+      case 450: /* expression ::= case_when_expression */ yytestcase(yyruleno==450);
+      case 483: /* function_expression ::= literal_func */ yytestcase(yyruleno==483);
+      case 532: /* boolean_value_expression ::= boolean_primary */ yytestcase(yyruleno==532);
+      case 536: /* boolean_primary ::= predicate */ yytestcase(yyruleno==536);
+      case 538: /* common_expression ::= expr_or_subquery */ yytestcase(yyruleno==538);
+      case 539: /* common_expression ::= boolean_value_expression */ yytestcase(yyruleno==539);
+      case 542: /* table_reference_list ::= table_reference */ yytestcase(yyruleno==542);
+      case 544: /* table_reference ::= table_primary */ yytestcase(yyruleno==544);
+      case 545: /* table_reference ::= joined_table */ yytestcase(yyruleno==545);
+      case 549: /* table_primary ::= parenthesized_joined_table */ yytestcase(yyruleno==549);
+      case 615: /* query_simple ::= query_specification */ yytestcase(yyruleno==615);
+      case 616: /* query_simple ::= union_query_expression */ yytestcase(yyruleno==616);
+      case 619: /* query_simple_or_subquery ::= query_simple */ yytestcase(yyruleno==619);
+      case 621: /* query_or_subquery ::= query_expression */ yytestcase(yyruleno==621);
+#line 749 "sql.y"
+{ yylhsminor.yy992 = yymsp[0].minor.yy992; }
+#line 7002 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 413: /* literal ::= NULL */
 #line 750 "sql.y"
-{ yylhsminor.yy232 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
-#line 7004 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 413: /* signed ::= NK_INTEGER */
-#line 752 "sql.y"
-{ yylhsminor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0); }
-#line 7010 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 414: /* signed ::= NK_PLUS NK_INTEGER */
+{ yylhsminor.yy992 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_NULL, &yymsp[0].minor.yy0)); }
+#line 7008 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 414: /* literal ::= NK_QUESTION */
+#line 751 "sql.y"
+{ yylhsminor.yy992 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createPlaceholderValueNode(pCxt, &yymsp[0].minor.yy0)); }
+#line 7014 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 415: /* duration_literal ::= NK_VARIABLE */
+      case 590: /* interval_sliding_duration_literal ::= NK_VARIABLE */ yytestcase(yyruleno==590);
+      case 591: /* interval_sliding_duration_literal ::= NK_STRING */ yytestcase(yyruleno==591);
+      case 592: /* interval_sliding_duration_literal ::= NK_INTEGER */ yytestcase(yyruleno==592);
 #line 753 "sql.y"
-{ yymsp[-1].minor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0); }
-#line 7016 "sql.c"
-        break;
-      case 415: /* signed ::= NK_MINUS NK_INTEGER */
-#line 754 "sql.y"
+{ yylhsminor.yy992 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
+#line 7023 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 416: /* signed ::= NK_INTEGER */
+#line 755 "sql.y"
+{ yylhsminor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0); }
+#line 7029 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 417: /* signed ::= NK_PLUS NK_INTEGER */
+#line 756 "sql.y"
+{ yymsp[-1].minor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0); }
+#line 7035 "sql.c"
+        break;
+      case 418: /* signed ::= NK_MINUS NK_INTEGER */
+#line 757 "sql.y"
 {
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
-                                                                                    yylhsminor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &t);
+                                                                                    yylhsminor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &t);
                                                                                   }
-#line 7025 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 416: /* signed ::= NK_FLOAT */
-#line 759 "sql.y"
-{ yylhsminor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0); }
-#line 7031 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 417: /* signed ::= NK_PLUS NK_FLOAT */
-#line 760 "sql.y"
-{ yymsp[-1].minor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0); }
-#line 7037 "sql.c"
-        break;
-      case 418: /* signed ::= NK_MINUS NK_FLOAT */
-#line 761 "sql.y"
+#line 7044 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 419: /* signed ::= NK_FLOAT */
+#line 762 "sql.y"
+{ yylhsminor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0); }
+#line 7050 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 420: /* signed ::= NK_PLUS NK_FLOAT */
+#line 763 "sql.y"
+{ yymsp[-1].minor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0); }
+#line 7056 "sql.c"
+        break;
+      case 421: /* signed ::= NK_MINUS NK_FLOAT */
+#line 764 "sql.y"
 {
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
-                                                                                    yylhsminor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &t);
+                                                                                    yylhsminor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &t);
                                                                                   }
-#line 7046 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 420: /* signed_literal ::= NK_STRING */
-#line 768 "sql.y"
-{ yylhsminor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0); }
-#line 7052 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 421: /* signed_literal ::= NK_BOOL */
-#line 769 "sql.y"
-{ yylhsminor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_BOOL, &yymsp[0].minor.yy0); }
-#line 7058 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 422: /* signed_literal ::= TIMESTAMP NK_STRING */
-#line 770 "sql.y"
-{ yymsp[-1].minor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0); }
-#line 7064 "sql.c"
-        break;
-      case 423: /* signed_literal ::= duration_literal */
-      case 425: /* signed_literal ::= literal_func */ yytestcase(yyruleno==425);
-      case 500: /* star_func_para ::= expr_or_subquery */ yytestcase(yyruleno==500);
-      case 566: /* select_item ::= common_expression */ yytestcase(yyruleno==566);
-      case 576: /* partition_item ::= expr_or_subquery */ yytestcase(yyruleno==576);
-      case 617: /* query_simple_or_subquery ::= subquery */ yytestcase(yyruleno==617);
-      case 619: /* query_or_subquery ::= subquery */ yytestcase(yyruleno==619);
-      case 632: /* search_condition ::= common_expression */ yytestcase(yyruleno==632);
+#line 7065 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 423: /* signed_literal ::= NK_STRING */
 #line 771 "sql.y"
-{ yylhsminor.yy232 = releaseRawExprNode(pCxt, yymsp[0].minor.yy232); }
-#line 7076 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
+{ yylhsminor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0); }
+#line 7071 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
         break;
-      case 424: /* signed_literal ::= NULL */
+      case 424: /* signed_literal ::= NK_BOOL */
 #line 772 "sql.y"
-{ yylhsminor.yy232 = createValueNode(pCxt, TSDB_DATA_TYPE_NULL, &yymsp[0].minor.yy0); }
-#line 7082 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 426: /* signed_literal ::= NK_QUESTION */
+{ yylhsminor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_BOOL, &yymsp[0].minor.yy0); }
+#line 7077 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 425: /* signed_literal ::= TIMESTAMP NK_STRING */
+#line 773 "sql.y"
+{ yymsp[-1].minor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0); }
+#line 7083 "sql.c"
+        break;
+      case 426: /* signed_literal ::= duration_literal */
+      case 428: /* signed_literal ::= literal_func */ yytestcase(yyruleno==428);
+      case 503: /* star_func_para ::= expr_or_subquery */ yytestcase(yyruleno==503);
+      case 569: /* select_item ::= common_expression */ yytestcase(yyruleno==569);
+      case 579: /* partition_item ::= expr_or_subquery */ yytestcase(yyruleno==579);
+      case 620: /* query_simple_or_subquery ::= subquery */ yytestcase(yyruleno==620);
+      case 622: /* query_or_subquery ::= subquery */ yytestcase(yyruleno==622);
+      case 635: /* search_condition ::= common_expression */ yytestcase(yyruleno==635);
 #line 774 "sql.y"
-{ yylhsminor.yy232 = createPlaceholderValueNode(pCxt, &yymsp[0].minor.yy0); }
-#line 7088 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 444: /* expression ::= pseudo_column */
-#line 836 "sql.y"
-{ yylhsminor.yy232 = yymsp[0].minor.yy232; setRawExprNodeIsPseudoColumn(pCxt, yylhsminor.yy232, true); }
-#line 7094 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 448: /* expression ::= NK_LP expression NK_RP */
-      case 534: /* boolean_primary ::= NK_LP boolean_value_expression NK_RP */ yytestcase(yyruleno==534);
-      case 631: /* subquery ::= NK_LP subquery NK_RP */ yytestcase(yyruleno==631);
-#line 840 "sql.y"
-{ yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, releaseRawExprNode(pCxt, yymsp[-1].minor.yy232)); }
-#line 7102 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 449: /* expression ::= NK_PLUS expr_or_subquery */
-#line 841 "sql.y"
+{ yylhsminor.yy992 = releaseRawExprNode(pCxt, yymsp[0].minor.yy992); }
+#line 7095 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 427: /* signed_literal ::= NULL */
+#line 775 "sql.y"
+{ yylhsminor.yy992 = createValueNode(pCxt, TSDB_DATA_TYPE_NULL, &yymsp[0].minor.yy0); }
+#line 7101 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 429: /* signed_literal ::= NK_QUESTION */
+#line 777 "sql.y"
+{ yylhsminor.yy992 = createPlaceholderValueNode(pCxt, &yymsp[0].minor.yy0); }
+#line 7107 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 447: /* expression ::= pseudo_column */
+#line 839 "sql.y"
+{ yylhsminor.yy992 = yymsp[0].minor.yy992; setRawExprNodeIsPseudoColumn(pCxt, yylhsminor.yy992, true); }
+#line 7113 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 451: /* expression ::= NK_LP expression NK_RP */
+      case 537: /* boolean_primary ::= NK_LP boolean_value_expression NK_RP */ yytestcase(yyruleno==537);
+      case 634: /* subquery ::= NK_LP subquery NK_RP */ yytestcase(yyruleno==634);
+#line 843 "sql.y"
+{ yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, releaseRawExprNode(pCxt, yymsp[-1].minor.yy992)); }
+#line 7121 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 452: /* expression ::= NK_PLUS expr_or_subquery */
+#line 844 "sql.y"
 {
-                                                                                    SToken t = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &t, releaseRawExprNode(pCxt, yymsp[0].minor.yy232));
+                                                                                    SToken t = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &t, releaseRawExprNode(pCxt, yymsp[0].minor.yy992));
                                                                                   }
-#line 7111 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
+#line 7130 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
         break;
-      case 450: /* expression ::= NK_MINUS expr_or_subquery */
-#line 845 "sql.y"
+      case 453: /* expression ::= NK_MINUS expr_or_subquery */
+#line 848 "sql.y"
 {
-                                                                                    SToken t = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &t, createOperatorNode(pCxt, OP_TYPE_MINUS, releaseRawExprNode(pCxt, yymsp[0].minor.yy232), NULL));
+                                                                                    SToken t = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &t, createOperatorNode(pCxt, OP_TYPE_MINUS, releaseRawExprNode(pCxt, yymsp[0].minor.yy992), NULL));
                                                                                   }
-#line 7120 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
+#line 7139 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
         break;
-      case 451: /* expression ::= expr_or_subquery NK_PLUS expr_or_subquery */
-#line 849 "sql.y"
+      case 454: /* expression ::= expr_or_subquery NK_PLUS expr_or_subquery */
+#line 852 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy232);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_ADD, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), releaseRawExprNode(pCxt, yymsp[0].minor.yy232)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy992);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_ADD, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), releaseRawExprNode(pCxt, yymsp[0].minor.yy992)));
                                                                                   }
-#line 7130 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+#line 7149 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 452: /* expression ::= expr_or_subquery NK_MINUS expr_or_subquery */
-#line 854 "sql.y"
+      case 455: /* expression ::= expr_or_subquery NK_MINUS expr_or_subquery */
+#line 857 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy232);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_SUB, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), releaseRawExprNode(pCxt, yymsp[0].minor.yy232)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy992);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_SUB, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), releaseRawExprNode(pCxt, yymsp[0].minor.yy992)));
                                                                                   }
-#line 7140 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+#line 7159 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 453: /* expression ::= expr_or_subquery NK_STAR expr_or_subquery */
-#line 859 "sql.y"
+      case 456: /* expression ::= expr_or_subquery NK_STAR expr_or_subquery */
+#line 862 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy232);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_MULTI, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), releaseRawExprNode(pCxt, yymsp[0].minor.yy232)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy992);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_MULTI, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), releaseRawExprNode(pCxt, yymsp[0].minor.yy992)));
                                                                                   }
-#line 7150 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+#line 7169 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 454: /* expression ::= expr_or_subquery NK_SLASH expr_or_subquery */
-#line 864 "sql.y"
+      case 457: /* expression ::= expr_or_subquery NK_SLASH expr_or_subquery */
+#line 867 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy232);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_DIV, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), releaseRawExprNode(pCxt, yymsp[0].minor.yy232)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy992);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_DIV, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), releaseRawExprNode(pCxt, yymsp[0].minor.yy992)));
                                                                                   }
-#line 7160 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+#line 7179 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 455: /* expression ::= expr_or_subquery NK_REM expr_or_subquery */
-#line 869 "sql.y"
+      case 458: /* expression ::= expr_or_subquery NK_REM expr_or_subquery */
+#line 872 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy232);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_REM, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), releaseRawExprNode(pCxt, yymsp[0].minor.yy232)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy992);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_REM, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), releaseRawExprNode(pCxt, yymsp[0].minor.yy992)));
                                                                                   }
-#line 7170 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+#line 7189 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 456: /* expression ::= column_reference NK_ARROW NK_STRING */
-#line 874 "sql.y"
+      case 459: /* expression ::= column_reference NK_ARROW NK_STRING */
+#line 877 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_JSON_GET_VALUE, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_JSON_GET_VALUE, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0)));
                                                                                   }
-#line 7179 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+#line 7198 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 457: /* expression ::= expr_or_subquery NK_BITAND expr_or_subquery */
-#line 878 "sql.y"
+      case 460: /* expression ::= expr_or_subquery NK_BITAND expr_or_subquery */
+#line 881 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy232);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_BIT_AND, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), releaseRawExprNode(pCxt, yymsp[0].minor.yy232)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy992);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_BIT_AND, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), releaseRawExprNode(pCxt, yymsp[0].minor.yy992)));
                                                                                   }
-#line 7189 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+#line 7208 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 458: /* expression ::= expr_or_subquery NK_BITOR expr_or_subquery */
-#line 883 "sql.y"
+      case 461: /* expression ::= expr_or_subquery NK_BITOR expr_or_subquery */
+#line 886 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy232);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_BIT_OR, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), releaseRawExprNode(pCxt, yymsp[0].minor.yy232)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy992);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_BIT_OR, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), releaseRawExprNode(pCxt, yymsp[0].minor.yy992)));
                                                                                   }
-#line 7199 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 461: /* column_reference ::= column_name */
-#line 894 "sql.y"
-{ yylhsminor.yy232 = createRawExprNode(pCxt, &yymsp[0].minor.yy993, createColumnNode(pCxt, NULL, &yymsp[0].minor.yy993)); }
-#line 7205 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 462: /* column_reference ::= table_name NK_DOT column_name */
-#line 895 "sql.y"
-{ yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy993, &yymsp[0].minor.yy993, createColumnNode(pCxt, &yymsp[-2].minor.yy993, &yymsp[0].minor.yy993)); }
-#line 7211 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 463: /* column_reference ::= NK_ALIAS */
-#line 896 "sql.y"
-{ yylhsminor.yy232 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createColumnNode(pCxt, NULL, &yymsp[0].minor.yy0)); }
-#line 7217 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 464: /* column_reference ::= table_name NK_DOT NK_ALIAS */
+#line 7218 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 464: /* column_reference ::= column_name */
 #line 897 "sql.y"
-{ yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy993, &yymsp[0].minor.yy0, createColumnNode(pCxt, &yymsp[-2].minor.yy993, &yymsp[0].minor.yy0)); }
-#line 7223 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 465: /* pseudo_column ::= ROWTS */
-      case 466: /* pseudo_column ::= TBNAME */ yytestcase(yyruleno==466);
-      case 468: /* pseudo_column ::= QSTART */ yytestcase(yyruleno==468);
-      case 469: /* pseudo_column ::= QEND */ yytestcase(yyruleno==469);
-      case 470: /* pseudo_column ::= QDURATION */ yytestcase(yyruleno==470);
-      case 471: /* pseudo_column ::= WSTART */ yytestcase(yyruleno==471);
-      case 472: /* pseudo_column ::= WEND */ yytestcase(yyruleno==472);
-      case 473: /* pseudo_column ::= WDURATION */ yytestcase(yyruleno==473);
-      case 474: /* pseudo_column ::= IROWTS */ yytestcase(yyruleno==474);
-      case 475: /* pseudo_column ::= ISFILLED */ yytestcase(yyruleno==475);
-      case 476: /* pseudo_column ::= QTAGS */ yytestcase(yyruleno==476);
-      case 482: /* literal_func ::= NOW */ yytestcase(yyruleno==482);
+{ yylhsminor.yy992 = createRawExprNode(pCxt, &yymsp[0].minor.yy929, createColumnNode(pCxt, NULL, &yymsp[0].minor.yy929)); }
+#line 7224 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 465: /* column_reference ::= table_name NK_DOT column_name */
+#line 898 "sql.y"
+{ yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy929, &yymsp[0].minor.yy929, createColumnNode(pCxt, &yymsp[-2].minor.yy929, &yymsp[0].minor.yy929)); }
+#line 7230 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 466: /* column_reference ::= NK_ALIAS */
 #line 899 "sql.y"
-{ yylhsminor.yy232 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[0].minor.yy0, NULL)); }
-#line 7240 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 467: /* pseudo_column ::= table_name NK_DOT TBNAME */
-#line 901 "sql.y"
-{ yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy993, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[0].minor.yy0, createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[-2].minor.yy993)))); }
-#line 7246 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 477: /* function_expression ::= function_name NK_LP expression_list NK_RP */
-      case 478: /* function_expression ::= star_func NK_LP star_func_para_list NK_RP */ yytestcase(yyruleno==478);
-#line 912 "sql.y"
-{ yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-3].minor.yy993, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[-3].minor.yy993, yymsp[-1].minor.yy88)); }
-#line 7253 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 479: /* function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP */
-#line 915 "sql.y"
-{ yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-5].minor.yy0, &yymsp[0].minor.yy0, createCastFunctionNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy232), yymsp[-1].minor.yy400)); }
+{ yylhsminor.yy992 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createColumnNode(pCxt, NULL, &yymsp[0].minor.yy0)); }
+#line 7236 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 467: /* column_reference ::= table_name NK_DOT NK_ALIAS */
+#line 900 "sql.y"
+{ yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy929, &yymsp[0].minor.yy0, createColumnNode(pCxt, &yymsp[-2].minor.yy929, &yymsp[0].minor.yy0)); }
+#line 7242 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 468: /* pseudo_column ::= ROWTS */
+      case 469: /* pseudo_column ::= TBNAME */ yytestcase(yyruleno==469);
+      case 471: /* pseudo_column ::= QSTART */ yytestcase(yyruleno==471);
+      case 472: /* pseudo_column ::= QEND */ yytestcase(yyruleno==472);
+      case 473: /* pseudo_column ::= QDURATION */ yytestcase(yyruleno==473);
+      case 474: /* pseudo_column ::= WSTART */ yytestcase(yyruleno==474);
+      case 475: /* pseudo_column ::= WEND */ yytestcase(yyruleno==475);
+      case 476: /* pseudo_column ::= WDURATION */ yytestcase(yyruleno==476);
+      case 477: /* pseudo_column ::= IROWTS */ yytestcase(yyruleno==477);
+      case 478: /* pseudo_column ::= ISFILLED */ yytestcase(yyruleno==478);
+      case 479: /* pseudo_column ::= QTAGS */ yytestcase(yyruleno==479);
+      case 485: /* literal_func ::= NOW */ yytestcase(yyruleno==485);
+#line 902 "sql.y"
+{ yylhsminor.yy992 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[0].minor.yy0, NULL)); }
 #line 7259 "sql.c"
-  yymsp[-5].minor.yy232 = yylhsminor.yy232;
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
         break;
-      case 481: /* literal_func ::= noarg_func NK_LP NK_RP */
-#line 918 "sql.y"
-{ yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy993, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[-2].minor.yy993, NULL)); }
+      case 470: /* pseudo_column ::= table_name NK_DOT TBNAME */
+#line 904 "sql.y"
+{ yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy929, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[0].minor.yy0, createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[-2].minor.yy929)))); }
 #line 7265 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 496: /* star_func_para_list ::= NK_STAR */
-#line 942 "sql.y"
-{ yylhsminor.yy88 = createNodeList(pCxt, createColumnNode(pCxt, NULL, &yymsp[0].minor.yy0)); }
-#line 7271 "sql.c"
-  yymsp[0].minor.yy88 = yylhsminor.yy88;
-        break;
-      case 501: /* star_func_para ::= table_name NK_DOT NK_STAR */
-      case 569: /* select_item ::= table_name NK_DOT NK_STAR */ yytestcase(yyruleno==569);
-#line 951 "sql.y"
-{ yylhsminor.yy232 = createColumnNode(pCxt, &yymsp[-2].minor.yy993, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 480: /* function_expression ::= function_name NK_LP expression_list NK_RP */
+      case 481: /* function_expression ::= star_func NK_LP star_func_para_list NK_RP */ yytestcase(yyruleno==481);
+#line 915 "sql.y"
+{ yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-3].minor.yy929, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[-3].minor.yy929, yymsp[-1].minor.yy364)); }
+#line 7272 "sql.c"
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 482: /* function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP */
+#line 918 "sql.y"
+{ yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-5].minor.yy0, &yymsp[0].minor.yy0, createCastFunctionNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy992), yymsp[-1].minor.yy184)); }
 #line 7278 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+  yymsp[-5].minor.yy992 = yylhsminor.yy992;
         break;
-      case 502: /* case_when_expression ::= CASE when_then_list case_when_else_opt END */
-#line 954 "sql.y"
-{ yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-3].minor.yy0, &yymsp[0].minor.yy0, createCaseWhenNode(pCxt, NULL, yymsp[-2].minor.yy88, yymsp[-1].minor.yy232)); }
+      case 484: /* literal_func ::= noarg_func NK_LP NK_RP */
+#line 921 "sql.y"
+{ yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy929, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[-2].minor.yy929, NULL)); }
 #line 7284 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 503: /* case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END */
-#line 956 "sql.y"
-{ yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-4].minor.yy0, &yymsp[0].minor.yy0, createCaseWhenNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy232), yymsp[-2].minor.yy88, yymsp[-1].minor.yy232)); }
+      case 499: /* star_func_para_list ::= NK_STAR */
+#line 945 "sql.y"
+{ yylhsminor.yy364 = createNodeList(pCxt, createColumnNode(pCxt, NULL, &yymsp[0].minor.yy0)); }
 #line 7290 "sql.c"
-  yymsp[-4].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 506: /* when_then_expr ::= WHEN common_expression THEN common_expression */
-#line 963 "sql.y"
-{ yymsp[-3].minor.yy232 = createWhenThenNode(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), releaseRawExprNode(pCxt, yymsp[0].minor.yy232)); }
-#line 7296 "sql.c"
+  yymsp[0].minor.yy364 = yylhsminor.yy364;
         break;
-      case 508: /* case_when_else_opt ::= ELSE common_expression */
+      case 504: /* star_func_para ::= table_name NK_DOT NK_STAR */
+      case 572: /* select_item ::= table_name NK_DOT NK_STAR */ yytestcase(yyruleno==572);
+#line 954 "sql.y"
+{ yylhsminor.yy992 = createColumnNode(pCxt, &yymsp[-2].minor.yy929, &yymsp[0].minor.yy0); }
+#line 7297 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 505: /* case_when_expression ::= CASE when_then_list case_when_else_opt END */
+#line 957 "sql.y"
+{ yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-3].minor.yy0, &yymsp[0].minor.yy0, createCaseWhenNode(pCxt, NULL, yymsp[-2].minor.yy364, yymsp[-1].minor.yy992)); }
+#line 7303 "sql.c"
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 506: /* case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END */
+#line 959 "sql.y"
+{ yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-4].minor.yy0, &yymsp[0].minor.yy0, createCaseWhenNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy992), yymsp[-2].minor.yy364, yymsp[-1].minor.yy992)); }
+#line 7309 "sql.c"
+  yymsp[-4].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 509: /* when_then_expr ::= WHEN common_expression THEN common_expression */
 #line 966 "sql.y"
-{ yymsp[-1].minor.yy232 = releaseRawExprNode(pCxt, yymsp[0].minor.yy232); }
-#line 7301 "sql.c"
+{ yymsp[-3].minor.yy992 = createWhenThenNode(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), releaseRawExprNode(pCxt, yymsp[0].minor.yy992)); }
+#line 7315 "sql.c"
         break;
-      case 509: /* predicate ::= expr_or_subquery compare_op expr_or_subquery */
-      case 514: /* predicate ::= expr_or_subquery in_op in_predicate_value */ yytestcase(yyruleno==514);
+      case 511: /* case_when_else_opt ::= ELSE common_expression */
 #line 969 "sql.y"
+{ yymsp[-1].minor.yy992 = releaseRawExprNode(pCxt, yymsp[0].minor.yy992); }
+#line 7320 "sql.c"
+        break;
+      case 512: /* predicate ::= expr_or_subquery compare_op expr_or_subquery */
+      case 517: /* predicate ::= expr_or_subquery in_op in_predicate_value */ yytestcase(yyruleno==517);
+#line 972 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy232);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, yymsp[-1].minor.yy708, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), releaseRawExprNode(pCxt, yymsp[0].minor.yy232)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy992);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, yymsp[-1].minor.yy20, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), releaseRawExprNode(pCxt, yymsp[0].minor.yy992)));
                                                                                   }
-#line 7311 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+#line 7330 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 510: /* predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery */
-#line 976 "sql.y"
+      case 513: /* predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery */
+#line 979 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-4].minor.yy232);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &e, createBetweenAnd(pCxt, releaseRawExprNode(pCxt, yymsp[-4].minor.yy232), releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), releaseRawExprNode(pCxt, yymsp[0].minor.yy232)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-4].minor.yy992);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &e, createBetweenAnd(pCxt, releaseRawExprNode(pCxt, yymsp[-4].minor.yy992), releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), releaseRawExprNode(pCxt, yymsp[0].minor.yy992)));
                                                                                   }
-#line 7321 "sql.c"
-  yymsp[-4].minor.yy232 = yylhsminor.yy232;
+#line 7340 "sql.c"
+  yymsp[-4].minor.yy992 = yylhsminor.yy992;
         break;
-      case 511: /* predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery */
-#line 982 "sql.y"
+      case 514: /* predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery */
+#line 985 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-5].minor.yy232);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &e, createNotBetweenAnd(pCxt, releaseRawExprNode(pCxt, yymsp[-5].minor.yy232), releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), releaseRawExprNode(pCxt, yymsp[0].minor.yy232)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-5].minor.yy992);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &e, createNotBetweenAnd(pCxt, releaseRawExprNode(pCxt, yymsp[-5].minor.yy992), releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), releaseRawExprNode(pCxt, yymsp[0].minor.yy992)));
                                                                                   }
-#line 7331 "sql.c"
-  yymsp[-5].minor.yy232 = yylhsminor.yy232;
+#line 7350 "sql.c"
+  yymsp[-5].minor.yy992 = yylhsminor.yy992;
         break;
-      case 512: /* predicate ::= expr_or_subquery IS NULL */
-#line 987 "sql.y"
+      case 515: /* predicate ::= expr_or_subquery IS NULL */
+#line 990 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_IS_NULL, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), NULL));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_IS_NULL, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), NULL));
                                                                                   }
-#line 7340 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+#line 7359 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 513: /* predicate ::= expr_or_subquery IS NOT NULL */
-#line 991 "sql.y"
+      case 516: /* predicate ::= expr_or_subquery IS NOT NULL */
+#line 994 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-3].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_IS_NOT_NULL, releaseRawExprNode(pCxt, yymsp[-3].minor.yy232), NULL));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-3].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_IS_NOT_NULL, releaseRawExprNode(pCxt, yymsp[-3].minor.yy992), NULL));
                                                                                   }
-#line 7349 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 515: /* compare_op ::= NK_LT */
-#line 1003 "sql.y"
-{ yymsp[0].minor.yy708 = OP_TYPE_LOWER_THAN; }
-#line 7355 "sql.c"
-        break;
-      case 516: /* compare_op ::= NK_GT */
-#line 1004 "sql.y"
-{ yymsp[0].minor.yy708 = OP_TYPE_GREATER_THAN; }
-#line 7360 "sql.c"
+#line 7368 "sql.c"
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
         break;
-      case 517: /* compare_op ::= NK_LE */
-#line 1005 "sql.y"
-{ yymsp[0].minor.yy708 = OP_TYPE_LOWER_EQUAL; }
-#line 7365 "sql.c"
-        break;
-      case 518: /* compare_op ::= NK_GE */
+      case 518: /* compare_op ::= NK_LT */
 #line 1006 "sql.y"
-{ yymsp[0].minor.yy708 = OP_TYPE_GREATER_EQUAL; }
-#line 7370 "sql.c"
+{ yymsp[0].minor.yy20 = OP_TYPE_LOWER_THAN; }
+#line 7374 "sql.c"
         break;
-      case 519: /* compare_op ::= NK_NE */
+      case 519: /* compare_op ::= NK_GT */
 #line 1007 "sql.y"
-{ yymsp[0].minor.yy708 = OP_TYPE_NOT_EQUAL; }
-#line 7375 "sql.c"
+{ yymsp[0].minor.yy20 = OP_TYPE_GREATER_THAN; }
+#line 7379 "sql.c"
         break;
-      case 520: /* compare_op ::= NK_EQ */
+      case 520: /* compare_op ::= NK_LE */
 #line 1008 "sql.y"
-{ yymsp[0].minor.yy708 = OP_TYPE_EQUAL; }
-#line 7380 "sql.c"
+{ yymsp[0].minor.yy20 = OP_TYPE_LOWER_EQUAL; }
+#line 7384 "sql.c"
         break;
-      case 521: /* compare_op ::= LIKE */
+      case 521: /* compare_op ::= NK_GE */
 #line 1009 "sql.y"
-{ yymsp[0].minor.yy708 = OP_TYPE_LIKE; }
-#line 7385 "sql.c"
+{ yymsp[0].minor.yy20 = OP_TYPE_GREATER_EQUAL; }
+#line 7389 "sql.c"
         break;
-      case 522: /* compare_op ::= NOT LIKE */
+      case 522: /* compare_op ::= NK_NE */
 #line 1010 "sql.y"
-{ yymsp[-1].minor.yy708 = OP_TYPE_NOT_LIKE; }
-#line 7390 "sql.c"
+{ yymsp[0].minor.yy20 = OP_TYPE_NOT_EQUAL; }
+#line 7394 "sql.c"
         break;
-      case 523: /* compare_op ::= MATCH */
+      case 523: /* compare_op ::= NK_EQ */
 #line 1011 "sql.y"
-{ yymsp[0].minor.yy708 = OP_TYPE_MATCH; }
-#line 7395 "sql.c"
+{ yymsp[0].minor.yy20 = OP_TYPE_EQUAL; }
+#line 7399 "sql.c"
         break;
-      case 524: /* compare_op ::= NMATCH */
+      case 524: /* compare_op ::= LIKE */
 #line 1012 "sql.y"
-{ yymsp[0].minor.yy708 = OP_TYPE_NMATCH; }
-#line 7400 "sql.c"
+{ yymsp[0].minor.yy20 = OP_TYPE_LIKE; }
+#line 7404 "sql.c"
         break;
-      case 525: /* compare_op ::= CONTAINS */
+      case 525: /* compare_op ::= NOT LIKE */
 #line 1013 "sql.y"
-{ yymsp[0].minor.yy708 = OP_TYPE_JSON_CONTAINS; }
-#line 7405 "sql.c"
+{ yymsp[-1].minor.yy20 = OP_TYPE_NOT_LIKE; }
+#line 7409 "sql.c"
+        break;
+      case 526: /* compare_op ::= MATCH */
+#line 1014 "sql.y"
+{ yymsp[0].minor.yy20 = OP_TYPE_MATCH; }
+#line 7414 "sql.c"
         break;
-      case 526: /* in_op ::= IN */
-#line 1017 "sql.y"
-{ yymsp[0].minor.yy708 = OP_TYPE_IN; }
-#line 7410 "sql.c"
+      case 527: /* compare_op ::= NMATCH */
+#line 1015 "sql.y"
+{ yymsp[0].minor.yy20 = OP_TYPE_NMATCH; }
+#line 7419 "sql.c"
         break;
-      case 527: /* in_op ::= NOT IN */
-#line 1018 "sql.y"
-{ yymsp[-1].minor.yy708 = OP_TYPE_NOT_IN; }
-#line 7415 "sql.c"
+      case 528: /* compare_op ::= CONTAINS */
+#line 1016 "sql.y"
+{ yymsp[0].minor.yy20 = OP_TYPE_JSON_CONTAINS; }
+#line 7424 "sql.c"
         break;
-      case 528: /* in_predicate_value ::= NK_LP literal_list NK_RP */
+      case 529: /* in_op ::= IN */
 #line 1020 "sql.y"
-{ yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, createNodeListNode(pCxt, yymsp[-1].minor.yy88)); }
-#line 7420 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+{ yymsp[0].minor.yy20 = OP_TYPE_IN; }
+#line 7429 "sql.c"
+        break;
+      case 530: /* in_op ::= NOT IN */
+#line 1021 "sql.y"
+{ yymsp[-1].minor.yy20 = OP_TYPE_NOT_IN; }
+#line 7434 "sql.c"
         break;
-      case 530: /* boolean_value_expression ::= NOT boolean_primary */
-#line 1024 "sql.y"
+      case 531: /* in_predicate_value ::= NK_LP literal_list NK_RP */
+#line 1023 "sql.y"
+{ yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, createNodeListNode(pCxt, yymsp[-1].minor.yy364)); }
+#line 7439 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 533: /* boolean_value_expression ::= NOT boolean_primary */
+#line 1027 "sql.y"
 {
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &e, createLogicConditionNode(pCxt, LOGIC_COND_TYPE_NOT, releaseRawExprNode(pCxt, yymsp[0].minor.yy232), NULL));
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &e, createLogicConditionNode(pCxt, LOGIC_COND_TYPE_NOT, releaseRawExprNode(pCxt, yymsp[0].minor.yy992), NULL));
                                                                                   }
-#line 7429 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
+#line 7448 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
         break;
-      case 531: /* boolean_value_expression ::= boolean_value_expression OR boolean_value_expression */
-#line 1029 "sql.y"
+      case 534: /* boolean_value_expression ::= boolean_value_expression OR boolean_value_expression */
+#line 1032 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy232);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &e, createLogicConditionNode(pCxt, LOGIC_COND_TYPE_OR, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), releaseRawExprNode(pCxt, yymsp[0].minor.yy232)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy992);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &e, createLogicConditionNode(pCxt, LOGIC_COND_TYPE_OR, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), releaseRawExprNode(pCxt, yymsp[0].minor.yy992)));
                                                                                   }
-#line 7439 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
+#line 7458 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 532: /* boolean_value_expression ::= boolean_value_expression AND boolean_value_expression */
-#line 1035 "sql.y"
+      case 535: /* boolean_value_expression ::= boolean_value_expression AND boolean_value_expression */
+#line 1038 "sql.y"
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy232);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy232);
-                                                                                    yylhsminor.yy232 = createRawExprNodeExt(pCxt, &s, &e, createLogicConditionNode(pCxt, LOGIC_COND_TYPE_AND, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), releaseRawExprNode(pCxt, yymsp[0].minor.yy232)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy992);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy992);
+                                                                                    yylhsminor.yy992 = createRawExprNodeExt(pCxt, &s, &e, createLogicConditionNode(pCxt, LOGIC_COND_TYPE_AND, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), releaseRawExprNode(pCxt, yymsp[0].minor.yy992)));
                                                                                   }
-#line 7449 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 540: /* table_reference_list ::= table_reference_list NK_COMMA table_reference */
-#line 1053 "sql.y"
-{ yylhsminor.yy232 = createJoinTableNode(pCxt, JOIN_TYPE_INNER, yymsp[-2].minor.yy232, yymsp[0].minor.yy232, NULL); }
-#line 7455 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 543: /* table_primary ::= table_name alias_opt */
-#line 1059 "sql.y"
-{ yylhsminor.yy232 = createRealTableNode(pCxt, NULL, &yymsp[-1].minor.yy993, &yymsp[0].minor.yy993); }
-#line 7461 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 544: /* table_primary ::= db_name NK_DOT table_name alias_opt */
-#line 1060 "sql.y"
-{ yylhsminor.yy232 = createRealTableNode(pCxt, &yymsp[-3].minor.yy993, &yymsp[-1].minor.yy993, &yymsp[0].minor.yy993); }
-#line 7467 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 545: /* table_primary ::= subquery alias_opt */
-#line 1061 "sql.y"
-{ yylhsminor.yy232 = createTempTableNode(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy232), &yymsp[0].minor.yy993); }
-#line 7473 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 547: /* alias_opt ::= */
-#line 1066 "sql.y"
-{ yymsp[1].minor.yy993 = nil_token;  }
-#line 7479 "sql.c"
-        break;
-      case 549: /* alias_opt ::= AS table_alias */
-#line 1068 "sql.y"
-{ yymsp[-1].minor.yy993 = yymsp[0].minor.yy993; }
-#line 7484 "sql.c"
-        break;
-      case 550: /* parenthesized_joined_table ::= NK_LP joined_table NK_RP */
-      case 551: /* parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP */ yytestcase(yyruleno==551);
-#line 1070 "sql.y"
-{ yymsp[-2].minor.yy232 = yymsp[-1].minor.yy232; }
-#line 7490 "sql.c"
-        break;
-      case 552: /* joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
-#line 1075 "sql.y"
-{ yylhsminor.yy232 = createJoinTableNode(pCxt, yymsp[-4].minor.yy436, yymsp[-5].minor.yy232, yymsp[-2].minor.yy232, yymsp[0].minor.yy232); }
-#line 7495 "sql.c"
-  yymsp[-5].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 553: /* join_type ::= */
-#line 1079 "sql.y"
-{ yymsp[1].minor.yy436 = JOIN_TYPE_INNER; }
-#line 7501 "sql.c"
-        break;
-      case 554: /* join_type ::= INNER */
-#line 1080 "sql.y"
-{ yymsp[0].minor.yy436 = JOIN_TYPE_INNER; }
-#line 7506 "sql.c"
-        break;
-      case 555: /* query_specification ::= SELECT hint_list set_quantifier_opt tag_mode_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
-#line 1086 "sql.y"
+#line 7468 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 543: /* table_reference_list ::= table_reference_list NK_COMMA table_reference */
+#line 1056 "sql.y"
+{ yylhsminor.yy992 = createJoinTableNode(pCxt, JOIN_TYPE_INNER, yymsp[-2].minor.yy992, yymsp[0].minor.yy992, NULL); }
+#line 7474 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 546: /* table_primary ::= table_name alias_opt */
+#line 1062 "sql.y"
+{ yylhsminor.yy992 = createRealTableNode(pCxt, NULL, &yymsp[-1].minor.yy929, &yymsp[0].minor.yy929); }
+#line 7480 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 547: /* table_primary ::= db_name NK_DOT table_name alias_opt */
+#line 1063 "sql.y"
+{ yylhsminor.yy992 = createRealTableNode(pCxt, &yymsp[-3].minor.yy929, &yymsp[-1].minor.yy929, &yymsp[0].minor.yy929); }
+#line 7486 "sql.c"
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 548: /* table_primary ::= subquery alias_opt */
+#line 1064 "sql.y"
+{ yylhsminor.yy992 = createTempTableNode(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy992), &yymsp[0].minor.yy929); }
+#line 7492 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 550: /* alias_opt ::= */
+#line 1069 "sql.y"
+{ yymsp[1].minor.yy929 = nil_token;  }
+#line 7498 "sql.c"
+        break;
+      case 552: /* alias_opt ::= AS table_alias */
+#line 1071 "sql.y"
+{ yymsp[-1].minor.yy929 = yymsp[0].minor.yy929; }
+#line 7503 "sql.c"
+        break;
+      case 553: /* parenthesized_joined_table ::= NK_LP joined_table NK_RP */
+      case 554: /* parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP */ yytestcase(yyruleno==554);
+#line 1073 "sql.y"
+{ yymsp[-2].minor.yy992 = yymsp[-1].minor.yy992; }
+#line 7509 "sql.c"
+        break;
+      case 555: /* joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
+#line 1078 "sql.y"
+{ yylhsminor.yy992 = createJoinTableNode(pCxt, yymsp[-4].minor.yy732, yymsp[-5].minor.yy992, yymsp[-2].minor.yy992, yymsp[0].minor.yy992); }
+#line 7514 "sql.c"
+  yymsp[-5].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 556: /* join_type ::= */
+#line 1082 "sql.y"
+{ yymsp[1].minor.yy732 = JOIN_TYPE_INNER; }
+#line 7520 "sql.c"
+        break;
+      case 557: /* join_type ::= INNER */
+#line 1083 "sql.y"
+{ yymsp[0].minor.yy732 = JOIN_TYPE_INNER; }
+#line 7525 "sql.c"
+        break;
+      case 558: /* query_specification ::= SELECT hint_list set_quantifier_opt tag_mode_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
+#line 1089 "sql.y"
 {
-                                                                                    yymsp[-13].minor.yy232 = createSelectStmt(pCxt, yymsp[-11].minor.yy985, yymsp[-9].minor.yy88, yymsp[-8].minor.yy232, yymsp[-12].minor.yy88);
-                                                                                    yymsp[-13].minor.yy232 = setSelectStmtTagMode(pCxt, yymsp[-13].minor.yy232, yymsp[-10].minor.yy985);
-                                                                                    yymsp[-13].minor.yy232 = addWhereClause(pCxt, yymsp[-13].minor.yy232, yymsp[-7].minor.yy232);
-                                                                                    yymsp[-13].minor.yy232 = addPartitionByClause(pCxt, yymsp[-13].minor.yy232, yymsp[-6].minor.yy88);
-                                                                                    yymsp[-13].minor.yy232 = addWindowClauseClause(pCxt, yymsp[-13].minor.yy232, yymsp[-2].minor.yy232);
-                                                                                    yymsp[-13].minor.yy232 = addGroupByClause(pCxt, yymsp[-13].minor.yy232, yymsp[-1].minor.yy88);
-                                                                                    yymsp[-13].minor.yy232 = addHavingClause(pCxt, yymsp[-13].minor.yy232, yymsp[0].minor.yy232);
-                                                                                    yymsp[-13].minor.yy232 = addRangeClause(pCxt, yymsp[-13].minor.yy232, yymsp[-5].minor.yy232);
-                                                                                    yymsp[-13].minor.yy232 = addEveryClause(pCxt, yymsp[-13].minor.yy232, yymsp[-4].minor.yy232);
-                                                                                    yymsp[-13].minor.yy232 = addFillClause(pCxt, yymsp[-13].minor.yy232, yymsp[-3].minor.yy232);
+                                                                                    yymsp[-13].minor.yy992 = createSelectStmt(pCxt, yymsp[-11].minor.yy437, yymsp[-9].minor.yy364, yymsp[-8].minor.yy992, yymsp[-12].minor.yy364);
+                                                                                    yymsp[-13].minor.yy992 = setSelectStmtTagMode(pCxt, yymsp[-13].minor.yy992, yymsp[-10].minor.yy437);
+                                                                                    yymsp[-13].minor.yy992 = addWhereClause(pCxt, yymsp[-13].minor.yy992, yymsp[-7].minor.yy992);
+                                                                                    yymsp[-13].minor.yy992 = addPartitionByClause(pCxt, yymsp[-13].minor.yy992, yymsp[-6].minor.yy364);
+                                                                                    yymsp[-13].minor.yy992 = addWindowClauseClause(pCxt, yymsp[-13].minor.yy992, yymsp[-2].minor.yy992);
+                                                                                    yymsp[-13].minor.yy992 = addGroupByClause(pCxt, yymsp[-13].minor.yy992, yymsp[-1].minor.yy364);
+                                                                                    yymsp[-13].minor.yy992 = addHavingClause(pCxt, yymsp[-13].minor.yy992, yymsp[0].minor.yy992);
+                                                                                    yymsp[-13].minor.yy992 = addRangeClause(pCxt, yymsp[-13].minor.yy992, yymsp[-5].minor.yy992);
+                                                                                    yymsp[-13].minor.yy992 = addEveryClause(pCxt, yymsp[-13].minor.yy992, yymsp[-4].minor.yy992);
+                                                                                    yymsp[-13].minor.yy992 = addFillClause(pCxt, yymsp[-13].minor.yy992, yymsp[-3].minor.yy992);
                                                                                   }
-#line 7522 "sql.c"
-        break;
-      case 556: /* hint_list ::= */
-#line 1101 "sql.y"
-{ yymsp[1].minor.yy88 = createHintNodeList(pCxt, NULL); }
-#line 7527 "sql.c"
-        break;
-      case 557: /* hint_list ::= NK_HINT */
-#line 1102 "sql.y"
-{ yylhsminor.yy88 = createHintNodeList(pCxt, &yymsp[0].minor.yy0); }
-#line 7532 "sql.c"
-  yymsp[0].minor.yy88 = yylhsminor.yy88;
-        break;
-      case 562: /* set_quantifier_opt ::= ALL */
-#line 1113 "sql.y"
-{ yymsp[0].minor.yy985 = false; }
-#line 7538 "sql.c"
-        break;
-      case 565: /* select_item ::= NK_STAR */
-#line 1120 "sql.y"
-{ yylhsminor.yy232 = createColumnNode(pCxt, NULL, &yymsp[0].minor.yy0); }
-#line 7543 "sql.c"
-  yymsp[0].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 567: /* select_item ::= common_expression column_alias */
-      case 577: /* partition_item ::= expr_or_subquery column_alias */ yytestcase(yyruleno==577);
-#line 1122 "sql.y"
-{ yylhsminor.yy232 = setProjectionAlias(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy232), &yymsp[0].minor.yy993); }
-#line 7550 "sql.c"
-  yymsp[-1].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 568: /* select_item ::= common_expression AS column_alias */
-      case 578: /* partition_item ::= expr_or_subquery AS column_alias */ yytestcase(yyruleno==578);
-#line 1123 "sql.y"
-{ yylhsminor.yy232 = setProjectionAlias(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), &yymsp[0].minor.yy993); }
+#line 7541 "sql.c"
+        break;
+      case 559: /* hint_list ::= */
+#line 1104 "sql.y"
+{ yymsp[1].minor.yy364 = createHintNodeList(pCxt, NULL); }
+#line 7546 "sql.c"
+        break;
+      case 560: /* hint_list ::= NK_HINT */
+#line 1105 "sql.y"
+{ yylhsminor.yy364 = createHintNodeList(pCxt, &yymsp[0].minor.yy0); }
+#line 7551 "sql.c"
+  yymsp[0].minor.yy364 = yylhsminor.yy364;
+        break;
+      case 565: /* set_quantifier_opt ::= ALL */
+#line 1116 "sql.y"
+{ yymsp[0].minor.yy437 = false; }
 #line 7557 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 573: /* partition_by_clause_opt ::= PARTITION BY partition_list */
-      case 601: /* group_by_clause_opt ::= GROUP BY group_by_list */ yytestcase(yyruleno==601);
-      case 621: /* order_by_clause_opt ::= ORDER BY sort_specification_list */ yytestcase(yyruleno==621);
-#line 1132 "sql.y"
-{ yymsp[-2].minor.yy88 = yymsp[0].minor.yy88; }
-#line 7565 "sql.c"
-        break;
-      case 580: /* twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA interval_sliding_duration_literal NK_RP */
-#line 1145 "sql.y"
-{ yymsp[-5].minor.yy232 = createSessionWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy232), releaseRawExprNode(pCxt, yymsp[-1].minor.yy232)); }
-#line 7570 "sql.c"
-        break;
-      case 581: /* twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
-#line 1146 "sql.y"
-{ yymsp[-3].minor.yy232 = createStateWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy232)); }
-#line 7575 "sql.c"
-        break;
-      case 582: /* twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_RP sliding_opt fill_opt */
+        break;
+      case 568: /* select_item ::= NK_STAR */
+#line 1123 "sql.y"
+{ yylhsminor.yy992 = createColumnNode(pCxt, NULL, &yymsp[0].minor.yy0); }
+#line 7562 "sql.c"
+  yymsp[0].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 570: /* select_item ::= common_expression column_alias */
+      case 580: /* partition_item ::= expr_or_subquery column_alias */ yytestcase(yyruleno==580);
+#line 1125 "sql.y"
+{ yylhsminor.yy992 = setProjectionAlias(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy992), &yymsp[0].minor.yy929); }
+#line 7569 "sql.c"
+  yymsp[-1].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 571: /* select_item ::= common_expression AS column_alias */
+      case 581: /* partition_item ::= expr_or_subquery AS column_alias */ yytestcase(yyruleno==581);
+#line 1126 "sql.y"
+{ yylhsminor.yy992 = setProjectionAlias(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), &yymsp[0].minor.yy929); }
+#line 7576 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 576: /* partition_by_clause_opt ::= PARTITION BY partition_list */
+      case 604: /* group_by_clause_opt ::= GROUP BY group_by_list */ yytestcase(yyruleno==604);
+      case 624: /* order_by_clause_opt ::= ORDER BY sort_specification_list */ yytestcase(yyruleno==624);
+#line 1135 "sql.y"
+{ yymsp[-2].minor.yy364 = yymsp[0].minor.yy364; }
+#line 7584 "sql.c"
+        break;
+      case 583: /* twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA interval_sliding_duration_literal NK_RP */
 #line 1148 "sql.y"
-{ yymsp[-5].minor.yy232 = createIntervalWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy232), NULL, yymsp[-1].minor.yy232, yymsp[0].minor.yy232); }
-#line 7580 "sql.c"
-        break;
-      case 583: /* twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_COMMA interval_sliding_duration_literal NK_RP sliding_opt fill_opt */
-#line 1152 "sql.y"
-{ yymsp[-7].minor.yy232 = createIntervalWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-5].minor.yy232), releaseRawExprNode(pCxt, yymsp[-3].minor.yy232), yymsp[-1].minor.yy232, yymsp[0].minor.yy232); }
-#line 7585 "sql.c"
-        break;
-      case 584: /* twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition */
-#line 1154 "sql.y"
-{ yymsp[-6].minor.yy232 = createEventWindowNode(pCxt, yymsp[-3].minor.yy232, yymsp[0].minor.yy232); }
-#line 7590 "sql.c"
-        break;
-      case 591: /* fill_opt ::= FILL NK_LP fill_mode NK_RP */
-#line 1164 "sql.y"
-{ yymsp[-3].minor.yy232 = createFillNode(pCxt, yymsp[-1].minor.yy246, NULL); }
-#line 7595 "sql.c"
-        break;
-      case 592: /* fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP */
-#line 1165 "sql.y"
-{ yymsp[-5].minor.yy232 = createFillNode(pCxt, FILL_MODE_VALUE, createNodeListNode(pCxt, yymsp[-1].minor.yy88)); }
-#line 7600 "sql.c"
-        break;
-      case 593: /* fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP */
-#line 1166 "sql.y"
-{ yymsp[-5].minor.yy232 = createFillNode(pCxt, FILL_MODE_VALUE_F, createNodeListNode(pCxt, yymsp[-1].minor.yy88)); }
-#line 7605 "sql.c"
-        break;
-      case 594: /* fill_mode ::= NONE */
-#line 1170 "sql.y"
-{ yymsp[0].minor.yy246 = FILL_MODE_NONE; }
-#line 7610 "sql.c"
-        break;
-      case 595: /* fill_mode ::= PREV */
-#line 1171 "sql.y"
-{ yymsp[0].minor.yy246 = FILL_MODE_PREV; }
-#line 7615 "sql.c"
-        break;
-      case 596: /* fill_mode ::= NULL */
-#line 1172 "sql.y"
-{ yymsp[0].minor.yy246 = FILL_MODE_NULL; }
-#line 7620 "sql.c"
+{ yymsp[-5].minor.yy992 = createSessionWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy992), releaseRawExprNode(pCxt, yymsp[-1].minor.yy992)); }
+#line 7589 "sql.c"
+        break;
+      case 584: /* twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
+#line 1149 "sql.y"
+{ yymsp[-3].minor.yy992 = createStateWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy992)); }
+#line 7594 "sql.c"
+        break;
+      case 585: /* twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_RP sliding_opt fill_opt */
+#line 1151 "sql.y"
+{ yymsp[-5].minor.yy992 = createIntervalWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy992), NULL, yymsp[-1].minor.yy992, yymsp[0].minor.yy992); }
+#line 7599 "sql.c"
+        break;
+      case 586: /* twindow_clause_opt ::= INTERVAL NK_LP interval_sliding_duration_literal NK_COMMA interval_sliding_duration_literal NK_RP sliding_opt fill_opt */
+#line 1155 "sql.y"
+{ yymsp[-7].minor.yy992 = createIntervalWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-5].minor.yy992), releaseRawExprNode(pCxt, yymsp[-3].minor.yy992), yymsp[-1].minor.yy992, yymsp[0].minor.yy992); }
+#line 7604 "sql.c"
+        break;
+      case 587: /* twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition */
+#line 1157 "sql.y"
+{ yymsp[-6].minor.yy992 = createEventWindowNode(pCxt, yymsp[-3].minor.yy992, yymsp[0].minor.yy992); }
+#line 7609 "sql.c"
+        break;
+      case 594: /* fill_opt ::= FILL NK_LP fill_mode NK_RP */
+#line 1167 "sql.y"
+{ yymsp[-3].minor.yy992 = createFillNode(pCxt, yymsp[-1].minor.yy114, NULL); }
+#line 7614 "sql.c"
+        break;
+      case 595: /* fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP */
+#line 1168 "sql.y"
+{ yymsp[-5].minor.yy992 = createFillNode(pCxt, FILL_MODE_VALUE, createNodeListNode(pCxt, yymsp[-1].minor.yy364)); }
+#line 7619 "sql.c"
+        break;
+      case 596: /* fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP */
+#line 1169 "sql.y"
+{ yymsp[-5].minor.yy992 = createFillNode(pCxt, FILL_MODE_VALUE_F, createNodeListNode(pCxt, yymsp[-1].minor.yy364)); }
+#line 7624 "sql.c"
         break;
-      case 597: /* fill_mode ::= NULL_F */
+      case 597: /* fill_mode ::= NONE */
 #line 1173 "sql.y"
-{ yymsp[0].minor.yy246 = FILL_MODE_NULL_F; }
-#line 7625 "sql.c"
+{ yymsp[0].minor.yy114 = FILL_MODE_NONE; }
+#line 7629 "sql.c"
         break;
-      case 598: /* fill_mode ::= LINEAR */
+      case 598: /* fill_mode ::= PREV */
 #line 1174 "sql.y"
-{ yymsp[0].minor.yy246 = FILL_MODE_LINEAR; }
-#line 7630 "sql.c"
+{ yymsp[0].minor.yy114 = FILL_MODE_PREV; }
+#line 7634 "sql.c"
         break;
-      case 599: /* fill_mode ::= NEXT */
+      case 599: /* fill_mode ::= NULL */
 #line 1175 "sql.y"
-{ yymsp[0].minor.yy246 = FILL_MODE_NEXT; }
-#line 7635 "sql.c"
-        break;
-      case 602: /* group_by_list ::= expr_or_subquery */
-#line 1184 "sql.y"
-{ yylhsminor.yy88 = createNodeList(pCxt, createGroupingSetNode(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy232))); }
-#line 7640 "sql.c"
-  yymsp[0].minor.yy88 = yylhsminor.yy88;
-        break;
-      case 603: /* group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
-#line 1185 "sql.y"
-{ yylhsminor.yy88 = addNodeToList(pCxt, yymsp[-2].minor.yy88, createGroupingSetNode(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy232))); }
-#line 7646 "sql.c"
-  yymsp[-2].minor.yy88 = yylhsminor.yy88;
-        break;
-      case 607: /* range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
-#line 1192 "sql.y"
-{ yymsp[-5].minor.yy232 = createInterpTimeRange(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy232), releaseRawExprNode(pCxt, yymsp[-1].minor.yy232)); }
-#line 7652 "sql.c"
-        break;
-      case 608: /* range_opt ::= RANGE NK_LP expr_or_subquery NK_RP */
-#line 1194 "sql.y"
-{ yymsp[-3].minor.yy232 = createInterpTimePoint(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy232)); }
-#line 7657 "sql.c"
-        break;
-      case 611: /* query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
-#line 1201 "sql.y"
+{ yymsp[0].minor.yy114 = FILL_MODE_NULL; }
+#line 7639 "sql.c"
+        break;
+      case 600: /* fill_mode ::= NULL_F */
+#line 1176 "sql.y"
+{ yymsp[0].minor.yy114 = FILL_MODE_NULL_F; }
+#line 7644 "sql.c"
+        break;
+      case 601: /* fill_mode ::= LINEAR */
+#line 1177 "sql.y"
+{ yymsp[0].minor.yy114 = FILL_MODE_LINEAR; }
+#line 7649 "sql.c"
+        break;
+      case 602: /* fill_mode ::= NEXT */
+#line 1178 "sql.y"
+{ yymsp[0].minor.yy114 = FILL_MODE_NEXT; }
+#line 7654 "sql.c"
+        break;
+      case 605: /* group_by_list ::= expr_or_subquery */
+#line 1187 "sql.y"
+{ yylhsminor.yy364 = createNodeList(pCxt, createGroupingSetNode(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy992))); }
+#line 7659 "sql.c"
+  yymsp[0].minor.yy364 = yylhsminor.yy364;
+        break;
+      case 606: /* group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
+#line 1188 "sql.y"
+{ yylhsminor.yy364 = addNodeToList(pCxt, yymsp[-2].minor.yy364, createGroupingSetNode(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy992))); }
+#line 7665 "sql.c"
+  yymsp[-2].minor.yy364 = yylhsminor.yy364;
+        break;
+      case 610: /* range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
+#line 1195 "sql.y"
+{ yymsp[-5].minor.yy992 = createInterpTimeRange(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy992), releaseRawExprNode(pCxt, yymsp[-1].minor.yy992)); }
+#line 7671 "sql.c"
+        break;
+      case 611: /* range_opt ::= RANGE NK_LP expr_or_subquery NK_RP */
+#line 1197 "sql.y"
+{ yymsp[-3].minor.yy992 = createInterpTimePoint(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy992)); }
+#line 7676 "sql.c"
+        break;
+      case 614: /* query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
+#line 1204 "sql.y"
 {
-                                                                                    yylhsminor.yy232 = addOrderByClause(pCxt, yymsp[-3].minor.yy232, yymsp[-2].minor.yy88);
-                                                                                    yylhsminor.yy232 = addSlimitClause(pCxt, yylhsminor.yy232, yymsp[-1].minor.yy232);
-                                                                                    yylhsminor.yy232 = addLimitClause(pCxt, yylhsminor.yy232, yymsp[0].minor.yy232);
+                                                                                    yylhsminor.yy992 = addOrderByClause(pCxt, yymsp[-3].minor.yy992, yymsp[-2].minor.yy364);
+                                                                                    yylhsminor.yy992 = addSlimitClause(pCxt, yylhsminor.yy992, yymsp[-1].minor.yy992);
+                                                                                    yylhsminor.yy992 = addLimitClause(pCxt, yylhsminor.yy992, yymsp[0].minor.yy992);
                                                                                   }
-#line 7666 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 614: /* union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
-#line 1211 "sql.y"
-{ yylhsminor.yy232 = createSetOperator(pCxt, SET_OP_TYPE_UNION_ALL, yymsp[-3].minor.yy232, yymsp[0].minor.yy232); }
-#line 7672 "sql.c"
-  yymsp[-3].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 615: /* union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
-#line 1213 "sql.y"
-{ yylhsminor.yy232 = createSetOperator(pCxt, SET_OP_TYPE_UNION, yymsp[-2].minor.yy232, yymsp[0].minor.yy232); }
-#line 7678 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 623: /* slimit_clause_opt ::= SLIMIT NK_INTEGER */
-      case 627: /* limit_clause_opt ::= LIMIT NK_INTEGER */ yytestcase(yyruleno==627);
-#line 1227 "sql.y"
-{ yymsp[-1].minor.yy232 = createLimitNode(pCxt, &yymsp[0].minor.yy0, NULL); }
 #line 7685 "sql.c"
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
         break;
-      case 624: /* slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
-      case 628: /* limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */ yytestcase(yyruleno==628);
-#line 1228 "sql.y"
-{ yymsp[-3].minor.yy232 = createLimitNode(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0); }
+      case 617: /* union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
+#line 1214 "sql.y"
+{ yylhsminor.yy992 = createSetOperator(pCxt, SET_OP_TYPE_UNION_ALL, yymsp[-3].minor.yy992, yymsp[0].minor.yy992); }
 #line 7691 "sql.c"
+  yymsp[-3].minor.yy992 = yylhsminor.yy992;
         break;
-      case 625: /* slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
-      case 629: /* limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */ yytestcase(yyruleno==629);
-#line 1229 "sql.y"
-{ yymsp[-3].minor.yy232 = createLimitNode(pCxt, &yymsp[0].minor.yy0, &yymsp[-2].minor.yy0); }
+      case 618: /* union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
+#line 1216 "sql.y"
+{ yylhsminor.yy992 = createSetOperator(pCxt, SET_OP_TYPE_UNION, yymsp[-2].minor.yy992, yymsp[0].minor.yy992); }
 #line 7697 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 626: /* slimit_clause_opt ::= SLIMIT NK_INTEGER */
+      case 630: /* limit_clause_opt ::= LIMIT NK_INTEGER */ yytestcase(yyruleno==630);
+#line 1230 "sql.y"
+{ yymsp[-1].minor.yy992 = createLimitNode(pCxt, &yymsp[0].minor.yy0, NULL); }
+#line 7704 "sql.c"
+        break;
+      case 627: /* slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
+      case 631: /* limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */ yytestcase(yyruleno==631);
+#line 1231 "sql.y"
+{ yymsp[-3].minor.yy992 = createLimitNode(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0); }
+#line 7710 "sql.c"
+        break;
+      case 628: /* slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
+      case 632: /* limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */ yytestcase(yyruleno==632);
+#line 1232 "sql.y"
+{ yymsp[-3].minor.yy992 = createLimitNode(pCxt, &yymsp[0].minor.yy0, &yymsp[-2].minor.yy0); }
+#line 7716 "sql.c"
+        break;
+      case 633: /* subquery ::= NK_LP query_expression NK_RP */
+#line 1240 "sql.y"
+{ yylhsminor.yy992 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, yymsp[-1].minor.yy992); }
+#line 7721 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
+        break;
+      case 638: /* sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
+#line 1254 "sql.y"
+{ yylhsminor.yy992 = createOrderByExprNode(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy992), yymsp[-1].minor.yy938, yymsp[0].minor.yy517); }
+#line 7727 "sql.c"
+  yymsp[-2].minor.yy992 = yylhsminor.yy992;
         break;
-      case 630: /* subquery ::= NK_LP query_expression NK_RP */
-#line 1237 "sql.y"
-{ yylhsminor.yy232 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, yymsp[-1].minor.yy232); }
-#line 7702 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 635: /* sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
-#line 1251 "sql.y"
-{ yylhsminor.yy232 = createOrderByExprNode(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy232), yymsp[-1].minor.yy834, yymsp[0].minor.yy153); }
-#line 7708 "sql.c"
-  yymsp[-2].minor.yy232 = yylhsminor.yy232;
-        break;
-      case 636: /* ordering_specification_opt ::= */
-#line 1255 "sql.y"
-{ yymsp[1].minor.yy834 = ORDER_ASC; }
-#line 7714 "sql.c"
-        break;
-      case 637: /* ordering_specification_opt ::= ASC */
-#line 1256 "sql.y"
-{ yymsp[0].minor.yy834 = ORDER_ASC; }
-#line 7719 "sql.c"
-        break;
-      case 638: /* ordering_specification_opt ::= DESC */
-#line 1257 "sql.y"
-{ yymsp[0].minor.yy834 = ORDER_DESC; }
-#line 7724 "sql.c"
+      case 639: /* ordering_specification_opt ::= */
+#line 1258 "sql.y"
+{ yymsp[1].minor.yy938 = ORDER_ASC; }
+#line 7733 "sql.c"
         break;
-      case 639: /* null_ordering_opt ::= */
-#line 1261 "sql.y"
-{ yymsp[1].minor.yy153 = NULL_ORDER_DEFAULT; }
-#line 7729 "sql.c"
+      case 640: /* ordering_specification_opt ::= ASC */
+#line 1259 "sql.y"
+{ yymsp[0].minor.yy938 = ORDER_ASC; }
+#line 7738 "sql.c"
         break;
-      case 640: /* null_ordering_opt ::= NULLS FIRST */
-#line 1262 "sql.y"
-{ yymsp[-1].minor.yy153 = NULL_ORDER_FIRST; }
-#line 7734 "sql.c"
+      case 641: /* ordering_specification_opt ::= DESC */
+#line 1260 "sql.y"
+{ yymsp[0].minor.yy938 = ORDER_DESC; }
+#line 7743 "sql.c"
         break;
-      case 641: /* null_ordering_opt ::= NULLS LAST */
-#line 1263 "sql.y"
-{ yymsp[-1].minor.yy153 = NULL_ORDER_LAST; }
-#line 7739 "sql.c"
+      case 642: /* null_ordering_opt ::= */
+#line 1264 "sql.y"
+{ yymsp[1].minor.yy517 = NULL_ORDER_DEFAULT; }
+#line 7748 "sql.c"
+        break;
+      case 643: /* null_ordering_opt ::= NULLS FIRST */
+#line 1265 "sql.y"
+{ yymsp[-1].minor.yy517 = NULL_ORDER_FIRST; }
+#line 7753 "sql.c"
+        break;
+      case 644: /* null_ordering_opt ::= NULLS LAST */
+#line 1266 "sql.y"
+{ yymsp[-1].minor.yy517 = NULL_ORDER_LAST; }
+#line 7758 "sql.c"
         break;
       default:
         break;
@@ -7809,7 +7828,7 @@ static void yy_syntax_error(
   } else if (TSDB_CODE_PAR_DB_NOT_SPECIFIED == pCxt->errCode && TK_NK_FLOAT == TOKEN.type) {
     pCxt->errCode = generateSyntaxErrMsg(&pCxt->msgBuf, TSDB_CODE_PAR_SYNTAX_ERROR, TOKEN.z);
   }
-#line 7812 "sql.c"
+#line 7831 "sql.c"
 /************ End %syntax_error code ******************************************/
   ParseARG_STORE /* Suppress warning about unused %extra_argument variable */
   ParseCTX_STORE
@@ -108,6 +108,7 @@ TEST_F(ParserInitialATest, alterDnode) {
  *   | REPLICA int_value                                         -- todo: enum 1, 3, default 1, unit replica
  *   | WAL_LEVEL int_value                                       -- enum 1, 2, default 1
  *   | STT_TRIGGER int_value                                     -- rang [1, 16], default 8
+ *   | STT_MERGE_POLICY {'count' | 'tiered'}                     -- default 'count'
  *   | MINROWS int_value                                         -- rang [10, 1000], default 100
  *   | WAL_RETENTION_PERIOD int_value                            -- rang [-1, INT32_MAX], default 0
  *   | WAL_RETENTION_SIZE int_value                              -- rang [-1, INT32_MAX], default 0
@@ -135,6 +136,7 @@ TEST_F(ParserInitialATest, alterDatabase) {
     expect.cacheLastSize = -1;
     expect.replications = -1;
     expect.sstTrigger = -1;
+    expect.sttMergePolicy = -1;
     expect.minRows = -1;
     expect.walRetentionPeriod = -2;
     expect.walRetentionSize = -2;
@@ -155,6 +157,7 @@ TEST_F(ParserInitialATest, alterDatabase) {
   auto setAlterDbCacheModel = [&](int8_t cacheModel) { expect.cacheLast = cacheModel; };
   auto setAlterDbReplica = [&](int8_t replications) { expect.replications = replications; };
   auto setAlterDbSttTrigger = [&](int8_t sstTrigger) { expect.sstTrigger = sstTrigger; };
+  auto setAlterDbSttMergePolicy = [&](int8_t sttMergePolicy) { expect.sttMergePolicy = sttMergePolicy; };
   auto setAlterDbMinRows = [&](int32_t minRows) { expect.minRows = minRows; };
   auto setAlterDbWalRetentionPeriod = [&](int32_t walRetentionPeriod) {
     expect.walRetentionPeriod = walRetentionPeriod;
@@ -180,6 +183,7 @@ TEST_F(ParserInitialATest, alterDatabase) {
     ASSERT_EQ(req.cacheLast, expect.cacheLast);
     ASSERT_EQ(req.replications, expect.replications);
     ASSERT_EQ(req.sstTrigger, expect.sstTrigger);
+    ASSERT_EQ(req.sttMergePolicy, expect.sttMergePolicy);
     ASSERT_EQ(req.minRows, expect.minRows);
     ASSERT_EQ(req.walRetentionPeriod, expect.walRetentionPeriod);
     ASSERT_EQ(req.walRetentionSize, expect.walRetentionSize);
@@ -293,6 +297,13 @@ TEST_F(ParserInitialATest, alterDatabase) {
   run("ALTER DATABASE test STT_TRIGGER 16");
   clearAlterDbReq();
 
+  initAlterDb("test");
+  setAlterDbSttMergePolicy(TSDB_STT_MERGE_POLICY_TIERED);
+  run("ALTER DATABASE test STT_MERGE_POLICY 'tiered'");
+  setAlterDbSttMergePolicy(TSDB_STT_MERGE_POLICY_COUNT);
+  run("ALTER DATABASE test STT_MERGE_POLICY 'count'");
+  clearAlterDbReq();
+
   initAlterDb("test");
   setAlterDbMinRows(10);
   run("ALTER DATABASE test MINROWS 10");
@@ -338,6 +349,9 @@ TEST_F(ParserInitialATest, alterDatabaseSemanticCheck) {
   run("ALTER DATABASE test REPLICA 2", TSDB_CODE_PAR_INVALID_DB_OPTION);
   run("ALTER DATABASE test STT_TRIGGER 0", TSDB_CODE_PAR_INVALID_DB_OPTION);
   run("ALTER DATABASE test STT_TRIGGER 17", TSDB_CODE_PAR_INVALID_DB_OPTION);
+  run("ALTER DATABASE test STT_MERGE_POLICY 'leveled'", TSDB_CODE_PAR_INVALID_DB_OPTION);
+  run("ALTER DATABASE test STT_MERGE_POLICY tiered", TSDB_CODE_PAR_SYNTAX_ERROR, PARSER_STAGE_PARSE);
+  run("ALTER DATABASE test CACHEMODEL 'tiered'", TSDB_CODE_PAR_INVALID_DB_OPTION);
   // Regardless of the specific sentence
   run("ALTER DATABASE db WAL_LEVEL 0     # td-14436", TSDB_CODE_PAR_SYNTAX_ERROR, PARSER_STAGE_PARSE);
 }
@@ -157,6 +157,7 @@ TEST_F(ParserInitialCTest, createDatabase) {
     expect.walRollPeriod = TSDB_REP_DEF_DB_WAL_ROLL_PERIOD;
     expect.walSegmentSize = TSDB_DEFAULT_DB_WAL_SEGMENT_SIZE;
     expect.sstTrigger = TSDB_DEFAULT_SST_TRIGGER;
+    expect.sttMergePolicy = TSDB_DEFAULT_STT_MERGE_POLICY;
     expect.hashPrefix = TSDB_DEFAULT_HASH_PREFIX;
     expect.hashSuffix = TSDB_DEFAULT_HASH_SUFFIX;
     expect.tsdbPageSize = TSDB_DEFAULT_TSDB_PAGESIZE;
@@ -201,6 +202,7 @@ TEST_F(ParserInitialCTest, createDatabase) {
   auto setDbWalRollPeriod = [&](int32_t walRollPeriod) { expect.walRollPeriod = walRollPeriod; };
   auto setDbWalSegmentSize = [&](int32_t walSegmentSize) { expect.walSegmentSize = walSegmentSize; };
   auto setDbSstTrigger = [&](int32_t sstTrigger) { expect.sstTrigger = sstTrigger; };
+  auto setDbSttMergePolicy = [&](int8_t sttMergePolicy) { expect.sttMergePolicy = sttMergePolicy; };
   auto setDbHashPrefix = [&](int32_t hashPrefix) { expect.hashPrefix = hashPrefix; };
   auto setDbHashSuffix = [&](int32_t hashSuffix) { expect.hashSuffix = hashSuffix; };
   auto setDbTsdbPageSize = [&](int32_t tsdbPageSize) { expect.tsdbPageSize = tsdbPageSize; };
@@ -236,6 +238,7 @@ TEST_F(ParserInitialCTest, createDatabase) {
     ASSERT_EQ(req.walRollPeriod, expect.walRollPeriod);
     ASSERT_EQ(req.walSegmentSize, expect.walSegmentSize);
     ASSERT_EQ(req.sstTrigger, expect.sstTrigger);
+    ASSERT_EQ(req.sttMergePolicy, expect.sttMergePolicy);
     ASSERT_EQ(req.hashPrefix, expect.hashPrefix);
     ASSERT_EQ(req.hashSuffix, expect.hashSuffix);
     ASSERT_EQ(req.tsdbPageSize, expect.tsdbPageSize);
@@ -291,6 +294,7 @@ TEST_F(ParserInitialCTest, createDatabase) {
   setDbWalRollPeriod(10);
   setDbWalSegmentSize(20);
   setDbSstTrigger(16);
+  setDbSttMergePolicy(TSDB_STT_MERGE_POLICY_TIERED);
   setDbHashPrefix(3);
   setDbHashSuffix(4);
   setDbTsdbPageSize(32);
@@ -319,6 +323,7 @@ TEST_F(ParserInitialCTest, createDatabase) {
       "WAL_ROLL_PERIOD 10 "
       "WAL_SEGMENT_SIZE 20 "
       "STT_TRIGGER 16 "
+      "STT_MERGE_POLICY 'tiered' "
       "TABLE_PREFIX 3 "
       "TABLE_SUFFIX 4 "
       "TSDB_PAGESIZE 32");
@@ -908,6 +913,15 @@ TEST_F(ParserInitialCTest, createStable) {
       "COMMENT 'test create table' SMA(c1, c2, c3) ROLLUP (MIN) MAX_DELAY 100s,10m WATERMARK 10a,1m "
       "DELETE_MARK 1000s,200m");
   clearCreateStbReq();
+
+  setCreateStbReq("test", "t1");
+  addFieldToCreateStbReq(true, "ts", TSDB_DATA_TYPE_TIMESTAMP);
+  addFieldToCreateStbReq(true, "c1", TSDB_DATA_TYPE_INT);
+  addFieldToCreateStbReq(true, "c2", TSDB_DATA_TYPE_BIGINT, 0, COL_SMA_ON | COL_BLOOM_ON);
+  addFieldToCreateStbReq(true, "c3", TSDB_DATA_TYPE_VARCHAR, 20 + VARSTR_HEADER_SIZE, COL_SMA_ON | COL_BLOOM_ON);
+  addFieldToCreateStbReq(false, "id", TSDB_DATA_TYPE_INT);
+  run("CREATE STABLE t1(ts TIMESTAMP, c1 INT, c2 BIGINT, c3 VARCHAR(20)) TAGS(id INT) BLOOM_FILTER(c2, c3)");
+  clearCreateStbReq();
 }
 
 TEST_F(ParserInitialCTest, createStableSemanticCheck) {
@@ -921,6 +935,17 @@ TEST_F(ParserInitialCTest, createStableSemanticCheck) {
 
   run("CREATE STABLE rollup_db.stb2 (ts TIMESTAMP, c1 INT) TAGS (tag1 INT) ROLLUP(MAX) MAX_DELAY 10s WATERMARK 18m",
       TSDB_CODE_PAR_INVALID_TABLE_OPTION);
+
+  run("CREATE STABLE stb2 (ts TIMESTAMP, c1 DOUBLE) TAGS (tag1 INT) BLOOM_FILTER(c1)",
+      TSDB_CODE_PAR_INVALID_TABLE_OPTION);
+
+  run("CREATE STABLE stb2 (ts TIMESTAMP, c1 INT) TAGS (tag1 INT) BLOOM_FILTER(c2)", TSDB_CODE_PAR_INVALID_COLUMN);
+
+  run("CREATE STABLE stb2 (ts TIMESTAMP, bloom_filter DOUBLE) TAGS (tag1 INT) BLOOM_FILTER(bloom_filter)",
+      TSDB_CODE_PAR_INVALID_TABLE_OPTION);
+
+  run("CREATE BLOOM_FILTER INDEX idx1 ON t1 FUNCTION(MAX(c1)) INTERVAL(10s)", TSDB_CODE_PAR_SYNTAX_ERROR,
+      PARSER_STAGE_PARSE);
 }
 
 /*
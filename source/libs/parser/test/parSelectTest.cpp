@@ -365,6 +365,8 @@ TEST_F(ParserSelectTest, semanticCheck) {
 
   run("SELECT t1.c1, t1.cc1 FROM t1", TSDB_CODE_PAR_INVALID_COLUMN);
 
+  run("SELECT stt_merge_policy FROM t1", TSDB_CODE_PAR_INVALID_COLUMN);
+
   // TSDB_CODE_PAR_GET_META_ERROR
   run("SELECT * FROM t10", TSDB_CODE_PAR_GET_META_ERROR);
 
@@ -36,6 +36,7 @@ extern "C" {
 #define QW_DEFAULT_HEARTBEAT_MSEC   5000
 #define QW_SCH_TIMEOUT_MSEC         180000
 #define QW_MIN_RES_ROWS             4096
+#define QW_MEM_SPILL_WATERMARK      80  // percent of the memory limit, beyond it the spillable memory is refused
 
 enum {
   QW_PHASE_PRE_QUERY = 1,
@@ -112,6 +113,17 @@ typedef struct SQWTaskStatus {
   int8_t  status;
 } SQWTaskStatus;
 
+typedef struct SQWMemBudget {
+  int64_t limit;  // bytes, 0 means no limit besides the one of the dnode
+  int64_t used;   // bytes charged to the dnode memory governor
+} SQWMemBudget;
+
+typedef struct SQWMemGovernor {
+  int64_t used;
+  int64_t spillRefused;
+  int64_t allocRefused;
+} SQWMemGovernor;
+
 typedef struct SQWTaskCtx {
   SRWLatch lock;
   int8_t   phase;
@@ -125,6 +137,7 @@ typedef struct SQWTaskCtx {
   int32_t  fetchMsgType;
   int32_t  level;
   int32_t  dynExecId;
+  int32_t  fetchCompressSize;
   uint64_t sId;
 
   bool    queryGotData;
@@ -136,6 +149,7 @@ typedef struct SQWTaskCtx {
   bool    explainRsped;
   int32_t rspCode;
   int64_t affectedRows;  // for insert ...select stmt
+  int64_t memPeak;       // peak bytes of the task column buffers, reported in sch hb
 
   SRpcHandleInfo ctrlConnInfo;
   SRpcHandleInfo dataConnInfo;
@@ -146,6 +160,8 @@ typedef struct SQWTaskCtx {
   void      *taskHandle;
   void      *sinkHandle;
   SArray    *tbInfo; // STbVerInfo
+
+  SQWMemBudget memBudget;
 } SQWTaskCtx;
 
 typedef struct SQWSchStatus {
@@ -399,6 +415,9 @@ int64_t qwGetTimeInQueue(SQWorker *mgmt, EQueueType type);
 void    qwClearExpiredSch(SQWorker *mgmt, SArray *pExpiredSch);
 int32_t qwAcquireScheduler(SQWorker *mgmt, uint64_t sId, int32_t rwType, SQWSchStatus **sch);
 void    qwFreeTaskCtx(SQWTaskCtx *ctx);
+void    qwSetTaskMemBudget(QW_FPARAMS_DEF, SQWTaskCtx *ctx, qTaskInfo_t taskHandle);
+void    qwFreeTaskMemBudget(SQWTaskCtx *ctx);
+void    qwGetMemStat(SQWorkerStat *pStat);
 int32_t qwHandleTaskComplete(QW_FPARAMS_DEF, SQWTaskCtx *ctx);
 
 void    qwDbgDumpMgmtInfo(SQWorker *mgmt);
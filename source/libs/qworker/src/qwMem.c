@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "executor.h"
+#include "qwInt.h"
+#include "qworker.h"
+#include "tglobal.h"
+
+/*
+ * Memory governor of the query tasks on one dnode. Every task charges its memory to its own budget and to the dnode.
+ * Spillable memory, like the pages of the paged buffers, is refused beyond QW_MEM_SPILL_WATERMARK of the limits so that
+ * operators spill early, the other memory is refused beyond the limits and the task fails with
+ * TSDB_CODE_QRY_NOT_ENOUGH_BUFFER instead of the whole dnode running out of memory.
+ */
+
+static SQWMemGovernor gQwMemGov = {0};
+
+static int64_t qwGetNodeMemLimit(void) {
+  int32_t limitMB = atomic_load_32(&tsQueryMemoryLimit);
+  if (limitMB > 0) {
+    return (int64_t)limitMB * 1048576;
+  }
+
+  return tsTotalMemoryKB * 1024 / 2;
+}
+
+static bool qwReserveTaskMem(void *param, int64_t size, bool spillable) {
+  SQWMemBudget *pBudget = (SQWMemBudget *)param;
+  int64_t       nodeLimit = qwGetNodeMemLimit();
+  int64_t       taskLimit = (pBudget->limit > 0) ? pBudget->limit : nodeLimit;
+  if (spillable) {
+    nodeLimit = nodeLimit / 100 * QW_MEM_SPILL_WATERMARK;
+    taskLimit = taskLimit / 100 * QW_MEM_SPILL_WATERMARK;
+  }
+
+  int64_t taskUsed = atomic_add_fetch_64(&pBudget->used, size);
+  int64_t nodeUsed = atomic_add_fetch_64(&gQwMemGov.used, size);
+  if (taskUsed <= taskLimit && nodeUsed <= nodeLimit) {
+    return true;
+  }
+
+  atomic_sub_fetch_64(&pBudget->used, size);
+  atomic_sub_fetch_64(&gQwMemGov.used, size);
+
+  if (spillable) {
+    atomic_add_fetch_64(&gQwMemGov.spillRefused, 1);
+  } else {
+    atomic_add_fetch_64(&gQwMemGov.allocRefused, 1);
+    qWarn("query memory refused, size:%" PRId64 ", task used:%" PRId64 ", limit:%" PRId64 ", dnode used:%" PRId64
+          ", limit:%" PRId64,
+          size, taskUsed - size, taskLimit, nodeUsed - size, nodeLimit);
+  }
+
+  return false;
+}
+
+static void qwReleaseTaskMem(void *param, int64_t size) {
+  SQWMemBudget *pBudget = (SQWMemBudget *)param;
+
+  // the memory allocated before the budget is set is never charged
+  int64_t used = atomic_load_64(&pBudget->used);
+  if (size > used) {
+    size = used;
+  }
+
+  if (size > 0) {
+    atomic_sub_fetch_64(&pBudget->used, size);
+    atomic_sub_fetch_64(&gQwMemGov.used, size);
+  }
+}
+
+void qwSetTaskMemBudget(QW_FPARAMS_DEF, SQWTaskCtx *ctx, qTaskInfo_t taskHandle) {
+  ctx->memBudget.limit = (int64_t)atomic_load_32(&tsQueryTaskMemoryLimit) * 1048576;
+  ctx->memBudget.used = 0;
+
+  qSetTaskMemBudget(taskHandle, qwReserveTaskMem, qwReleaseTaskMem, &ctx->memBudget);
+  QW_TASK_DLOG("task memory budget set, limit:%" PRId64 ", dnode used:%" PRId64 ", limit:%" PRId64,
+               ctx->memBudget.limit, atomic_load_64(&gQwMemGov.used), qwGetNodeMemLimit());
+}
+
+void qwFreeTaskMemBudget(SQWTaskCtx *ctx) {
+  // whatever not released by the task is given back to the dnode, the task handle must be destroyed already
+  int64_t used = atomic_exchange_64(&ctx->memBudget.used, 0);
+  if (used > 0) {
+    atomic_sub_fetch_64(&gQwMemGov.used, used);
+  }
+}
+
+void qwGetMemStat(SQWorkerStat *pStat) {
+  pStat->memUsed = atomic_load_64(&gQwMemGov.used);
+  pStat->memLimit = qwGetNodeMemLimit();
+  pStat->spillRefused = atomic_load_64(&gQwMemGov.spillRefused);
+  pStat->allocRefused = atomic_load_64(&gQwMemGov.allocRefused);
+}
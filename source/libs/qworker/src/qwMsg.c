@@ -6,6 +6,7 @@
 #include "qwInt.h"
 #include "qworker.h"
 #include "tcommon.h"
+#include "tdatablock.h"
 #include "tmsg.h"
 #include "tname.h"
 #include "tgrant.h"
@@ -29,6 +30,28 @@ int32_t qwMallocFetchRsp(int8_t rpcMalloc, int32_t length, SRetrieveTableRsp **r
   return TSDB_CODE_SUCCESS;
 }
 
+// keep the original rsp if the compressed payload turns out to be no smaller
+int32_t qwCompressFetchRsp(int32_t *dataLen, SRetrieveTableRsp **rsp, SOutputData *pOutput) {
+  SRetrieveTableRsp *pRsp = (SRetrieveTableRsp *)rpcMallocCont(sizeof(SRetrieveTableRsp) + *dataLen);
+  if (NULL == pRsp) {
+    qError("rpcMallocCont %d failed", (int32_t)sizeof(SRetrieveTableRsp) + *dataLen);
+    QW_RET(TSDB_CODE_OUT_OF_MEMORY);
+  }
+
+  int32_t len = blockCompressEncoded((*rsp)->data, *dataLen, pRsp->data, *dataLen);
+  if (len < 0) {
+    rpcFreeCont(pRsp);
+    return TSDB_CODE_SUCCESS;
+  }
+
+  rpcFreeCont(*rsp);
+  *rsp = pRsp;
+  *dataLen = len;
+  pOutput->compressed = 1;
+
+  return TSDB_CODE_SUCCESS;
+}
+
 void qwBuildFetchRsp(void *msg, SOutputData *input, int32_t len, bool qComplete) {
   SRetrieveTableRsp *rsp = (SRetrieveTableRsp *)msg;
 
@@ -507,6 +530,7 @@ int32_t qWorkerProcessFetchMsg(void *node, void *qWorkerMgmt, SRpcMsg *pMsg, int
   int32_t  eId = req.execId;
 
   SQWMsg qwMsg = {.node = node, .msg = req.pOpParam, .msgLen = 0, .connInfo = pMsg->info, .msgType = pMsg->msgType};
+  qwMsg.msgInfo.compressSize = req.compressSize;
 
   QW_SCH_TASK_DLOG("processFetch start, node:%p, handle:%p", node, pMsg->info.handle);
 
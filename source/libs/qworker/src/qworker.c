@@ -150,6 +150,7 @@ int32_t qwExecTask(QW_FPARAMS_DEF, SQWTaskCtx *ctx, bool *queryStop) {
       qwDbgSimulateSleep();
 
       code = qExecTaskOpt(taskHandle, pResList, &useconds, &hasMore, &localFetch);
+      atomic_store_64(&ctx->memPeak, qGetTaskMemPeak(taskHandle));
       if (code) {
         if (code != TSDB_CODE_OPS_NOT_SUPPORT) {
           QW_TASK_ELOG("qExecTask failed, code:%x - %s", code, tstrerror(code));
@@ -266,11 +267,16 @@ int32_t qwGenerateSchHbRsp(SQWorker *mgmt, SQWSchStatus *sch, SQWHbInfo *hbInfo)
     SQWTaskStatus *taskStatus = (SQWTaskStatus *)pIter;
     key = taosHashGetKey(pIter, &keyLen);
 
-    // TODO GET EXECUTOR API TO GET MORE INFO
-
     QW_GET_QTID(key, status.queryId, status.taskId, status.execId);
     status.status = taskStatus->status;
     status.refId = taskStatus->refId;
+    status.memPeak = 0;
+
+    SQWTaskCtx *ctx = taosHashAcquire(mgmt->ctxHash, key, keyLen);
+    if (ctx) {
+      status.memPeak = atomic_load_64(&ctx->memPeak);
+      qwReleaseTaskCtx(mgmt, ctx);
+    }
 
     taosArrayPush(hbInfo->rsp.taskStatus, &status);
 
@@ -342,15 +348,28 @@ int32_t qwGetQueryResFromSink(QW_FPARAMS_DEF, SQWTaskCtx *ctx, int32_t *dataLen,
 
     *dataLen += len;
 
-    QW_ERR_RET(qwMallocFetchRsp(!ctx->localExec, *dataLen, &rsp));
+    // the first block of a remote fetch is taken over from the sink as the rsp msg itself, without copying
+    output.rpcBuf = (NULL == rsp && !ctx->localExec);
+    output.pRsp = NULL;
+    if (!output.rpcBuf) {
+      QW_ERR_RET(qwMallocFetchRsp(!ctx->localExec, *dataLen, &rsp));
+      output.pData = rsp->data + *dataLen - len;
+    }
 
-    output.pData = rsp->data + *dataLen - len;
     code = dsGetDataBlock(ctx->sinkHandle, &output);
     if (code) {
       QW_TASK_ELOG("dsGetDataBlock failed, code:%x - %s", code, tstrerror(code));
       QW_ERR_RET(code);
     }
 
+    if (output.rpcBuf) {
+      if (NULL == output.pRsp) {
+        QW_TASK_ELOG("sink returned no rsp buffer, dataLength:%" PRId64, len);
+        QW_ERR_RET(TSDB_CODE_QRY_INVALID_INPUT);
+      }
+      rsp = (SRetrieveTableRsp *)output.pRsp;
+    }
+
     pOutput->queryEnd = output.queryEnd;
     pOutput->precision = output.precision;
     pOutput->bufStatus = output.bufStatus;
@@ -380,6 +399,11 @@ int32_t qwGetQueryResFromSink(QW_FPARAMS_DEF, SQWTaskCtx *ctx, int32_t *dataLen,
     }
   }
 
+  if (rsp && !ctx->localExec && ctx->fetchCompressSize > 0 && *dataLen > ctx->fetchCompressSize) {
+    QW_ERR_RET(qwCompressFetchRsp(dataLen, &rsp, pOutput));
+    QW_TASK_DLOG("fetch rsp compressed:%d, dataLength:%d", pOutput->compressed, *dataLen);
+  }
+
   *rspMsg = rsp;
 
   return TSDB_CODE_SUCCESS;
@@ -747,6 +771,8 @@ int32_t qwProcessQuery(QW_FPARAMS_DEF, SQWMsg *qwMsg, char *sql) {
 
   // qwSendQueryRsp(QW_FPARAMS(), qwMsg->msgType + 1, ctx, code, true);
 
+  qwSetTaskMemBudget(QW_FPARAMS(), ctx, pTaskInfo);
+
   ctx->level = plan->level;
   ctx->dynamicTask = qIsDynamicExecTask(pTaskInfo);
   atomic_store_ptr(&ctx->taskHandle, pTaskInfo);
@@ -878,6 +904,7 @@ int32_t qwProcessFetch(QW_FPARAMS_DEF, SQWMsg *qwMsg) {
 
   ctx->fetchMsgType = qwMsg->msgType;
   ctx->dataConnInfo = qwMsg->connInfo;
+  ctx->fetchCompressSize = qwMsg->msgInfo.compressSize;
 
   if (qwMsg->msg) {
     code = qwStartDynamicTaskNewExec(QW_FPARAMS(), ctx, qwMsg);
@@ -1391,6 +1418,8 @@ int32_t qWorkerGetStat(SReadHandle *handle, void *qWorkerMgmt, SQWorkerStat *pSt
   pStat->timeInQueryQueue = qwGetTimeInQueue((SQWorker *)qWorkerMgmt, QUERY_QUEUE);
   pStat->timeInFetchQueue = qwGetTimeInQueue((SQWorker *)qWorkerMgmt, FETCH_QUEUE);
 
+  qwGetMemStat(pStat);
+
   return TSDB_CODE_SUCCESS;
 }
 
@@ -1432,6 +1461,8 @@ int32_t qWorkerProcessLocalQuery(void *pMgmt, uint64_t sId, uint64_t qId, uint64
     QW_ERR_JRET(TSDB_CODE_APP_ERROR);
   }
 
+  qwSetTaskMemBudget(QW_FPARAMS(), ctx, pTaskInfo);
+
   ctx->level = plan->level;
   atomic_store_ptr(&ctx->taskHandle, pTaskInfo);
   atomic_store_ptr(&ctx->sinkHandle, sinkHandle);
@@ -267,6 +267,9 @@ struct SFilterInfo {
   int8_t           *blkUnitRes;
   void             *pTable;
   SArray           *blkList;
+  int32_t           vecBufRows;   // capacity of the columnar result buffers below
+  int8_t           *vecUnitRes;   // columnar result of one unit
+  int8_t           *vecGroupRes;  // columnar result of one group
 
   SFilterPCtx pctx;
 };
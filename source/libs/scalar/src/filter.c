@@ -21,6 +21,7 @@
 #include "filterInt.h"
 #include "functionMgt.h"
 #include "sclInt.h"
+#include "tbloomfilter.h"
 #include "tcompare.h"
 #include "tdatablock.h"
 #include "tsimplehash.h"
@@ -1218,8 +1219,13 @@ int32_t fltAddGroupUnitFromNode(SFilterInfo *info, SNode *tree, SArray *group) {
 
         len = tDataTypes[type].bytes;
 
-        filterAddField(info, NULL, (void **)&out.columnData->pData, FLD_TYPE_VALUE, &right, len, true, NULL);
-        out.columnData->pData = NULL;
+        // the payload of the column may come from the column buffer pool, the field keeps a copy of its own
+        void *data = taosMemoryCalloc(1, tDataTypes[TSDB_DATA_TYPE_BIGINT].bytes);  // reserved space for simple_copy
+        if (NULL == data) {
+          FLT_ERR_RET(TSDB_CODE_OUT_OF_MEMORY);
+        }
+        memcpy(data, out.columnData->pData, len);
+        filterAddField(info, NULL, (void **)&data, FLD_TYPE_VALUE, &right, len, true, NULL);
       } else {
         void *data = taosMemoryCalloc(1, tDataTypes[TSDB_DATA_TYPE_BIGINT].bytes);  // reserved space for simple_copy
         if (NULL == data) {
@@ -1912,6 +1918,9 @@ void filterFreeInfo(SFilterInfo *info) {
 
   taosMemoryFreeClear(info->unitFlags);
 
+  taosMemoryFreeClear(info->vecUnitRes);
+  taosMemoryFreeClear(info->vecGroupRes);
+
   for (uint32_t i = 0; i < info->colRangeNum; ++i) {
     filterFreeRangeCtx(info->colRange[i]);
   }
@@ -2820,6 +2829,105 @@ int32_t filterUpdateComUnits(SFilterInfo *info) {
   return TSDB_CODE_SUCCESS;
 }
 
+static int32_t fltBlockIdxCompare(const char *pData, uint32_t nData, const char *pPrefix, uint32_t nPrefix) {
+  int32_t c = memcmp(pData, pPrefix, TMIN(nData, nPrefix));
+  if (c) return c;
+  return (nData < nPrefix) ? -1 : ((nData > nPrefix) ? 1 : 0);
+}
+
+// whether the unit is always false for the rows of a data block, according to the bloom filter and zone of the column
+static bool fltBlockIdxExcludeUnit(SFilterComUnit *cunit, const SColumnDataIdx *pIdx) {
+  if (pIdx == NULL || cunit->valData == NULL || cunit->rfunc >= 0) {
+    return false;
+  }
+
+  if (cunit->optr != OP_TYPE_EQUAL && cunit->optr != OP_TYPE_LOWER_THAN && cunit->optr != OP_TYPE_LOWER_EQUAL &&
+      cunit->optr != OP_TYPE_GREATER_THAN && cunit->optr != OP_TYPE_GREATER_EQUAL) {
+    return false;
+  }
+
+  bool        isVar = IS_VAR_DATA_TYPE(cunit->dataType);
+  const char *pData = isVar ? varDataVal(cunit->valData) : cunit->valData;
+  uint32_t    nData = isVar ? varDataLen(cunit->valData) : tDataTypes[cunit->dataType].bytes;
+
+  // +0.0 and -0.0 are equal with different bytes, so the bloom filter is not used for float values
+  if (cunit->optr == OP_TYPE_EQUAL && pIdx->pBloom != NULL && !IS_FLOAT_TYPE(cunit->dataType)) {
+    uint64_t h1 = (uint64_t)pIdx->pBloom->hashFn1(pData, nData);
+    uint64_t h2 = (uint64_t)pIdx->pBloom->hashFn2(pData, nData);
+    if (tBloomFilterNoContain(pIdx->pBloom, h1, h2) == TSDB_CODE_SUCCESS) {
+      return true;
+    }
+  }
+
+  if (!pIdx->hasZone || !isVar) {
+    return false;
+  }
+
+  // the zone is kept in byte order, which is not the order of nchar values
+  if (cunit->optr != OP_TYPE_EQUAL && cunit->dataType != TSDB_DATA_TYPE_VARCHAR &&
+      cunit->dataType != TSDB_DATA_TYPE_VARBINARY) {
+    return false;
+  }
+
+  bool ltMin = fltBlockIdxCompare(pData, nData, pIdx->minPrefix, pIdx->minLen) < 0;
+  bool leMin = pIdx->minTrunc ? ltMin : (fltBlockIdxCompare(pData, nData, pIdx->minPrefix, pIdx->minLen) <= 0);
+  bool gtMax = pIdx->maxTrunc
+                   ? (fltBlockIdxCompare(pData, TMIN(nData, pIdx->maxLen), pIdx->maxPrefix, pIdx->maxLen) > 0)
+                   : (fltBlockIdxCompare(pData, nData, pIdx->maxPrefix, pIdx->maxLen) > 0);
+  bool geMax = pIdx->maxTrunc ? gtMax : (fltBlockIdxCompare(pData, nData, pIdx->maxPrefix, pIdx->maxLen) >= 0);
+
+  switch (cunit->optr) {
+    case OP_TYPE_EQUAL:
+      return ltMin || gtMax;
+    case OP_TYPE_LOWER_THAN:
+      return leMin;
+    case OP_TYPE_LOWER_EQUAL:
+      return ltMin;
+    case OP_TYPE_GREATER_THAN:
+      return geMax;
+    case OP_TYPE_GREATER_EQUAL:
+      return gtMax;
+    default:
+      return false;
+  }
+}
+
+// whether all the groups are always false for the rows of a data block, according to the column indexes
+static bool fltBlockIdxFilterOut(SFilterInfo *info, SColumnDataAgg **pDataStatis, int32_t numOfCols) {
+  bool hasIdx = false;
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    if (pDataStatis[i] != NULL && pDataStatis[i]->pIdx != NULL) {
+      hasIdx = true;
+      break;
+    }
+  }
+
+  if (!hasIdx || info->cunits == NULL) {
+    return false;
+  }
+
+  for (uint32_t g = 0; g < info->groupNum; ++g) {
+    SFilterGroup *group = &info->groups[g];
+    bool          empty = false;
+
+    for (uint32_t u = 0; u < group->unitNum && !empty; ++u) {
+      SFilterComUnit *cunit = &info->cunits[group->unitIdxs[u]];
+      for (int32_t i = 0; i < numOfCols; ++i) {
+        if (pDataStatis[i] != NULL && pDataStatis[i]->colId == cunit->colId) {
+          empty = fltBlockIdxExcludeUnit(cunit, pDataStatis[i]->pIdx);
+          break;
+        }
+      }
+    }
+
+    if (!empty) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 int32_t filterRmUnitByRange(SFilterInfo *info, SColumnDataAgg *pDataStatis, int32_t numOfCols, int32_t numOfRows) {
   int32_t rmUnit = 0;
 
@@ -2829,10 +2937,6 @@ int32_t filterRmUnitByRange(SFilterInfo *info, SColumnDataAgg *pDataStatis, int3
     int32_t         index = -1;
     SFilterComUnit *cunit = &info->cunits[k];
 
-    if (FILTER_NO_MERGE_DATA_TYPE(cunit->dataType)) {
-      continue;
-    }
-
     for (int32_t i = 0; i < numOfCols; ++i) {
       if (pDataStatis[i].colId == cunit->colId) {
         index = i;
@@ -2844,6 +2948,16 @@ int32_t filterRmUnitByRange(SFilterInfo *info, SColumnDataAgg *pDataStatis, int3
       continue;
     }
 
+    if (fltBlockIdxExcludeUnit(cunit, pDataStatis[index].pIdx)) {
+      info->blkUnitRes[k] = -1;
+      rmUnit = 1;
+      continue;
+    }
+
+    if (FILTER_NO_MERGE_DATA_TYPE(cunit->dataType)) {
+      continue;
+    }
+
     if (pDataStatis[index].numOfNull <= 0) {
       if (cunit->optr == OP_TYPE_IS_NULL) {
         info->blkUnitRes[k] = -1;
@@ -3327,6 +3441,260 @@ bool filterExecuteImpl(void *pinfo, int32_t numOfRows, SColumnInfoData *pRes, SC
   return all;
 }
 
+// Columnar execution of the filter: every unit is evaluated over the whole column into a byte array with a branch-free
+// typed loop (vectorized by the compiler), the units of a group are combined by AND and the groups by OR. Only the
+// units on fixed length integer columns compared with constant values are supported, since float/double comparisons
+// follow the epsilon rules of the compare functions.
+#define FLT_VEC_DATA_TYPE(_t) (IS_INTEGER_TYPE(_t) || (_t) == TSDB_DATA_TYPE_BOOL || (_t) == TSDB_DATA_TYPE_TIMESTAMP)
+
+#define FLT_VEC_CMP(_type, _pData, _val, _op, _numOfRows, _res) \
+  do {                                                          \
+    const _type *d = (const _type *)(_pData);                   \
+    const _type  v = *(const _type *)(_val);                    \
+    for (int32_t i = 0; i < (_numOfRows); ++i) {                \
+      (_res)[i] = (d[i] _op v);                                 \
+    }                                                           \
+  } while (0)
+
+#define FLT_VEC_RANGE(_type, _pData, _val, _val2, _op, _op2, _numOfRows, _res) \
+  do {                                                                         \
+    const _type *d = (const _type *)(_pData);                                  \
+    const _type  v = *(const _type *)(_val);                                   \
+    const _type  v2 = *(const _type *)(_val2);                                 \
+    for (int32_t i = 0; i < (_numOfRows); ++i) {                               \
+      (_res)[i] = (d[i] _op v) & (d[i] _op2 v2);                               \
+    }                                                                          \
+  } while (0)
+
+// the index of rfunc follows the order of gRangeCompare
+#define FLT_VEC_EXEC_TYPED(_type, _cunit, _pData, _numOfRows, _res)                                          \
+  do {                                                                                                      \
+    switch ((_cunit)->rfunc) {                                                                              \
+      case 0:                                                                                               \
+        FLT_VEC_RANGE(_type, _pData, (_cunit)->valData, (_cunit)->valData2, >, <, _numOfRows, _res);        \
+        break;                                                                                              \
+      case 1:                                                                                               \
+        FLT_VEC_RANGE(_type, _pData, (_cunit)->valData, (_cunit)->valData2, >, <=, _numOfRows, _res);       \
+        break;                                                                                              \
+      case 2:                                                                                               \
+        FLT_VEC_RANGE(_type, _pData, (_cunit)->valData, (_cunit)->valData2, >=, <, _numOfRows, _res);       \
+        break;                                                                                              \
+      case 3:                                                                                               \
+        FLT_VEC_RANGE(_type, _pData, (_cunit)->valData, (_cunit)->valData2, >=, <=, _numOfRows, _res);      \
+        break;                                                                                              \
+      case 4:                                                                                               \
+        FLT_VEC_CMP(_type, _pData, (_cunit)->valData, >, _numOfRows, _res);                                 \
+        break;                                                                                              \
+      case 5:                                                                                               \
+        FLT_VEC_CMP(_type, _pData, (_cunit)->valData, >=, _numOfRows, _res);                                \
+        break;                                                                                              \
+      case 6:                                                                                               \
+        FLT_VEC_CMP(_type, _pData, (_cunit)->valData2, <, _numOfRows, _res);                                \
+        break;                                                                                              \
+      case 7:                                                                                               \
+        FLT_VEC_CMP(_type, _pData, (_cunit)->valData2, <=, _numOfRows, _res);                               \
+        break;                                                                                              \
+      default:                                                                                              \
+        if ((_cunit)->optr == OP_TYPE_EQUAL) {                                                              \
+          FLT_VEC_CMP(_type, _pData, (_cunit)->valData, ==, _numOfRows, _res);                              \
+        } else {                                                                                            \
+          FLT_VEC_CMP(_type, _pData, (_cunit)->valData, !=, _numOfRows, _res);                              \
+        }                                                                                                   \
+        break;                                                                                              \
+    }                                                                                                       \
+  } while (0)
+
+static bool filterIsVectorUnit(SFilterComUnit *cunit) {
+  if (!FLT_VEC_DATA_TYPE(cunit->dataType)) {
+    return false;
+  }
+
+  switch (cunit->optr) {
+    case OP_TYPE_IS_NULL:
+    case OP_TYPE_IS_NOT_NULL:
+      return true;
+    case OP_TYPE_EQUAL:
+    case OP_TYPE_NOT_EQUAL:
+      return cunit->valData != NULL;
+    default:
+      return cunit->rfunc >= 0 && cunit->valData != NULL && cunit->valData2 != NULL;
+  }
+}
+
+static bool filterIsVectorizable(SFilterInfo *info) {
+  if (info->cunits == NULL || info->unitNum == 0) {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < info->unitNum; ++i) {
+    if (!filterIsVectorUnit(&info->cunits[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static int32_t filterEnsureVecBuf(SFilterInfo *info, int32_t numOfRows) {
+  if (info->vecBufRows >= numOfRows) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  int8_t *pUnitRes = taosMemoryRealloc(info->vecUnitRes, numOfRows);
+  if (pUnitRes == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+  info->vecUnitRes = pUnitRes;
+
+  int8_t *pGroupRes = taosMemoryRealloc(info->vecGroupRes, numOfRows);
+  if (pGroupRes == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+  info->vecGroupRes = pGroupRes;
+
+  info->vecBufRows = numOfRows;
+  return TSDB_CODE_SUCCESS;
+}
+
+static void filterVecExecUnit(SFilterComUnit *cunit, int32_t numOfRows, int8_t *res) {
+  SColumnInfoData *pCol = (SColumnInfoData *)cunit->colData;
+
+  if (cunit->optr == OP_TYPE_IS_NULL || cunit->optr == OP_TYPE_IS_NOT_NULL) {
+    int8_t isNull = (cunit->optr == OP_TYPE_IS_NULL);
+    if (!pCol->hasNull) {
+      memset(res, !isNull, numOfRows);
+      return;
+    }
+
+    for (int32_t i = 0; i < numOfRows; ++i) {
+      res[i] = (colDataIsNull_f(pCol->nullbitmap, i) ? isNull : !isNull);
+    }
+    return;
+  }
+
+  switch (cunit->dataType) {
+    case TSDB_DATA_TYPE_BOOL:
+    case TSDB_DATA_TYPE_TINYINT:
+      FLT_VEC_EXEC_TYPED(int8_t, cunit, pCol->pData, numOfRows, res);
+      break;
+    case TSDB_DATA_TYPE_UTINYINT:
+      FLT_VEC_EXEC_TYPED(uint8_t, cunit, pCol->pData, numOfRows, res);
+      break;
+    case TSDB_DATA_TYPE_SMALLINT:
+      FLT_VEC_EXEC_TYPED(int16_t, cunit, pCol->pData, numOfRows, res);
+      break;
+    case TSDB_DATA_TYPE_USMALLINT:
+      FLT_VEC_EXEC_TYPED(uint16_t, cunit, pCol->pData, numOfRows, res);
+      break;
+    case TSDB_DATA_TYPE_INT:
+      FLT_VEC_EXEC_TYPED(int32_t, cunit, pCol->pData, numOfRows, res);
+      break;
+    case TSDB_DATA_TYPE_UINT:
+      FLT_VEC_EXEC_TYPED(uint32_t, cunit, pCol->pData, numOfRows, res);
+      break;
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_TIMESTAMP:
+      FLT_VEC_EXEC_TYPED(int64_t, cunit, pCol->pData, numOfRows, res);
+      break;
+    case TSDB_DATA_TYPE_UBIGINT:
+      FLT_VEC_EXEC_TYPED(uint64_t, cunit, pCol->pData, numOfRows, res);
+      break;
+    default:
+      break;
+  }
+
+  if (!pCol->hasNull) {
+    return;
+  }
+
+  // null value never satisfies a comparison, skip the bitmap bytes without null value
+  for (int32_t i = 0; i < numOfRows; i += 8) {
+    if (BMCharPos(pCol->nullbitmap, i) == 0) {
+      continue;
+    }
+
+    int32_t end = TMIN(i + 8, numOfRows);
+    for (int32_t j = i; j < end; ++j) {
+      if (colDataIsNull_f(pCol->nullbitmap, j)) {
+        res[j] = 0;
+      }
+    }
+  }
+}
+
+static bool filterVecAnyTrue(const int8_t *res, int32_t numOfRows) {
+  for (int32_t i = 0; i < numOfRows; ++i) {
+    if (res[i]) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static bool filterExecuteImplVector(void *pinfo, int32_t numOfRows, SColumnInfoData *pRes, SColumnDataAgg *statis,
+                             int16_t numOfCols, int32_t *numOfQualified) {
+  SFilterInfo *info = (SFilterInfo *)pinfo;
+  bool         all = true;
+
+  if (filterExecuteBasedOnStatis(info, numOfRows, pRes, statis, numOfCols, &all) == 0) {
+    return all;
+  }
+
+  // the data type of the input column may be different from the one the filter was prepared for, e.g. the column was
+  // altered, let the row based implementation handle it.
+  for (uint32_t i = 0; i < info->unitNum; ++i) {
+    SColumnInfoData *pCol = (SColumnInfoData *)info->cunits[i].colData;
+    if (pCol == NULL || pCol->info.type != info->cunits[i].dataType ||
+        (pCol->pData == NULL && info->cunits[i].optr != OP_TYPE_IS_NULL &&
+         info->cunits[i].optr != OP_TYPE_IS_NOT_NULL)) {
+      return filterExecuteImpl(pinfo, numOfRows, pRes, statis, numOfCols, numOfQualified);
+    }
+  }
+
+  if (filterEnsureVecBuf(info, numOfRows) != TSDB_CODE_SUCCESS) {
+    return filterExecuteImpl(pinfo, numOfRows, pRes, statis, numOfCols, numOfQualified);
+  }
+
+  int8_t *p = (int8_t *)pRes->pData;
+  int8_t *pUnitRes = info->vecUnitRes;
+  int8_t *pGroupRes = info->vecGroupRes;
+
+  memset(p, 0, numOfRows);
+
+  for (uint32_t g = 0; g < info->groupNum; ++g) {
+    SFilterGroup *group = &info->groups[g];
+    if (group->unitNum == 0) {
+      continue;
+    }
+
+    filterVecExecUnit(&info->cunits[group->unitIdxs[0]], numOfRows, pGroupRes);
+
+    for (uint32_t u = 1; u < group->unitNum; ++u) {
+      if (!filterVecAnyTrue(pGroupRes, numOfRows)) {
+        break;
+      }
+
+      filterVecExecUnit(&info->cunits[group->unitIdxs[u]], numOfRows, pUnitRes);
+      for (int32_t i = 0; i < numOfRows; ++i) {
+        pGroupRes[i] &= pUnitRes[i];
+      }
+    }
+
+    for (int32_t i = 0; i < numOfRows; ++i) {
+      p[i] |= pGroupRes[i];
+    }
+  }
+
+  int32_t num = 0;
+  for (int32_t i = 0; i < numOfRows; ++i) {
+    num += p[i];
+  }
+
+  (*numOfQualified) += num;
+  return num == numOfRows;
+}
+
 int32_t filterSetExecFunc(SFilterInfo *info) {
   if (FILTER_ALL_RES(info)) {
     info->func = filterExecuteImplAll;
@@ -3338,6 +3706,11 @@ int32_t filterSetExecFunc(SFilterInfo *info) {
     return TSDB_CODE_SUCCESS;
   }
 
+  if (filterIsVectorizable(info)) {
+    info->func = filterExecuteImplVector;
+    return TSDB_CODE_SUCCESS;
+  }
+
   if (info->unitNum > 1) {
     info->func = filterExecuteImpl;
     return TSDB_CODE_SUCCESS;
@@ -3826,6 +4199,11 @@ bool filterRangeExecute(SFilterInfo *info, SColumnDataAgg **pDataStatis, int32_t
     return true;
   }
 
+  if (fltBlockIdxFilterOut(info, pDataStatis, numOfCols)) {
+    qDebug("filter range execute, data block filtered out by the column bloom filter or zone");
+    return false;
+  }
+
   bool  ret = true;
   void *minVal, *maxVal;
 
@@ -40,6 +40,7 @@
 #include "taos.h"
 #include "tdatablock.h"
 #include "tdef.h"
+#include "tbloomfilter.h"
 #include "tglobal.h"
 #include "tlog.h"
 #include "tvariant.h"
@@ -1341,6 +1342,129 @@ TEST(scalarModelogicTest, diff_columns_or_and_or) {
 }
 #endif
 
+TEST(filterModelogicTest, diff_int_columns_and_or_and_with_null) {
+  SNode       *pLeft1 = NULL, *pRight1 = NULL, *pLeft2 = NULL, *pRight2 = NULL, *opNode1 = NULL, *opNode2 = NULL;
+  SNode       *logicNode1 = NULL, *logicNode2 = NULL;
+  int32_t      leftv1[8] = {1, 2, 3, 4, 5, -1, -2, -3};
+  int64_t      leftv2[8] = {3, 4, 2, 9, -3, 3, 4, 5};
+  int32_t      rightv1 = 3;
+  int64_t      rightv2 = 3;
+  int8_t       eRes[8] = {0, 1, 0, 0, 1, 1, 1, 1};
+  SSDataBlock *src = NULL;
+
+  SNodeList *list = nodesMakeList();
+
+  int32_t rowNum = sizeof(leftv1) / sizeof(leftv1[0]);
+  flttMakeColumnNode(&pLeft1, &src, TSDB_DATA_TYPE_INT, sizeof(int32_t), rowNum, leftv1);
+  flttMakeValueNode(&pRight1, TSDB_DATA_TYPE_INT, &rightv1);
+  flttMakeOpNode(&opNode1, OP_TYPE_GREATER_THAN, TSDB_DATA_TYPE_BOOL, pLeft1, pRight1);
+  nodesListAppend(list, opNode1);
+
+  flttMakeColumnNode(&pLeft2, &src, TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), rowNum, leftv2);
+  flttMakeValueNode(&pRight2, TSDB_DATA_TYPE_BIGINT, &rightv2);
+  flttMakeOpNode(&opNode2, OP_TYPE_LOWER_EQUAL, TSDB_DATA_TYPE_BOOL, pLeft2, pRight2);
+  nodesListAppend(list, opNode2);
+
+  flttMakeLogicNodeFromList(&logicNode1, LOGIC_COND_TYPE_AND, list);
+
+  list = nodesMakeList();
+
+  flttMakeColumnNode(&pLeft1, &src, TSDB_DATA_TYPE_INT, sizeof(int32_t), rowNum, leftv1);
+  flttMakeValueNode(&pRight1, TSDB_DATA_TYPE_INT, &rightv1);
+  flttMakeOpNode(&opNode1, OP_TYPE_LOWER_EQUAL, TSDB_DATA_TYPE_BOOL, pLeft1, pRight1);
+  nodesListAppend(list, opNode1);
+
+  flttMakeColumnNode(&pLeft2, &src, TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), rowNum, leftv2);
+  flttMakeValueNode(&pRight2, TSDB_DATA_TYPE_BIGINT, &rightv2);
+  flttMakeOpNode(&opNode2, OP_TYPE_GREATER_EQUAL, TSDB_DATA_TYPE_BOOL, pLeft2, pRight2);
+  nodesListAppend(list, opNode2);
+
+  flttMakeLogicNodeFromList(&logicNode2, LOGIC_COND_TYPE_AND, list);
+
+  list = nodesMakeList();
+  nodesListAppend(list, logicNode1);
+  nodesListAppend(list, logicNode2);
+  flttMakeLogicNodeFromList(&logicNode1, LOGIC_COND_TYPE_OR, list);
+
+  // the first row of the int column used by the second group is null
+  colDataSetNULL((SColumnInfoData *)taosArrayGet(src->pDataBlock, 4), 0);
+
+  SFilterInfo *filter = NULL;
+  int32_t      code = filterInitFromNode(logicNode1, &filter, 0);
+  ASSERT_EQ(code, 0);
+
+  SFilterColumnParam param = {(int32_t)taosArrayGetSize(src->pDataBlock), src->pDataBlock};
+  code = filterSetDataFromSlotId(filter, &param);
+  ASSERT_EQ(code, 0);
+
+  SColumnInfoData *rowRes = NULL;
+  int32_t          status = 0;
+  code = filterExecute(filter, src, &rowRes, NULL, (int16_t)taosArrayGetSize(src->pDataBlock), &status);
+  ASSERT_EQ(code, 0);
+  ASSERT_EQ(status, FILTER_RESULT_PARTIAL_QUALIFIED);
+
+  for (int32_t i = 0; i < rowNum; ++i) {
+    ASSERT_EQ(*((int8_t *)rowRes->pData + i), eRes[i]);
+  }
+  colDataDestroy(rowRes);
+  taosMemoryFree(rowRes);
+  filterFreeInfo(filter);
+  nodesDestroyNode(logicNode1);
+  blockDataDestroy(src);
+}
+
+TEST(columnTest, int_column_equal_value_with_block_sma) {
+  SNode       *pLeft = NULL, *pRight = NULL, *opNode = NULL;
+  int32_t      leftv[5] = {1, 2, 3, 4, 5};
+  int32_t      rightv = 3;
+  SSDataBlock *src = NULL;
+
+  int32_t rowNum = sizeof(leftv) / sizeof(leftv[0]);
+  flttMakeColumnNode(&pLeft, &src, TSDB_DATA_TYPE_INT, sizeof(int32_t), rowNum, leftv);
+  flttMakeValueNode(&pRight, TSDB_DATA_TYPE_INT, &rightv);
+  flttMakeOpNode(&opNode, OP_TYPE_EQUAL, TSDB_DATA_TYPE_BOOL, pLeft, pRight);
+
+  SFilterInfo *filter = NULL;
+  int32_t      code = filterInitFromNode(opNode, &filter, 0);
+  ASSERT_EQ(code, 0);
+
+  // the sma decoded from a file written without column indexes carries no index
+  SColumnDataAgg  stat = {0};
+  SColumnDataAgg *pStat = &stat;
+  stat.colId = ((SColumnNode *)pLeft)->colId;
+  stat.min = 1;
+  stat.max = 5;
+  stat.pIdx = NULL;
+  ASSERT_EQ(filterRangeExecute(filter, &pStat, 1, rowNum), true);
+
+  stat.min = 4;
+  stat.max = 9;
+  ASSERT_EQ(filterRangeExecute(filter, &pStat, 1, rowNum), false);
+
+  // with a bloom filter which does not contain the value, the block is filtered out even if the range overlaps
+  SColumnDataIdx idx = {0};
+  idx.colId = stat.colId;
+  idx.pBloom = tBloomFilterInit(rowNum, 0.0001);
+  ASSERT_NE(idx.pBloom, nullptr);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    if (leftv[i] != rightv) {
+      ASSERT_EQ(tBloomFilterPut(idx.pBloom, &leftv[i], sizeof(int32_t)), 0);
+    }
+  }
+  stat.min = 1;
+  stat.max = 5;
+  stat.pIdx = &idx;
+  ASSERT_EQ(filterRangeExecute(filter, &pStat, 1, rowNum), false);
+
+  ASSERT_EQ(tBloomFilterPut(idx.pBloom, &rightv, sizeof(int32_t)), 0);
+  ASSERT_EQ(filterRangeExecute(filter, &pStat, 1, rowNum), true);
+
+  tBloomFilterDestroy(idx.pBloom);
+  filterFreeInfo(filter);
+  nodesDestroyNode(opNode);
+  blockDataDestroy(src);
+}
+
 template <class SignedT, class UnsignedT>
 int32_t compareSignedWithUnsigned(SignedT l, UnsignedT r) {
   if (l < 0) return -1;
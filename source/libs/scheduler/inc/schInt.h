@@ -230,6 +230,7 @@ typedef struct SSchTask {
   bool            waitRetry;       // wait for retry
   int32_t         execId;          // task current execute index
   int32_t         failedExecId;    // last failed task execute index
+  int64_t         memPeak;         // peak bytes of the task column buffers in the exec node
   SSchLevel      *level;           // level
   SRWLatch        planLock;        // task update plan lock
   SSubplan       *plan;            // subplan
@@ -257,6 +258,7 @@ typedef struct SSchJobAttr {
   bool         needFetch;
   bool         needFlowCtrl;
   bool         localExec;
+  int32_t      fetchCompressSize;
 } SSchJobAttr;
 
 typedef struct {
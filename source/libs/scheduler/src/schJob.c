@@ -733,6 +733,7 @@ int32_t schInitJob(int64_t *pJobId, SSchedulerReq *pReq) {
 
   pJob->attr.explainMode = pReq->pDag->explainInfo.mode;
   pJob->attr.localExec = pReq->localReq;
+  pJob->attr.fetchCompressSize = pReq->fetchCompressSize;
   pJob->conn = *pReq->pConn;
   if (pReq->sql) {
     pJob->sql = taosStrdup(pReq->sql);
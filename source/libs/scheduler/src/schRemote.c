@@ -17,6 +17,7 @@
 #include "command.h"
 #include "query.h"
 #include "schInt.h"
+#include "tdatablock.h"
 #include "tmsg.h"
 #include "tref.h"
 #include "trpc.h"
@@ -72,6 +73,39 @@ int32_t schValidateRspMsgType(SSchJob *pJob, SSchTask *pTask, int32_t msgType) {
   return TSDB_CODE_SUCCESS;
 }
 
+// inflate the column compressed payload here, so that the application thread gets the plain blocks
+int32_t schDecompressFetchRsp(SSchJob *pJob, SSchTask *pTask, SRetrieveTableRsp **pRsp) {
+  SRetrieveTableRsp *rsp = *pRsp;
+  int32_t            compLen = htonl(rsp->compLen);
+  int32_t            rawLen = blockGetDecompressedSize(rsp->data, compLen);
+  if (rawLen < 0) {
+    SCH_TASK_ELOG("invalid compressed fetch rsp, compLen:%d", compLen);
+    SCH_ERR_RET(TSDB_CODE_QRY_INVALID_INPUT);
+  }
+
+  SRetrieveTableRsp *pNew = taosMemoryMalloc(sizeof(SRetrieveTableRsp) + rawLen);
+  if (NULL == pNew) {
+    SCH_TASK_ELOG("malloc %d failed", (int32_t)sizeof(SRetrieveTableRsp) + rawLen);
+    SCH_ERR_RET(TSDB_CODE_OUT_OF_MEMORY);
+  }
+
+  memcpy(pNew, rsp, sizeof(SRetrieveTableRsp));
+  if (blockDecompressEncoded(rsp->data, compLen, pNew->data, rawLen) != rawLen) {
+    SCH_TASK_ELOG("decompress fetch rsp failed, compLen:%d, rawLen:%d", compLen, rawLen);
+    taosMemoryFree(pNew);
+    SCH_ERR_RET(TSDB_CODE_QRY_INVALID_INPUT);
+  }
+
+  pNew->compressed = 0;
+  pNew->compLen = htonl(rawLen);
+
+  SCH_TASK_DLOG("fetch rsp decompressed, compLen:%d, rawLen:%d", compLen, rawLen);
+
+  taosMemoryFree(rsp);
+  *pRsp = pNew;
+  return TSDB_CODE_SUCCESS;
+}
+
 int32_t schProcessFetchRsp(SSchJob *pJob, SSchTask *pTask, char *msg, int32_t rspCode) {
   SRetrieveTableRsp *rsp = (SRetrieveTableRsp *)msg;
   int32_t code = 0;
@@ -108,6 +142,11 @@ int32_t schProcessFetchRsp(SSchJob *pJob, SSchTask *pTask, char *msg, int32_t rs
     SCH_TASK_ELOG("got fetch rsp while res already exists, res:%p", pJob->fetchRes);
     SCH_ERR_JRET(TSDB_CODE_SCH_STATUS_ERROR);
   }
+
+  if (rsp->compressed) {
+    SCH_ERR_JRET(schDecompressFetchRsp(pJob, pTask, &rsp));
+    msg = (char *)rsp;
+  }
   
   atomic_store_ptr(&pJob->fetchRes, rsp);
   atomic_add_fetch_64(&pJob->resNumOfRows, htobe64(rsp->numOfRows));
@@ -1146,6 +1185,7 @@ int32_t schBuildAndSendMsg(SSchJob *pJob, SSchTask *pTask, SQueryNodeAddr *addr,
       req.queryId = pJob->queryId;
       req.taskId = pTask->taskId;
       req.execId = pTask->execId;
+      req.compressSize = pJob->attr.fetchCompressSize;
 
       msgSize = tSerializeSResFetchReq(NULL, 0, &req);
       if (msgSize < 0) {
@@ -927,6 +927,8 @@ int32_t schProcessOnTaskStatusRsp(SQueryNodeEpId *pEpId, SArray *pStatusList) {
       continue;
     }
 
+    atomic_store_64(&pTask->memPeak, pStatus->memPeak);
+
     if (pStatus->status == JOB_TASK_STATUS_FAIL) {
       // RECORD AND HANDLE ERROR!!!!
       schProcessOnCbEnd(pJob, pTask, 0);
@@ -114,6 +114,7 @@ int32_t schedulerGetTasksStatus(int64_t jobId, SArray *pSub) {
       SQuerySubDesc subDesc = {0};
       subDesc.tid = pTask->taskId;
       strcpy(subDesc.status, jobTaskStatusStr(pTask->status));
+      subDesc.memPeak = atomic_load_64(&pTask->memPeak);
 
       taosArrayPush(pSub, &subDesc);
     }
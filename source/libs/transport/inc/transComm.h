@@ -171,6 +171,13 @@ typedef struct {
 #pragma pack(push, 1)
 
 #define TRANS_VER 2
+// version of shm frames, peers without shm support drop the conn instead of misreading them
+#define TRANS_SHM_VER 3
+
+#define TRANS_SHM_ATTACH 1
+#define TRANS_SHM_DATA   2
+// shm is a signed 2-bit field
+#define TRANS_SHM_TYPE(pHead) ((uint8_t)(pHead)->shm & 0x3)
 typedef struct {
   char version : 4;  // RPC version
   char comp : 2;     // compression algorithm, 0:no compression 1:lz4
@@ -178,7 +185,7 @@ typedef struct {
   char persist : 2;  // persist handle,0: no persit, 1: persist handle
   char release : 2;
   char secured : 2;
-  char spi : 2;
+  char shm : 2;       // 0: msg on wire, TRANS_SHM_ATTACH: attach shm ring, TRANS_SHM_DATA: msg is in shm ring
   char hasEpSet : 2;  // contain epset or not, 0(default): no epset, 1: contain epset
 
   uint64_t timestamp;
@@ -193,6 +200,15 @@ typedef struct {
   uint8_t  content[0];  // message body starts from here
 } STransMsgHead;
 
+// sent on the conn in place of a msg which is copied into the shm ring, or to attach the ring
+typedef struct {
+  STransMsgHead head;
+  int32_t       shmId;
+  int32_t       len;  // TRANS_SHM_ATTACH: size of shm, TRANS_SHM_DATA: len of msg in ring
+  int64_t       pos;  // TRANS_SHM_DATA: position of msg in ring
+  int64_t       token;
+} STransShmFrame;
+
 typedef struct {
   int32_t reserved;
   int32_t contLen;
@@ -253,6 +269,19 @@ typedef struct {
   int8_t      stop;
 } SAsyncPool;
 
+// shm ring pair shared by the client and server of one conn on the same host, msgs are copied into the ring of the
+// sender and only a small STransShmFrame goes through the conn
+typedef struct STransShm STransShm;
+
+STransShm* transShmCreate(int32_t ringSize);
+STransShm* transShmAttach(STransShmFrame* pFrame, int32_t maxRingSize);
+void       transShmDestroy(STransShm* pShm);
+void       transShmBuildAttach(STransShm* pShm, STransShmFrame* pFrame);
+// copy msg into the ring and fill the frame to send instead, -1 if the msg is too small or the ring is full
+int32_t transShmPut(STransShm* pShm, char* msg, int32_t len, STransShmFrame* pFrame);
+// replace the TRANS_SHM_DATA frame dumped from conn buffer by the msg it refers to, return len of msg
+int32_t transShmGet(STransShm* pShm, STransMsgHead** ppHead, int32_t frameLen);
+
 SAsyncPool* transAsyncPoolCreate(uv_loop_t* loop, int sz, void* arg, AsyncCB cb);
 void        transAsyncPoolDestroy(SAsyncPool* pool);
 int         transAsyncSend(SAsyncPool* pool, queue* mq);
@@ -68,6 +68,9 @@ typedef struct {
   int8_t        connLimitLock;  // 0: no lock. 1. lock
   int8_t        supportBatch;   // 0: no batch, 1: support batch
   int32_t       batchSize;
+  int32_t       muxConnNum;
+  int32_t       muxInflight;
+  int32_t       shmSize;
   int32_t       timeToGetConn;
   int           index;
   void*         parent;
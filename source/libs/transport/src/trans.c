@@ -75,6 +75,12 @@ void* rpcOpen(const SRpcInit* pInit) {
   pRpc->connLimitLock = pInit->connLimitLock;
   pRpc->supportBatch = pInit->supportBatch;
   pRpc->batchSize = pInit->batchSize;
+  pRpc->muxConnNum = pInit->muxConnNum;
+  pRpc->muxInflight = pInit->muxInflight;
+  if (pRpc->muxInflight <= 0) {
+    pRpc->muxInflight = 256;
+  }
+  pRpc->shmSize = pInit->shmSize;
 
   pRpc->numOfThreads = pInit->numOfThreads > TSDB_MAX_RPC_THREADS ? TSDB_MAX_RPC_THREADS : pInit->numOfThreads;
   if (pRpc->numOfThreads <= 0) {
@@ -52,6 +52,18 @@ typedef struct {
   SCliBatchList* pList;
 } SCliBatch;
 
+// conns shared by all multiplexed requests to one endpoint, see cliMuxHandleReq
+typedef struct {
+  SArray*  conns;  // SCliConn*
+  queue    pending;
+  int32_t  numOfPending;
+  uint64_t numOfReq;
+
+  char*    dst;
+  char*    ip;
+  uint16_t port;
+} SCliMuxList;
+
 typedef struct SCliConn {
   T_REF_DECLARE()
   uv_connect_t connReq;
@@ -81,6 +93,22 @@ typedef struct SCliConn {
   char  dst[32];
 
   int64_t refId;
+
+  // multiplexed conn, never put into conn pool
+  bool         mux;
+  bool         muxReady;  // connected, msgs can be written out
+  bool         muxFlush;  // linked into muxFlushQ of host thread
+  queue        muxq;
+  SCliMuxList* muxList;
+  uint64_t     muxSeq;
+  int32_t      inflight;  // msgs sent or waiting to be sent, but not responded yet
+  int32_t      maxInflight;
+  int64_t      numOfWrite;
+
+  // msgs bigger than a frame go through shm ring once the server acked the attach
+  STransShm*     shm;
+  bool           shmReady;
+  STransShmFrame shmAttach;
 } SCliConn;
 
 typedef struct SCliMsg {
@@ -93,6 +121,9 @@ typedef struct SCliMsg {
   uint64_t st;
   int      sent;  //(0: no send, 1: alread sent)
   queue    seqq;  //
+  uint64_t muxId;  // req id on multiplexed conn, echoed back by server in head's ahandle
+
+  STransShmFrame shmFrame;  // sent instead of msg if msg is put into shm ring
 } SCliMsg;
 
 typedef struct SCliThrd {
@@ -121,6 +152,12 @@ typedef struct SCliThrd {
   SHashObj* failFastCache;
   SHashObj* batchCache;
 
+  SHashObj* muxCache;
+  queue     muxFlushQ;
+  int32_t   muxInflight;
+
+  SHashObj* shmFailCache;  // dst whose server refused shm, never try again
+
   SCliMsg* stopMsg;
 
   bool quit;
@@ -170,6 +207,21 @@ static void cliPrepareCb(uv_prepare_t* handle);
 static void cliHandleBatchReq(SCliBatch* pBatch, SCliThrd* pThrd);
 static void cliSendBatchCb(uv_write_t* req, int status);
 
+// multiplexed conn, many in-flight reqs share a few conns per endpoint
+static bool cliMuxEnabled(STrans* pTransInst, SCliMsg* pMsg);
+static void cliMuxHandleReq(SCliMsg* pMsg, SCliThrd* pThrd, char* addr, char* fqdn, uint16_t port);
+static void cliMuxHandleResp(SCliConn* conn, STransMsgHead* pHead);
+static void cliMuxHandleExcept(SCliConn* conn, int32_t code);
+static void cliMuxConnReady(SCliConn* conn);
+static void cliMuxRemoveConn(SCliConn* conn);
+static void cliMuxFlushCb(uv_prepare_t* handle);
+static void cliMuxSendCb(uv_write_t* req, int status);
+static void cliMuxDestroyCache(SCliThrd* pThrd);
+
+static void    cliShmMayAttach(SCliConn* conn, struct sockaddr* peer, struct sockaddr* sock);
+static void    cliShmMayPut(SCliConn* conn, SCliMsg* pCliMsg, uv_buf_t* wb);
+static int32_t cliShmHandleFrame(SCliConn* conn, STransMsgHead** ppHead, int32_t* msgLen);
+
 SCliBatch* cliGetHeadFromList(SCliBatchList* pList);
 
 static bool cliRecvReleaseReq(SCliConn* conn, STransMsgHead* pHead);
@@ -203,6 +255,7 @@ static void cliHandleResp(SCliConn* conn);
 // handle except about conn
 static void cliHandleExcept(SCliConn* conn);
 static void cliHandleFastFail(SCliConn* pConn, int status);
+static void cliHandleConnect(SCliConn* conn, SCliThrd* pThrd, char* fqdn, uint16_t port, STraceId* trace);
 
 static void doNotifyApp(SCliMsg* pMsg, SCliThrd* pThrd);
 // handle req from app
@@ -369,6 +422,20 @@ void cliHandleResp(SCliConn* conn) {
   SCliThrd* pThrd = conn->hostThrd;
   STrans*   pTransInst = pThrd->pTransInst;
 
+  STransMsgHead* pHead = NULL;
+
+  int32_t msgLen = transDumpFromBuffer(&conn->readBuf, (char**)&pHead);
+  if (msgLen <= 0) {
+    taosMemoryFree(pHead);
+    tDebug("%s conn %p recv invalid packet ", CONN_GET_INST_LABEL(conn), conn);
+    return;
+  }
+  if (pHead->version == TRANS_SHM_VER) {
+    if (cliShmHandleFrame(conn, &pHead, &msgLen) != 0) {
+      return;
+    }
+  }
+
   if (conn->timer) {
     if (uv_is_active((uv_handle_t*)conn->timer)) {
       tDebug("%s conn %p stop timer", CONN_GET_INST_LABEL(conn), conn);
@@ -379,20 +446,15 @@ void cliHandleResp(SCliConn* conn) {
     conn->timer = NULL;
   }
 
-  STransMsgHead* pHead = NULL;
-
-  int32_t msgLen = transDumpFromBuffer(&conn->readBuf, (char**)&pHead);
-  if (msgLen <= 0) {
-    taosMemoryFree(pHead);
-    tDebug("%s conn %p recv invalid packet ", CONN_GET_INST_LABEL(conn), conn);
-    return;
-  }
-
   if (transDecompressMsg((char**)&pHead, msgLen) < 0) {
     tDebug("%s conn %p recv invalid packet, failed to decompress", CONN_GET_INST_LABEL(conn), conn);
   }
   pHead->code = htonl(pHead->code);
   pHead->msgLen = htonl(pHead->msgLen);
+  if (conn->mux) {
+    cliMuxHandleResp(conn, pHead);
+    return;
+  }
   if (cliRecvReleaseReq(conn, pHead)) {
     return;
   }
@@ -493,6 +555,10 @@ static void cliDestroyMsgInExhandle(int64_t refId) {
   }
 }
 void cliHandleExceptImpl(SCliConn* pConn, int32_t code) {
+  if (pConn->mux) {
+    cliMuxHandleExcept(pConn, code);
+    return;
+  }
   if (transQueueEmpty(&pConn->cliMsgs)) {
     if (pConn->broken == true && CONN_NO_PERSIST_BY_APP(pConn)) {
       tTrace("%s conn %p handle except, persist:0", CONN_GET_INST_LABEL(pConn), pConn);
@@ -858,6 +924,7 @@ static void cliRecvCb(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf) {
         break;
       } else {
         cliHandleResp(conn);
+        if (conn->broken) break;
       }
     }
     return;
@@ -918,7 +985,9 @@ static void cliDestroyConn(SCliConn* conn, bool clear) {
 
   conn->broken = true;
 
-  if (conn->list != NULL) {
+  if (conn->mux) {
+    cliMuxRemoveConn(conn);
+  } else if (conn->list != NULL) {
     SConnList* connList = conn->list;
     connList->list->numOfConn--;
     connList->size--;
@@ -969,6 +1038,11 @@ static void cliDestroy(uv_handle_t* handle) {
 
   transReleaseExHandle(transGetRefMgt(), conn->refId);
   transRemoveExHandle(transGetRefMgt(), conn->refId);
+  if (conn->shm != NULL && !conn->shmReady && conn->dstAddr != NULL) {
+    int8_t fail = 1;
+    taosHashPut(pThrd->shmFailCache, conn->dstAddr, strlen(conn->dstAddr), &fail, sizeof(fail));
+  }
+  transShmDestroy(conn->shm);
   taosMemoryFree(conn->dstAddr);
   taosMemoryFree(conn->stream);
 
@@ -1071,14 +1145,15 @@ void cliSendBatch(SCliConn* pConn) {
     pHead->timestamp = taosHton64(taosGetTimestampUs());
 
     if (pHead->comp == 0) {
-      if (pTransInst->compressSize != -1 && pTransInst->compressSize < pMsg->contLen) {
+      if (!pConn->shmReady && pTransInst->compressSize != -1 && pTransInst->compressSize < pMsg->contLen) {
         msgLen = transCompressMsg(pMsg->pCont, pMsg->contLen) + sizeof(STransMsgHead);
         pHead->msgLen = (int32_t)htonl((uint32_t)msgLen);
       }
     } else {
       msgLen = (int32_t)ntohl((uint32_t)(pHead->msgLen));
     }
-    wb[i++] = uv_buf_init((char*)pHead, msgLen);
+    wb[i] = uv_buf_init((char*)pHead, msgLen);
+    cliShmMayPut(pConn, pCliMsg, &wb[i++]);
   }
 
   uv_write_t* req = taosMemoryCalloc(1, sizeof(uv_write_t));
@@ -1150,7 +1225,8 @@ void cliSend(SCliConn* pConn) {
   }
 
   if (pHead->comp == 0) {
-    if (pTransInst->compressSize != -1 && pTransInst->compressSize < pMsg->contLen) {
+    // no need to compress msg copied through shm
+    if (!pConn->shmReady && pTransInst->compressSize != -1 && pTransInst->compressSize < pMsg->contLen) {
       msgLen = transCompressMsg(pMsg->pCont, pMsg->contLen) + sizeof(STransMsgHead);
       pHead->msgLen = (int32_t)htonl((uint32_t)msgLen);
     }
@@ -1161,7 +1237,8 @@ void cliSend(SCliConn* pConn) {
   tGDebug("%s conn %p %s is sent to %s, local info %s, len:%d", CONN_GET_INST_LABEL(pConn), pConn,
           TMSG_INFO(pHead->msgType), pConn->dst, pConn->src, msgLen);
 
-  uv_buf_t    wb = uv_buf_init((char*)pHead, msgLen);
+  uv_buf_t wb = uv_buf_init((char*)pHead, msgLen);
+  cliShmMayPut(pConn, pCliMsg, &wb);
   uv_write_t* req = transReqQueuePush(&pConn->wreqQueue);
 
   int status = uv_write(req, (uv_stream_t*)pConn->stream, &wb, 1, cliSendCb);
@@ -1381,7 +1458,10 @@ void cliConnCb(uv_connect_t* req, int status) {
   transSockInfo2Str(&sockname, pConn->src);
 
   tTrace("%s conn %p connect to server successfully", CONN_GET_INST_LABEL(pConn), pConn);
-  if (pConn->pBatch != NULL) {
+  cliShmMayAttach(pConn, &peername, &sockname);
+  if (pConn->mux) {
+    cliMuxConnReady(pConn);
+  } else if (pConn->pBatch != NULL) {
     cliSendBatch(pConn);
   } else {
     cliSend(pConn);
@@ -1423,6 +1503,7 @@ static void cliHandleQuit(SCliMsg* pMsg, SCliThrd* pThrd) {
   destroyCmsg(pMsg);
 
   destroyConnPool(pThrd);
+  cliMuxDestroyCache(pThrd);
   uv_walk(pThrd->loop, cliWalkCb, NULL);
 }
 static void cliHandleRelease(SCliMsg* pMsg, SCliThrd* pThrd) {
@@ -1577,6 +1658,60 @@ static void doFreeTimeoutMsg(void* param) {
   doNotifyApp(pMsg, pThrd);
   taosMemoryFree(arg);
 }
+static void cliHandleConnect(SCliConn* conn, SCliThrd* pThrd, char* fqdn, uint16_t port, STraceId* trace) {
+  STrans* pTransInst = pThrd->pTransInst;
+
+  uint32_t ipaddr = cliGetIpFromFqdnCache(pThrd->fqdn2ipCache, fqdn);
+  if (ipaddr == 0xffffffff) {
+    uv_timer_stop(conn->timer);
+    conn->timer->data = NULL;
+    taosArrayPush(pThrd->timerList, &conn->timer);
+    conn->timer = NULL;
+
+    cliHandleExcept(conn);
+    return;
+  }
+
+  struct sockaddr_in addr;
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = ipaddr;
+  addr.sin_port = (uint16_t)htons(port);
+
+  tGTrace("%s conn %p try to connect to %s", pTransInst->label, conn, conn->dstAddr);
+  int32_t fd = taosCreateSocketWithTimeout(TRANS_CONN_TIMEOUT * 10);
+  if (fd == -1) {
+    tGError("%s conn %p failed to create socket, reason:%s", transLabel(pTransInst), conn,
+            tstrerror(TAOS_SYSTEM_ERROR(errno)));
+    cliHandleExcept(conn);
+    errno = 0;
+    return;
+  }
+  int ret = uv_tcp_open((uv_tcp_t*)conn->stream, fd);
+  if (ret != 0) {
+    tGError("%s conn %p failed to set stream, reason:%s", transLabel(pTransInst), conn, uv_err_name(ret));
+    cliHandleExcept(conn);
+    return;
+  }
+  ret = transSetConnOption((uv_tcp_t*)conn->stream, tsKeepAliveIdle);
+  if (ret != 0) {
+    tGError("%s conn %p failed to set socket opt, reason:%s", transLabel(pTransInst), conn, uv_err_name(ret));
+    cliHandleExcept(conn);
+    return;
+  }
+
+  ret = uv_tcp_connect(&conn->connReq, (uv_tcp_t*)(conn->stream), (const struct sockaddr*)&addr, cliConnCb);
+  if (ret != 0) {
+    uv_timer_stop(conn->timer);
+    conn->timer->data = NULL;
+    taosArrayPush(pThrd->timerList, &conn->timer);
+    conn->timer = NULL;
+
+    cliMayUpdateFqdnCache(pThrd->fqdn2ipCache, conn->dstAddr);
+    cliHandleFastFail(conn, ret);
+    return;
+  }
+  uv_timer_start(conn->timer, cliConnTimeout, TRANS_CONN_TIMEOUT, 0);
+}
 void cliHandleReq(SCliMsg* pMsg, SCliThrd* pThrd) {
   STrans* pTransInst = pThrd->pTransInst;
 
@@ -1590,6 +1725,11 @@ void cliHandleReq(SCliMsg* pMsg, SCliThrd* pThrd) {
   char     addr[TSDB_FQDN_LEN + 64] = {0};
   CONN_CONSTRUCT_HASH_KEY(addr, fqdn, port);
 
+  if (cliMuxEnabled(pTransInst, pMsg)) {
+    cliMuxHandleReq(pMsg, pThrd, addr, fqdn, port);
+    return;
+  }
+
   bool      ignore = false;
   SCliConn* conn = cliGetConn(&pMsg, pThrd, &ignore, addr);
   if (ignore == true) {
@@ -1624,59 +1764,421 @@ void cliHandleReq(SCliMsg* pMsg, SCliThrd* pThrd) {
     transQueuePush(&conn->cliMsgs, pMsg);
 
     conn->dstAddr = taosStrdup(addr);
+    cliHandleConnect(conn, pThrd, fqdn, port, trace);
+    return;
+  }
+  tGTrace("%s conn %p ready", pTransInst->label, conn);
+}
 
-    uint32_t ipaddr = cliGetIpFromFqdnCache(pThrd->fqdn2ipCache, fqdn);
-    if (ipaddr == 0xffffffff) {
-      uv_timer_stop(conn->timer);
-      conn->timer->data = NULL;
-      taosArrayPush(pThrd->timerList, &conn->timer);
-      conn->timer = NULL;
+// Multiplexed conn: reqs that do not need a persist handle share at most muxConnNum conns per endpoint in each
+// thread. Every req gets a conn-local id written into head's ahandle, the server echoes it back, so resps may arrive
+// in any order. Msgs queued on a conn within one loop iteration are written out by a single uv_write, and a conn
+// never holds more than muxInflight unanswered reqs, the rest wait in the list's pending queue.
+static bool cliMuxEnabled(STrans* pTransInst, SCliMsg* pMsg) {
+  return pTransInst->muxConnNum > 0 && pMsg->type == Normal && pMsg->msg.info.handle == 0 &&
+         !REQUEST_NO_RESP(&pMsg->msg) && !REQUEST_PERSIS_HANDLE(&pMsg->msg);
+}
+static SCliMuxList* cliMuxGetList(SCliThrd* pThrd, char* addr, char* fqdn, uint16_t port) {
+  size_t        klen = strlen(addr);
+  SCliMuxList** ppList = taosHashGet(pThrd->muxCache, addr, klen);
+  if (ppList != NULL) {
+    return *ppList;
+  }
+  SCliMuxList* pList = taosMemoryCalloc(1, sizeof(SCliMuxList));
+  pList->conns = taosArrayInit(4, sizeof(void*));
+  QUEUE_INIT(&pList->pending);
+  pList->dst = taosStrdup(addr);
+  pList->ip = taosStrdup(fqdn);
+  pList->port = port;
+  taosHashPut(pThrd->muxCache, addr, klen, &pList, sizeof(void*));
+  return pList;
+}
+static SCliConn* cliMuxCreateConn(SCliThrd* pThrd, SCliMuxList* pList) {
+  SCliConn* conn = cliCreateConn(pThrd);
+  conn->mux = true;
+  conn->muxList = pList;
+  conn->dstAddr = taosStrdup(pList->dst);
+  QUEUE_INIT(&conn->muxq);
+  taosArrayPush(pList->conns, &conn);
+  tDebug("%s conn %p multiplexed to %s, numOfConn:%d", CONN_GET_INST_LABEL(conn), conn, pList->dst,
+         (int32_t)taosArrayGetSize(pList->conns));
+  return conn;
+}
+// pick the least loaded conn, open a new one only if all existing conns are busy
+static SCliConn* cliMuxPickConn(SCliThrd* pThrd, SCliMuxList* pList, bool* created) {
+  STrans*   pTransInst = pThrd->pTransInst;
+  SCliConn* conn = NULL;
 
-      cliHandleExcept(conn);
-      return;
+  int32_t sz = taosArrayGetSize(pList->conns);
+  for (int32_t i = 0; i < sz; i++) {
+    SCliConn* c = taosArrayGetP(pList->conns, i);
+    if (c->inflight >= pTransInst->muxInflight) continue;
+    if (conn == NULL || c->inflight < conn->inflight) conn = c;
+  }
+  *created = false;
+  if ((conn == NULL || conn->inflight > 0) && sz < pTransInst->muxConnNum) {
+    conn = cliMuxCreateConn(pThrd, pList);
+    *created = true;
+  }
+  return conn;
+}
+static void cliMuxPushMsg(SCliConn* conn, SCliMsg* pMsg) {
+  SCliThrd* pThrd = conn->hostThrd;
+
+  pMsg->muxId = ++conn->muxSeq;
+  pMsg->sent = 0;
+  transQueuePush(&conn->cliMsgs, pMsg);
+
+  conn->inflight++;
+  if (conn->inflight > conn->maxInflight) conn->maxInflight = conn->inflight;
+  conn->muxList->numOfReq++;
+  atomic_add_fetch_32(&pThrd->muxInflight, 1);
+
+  STraceId* trace = &pMsg->msg.info.traceId;
+  tGTrace("%s conn %p %s queued, req id:%" PRIu64 ", inflight:%d", CONN_GET_INST_LABEL(conn), conn,
+          TMSG_INFO(pMsg->msg.msgType), pMsg->muxId, conn->inflight);
+
+  if (conn->muxReady && !conn->muxFlush) {
+    conn->muxFlush = true;
+    QUEUE_PUSH(&pThrd->muxFlushQ, &conn->muxq);
+  }
+}
+static void cliMuxDispatch(SCliThrd* pThrd, SCliMuxList* pList) {
+  while (!QUEUE_IS_EMPTY(&pList->pending)) {
+    bool      created = false;
+    SCliConn* conn = cliMuxPickConn(pThrd, pList, &created);
+    if (conn == NULL) break;
+
+    queue* h = QUEUE_HEAD(&pList->pending);
+    QUEUE_REMOVE(h);
+    pList->numOfPending--;
+
+    SCliMsg* pMsg = QUEUE_DATA(h, SCliMsg, q);
+    cliMuxPushMsg(conn, pMsg);
+    if (created) {
+      cliHandleConnect(conn, pThrd, pList->ip, pList->port, &pMsg->msg.info.traceId);
     }
+  }
+}
+static void cliMuxHandleReq(SCliMsg* pMsg, SCliThrd* pThrd, char* addr, char* fqdn, uint16_t port) {
+  STraceId*    trace = &pMsg->msg.info.traceId;
+  SCliMuxList* pList = cliMuxGetList(pThrd, addr, fqdn, port);
 
-    struct sockaddr_in addr;
-    addr.sin_family = AF_INET;
-    addr.sin_addr.s_addr = ipaddr;
-    addr.sin_port = (uint16_t)htons(port);
+  bool      created = false;
+  SCliConn* conn = QUEUE_IS_EMPTY(&pList->pending) ? cliMuxPickConn(pThrd, pList, &created) : NULL;
+  if (conn == NULL) {
+    // flow control, all conns reach the in-flight limit
+    QUEUE_PUSH(&pList->pending, &pMsg->q);
+    pList->numOfPending++;
+    tGDebug("%s msg %s wait for multiplexed conn to %s, pending:%d", transLabel(pThrd->pTransInst),
+            TMSG_INFO(pMsg->msg.msgType), addr, pList->numOfPending);
+    return;
+  }
+  cliMuxPushMsg(conn, pMsg);
+  if (created) {
+    cliHandleConnect(conn, pThrd, fqdn, port, trace);
+  }
+}
+static void cliMuxConnReady(SCliConn* conn) {
+  SCliThrd* pThrd = conn->hostThrd;
 
-    tGTrace("%s conn %p try to connect to %s", pTransInst->label, conn, conn->dstAddr);
-    int32_t fd = taosCreateSocketWithTimeout(TRANS_CONN_TIMEOUT * 10);
-    if (fd == -1) {
-      tGError("%s conn %p failed to create socket, reason:%s", transLabel(pTransInst), conn,
-              tstrerror(TAOS_SYSTEM_ERROR(errno)));
-      cliHandleExcept(conn);
-      errno = 0;
-      return;
+  conn->muxReady = true;
+  uv_read_start((uv_stream_t*)conn->stream, cliAllocRecvBufferCb, cliRecvCb);
+  if (!transQueueEmpty(&conn->cliMsgs) && !conn->muxFlush) {
+    conn->muxFlush = true;
+    QUEUE_PUSH(&pThrd->muxFlushQ, &conn->muxq);
+  }
+}
+static int32_t cliMuxBuildMsg(SCliConn* pConn, SCliMsg* pCliMsg, uv_buf_t* wb) {
+  SCliThrd* pThrd = pConn->hostThrd;
+  STrans*   pTransInst = pThrd->pTransInst;
+
+  STransMsg* pMsg = (STransMsg*)(&pCliMsg->msg);
+  if (pMsg->pCont == 0) {
+    pMsg->pCont = (void*)rpcMallocCont(0);
+    pMsg->contLen = 0;
+  }
+
+  int            msgLen = transMsgLenFromCont(pMsg->contLen);
+  STransMsgHead* pHead = transHeadFromCont(pMsg->pCont);
+
+  if (pHead->comp == 0) {
+    pHead->noResp = 0;
+    pHead->persist = 0;
+    pHead->msgType = pMsg->msgType;
+    pHead->msgLen = (int32_t)htonl((uint32_t)msgLen);
+    pHead->release = 0;
+    memcpy(pHead->user, pTransInst->user, strlen(pTransInst->user));
+    pHead->traceId = pMsg->info.traceId;
+    pHead->magicNum = htonl(TRANS_MAGIC_NUM);
+    pHead->version = TRANS_VER;
+    pHead->compatibilityVer = htonl(pTransInst->compatibilityVer);
+  }
+  // not covered by compression, so a msg resent after retry gets its new id as well
+  pHead->ahandle = pCliMsg->muxId;
+  pHead->timestamp = taosHton64(taosGetTimestampUs());
+
+  if (pHead->comp == 0) {
+    if (!pConn->shmReady && pTransInst->compressSize != -1 && pTransInst->compressSize < pMsg->contLen) {
+      msgLen = transCompressMsg(pMsg->pCont, pMsg->contLen) + sizeof(STransMsgHead);
+      pHead->msgLen = (int32_t)htonl((uint32_t)msgLen);
     }
-    int ret = uv_tcp_open((uv_tcp_t*)conn->stream, fd);
-    if (ret != 0) {
-      tGError("%s conn %p failed to set stream, reason:%s", transLabel(pTransInst), conn, uv_err_name(ret));
-      cliHandleExcept(conn);
-      return;
+  } else {
+    msgLen = (int32_t)ntohl((uint32_t)(pHead->msgLen));
+  }
+
+  *wb = uv_buf_init((char*)pHead, msgLen);
+  cliShmMayPut(pConn, pCliMsg, wb);
+  return msgLen;
+}
+static void cliMuxSend(SCliConn* pConn) {
+  int32_t sz = transQueueSize(&pConn->cliMsgs);
+  int32_t num = 0;
+  for (int32_t i = 0; i < sz; i++) {
+    SCliMsg* pCliMsg = transQueueGet(&pConn->cliMsgs, i);
+    if (pCliMsg->sent == 0) num++;
+  }
+  if (num == 0) return;
+
+  uv_buf_t* wb = taosMemoryCalloc(num, sizeof(uv_buf_t));
+  int32_t   n = 0, len = 0;
+  for (int32_t i = 0; i < sz && n < num; i++) {
+    SCliMsg* pCliMsg = transQueueGet(&pConn->cliMsgs, i);
+    if (pCliMsg->sent != 0) continue;
+
+    pCliMsg->sent = 1;
+    len += cliMuxBuildMsg(pConn, pCliMsg, &wb[n++]);
+  }
+  pConn->numOfWrite++;
+  tDebug("%s conn %p send %d msgs to %s in one write, len:%d, inflight:%d", CONN_GET_INST_LABEL(pConn), pConn, n,
+         pConn->dst, len, pConn->inflight);
+
+  uv_write_t* req = transReqQueuePush(&pConn->wreqQueue);
+  int         status = uv_write(req, (uv_stream_t*)pConn->stream, wb, n, cliMuxSendCb);
+  taosMemoryFree(wb);
+  if (status != 0) {
+    tError("%s conn %p failed to send msgs, errmsg:%s", CONN_GET_INST_LABEL(pConn), pConn, uv_err_name(status));
+    cliHandleExcept(pConn);
+  }
+}
+static void cliMuxFlushCb(uv_prepare_t* handle) {
+  SCliThrd* pThrd = handle->data;
+  while (!QUEUE_IS_EMPTY(&pThrd->muxFlushQ)) {
+    queue* h = QUEUE_HEAD(&pThrd->muxFlushQ);
+    QUEUE_REMOVE(h);
+
+    SCliConn* conn = QUEUE_DATA(h, SCliConn, muxq);
+    conn->muxFlush = false;
+    cliMuxSend(conn);
+  }
+}
+static void cliMuxSendCb(uv_write_t* req, int status) {
+  SCliConn* pConn = transReqQueueRemove(req);
+  if (pConn == NULL) return;
+
+  if (status != 0) {
+    if (!uv_is_closing((uv_handle_t*)pConn->stream)) {
+      tError("%s conn %p failed to write:%s", CONN_GET_INST_LABEL(pConn), pConn, uv_err_name(status));
+      cliHandleExcept(pConn);
     }
-    ret = transSetConnOption((uv_tcp_t*)conn->stream, tsKeepAliveIdle);
-    if (ret != 0) {
-      tGError("%s conn %p failed to set socket opt, reason:%s", transLabel(pTransInst), conn, uv_err_name(ret));
-      cliHandleExcept(conn);
-      return;
+  }
+}
+static void cliMuxHandleResp(SCliConn* conn, STransMsgHead* pHead) {
+  SCliThrd* pThrd = conn->hostThrd;
+
+  SCliMsg* pMsg = NULL;
+  int32_t  sz = transQueueSize(&conn->cliMsgs);
+  for (int32_t i = 0; i < sz; i++) {
+    SCliMsg* p = transQueueGet(&conn->cliMsgs, i);
+    if (p->muxId == pHead->ahandle) {
+      pMsg = transQueueRm(&conn->cliMsgs, i);
+      break;
     }
+  }
+  if (pMsg == NULL) {
+    tDebug("%s conn %p recv resp of unknown req id:%" PRIu64 ", ignore it", CONN_GET_INST_LABEL(conn), conn,
+           pHead->ahandle);
+    transFreeMsg(transContFromHead((char*)pHead));
+    return;
+  }
+  conn->inflight--;
+  atomic_sub_fetch_32(&pThrd->muxInflight, 1);
 
-    ret = uv_tcp_connect(&conn->connReq, (uv_tcp_t*)(conn->stream), (const struct sockaddr*)&addr, cliConnCb);
-    if (ret != 0) {
-      uv_timer_stop(conn->timer);
-      conn->timer->data = NULL;
-      taosArrayPush(pThrd->timerList, &conn->timer);
-      conn->timer = NULL;
+  STransMsg transMsg = {0};
+  transMsg.contLen = transContLenFromMsg(pHead->msgLen);
+  transMsg.pCont = transContFromHead((char*)pHead);
+  transMsg.code = pHead->code;
+  transMsg.msgType = pHead->msgType;
+  transMsg.info.ahandle = pMsg->ctx ? pMsg->ctx->ahandle : NULL;
+  transMsg.info.traceId = pHead->traceId;
+  transMsg.info.hasEpSet = pHead->hasEpSet;
+  transMsg.info.cliVer = htonl(pHead->compatibilityVer);
 
-      cliMayUpdateFqdnCache(pThrd->fqdn2ipCache, conn->dstAddr);
-      cliHandleFastFail(conn, ret);
-      return;
+  STraceId* trace = &transMsg.info.traceId;
+  tGDebug("%s conn %p %s received from %s, local info:%s, len:%d, req id:%" PRIu64 ", inflight:%d, code str:%s",
+          CONN_GET_INST_LABEL(conn), conn, TMSG_INFO(pHead->msgType), conn->dst, conn->src, pHead->msgLen,
+          pMsg->muxId, conn->inflight, tstrerror(transMsg.code));
+
+  SCliMuxList* pList = conn->muxList;
+  if (cliAppCb(conn, &transMsg, pMsg) == 0) {
+    destroyCmsg(pMsg);
+  }
+  if (pList != NULL) {
+    cliMuxDispatch(pThrd, pList);
+  }
+}
+static void cliMuxHandleExcept(SCliConn* conn, int32_t code) {
+  SCliThrd*    pThrd = conn->hostThrd;
+  STrans*      pTransInst = pThrd->pTransInst;
+  SCliMuxList* pList = conn->muxList;
+
+  // detach first, so reqs retried below never pick this conn again
+  cliMuxRemoveConn(conn);
+
+  SCliMsg* pMsg = NULL;
+  while ((pMsg = transQueuePop(&conn->cliMsgs)) != NULL) {
+    conn->inflight--;
+    atomic_sub_fetch_32(&pThrd->muxInflight, 1);
+
+    STransMsg transMsg = {0};
+    transMsg.code = code == -1 ? (conn->broken ? TSDB_CODE_RPC_BROKEN_LINK : TSDB_CODE_RPC_NETWORK_UNAVAIL) : code;
+    transMsg.msgType = pMsg->msg.msgType + 1;
+    transMsg.info.ahandle = pMsg->ctx ? pMsg->ctx->ahandle : NULL;
+    transMsg.info.traceId = pMsg->msg.info.traceId;
+    transMsg.info.cliVer = pTransInst->compatibilityVer;
+    if (cliAppCb(conn, &transMsg, pMsg) == 0) {
+      destroyCmsg(pMsg);
     }
-    uv_timer_start(conn->timer, cliConnTimeout, TRANS_CONN_TIMEOUT, 0);
   }
-  tGTrace("%s conn %p ready", pTransInst->label, conn);
+  if (T_REF_VAL_GET(conn) > 1) transUnrefCliHandle(conn);
+  transUnrefCliHandle(conn);
+
+  if (pList != NULL) {
+    cliMuxDispatch(pThrd, pList);
+  }
+}
+static void cliMuxRemoveConn(SCliConn* conn) {
+  if (conn->muxFlush) {
+    QUEUE_REMOVE(&conn->muxq);
+    conn->muxFlush = false;
+  }
+  SCliMuxList* pList = conn->muxList;
+  if (pList == NULL) return;
+
+  for (int32_t i = 0; i < taosArrayGetSize(pList->conns); i++) {
+    if (taosArrayGetP(pList->conns, i) == conn) {
+      taosArrayRemove(pList->conns, i);
+      break;
+    }
+  }
+  conn->muxList = NULL;
+  conn->muxReady = false;
+  tDebug("%s conn %p removed from multiplexed conns to %s, inflight:%d, max inflight:%d, writes:%" PRId64
+         ", total reqs:%" PRIu64,
+         CONN_GET_INST_LABEL(conn), conn, pList->dst, conn->inflight, conn->maxInflight, conn->numOfWrite,
+         pList->numOfReq);
+}
+static void cliMuxDestroyCache(SCliThrd* pThrd) {
+  void** pIter = taosHashIterate(pThrd->muxCache, NULL);
+  while (pIter != NULL) {
+    SCliMuxList* pList = (SCliMuxList*)(*pIter);
+    while (taosArrayGetSize(pList->conns) > 0) {
+      cliMuxRemoveConn(taosArrayGetP(pList->conns, 0));
+    }
+    while (!QUEUE_IS_EMPTY(&pList->pending)) {
+      queue* h = QUEUE_HEAD(&pList->pending);
+      QUEUE_REMOVE(h);
+      doNotifyApp(QUEUE_DATA(h, SCliMsg, q), pThrd);
+    }
+    taosArrayDestroy(pList->conns);
+    taosMemoryFree(pList->dst);
+    taosMemoryFree(pList->ip);
+    taosMemoryFree(pList);
+
+    pIter = (void**)taosHashIterate(pThrd->muxCache, pIter);
+  }
+  taosHashClear(pThrd->muxCache);
+}
+
+static void cliShmAttachCb(uv_write_t* req, int status) {
+  if (status != 0) {
+    tDebug("failed to send shm attach, reason:%s", uv_err_name(status));
+  }
+  taosMemoryFree(req);
+}
+static void cliShmMayAttach(SCliConn* conn, struct sockaddr* peer, struct sockaddr* sock) {
+  SCliThrd* pThrd = conn->hostThrd;
+  STrans*   pTransInst = pThrd->pTransInst;
+  if (pTransInst->shmSize <= 0 || conn->shm != NULL || conn->dstAddr == NULL) {
+    return;
+  }
+  // only a server on the same host can map the ring
+  if (peer->sa_family != AF_INET || sock->sa_family != AF_INET ||
+      ((struct sockaddr_in*)peer)->sin_addr.s_addr != ((struct sockaddr_in*)sock)->sin_addr.s_addr) {
+    return;
+  }
+  if (taosHashGet(pThrd->shmFailCache, conn->dstAddr, strlen(conn->dstAddr)) != NULL) {
+    return;
+  }
+
+  conn->shm = transShmCreate(pTransInst->shmSize);
+  if (conn->shm == NULL) {
+    return;
+  }
+  transShmBuildAttach(conn->shm, &conn->shmAttach);
+
+  // written before any msg, so server attaches the ring before it reads a frame refers to it
+  uv_write_t* req = taosMemoryCalloc(1, sizeof(uv_write_t));
+  uv_buf_t    wb = uv_buf_init((char*)&conn->shmAttach, sizeof(STransShmFrame));
+  if (uv_write(req, (uv_stream_t*)conn->stream, &wb, 1, cliShmAttachCb) != 0) {
+    taosMemoryFree(req);
+    transShmDestroy(conn->shm);
+    conn->shm = NULL;
+    return;
+  }
+  tDebug("%s conn %p start to attach shm to %s", CONN_GET_INST_LABEL(conn), conn, conn->dst);
+}
+static void cliShmMayPut(SCliConn* conn, SCliMsg* pCliMsg, uv_buf_t* wb) {
+  if (!conn->shmReady) {
+    return;
+  }
+  if (transShmPut(conn->shm, wb->base, wb->len, &pCliMsg->shmFrame) == 0) {
+    *wb = uv_buf_init((char*)&pCliMsg->shmFrame, sizeof(STransShmFrame));
+  }
+}
+static int32_t cliShmHandleFrame(SCliConn* conn, STransMsgHead** ppHead, int32_t* msgLen) {
+  SCliThrd*       pThrd = conn->hostThrd;
+  STransShmFrame* pFrame = (STransShmFrame*)(*ppHead);
+
+  if (TRANS_SHM_TYPE(&pFrame->head) == TRANS_SHM_ATTACH && *msgLen == sizeof(STransShmFrame) && conn->shm != NULL &&
+      !conn->shmReady) {
+    if (pFrame->len == 0) {
+      tDebug("%s conn %p shm refused by %s", CONN_GET_INST_LABEL(conn), conn, conn->dst);
+      int8_t fail = 1;
+      taosHashPut(pThrd->shmFailCache, conn->dstAddr, strlen(conn->dstAddr), &fail, sizeof(fail));
+      transShmDestroy(conn->shm);
+      conn->shm = NULL;
+    } else {
+      tDebug("%s conn %p shm attached by %s", CONN_GET_INST_LABEL(conn), conn, conn->dst);
+      conn->shmReady = true;
+    }
+    taosMemoryFree(*ppHead);
+    return 1;
+  }
+
+  int32_t len = -1;
+  if (TRANS_SHM_TYPE(&pFrame->head) == TRANS_SHM_DATA) {
+    len = transShmGet(conn->shm, ppHead, *msgLen);
+  }
+  if (len < 0) {
+    tError("%s conn %p recv invalid shm frame", CONN_GET_INST_LABEL(conn), conn);
+    taosMemoryFree(*ppHead);
+    conn->broken = true;
+    cliHandleExcept(conn);
+    return -1;
+  }
+  *msgLen = len;
+  return 0;
 }
 
 static void cliNoBatchDealReq(queue* wq, SCliThrd* pThrd) {
@@ -2072,6 +2574,15 @@ static SCliThrd* createThrdObj(void* trans) {
 
   pThrd->batchCache = taosHashInit(8, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY), true, HASH_NO_LOCK);
 
+  pThrd->muxCache = taosHashInit(8, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY), true, HASH_NO_LOCK);
+  QUEUE_INIT(&pThrd->muxFlushQ);
+
+  pThrd->shmFailCache = taosHashInit(4, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY), true, HASH_NO_LOCK);
+  if (pTransInst->muxConnNum > 0) {
+    // coalesce msgs queued on multiplexed conns during one loop iteration into a single write
+    uv_prepare_start(pThrd->prepare, cliMuxFlushCb);
+  }
+
   pThrd->quit = false;
 
   return pThrd;
@@ -2119,6 +2630,8 @@ static void destroyThrdObj(SCliThrd* pThrd) {
     pIter = (void**)taosHashIterate(pThrd->batchCache, pIter);
   }
   taosHashCleanup(pThrd->batchCache);
+  taosHashCleanup(pThrd->muxCache);
+  taosHashCleanup(pThrd->shmFailCache);
   taosMemoryFree(pThrd);
 }
 
@@ -2328,7 +2841,7 @@ bool cliGenRetryRule(SCliConn* pConn, STransMsg* pResp, SCliMsg* pMsg) {
     tTrace("code str %s, contlen:%d 0", tstrerror(code), pResp->contLen);
     noDelay = cliResetEpset(pCtx, pResp, false);
     transFreeMsg(pResp->pCont);
-    transUnrefCliHandle(pConn);
+    if (!pConn->mux) transUnrefCliHandle(pConn);
   } else if (code == TSDB_CODE_SYN_NOT_LEADER || code == TSDB_CODE_SYN_INTERNAL_ERROR ||
              code == TSDB_CODE_SYN_PROPOSE_NOT_READY || code == TSDB_CODE_VND_STOPPED ||
              code == TSDB_CODE_MNODE_NOT_FOUND || code == TSDB_CODE_APP_IS_STARTING ||
@@ -2336,16 +2849,16 @@ bool cliGenRetryRule(SCliConn* pConn, STransMsg* pResp, SCliMsg* pMsg) {
     tTrace("code str %s, contlen:%d 1", tstrerror(code), pResp->contLen);
     noDelay = cliResetEpset(pCtx, pResp, true);
     transFreeMsg(pResp->pCont);
-    addConnToPool(pThrd->pool, pConn);
+    if (!pConn->mux) addConnToPool(pThrd->pool, pConn);
   } else if (code == TSDB_CODE_SYN_RESTORING) {
     tTrace("code str %s, contlen:%d 0", tstrerror(code), pResp->contLen);
     noDelay = cliResetEpset(pCtx, pResp, true);
-    addConnToPool(pThrd->pool, pConn);
+    if (!pConn->mux) addConnToPool(pThrd->pool, pConn);
     transFreeMsg(pResp->pCont);
   } else {
     tTrace("code str %s, contlen:%d 0", tstrerror(code), pResp->contLen);
     noDelay = cliResetEpset(pCtx, pResp, false);
-    addConnToPool(pThrd->pool, pConn);
+    if (!pConn->mux) addConnToPool(pThrd->pool, pConn);
     transFreeMsg(pResp->pCont);
   }
   if (code != TSDB_CODE_RPC_BROKEN_LINK && code != TSDB_CODE_RPC_NETWORK_UNAVAIL && code != TSDB_CODE_SUCCESS) {
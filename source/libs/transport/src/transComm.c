@@ -196,7 +196,8 @@ bool transReadComplete(SConnBuffer* connBuf) {
       memcpy((char*)&head, connBuf->buf, sizeof(head));
       int32_t msgLen = (int32_t)htonl(head.msgLen);
       p->total = msgLen;
-      p->invalid = TRANS_NOVALID_PACKET(htonl(head.magicNum)) || head.version != TRANS_VER;
+      p->invalid = TRANS_NOVALID_PACKET(htonl(head.magicNum)) ||
+                   (head.version != TRANS_VER && head.version != TRANS_SHM_VER);
     }
     if (p->total >= p->len) {
       p->left = p->total - p->len;
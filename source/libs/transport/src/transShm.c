@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "transComm.h"
+
+#define TRANS_SHM_MAGIC    0x7a3e5d1b
+#define TRANS_SHM_MIN_SIZE (64 * 1024)
+
+typedef struct {
+  int64_t head;  // bytes written by producer
+  char    pad1[56];
+  int64_t tail;  // bytes consumed by consumer
+  char    pad2[56];
+} STransShmRing;
+
+typedef struct {
+  int32_t       magic;
+  int32_t       ringSize;
+  int64_t       token;
+  char          pad[48];
+  STransShmRing rings[2];  // 0: client to server, 1: server to client
+} STransShmHead;
+
+// positions are kept locally as well, the peer is only trusted for the position it moves
+struct STransShm {
+  SShm           shm;
+  int32_t        ringSize;
+  int64_t        token;
+  STransShmRing* pWRing;
+  char*          pWData;
+  int64_t        wHead;
+  STransShmRing* pRRing;
+  char*          pRData;
+  int64_t        rTail;
+};
+
+static void transShmInitRing(STransShm* pShm, bool creator) {
+  STransShmHead* pHead = pShm->shm.ptr;
+  char*          data = (char*)pShm->shm.ptr + sizeof(STransShmHead);
+
+  int32_t w = creator ? 0 : 1;
+  pShm->pWRing = &pHead->rings[w];
+  pShm->pWData = data + (int64_t)w * pShm->ringSize;
+  pShm->pRRing = &pHead->rings[1 - w];
+  pShm->pRData = data + (int64_t)(1 - w) * pShm->ringSize;
+}
+
+STransShm* transShmCreate(int32_t ringSize) {
+  ringSize = TMAX(ringSize, TRANS_SHM_MIN_SIZE);
+  if ((int64_t)ringSize * 2 + sizeof(STransShmHead) > INT32_MAX) {
+    return NULL;
+  }
+
+  STransShm* pShm = taosMemoryCalloc(1, sizeof(STransShm));
+  if (pShm == NULL) {
+    return NULL;
+  }
+  if (taosCreateShm(&pShm->shm, sizeof(STransShmHead) + ringSize * 2) != 0) {
+    tError("failed to create shm, size:%d, reason:%s", ringSize, strerror(errno));
+    taosMemoryFree(pShm);
+    return NULL;
+  }
+
+  STransShmHead* pHead = pShm->shm.ptr;
+  memset(pHead, 0, sizeof(STransShmHead));
+  pHead->magic = TRANS_SHM_MAGIC;
+  pHead->ringSize = ringSize;
+  pHead->token = ((int64_t)taosSafeRand() << 32) | taosSafeRand();
+
+  pShm->ringSize = ringSize;
+  pShm->token = pHead->token;
+  transShmInitRing(pShm, true);
+  tDebug("shm %d created, ring size:%d", pShm->shm.id, ringSize);
+  return pShm;
+}
+
+STransShm* transShmAttach(STransShmFrame* pFrame, int32_t maxRingSize) {
+  if (pFrame->len <= (int32_t)sizeof(STransShmHead) ||
+      pFrame->len - sizeof(STransShmHead) > 2 * (int64_t)TMAX(maxRingSize, TRANS_SHM_MIN_SIZE)) {
+    tError("failed to attach shm %d, invalid size:%d", pFrame->shmId, pFrame->len);
+    return NULL;
+  }
+
+  STransShm* pShm = taosMemoryCalloc(1, sizeof(STransShm));
+  if (pShm == NULL) {
+    return NULL;
+  }
+  pShm->shm.id = pFrame->shmId;
+  pShm->shm.size = pFrame->len;
+  if (taosAttachShm(&pShm->shm) != 0) {
+    tError("failed to attach shm %d, reason:%s", pFrame->shmId, strerror(errno));
+    taosMemoryFree(pShm);
+    return NULL;
+  }
+
+  // the token proves the peer created this segment
+  STransShmHead* pHead = pShm->shm.ptr;
+  int32_t        ringSize = pHead->ringSize;
+  if (pHead->magic != TRANS_SHM_MAGIC || pHead->token != pFrame->token || ringSize < TRANS_SHM_MIN_SIZE ||
+      sizeof(STransShmHead) + 2 * (int64_t)ringSize != pFrame->len) {
+    tError("failed to attach shm %d, invalid head", pFrame->shmId);
+    taosDetachShm(&pShm->shm);
+    taosMemoryFree(pShm);
+    return NULL;
+  }
+
+  pShm->ringSize = ringSize;
+  pShm->token = pFrame->token;
+  transShmInitRing(pShm, false);
+  tDebug("shm %d attached, ring size:%d", pShm->shm.id, ringSize);
+  return pShm;
+}
+
+void transShmDestroy(STransShm* pShm) {
+  if (pShm == NULL) return;
+  tDebug("shm %d detached, bytes sent:%" PRId64 ", bytes received:%" PRId64, pShm->shm.id, pShm->wHead, pShm->rTail);
+  taosDetachShm(&pShm->shm);
+  taosMemoryFree(pShm);
+}
+
+static void transShmBuildFrame(STransShm* pShm, STransShmFrame* pFrame, int8_t type) {
+  memset(pFrame, 0, sizeof(STransShmFrame));
+  pFrame->head.version = TRANS_SHM_VER;
+  pFrame->head.shm = type;
+  pFrame->head.magicNum = htonl(TRANS_MAGIC_NUM);
+  pFrame->head.msgLen = (int32_t)htonl((uint32_t)sizeof(STransShmFrame));
+  pFrame->shmId = pShm->shm.id;
+}
+
+void transShmBuildAttach(STransShm* pShm, STransShmFrame* pFrame) {
+  transShmBuildFrame(pShm, pFrame, TRANS_SHM_ATTACH);
+  pFrame->len = pShm->shm.size;
+  pFrame->token = pShm->token;
+}
+
+int32_t transShmPut(STransShm* pShm, char* msg, int32_t len, STransShmFrame* pFrame) {
+  if (pShm == NULL || len <= (int32_t)sizeof(STransShmFrame) || len > pShm->ringSize) {
+    return -1;
+  }
+  int64_t tail = atomic_load_64(&pShm->pWRing->tail);
+  if (pShm->wHead + len - tail > pShm->ringSize) {
+    return -1;
+  }
+
+  int32_t offset = pShm->wHead % pShm->ringSize;
+  int32_t n = TMIN(len, pShm->ringSize - offset);
+  memcpy(pShm->pWData + offset, msg, n);
+  if (n < len) {
+    memcpy(pShm->pWData, msg + n, len - n);
+  }
+
+  transShmBuildFrame(pShm, pFrame, TRANS_SHM_DATA);
+  pFrame->len = len;
+  pFrame->pos = pShm->wHead;
+
+  pShm->wHead += len;
+  atomic_store_64(&pShm->pWRing->head, pShm->wHead);
+  return 0;
+}
+
+int32_t transShmGet(STransShm* pShm, STransMsgHead** ppHead, int32_t frameLen) {
+  STransShmFrame* pFrame = (STransShmFrame*)(*ppHead);
+  if (pShm == NULL || frameLen != sizeof(STransShmFrame) || TRANS_SHM_TYPE(&pFrame->head) != TRANS_SHM_DATA ||
+      pFrame->pos != pShm->rTail || pFrame->len <= (int32_t)sizeof(STransMsgHead) || pFrame->len > pShm->ringSize) {
+    return -1;
+  }
+
+  int32_t len = pFrame->len;
+  char*   buf = taosMemoryCalloc(1, len);
+  if (buf == NULL) {
+    return -1;
+  }
+  int32_t offset = pShm->rTail % pShm->ringSize;
+  int32_t n = TMIN(len, pShm->ringSize - offset);
+  memcpy(buf, pShm->pRData + offset, n);
+  if (n < len) {
+    memcpy(buf + n, pShm->pRData, len - n);
+  }
+
+  pShm->rTail += len;
+  atomic_store_64(&pShm->pRRing->tail, pShm->rTail);
+
+  if ((int32_t)htonl(((STransMsgHead*)buf)->msgLen) != len) {
+    taosMemoryFree(buf);
+    return -1;
+  }
+  taosMemoryFree(*ppHead);
+  *ppHead = (STransMsgHead*)buf;
+  return len;
+}
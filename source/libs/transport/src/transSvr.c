@@ -58,6 +58,9 @@ typedef struct SSvrConn {
   char    ckey[TSDB_PASSWORD_LEN];  // ciphering key
 
   int64_t whiteListVer;
+
+  STransShm*     shm;  // attached at the request of a client on the same host
+  STransShmFrame shmAck;
 } SSvrConn;
 
 typedef struct SSvrMsg {
@@ -69,6 +72,7 @@ typedef struct SSvrMsg {
   void*     arg;
   FilteFunc func;
 
+  STransShmFrame shmFrame;  // sent instead of msg if msg is put into shm ring
 } SSvrMsg;
 
 typedef struct {
@@ -155,6 +159,7 @@ static void uvFreeCb(uv_handle_t* handle);
 static FORCE_INLINE void uvStartSendRespImpl(SSvrMsg* smsg);
 
 static int  uvPrepareSendData(SSvrMsg* msg, uv_buf_t* wb);
+static bool uvHandleShmAttach(SSvrConn* pConn, STransShmFrame* pFrame);
 static void uvStartSendResp(SSvrMsg* msg);
 
 static void uvNotifyLinkBrokenToApp(SSvrConn* conn);
@@ -347,6 +352,19 @@ static bool uvHandleReq(SSvrConn* pConn) {
     tError("%s conn %p read invalid packet", transLabel(pTransInst), pConn);
     return false;
   }
+  if (pHead->version == TRANS_SHM_VER) {
+    STransShmFrame* pFrame = (STransShmFrame*)pHead;
+    if (msgLen == sizeof(STransShmFrame) && TRANS_SHM_TYPE(&pFrame->head) == TRANS_SHM_ATTACH) {
+      bool ret = uvHandleShmAttach(pConn, pFrame);
+      taosMemoryFree(pHead);
+      return ret;
+    }
+    if (TRANS_SHM_TYPE(&pFrame->head) != TRANS_SHM_DATA || (msgLen = transShmGet(pConn->shm, &pHead, msgLen)) < 0) {
+      tError("%s conn %p read invalid shm frame", transLabel(pTransInst), pConn);
+      taosMemoryFree(pHead);
+      return false;
+    }
+  }
 
   if (transDecompressMsg((char**)&pHead, msgLen) < 0) {
     tError("%s conn %p recv invalid packet, failed to decompress", transLabel(pTransInst), pConn);
@@ -427,6 +445,7 @@ static bool uvHandleReq(SSvrConn* pConn) {
   transMsg.info.traceId = pHead->traceId;
   transMsg.info.cliVer = htonl(pHead->compatibilityVer);
   transMsg.info.forbiddenIp = forbiddenIp;
+  transMsg.info.reqType = pHead->msgType;
 
   tGTrace("%s handle %p conn:%p translated to app, refId:%" PRIu64, transLabel(pTransInst), transMsg.info.handle, pConn,
           pConn->refId);
@@ -585,15 +604,18 @@ static int uvPrepareSendData(SSvrMsg* smsg, uv_buf_t* wb) {
   pHead->compatibilityVer = htonl(((STrans*)pConn->pTransInst)->compatibilityVer);
   pHead->version = TRANS_VER;
 
+  // client may pipeline reqs on one conn, so the type of the last received req is not always the one answered here
+  int32_t inType = pMsg->info.reqType != 0 ? pMsg->info.reqType : pConn->inType;
+
   // handle invalid drop_task resp, TD-20098
-  if (pConn->inType == TDMT_SCH_DROP_TASK && pMsg->code == TSDB_CODE_VND_INVALID_VGROUP_ID) {
+  if (inType == TDMT_SCH_DROP_TASK && pMsg->code == TSDB_CODE_VND_INVALID_VGROUP_ID) {
     transQueuePop(&pConn->srvMsgs);
     destroySmsg(smsg);
     return -1;
   }
 
   if (pConn->status == ConnNormal) {
-    pHead->msgType = (0 == pMsg->msgType ? pConn->inType + 1 : pMsg->msgType);
+    pHead->msgType = (0 == pMsg->msgType ? inType + 1 : pMsg->msgType);
     if (smsg->type == Release) pHead->msgType = 0;
   } else {
     if (smsg->type == Release) {
@@ -603,7 +625,7 @@ static int uvPrepareSendData(SSvrMsg* smsg, uv_buf_t* wb) {
       transUnrefSrvHandle(pConn);
     } else {
       // set up resp msg type
-      pHead->msgType = (0 == pMsg->msgType ? pConn->inType + 1 : pMsg->msgType);
+      pHead->msgType = (0 == pMsg->msgType ? inType + 1 : pMsg->msgType);
     }
   }
 
@@ -615,7 +637,7 @@ static int uvPrepareSendData(SSvrMsg* smsg, uv_buf_t* wb) {
   int32_t len = transMsgLenFromCont(pMsg->contLen);
 
   STrans* pTransInst = pConn->pTransInst;
-  if (pTransInst->compressSize != -1 && pTransInst->compressSize < pMsg->contLen) {
+  if (pConn->shm == NULL && pTransInst->compressSize != -1 && pTransInst->compressSize < pMsg->contLen) {
     len = transCompressMsg(pMsg->pCont, pMsg->contLen) + sizeof(STransMsgHead);
     pHead->msgLen = (int32_t)htonl((uint32_t)len);
   }
@@ -626,9 +648,45 @@ static int uvPrepareSendData(SSvrMsg* smsg, uv_buf_t* wb) {
 
   wb->base = (char*)pHead;
   wb->len = len;
+  if (pConn->shm != NULL && transShmPut(pConn->shm, wb->base, wb->len, &smsg->shmFrame) == 0) {
+    wb->base = (char*)&smsg->shmFrame;
+    wb->len = sizeof(STransShmFrame);
+  }
   return 0;
 }
 
+static void uvShmAckCb(uv_write_t* req, int status) {
+  if (status != 0) {
+    tDebug("failed to send shm ack, reason:%s", uv_err_name(status));
+  }
+  taosMemoryFree(req);
+}
+static bool uvHandleShmAttach(SSvrConn* pConn, STransShmFrame* pFrame) {
+  STrans* pTransInst = pConn->pTransInst;
+  if (pConn->shm != NULL) {
+    tError("%s conn %p shm already attached", transLabel(pTransInst), pConn);
+    return false;
+  }
+
+  // a refused attach is acked with zero size, then client keeps sending msgs through conn
+  if (pTransInst->shmSize > 0 && pConn->clientIp == pConn->serverIp) {
+    pConn->shm = transShmAttach(pFrame, pTransInst->shmSize);
+  }
+  pConn->shmAck = *pFrame;
+  pConn->shmAck.len = pConn->shm != NULL ? pFrame->len : 0;
+  pConn->shmAck.token = 0;
+  tDebug("%s conn %p %s shm %d from %s", transLabel(pTransInst), pConn, pConn->shm != NULL ? "attach" : "refuse",
+         pFrame->shmId, pConn->dst);
+
+  uv_write_t* req = taosMemoryCalloc(1, sizeof(uv_write_t));
+  uv_buf_t    wb = uv_buf_init((char*)&pConn->shmAck, sizeof(STransShmFrame));
+  if (uv_write(req, (uv_stream_t*)pConn->pTcp, &wb, 1, uvShmAckCb) != 0) {
+    taosMemoryFree(req);
+    return false;
+  }
+  return true;
+}
+
 static FORCE_INLINE void uvStartSendRespImpl(SSvrMsg* smsg) {
   SSvrConn* pConn = smsg->pConn;
   if (pConn->broken) {
@@ -1149,6 +1207,7 @@ static void uvDestroyConn(uv_handle_t* handle) {
 
   QUEUE_REMOVE(&conn->queue);
   taosMemoryFree(conn->pTcp);
+  transShmDestroy(conn->shm);
   destroyConnRegArg(conn);
   transDestroyBuffer(&conn->readBuf);
   taosMemoryFree(conn);
@@ -75,6 +75,17 @@ class Client {
     rpcClose(this->transCli);
     this->transCli = NULL;
   }
+  void SetMux(int32_t connNum, int32_t inflight) {
+    rpcClose(this->transCli);
+    rpcInit_.muxConnNum = connNum;
+    rpcInit_.muxInflight = inflight;
+    this->transCli = rpcOpen(&rpcInit_);
+  }
+  void SetShm(int32_t size) {
+    rpcClose(this->transCli);
+    rpcInit_.shmSize = size;
+    this->transCli = rpcOpen(&rpcInit_);
+  }
 
   void SendAndRecv(SRpcMsg *req, SRpcMsg *resp) {
     SEpSet epSet = {0};
@@ -85,6 +96,23 @@ class Client {
     SemWait();
     *resp = this->resp;
   }
+  // send all reqs before waiting for any resp
+  void SendManyAndRecv(SRpcMsg *req, int32_t num, int32_t *failed) {
+    SEpSet epSet = {0};
+    epSet.inUse = 0;
+    addEpIntoEpSet(&epSet, "127.0.0.1", 7000);
+
+    for (int32_t i = 0; i < num; i++) {
+      SRpcMsg msg = *req;
+      msg.pCont = rpcMallocCont(req->contLen);
+      rpcSendRequest(this->transCli, &epSet, &msg, NULL);
+    }
+    *failed = 0;
+    for (int32_t i = 0; i < num; i++) {
+      SemWait();
+      if (this->resp.code != 0) (*failed)++;
+    }
+  }
   void SendAndRecvNoHandle(SRpcMsg *req, SRpcMsg *resp) {
     if (req->info.handle != NULL) {
       rpcReleaseHandle(req->info.handle, TAOS_CONN_CLIENT);
@@ -145,6 +173,11 @@ class Server {
     this->Stop();
     this->Start();
   }
+  void SetShm(int32_t size) {
+    this->Stop();
+    rpcInit_.shmSize = size;
+    this->Start();
+  }
   ~Server() {
     if (this->transSrv) rpcClose(this->transSrv);
     this->transSrv = NULL;
@@ -265,6 +298,10 @@ class TransObj {
   }
   void cliSendAndRecv(SRpcMsg *req, SRpcMsg *resp) { cli->SendAndRecv(req, resp); }
   void cliSendAndRecvNoHandle(SRpcMsg *req, SRpcMsg *resp) { cli->SendAndRecvNoHandle(req, resp); }
+  void cliSetMux(int32_t connNum, int32_t inflight) { cli->SetMux(connNum, inflight); }
+  void cliSetShm(int32_t size) { cli->SetShm(size); }
+  void srvSetShm(int32_t size) { srv->SetShm(size); }
+  void cliSendManyAndRecv(SRpcMsg *req, int32_t num, int32_t *failed) { cli->SendManyAndRecv(req, num, failed); }
 
   ~TransObj() {
     delete cli;
@@ -300,6 +337,39 @@ TEST_F(TransEnv, 01sendAndRec) {
   }
 }
 
+TEST_F(TransEnv, 01muxSendAndRecv) {
+  // 2 conns with at most 8 reqs in flight on each, the rest wait in pending queue
+  tr->cliSetMux(2, 8);
+  SRpcMsg req = {0};
+  req.msgType = 0;
+  req.contLen = 10;
+
+  int32_t failed = 0;
+  tr->cliSendManyAndRecv(&req, 100, &failed);
+  assert(failed == 0);
+}
+TEST_F(TransEnv, 01shmSendAndRecv) {
+  // client and server on the same host, msgs bigger than the ring still go through conn
+  tr->srvSetShm(1024 * 1024);
+  tr->cliSetShm(64 * 1024);
+  int32_t lens[] = {10, 1000, 60000, 200000};
+  for (int i = 0; i < 40; i++) {
+    SRpcMsg req = {0}, resp = {0};
+    req.msgType = 0;
+    req.contLen = lens[i % 4];
+    req.pCont = rpcMallocCont(req.contLen);
+    tr->cliSendAndRecv(&req, &resp);
+    assert(resp.code == 0 && resp.contLen == 100);
+  }
+  tr->cliSetMux(2, 8);
+  SRpcMsg req = {0};
+  req.msgType = 0;
+  req.contLen = 1000;
+
+  int32_t failed = 0;
+  tr->cliSendManyAndRecv(&req, 200, &failed);
+  assert(failed == 0);
+}
 TEST_F(TransEnv, 02StopServer) {
   for (int i = 0; i < 1; i++) {
     SRpcMsg req = {0}, resp = {0};
@@ -163,6 +163,14 @@ int     walInitWriteFile(SWal* pWal);
 // seek section end
 
 int64_t walGetSeq();
+
+// group commit section
+int32_t walGroupCommitInit();
+void    walGroupCommitCleanup();
+int32_t walGroupCommitFsync(SWal* pWal);
+void    walGroupCommitReport();
+// group commit section end
+
 int     walSeekWriteVer(SWal* pWal, int64_t ver);
 int32_t walRollImpl(SWal* pWal);
 
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _DEFAULT_SOURCE
+#include "os.h"
+#include "taoserror.h"
+#include "tglobal.h"
+#include "walInt.h"
+
+/*
+ * Group commit: writers of all WALs on the same disk queue their fsync requests to one flusher thread. The flusher
+ * waits for a flush window so that more requests can join, flushes the batch, and then acknowledges all waiting writers
+ * together. A batch of more than one WAL is flushed by one syncfs of the file system where supported, otherwise every
+ * distinct WAL of the batch is fsynced once.
+ */
+
+typedef struct SWalGcReq SWalGcReq;
+struct SWalGcReq {
+  SWal      *pWal;
+  int32_t    code;
+  int8_t     done;
+  SWalGcReq *pSame;  // the earlier request of the same WAL in the batch, which is flushed for both
+  SWalGcReq *next;
+};
+
+typedef struct SWalGcDisk SWalGcDisk;
+struct SWalGcDisk {
+  int64_t       devId;
+  TdThreadMutex mutex;
+  TdThreadCond  reqCond;   // a new request is queued
+  TdThreadCond  doneCond;  // a batch is flushed
+  SWalGcReq    *pHead;
+  int32_t       nPending;
+  int32_t       nRef;  // writers holding the disk, it is freed only after all of them leave
+  int8_t        stop;
+  TdThread      thread;
+  SWalGcDisk   *next;
+};
+
+typedef struct {
+  TdThreadMutex       mutex;
+  int8_t              inited;
+  SWalGcDisk         *pDisks;
+  SWalGroupCommitStat stat;
+} SWalGcMgmt;
+
+static SWalGcMgmt tsWalGc = {0};
+
+static int32_t walGcHistIdx(int64_t val) {
+  int32_t idx = 0;
+  while (val > 1 && idx < WAL_GROUP_COMMIT_HIST_SIZE - 1) {
+    val >>= 1;
+    idx++;
+  }
+  return idx;
+}
+
+static int32_t walGcFsync(SWal *pWal) {
+  int32_t code = 0;
+  int64_t startUs = taosGetTimestampUs();
+
+  taosThreadMutexLock(&pWal->mutex);
+  if (pWal->pLogFile && taosFsyncFile(pWal->pLogFile) < 0) {
+    code = TAOS_SYSTEM_ERROR(errno);
+    wError("vgId:%d, file:%" PRId64 ".log, group commit fsync failed since %s", pWal->cfg.vgId,
+           walGetCurFileFirstVer(pWal), strerror(errno));
+  }
+  taosThreadMutexUnlock(&pWal->mutex);
+
+  atomic_add_fetch_64(&tsWalGc.stat.latencyHist[walGcHistIdx(taosGetTimestampUs() - startUs)], 1);
+  return code;
+}
+
+// the WALs of a batch are on the same file system, one syncfs covers all of them
+static bool walGcSyncFs(SWalGcDisk *pDisk, SWal *pWal) {
+  int32_t ret = 0;
+  int64_t startUs = taosGetTimestampUs();
+
+  taosThreadMutexLock(&pWal->mutex);
+  ret = pWal->pLogFile ? taosSyncFsFile(pWal->pLogFile) : -1;
+  taosThreadMutexUnlock(&pWal->mutex);
+
+  if (ret < 0) {
+    wDebug("wal group commit on dev:%" PRId64 ", syncfs failed since %s, fsync each file", pDisk->devId,
+           strerror(errno));
+    return false;
+  }
+
+  atomic_add_fetch_64(&tsWalGc.stat.latencyHist[walGcHistIdx(taosGetTimestampUs() - startUs)], 1);
+  return true;
+}
+
+static void walGcFlushBatch(SWalGcDisk *pDisk, SWalGcReq *pBatch, int32_t nReq) {
+  int32_t nWal = 0;
+  int32_t nFsync = 0;
+
+  // a WAL shows up more than once if its writer queued again before the previous flush, it is flushed only for the
+  // first request
+  for (SWalGcReq *pReq = pBatch; pReq; pReq = pReq->next) {
+    pReq->pSame = NULL;
+    for (SWalGcReq *pPrev = pBatch; pPrev != pReq; pPrev = pPrev->next) {
+      if (pPrev->pSame == NULL && pPrev->pWal == pReq->pWal) {
+        pReq->pSame = pPrev;
+        break;
+      }
+    }
+    if (pReq->pSame == NULL) nWal++;
+  }
+
+  if (nWal > 1 && walGcSyncFs(pDisk, pBatch->pWal)) {
+    nFsync = 1;
+  } else {
+    for (SWalGcReq *pReq = pBatch; pReq; pReq = pReq->next) {
+      if (pReq->pSame == NULL) {
+        pReq->code = walGcFsync(pReq->pWal);
+        nFsync++;
+      }
+    }
+  }
+
+  for (SWalGcReq *pReq = pBatch; pReq; pReq = pReq->next) {
+    if (pReq->pSame) pReq->code = pReq->pSame->code;
+  }
+
+  atomic_add_fetch_64(&tsWalGc.stat.nRequest, nReq);
+  atomic_add_fetch_64(&tsWalGc.stat.nFsync, nFsync);
+  atomic_add_fetch_64(&tsWalGc.stat.depthHist[walGcHistIdx(nReq)], 1);
+
+  wTrace("wal group commit on dev:%" PRId64 ", requests:%d wals:%d fsyncs:%d", pDisk->devId, nReq, nWal, nFsync);
+}
+
+static void *walGcThreadFunc(void *param) {
+  SWalGcDisk *pDisk = (SWalGcDisk *)param;
+  setThreadName("wal-gc");
+
+  while (1) {
+    taosThreadMutexLock(&pDisk->mutex);
+    while (pDisk->pHead == NULL && !pDisk->stop) {
+      taosThreadCondWait(&pDisk->reqCond, &pDisk->mutex);
+    }
+    if (pDisk->pHead == NULL && pDisk->stop) {
+      taosThreadMutexUnlock(&pDisk->mutex);
+      break;
+    }
+    taosThreadMutexUnlock(&pDisk->mutex);
+
+    // flush window, let writers of other WALs on this disk join the batch
+    int32_t windowUs = atomic_load_32(&tsWalGroupCommitWindowUs);
+    if (windowUs > 0 && !pDisk->stop) {
+      taosUsleep(windowUs);
+    }
+
+    taosThreadMutexLock(&pDisk->mutex);
+    SWalGcReq *pBatch = pDisk->pHead;
+    int32_t    nReq = pDisk->nPending;
+    pDisk->pHead = NULL;
+    pDisk->nPending = 0;
+    taosThreadMutexUnlock(&pDisk->mutex);
+
+    walGcFlushBatch(pDisk, pBatch, nReq);
+
+    taosThreadMutexLock(&pDisk->mutex);
+    for (SWalGcReq *pReq = pBatch; pReq; pReq = pReq->next) {
+      pReq->done = 1;
+    }
+    taosThreadCondBroadcast(&pDisk->doneCond);
+    taosThreadMutexUnlock(&pDisk->mutex);
+  }
+
+  return NULL;
+}
+
+// called with pDisk->mutex locked
+static void walGcReleaseDisk(SWalGcDisk *pDisk) {
+  if (atomic_sub_fetch_32(&pDisk->nRef, 1) == 0) {
+    taosThreadCondBroadcast(&pDisk->doneCond);
+  }
+}
+
+static SWalGcDisk *walGcGetDisk(int64_t devId) {
+  SWalGcDisk *pDisk = NULL;
+
+  taosThreadMutexLock(&tsWalGc.mutex);
+
+  if (!tsWalGc.inited) goto _exit;
+
+  for (pDisk = tsWalGc.pDisks; pDisk; pDisk = pDisk->next) {
+    if (pDisk->devId == devId) {
+      atomic_add_fetch_32(&pDisk->nRef, 1);
+      goto _exit;
+    }
+  }
+
+  pDisk = taosMemoryCalloc(1, sizeof(*pDisk));
+  if (pDisk == NULL) goto _exit;
+
+  pDisk->devId = devId;
+  taosThreadMutexInit(&pDisk->mutex, NULL);
+  taosThreadCondInit(&pDisk->reqCond, NULL);
+  taosThreadCondInit(&pDisk->doneCond, NULL);
+
+  TdThreadAttr thAttr;
+  taosThreadAttrInit(&thAttr);
+  taosThreadAttrSetDetachState(&thAttr, PTHREAD_CREATE_JOINABLE);
+  if (taosThreadCreate(&pDisk->thread, &thAttr, walGcThreadFunc, pDisk) != 0) {
+    wError("failed to create wal group commit thread for dev:%" PRId64 " since %s", devId, strerror(errno));
+    taosThreadAttrDestroy(&thAttr);
+    taosThreadCondDestroy(&pDisk->doneCond);
+    taosThreadCondDestroy(&pDisk->reqCond);
+    taosThreadMutexDestroy(&pDisk->mutex);
+    taosMemoryFreeClear(pDisk);
+    goto _exit;
+  }
+  taosThreadAttrDestroy(&thAttr);
+
+  pDisk->nRef = 1;
+  pDisk->next = tsWalGc.pDisks;
+  tsWalGc.pDisks = pDisk;
+  wInfo("wal group commit thread is launched for dev:%" PRId64, devId);
+
+_exit:
+  taosThreadMutexUnlock(&tsWalGc.mutex);
+  return pDisk;
+}
+
+int32_t walGroupCommitInit() {
+  taosThreadMutexInit(&tsWalGc.mutex, NULL);
+  tsWalGc.pDisks = NULL;
+  memset(&tsWalGc.stat, 0, sizeof(tsWalGc.stat));
+  tsWalGc.inited = 1;
+  return 0;
+}
+
+void walGroupCommitCleanup() {
+  taosThreadMutexLock(&tsWalGc.mutex);
+  SWalGcDisk *pDisks = tsWalGc.pDisks;
+  tsWalGc.pDisks = NULL;
+  tsWalGc.inited = 0;
+  taosThreadMutexUnlock(&tsWalGc.mutex);
+
+  while (pDisks) {
+    SWalGcDisk *pDisk = pDisks;
+    pDisks = pDisk->next;
+
+    taosThreadMutexLock(&pDisk->mutex);
+    pDisk->stop = 1;
+    taosThreadCondSignal(&pDisk->reqCond);
+    taosThreadMutexUnlock(&pDisk->mutex);
+
+    if (taosCheckPthreadValid(pDisk->thread)) {
+      taosThreadJoin(pDisk->thread, NULL);
+      taosThreadClear(&pDisk->thread);
+    }
+
+    // the flusher acknowledged every queued request before it exited, wait until the writers leave the disk
+    taosThreadMutexLock(&pDisk->mutex);
+    while (atomic_load_32(&pDisk->nRef) > 0) {
+      taosThreadCondWait(&pDisk->doneCond, &pDisk->mutex);
+    }
+    taosThreadMutexUnlock(&pDisk->mutex);
+
+    taosThreadCondDestroy(&pDisk->doneCond);
+    taosThreadCondDestroy(&pDisk->reqCond);
+    taosThreadMutexDestroy(&pDisk->mutex);
+    taosMemoryFree(pDisk);
+  }
+
+  wInfo("wal group commit is cleaned up, requests:%" PRId64 " fsyncs:%" PRId64, tsWalGc.stat.nRequest,
+        tsWalGc.stat.nFsync);
+  taosThreadMutexDestroy(&tsWalGc.mutex);
+}
+
+int32_t walGroupCommitFsync(SWal *pWal) {
+  int64_t devId = 0;
+  int64_t ino = 0;
+
+  if (pWal->pLogFile == NULL || taosDevInoFile(pWal->pLogFile, &devId, &ino) < 0) {
+    return -1;
+  }
+
+  SWalGcDisk *pDisk = walGcGetDisk(devId);
+  if (pDisk == NULL) {
+    return -1;
+  }
+
+  SWalGcReq req = {.pWal = pWal, .code = 0, .done = 0};
+
+  taosThreadMutexLock(&pDisk->mutex);
+  if (pDisk->stop) {
+    walGcReleaseDisk(pDisk);
+    taosThreadMutexUnlock(&pDisk->mutex);
+    return -1;
+  }
+  req.next = pDisk->pHead;
+  pDisk->pHead = &req;
+  pDisk->nPending++;
+  taosThreadCondSignal(&pDisk->reqCond);
+  while (!req.done) {
+    taosThreadCondWait(&pDisk->doneCond, &pDisk->mutex);
+  }
+  walGcReleaseDisk(pDisk);
+  taosThreadMutexUnlock(&pDisk->mutex);
+
+  if (req.code) {
+    terrno = req.code;
+    return -1;
+  }
+  return 0;
+}
+
+void walGetGroupCommitStat(SWalGroupCommitStat *pStat) {
+  pStat->nRequest = atomic_load_64(&tsWalGc.stat.nRequest);
+  pStat->nFsync = atomic_load_64(&tsWalGc.stat.nFsync);
+  for (int32_t i = 0; i < WAL_GROUP_COMMIT_HIST_SIZE; i++) {
+    pStat->depthHist[i] = atomic_load_64(&tsWalGc.stat.depthHist[i]);
+    pStat->latencyHist[i] = atomic_load_64(&tsWalGc.stat.latencyHist[i]);
+  }
+}
+
+void walGroupCommitReport() {
+  SWalGroupCommitStat stat;
+  char                depth[512] = {0};
+  char                latency[512] = {0};
+  int32_t             dlen = 0;
+  int32_t             llen = 0;
+
+  walGetGroupCommitStat(&stat);
+  if (stat.nRequest == 0) return;
+
+  for (int32_t i = 0; i < WAL_GROUP_COMMIT_HIST_SIZE && dlen < sizeof(depth) && llen < sizeof(latency); i++) {
+    dlen += snprintf(depth + dlen, sizeof(depth) - dlen, "%s%" PRId64, i ? "," : "", stat.depthHist[i]);
+    llen += snprintf(latency + llen, sizeof(latency) - llen, "%s%" PRId64, i ? "," : "", stat.latencyHist[i]);
+  }
+
+  wDebug("wal group commit, requests:%" PRId64 " fsyncs:%" PRId64 " depth(log2):[%s] fsync us(log2):[%s]",
+         stat.nRequest, stat.nFsync, depth, latency);
+}
@@ -28,6 +28,8 @@ typedef struct {
   TdThread thread;
 } SWalMgmt;
 
+#define WAL_GROUP_COMMIT_REPORT_SEQ 60
+
 static SWalMgmt tsWal = {0, .seq = 1};
 static int32_t  walCreateThread();
 static void     walStopThread();
@@ -44,6 +46,7 @@ int32_t walInit() {
 
   if (old == 0) {
     tsWal.refSetId = taosOpenRef(TSDB_MIN_VNODES, walFreeObj);
+    walGroupCommitInit();
 
     int32_t code = walCreateThread();
     if (code != 0) {
@@ -68,6 +71,7 @@ void walCleanUp() {
 
   if (old == 1) {
     walStopThread();
+    walGroupCommitCleanup();
     taosCloseRef(tsWal.refSetId);
     wInfo("wal module is cleaned up");
     atomic_store_8(&tsWal.inited, 0);
@@ -282,6 +286,10 @@ static void *walThreadFunc(void *param) {
     walUpdateSeq();
     walFsyncAll();
 
+    if (atomic_load_32(&tsWal.seq) % WAL_GROUP_COMMIT_REPORT_SEQ == 0) {
+      walGroupCommitReport();
+    }
+
     if (atomic_load_8(&tsWal.stop)) break;
   }
 
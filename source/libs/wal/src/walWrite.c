@@ -488,6 +488,51 @@ static int32_t walWriteIndex(SWal *pWal, int64_t ver, int64_t offset) {
   return 0;
 }
 
+// write the idx entry, the head and the body in one linked submission, both files are opened in append mode so the
+// chain keeps the same order as the blocking path
+static int32_t walWriteBatch(SWal *pWal, int64_t index, int64_t offset, const void *body, int32_t bodyLen) {
+  SWalIdxEntry  entry = {.ver = index, .offset = offset};
+  SWalFileInfo *pFileInfo = walGetCurFileInfo(pWal);
+  int64_t       idxOffset = (index - pFileInfo->firstVer) * sizeof(SWalIdxEntry);
+
+  SFileIoReq aReq[] = {
+      {.pFile = pWal->pIdxFile, .write = true, .buf = &entry, .count = sizeof(SWalIdxEntry), .offset = idxOffset},
+      {.pFile = pWal->pLogFile, .write = true, .buf = &pWal->writeHead, .count = sizeof(SWalCkHead), .offset = offset},
+      {.pFile = pWal->pLogFile,
+       .write = true,
+       .buf = (void *)body,
+       .count = bodyLen,
+       .offset = offset + sizeof(SWalCkHead)},
+  };
+  int32_t nReq = bodyLen > 0 ? tListLen(aReq) : tListLen(aReq) - 1;
+
+  wDebug("vgId:%d, write index, index:%" PRId64 ", offset:%" PRId64 ", at %" PRId64, pWal->cfg.vgId, index, offset,
+         idxOffset);
+
+  int32_t code = taosFileIoSubmit(aReq, nReq, true);
+  for (int32_t i = 0; i < nReq; i++) {
+    if (aReq[i].ret != aReq[i].count) {
+      if (aReq[i].ret >= 0) aReq[i].err = EIO;
+      code = -1;
+      terrno = TAOS_SYSTEM_ERROR(aReq[i].err);
+      wError("vgId:%d, file:%" PRId64 ".%s, failed to write since %s", pWal->cfg.vgId, walGetLastFileFirstVer(pWal),
+             i == 0 ? "idx" : "log", strerror(aReq[i].err));
+      return code;
+    }
+  }
+
+  // check alignment of idx entries
+  int64_t endOffset = taosLSeekFile(pWal->pIdxFile, 0, SEEK_END);
+  if (endOffset < 0) {
+    wFatal("vgId:%d, failed to seek end of WAL idxfile due to %s. ver:%" PRId64 "", pWal->cfg.vgId, strerror(errno),
+           index);
+    taosMsleep(100);
+    exit(EXIT_FAILURE);
+  }
+
+  return code;
+}
+
 static FORCE_INLINE int32_t walWriteImpl(SWal *pWal, int64_t index, tmsg_t msgType, SWalSyncInfo syncMeta,
                                          const void *body, int32_t bodyLen) {
   int64_t code = 0;
@@ -508,6 +553,14 @@ static FORCE_INLINE int32_t walWriteImpl(SWal *pWal, int64_t index, tmsg_t msgTy
   wDebug("vgId:%d, wal write log %" PRId64 ", msgType: %s, cksum head %u cksum body %u", pWal->cfg.vgId, index,
          TMSG_INFO(msgType), pWal->writeHead.cksumHead, pWal->writeHead.cksumBody);
 
+  if (taosFileIoUringEnabled()) {
+    code = walWriteBatch(pWal, index, offset, body, bodyLen);
+    if (code < 0) {
+      goto END;
+    }
+    goto _set_status;
+  }
+
   code = walWriteIndex(pWal, index, offset);
   if (code < 0) {
     goto END;
@@ -529,6 +582,7 @@ static FORCE_INLINE int32_t walWriteImpl(SWal *pWal, int64_t index, tmsg_t msgTy
     goto END;
   }
 
+_set_status:
   // set status
   if (pWal->vers.firstVer == -1) {
     pWal->vers.firstVer = 0;
@@ -638,6 +692,13 @@ int32_t walWrite(SWal *pWal, int64_t index, tmsg_t msgType, const void *body, in
 }
 
 void walFsync(SWal *pWal, bool forceFsync) {
+  if (forceFsync || (pWal->cfg.level == TAOS_WAL_FSYNC && pWal->cfg.fsyncPeriod == 0)) {
+    // share the fsync with other writers on the same disk, falls back to a private fsync if it can not be queued
+    if (atomic_load_32(&tsWalGroupCommitWindowUs) > 0 && walGroupCommitFsync(pWal) == 0) {
+      return;
+    }
+  }
+
   taosThreadMutexLock(&pWal->mutex);
   if (forceFsync || (pWal->cfg.level == TAOS_WAL_FSYNC && pWal->cfg.fsyncPeriod == 0)) {
     wTrace("vgId:%d, fileId:%" PRId64 ".log, do fsync", pWal->cfg.vgId, walGetCurFileFirstVer(pWal));
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <queue>
 
+#include "tglobal.h"
 #include "walInt.h"
 
 const char* ranStr = "tvapq02tcp";
@@ -29,14 +30,17 @@ class WalCleanEnv : public ::testing::Test {
     pWal = walOpen(pathName, pCfg);
     taosMemoryFree(pCfg);
     ASSERT(pWal != NULL);
+    groupCommitWindowUs = tsWalGroupCommitWindowUs;
   }
 
   void TearDown() override {
+    tsWalGroupCommitWindowUs = groupCommitWindowUs;
     walClose(pWal);
     pWal = NULL;
   }
 
   SWal*       pWal = NULL;
+  int32_t     groupCommitWindowUs = 0;
   const char* pathName = TD_TMP_DIR_PATH "wal_test";
 };
 
@@ -234,6 +238,69 @@ TEST_F(WalCleanEnv, write) {
   ASSERT_EQ(code, 0);
 }
 
+TEST_F(WalCleanEnv, groupCommit) {
+  SWalGroupCommitStat before, after;
+  walGetGroupCommitStat(&before);
+
+  tsWalGroupCommitWindowUs = 100;
+  for (int i = 0; i < 10; i++) {
+    int code = walWrite(pWal, i, i + 1, (void*)ranStr, ranStrLen);
+    ASSERT_EQ(code, 0);
+    walFsync(pWal, false);
+  }
+  tsWalGroupCommitWindowUs = groupCommitWindowUs;
+
+  walGetGroupCommitStat(&after);
+  ASSERT_EQ(after.nRequest - before.nRequest, 10);
+  ASSERT_GE(after.nFsync - before.nFsync, 1);
+  ASSERT_LE(after.nFsync - before.nFsync, 10);
+}
+
+static void* writeAndFsync(void* param) {
+  SWal* pWal = (SWal*)param;
+  for (int i = 0; i < 20; i++) {
+    if (walWrite(pWal, i, i + 1, (void*)ranStr, ranStrLen) != 0) break;
+    walFsync(pWal, false);
+  }
+  return NULL;
+}
+
+TEST_F(WalCleanEnv, groupCommitWals) {
+  const char* pathName2 = TD_TMP_DIR_PATH "wal_test2";
+  taosRemoveDir(pathName2);
+  SWalCfg cfg = {0};
+  cfg.rollPeriod = -1;
+  cfg.segSize = -1;
+  cfg.level = TAOS_WAL_FSYNC;
+  SWal* pWal2 = walOpen(pathName2, &cfg);
+  ASSERT_NE(pWal2, nullptr);
+
+  SWalGroupCommitStat before, after;
+  walGetGroupCommitStat(&before);
+
+  // the writers of both WALs wait for each flush, so a batch holds at most one request of each
+  tsWalGroupCommitWindowUs = 2000;
+  TdThread thread;
+  ASSERT_EQ(taosThreadCreate(&thread, NULL, writeAndFsync, pWal2), 0);
+  writeAndFsync(pWal);
+  taosThreadJoin(thread, NULL);
+  tsWalGroupCommitWindowUs = groupCommitWindowUs;
+
+  walGetGroupCommitStat(&after);
+  ASSERT_EQ(pWal->vers.lastVer, 19);
+  ASSERT_EQ(pWal2->vers.lastVer, 19);
+  ASSERT_EQ(after.nRequest - before.nRequest, 40);
+#ifdef LINUX
+  // the batches of both WALs are flushed by one syncfs
+  ASSERT_LT(after.nFsync - before.nFsync, 40);
+#else
+  ASSERT_EQ(after.nFsync - before.nFsync, 40);
+#endif
+
+  walClose(pWal2);
+  taosRemoveDir(pathName2);
+}
+
 TEST_F(WalCleanEnv, rollback) {
   int code;
   for (int i = 0; i < 10; i++) {
@@ -361,6 +428,43 @@ TEST_F(WalKeepEnv, readHandleRead) {
   walCloseReader(pRead);
 }
 
+TEST_F(WalCleanEnv, writeBatch) {
+  // the idx entry, head and body go out as one submission, on io_uring if the kernel supports it
+  ASSERT_EQ(taosFileIoUringEnable(8), 0);
+
+  int code;
+  for (int i = 0; i < 100; i++) {
+    char newStr[100];
+    sprintf(newStr, "%s-%d", ranStr, i);
+    code = walWrite(pWal, i, 0, newStr, strlen(newStr));
+    ASSERT_EQ(code, 0);
+    ASSERT_EQ(pWal->vers.lastVer, i);
+  }
+  code = walWrite(pWal, 101, 0, (void*)ranStr, ranStrLen);
+  ASSERT_EQ(code, -1);
+  ASSERT_EQ(pWal->vers.lastVer, 99);
+
+  ASSERT_EQ(taosFileIoUringEnable(0), 0);
+
+  // idx entries stay aligned after the batch writes
+  int64_t idxSize = taosLSeekFile(pWal->pIdxFile, 0, SEEK_END);
+  ASSERT_EQ(idxSize, 100 * sizeof(SWalIdxEntry));
+
+  SWalReader* pRead = walOpenReader(pWal, NULL, 0);
+  ASSERT(pRead != NULL);
+  for (int i = 0; i < 100; i++) {
+    code = walReadVer(pRead, i);
+    ASSERT_EQ(code, 0);
+    ASSERT_EQ(pRead->pHead->head.version, i);
+
+    char newStr[100];
+    sprintf(newStr, "%s-%d", ranStr, i);
+    ASSERT_EQ(pRead->pHead->head.bodyLen, strlen(newStr));
+    ASSERT_EQ(memcmp(newStr, pRead->pHead->head.body, strlen(newStr)), 0);
+  }
+  walCloseReader(pRead);
+}
+
 TEST_F(WalRetentionEnv, repairMeta1) {
   walResetEnv();
   int code;
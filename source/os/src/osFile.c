@@ -34,6 +34,7 @@
 
 #if !defined(_TD_DARWIN_64)
 #include <sys/sendfile.h>
+#include <sys/syscall.h>
 #endif
 #include <sys/stat.h>
 #include <unistd.h>
@@ -1189,6 +1190,24 @@ int32_t taosFsyncFile(TdFilePtr pFile) {
   return 0;
 }
 
+// flush every file of the file system the file is on, -1 with errno ENOSYS if it is not supported by the platform
+int32_t taosSyncFsFile(TdFilePtr pFile) {
+  if (pFile == NULL) {
+    return 0;
+  }
+
+#if defined(WINDOWS) || defined(_TD_DARWIN_64) || !defined(SYS_syncfs)
+  errno = ENOSYS;
+  return -1;
+#else
+  if (pFile->fd < 0) {
+    errno = EBADF;
+    return -1;
+  }
+  return (int32_t)syscall(SYS_syncfs, pFile->fd);
+#endif
+}
+
 void taosFprintfFile(TdFilePtr pFile, const char *format, ...) {
   if (pFile == NULL || pFile->fp == NULL) {
     return;
@@ -1386,3 +1405,340 @@ int32_t taosSetFileHandlesLimit() {
 #endif
   return 0;
 }
+
+#if defined(LINUX) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define USE_IO_URING
+#endif
+#endif
+
+#ifdef USE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+typedef struct {
+  int32_t              fd;
+  uint32_t             sqEntries;
+  uint32_t            *sqHead;
+  uint32_t            *sqTail;
+  uint32_t            *sqMask;
+  uint32_t            *sqArray;
+  uint32_t            *cqHead;
+  uint32_t            *cqTail;
+  uint32_t            *cqMask;
+  struct io_uring_sqe *sqes;
+  struct io_uring_cqe *cqes;
+  void                *sqPtr;
+  size_t               sqSize;
+  void                *cqPtr;
+  size_t               cqSize;
+  size_t               sqesSize;
+} SFileUring;
+
+static int32_t                tsFileUringDepth = 0;
+static threadlocal SFileUring *tsFileUring = NULL;
+static threadlocal int8_t      tsFileUringFailed = 0;
+static TdThreadKey             tsFileUringKey;
+static TdThreadOnce            tsFileUringKeyInit = PTHREAD_ONCE_INIT;
+
+static void taosFileUringDestroy(SFileUring *pRing) {
+  if (pRing->sqes) munmap(pRing->sqes, pRing->sqesSize);
+  if (pRing->cqPtr && pRing->cqPtr != pRing->sqPtr) munmap(pRing->cqPtr, pRing->cqSize);
+  if (pRing->sqPtr) munmap(pRing->sqPtr, pRing->sqSize);
+  if (pRing->fd >= 0) close(pRing->fd);
+  taosMemoryFree(pRing);
+}
+
+// called at thread exit with the ring of the thread
+static void taosFileUringRelease(void *param) {
+  taosFileUringDestroy((SFileUring *)param);
+  tsFileUring = NULL;
+}
+
+static void taosFileUringKeyCreate() { (void)taosThreadKeyCreate(&tsFileUringKey, taosFileUringRelease); }
+
+// the ring can not be trusted once a completion is lost, stay on the blocking path in this thread
+static void taosFileUringBroken() {
+  if (tsFileUring == NULL) return;
+  (void)taosThreadSetSpecific(tsFileUringKey, NULL);
+  taosFileUringDestroy(tsFileUring);
+  tsFileUring = NULL;
+  tsFileUringFailed = 1;
+}
+
+// each thread owns its ring, so submission and completion need no lock
+static SFileUring *taosFileUringGet() {
+  if (tsFileUring || tsFileUringFailed) return tsFileUring;
+
+  struct io_uring_params params = {0};
+  SFileUring            *pRing = NULL;
+  if (taosThreadOnce(&tsFileUringKeyInit, taosFileUringKeyCreate) != 0) goto _err;
+
+  pRing = taosMemoryCalloc(1, sizeof(SFileUring));
+  if (pRing == NULL) goto _err;
+
+  pRing->fd = (int32_t)syscall(__NR_io_uring_setup, tsFileUringDepth, &params);
+  if (pRing->fd < 0) goto _err;
+
+  pRing->sqSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  pRing->cqSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    pRing->sqSize = TMAX(pRing->sqSize, pRing->cqSize);
+    pRing->cqSize = pRing->sqSize;
+  }
+
+  pRing->sqPtr =
+      mmap(NULL, pRing->sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, pRing->fd, IORING_OFF_SQ_RING);
+  if (pRing->sqPtr == MAP_FAILED) {
+    pRing->sqPtr = NULL;
+    goto _err;
+  }
+
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    pRing->cqPtr = pRing->sqPtr;
+  } else {
+    pRing->cqPtr =
+        mmap(NULL, pRing->cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, pRing->fd, IORING_OFF_CQ_RING);
+    if (pRing->cqPtr == MAP_FAILED) {
+      pRing->cqPtr = NULL;
+      goto _err;
+    }
+  }
+
+  pRing->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+  pRing->sqes =
+      mmap(NULL, pRing->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, pRing->fd, IORING_OFF_SQES);
+  if (pRing->sqes == MAP_FAILED) {
+    pRing->sqes = NULL;
+    goto _err;
+  }
+
+  pRing->sqEntries = params.sq_entries;
+  pRing->sqHead = (uint32_t *)((char *)pRing->sqPtr + params.sq_off.head);
+  pRing->sqTail = (uint32_t *)((char *)pRing->sqPtr + params.sq_off.tail);
+  pRing->sqMask = (uint32_t *)((char *)pRing->sqPtr + params.sq_off.ring_mask);
+  pRing->sqArray = (uint32_t *)((char *)pRing->sqPtr + params.sq_off.array);
+  pRing->cqHead = (uint32_t *)((char *)pRing->cqPtr + params.cq_off.head);
+  pRing->cqTail = (uint32_t *)((char *)pRing->cqPtr + params.cq_off.tail);
+  pRing->cqMask = (uint32_t *)((char *)pRing->cqPtr + params.cq_off.ring_mask);
+  pRing->cqes = (struct io_uring_cqe *)((char *)pRing->cqPtr + params.cq_off.cqes);
+
+  if (taosThreadSetSpecific(tsFileUringKey, pRing) != 0) goto _err;
+
+  tsFileUring = pRing;
+  return tsFileUring;
+
+_err:
+  // not supported by the kernel or not permitted, stay on the blocking path in this thread
+  if (pRing) taosFileUringDestroy(pRing);
+  tsFileUringFailed = 1;
+  return NULL;
+}
+
+/*
+ * Submit the requests and wait for all of them. Once a request is taken by the kernel, its buffer and iovec are in use
+ * until its completion is reaped, so every submitted request is reaped before returning, even on error. Requests the
+ * kernel did not take are removed from the submission queue and left canceled.
+ */
+static int32_t taosFileUringSubmit(SFileUring *pRing, SFileIoReq *aReq, struct iovec *aIov, int32_t nReq,
+                                   bool ordered) {
+  int32_t  code = 0;
+  uint32_t tail = *pRing->sqTail;
+  uint32_t mask = *pRing->sqMask;
+
+  for (int32_t i = 0; i < nReq; i++) {
+    uint32_t             idx = tail & mask;
+    struct io_uring_sqe *pSqe = &pRing->sqes[idx];
+
+    aIov[i].iov_base = aReq[i].buf;
+    aIov[i].iov_len = aReq[i].count;
+
+    memset(pSqe, 0, sizeof(*pSqe));
+    pSqe->opcode = aReq[i].write ? IORING_OP_WRITEV : IORING_OP_READV;
+    pSqe->fd = aReq[i].pFile->fd;
+    pSqe->addr = (uint64_t)(uintptr_t)&aIov[i];
+    pSqe->len = 1;
+    pSqe->off = aReq[i].offset;
+    pSqe->user_data = i;
+    if (ordered && i < nReq - 1) pSqe->flags |= IOSQE_IO_LINK;
+
+    pRing->sqArray[idx] = idx;
+    tail++;
+  }
+  __atomic_store_n(pRing->sqTail, tail, __ATOMIC_RELEASE);
+
+  int32_t nSubmit = 0;
+  while (nSubmit < nReq) {
+    int32_t ret = (int32_t)syscall(__NR_io_uring_enter, pRing->fd, nReq - nSubmit, 0, 0, NULL, 0);
+    if (ret < 0) {
+      if (errno == EINTR || errno == EAGAIN || errno == EBUSY) continue;
+
+      // without sq polling the kernel only consumes entries in io_uring_enter, so the rest can be taken back and
+      // stay canceled
+      __atomic_store_n(pRing->sqTail, tail - (nReq - nSubmit), __ATOMIC_RELEASE);
+      code = -1;
+      break;
+    }
+    nSubmit += ret;
+  }
+
+  // reap
+  for (int32_t nDone = 0; nDone < nSubmit;) {
+    uint32_t head = *pRing->cqHead;
+    if (head == __atomic_load_n(pRing->cqTail, __ATOMIC_ACQUIRE)) {
+      int32_t ret = (int32_t)syscall(__NR_io_uring_enter, pRing->fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+      if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+        int32_t err = errno;
+        for (int32_t i = 0; i < nSubmit; i++) {
+          if (aReq[i].ret < 0 && aReq[i].err == ECANCELED) aReq[i].err = err;
+        }
+        taosFileUringBroken();
+        return -1;
+      }
+      continue;
+    }
+
+    struct io_uring_cqe *pCqe = &pRing->cqes[head & *pRing->cqMask];
+    SFileIoReq          *pReq = &aReq[pCqe->user_data];
+    if (pCqe->res < 0) {
+      pReq->ret = -1;
+      pReq->err = -pCqe->res;
+    } else {
+      pReq->ret = pCqe->res;
+    }
+    __atomic_store_n(pRing->cqHead, head + 1, __ATOMIC_RELEASE);
+    nDone++;
+  }
+
+  return code;
+}
+
+// a file may show up in several requests of one chunk, but its lock is only taken once
+static bool taosFileIoLockedBefore(SFileIoReq *aReq, int32_t start, int32_t idx) {
+  for (int32_t i = start; i < idx; i++) {
+    if (aReq[i].pFile == aReq[idx].pFile) return true;
+  }
+  return false;
+}
+
+static bool taosFileIoHasWrite(SFileIoReq *aReq, int32_t idx, int32_t end) {
+  for (int32_t i = idx; i < end; i++) {
+    if (aReq[i].pFile == aReq[idx].pFile && aReq[i].write) return true;
+  }
+  return false;
+}
+#endif
+
+int32_t taosFileIoUringEnable(int32_t queueDepth) {
+#ifdef USE_IO_URING
+  tsFileUringDepth = queueDepth;
+  return 0;
+#else
+  return queueDepth > 0 ? -1 : 0;
+#endif
+}
+
+bool taosFileIoUringEnabled() {
+#ifdef USE_IO_URING
+  return tsFileUringDepth > 0;
+#else
+  return false;
+#endif
+}
+
+/*
+ * Finish a request of which ret bytes are transferred on the blocking path, a read or write may transfer less than
+ * requested. A read stops early only at the end of file.
+ */
+static int32_t taosFileIoComplete(SFileIoReq *pReq) {
+  int64_t done = TMAX(pReq->ret, 0);
+
+  while (done < pReq->count) {
+    int64_t n = 0;
+    if (pReq->write) {
+      n = taosPWriteFile(pReq->pFile, (char *)pReq->buf + done, pReq->count - done, pReq->offset + done);
+    } else {
+      n = taosPReadFile(pReq->pFile, (char *)pReq->buf + done, pReq->count - done, pReq->offset + done);
+    }
+
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      pReq->ret = -1;
+      pReq->err = errno;
+      return -1;
+    }
+    if (n == 0) break;
+    done += n;
+  }
+
+  pReq->ret = done;
+  return 0;
+}
+
+int32_t taosFileIoSubmit(SFileIoReq *aReq, int32_t nReq, bool ordered) {
+  int32_t code = 0;
+
+  for (int32_t i = 0; i < nReq; i++) {
+    aReq[i].ret = -1;
+    aReq[i].err = ECANCELED;
+  }
+
+#ifdef USE_IO_URING
+  SFileUring  *pRing = (tsFileUringDepth > 0) ? taosFileUringGet() : NULL;
+  struct iovec aIov[64];
+  int32_t      nChunk = pRing ? TMIN(tListLen(aIov), pRing->sqEntries) : 0;
+
+  // a linked chain must go in one submission to keep its order
+  if (pRing && (!ordered || nReq <= nChunk)) {
+    for (int32_t i = 0; i < nReq; i += nChunk) {
+      int32_t n = TMIN(nReq - i, nChunk);
+
+#if FILE_WITH_LOCK
+      for (int32_t j = i; j < i + n; j++) {
+        if (taosFileIoLockedBefore(aReq, i, j)) continue;
+        if (taosFileIoHasWrite(aReq, j, i + n)) {
+          taosThreadRwlockWrlock(&aReq[j].pFile->rwlock);
+        } else {
+          taosThreadRwlockRdlock(&aReq[j].pFile->rwlock);
+        }
+      }
+#endif
+      code = taosFileUringSubmit(pRing, aReq + i, aIov, n, ordered);
+#if FILE_WITH_LOCK
+      for (int32_t j = i; j < i + n; j++) {
+        if (taosFileIoLockedBefore(aReq, i, j)) continue;
+        taosThreadRwlockUnlock(&aReq[j].pFile->rwlock);
+      }
+#endif
+      if (code) break;
+    }
+  }
+#endif
+
+  /*
+   * Requests the ring did not execute are still canceled, and the transfers which are short are not finished, both
+   * are done on the blocking path. A short transfer breaks a linked chain and cancels the rest of it, so in order the
+   * requests are run up to the first one which fails.
+   */
+  code = 0;
+  for (int32_t i = 0; i < nReq; i++) {
+    SFileIoReq *pReq = &aReq[i];
+
+    if (pReq->ret < 0 && pReq->err == ECANCELED) {
+      pReq->ret = 0;
+    }
+    if (pReq->ret >= 0 && pReq->ret < pReq->count) {
+      (void)taosFileIoComplete(pReq);
+    }
+
+    if (pReq->ret < 0) {
+      errno = pReq->err;
+      code = -1;
+      if (ordered) break;
+    }
+  }
+
+  return code;
+}
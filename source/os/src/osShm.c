@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define ALLOW_FORBID_FUNC
+#include "os.h"
+
+int32_t taosCreateShm(SShm *pShm, int32_t size) {
+  pShm->id = -1;
+  pShm->ptr = NULL;
+#if defined(WINDOWS)
+  return -1;
+#else
+  int32_t id = shmget(IPC_PRIVATE, size, IPC_CREAT | IPC_EXCL | 0600);
+  if (id < 0) {
+    return -1;
+  }
+  void *ptr = shmat(id, NULL, 0);
+  if (ptr == (void *)-1) {
+    shmctl(id, IPC_RMID, NULL);
+    return -1;
+  }
+#if defined(LINUX)
+  // linux still allows others to attach a removed segment, so it never outlives its users
+  shmctl(id, IPC_RMID, NULL);
+#endif
+  pShm->id = id;
+  pShm->size = size;
+  pShm->ptr = ptr;
+  return 0;
+#endif
+}
+
+int32_t taosAttachShm(SShm *pShm) {
+  pShm->ptr = NULL;
+#if defined(WINDOWS)
+  return -1;
+#else
+  struct shmid_ds ds;
+  if (shmctl(pShm->id, IPC_STAT, &ds) != 0 || ds.shm_segsz != (size_t)pShm->size) {
+    return -1;
+  }
+  void *ptr = shmat(pShm->id, NULL, 0);
+  if (ptr == (void *)-1) {
+    return -1;
+  }
+  pShm->ptr = ptr;
+  return 0;
+#endif
+}
+
+void taosDetachShm(SShm *pShm) {
+#if !defined(WINDOWS)
+  if (pShm->ptr != NULL) {
+    shmdt(pShm->ptr);
+  }
+#endif
+  pShm->ptr = NULL;
+}
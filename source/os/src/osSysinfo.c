@@ -562,6 +562,105 @@ int32_t taosGetCpuCores(float *numOfCores, bool physical) {
 #endif
 }
 
+#if !defined(WINDOWS) && !defined(_TD_DARWIN_64)
+// the memory policy constants of <numaif.h>, which comes with libnuma
+#define TD_MPOL_PREFERRED 1
+#define TD_MPOL_MF_MOVE   (1 << 1)
+#define TD_NUMA_MAX_NODES 64
+
+// parses a list like "0-3,8-11" of /sys, calls fp on every number of it
+static int32_t taosParseSysList(const char *fname, void (*fp)(int32_t, void *), void *param) {
+  TdFilePtr pFile = taosOpenFile(fname, TD_FILE_READ | TD_FILE_STREAM);
+  if (pFile == NULL) return -1;
+
+  char    line[1024] = {0};
+  int64_t bytes = taosGetsFile(pFile, sizeof(line), line);
+  taosCloseFile(&pFile);
+  if (bytes <= 0) return -1;
+
+  char *pos = line;
+  while (*pos >= '0' && *pos <= '9') {
+    int32_t first = taosStr2Int32(pos, &pos, 10);
+    int32_t last = first;
+    if (*pos == '-') last = taosStr2Int32(pos + 1, &pos, 10);
+    for (int32_t i = first; i <= last; ++i) (*fp)(i, param);
+    if (*pos == ',') pos++;
+  }
+
+  return 0;
+}
+
+static void taosNumaCountNode(int32_t node, void *param) { *(int32_t *)param = TMAX(*(int32_t *)param, node + 1); }
+
+static void taosNumaSetCpu(int32_t cpu, void *param) {
+  if (cpu < CPU_SETSIZE) CPU_SET(cpu, (cpu_set_t *)param);
+}
+#endif
+
+int32_t taosGetNumOfNumaNodes() {
+#if defined(WINDOWS) || defined(_TD_DARWIN_64)
+  return 1;
+#else
+  static int32_t numOfNodes = 0;
+  if (numOfNodes > 0) return numOfNodes;
+
+  int32_t num = 0;
+  if (taosParseSysList("/sys/devices/system/node/online", taosNumaCountNode, &num) != 0 || num <= 0) num = 1;
+  numOfNodes = TMIN(num, TD_NUMA_MAX_NODES);
+  return numOfNodes;
+#endif
+}
+
+// runs the calling thread on the cpus of the node, and prefers the memory of the node for its allocations
+int32_t taosSetThreadNumaNode(int32_t node) {
+#if defined(WINDOWS) || defined(_TD_DARWIN_64)
+  return 0;
+#else
+  if (node < 0 || node >= taosGetNumOfNumaNodes()) return -1;
+
+  char      fname[64] = {0};
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  snprintf(fname, sizeof(fname), "/sys/devices/system/node/node%d/cpulist", node);
+  if (taosParseSysList(fname, taosNumaSetCpu, &cpus) != 0 || CPU_COUNT(&cpus) == 0) return -1;
+
+  if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+    terrno = TAOS_SYSTEM_ERROR(errno);
+    return -1;
+  }
+
+  uint64_t mask = 1ULL << node;
+  if (syscall(SYS_set_mempolicy, TD_MPOL_PREFERRED, &mask, TD_NUMA_MAX_NODES + 1) != 0) {
+    terrno = TAOS_SYSTEM_ERROR(errno);
+    return -1;
+  }
+
+  return 0;
+#endif
+}
+
+// moves the whole pages of the range to the node, the pages not touched yet are allocated from it later
+int32_t taosBindMemoryNumaNode(void *ptr, int64_t size, int32_t node) {
+#if defined(WINDOWS) || defined(_TD_DARWIN_64)
+  return 0;
+#else
+  if (ptr == NULL || node < 0 || node >= taosGetNumOfNumaNodes()) return -1;
+
+  int64_t  pageSize = sysconf(_SC_PAGESIZE);
+  uint64_t start = ((uint64_t)ptr + pageSize - 1) / pageSize * pageSize;
+  uint64_t end = ((uint64_t)ptr + size) / pageSize * pageSize;
+  if (end <= start) return 0;
+
+  uint64_t mask = 1ULL << node;
+  if (syscall(SYS_mbind, start, end - start, TD_MPOL_PREFERRED, &mask, TD_NUMA_MAX_NODES + 1, TD_MPOL_MF_MOVE) != 0) {
+    terrno = TAOS_SYSTEM_ERROR(errno);
+    return -1;
+  }
+
+  return 0;
+#endif
+}
+
 void taosGetCpuUsage(double *cpu_system, double *cpu_engine) {
   static int64_t lastSysUsed = 0;
   static int64_t lastSysTotal = 0;
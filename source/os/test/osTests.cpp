@@ -168,6 +168,80 @@ TEST(osTest, osFile) {
   //printf("remove file success");
 }
 
+static void fileIoSubmitRun(const char *fname) {
+  TdFilePtr pFile = taosOpenFile(fname, TD_FILE_CREATE | TD_FILE_WRITE | TD_FILE_READ | TD_FILE_TRUNC);
+  ASSERT_NE(pFile, nullptr);
+
+  // more requests than one submission of the ring takes
+  const int32_t nReq = 100;
+  const int32_t szReq = 512;
+  char         *wbuf = (char *)taosMemoryMalloc(nReq * szReq);
+  char         *rbuf = (char *)taosMemoryCalloc(1, nReq * szReq + szReq);
+  ASSERT_NE(wbuf, nullptr);
+  ASSERT_NE(rbuf, nullptr);
+  for (int32_t i = 0; i < nReq * szReq; i++) {
+    wbuf[i] = (char)(i * 31 + 7);
+  }
+
+  SFileIoReq aReq[nReq + 1];
+  for (int32_t i = 0; i < nReq; i++) {
+    aReq[i] = (SFileIoReq){.pFile = pFile, .write = true, .buf = wbuf + i * szReq, .count = szReq, .offset = i * szReq};
+  }
+  ASSERT_EQ(taosFileIoSubmit(aReq, 3, true), 0);
+  ASSERT_EQ(taosFileIoSubmit(aReq + 3, nReq - 3, false), 0);
+  for (int32_t i = 0; i < nReq; i++) {
+    ASSERT_EQ(aReq[i].ret, szReq);
+  }
+
+  // the last read crosses the end of file and is short, which is not an error
+  for (int32_t i = 0; i < nReq; i++) {
+    aReq[i] = (SFileIoReq){.pFile = pFile, .write = false, .buf = rbuf + i * szReq, .count = szReq, .offset = i * szReq};
+  }
+  aReq[nReq - 1].count = 2 * szReq;
+  aReq[nReq] = (SFileIoReq){.pFile = pFile, .write = false, .buf = rbuf, .count = szReq, .offset = 2 * nReq * szReq};
+  ASSERT_EQ(taosFileIoSubmit(aReq, nReq + 1, false), 0);
+  for (int32_t i = 0; i < nReq - 1; i++) {
+    ASSERT_EQ(aReq[i].ret, szReq);
+  }
+  ASSERT_EQ(aReq[nReq - 1].ret, szReq);
+  ASSERT_EQ(aReq[nReq].ret, 0);
+  ASSERT_EQ(memcmp(wbuf, rbuf, nReq * szReq), 0);
+
+  taosMemoryFree(wbuf);
+  taosMemoryFree(rbuf);
+  taosCloseFile(&pFile);
+  taosRemoveFile(fname);
+}
+
+static void *fileIoSubmitThread(void *param) {
+  fileIoSubmitRun((const char *)param);
+  return NULL;
+}
+
+TEST(osTest, osFileIoSubmit) {
+  char *fname = "./osfiletest2.txt";
+
+  ASSERT_EQ(taosFileIoUringEnable(0), 0);
+  fileIoSubmitRun(fname);
+
+  // falls back to the blocking path if io_uring is not supported
+  if (taosFileIoUringEnable(8) == 0) {
+    fileIoSubmitRun(fname);
+
+    // the ring of a thread is released when the thread exits
+    for (int32_t i = 0; i < 4; i++) {
+      TdThread thread;
+      TdThreadAttr thattr;
+      taosThreadAttrInit(&thattr);
+      taosThreadCreate(&thread, &thattr, fileIoSubmitThread, (void *)fname);
+      taosThreadAttrDestroy(&thattr);
+      taosThreadJoin(thread, NULL);
+      taosThreadClear(&thread);
+    }
+    ASSERT_EQ(taosFileIoUringEnable(0), 0);
+  }
+}
+
 #ifndef OSFILE_PERFORMANCE_TEST
 
 #define MAX_WORDS          100
@@ -15,6 +15,7 @@
 
 #define _DEFAULT_SOURCE
 #include "tmempool.h"
+#include "taoserror.h"
 #include "tlog.h"
 #include "tutil.h"
 
@@ -125,3 +126,297 @@ void taosMemPoolCleanUp(mpool_h handle) {
   memset(pool_p, 0, sizeof(*pool_p));
   taosMemoryFree(pool_p);
 }
+
+#define MEM_CLASS_MIN_BITS 8   // 256B
+#define MEM_CLASS_MAX_BITS 24  // 16MB
+#define MEM_CLASS_NUM      (MEM_CLASS_MAX_BITS - MEM_CLASS_MIN_BITS + 1)
+
+typedef struct mcpool_t mcpool_t;
+
+// kept right before the payload, so a buffer is always given back to the pool it comes from
+typedef struct {
+  mcpool_t *pool;
+  int64_t   size;  // usable bytes of the payload
+} mcbuf_hdr_t;
+
+#define MEM_CLASS_HDR_SIZE MEM_CLASS_POOL_ALIGN
+
+struct mcpool_t {
+  TdThreadMutex mutex;
+  void         *pFree[MEM_CLASS_NUM];  // the first bytes of a cached payload keep the next one
+  int32_t       numOfFree[MEM_CLASS_NUM];
+  int64_t       cacheSize;
+  int64_t       maxCacheSize;
+  int64_t       used;  // bytes handed out and not returned yet
+  int64_t       peak;
+  int64_t       numOfReuse;
+  int64_t       numOfAlloc;
+  int64_t       numOfBuf;  // buffers handed out and not returned yet
+  bool          closed;    // cleaned up by the owner, freed when the last buffer comes back
+
+  __mem_reserve_fn_t reserveFp;
+  __mem_release_fn_t releaseFp;
+  void              *param;
+};
+
+static threadlocal mcpool_h tsCurMemClassPool = NULL;
+
+static FORCE_INLINE mcbuf_hdr_t *memClassBufHdr(void *p) { return (mcbuf_hdr_t *)((char *)p - MEM_CLASS_HDR_SIZE); }
+
+static FORCE_INLINE int32_t memClassOfAlloc(int64_t size) {
+  int32_t bits = MEM_CLASS_MIN_BITS;
+  while (bits <= MEM_CLASS_MAX_BITS && (1LL << bits) < size) {
+    bits++;
+  }
+  return bits - MEM_CLASS_MIN_BITS;
+}
+
+static void *memClassBufMalloc(mcpool_t *pool_p, int64_t size) {
+  char *base = taosMemoryMallocAlign(MEM_CLASS_POOL_ALIGN, MEM_CLASS_HDR_SIZE + size);
+  if (base == NULL) {
+    return NULL;
+  }
+
+  mcbuf_hdr_t *pHdr = (mcbuf_hdr_t *)base;
+  pHdr->pool = pool_p;
+  pHdr->size = size;
+  return base + MEM_CLASS_HDR_SIZE;
+}
+
+static FORCE_INLINE void memClassBufFree(void *p) { taosMemoryFree(memClassBufHdr(p)); }
+
+mcpool_h taosMemClassPoolInit(int64_t maxCacheSize) {
+  mcpool_t *pool_p = (mcpool_t *)taosMemoryCalloc(1, sizeof(mcpool_t));
+  if (pool_p == NULL) {
+    uError("mem class pool malloc failed");
+    return NULL;
+  }
+
+  taosThreadMutexInit(&pool_p->mutex, NULL);
+  pool_p->maxCacheSize = maxCacheSize;
+  return (mcpool_h)pool_p;
+}
+
+static FORCE_INLINE void memClassPoolCharge(mcpool_t *pool_p, int64_t size) {
+  pool_p->used += size;
+  if (pool_p->used > pool_p->peak) {
+    atomic_store_64(&pool_p->peak, pool_p->used);
+  }
+}
+
+// called with pool_p->mutex locked, the owner never gets back more than it is charged
+static int64_t memClassPoolUncharge(mcpool_t *pool_p, int64_t size) {
+  if (size > pool_p->used) {
+    size = TMAX(pool_p->used, 0);
+  }
+  pool_p->used -= size;
+  return size;
+}
+
+static void memClassPoolDestroy(mcpool_t *pool_p) {
+  taosThreadMutexDestroy(&pool_p->mutex);
+  taosMemoryFree(pool_p);
+}
+
+// called with pool_p->mutex locked, false if the buffer is not cached and should be released
+static bool memClassPoolPut(mcpool_t *pool_p, void *p, int64_t size) {
+  int32_t cls = memClassOfAlloc(size);
+  if (pool_p->closed || cls >= MEM_CLASS_NUM || (1LL << (cls + MEM_CLASS_MIN_BITS)) != size ||
+      pool_p->cacheSize + size > pool_p->maxCacheSize) {
+    return false;
+  }
+
+  *(void **)p = pool_p->pFree[cls];
+  pool_p->pFree[cls] = p;
+  pool_p->numOfFree[cls] += 1;
+  pool_p->cacheSize += size;
+  return true;
+}
+
+void *taosMemClassPoolMalloc(mcpool_h handle, int64_t size) {
+  mcpool_t *pool_p = (mcpool_t *)handle;
+  void     *p = NULL;
+
+  if (pool_p == NULL) {
+    p = memClassBufMalloc(NULL, size);
+    if (p == NULL) {
+      terrno = TSDB_CODE_OUT_OF_MEMORY;
+    }
+    return p;
+  }
+
+  int32_t cls = memClassOfAlloc(size);
+  int64_t usable = (cls < MEM_CLASS_NUM) ? (1LL << (cls + MEM_CLASS_MIN_BITS)) : size;
+
+  taosThreadMutexLock(&pool_p->mutex);
+  bool cached = (cls < MEM_CLASS_NUM && pool_p->pFree[cls] != NULL);
+  if (cached) {
+    p = pool_p->pFree[cls];
+    pool_p->pFree[cls] = *(void **)p;
+    pool_p->numOfFree[cls] -= 1;
+    pool_p->cacheSize -= usable;
+  }
+  taosThreadMutexUnlock(&pool_p->mutex);
+
+  if (p == NULL) {
+    p = memClassBufMalloc(pool_p, usable);
+    if (p == NULL) {
+      terrno = TSDB_CODE_OUT_OF_MEMORY;
+      return NULL;
+    }
+  }
+
+  if (pool_p->reserveFp != NULL && !pool_p->reserveFp(pool_p->param, usable, false)) {
+    taosThreadMutexLock(&pool_p->mutex);
+    bool cached = memClassPoolPut(pool_p, p, usable);
+    taosThreadMutexUnlock(&pool_p->mutex);
+    if (!cached) {
+      memClassBufFree(p);
+    }
+    terrno = TSDB_CODE_QRY_NOT_ENOUGH_BUFFER;
+    return NULL;
+  }
+
+  taosThreadMutexLock(&pool_p->mutex);
+  pool_p->numOfAlloc += 1;
+  pool_p->numOfReuse += cached ? 1 : 0;
+  pool_p->numOfBuf += 1;
+  memClassPoolCharge(pool_p, usable);
+  taosThreadMutexUnlock(&pool_p->mutex);
+  return p;
+}
+
+void taosMemClassPoolFree(void *p) {
+  if (p == NULL) {
+    return;
+  }
+
+  mcpool_t *pool_p = memClassBufHdr(p)->pool;
+  if (pool_p == NULL) {
+    memClassBufFree(p);
+    return;
+  }
+
+  int64_t size = memClassBufHdr(p)->size;
+
+  // the buffer may be freed by a thread other than the owner, e.g., by the one consuming the result block
+  taosThreadMutexLock(&pool_p->mutex);
+  int64_t released = memClassPoolUncharge(pool_p, size);
+  if (pool_p->releaseFp != NULL && released > 0) {
+    pool_p->releaseFp(pool_p->param, released);
+  }
+  pool_p->numOfBuf -= 1;
+  bool cached = memClassPoolPut(pool_p, p, size);
+  bool destroy = (pool_p->closed && pool_p->numOfBuf == 0);
+  taosThreadMutexUnlock(&pool_p->mutex);
+
+  if (!cached) {
+    memClassBufFree(p);
+  }
+  if (destroy) {
+    memClassPoolDestroy(pool_p);
+  }
+}
+
+void taosMemClassPoolCleanUp(mcpool_h handle) {
+  mcpool_t *pool_p = (mcpool_t *)handle;
+  if (pool_p == NULL) {
+    return;
+  }
+
+  taosThreadMutexLock(&pool_p->mutex);
+  for (int32_t i = 0; i < MEM_CLASS_NUM; ++i) {
+    void *p = pool_p->pFree[i];
+    while (p != NULL) {
+      void *next = *(void **)p;
+      memClassBufFree(p);
+      p = next;
+    }
+    pool_p->pFree[i] = NULL;
+    pool_p->numOfFree[i] = 0;
+  }
+  pool_p->cacheSize = 0;
+
+  uDebug("mem class pool cleaned up, peak:%" PRId64 ", alloc:%" PRId64 ", reuse:%" PRId64 ", in use:%" PRId64,
+         pool_p->peak, pool_p->numOfAlloc, pool_p->numOfReuse, pool_p->numOfBuf);
+
+  // the memory not returned to the pool is given back to the owner at last, the buffers still in use are released
+  // later without the owner
+  if (pool_p->releaseFp != NULL && pool_p->used > 0) {
+    pool_p->releaseFp(pool_p->param, pool_p->used);
+  }
+  pool_p->used = 0;
+  pool_p->reserveFp = NULL;
+  pool_p->releaseFp = NULL;
+  pool_p->param = NULL;
+  pool_p->closed = true;
+
+  bool destroy = (pool_p->numOfBuf == 0);
+  taosThreadMutexUnlock(&pool_p->mutex);
+
+  if (tsCurMemClassPool == handle) {
+    tsCurMemClassPool = NULL;
+  }
+  if (destroy) {
+    memClassPoolDestroy(pool_p);
+  }
+}
+
+int64_t taosMemClassPoolUsed(mcpool_h handle) {
+  return (handle == NULL) ? 0 : atomic_load_64(&((mcpool_t *)handle)->used);
+}
+
+int64_t taosMemClassPoolPeak(mcpool_h handle) {
+  return (handle == NULL) ? 0 : atomic_load_64(&((mcpool_t *)handle)->peak);
+}
+
+void taosMemClassPoolSetCtrl(mcpool_h handle, __mem_reserve_fn_t reserveFp, __mem_release_fn_t releaseFp, void *param) {
+  mcpool_t *pool_p = (mcpool_t *)handle;
+  if (pool_p == NULL) {
+    return;
+  }
+
+  taosThreadMutexLock(&pool_p->mutex);
+  pool_p->reserveFp = reserveFp;
+  pool_p->releaseFp = releaseFp;
+  pool_p->param = param;
+  taosThreadMutexUnlock(&pool_p->mutex);
+}
+
+bool taosMemClassPoolReserve(mcpool_h handle, int64_t size, bool spillable) {
+  mcpool_t *pool_p = (mcpool_t *)handle;
+  if (pool_p == NULL) {
+    return true;
+  }
+
+  if (pool_p->reserveFp != NULL && !pool_p->reserveFp(pool_p->param, size, spillable)) {
+    return false;
+  }
+
+  taosThreadMutexLock(&pool_p->mutex);
+  memClassPoolCharge(pool_p, size);
+  taosThreadMutexUnlock(&pool_p->mutex);
+  return true;
+}
+
+void taosMemClassPoolRelease(mcpool_h handle, int64_t size) {
+  mcpool_t *pool_p = (mcpool_t *)handle;
+  if (pool_p == NULL) {
+    return;
+  }
+
+  taosThreadMutexLock(&pool_p->mutex);
+  size = memClassPoolUncharge(pool_p, size);
+  if (pool_p->releaseFp != NULL && size > 0) {
+    pool_p->releaseFp(pool_p->param, size);
+  }
+  taosThreadMutexUnlock(&pool_p->mutex);
+}
+
+mcpool_h taosMemClassPoolSwitch(mcpool_h handle) {
+  mcpool_h prev = tsCurMemClassPool;
+  tsCurMemClassPool = handle;
+  return prev;
+}
+
+mcpool_h taosMemClassPoolCurrent() { return tsCurMemClassPool; }
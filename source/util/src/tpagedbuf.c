@@ -2,6 +2,7 @@
 #include "tpagedbuf.h"
 #include "taoserror.h"
 #include "tcompression.h"
+#include "tmempool.h"
 #include "tsimplehash.h"
 #include "tlog.h"
 
@@ -10,6 +11,21 @@
 #define CLEAR_BUF_PAGE_IN_MEM_FLAG(_p) ((_p)->pData = NULL)
 #define HAS_DATA_IN_DISK(_p)           ((_p)->offset >= 0)
 #define NO_IN_MEM_AVAILABLE_PAGES(_b)  (listNEles((_b)->lruList) >= (_b)->inMemPages)
+#define GET_RAW_PAGE_SIZE(_b)          ((_b)->pageSize + (int32_t)sizeof(SFilePage))
+
+#define DBUF_FLUSH_THREADS      2
+#define DBUF_MAX_INFLIGHT_PAGES 8  // writes not done yet of one buffer, the query thread stalls beyond it
+#define DBUF_READ_AHEAD_PAGES   4
+#define DBUF_RECENT_LOADS       8
+#define DBUF_COMP_EXTRA_BYTES   32
+#define DBUF_UNCHARGED_PAGES    2  // pages always allowed in memory, not charged to the memory budget
+
+// the first byte of a page compressed on disk
+#define DBUF_PAGE_COMP_STRING 1
+#define DBUF_PAGE_COMP_CODEC  2
+
+#define DBUF_IO_WRITE 1
+#define DBUF_IO_READ  2
 
 typedef struct SPageDiskInfo {
   int64_t offset;
@@ -24,8 +40,30 @@ struct SPageInfo {
   int32_t    length : 29;
   bool       used : 1;   // set current page is in used
   bool       dirty : 1;  // set current buffer page is dirty or not
+  bool       comp : 1;   // the data on disk is compressed
 };
 
+typedef struct SPageIoTask SPageIoTask;
+struct SPageIoTask {
+  SDiskbasedBuf* pBuf;
+  int32_t        pageId;
+  int8_t         type;
+  int8_t         done;
+  int32_t        code;
+  int64_t        offset;
+  int32_t        length;
+  SPageIoTask*   next;
+  char           data[];
+};
+
+typedef struct SPageFlusher {
+  TdThread      thread;
+  TdThreadMutex mutex;
+  TdThreadCond  cond;
+  SPageIoTask*  pHead;
+  SPageIoTask*  pTail;
+} SPageFlusher;
+
 struct SDiskbasedBuf {
   int32_t   numOfPages;
   int64_t   totalBufSize;
@@ -46,11 +84,272 @@ struct SDiskbasedBuf {
   bool      comp;              // compressed before flushed to disk
   uint64_t  nextPos;           // next page flush position
 
+  __page_encode_fn_t encodeFp;
+  __page_decode_fn_t decodeFp;
+  void*              codecParam;
+
+  // pages are written and read ahead by the flusher threads, the query thread only waits for them when needed
+  int32_t       flusherIdx;  // -1 if no flusher is available, the query thread does the io itself
+  TdThreadMutex ioMutex;
+  TdThreadCond  ioCond;
+  SSHashObj*    pIoTasks;  // pageId -> SPageIoTask*, pages being written and pages read ahead
+  int32_t       numOfInflight;
+  int32_t       numOfPrefetched;
+  int32_t       ioCode;
+  int32_t       recentLoads[DBUF_RECENT_LOADS];
+  int32_t       recentLoadIdx;
+
+  // in-memory pages are charged to the memory pool of the query task, a page is spilled instead if it is refused
+  void*   pMemCtx;
+  int32_t numOfMemPages;
+  int32_t numOfChargedPages;
+
   char*               id;           // for debug purpose
   bool                printStatis;  // Print statistics info when closing this buffer.
   SDiskbasedBufStatis statis;
 };
 
+static TdThreadOnce flusherInit = PTHREAD_ONCE_INIT;
+static SPageFlusher flushers[DBUF_FLUSH_THREADS];
+static int32_t      numOfFlushers = 0;
+static int32_t      nextFlusher = 0;
+
+static void dBufFinishIoTask(SDiskbasedBuf* pBuf, SPageIoTask* pTask, int32_t code) {
+  bool freeTask = false;
+
+  taosThreadMutexLock(&pBuf->ioMutex);
+  pTask->code = code;
+  pTask->done = 1;
+  pBuf->numOfInflight -= 1;
+
+  if (pTask->type == DBUF_IO_WRITE) {
+    if (code != TSDB_CODE_SUCCESS) {
+      uError("failed to flush buf page:%d to disk since %s, %s", pTask->pageId, tstrerror(code), pBuf->id);
+      pBuf->ioCode = code;
+    }
+
+    // a newer write of the same page may have replaced it
+    SPageIoTask** pp = tSimpleHashGet(pBuf->pIoTasks, &pTask->pageId, sizeof(int32_t));
+    if (pp != NULL && *pp == pTask) {
+      tSimpleHashRemove(pBuf->pIoTasks, &pTask->pageId, sizeof(int32_t));
+    }
+    freeTask = true;
+  }
+
+  taosThreadCondBroadcast(&pBuf->ioCond);
+  taosThreadMutexUnlock(&pBuf->ioMutex);
+
+  if (freeTask) {
+    taosMemoryFree(pTask);
+  }
+}
+
+static int32_t dBufDoIo(SDiskbasedBuf* pBuf, SPageIoTask* pTask) {
+  int64_t ret = 0;
+  if (pTask->type == DBUF_IO_WRITE) {
+    ret = taosPWriteFile(pBuf->pFile, pTask->data, pTask->length, pTask->offset);
+  } else {
+    ret = taosPReadFile(pBuf->pFile, pTask->data, pTask->length, pTask->offset);
+  }
+
+  return (ret == pTask->length) ? TSDB_CODE_SUCCESS : TAOS_SYSTEM_ERROR(errno);
+}
+
+static void* dBufFlushThreadFp(void* param) {
+  SPageFlusher* pFlusher = (SPageFlusher*)param;
+  setThreadName("dbuf-flush");
+
+  while (1) {
+    taosThreadMutexLock(&pFlusher->mutex);
+    while (pFlusher->pHead == NULL) {
+      taosThreadCondWait(&pFlusher->cond, &pFlusher->mutex);
+    }
+
+    SPageIoTask* pTask = pFlusher->pHead;
+    pFlusher->pHead = pTask->next;
+    if (pFlusher->pHead == NULL) {
+      pFlusher->pTail = NULL;
+    }
+    taosThreadMutexUnlock(&pFlusher->mutex);
+
+    int32_t code = dBufDoIo(pTask->pBuf, pTask);
+    dBufFinishIoTask(pTask->pBuf, pTask, code);
+  }
+
+  return NULL;
+}
+
+static void dBufInitFlushers(void) {
+  for (int32_t i = 0; i < DBUF_FLUSH_THREADS; ++i) {
+    SPageFlusher* pFlusher = &flushers[numOfFlushers];
+    taosThreadMutexInit(&pFlusher->mutex, NULL);
+    taosThreadCondInit(&pFlusher->cond, NULL);
+
+    TdThreadAttr thattr;
+    taosThreadAttrInit(&thattr);
+    taosThreadAttrSetDetachState(&thattr, PTHREAD_CREATE_DETACHED);
+    int32_t ret = taosThreadCreate(&pFlusher->thread, &thattr, dBufFlushThreadFp, pFlusher);
+    taosThreadAttrDestroy(&thattr);
+
+    if (ret != 0) {
+      uError("failed to create paged buf flush thread since %s", strerror(errno));
+      taosThreadCondDestroy(&pFlusher->cond);
+      taosThreadMutexDestroy(&pFlusher->mutex);
+      break;
+    }
+    numOfFlushers += 1;
+  }
+}
+
+// writes of one buffer always go to the same flusher, so they reach the disk in order
+static int32_t dBufSubmitIoTask(SDiskbasedBuf* pBuf, SPageIoTask* pTask) {
+  pTask->pBuf = pBuf;
+
+  if (pBuf->flusherIdx < 0) {
+    int32_t code = dBufDoIo(pBuf, pTask);
+    taosMemoryFree(pTask);
+    return code;
+  }
+
+  taosThreadMutexLock(&pBuf->ioMutex);
+  if (pTask->type == DBUF_IO_WRITE && pBuf->numOfInflight >= DBUF_MAX_INFLIGHT_PAGES) {
+    int64_t st = taosGetTimestampUs();
+    while (pBuf->numOfInflight >= DBUF_MAX_INFLIGHT_PAGES) {
+      taosThreadCondWait(&pBuf->ioCond, &pBuf->ioMutex);
+    }
+    pBuf->statis.stallTime += taosGetTimestampUs() - st;
+  }
+
+  if (tSimpleHashPut(pBuf->pIoTasks, &pTask->pageId, sizeof(int32_t), &pTask, POINTER_BYTES) != 0) {
+    taosThreadMutexUnlock(&pBuf->ioMutex);
+    taosMemoryFree(pTask);
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+  pBuf->numOfInflight += 1;
+  if (pTask->type == DBUF_IO_READ) {
+    pBuf->numOfPrefetched += 1;
+  }
+  taosThreadMutexUnlock(&pBuf->ioMutex);
+
+  SPageFlusher* pFlusher = &flushers[pBuf->flusherIdx];
+  taosThreadMutexLock(&pFlusher->mutex);
+  if (pFlusher->pTail == NULL) {
+    pFlusher->pHead = pTask;
+  } else {
+    pFlusher->pTail->next = pTask;
+  }
+  pFlusher->pTail = pTask;
+  taosThreadCondSignal(&pFlusher->cond);
+  taosThreadMutexUnlock(&pFlusher->mutex);
+
+  return TSDB_CODE_SUCCESS;
+}
+
+// the page is not loaded from disk if it is still being written, or it has been read ahead
+static bool dBufLoadFromIoTask(SDiskbasedBuf* pBuf, SPageInfo* pg, char* pPage) {
+  SPageIoTask* pFree = NULL;
+  bool         loaded = false;
+
+  taosThreadMutexLock(&pBuf->ioMutex);
+  SPageIoTask** pp = tSimpleHashGet(pBuf->pIoTasks, &pg->pageId, sizeof(int32_t));
+  if (pp != NULL) {
+    SPageIoTask* pTask = *pp;
+    if (pTask->type == DBUF_IO_WRITE) {
+      memcpy(pPage, pTask->data, pTask->length);
+      loaded = true;
+    } else {
+      while (!pTask->done) {
+        taosThreadCondWait(&pBuf->ioCond, &pBuf->ioMutex);
+      }
+
+      tSimpleHashRemove(pBuf->pIoTasks, &pg->pageId, sizeof(int32_t));
+      pBuf->numOfPrefetched -= 1;
+      if (pTask->code == TSDB_CODE_SUCCESS && pTask->offset == pg->offset && pTask->length == pg->length) {
+        memcpy(pPage, pTask->data, pTask->length);
+        pBuf->statis.readAheadHits += 1;
+        loaded = true;
+      }
+      pFree = pTask;
+    }
+  }
+  taosThreadMutexUnlock(&pBuf->ioMutex);
+
+  taosMemoryFree(pFree);
+  return loaded;
+}
+
+static void dBufWaitIoTasks(SDiskbasedBuf* pBuf) {
+  if (pBuf->pIoTasks == NULL) {
+    return;
+  }
+
+  taosThreadMutexLock(&pBuf->ioMutex);
+  while (pBuf->numOfInflight > 0) {
+    taosThreadCondWait(&pBuf->ioCond, &pBuf->ioMutex);
+  }
+
+  // only the pages read ahead are left
+  void*   pIte = NULL;
+  int32_t iter = 0;
+  while ((pIte = tSimpleHashIterate(pBuf->pIoTasks, pIte, &iter)) != NULL) {
+    taosMemoryFree(*(SPageIoTask**)pIte);
+  }
+  tSimpleHashClear(pBuf->pIoTasks);
+  pBuf->numOfPrefetched = 0;
+  taosThreadMutexUnlock(&pBuf->ioMutex);
+}
+
+static void dBufReadAhead(SDiskbasedBuf* pBuf, int32_t id) {
+  bool sequential = false;
+  for (int32_t i = 0; i < DBUF_RECENT_LOADS; ++i) {
+    if (pBuf->recentLoads[i] == id - 1) {
+      sequential = true;
+      break;
+    }
+  }
+  pBuf->recentLoads[pBuf->recentLoadIdx] = id;
+  pBuf->recentLoadIdx = (pBuf->recentLoadIdx + 1) % DBUF_RECENT_LOADS;
+
+  if (!sequential || pBuf->flusherIdx < 0) {
+    return;
+  }
+
+  for (int32_t next = id + 1; next <= id + DBUF_READ_AHEAD_PAGES; ++next) {
+    SPageInfo** pi = tSimpleHashGet(pBuf->all, &next, sizeof(int32_t));
+    if (pi == NULL || *pi == NULL) {
+      break;
+    }
+    if (BUF_PAGE_IN_MEM(*pi) || !HAS_DATA_IN_DISK(*pi) || (*pi)->length <= 0) {
+      continue;
+    }
+
+    taosThreadMutexLock(&pBuf->ioMutex);
+    bool full = pBuf->numOfInflight >= DBUF_MAX_INFLIGHT_PAGES || pBuf->numOfPrefetched >= DBUF_READ_AHEAD_PAGES * 2;
+    bool exist = tSimpleHashGet(pBuf->pIoTasks, &next, sizeof(int32_t)) != NULL;
+    taosThreadMutexUnlock(&pBuf->ioMutex);
+
+    if (full) {
+      break;
+    }
+    if (exist) {
+      continue;
+    }
+
+    SPageIoTask* pTask = taosMemoryCalloc(1, sizeof(SPageIoTask) + (*pi)->length);
+    if (pTask == NULL) {
+      break;
+    }
+    pTask->pageId = next;
+    pTask->type = DBUF_IO_READ;
+    pTask->offset = (*pi)->offset;
+    pTask->length = (*pi)->length;
+    if (dBufSubmitIoTask(pBuf, pTask) != TSDB_CODE_SUCCESS) {
+      break;
+    }
+    pBuf->statis.readAheadPages += 1;
+  }
+}
+
 static int32_t createDiskFile(SDiskbasedBuf* pBuf) {
   if (pBuf->path == NULL) {  // prepare the file name when needed it
     char path[PATH_MAX] = {0};
@@ -70,29 +369,69 @@ static int32_t createDiskFile(SDiskbasedBuf* pBuf) {
   return TSDB_CODE_SUCCESS;
 }
 
-static char* doCompressData(void* data, int32_t srcSize, int32_t* dst, SDiskbasedBuf* pBuf) {  // do nothing
-  if (!pBuf->comp) {
-    *dst = srcSize;
-    return data;
+// the page is written as it is if it can not be compressed
+static SPageIoTask* doCompressData(SDiskbasedBuf* pBuf, SPageInfo* pg) {
+  int32_t      rawSize = GET_RAW_PAGE_SIZE(pBuf);
+  SPageIoTask* pTask = taosMemoryCalloc(1, sizeof(SPageIoTask) + rawSize + DBUF_COMP_EXTRA_BYTES);
+  if (pTask == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return NULL;
   }
 
-  *dst = tsCompressString(data, srcSize, 1, pBuf->assistBuf, srcSize, ONE_STAGE_COMP, NULL, 0);
+  char*   payload = GET_PAYLOAD_DATA(pg);
+  int32_t cap = rawSize + DBUF_COMP_EXTRA_BYTES - 1;
+  int32_t size = -1;
+  if (pBuf->comp) {
+    if (pBuf->encodeFp != NULL) {
+      size = pBuf->encodeFp(payload, rawSize, pTask->data + 1, cap, pBuf->codecParam);
+      pTask->data[0] = DBUF_PAGE_COMP_CODEC;
+    }
+    if (size <= 0 || size + 1 >= rawSize) {
+      size = tsCompressString(payload, rawSize, 1, pTask->data + 1, cap, ONE_STAGE_COMP, NULL, 0);
+      pTask->data[0] = DBUF_PAGE_COMP_STRING;
+    }
+    size += 1;
+  }
+
+  if (size <= 1 || size >= rawSize) {
+    memcpy(pTask->data, payload, rawSize);
+    size = rawSize;
+    pg->comp = false;
+  } else {
+    pg->comp = true;
+  }
+
+  pTask->pageId = pg->pageId;
+  pTask->type = DBUF_IO_WRITE;
+  pTask->length = size;
 
-  memcpy(data, pBuf->assistBuf, *dst);
-  return data;
+  pBuf->statis.rawFlushBytes += rawSize;
+  return pTask;
 }
 
-static char* doDecompressData(void* data, int32_t srcSize, int32_t* dst, SDiskbasedBuf* pBuf) {  // do nothing
-  if (!pBuf->comp) {
-    *dst = srcSize;
-    return data;
+static int32_t doDecompressData(SDiskbasedBuf* pBuf, SPageInfo* pg, char* data) {
+  if (!pg->comp) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  int32_t rawSize = GET_RAW_PAGE_SIZE(pBuf);
+  int32_t size = -1;
+  if (data[0] == DBUF_PAGE_COMP_CODEC && pBuf->decodeFp != NULL) {
+    size = pBuf->decodeFp(data + 1, pg->length - 1, pBuf->assistBuf, rawSize);
+  } else if (data[0] == DBUF_PAGE_COMP_STRING) {
+    size = tsDecompressString(data + 1, pg->length - 1, 1, pBuf->assistBuf, rawSize, ONE_STAGE_COMP, NULL, 0);
+  }
+
+  if (size < 0 || size > rawSize) {
+    uError("failed to decompress buf page:%d, method:%d, length:%d, %s", pg->pageId, data[0], pg->length, pBuf->id);
+    return TSDB_CODE_INVALID_PARA;
   }
 
-  *dst = tsDecompressString(data, srcSize, 1, pBuf->assistBuf, pBuf->pageSize, ONE_STAGE_COMP, NULL, 0);
-  if (*dst > 0) {
-    memcpy(data, pBuf->assistBuf, *dst);
+  memcpy(data, pBuf->assistBuf, size);
+  if (size < rawSize) {
+    memset(data + size, 0, rawSize - size);
   }
-  return data;
+  return TSDB_CODE_SUCCESS;
 }
 
 static uint64_t allocateNewPositionInFile(SDiskbasedBuf* pBuf, size_t size) {
@@ -129,30 +468,6 @@ static uint64_t allocateNewPositionInFile(SDiskbasedBuf* pBuf, size_t size) {
 
 static FORCE_INLINE size_t getAllocPageSize(int32_t pageSize) { return pageSize + POINTER_BYTES + sizeof(SFilePage); }
 
-static int32_t doFlushBufPageImpl(SDiskbasedBuf* pBuf, int64_t offset, const char* pData, int32_t size) {
-  int32_t ret = taosLSeekFile(pBuf->pFile, offset, SEEK_SET);
-  if (ret == -1) {
-    terrno = TAOS_SYSTEM_ERROR(errno);
-    return terrno;
-  }
-
-  ret = (int32_t)taosWriteFile(pBuf->pFile, pData, size);
-  if (ret != size) {
-    terrno = TAOS_SYSTEM_ERROR(errno);
-    return terrno;
-  }
-
-  // extend the file
-  if (pBuf->fileSize < offset + size) {
-    pBuf->fileSize = offset + size;
-  }
-
-  pBuf->statis.flushBytes += size;
-  pBuf->statis.flushPages += 1;
-
-  return TSDB_CODE_SUCCESS;
-}
-
 static char* doFlushBufPage(SDiskbasedBuf* pBuf, SPageInfo* pg) {
   if (pg->pData == NULL || pg->used) {
     uError("invalid params in paged buffer process when flushing buf to disk, %s", pBuf->id);
@@ -160,49 +475,45 @@ static char* doFlushBufPage(SDiskbasedBuf* pBuf, SPageInfo* pg) {
     return NULL;
   }
 
-  int32_t size = pBuf->pageSize;
   int64_t offset = pg->offset;
+  int32_t size = pg->length;  // NOTE: the size may be -1, the this recycle page has not been flushed to disk yet.
 
-  char* t = NULL;
-  if ((!HAS_DATA_IN_DISK(pg)) || pg->dirty) {
-    void* payload = GET_PAYLOAD_DATA(pg);
-    t = doCompressData(payload, pBuf->pageSize + sizeof(SFilePage), &size, pBuf);
-    if (size < 0) {
-      uError("failed to compress data when flushing data to disk, %s", pBuf->id);
-      terrno = TSDB_CODE_INVALID_PARA;
+  // the page is compressed here, only the write is left to the flusher
+  if (pg->dirty) {
+    SPageIoTask* pTask = doCompressData(pBuf, pg);
+    if (pTask == NULL) {
       return NULL;
     }
-  }
+    size = pTask->length;
 
-  // this page is flushed to disk for the first time
-  if (pg->dirty) {
-    if (!HAS_DATA_IN_DISK(pg)) {
+    if (!HAS_DATA_IN_DISK(pg)) {  // this page is flushed to disk for the first time
       offset = allocateNewPositionInFile(pBuf, size);
       pBuf->nextPos += size;
-
-      int32_t code = doFlushBufPageImpl(pBuf, offset, t, size);
-      if (code != TSDB_CODE_SUCCESS) {
-        return NULL;
-      }
-    } else {
+    } else if (pg->length < size) {
       // length becomes greater, current space is not enough, allocate new place, otherwise, do nothing
-      if (pg->length < size) {
-        // 1. add current space to free list
-        SPageDiskInfo dinfo = {.length = pg->length, .offset = offset};
-        taosArrayPush(pBuf->pFree, &dinfo);
-
-        // 2. allocate new position, and update the info
-        offset = allocateNewPositionInFile(pBuf, size);
-        pBuf->nextPos += size;
-      }
+      // 1. add current space to free list
+      SPageDiskInfo dinfo = {.length = pg->length, .offset = offset};
+      taosArrayPush(pBuf->pFree, &dinfo);
 
-      int32_t code = doFlushBufPageImpl(pBuf, offset, t, size);
-      if (code != TSDB_CODE_SUCCESS) {
-        return NULL;
-      }
+      // 2. allocate new position, and update the info
+      offset = allocateNewPositionInFile(pBuf, size);
+      pBuf->nextPos += size;
+    }
+
+    // extend the file
+    if (pBuf->fileSize < offset + size) {
+      pBuf->fileSize = offset + size;
+    }
+
+    pBuf->statis.flushBytes += size;
+    pBuf->statis.flushPages += 1;
+
+    pTask->offset = offset;
+    int32_t code = dBufSubmitIoTask(pBuf, pTask);
+    if (code != TSDB_CODE_SUCCESS) {
+      terrno = code;
+      return NULL;
     }
-  } else {  // NOTE: the size may be -1, the this recycle page has not been flushed to disk yet.
-    size = pg->length;
   }
 
   char* pDataBuf = pg->pData;
@@ -241,25 +552,18 @@ static int32_t loadPageFromDisk(SDiskbasedBuf* pBuf, SPageInfo* pg) {
     return TSDB_CODE_INVALID_PARA;
   }
 
-  int32_t ret = taosLSeekFile(pBuf->pFile, pg->offset, SEEK_SET);
-  if (ret == -1) {
-    ret = TAOS_SYSTEM_ERROR(errno);
-    return ret;
-  }
-
-  void* pPage = (void*)GET_PAYLOAD_DATA(pg);
-  ret = (int32_t)taosReadFile(pBuf->pFile, pPage, pg->length);
-  if (ret != pg->length) {
-    ret = TAOS_SYSTEM_ERROR(errno);
-    return ret;
+  char* pPage = GET_PAYLOAD_DATA(pg);
+  if (!dBufLoadFromIoTask(pBuf, pg, pPage)) {
+    int64_t ret = taosPReadFile(pBuf->pFile, pPage, pg->length, pg->offset);
+    if (ret != pg->length) {
+      return TAOS_SYSTEM_ERROR(errno);
+    }
   }
 
   pBuf->statis.loadBytes += pg->length;
   pBuf->statis.loadPages += 1;
 
-  int32_t fullSize = 0;
-  doDecompressData(pPage, pg->length, &fullSize, pBuf);
-  return 0;
+  return doDecompressData(pBuf, pg, pPage);
 }
 
 static SPageInfo* registerNewPageInfo(SDiskbasedBuf* pBuf, int32_t pageId) {
@@ -278,6 +582,7 @@ static SPageInfo* registerNewPageInfo(SDiskbasedBuf* pBuf, int32_t pageId) {
   ppi->used = true;
   ppi->pn = NULL;
   ppi->dirty = false;
+  ppi->comp = false;
 
   return *(SPageInfo**)taosArrayPush(pBuf->pIdList, &ppi);
 }
@@ -382,6 +687,26 @@ int32_t createDiskbasedBuf(SDiskbasedBuf** pBuf, int32_t pagesize, int32_t inMem
   pPBuf->prefix = (char*)dir;
   pPBuf->emptyDummyIdList = taosArrayInit(1, sizeof(int32_t));
 
+  pPBuf->pIoTasks = tSimpleHashInit(8, fn);
+  if (pPBuf->pIoTasks == NULL) {
+    goto _error;
+  }
+  taosThreadMutexInit(&pPBuf->ioMutex, NULL);
+  taosThreadCondInit(&pPBuf->ioCond, NULL);
+
+  taosThreadOnce(&flusherInit, dBufInitFlushers);
+  pPBuf->flusherIdx = (numOfFlushers > 0) ? (atomic_fetch_add_32(&nextFlusher, 1) % numOfFlushers) : -1;
+  pPBuf->pMemCtx = taosMemClassPoolCurrent();
+  for (int32_t i = 0; i < DBUF_RECENT_LOADS; ++i) {
+    pPBuf->recentLoads[i] = -1;
+  }
+
+  // pages are compressed before flushed to disk by default
+  setBufPageCompressOnDisk(pPBuf, true);
+  if (pPBuf->assistBuf == NULL) {
+    goto _error;
+  }
+
   //  qDebug("QInfo:0x%"PRIx64" create resBuf for output, page size:%d, inmem buf pages:%d, file:%s", qId,
   //  pPBuf->pageSize, pPBuf->inMemPages, pPBuf->path);
 
@@ -391,6 +716,41 @@ _error:
   return TSDB_CODE_OUT_OF_MEMORY;
 }
 
+static bool dBufChargeNewPage(SDiskbasedBuf* pBuf) {
+  if (pBuf->pMemCtx == NULL || pBuf->numOfMemPages < DBUF_UNCHARGED_PAGES) {
+    return true;
+  }
+
+  if (!taosMemClassPoolReserve(pBuf->pMemCtx, getAllocPageSize(pBuf->pageSize), true)) {
+    return false;
+  }
+
+  pBuf->numOfChargedPages += 1;
+  return true;
+}
+
+static void dBufFreeMemPage(SDiskbasedBuf* pBuf, void* pData) {
+  if (pData == NULL) {
+    return;
+  }
+
+  taosMemoryFree(pData);
+  pBuf->numOfMemPages -= 1;
+  if (pBuf->numOfChargedPages > pBuf->numOfMemPages) {
+    pBuf->numOfChargedPages -= 1;
+    taosMemClassPoolRelease(pBuf->pMemCtx, getAllocPageSize(pBuf->pageSize));
+  }
+}
+
+static void dBufReleaseAllMemPages(SDiskbasedBuf* pBuf) {
+  if (pBuf->numOfChargedPages > 0) {
+    taosMemClassPoolRelease(pBuf->pMemCtx, (int64_t)pBuf->numOfChargedPages * getAllocPageSize(pBuf->pageSize));
+  }
+
+  pBuf->numOfChargedPages = 0;
+  pBuf->numOfMemPages = 0;
+}
+
 static char* doExtractPage(SDiskbasedBuf* pBuf, bool* newPage) {
   char* availablePage = NULL;
   if (NO_IN_MEM_AVAILABLE_PAGES(pBuf)) {
@@ -399,19 +759,44 @@ static char* doExtractPage(SDiskbasedBuf* pBuf, bool* newPage) {
       uWarn("no available buf pages, current:%d, max:%d, reason: %s, %s", listNEles(pBuf->lruList), pBuf->inMemPages,
             terrstr(), pBuf->id)
     }
-  } else {
-    availablePage =
-        taosMemoryCalloc(1, getAllocPageSize(pBuf->pageSize));  // add extract bytes in case of zipped buffer increased.
-    if (availablePage == NULL) {
-      terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return availablePage;
+  }
+
+  // the memory budget of the query is used up, spill the eldest page instead of allocating a new one
+  if (!dBufChargeNewPage(pBuf)) {
+    availablePage = evictBufPage(pBuf);
+    if (availablePage != NULL) {
+      pBuf->statis.budgetSpills += 1;
+      return availablePage;
+    }
+
+    uDebug("no page to spill for memory budget, current:%d, %s", listNEles(pBuf->lruList), pBuf->id);
+  }
+
+  availablePage =
+      taosMemoryCalloc(1, getAllocPageSize(pBuf->pageSize));  // add extract bytes in case of zipped buffer increased.
+  if (availablePage == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    if (pBuf->numOfChargedPages > pBuf->numOfMemPages) {
+      pBuf->numOfChargedPages -= 1;
+      taosMemClassPoolRelease(pBuf->pMemCtx, getAllocPageSize(pBuf->pageSize));
     }
+  } else {
+    pBuf->numOfMemPages += 1;
     *newPage = true;
   }
 
   return availablePage;
 }
 
+static FORCE_INLINE int32_t dBufGetIoCode(SDiskbasedBuf* pBuf) { return atomic_load_32(&pBuf->ioCode); }
+
 void* getNewBufPage(SDiskbasedBuf* pBuf, int32_t* pageId) {
+  if (dBufGetIoCode(pBuf) != TSDB_CODE_SUCCESS) {
+    terrno = dBufGetIoCode(pBuf);
+    return NULL;
+  }
+
   pBuf->statis.getPages += 1;
 
   bool newPage = false;
@@ -435,7 +820,7 @@ void* getNewBufPage(SDiskbasedBuf* pBuf, int32_t* pageId) {
     pi = registerNewPageInfo(pBuf, *pageId);
     if (pi == NULL) {
       if (newPage) {
-        taosMemoryFree(availablePage);
+        dBufFreeMemPage(pBuf, availablePage);
       }
       return NULL;
     }
@@ -464,6 +849,11 @@ void* getBufPage(SDiskbasedBuf* pBuf, int32_t id) {
     return NULL;
   }
 
+  if (dBufGetIoCode(pBuf) != TSDB_CODE_SUCCESS) {
+    terrno = dBufGetIoCode(pBuf);
+    return NULL;
+  }
+
   pBuf->statis.getPages += 1;
 
   SPageInfo** pi = tSimpleHashGet(pBuf->all, &id, sizeof(int32_t));
@@ -517,12 +907,15 @@ void* getBufPage(SDiskbasedBuf* pBuf, int32_t id) {
       int32_t code = loadPageFromDisk(pBuf, *pi);
       if (code != 0) {
         if (newPage) {
-          taosMemoryFree((*pi)->pData);
+          dBufFreeMemPage(pBuf, (*pi)->pData);
         }
 
         terrno = code;
         return NULL;
       }
+
+      // pages are usually loaded one by one in external merge sort, read the following pages ahead
+      dBufReadAhead(pBuf, id);
     }
 #ifdef BUF_PAGE_DEBUG
     uDebug("page_getBufPage2 pageId:%d, offset:%" PRId64, (*pi)->pageId, (*pi)->offset);
@@ -568,6 +961,7 @@ void destroyDiskbasedBuf(SDiskbasedBuf* pBuf) {
   }
 
   dBufPrintStatis(pBuf);
+  dBufWaitIoTasks(pBuf);
 
   bool needRemoveFile = false;
   if (pBuf->pFile != NULL) {
@@ -595,6 +989,12 @@ void destroyDiskbasedBuf(SDiskbasedBuf* pBuf) {
           ps->getPages, ps->releasePages, ps->flushBytes / 1024.0f, ps->flushPages, ps->loadBytes / 1024.0f,
           ps->loadPages, ps->loadBytes / (1024.0 * ps->loadPages));
     }
+
+    if (ps->flushBytes > 0) {
+      uDebug("Spill raw:%.2f Kb, comp ratio:%.2f, stall:%.2f ms, read ahead pages:%d, hit:%d, by budget:%d, %s",
+             ps->rawFlushBytes / 1024.0, ps->rawFlushBytes / (double)ps->flushBytes, ps->stallTime / 1000.0,
+             ps->readAheadPages, ps->readAheadHits, ps->budgetSpills, pBuf->id);
+    }
   }
 
   if (needRemoveFile) {
@@ -614,6 +1014,7 @@ void destroyDiskbasedBuf(SDiskbasedBuf* pBuf) {
   }
 
   taosArrayDestroy(pBuf->pIdList);
+  dBufReleaseAllMemPages(pBuf);
 
   tdListFree(pBuf->lruList);
   tdListFree(pBuf->freePgList);
@@ -623,6 +1024,13 @@ void destroyDiskbasedBuf(SDiskbasedBuf* pBuf) {
 
   tSimpleHashCleanup(pBuf->all);
 
+  if (pBuf->pIoTasks != NULL) {
+    tSimpleHashCleanup(pBuf->pIoTasks);
+    taosThreadCondDestroy(&pBuf->ioCond);
+    taosThreadMutexDestroy(&pBuf->ioMutex);
+  }
+
+  taosMemoryFreeClear(pBuf->codecParam);
   taosMemoryFreeClear(pBuf->id);
   taosMemoryFreeClear(pBuf->assistBuf);
   taosMemoryFreeClear(pBuf);
@@ -650,8 +1058,18 @@ void setBufPageDirty(void* pPage, bool dirty) {
 void setBufPageCompressOnDisk(SDiskbasedBuf* pBuf, bool comp) {
   pBuf->comp = comp;
   if (comp  && (pBuf->assistBuf == NULL)) {
-    pBuf->assistBuf = taosMemoryMalloc(pBuf->pageSize + 2);  // EXTRA BYTES
+    pBuf->assistBuf = taosMemoryMalloc(GET_RAW_PAGE_SIZE(pBuf));
+  }
+}
+
+void dBufSetPageCodec(SDiskbasedBuf* pBuf, __page_encode_fn_t encodeFp, __page_decode_fn_t decodeFp, void* param) {
+  if (pBuf->codecParam != param) {
+    taosMemoryFreeClear(pBuf->codecParam);
   }
+
+  pBuf->encodeFp = encodeFp;
+  pBuf->decodeFp = decodeFp;
+  pBuf->codecParam = param;
 }
 
 void dBufSetBufPageRecycled(SDiskbasedBuf* pBuf, void* pPage) {
@@ -662,7 +1080,8 @@ void dBufSetBufPageRecycled(SDiskbasedBuf* pBuf, void* pPage) {
 
   // add this pageinfo into the free page info list
   SListNode* pNode = tdListPopNode(pBuf->lruList, ppi->pn);
-  taosMemoryFreeClear(ppi->pData);
+  dBufFreeMemPage(pBuf, ppi->pData);
+  ppi->pData = NULL;
   taosMemoryFreeClear(pNode);
   ppi->pn = NULL;
 
@@ -700,6 +1119,8 @@ void dBufPrintStatis(const SDiskbasedBuf* pBuf) {
 }
 
 void clearDiskbasedBuf(SDiskbasedBuf* pBuf) {
+  dBufWaitIoTasks(pBuf);
+
   size_t n = taosArrayGetSize(pBuf->pIdList);
   for (int32_t i = 0; i < n; ++i) {
     SPageInfo* pi = taosArrayGetP(pBuf->pIdList, i);
@@ -708,6 +1129,7 @@ void clearDiskbasedBuf(SDiskbasedBuf* pBuf) {
   }
 
   taosArrayClear(pBuf->pIdList);
+  dBufReleaseAllMemPages(pBuf);
 
   tdListEmpty(pBuf->lruList);
   tdListEmpty(pBuf->freePgList);
@@ -721,4 +1143,8 @@ void clearDiskbasedBuf(SDiskbasedBuf* pBuf) {
   pBuf->totalBufSize = 0;
   pBuf->allocateId = -1;
   pBuf->fileSize = 0;
+  pBuf->recentLoadIdx = 0;
+  for (int32_t i = 0; i < DBUF_RECENT_LOADS; ++i) {
+    pBuf->recentLoads[i] = -1;
+  }
 }
@@ -18,12 +18,100 @@
 #include "taoserror.h"
 #include "tlog.h"
 
+#define QSET_MIN_SPIN_TIMES 64
+#define QSET_MAX_SPIN_TIMES 4096
+#define QUEUE_SPIN_YIELD    1000
+
 int64_t tsRpcQueueMemoryAllowed = 0;
 int64_t tsRpcQueueMemoryUsed = 0;
 
 void taosSetQueueMemoryCapacity(STaosQueue *queue, int64_t cap) { queue->memLimit = cap; }
 void taosSetQueueCapacity(STaosQueue *queue, int64_t size) { queue->itemLimit = size; }
 
+// the writer side of the intrusive MPSC list, never blocks
+static void taosQueuePushNode(STaosQueue *queue, STaosQnode *pNode) {
+  pNode->next = NULL;
+  STaosQnode *prev = atomic_exchange_ptr(&queue->tail, pNode);
+  atomic_store_ptr(&prev->next, pNode);
+}
+
+static FORCE_INLINE void taosQueueSpin(int32_t *nLoops) {
+  if (++(*nLoops) > QUEUE_SPIN_YIELD) {
+    sched_yield();
+    *nLoops = 0;
+  }
+}
+
+// the reader side, the caller shall hold queue->mutex. NULL is returned if the queue is empty
+static STaosQnode *taosQueuePopNode(STaosQueue *queue) {
+  int32_t nLoops = 0;
+
+  while (1) {
+    STaosQnode *head = queue->head;
+    STaosQnode *next = atomic_load_ptr(&head->next);
+
+    if (head == queue->stub) {
+      if (next != NULL) {
+        atomic_store_ptr(&queue->head, next);
+      } else if (atomic_load_ptr(&queue->tail) == head) {
+        return NULL;
+      } else {
+        taosQueueSpin(&nLoops);  // a writer has swapped the tail but not linked its node yet
+      }
+      continue;
+    }
+
+    if (next != NULL) {
+      atomic_store_ptr(&queue->head, next);
+      return head;
+    }
+
+    if (atomic_load_ptr(&queue->tail) == head) {
+      // head is the last node, put the stub behind it so that head can be taken out
+      taosQueuePushNode(queue, queue->stub);
+    } else {
+      taosQueueSpin(&nLoops);
+    }
+  }
+}
+
+// no node is linked or being linked. The stub being the tail is not enough, since a reader puts it behind the last node
+// before taking that node out, and a writer swaps the tail before linking its node to the stub
+static FORCE_INLINE bool taosQueueNoNode(STaosQueue *queue) {
+  STaosQnode *stub = queue->stub;
+  return atomic_load_ptr(&queue->tail) == stub && atomic_load_ptr(&queue->head) == stub &&
+         atomic_load_ptr(&stub->next) == NULL;
+}
+
+// counting semaphore of the qset, the readers spin for a while before parking on the kernel semaphore
+static void taosQsetPost(STaosQset *qset) {
+  if (atomic_fetch_add_32(&qset->semCount, 1) < 0) {
+    tsem_post(&qset->sem);
+  }
+}
+
+static void taosQsetWait(STaosQset *qset) {
+  int32_t spinTimes = atomic_load_32(&qset->spinTimes);
+  for (int32_t i = 0; i < spinTimes; ++i) {
+    int32_t count = atomic_load_32(&qset->semCount);
+    if (count > 0 && atomic_val_compare_exchange_32(&qset->semCount, count, count - 1) == count) {
+      // items come in while spinning, spin longer next time
+      if (i > 0 && spinTimes < QSET_MAX_SPIN_TIMES) {
+        atomic_store_32(&qset->spinTimes, spinTimes * 2);
+      }
+      return;
+    }
+  }
+
+  if (spinTimes > QSET_MIN_SPIN_TIMES) {
+    atomic_store_32(&qset->spinTimes, TMAX(spinTimes / 2, QSET_MIN_SPIN_TIMES));
+  }
+
+  if (atomic_fetch_sub_32(&qset->semCount, 1) <= 0) {
+    tsem_wait(&qset->sem);
+  }
+}
+
 STaosQueue *taosOpenQueue() {
   STaosQueue *queue = taosMemoryCalloc(1, sizeof(STaosQueue));
   if (queue == NULL) {
@@ -31,7 +119,18 @@ STaosQueue *taosOpenQueue() {
     return NULL;
   }
 
+  queue->stub = taosMemoryCalloc(1, sizeof(STaosQnode));
+  if (queue->stub == NULL) {
+    taosMemoryFree(queue);
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return NULL;
+  }
+  queue->head = queue->stub;
+  queue->tail = queue->stub;
+
   if (taosThreadMutexInit(&queue->mutex, NULL) != 0) {
+    taosMemoryFree(queue->stub);
+    taosMemoryFree(queue);
     terrno = TSDB_CODE_OUT_OF_MEMORY;
     return NULL;
   }
@@ -48,26 +147,22 @@ void taosSetQueueFp(STaosQueue *queue, FItem itemFp, FItems itemsFp) {
 
 void taosCloseQueue(STaosQueue *queue) {
   if (queue == NULL) return;
-  STaosQnode *pTemp;
+  STaosQnode *pNode;
   STaosQset  *qset;
 
-  taosThreadMutexLock(&queue->mutex);
-  STaosQnode *pNode = queue->head;
-  queue->head = NULL;
-  qset = queue->qset;
-  taosThreadMutexUnlock(&queue->mutex);
-
-  if (queue->qset) {
+  qset = atomic_load_ptr(&queue->qset);
+  if (qset) {
     taosRemoveFromQset(qset, queue);
   }
 
-  while (pNode) {
-    pTemp = pNode;
-    pNode = pNode->next;
-    taosMemoryFree(pTemp);
+  taosThreadMutexLock(&queue->mutex);
+  while ((pNode = taosQueuePopNode(queue)) != NULL) {
+    taosMemoryFree(pNode);
   }
+  taosThreadMutexUnlock(&queue->mutex);
 
   taosThreadMutexDestroy(&queue->mutex);
+  taosMemoryFree(queue->stub);
   taosMemoryFree(queue);
 
   uDebug("queue:%p is closed", queue);
@@ -76,41 +171,24 @@ void taosCloseQueue(STaosQueue *queue) {
 bool taosQueueEmpty(STaosQueue *queue) {
   if (queue == NULL) return true;
 
-  bool empty = false;
-  taosThreadMutexLock(&queue->mutex);
-  if (queue->head == NULL && queue->tail == NULL && queue->numOfItems == 0 /*&& queue->memOfItems == 0*/) {
-    empty = true;
-  }
-  taosThreadMutexUnlock(&queue->mutex);
-
-  return empty;
+  return atomic_load_32(&queue->numOfItems) == 0 && taosQueueNoNode(queue);
 }
 
 void taosUpdateItemSize(STaosQueue *queue, int32_t items) {
   if (queue == NULL) return;
 
-  taosThreadMutexLock(&queue->mutex);
-  queue->numOfItems -= items;
-  taosThreadMutexUnlock(&queue->mutex);
+  atomic_sub_fetch_32(&queue->numOfItems, items);
 }
 
 int32_t taosQueueItemSize(STaosQueue *queue) {
   if (queue == NULL) return 0;
 
-  taosThreadMutexLock(&queue->mutex);
-  int32_t numOfItems = queue->numOfItems;
-  taosThreadMutexUnlock(&queue->mutex);
-
-  uTrace("queue:%p, numOfItems:%d memOfItems:%" PRId64, queue, queue->numOfItems, queue->memOfItems);
+  int32_t numOfItems = atomic_load_32(&queue->numOfItems);
+  uTrace("queue:%p, numOfItems:%d memOfItems:%" PRId64, queue, numOfItems, atomic_load_64(&queue->memOfItems));
   return numOfItems;
 }
 
-int64_t taosQueueMemorySize(STaosQueue *queue) {
-  taosThreadMutexLock(&queue->mutex);
-  int64_t memOfItems = queue->memOfItems;
-  taosThreadMutexUnlock(&queue->mutex);
-  return memOfItems;
-}
+int64_t taosQueueMemorySize(STaosQueue *queue) { return atomic_load_64(&queue->memOfItems); }
 
 void *taosAllocateQitem(int32_t size, EQItype itype, int64_t dataSize) {
   STaosQnode *pNode = taosMemoryCalloc(1, sizeof(STaosQnode) + size);
@@ -159,40 +237,37 @@ void taosFreeQitem(void *pItem) {
 int32_t taosWriteQitem(STaosQueue *queue, void *pItem) {
   int32_t     code = 0;
   STaosQnode *pNode = (STaosQnode *)(((char *)pItem) - sizeof(STaosQnode));
-  pNode->next = NULL;
+  int64_t     size = pNode->size + pNode->dataSize;
 
-  taosThreadMutexLock(&queue->mutex);
-  if (queue->memLimit > 0 && (queue->memOfItems + pNode->size + pNode->dataSize) > queue->memLimit) {
+  // the limits are reserved before the node is linked, and given back if they are exceeded
+  int64_t memOfItems = atomic_add_fetch_64(&queue->memOfItems, size);
+  if (queue->memLimit > 0 && memOfItems > queue->memLimit) {
+    atomic_sub_fetch_64(&queue->memOfItems, size);
     code = TSDB_CODE_UTIL_QUEUE_OUT_OF_MEMORY;
     uError("item:%p failed to put into queue:%p, queue mem limit: %" PRId64 ", reason: %s" PRId64, pItem, queue,
            queue->memLimit, tstrerror(code));
-
-    taosThreadMutexUnlock(&queue->mutex);
     return code;
-  } else if (queue->itemLimit > 0 && queue->numOfItems + 1 > queue->itemLimit) {
+  }
+
+  int32_t numOfItems = atomic_add_fetch_32(&queue->numOfItems, 1);
+  if (queue->itemLimit > 0 && numOfItems > queue->itemLimit) {
+    atomic_sub_fetch_32(&queue->numOfItems, 1);
+    atomic_sub_fetch_64(&queue->memOfItems, size);
     code = TSDB_CODE_UTIL_QUEUE_OUT_OF_MEMORY;
     uError("item:%p failed to put into queue:%p, queue size limit: %" PRId64 ", reason: %s" PRId64, pItem, queue,
            queue->itemLimit, tstrerror(code));
-    taosThreadMutexUnlock(&queue->mutex);
     return code;
   }
 
-  if (queue->tail) {
-    queue->tail->next = pNode;
-    queue->tail = pNode;
-  } else {
-    queue->head = pNode;
-    queue->tail = pNode;
-  }
-  queue->numOfItems++;
-  queue->memOfItems += (pNode->size + pNode->dataSize);
-  if (queue->qset) atomic_add_fetch_32(&queue->qset->numOfItems, 1);
-
-  uTrace("item:%p is put into queue:%p, items:%d mem:%" PRId64, pItem, queue, queue->numOfItems, queue->memOfItems);
+  taosQueuePushNode(queue, pNode);
+  uTrace("item:%p is put into queue:%p, items:%d mem:%" PRId64, pItem, queue, numOfItems, memOfItems);
 
-  taosThreadMutexUnlock(&queue->mutex);
+  STaosQset *qset = atomic_load_ptr(&queue->qset);
+  if (qset) {
+    atomic_add_fetch_32(&qset->numOfItems, 1);
+    taosQsetPost(qset);
+  }
 
-  if (queue->qset) tsem_post(&queue->qset->sem);
   return code;
 }
 
@@ -200,26 +275,55 @@ int32_t taosReadQitem(STaosQueue *queue, void **ppItem) {
   STaosQnode *pNode = NULL;
   int32_t     code = 0;
 
+  if (taosQueueNoNode(queue)) return 0;
+
   taosThreadMutexLock(&queue->mutex);
+  pNode = taosQueuePopNode(queue);
+  taosThreadMutexUnlock(&queue->mutex);
 
-  if (queue->head) {
-    pNode = queue->head;
+  if (pNode) {
     *ppItem = pNode->item;
-    queue->head = pNode->next;
-    if (queue->head == NULL) queue->tail = NULL;
-    queue->numOfItems--;
-    queue->memOfItems -= (pNode->size + pNode->dataSize);
-    if (queue->qset) atomic_sub_fetch_32(&queue->qset->numOfItems, 1);
+    int32_t numOfItems = atomic_sub_fetch_32(&queue->numOfItems, 1);
+    int64_t memOfItems = atomic_sub_fetch_64(&queue->memOfItems, pNode->size + pNode->dataSize);
+    STaosQset *qset = atomic_load_ptr(&queue->qset);
+    if (qset) atomic_sub_fetch_32(&qset->numOfItems, 1);
     code = 1;
-    uTrace("item:%p is read out from queue:%p, items:%d mem:%" PRId64, *ppItem, queue, queue->numOfItems,
-           queue->memOfItems);
+    uTrace("item:%p is read out from queue:%p, items:%d mem:%" PRId64, *ppItem, queue, numOfItems, memOfItems);
   }
 
-  taosThreadMutexUnlock(&queue->mutex);
-
   return code;
 }
 
+// take out the nodes linked before the read starts, so that it does not chase the writers forever
+static int32_t taosQueuePopAllNodes(STaosQueue *queue, STaosQall *qall) {
+  STaosQnode *end = atomic_load_ptr(&queue->tail);
+  STaosQnode *last = NULL;
+  STaosQnode *pNode = NULL;
+
+  memset(qall, 0, sizeof(STaosQall));
+  if (end == queue->stub) return 0;
+
+  while ((pNode = taosQueuePopNode(queue)) != NULL) {
+    if (last) {
+      last->next = pNode;
+    } else {
+      qall->start = pNode;
+    }
+    last = pNode;
+
+    qall->numOfItems++;
+    qall->memOfItems += (pNode->size + pNode->dataSize);
+    if (pNode == end) break;
+  }
+
+  if (last) last->next = NULL;
+
+  qall->current = qall->start;
+  qall->unAccessedNumOfItems = qall->numOfItems;
+  qall->unAccessMemOfItems = qall->memOfItems;
+  return qall->numOfItems;
+}
+
 STaosQall *taosAllocateQall() {
   STaosQall *qall = taosMemoryCalloc(1, sizeof(STaosQall));
   if (qall != NULL) {
@@ -232,40 +336,20 @@ void taosFreeQall(STaosQall *qall) { taosMemoryFree(qall); }
 
 int32_t taosReadAllQitems(STaosQueue *queue, STaosQall *qall) {
   int32_t numOfItems = 0;
-  bool    empty;
 
   taosThreadMutexLock(&queue->mutex);
-
-  empty = queue->head == NULL;
-  if (!empty) {
-    memset(qall, 0, sizeof(STaosQall));
-    qall->current = queue->head;
-    qall->start = queue->head;
-    qall->numOfItems = queue->numOfItems;
-    qall->memOfItems = queue->memOfItems;
-
-    qall->unAccessedNumOfItems = queue->numOfItems;
-    qall->unAccessMemOfItems = queue->memOfItems;
-
-    numOfItems = qall->numOfItems;
-
-    queue->head = NULL;
-    queue->tail = NULL;
-    queue->numOfItems = 0;
-    queue->memOfItems = 0;
-    uTrace("read %d items from queue:%p, items:%d mem:%" PRId64, numOfItems, queue, queue->numOfItems,
-           queue->memOfItems);
-    if (queue->qset) atomic_sub_fetch_32(&queue->qset->numOfItems, qall->numOfItems);
-  }
-
+  numOfItems = taosQueuePopAllNodes(queue, qall);
   taosThreadMutexUnlock(&queue->mutex);
 
-  // if source queue is empty, we set destination qall to empty too.
-  if (empty) {
-    qall->current = NULL;
-    qall->start = NULL;
-    qall->numOfItems = 0;
+  if (numOfItems > 0) {
+    atomic_sub_fetch_32(&queue->numOfItems, numOfItems);
+    atomic_sub_fetch_64(&queue->memOfItems, qall->memOfItems);
+    STaosQset *qset = atomic_load_ptr(&queue->qset);
+    if (qset) atomic_sub_fetch_32(&qset->numOfItems, numOfItems);
+    uTrace("read %d items from queue:%p, items:%d mem:%" PRId64, numOfItems, queue,
+           atomic_load_32(&queue->numOfItems), atomic_load_64(&queue->memOfItems));
   }
+
   return numOfItems;
 }
 
@@ -300,6 +384,11 @@ STaosQset *taosOpenQset() {
 
   taosThreadMutexInit(&qset->mutex, NULL);
   tsem_init(&qset->sem, 0, 0);
+  // no spinning on a single core, the writers can not run meanwhile
+  float numOfCores = 0;
+  taosGetCpuCores(&numOfCores, false);
+  qset->semCount = 0;
+  qset->spinTimes = (numOfCores > 1) ? QSET_MIN_SPIN_TIMES : 0;
 
   uDebug("qset:%p is opened", qset);
   return qset;
@@ -314,7 +403,7 @@ void taosCloseQset(STaosQset *qset) {
     STaosQueue *queue = qset->head;
     qset->head = qset->head->next;
 
-    queue->qset = NULL;
+    atomic_store_ptr(&queue->qset, NULL);
     queue->next = NULL;
   }
   taosThreadMutexUnlock(&qset->mutex);
@@ -325,12 +414,12 @@ void taosCloseQset(STaosQset *qset) {
   uDebug("qset:%p is closed", qset);
 }
 
-// tsem_post 'qset->sem', so that reader threads waiting for it
+// post 'qset->sem', so that reader threads waiting for it
 // resumes execution and return, should only be used to signal the
 // thread to exit.
 void taosQsetThreadResume(STaosQset *qset) {
   uDebug("qset:%p, it will exit", qset);
-  tsem_post(&qset->sem);
+  taosQsetPost(qset);
 }
 
 int32_t taosAddIntoQset(STaosQset *qset, STaosQueue *queue, void *ahandle) {
@@ -343,10 +432,8 @@ int32_t taosAddIntoQset(STaosQset *qset, STaosQueue *queue, void *ahandle) {
   qset->head = queue;
   qset->numOfQueues++;
 
-  taosThreadMutexLock(&queue->mutex);
-  atomic_add_fetch_32(&qset->numOfItems, queue->numOfItems);
-  queue->qset = qset;
-  taosThreadMutexUnlock(&queue->mutex);
+  atomic_add_fetch_32(&qset->numOfItems, atomic_load_32(&queue->numOfItems));
+  atomic_store_ptr(&queue->qset, qset);
 
   taosThreadMutexUnlock(&qset->mutex);
 
@@ -382,8 +469,8 @@ void taosRemoveFromQset(STaosQset *qset, STaosQueue *queue) {
       qset->numOfQueues--;
 
       taosThreadMutexLock(&queue->mutex);
-      atomic_sub_fetch_32(&qset->numOfItems, queue->numOfItems);
-      queue->qset = NULL;
+      atomic_store_ptr(&queue->qset, NULL);
+      atomic_sub_fetch_32(&qset->numOfItems, atomic_load_32(&queue->numOfItems));
       queue->next = NULL;
       taosThreadMutexUnlock(&queue->mutex);
     }
@@ -398,7 +485,7 @@ int32_t taosReadQitemFromQset(STaosQset *qset, void **ppItem, SQueueInfo *qinfo)
   STaosQnode *pNode = NULL;
   int32_t     code = 0;
 
-  tsem_wait(&qset->sem);
+  taosQsetWait(qset);
 
   taosThreadMutexLock(&qset->mutex);
 
@@ -407,30 +494,27 @@ int32_t taosReadQitemFromQset(STaosQset *qset, void **ppItem, SQueueInfo *qinfo)
     STaosQueue *queue = qset->current;
     if (queue) qset->current = queue->next;
     if (queue == NULL) break;
-    if (queue->head == NULL) continue;
+    if (taosQueueNoNode(queue)) continue;
 
     taosThreadMutexLock(&queue->mutex);
+    pNode = taosQueuePopNode(queue);
+    taosThreadMutexUnlock(&queue->mutex);
 
-    if (queue->head) {
-      pNode = queue->head;
+    if (pNode) {
       *ppItem = pNode->item;
       qinfo->ahandle = queue->ahandle;
       qinfo->fp = queue->itemFp;
       qinfo->queue = queue;
       qinfo->timestamp = pNode->timestamp;
 
-      queue->head = pNode->next;
-      if (queue->head == NULL) queue->tail = NULL;
-      // queue->numOfItems--;
-      queue->memOfItems -= (pNode->size + pNode->dataSize);
+      // queue->numOfItems is decreased by taosUpdateItemSize after the item is processed
+      int64_t memOfItems = atomic_sub_fetch_64(&queue->memOfItems, pNode->size + pNode->dataSize);
       atomic_sub_fetch_32(&qset->numOfItems, 1);
       code = 1;
-      uTrace("item:%p is read out from queue:%p, items:%d mem:%" PRId64, *ppItem, queue, queue->numOfItems - 1,
-             queue->memOfItems);
+      uTrace("item:%p is read out from queue:%p, items:%d mem:%" PRId64, *ppItem, queue,
+             atomic_load_32(&queue->numOfItems) - 1, memOfItems);
+      break;
     }
-
-    taosThreadMutexUnlock(&queue->mutex);
-    if (pNode) break;
   }
 
   taosThreadMutexUnlock(&qset->mutex);
@@ -442,7 +526,7 @@ int32_t taosReadAllQitemsFromQset(STaosQset *qset, STaosQall *qall, SQueueInfo *
   STaosQueue *queue;
   int32_t     code = 0;
 
-  tsem_wait(&qset->sem);
+  taosQsetWait(qset);
   taosThreadMutexLock(&qset->mutex);
 
   for (int32_t i = 0; i < qset->numOfQueues; ++i) {
@@ -450,36 +534,27 @@ int32_t taosReadAllQitemsFromQset(STaosQset *qset, STaosQall *qall, SQueueInfo *
     queue = qset->current;
     if (queue) qset->current = queue->next;
     if (queue == NULL) break;
-    if (queue->head == NULL) continue;
+    if (taosQueueNoNode(queue)) continue;
 
     taosThreadMutexLock(&queue->mutex);
+    code = taosQueuePopAllNodes(queue, qall);
+    taosThreadMutexUnlock(&queue->mutex);
 
-    if (queue->head) {
-      qall->current = queue->head;
-      qall->start = queue->head;
-      qall->numOfItems = queue->numOfItems;
-      qall->memOfItems = queue->memOfItems;
-
-      code = qall->numOfItems;
+    if (code != 0) {
       qinfo->ahandle = queue->ahandle;
       qinfo->fp = queue->itemsFp;
       qinfo->queue = queue;
 
-      queue->head = NULL;
-      queue->tail = NULL;
-      // queue->numOfItems = 0;
-      queue->memOfItems = 0;
-      uTrace("read %d items from queue:%p, items:0 mem:%" PRId64, code, queue, queue->memOfItems);
+      // queue->numOfItems is decreased by taosUpdateItemSize after the items are processed
+      atomic_sub_fetch_64(&queue->memOfItems, qall->memOfItems);
+      uTrace("read %d items from queue:%p, items:0 mem:%" PRId64, code, queue, atomic_load_64(&queue->memOfItems));
 
       atomic_sub_fetch_32(&qset->numOfItems, qall->numOfItems);
       for (int32_t j = 1; j < qall->numOfItems; ++j) {
-        tsem_wait(&qset->sem);
+        taosQsetWait(qset);
       }
+      break;
     }
-
-    taosThreadMutexUnlock(&queue->mutex);
-
-    if (code != 0) break;
   }
 
   taosThreadMutexUnlock(&qset->mutex);
@@ -268,6 +268,365 @@ void tAutoQWorkerFreeQueue(SAutoQWorkerPool *pool, STaosQueue *queue) {
   taosCloseQueue(queue);
 }
 
+#define STEAL_WORKER_HIGH_BURST 8  // a low class item is preferred after so many high class ones
+
+static threadlocal SStealWorker *tsStealWorker = NULL;
+
+static int32_t tStealWorkerHistIdx(int64_t val) {
+  int32_t idx = 0;
+  while (val > 1 && idx < STEAL_WORKER_HIST - 1) {
+    val >>= 1;
+    idx++;
+  }
+  return idx;
+}
+
+static SStealWorkerSvc *tStealWorkerGetSvc(SStealWorkerPool *pool, int64_t key) {
+  uint64_t hash = ((uint64_t)key * 0x9E3779B97F4A7C15ULL) >> 32;
+  return &pool->svc[hash % STEAL_WORKER_SVC_SIZE];
+}
+
+// a key that shares its slot with another key may be misclassified for a while, its items are never lost
+static int32_t tStealWorkerClassify(SStealWorkerPool *pool, int64_t key) {
+  if (pool->demoteUs <= 0 || key == 0) return STEAL_WORKER_HIGH;
+
+  SStealWorkerSvc *pSvc = tStealWorkerGetSvc(pool, key);
+  if (atomic_load_64(&pSvc->key) == key && atomic_load_64(&pSvc->usedUs) >= pool->demoteUs) {
+    return STEAL_WORKER_LOW;
+  }
+  return STEAL_WORKER_HIGH;
+}
+
+static void tStealWorkerCharge(SStealWorkerPool *pool, int64_t key, int64_t elapsedUs) {
+  if (pool->demoteUs <= 0 || key == 0) return;
+
+  SStealWorkerSvc *pSvc = tStealWorkerGetSvc(pool, key);
+  int64_t          oldKey = atomic_load_64(&pSvc->key);
+  if (oldKey == key) {
+    atomic_add_fetch_64(&pSvc->usedUs, elapsedUs);
+  } else if (atomic_val_compare_exchange_64(&pSvc->key, oldKey, key) == oldKey) {
+    atomic_store_64(&pSvc->usedUs, elapsedUs);
+  }
+}
+
+static void tStealRunqPush(SStealRunQueue *runq, STaosQnode *pNode) {
+  pNode->next = NULL;
+  if (runq->tail) {
+    runq->tail->next = pNode;
+  } else {
+    runq->head = pNode;
+  }
+  runq->tail = pNode;
+  atomic_add_fetch_32(&runq->num, 1);
+}
+
+static STaosQnode *tStealRunqPop(SStealWorker *worker, int32_t cls) {
+  SStealRunQueue *runq = &worker->runq[cls];
+  if (atomic_load_32(&runq->num) <= 0) return NULL;
+
+  taosThreadMutexLock(&worker->mutex);
+  STaosQnode *pNode = runq->head;
+  if (pNode) {
+    runq->head = pNode->next;
+    if (runq->head == NULL) runq->tail = NULL;
+    atomic_sub_fetch_32(&runq->num, 1);
+  }
+  taosThreadMutexUnlock(&worker->mutex);
+
+  return pNode;
+}
+
+// own run queue first, then steal the oldest item of another worker, the high class goes before the low class
+static STaosQnode *tStealWorkerTake(SStealWorker *worker, int32_t *pCls) {
+  SStealWorkerPool *pool = worker->pool;
+  int32_t           order[STEAL_WORKER_CLASSES] = {STEAL_WORKER_HIGH, STEAL_WORKER_LOW};
+
+  if (worker->highBurst >= STEAL_WORKER_HIGH_BURST) {
+    order[0] = STEAL_WORKER_LOW;
+    order[1] = STEAL_WORKER_HIGH;
+  }
+
+  for (int32_t i = 0; i < STEAL_WORKER_CLASSES; ++i) {
+    int32_t     cls = order[i];
+    STaosQnode *pNode = tStealRunqPop(worker, cls);
+
+    for (int32_t j = 1; pNode == NULL && j < pool->num; ++j) {
+      pNode = tStealRunqPop(pool->workers + (worker->id + j) % pool->num, cls);
+      if (pNode) atomic_add_fetch_64(&worker->stat.numOfSteals, 1);
+    }
+
+    if (pNode) {
+      worker->highBurst = (cls == STEAL_WORKER_HIGH) ? worker->highBurst + 1 : 0;
+      atomic_sub_fetch_32(&pool->numOfItems, 1);
+      *pCls = cls;
+      return pNode;
+    }
+  }
+
+  return NULL;
+}
+
+static bool tStealWorkerPark(SStealWorker *worker) {
+  SStealWorkerPool *pool = worker->pool;
+  bool              stop = false;
+
+  taosThreadMutexLock(&pool->mutex);
+  atomic_add_fetch_32(&pool->numOfIdle, 1);
+  while (atomic_load_32(&pool->numOfItems) <= 0 && !pool->stop) {
+    taosThreadCondWait(&pool->cond, &pool->mutex);
+  }
+  atomic_sub_fetch_32(&pool->numOfIdle, 1);
+  stop = pool->stop && atomic_load_32(&pool->numOfItems) <= 0;
+  taosThreadMutexUnlock(&pool->mutex);
+
+  return stop;
+}
+
+static void *tStealWorkerThreadFp(SStealWorker *worker) {
+  SStealWorkerPool *pool = worker->pool;
+  SQueueInfo        qinfo = {0};
+
+  taosBlockSIGPIPE();
+  setThreadName(pool->name);
+  worker->pid = taosGetSelfPthreadId();
+  tsStealWorker = worker;
+  uInfo("worker:%s:%d is running, thread:%08" PRId64, pool->name, worker->id, worker->pid);
+
+  while (1) {
+    int32_t     cls = STEAL_WORKER_HIGH;
+    STaosQnode *pNode = tStealWorkerTake(worker, &cls);
+    if (pNode == NULL) {
+      if (tStealWorkerPark(worker)) {
+        uInfo("worker:%s:%d got no message and exiting, thread:%08" PRId64, pool->name, worker->id, worker->pid);
+        break;
+      }
+      continue;
+    }
+
+    STaosQueue *queue = pNode->queue;
+    int64_t     key = pool->keyFp ? (*pool->keyFp)(pNode->item) : 0;
+    int64_t     startUs = taosGetTimestampUs();
+
+    atomic_add_fetch_64(&worker->stat.waitHist[cls][tStealWorkerHistIdx(startUs - pNode->timestamp)], 1);
+    atomic_sub_fetch_64(&queue->memOfItems, pNode->size + pNode->dataSize);
+
+    if (queue->itemFp != NULL) {
+      qinfo.ahandle = queue->ahandle;
+      qinfo.fp = queue->itemFp;
+      qinfo.queue = queue;
+      qinfo.timestamp = pNode->timestamp;
+      qinfo.workerId = worker->id;
+      qinfo.threadNum = pool->num;
+      (*queue->itemFp)(&qinfo, pNode->item);
+    }
+
+    int64_t elapsedUs = taosGetTimestampUs() - startUs;
+    tStealWorkerCharge(pool, key, elapsedUs);
+    atomic_add_fetch_64(&worker->stat.busyUs, elapsedUs);
+    atomic_add_fetch_64(&worker->stat.numOfItems, 1);
+
+    // the queue may be freed once it is empty
+    taosUpdateItemSize(queue, 1);
+  }
+
+  tsStealWorker = NULL;
+  destroyThreadLocalGeosCtx();
+
+  return NULL;
+}
+
+int32_t tStealWorkerInit(SStealWorkerPool *pool) {
+  int32_t max = TMAX(pool->num, 1);
+
+  pool->workers = taosMemoryCalloc(max, sizeof(SStealWorker));
+  if (pool->workers == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return -1;
+  }
+  pool->max = max;
+
+  (void)taosThreadMutexInit(&pool->mutex, NULL);
+  (void)taosThreadCondInit(&pool->cond, NULL);
+  pool->numOfIdle = 0;
+  pool->numOfItems = 0;
+  pool->nextId = 0;
+  pool->stop = 0;
+  memset(pool->svc, 0, sizeof(pool->svc));
+
+  for (int32_t i = 0; i < max; ++i) {
+    SStealWorker *worker = pool->workers + i;
+    worker->id = i;
+    worker->pool = pool;
+    (void)taosThreadMutexInit(&worker->mutex, NULL);
+  }
+
+  // workers steal from each other, so all of them are started up front
+  for (pool->num = 0; pool->num < max; pool->num++) {
+    SStealWorker *worker = pool->workers + pool->num;
+
+    TdThreadAttr thAttr;
+    taosThreadAttrInit(&thAttr);
+    taosThreadAttrSetDetachState(&thAttr, PTHREAD_CREATE_JOINABLE);
+    if (taosThreadCreate(&worker->thread, &thAttr, (ThreadFp)tStealWorkerThreadFp, worker) != 0) {
+      uError("worker:%s:%d failed to create thread, total:%d", pool->name, worker->id, pool->num);
+      taosThreadAttrDestroy(&thAttr);
+      terrno = TSDB_CODE_OUT_OF_MEMORY;
+      return -1;
+    }
+    taosThreadAttrDestroy(&thAttr);
+    uInfo("worker:%s:%d is launched, total:%d", pool->name, worker->id, max);
+  }
+
+  uInfo("worker:%s is initialized as stealing, num:%d demote:%" PRId64 "us", pool->name, pool->num, pool->demoteUs);
+  return 0;
+}
+
+void tStealWorkerCleanup(SStealWorkerPool *pool) {
+  if (pool->workers == NULL) return;
+
+  taosThreadMutexLock(&pool->mutex);
+  pool->stop = 1;
+  taosThreadCondBroadcast(&pool->cond);
+  taosThreadMutexUnlock(&pool->mutex);
+
+  for (int32_t i = 0; i < pool->num; ++i) {
+    SStealWorker *worker = pool->workers + i;
+    if (taosCheckPthreadValid(worker->thread)) {
+      uInfo("worker:%s:%d is stopping", pool->name, worker->id);
+      taosThreadJoin(worker->thread, NULL);
+      taosThreadClear(&worker->thread);
+      uInfo("worker:%s:%d is stopped", pool->name, worker->id);
+    }
+  }
+
+  tStealWorkerReport(pool);
+
+  // workers whose thread failed to start still have their mutex initialized
+  for (int32_t i = 0; i < pool->max; ++i) {
+    taosThreadMutexDestroy(&pool->workers[i].mutex);
+  }
+
+  taosMemoryFreeClear(pool->workers);
+  pool->num = 0;
+  pool->max = 0;
+  taosThreadCondDestroy(&pool->cond);
+  taosThreadMutexDestroy(&pool->mutex);
+
+  uInfo("worker:%s is closed", pool->name);
+}
+
+STaosQueue *tStealWorkerAllocQueue(SStealWorkerPool *pool, void *ahandle, FItem fp) {
+  STaosQueue *queue = taosOpenQueue();
+  if (queue == NULL) return NULL;
+
+  taosSetQueueFp(queue, fp, NULL);
+  queue->ahandle = ahandle;
+
+  uInfo("worker:%s, queue:%p is allocated, ahandle:%p", pool->name, queue, ahandle);
+  return queue;
+}
+
+void tStealWorkerFreeQueue(SStealWorkerPool *pool, STaosQueue *queue) {
+  uInfo("worker:%s, queue:%p is freed", pool->name, queue);
+  taosCloseQueue(queue);
+}
+
+static SStealWorker *tStealWorkerPick(SStealWorkerPool *pool) {
+  // items put by a worker of the pool stay on it, others go to the less loaded one of two candidates
+  SStealWorker *worker = tsStealWorker;
+  if (worker != NULL && worker->pool == pool) return worker;
+
+  uint32_t      id = (uint32_t)atomic_fetch_add_32(&pool->nextId, 1);
+  SStealWorker *first = pool->workers + id % pool->num;
+  SStealWorker *second = pool->workers + taosRand() % pool->num;
+  int32_t       firstLoad = atomic_load_32(&first->runq[0].num) + atomic_load_32(&first->runq[1].num);
+  int32_t       secondLoad = atomic_load_32(&second->runq[0].num) + atomic_load_32(&second->runq[1].num);
+
+  return (secondLoad < firstLoad) ? second : first;
+}
+
+int32_t tStealWorkerWriteQitem(SStealWorkerPool *pool, STaosQueue *queue, void *pItem) {
+  STaosQnode *pNode = (STaosQnode *)(((char *)pItem) - sizeof(STaosQnode));
+  int64_t     key = pool->keyFp ? (*pool->keyFp)(pItem) : 0;
+  int32_t     cls = tStealWorkerClassify(pool, key);
+
+  pNode->queue = queue;
+  atomic_add_fetch_64(&queue->memOfItems, pNode->size + pNode->dataSize);
+  atomic_add_fetch_32(&queue->numOfItems, 1);
+
+  SStealWorker *worker = tStealWorkerPick(pool);
+  taosThreadMutexLock(&worker->mutex);
+  tStealRunqPush(&worker->runq[cls], pNode);
+  taosThreadMutexUnlock(&worker->mutex);
+
+  // the parked workers check numOfItems with pool->mutex held, so the signal is never lost
+  atomic_add_fetch_32(&pool->numOfItems, 1);
+  if (atomic_load_32(&pool->numOfIdle) > 0) {
+    taosThreadMutexLock(&pool->mutex);
+    taosThreadCondSignal(&pool->cond);
+    taosThreadMutexUnlock(&pool->mutex);
+  }
+
+  uTrace("item:%p is put into worker:%s:%d, class:%d key:0x%" PRIx64, pItem, pool->name, worker->id, cls, key);
+  return 0;
+}
+
+void tStealWorkerGetStat(SStealWorkerPool *pool, int32_t workerId, SStealWorkerStat *pStat) {
+  memset(pStat, 0, sizeof(SStealWorkerStat));
+  if (workerId < 0 || workerId >= pool->num) return;
+
+  SStealWorkerStat *pSrc = &pool->workers[workerId].stat;
+  pStat->busyUs = atomic_load_64(&pSrc->busyUs);
+  pStat->numOfItems = atomic_load_64(&pSrc->numOfItems);
+  pStat->numOfSteals = atomic_load_64(&pSrc->numOfSteals);
+  for (int32_t c = 0; c < STEAL_WORKER_CLASSES; ++c) {
+    for (int32_t i = 0; i < STEAL_WORKER_HIST; ++i) {
+      pStat->waitHist[c][i] = atomic_load_64(&pSrc->waitHist[c][i]);
+    }
+  }
+}
+
+void tStealWorkerGetPoolStat(SStealWorkerPool *pool, SStealWorkerPoolStat *pStat) {
+  memset(pStat, 0, sizeof(SStealWorkerPoolStat));
+  pStat->numOfWorkers = pool->num;
+  pStat->numOfQueued = TMAX(atomic_load_32(&pool->numOfItems), 0);
+
+  for (int32_t w = 0; w < pool->num; ++w) {
+    SStealWorkerStat stat;
+    tStealWorkerGetStat(pool, w, &stat);
+    pStat->stat.busyUs += stat.busyUs;
+    pStat->stat.numOfItems += stat.numOfItems;
+    pStat->stat.numOfSteals += stat.numOfSteals;
+    for (int32_t c = 0; c < STEAL_WORKER_CLASSES; ++c) {
+      for (int32_t i = 0; i < STEAL_WORKER_HIST; ++i) {
+        pStat->stat.waitHist[c][i] += stat.waitHist[c][i];
+      }
+    }
+  }
+}
+
+void tStealWorkerReport(SStealWorkerPool *pool) {
+  for (int32_t w = 0; w < pool->num; ++w) {
+    SStealWorkerStat stat;
+    char             wait[STEAL_WORKER_CLASSES][256] = {0};
+
+    tStealWorkerGetStat(pool, w, &stat);
+    if (stat.numOfItems == 0) continue;
+
+    for (int32_t c = 0; c < STEAL_WORKER_CLASSES; ++c) {
+      int32_t len = 0;
+      for (int32_t i = 0; i < STEAL_WORKER_HIST && len < sizeof(wait[c]); ++i) {
+        len += snprintf(wait[c] + len, sizeof(wait[c]) - len, "%s%" PRId64, i ? "," : "", stat.waitHist[c][i]);
+      }
+    }
+
+    uDebug("worker:%s:%d, items:%" PRId64 " steals:%" PRId64 " busy:%" PRId64
+           "us wait us(log2) high:[%s] low:[%s]",
+           pool->name, w, stat.numOfItems, stat.numOfSteals, stat.busyUs, wait[STEAL_WORKER_HIGH],
+           wait[STEAL_WORKER_LOW]);
+  }
+}
+
 int32_t tWWorkerInit(SWWorkerPool *pool) {
   pool->nextId = 0;
   pool->workers = taosMemoryCalloc(pool->max, sizeof(SWWorker));
@@ -330,6 +689,10 @@ static void *tWWorkerThreadFp(SWWorker *worker) {
   worker->pid = taosGetSelfPthreadId();
   uInfo("worker:%s:%d is running, thread:%08" PRId64, pool->name, worker->id, worker->pid);
 
+  if (pool->bindNuma && taosSetThreadNumaNode(pool->numaNode) != 0) {
+    uWarn("worker:%s:%d failed to bind to numa node:%d since %s", pool->name, worker->id, pool->numaNode, terrstr());
+  }
+
   while (1) {
     numOfMsgs = taosReadAllQitemsFromQset(worker->qset, worker->qall, &qinfo);
     if (numOfMsgs == 0) {
@@ -435,6 +798,8 @@ int32_t tMultiWorkerInit(SMultiWorker *pWorker, const SMultiWorkerCfg *pCfg) {
   SWWorkerPool *pPool = &pWorker->pool;
   pPool->name = pCfg->name;
   pPool->max = pCfg->max;
+  pPool->bindNuma = pCfg->bindNuma;
+  pPool->numaNode = pCfg->numaNode;
   if (tWWorkerInit(pPool) != 0) return -1;
 
   pWorker->queue = tWWorkerAllocQueue(pPool, pCfg->param, pCfg->fp);
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include "taoserror.h"
+#include "tmempool.h"
+
+TEST(memClassPoolTest, reuse) {
+  mcpool_h pool = taosMemClassPoolInit(1024 * 1024);
+  ASSERT_TRUE(pool != NULL);
+
+  void* p1 = taosMemClassPoolMalloc(pool, 1000);
+  ASSERT_TRUE(p1 != NULL);
+  ASSERT_EQ(((uint64_t)p1) & (MEM_CLASS_POOL_ALIGN - 1), 0);
+  ASSERT_GE(taosMemClassPoolUsed(pool), 1000);
+
+  taosMemClassPoolFree(p1);
+  ASSERT_EQ(taosMemClassPoolUsed(pool), 0);
+
+  // the freed buffer is handed out again to a request of the same size class
+  void* p2 = taosMemClassPoolMalloc(pool, 900);
+  ASSERT_EQ(p1, p2);
+
+  void* p3 = taosMemClassPoolMalloc(pool, 100 * 1024);
+  ASSERT_TRUE(p3 != NULL);
+  ASSERT_GE(taosMemClassPoolPeak(pool), 900 + 100 * 1024);
+
+  taosMemClassPoolFree(p2);
+  taosMemClassPoolFree(p3);
+  ASSERT_EQ(taosMemClassPoolUsed(pool), 0);
+  taosMemClassPoolCleanUp(pool);
+}
+
+TEST(memClassPoolTest, current) {
+  mcpool_h pool = taosMemClassPoolInit(1024 * 1024);
+  ASSERT_TRUE(taosMemClassPoolCurrent() == NULL);
+
+  mcpool_h prev = taosMemClassPoolSwitch(pool);
+  ASSERT_TRUE(prev == NULL);
+  ASSERT_TRUE(taosMemClassPoolCurrent() == pool);
+
+  taosMemClassPoolSwitch(prev);
+  ASSERT_TRUE(taosMemClassPoolCurrent() == NULL);
+
+  // no pool, the buffer is allocated and released directly
+  void* p = taosMemClassPoolMalloc(NULL, 64);
+  ASSERT_TRUE(p != NULL);
+  taosMemClassPoolFree(p);
+
+  taosMemClassPoolCleanUp(pool);
+}
+
+namespace {
+
+typedef struct {
+  int64_t limit;
+  int64_t used;
+} SBudget;
+
+bool reserveBudget(void* param, int64_t size, bool spillable) {
+  SBudget* pBudget = (SBudget*)param;
+  int64_t  limit = spillable ? pBudget->limit / 2 : pBudget->limit;
+  if (pBudget->used + size > limit) {
+    return false;
+  }
+  pBudget->used += size;
+  return true;
+}
+
+void releaseBudget(void* param, int64_t size) { ((SBudget*)param)->used -= size; }
+
+}  // namespace
+
+TEST(memClassPoolTest, budget) {
+  SBudget  budget = {.limit = 64 * 1024, .used = 0};
+  mcpool_h pool = taosMemClassPoolInit(1024 * 1024);
+  taosMemClassPoolSetCtrl(pool, reserveBudget, releaseBudget, &budget);
+
+  void* p1 = taosMemClassPoolMalloc(pool, 16 * 1024);
+  ASSERT_TRUE(p1 != NULL);
+  ASSERT_EQ(budget.used, taosMemClassPoolUsed(pool));
+
+  // spillable memory is refused before the budget is used up
+  ASSERT_FALSE(taosMemClassPoolReserve(pool, 32 * 1024, true));
+  ASSERT_TRUE(taosMemClassPoolReserve(pool, 32 * 1024, false));
+
+  // the allocation beyond the budget fails
+  void* p2 = taosMemClassPoolMalloc(pool, 32 * 1024);
+  ASSERT_TRUE(p2 == NULL);
+  ASSERT_EQ(terrno, TSDB_CODE_QRY_NOT_ENOUGH_BUFFER);
+
+  taosMemClassPoolRelease(pool, 32 * 1024);
+  taosMemClassPoolFree(p1);
+  ASSERT_EQ(budget.used, 0);
+
+  // the memory still in use is given back at cleanup, the buffer is released later without the owner
+  p1 = taosMemClassPoolMalloc(pool, 16 * 1024);
+  ASSERT_GT(budget.used, 0);
+  taosMemClassPoolCleanUp(pool);
+  ASSERT_EQ(budget.used, 0);
+  budget.used = 1;
+  taosMemClassPoolFree(p1);
+  ASSERT_EQ(budget.used, 1);
+}
+
+namespace {
+
+typedef struct {
+  mcpool_h pool;
+  void*    p;
+} SFreeArg;
+
+void* freeInOtherPool(void* param) {
+  SFreeArg* pArg = (SFreeArg*)param;
+  mcpool_h  prev = taosMemClassPoolSwitch(pArg->pool);
+  taosMemClassPoolFree(pArg->p);
+  taosMemClassPoolSwitch(prev);
+  return NULL;
+}
+
+}  // namespace
+
+TEST(memClassPoolTest, crossThreadFree) {
+  mcpool_h pool = taosMemClassPoolInit(1024 * 1024);
+  mcpool_h other = taosMemClassPoolInit(1024 * 1024);
+
+  void* p1 = taosMemClassPoolMalloc(pool, 4096);
+  ASSERT_TRUE(p1 != NULL);
+  void* p2 = taosMemClassPoolMalloc(other, 4096);
+  ASSERT_TRUE(p2 != NULL);
+
+  // the buffer goes back to the pool it comes from, not to the pool of the releasing thread
+  SFreeArg arg = {.pool = other, .p = p1};
+  TdThread thread;
+  ASSERT_EQ(taosThreadCreate(&thread, NULL, freeInOtherPool, &arg), 0);
+  taosThreadJoin(thread, NULL);
+
+  ASSERT_EQ(taosMemClassPoolUsed(pool), 0);
+  ASSERT_EQ(taosMemClassPoolUsed(other), 4096);
+  ASSERT_EQ(taosMemClassPoolMalloc(pool, 4096), p1);
+  void* p3 = taosMemClassPoolMalloc(other, 4096);
+  ASSERT_NE(p3, p1);
+
+  // a pool cleaned up with buffers in use lives until the last of them is released
+  taosMemClassPoolCleanUp(pool);
+  taosMemClassPoolCleanUp(other);
+  taosMemClassPoolFree(p1);
+  taosMemClassPoolFree(p2);
+  taosMemClassPoolFree(p3);
+}
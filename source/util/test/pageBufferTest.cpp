@@ -220,6 +220,49 @@ void testFlushAndReadBackBuffer() {
   taosMemoryFree(rowData);
 }
 
+// pages are flushed in the background and read back one by one
+void sequentialReadBackTest() {
+  SDiskbasedBuf* pBuf = NULL;
+  int32_t        ret = createDiskbasedBuf(&pBuf, 1024, 4 * 1024, "5", TD_TMP_DIR_PATH);
+  ASSERT_EQ(ret, 0);
+
+  const int32_t numOfPages = 64;
+  for (int32_t i = 0; i < numOfPages; ++i) {
+    int32_t    pageId = -1;
+    SFilePage* pPg = (SFilePage*)getNewBufPage(pBuf, &pageId);
+    ASSERT_TRUE(pPg != NULL);
+    ASSERT_EQ(pageId, i);
+
+    int32_t* pData = (int32_t*)pPg->data;
+    for (int32_t j = 0; j < 1024 / sizeof(int32_t) - 4; ++j) {
+      pData[j] = i * 10 + (j % 10);
+    }
+    pPg->num = i;
+
+    setBufPageDirty(pPg, true);
+    releaseBufPage(pBuf, pPg);
+  }
+
+  for (int32_t i = 0; i < numOfPages; ++i) {
+    SFilePage* pPg = (SFilePage*)getBufPage(pBuf, i);
+    ASSERT_TRUE(pPg != NULL);
+    ASSERT_EQ(pPg->num, i);
+
+    int32_t* pData = (int32_t*)pPg->data;
+    for (int32_t j = 0; j < 1024 / sizeof(int32_t) - 4; ++j) {
+      ASSERT_EQ(pData[j], i * 10 + (j % 10));
+    }
+    releaseBufPage(pBuf, pPg);
+  }
+
+  SDiskbasedBufStatis st = getDBufStatis(pBuf);
+  ASSERT_GT(st.flushPages, 0);
+  ASSERT_GT(st.rawFlushBytes, st.flushBytes);
+  ASSERT_LE(st.readAheadHits, st.readAheadPages);
+
+  destroyDiskbasedBuf(pBuf);
+}
+
 }  // namespace
 
 TEST(testCase, resultBufferTest) {
@@ -228,6 +271,7 @@ TEST(testCase, resultBufferTest) {
   writeDownTest();
   recyclePageTest();
   testFlushAndReadBackBuffer();
+  sequentialReadBackTest();
 }
 
 #pragma GCC diagnostic pop
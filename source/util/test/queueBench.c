@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Microbenchmark of the queue/qset: writer threads put small items into the queues of a qset, reader threads take
+ * them out as the worker pools do. The same load is put on a queue protected by a mutex and a semaphore, as the
+ * queue/qset used to be, for comparison.
+ *
+ * usage: queueBench [-w writers] [-r readers] [-q queues] [-n items per writer] [-b, read in batch]
+ *
+ * In batch mode the qset is read by one thread, as the write worker pools do.
+ */
+
+#include "os.h"
+#include "taoserror.h"
+#include "tqueue.h"
+
+typedef struct SLockedNode {
+  struct SLockedNode *next;
+  int64_t             value;
+} SLockedNode;
+
+typedef struct {
+  TdThreadMutex mutex;
+  tsem_t        sem;
+  SLockedNode  *head;
+  SLockedNode  *tail;
+  int32_t       numOfItems;
+} SLockedQueue;
+
+typedef struct {
+  int32_t       writers;
+  int32_t       readers;
+  int32_t       queues;
+  int64_t       items;
+  bool          batch;
+  STaosQset    *qset;
+  STaosQueue  **pQueues;
+  SLockedQueue  locked;
+  int64_t       numOfRead;
+} SBenchParam;
+
+typedef struct {
+  SBenchParam *param;
+  int32_t      idx;
+} SBenchThread;
+
+static void lockedWrite(SLockedQueue *pQueue, SLockedNode *pNode) {
+  pNode->next = NULL;
+  taosThreadMutexLock(&pQueue->mutex);
+  if (pQueue->tail) {
+    pQueue->tail->next = pNode;
+  } else {
+    pQueue->head = pNode;
+  }
+  pQueue->tail = pNode;
+  pQueue->numOfItems++;
+  taosThreadMutexUnlock(&pQueue->mutex);
+  tsem_post(&pQueue->sem);
+}
+
+static SLockedNode *lockedRead(SLockedQueue *pQueue) {
+  tsem_wait(&pQueue->sem);
+  taosThreadMutexLock(&pQueue->mutex);
+  SLockedNode *pNode = pQueue->head;
+  if (pNode) {
+    pQueue->head = pNode->next;
+    if (pQueue->head == NULL) pQueue->tail = NULL;
+    pQueue->numOfItems--;
+  }
+  taosThreadMutexUnlock(&pQueue->mutex);
+  return pNode;
+}
+
+static void *lockedWriteFp(void *arg) {
+  SBenchThread *pThread = arg;
+  SBenchParam  *param = pThread->param;
+  for (int64_t i = 0; i < param->items; ++i) {
+    SLockedNode *pNode = taosMemoryMalloc(sizeof(SLockedNode));
+    pNode->value = i;
+    lockedWrite(&param->locked, pNode);
+  }
+  return NULL;
+}
+
+static void *lockedReadFp(void *arg) {
+  SBenchThread *pThread = arg;
+  SBenchParam  *param = pThread->param;
+  while (1) {
+    SLockedNode *pNode = lockedRead(&param->locked);
+    if (pNode == NULL) break;
+    taosMemoryFree(pNode);
+    atomic_add_fetch_64(&param->numOfRead, 1);
+  }
+  return NULL;
+}
+
+static void *qsetWriteFp(void *arg) {
+  SBenchThread *pThread = arg;
+  SBenchParam  *param = pThread->param;
+  STaosQueue   *queue = param->pQueues[pThread->idx % param->queues];
+  for (int64_t i = 0; i < param->items; ++i) {
+    int64_t *pItem = taosAllocateQitem(sizeof(int64_t), DEF_QITEM, 0);
+    *pItem = i;
+    while (taosWriteQitem(queue, pItem) != 0) {
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+static void *qsetReadFp(void *arg) {
+  SBenchThread *pThread = arg;
+  SBenchParam  *param = pThread->param;
+  STaosQall    *qall = taosAllocateQall();
+  SQueueInfo    qinfo = {0};
+  void         *pItem = NULL;
+
+  while (1) {
+    if (param->batch) {
+      int32_t num = taosReadAllQitemsFromQset(param->qset, qall, &qinfo);
+      if (num == 0) break;
+      for (int32_t i = 0; i < num; ++i) {
+        taosGetQitem(qall, &pItem);
+        taosFreeQitem(pItem);
+      }
+      taosUpdateItemSize(qinfo.queue, num);
+      atomic_add_fetch_64(&param->numOfRead, num);
+    } else {
+      if (taosReadQitemFromQset(param->qset, &pItem, &qinfo) == 0) break;
+      taosFreeQitem(pItem);
+      taosUpdateItemSize(qinfo.queue, 1);
+      atomic_add_fetch_64(&param->numOfRead, 1);
+    }
+  }
+
+  taosFreeQall(qall);
+  return NULL;
+}
+
+static double runBench(SBenchParam *param, void *(*writeFp)(void *), void *(*readFp)(void *),
+                       void (*stopFp)(SBenchParam *)) {
+  int32_t       numOfThreads = param->writers + param->readers;
+  TdThread     *threads = taosMemoryCalloc(numOfThreads, sizeof(TdThread));
+  SBenchThread *args = taosMemoryCalloc(numOfThreads, sizeof(SBenchThread));
+  int64_t       total = param->items * param->writers;
+
+  param->numOfRead = 0;
+  int64_t start = taosGetTimestampUs();
+  for (int32_t i = 0; i < numOfThreads; ++i) {
+    args[i].param = param;
+    args[i].idx = (i < param->readers) ? i : i - param->readers;
+    taosThreadCreate(&threads[i], NULL, (i < param->readers) ? readFp : writeFp, &args[i]);
+  }
+
+  while (atomic_load_64(&param->numOfRead) < total) {
+    taosUsleep(100);
+  }
+  int64_t elapsed = taosGetTimestampUs() - start;
+
+  stopFp(param);
+  for (int32_t i = 0; i < numOfThreads; ++i) {
+    taosThreadJoin(threads[i], NULL);
+  }
+
+  taosMemoryFree(args);
+  taosMemoryFree(threads);
+  return total * 1000000.0 / TMAX(elapsed, 1);
+}
+
+static void lockedStop(SBenchParam *param) {
+  for (int32_t i = 0; i < param->readers; ++i) {
+    tsem_post(&param->locked.sem);
+  }
+}
+
+static void qsetStop(SBenchParam *param) {
+  for (int32_t i = 0; i < param->readers; ++i) {
+    taosQsetThreadResume(param->qset);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  SBenchParam param = {.writers = 4, .readers = 1, .queues = 1, .items = 1000000, .batch = false};
+
+  for (int32_t i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "-w") == 0 && i < argc - 1) {
+      param.writers = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-r") == 0 && i < argc - 1) {
+      param.readers = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-q") == 0 && i < argc - 1) {
+      param.queues = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-n") == 0 && i < argc - 1) {
+      param.items = atoll(argv[++i]);
+    } else if (strcmp(argv[i], "-b") == 0) {
+      param.batch = true;
+    } else {
+      printf("usage: %s [-w writers] [-r readers] [-q queues] [-n items per writer] [-b]\n", argv[0]);
+      return 0;
+    }
+  }
+
+  if (param.batch) {
+    param.readers = 1;
+  }
+
+  taosThreadMutexInit(&param.locked.mutex, NULL);
+  tsem_init(&param.locked.sem, 0, 0);
+  double lockedRate = runBench(&param, lockedWriteFp, lockedReadFp, lockedStop);
+  tsem_destroy(&param.locked.sem);
+  taosThreadMutexDestroy(&param.locked.mutex);
+
+  param.qset = taosOpenQset();
+  param.pQueues = taosMemoryCalloc(param.queues, sizeof(STaosQueue *));
+  for (int32_t i = 0; i < param.queues; ++i) {
+    param.pQueues[i] = taosOpenQueue();
+    taosAddIntoQset(param.qset, param.pQueues[i], NULL);
+  }
+  double qsetRate = runBench(&param, qsetWriteFp, qsetReadFp, qsetStop);
+  for (int32_t i = 0; i < param.queues; ++i) {
+    taosCloseQueue(param.pQueues[i]);
+  }
+  taosMemoryFree(param.pQueues);
+  taosCloseQset(param.qset);
+
+  printf("writers:%d readers:%d queues:%d items:%" PRId64 " batch:%d\n", param.writers, param.readers, param.queues,
+         param.items * param.writers, param.batch);
+  printf("mutex queue: %.0f items/s\n", lockedRate);
+  printf("qset       : %.0f items/s, %.2fx\n", qsetRate, qsetRate / lockedRate);
+  return 0;
+}
@@ -0,0 +1,323 @@
+#include <gtest/gtest.h>
+
+#include "os.h"
+#include "taoserror.h"
+#include "tqueue.h"
+#include "tworker.h"
+
+namespace {
+
+typedef struct {
+  STaosQueue *queue;
+  int32_t     items;
+} SWriterParam;
+
+void *writeItems(void *param) {
+  SWriterParam *pParam = (SWriterParam *)param;
+  for (int32_t i = 0; i < pParam->items; ++i) {
+    int32_t *pItem = (int32_t *)taosAllocateQitem(sizeof(int32_t), DEF_QITEM, 0);
+    *pItem = i;
+    taosWriteQitem(pParam->queue, pItem);
+  }
+  return NULL;
+}
+
+typedef struct {
+  STaosQueue *queue;
+  int32_t     id;
+  int32_t     items;
+  int32_t    *written;
+} SCountWriterParam;
+
+// the item is written by writer id, the writers count the items whose write is done
+void *writeCountItems(void *param) {
+  SCountWriterParam *pParam = (SCountWriterParam *)param;
+  for (int32_t i = 0; i < pParam->items; ++i) {
+    int32_t *pItem = (int32_t *)taosAllocateQitem(sizeof(int32_t), DEF_QITEM, 0);
+    *pItem = (pParam->id << 20) | i;
+    taosWriteQitem(pParam->queue, pItem);
+    atomic_add_fetch_32(pParam->written, 1);
+  }
+  return NULL;
+}
+
+typedef struct {
+  int64_t key;
+  int32_t sleepMs;
+  int32_t seq;
+} SStealItem;
+
+int32_t stealProcessed = 0;
+int8_t  stealGate = 0;
+int32_t stealOrder[8] = {0};
+
+int64_t getStealItemKey(void *pItem) { return ((SStealItem *)pItem)->key; }
+
+void processStealItem(SQueueInfo *pInfo, void *pItem) {
+  SStealItem *pSteal = (SStealItem *)pItem;
+  if (pSteal->sleepMs > 0) taosMsleep(pSteal->sleepMs);
+  while (pSteal->sleepMs < 0 && atomic_load_8(&stealGate) == 0) taosMsleep(1);
+  int32_t idx = atomic_fetch_add_32(&stealProcessed, 1);
+  if (idx < 8) stealOrder[idx] = pSteal->seq;
+  taosFreeQitem(pItem);
+}
+
+void writeStealItem(SStealWorkerPool *pool, STaosQueue *queue, int64_t key, int32_t sleepMs, int32_t seq) {
+  SStealItem *pItem = (SStealItem *)taosAllocateQitem(sizeof(SStealItem), DEF_QITEM, 0);
+  pItem->key = key;
+  pItem->sleepMs = sleepMs;
+  pItem->seq = seq;
+  ASSERT_EQ(tStealWorkerWriteQitem(pool, queue, pItem), 0);
+}
+
+typedef struct {
+  SStealWorkerPool *pool;
+  STaosQueue       *queue;
+  int32_t           items;
+} SStealWriterParam;
+
+void *writeStealItems(void *param) {
+  SStealWriterParam *pParam = (SStealWriterParam *)param;
+  for (int32_t i = 0; i < pParam->items; ++i) {
+    writeStealItem(pParam->pool, pParam->queue, i % 16 + 1, 0, i);
+  }
+  return NULL;
+}
+
+}  // namespace
+
+TEST(queueTest, order) {
+  STaosQueue *queue = taosOpenQueue();
+  ASSERT_TRUE(taosQueueEmpty(queue));
+
+  for (int32_t i = 0; i < 100; ++i) {
+    int32_t *pItem = (int32_t *)taosAllocateQitem(sizeof(int32_t), DEF_QITEM, 0);
+    *pItem = i;
+    ASSERT_EQ(taosWriteQitem(queue, pItem), 0);
+  }
+  ASSERT_EQ(taosQueueItemSize(queue), 100);
+
+  for (int32_t i = 0; i < 50; ++i) {
+    int32_t *pItem = NULL;
+    ASSERT_EQ(taosReadQitem(queue, (void **)&pItem), 1);
+    ASSERT_EQ(*pItem, i);
+    taosFreeQitem(pItem);
+  }
+
+  STaosQall *qall = taosAllocateQall();
+  ASSERT_EQ(taosReadAllQitems(queue, qall), 50);
+  for (int32_t i = 50; i < 100; ++i) {
+    int32_t *pItem = NULL;
+    ASSERT_EQ(taosGetQitem(qall, (void **)&pItem), 1);
+    ASSERT_EQ(*pItem, i);
+    taosFreeQitem(pItem);
+  }
+
+  void *pItem = NULL;
+  ASSERT_EQ(taosGetQitem(qall, &pItem), 0);
+  ASSERT_EQ(taosReadQitem(queue, &pItem), 0);
+  ASSERT_TRUE(taosQueueEmpty(queue));
+  ASSERT_EQ(taosQueueMemorySize(queue), 0);
+
+  taosFreeQall(qall);
+  taosCloseQueue(queue);
+}
+
+TEST(queueTest, limit) {
+  STaosQueue *queue = taosOpenQueue();
+  taosSetQueueCapacity(queue, 2);
+
+  void *p1 = taosAllocateQitem(16, DEF_QITEM, 0);
+  void *p2 = taosAllocateQitem(16, DEF_QITEM, 0);
+  void *p3 = taosAllocateQitem(16, DEF_QITEM, 0);
+  ASSERT_EQ(taosWriteQitem(queue, p1), 0);
+  ASSERT_EQ(taosWriteQitem(queue, p2), 0);
+  ASSERT_EQ(taosWriteQitem(queue, p3), TSDB_CODE_UTIL_QUEUE_OUT_OF_MEMORY);
+  ASSERT_EQ(taosQueueItemSize(queue), 2);
+  ASSERT_EQ(taosQueueMemorySize(queue), 32);
+
+  taosSetQueueCapacity(queue, 0);
+  taosSetQueueMemoryCapacity(queue, 40);
+  ASSERT_EQ(taosWriteQitem(queue, p3), TSDB_CODE_UTIL_QUEUE_OUT_OF_MEMORY);
+  ASSERT_EQ(taosQueueMemorySize(queue), 32);
+
+  taosFreeQitem(p3);
+  taosCloseQueue(queue);
+}
+
+TEST(queueTest, qset) {
+  const int32_t numOfWriters = 4;
+  const int32_t numOfItems = 10000;
+
+  STaosQset  *qset = taosOpenQset();
+  STaosQueue *queue = taosOpenQueue();
+  ASSERT_EQ(taosAddIntoQset(qset, queue, NULL), 0);
+
+  TdThread     threads[numOfWriters];
+  SWriterParam param = {.queue = queue, .items = numOfItems};
+  for (int32_t i = 0; i < numOfWriters; ++i) {
+    taosThreadCreate(&threads[i], NULL, writeItems, &param);
+  }
+
+  // items of one writer are read out in the order they are written
+  int32_t    next[numOfWriters] = {0};
+  int32_t    numOfRead = 0;
+  SQueueInfo qinfo = {0};
+  while (numOfRead < numOfWriters * numOfItems) {
+    int32_t *pItem = NULL;
+    ASSERT_EQ(taosReadQitemFromQset(qset, (void **)&pItem, &qinfo), 1);
+    ASSERT_EQ(qinfo.queue, queue);
+
+    int32_t w = 0;
+    while (w < numOfWriters && next[w] != *pItem) w++;
+    ASSERT_LT(w, numOfWriters);
+    next[w]++;
+
+    taosFreeQitem(pItem);
+    taosUpdateItemSize(queue, 1);
+    numOfRead++;
+  }
+
+  for (int32_t i = 0; i < numOfWriters; ++i) {
+    taosThreadJoin(threads[i], NULL);
+  }
+  ASSERT_TRUE(taosQueueEmpty(queue));
+
+  // the reader is resumed with no item to exit
+  void *pItem = NULL;
+  taosQsetThreadResume(qset);
+  ASSERT_EQ(taosReadQitemFromQset(qset, &pItem, &qinfo), 0);
+
+  taosCloseQueue(queue);
+  taosCloseQset(qset);
+}
+
+TEST(queueTest, concurrentPushPop) {
+  const int32_t numOfWriters = 3;
+  const int32_t numOfItems = 100000;
+
+  // the only reader keeps the queue empty, so the stub is put back behind the last node while the writers swap the tail
+  STaosQueue       *queue = taosOpenQueue();
+  int32_t           written = 0;
+  TdThread          threads[numOfWriters];
+  SCountWriterParam params[numOfWriters];
+  for (int32_t i = 0; i < numOfWriters; ++i) {
+    params[i] = {.queue = queue, .id = i, .items = numOfItems, .written = &written};
+    taosThreadCreate(&threads[i], NULL, writeCountItems, &params[i]);
+  }
+
+  int32_t next[numOfWriters] = {0};
+  int32_t numOfRead = 0;
+  while (numOfRead < numOfWriters * numOfItems) {
+    int32_t  done = atomic_load_32(&written);
+    int32_t *pItem = NULL;
+    if (taosReadQitem(queue, (void **)&pItem) == 0) {
+      // an item whose write is done before the read is never missed
+      ASSERT_EQ(done, numOfRead);
+      continue;
+    }
+
+    int32_t w = *pItem >> 20;
+    ASSERT_LT(w, numOfWriters);
+    ASSERT_EQ(*pItem & ((1 << 20) - 1), next[w]);
+    next[w]++;
+    taosFreeQitem(pItem);
+    numOfRead++;
+  }
+
+  for (int32_t i = 0; i < numOfWriters; ++i) {
+    taosThreadJoin(threads[i], NULL);
+  }
+
+  void *pItem = NULL;
+  ASSERT_EQ(taosReadQitem(queue, &pItem), 0);
+  ASSERT_TRUE(taosQueueEmpty(queue));
+  ASSERT_EQ(taosQueueMemorySize(queue), 0);
+  taosCloseQueue(queue);
+}
+
+TEST(queueTest, stealWorker) {
+  SStealWorkerPool pool = {0};
+  pool.name = "steal-test";
+  pool.num = 4;
+  ASSERT_EQ(tStealWorkerInit(&pool), 0);
+
+  STaosQueue *queue = tStealWorkerAllocQueue(&pool, NULL, (FItem)processStealItem);
+  ASSERT_NE(queue, nullptr);
+
+  stealProcessed = 0;
+  SStealWriterParam param = {.pool = &pool, .queue = queue, .items = 10000};
+  TdThread          writers[2];
+  for (int32_t i = 0; i < 2; ++i) {
+    taosThreadCreate(&writers[i], NULL, writeStealItems, &param);
+  }
+  for (int32_t i = 0; i < 2; ++i) {
+    taosThreadJoin(writers[i], NULL);
+  }
+
+  while (!taosQueueEmpty(queue)) taosMsleep(1);
+  ASSERT_EQ(atomic_load_32(&stealProcessed), 20000);
+  ASSERT_EQ(taosQueueMemorySize(queue), 0);
+
+  int64_t items = 0;
+  for (int32_t i = 0; i < pool.num; ++i) {
+    SStealWorkerStat stat;
+    tStealWorkerGetStat(&pool, i, &stat);
+    items += stat.numOfItems;
+  }
+  ASSERT_EQ(items, 20000);
+
+  // the pool stat exported to the monitor sums the workers, every item is counted once in the wait histograms
+  SStealWorkerPoolStat poolStat;
+  tStealWorkerGetPoolStat(&pool, &poolStat);
+  ASSERT_EQ(poolStat.numOfWorkers, 4);
+  ASSERT_EQ(poolStat.numOfQueued, 0);
+  ASSERT_EQ(poolStat.stat.numOfItems, 20000);
+  int64_t waits = 0;
+  for (int32_t i = 0; i < STEAL_WORKER_HIST; ++i) {
+    waits += poolStat.stat.waitHist[STEAL_WORKER_HIGH][i] + poolStat.stat.waitHist[STEAL_WORKER_LOW][i];
+  }
+  ASSERT_EQ(waits, 20000);
+
+  tStealWorkerCleanup(&pool);
+  tStealWorkerFreeQueue(&pool, queue);
+}
+
+TEST(queueTest, stealWorkerPriority) {
+  SStealWorkerPool pool = {0};
+  pool.name = "steal-prio";
+  pool.num = 1;
+  pool.demoteUs = 1000;
+  pool.keyFp = getStealItemKey;
+  ASSERT_EQ(tStealWorkerInit(&pool), 0);
+
+  STaosQueue *queue = tStealWorkerAllocQueue(&pool, NULL, (FItem)processStealItem);
+  ASSERT_NE(queue, nullptr);
+
+  // key 1 consumes more than demoteUs, its later items go to the low class
+  stealProcessed = 0;
+  writeStealItem(&pool, queue, 1, 5, 0);
+  while (!taosQueueEmpty(queue)) taosMsleep(1);
+
+  // hold the only worker, so that the order of the queued items is decided by their class
+  stealGate = 0;
+  writeStealItem(&pool, queue, 3, -1, 1);
+  while (atomic_load_32(&pool.numOfItems) > 0) taosMsleep(1);
+  writeStealItem(&pool, queue, 1, 0, 2);
+  writeStealItem(&pool, queue, 1, 0, 3);
+  writeStealItem(&pool, queue, 2, 0, 4);
+
+  SStealWorkerPoolStat poolStat;
+  tStealWorkerGetPoolStat(&pool, &poolStat);
+  ASSERT_EQ(poolStat.numOfQueued, 3);
+  atomic_store_8(&stealGate, 1);
+
+  while (!taosQueueEmpty(queue)) taosMsleep(1);
+  ASSERT_EQ(stealProcessed, 5);
+  ASSERT_EQ(stealOrder[2], 4);
+  ASSERT_EQ(stealOrder[3], 2);
+  ASSERT_EQ(stealOrder[4], 3);
+
+  tStealWorkerCleanup(&pool);
+  tStealWorkerFreeQueue(&pool, queue);
+}
@@ -59,7 +59,7 @@ class TDTestCase:
             'ins_indexes','ins_stables','ins_tables','ins_tags','ins_columns','ins_users','ins_grants','ins_vgroups','ins_configs','ins_dnode_variables',\
                 'ins_topics','ins_subscriptions','ins_streams','ins_stream_tasks','ins_vnodes','ins_user_privileges','ins_views',
                 'ins_compacts', 'ins_compact_details']
-        self.perf_list = ['perf_connections','perf_queries','perf_consumers','perf_trans','perf_apps']
+        self.perf_list = ['perf_connections','perf_queries','perf_consumers','perf_trans','perf_apps','perf_last_cache','perf_page_cache','perf_write_stall','perf_stt_merge']
     def insert_data(self,column_dict,tbname,row_num):
         insert_sql = self.setsql.set_insertsql(column_dict,tbname,self.binary_str,self.nchar_str)
         for i in range(row_num):
@@ -221,7 +221,7 @@ class TDTestCase:
         tdSql.checkEqual(219, len(tdSql.queryResult))
 
         tdSql.query("select * from information_schema.ins_columns where db_name ='performance_schema'")
-        tdSql.checkEqual(54, len(tdSql.queryResult))
+        tdSql.checkEqual(84, len(tdSql.queryResult))
 
     def ins_dnodes_check(self):
         tdSql.execute('drop database if exists db2')
@@ -201,6 +201,18 @@ class TDTestCase:
         tdSql.query('select * from performance_schema.perf_apps')
         tdSql.checkNotEqual(tdSql.queryResult[rowIndex][11],0)             #column 11:slow_query  at least one slow query: create db.
 
+        tdSql.query('select vgroup_id, hits, misses, evictions from performance_schema.perf_last_cache')
+        tdSql.checkNotEqual(tdSql.queryRows,0)                              #one row for each vgroup
+
+        tdSql.query('select vgroup_id, hits, misses from performance_schema.perf_page_cache')
+        tdSql.checkNotEqual(tdSql.queryRows,0)                              #one row for each vgroup
+
+        tdSql.query('select vgroup_id, buffer_used, buffer_size, stalls, stall_time from performance_schema.perf_write_stall')
+        tdSql.checkNotEqual(tdSql.queryRows,0)                              #one row for each vgroup
+
+        tdSql.query('select vgroup_id, policy, merges, bytes_read, bytes_written from performance_schema.perf_stt_merge')
+        tdSql.checkNotEqual(tdSql.queryRows,0)                              #one row for each vgroup
+
     def run(self):
         self.prepare_data()
         self.count_check()